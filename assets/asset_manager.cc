@@ -19,6 +19,7 @@ bool AssetManager::PushFront(std::unique_ptr<AssetResolver> resolver) {
   }
 
   resolvers_.push_front(std::move(resolver));
+  ClearNegativeCache();
   return true;
 }
 
@@ -28,6 +29,7 @@ bool AssetManager::PushBack(std::unique_ptr<AssetResolver> resolver) {
   }
 
   resolvers_.push_back(std::move(resolver));
+  ClearNegativeCache();
   return true;
 }
 
@@ -53,6 +55,12 @@ void AssetManager::UpdateResolverByType(
     new_resolvers.push_back(std::move(updated_asset_resolver));
   }
   resolvers_.swap(new_resolvers);
+  ClearNegativeCache();
+}
+
+void AssetManager::ClearNegativeCache() {
+  std::scoped_lock lock(negative_cache_mutex_);
+  negative_cache_.clear();
 }
 
 std::deque<std::unique_ptr<AssetResolver>> AssetManager::TakeResolvers() {
@@ -67,16 +75,79 @@ std::unique_ptr<fml::Mapping> AssetManager::GetAsMapping(
   }
   TRACE_EVENT1("flutter", "AssetManager::GetAsMapping", "name",
                asset_name.c_str());
+  {
+    std::scoped_lock lock(negative_cache_mutex_);
+    if (negative_cache_.count(asset_name) > 0) {
+      return nullptr;
+    }
+  }
   for (const auto& resolver : resolvers_) {
     auto mapping = resolver->GetAsMapping(asset_name);
     if (mapping != nullptr) {
       return mapping;
     }
   }
+  {
+    std::scoped_lock lock(negative_cache_mutex_);
+    negative_cache_.insert(asset_name);
+  }
   FML_DLOG(WARNING) << "Could not find asset: " << asset_name;
   return nullptr;
 }
 
+std::shared_ptr<AssetManager::BatchQuery> AssetManager::GetAsMappingsBatch(
+    const std::vector<std::string>& asset_names,
+    const std::vector<fml::RefPtr<fml::TaskRunner>>& workers,
+    BatchCallback callback) const {
+  TRACE_EVENT0("flutter", "AssetManager::GetAsMappingsBatch");
+  auto query = std::make_shared<BatchQuery>();
+  if (asset_names.empty()) {
+    callback({});
+    return query;
+  }
+  if (workers.empty()) {
+    // No workers to spread the probes over; resolve inline.
+    std::vector<std::unique_ptr<fml::Mapping>> results;
+    results.reserve(asset_names.size());
+    for (const auto& asset_name : asset_names) {
+      results.push_back(GetAsMapping(asset_name));
+    }
+    callback(std::move(results));
+    return query;
+  }
+
+  struct BatchState {
+    std::mutex mutex;
+    size_t remaining;
+    std::vector<std::unique_ptr<fml::Mapping>> results;
+    AssetManager::BatchCallback callback;
+  };
+  auto state = std::make_shared<BatchState>();
+  state->remaining = asset_names.size();
+  state->results.resize(asset_names.size());
+  state->callback = std::move(callback);
+
+  for (size_t i = 0; i < asset_names.size(); i++) {
+    workers[i % workers.size()]->PostTask(
+        [this, state, query, asset_name = asset_names[i], i]() {
+          std::unique_ptr<fml::Mapping> mapping;
+          if (!query->IsCancelled()) {
+            mapping = GetAsMapping(asset_name);
+          }
+          bool completed = false;
+          {
+            std::scoped_lock lock(state->mutex);
+            state->results[i] = std::move(mapping);
+            completed = --state->remaining == 0;
+          }
+          if (completed && !query->IsCancelled()) {
+            state->callback(std::move(state->results));
+          }
+        });
+  }
+  return query;
+}
+
 // |AssetResolver|
 std::vector<std::unique_ptr<fml::Mapping>> AssetManager::GetAsMappings(
     const std::string& asset_pattern,
@@ -5,14 +5,20 @@
 #ifndef FLUTTER_ASSETS_ASSET_MANAGER_H_
 #define FLUTTER_ASSETS_ASSET_MANAGER_H_
 
+#include <atomic>
 #include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <string>
+#include <vector>
 
 #include <optional>
 #include "flutter/assets/asset_resolver.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/ref_counted.h"
+#include "flutter/fml/task_runner.h"
 
 namespace flutter {
 
@@ -70,6 +76,45 @@ class AssetManager final : public AssetResolver {
 
   std::deque<std::unique_ptr<AssetResolver>> TakeResolvers();
 
+  //--------------------------------------------------------------------------
+  /// @brief      A handle to an in-flight |GetAsMappingsBatch| query that
+  ///             allows the caller to cancel it. Cancellation is best
+  ///             effort: probes that have not started yet are skipped and
+  ///             the callback is never invoked, but probes already running
+  ///             on a worker are allowed to finish.
+  class BatchQuery {
+   public:
+    void Cancel() { cancelled_ = true; }
+
+    bool IsCancelled() const { return cancelled_; }
+
+   private:
+    std::atomic<bool> cancelled_ = false;
+  };
+
+  using BatchCallback =
+      std::function<void(std::vector<std::unique_ptr<fml::Mapping>>)>;
+
+  //--------------------------------------------------------------------------
+  /// @brief      Resolves a batch of assets concurrently on the given worker
+  ///             task runners instead of serially on the calling thread.
+  ///             Each asset still probes the resolver queue in priority
+  ///             order; the parallelism is across asset names, which is
+  ///             where startup bursts (font manifests, image assets) spend
+  ///             their time. Misses are remembered so repeated lookups of
+  ///             absent assets skip the resolver probes entirely.
+  ///
+  ///             The callback receives one mapping per requested name, in
+  ///             request order, with null entries for missing assets. It is
+  ///             invoked on the worker that completes the last probe, or
+  ///             synchronously when no workers are supplied. The asset
+  ///             manager must be kept alive until the callback has run or
+  ///             the query was cancelled and the in-flight probes finished.
+  std::shared_ptr<BatchQuery> GetAsMappingsBatch(
+      const std::vector<std::string>& asset_names,
+      const std::vector<fml::RefPtr<fml::TaskRunner>>& workers,
+      BatchCallback callback) const;
+
   // |AssetResolver|
   bool IsValid() const override;
 
@@ -91,6 +136,14 @@ class AssetManager final : public AssetResolver {
  private:
   std::deque<std::unique_ptr<AssetResolver>> resolvers_;
 
+  void ClearNegativeCache();
+
+  // Names that no resolver could satisfy. Cleared whenever the resolver
+  // queue changes since a new resolver may satisfy previously missing
+  // assets.
+  mutable std::mutex negative_cache_mutex_;
+  mutable std::set<std::string> negative_cache_;
+
   FML_DISALLOW_COPY_AND_ASSIGN(AssetManager);
 };
 
@@ -0,0 +1,336 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/assets/asset_pack_bundle.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <regex>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+#include "third_party/zlib/zlib.h"
+
+namespace flutter {
+
+namespace {
+
+// Reads |size| bytes at |*offset| into |out|, advancing the offset. Returns
+// false if the read would run past the end of the pack.
+bool ReadBytes(const fml::Mapping& pack,
+               size_t* offset,
+               void* out,
+               size_t size) {
+  if (pack.GetSize() < *offset || pack.GetSize() - *offset < size) {
+    return false;
+  }
+  memcpy(out, pack.GetMapping() + *offset, size);
+  *offset += size;
+  return true;
+}
+
+// A mapping that inflates its asset out of the pack file the first time it is
+// touched. Assets that are resolved but never touched stay compressed, and
+// the inflation happens on whatever thread first touches the mapping (the IO
+// task runner for the engine's own asset loads).
+//
+// Block offset tables are validated when the directory is parsed, so the
+// only failure left at inflation time is a corrupt deflate stream (which
+// zlib detects via its checksum). In that case the mapping presents itself
+// as empty - size zero and a null data pointer - so that callers sizing a
+// copy from |GetSize| never read past a null |GetMapping|. Both accessors
+// therefore trigger the inflation.
+class LazyInflatedMapping final : public fml::Mapping {
+ public:
+  LazyInflatedMapping(std::shared_ptr<fml::Mapping> pack,
+                      uint64_t data_size,
+                      uint64_t block_table_offset,
+                      uint32_t block_size)
+      : pack_(std::move(pack)),
+        data_size_(data_size),
+        block_table_offset_(block_table_offset),
+        block_size_(block_size) {}
+
+  // |fml::Mapping|
+  size_t GetSize() const override {
+    std::call_once(inflate_once_, [this]() { Inflate(); });
+    return data_.size();
+  }
+
+  // |fml::Mapping|
+  const uint8_t* GetMapping() const override {
+    std::call_once(inflate_once_, [this]() { Inflate(); });
+    return data_.empty() ? nullptr : data_.data();
+  }
+
+  // |fml::Mapping|
+  bool IsDontNeedSafe() const override { return false; }
+
+ private:
+  void Inflate() const {
+    TRACE_EVENT0("flutter", "LazyInflatedMapping::Inflate");
+    data_.resize(data_size_);
+    uint64_t num_blocks =
+        data_size_ == 0 ? 0 : (data_size_ + block_size_ - 1) / block_size_;
+    const uint8_t* pack_data = pack_->GetMapping();
+    for (uint64_t i = 0; i < num_blocks; i++) {
+      uint64_t offsets[2];
+      memcpy(offsets,
+             pack_data + block_table_offset_ + i * sizeof(uint64_t),
+             sizeof(offsets));
+      uLongf expected_size =
+          std::min<uint64_t>(block_size_, data_size_ - i * block_size_);
+      uLongf inflated_size = expected_size;
+      if (uncompress(data_.data() + i * block_size_, &inflated_size,
+                     pack_data + offsets[0],
+                     offsets[1] - offsets[0]) != Z_OK ||
+          inflated_size != expected_size) {
+        FML_LOG(ERROR) << "Could not inflate asset pack block.";
+        data_.clear();
+        data_.shrink_to_fit();
+        return;
+      }
+    }
+  }
+
+  const std::shared_ptr<fml::Mapping> pack_;
+  const uint64_t data_size_;
+  const uint64_t block_table_offset_;
+  const uint32_t block_size_;
+  mutable std::once_flag inflate_once_;
+  mutable std::vector<uint8_t> data_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(LazyInflatedMapping);
+};
+
+}  // namespace
+
+std::unique_ptr<fml::MallocMapping> AssetPackBundle::BuildPack(
+    const std::vector<std::pair<std::string, const fml::Mapping*>>& assets,
+    uint32_t block_size) {
+  if (block_size == 0) {
+    return nullptr;
+  }
+
+  PackHeader header;
+  header.entry_count = assets.size();
+  header.block_size = block_size;
+
+  size_t directory_size = sizeof(PackHeader);
+  for (const auto& asset : assets) {
+    directory_size +=
+        sizeof(uint32_t) + 2 * sizeof(uint64_t) + asset.first.size();
+  }
+
+  // Compress every block up front so the directory and block offset tables
+  // can be written with absolute offsets.
+  struct PackedAsset {
+    uint64_t data_size = 0;
+    uint64_t table_offset = 0;
+    std::vector<uint64_t> block_offsets;
+    std::vector<uint8_t> compressed;
+  };
+  std::vector<PackedAsset> packed;
+  uint64_t offset = directory_size;
+  for (const auto& asset : assets) {
+    const fml::Mapping* mapping = asset.second;
+    PackedAsset packed_asset;
+    packed_asset.data_size = mapping->GetSize();
+    packed_asset.table_offset = offset;
+    uint64_t num_blocks =
+        packed_asset.data_size == 0
+            ? 0
+            : (packed_asset.data_size + block_size - 1) / block_size;
+    uint64_t data_offset = offset + (num_blocks + 1) * sizeof(uint64_t);
+    packed_asset.block_offsets.push_back(data_offset);
+    for (uint64_t i = 0; i < num_blocks; i++) {
+      uLong source_size = std::min<uint64_t>(
+          block_size, packed_asset.data_size - i * block_size);
+      uLongf compressed_size = compressBound(source_size);
+      size_t old_size = packed_asset.compressed.size();
+      packed_asset.compressed.resize(old_size + compressed_size);
+      if (compress2(packed_asset.compressed.data() + old_size,
+                    &compressed_size, mapping->GetMapping() + i * block_size,
+                    source_size, Z_DEFAULT_COMPRESSION) != Z_OK) {
+        return nullptr;
+      }
+      packed_asset.compressed.resize(old_size + compressed_size);
+      data_offset += compressed_size;
+      packed_asset.block_offsets.push_back(data_offset);
+    }
+    offset = data_offset;
+    packed.push_back(std::move(packed_asset));
+  }
+
+  size_t total_size = offset;
+  uint8_t* mapping_buf = reinterpret_cast<uint8_t*>(malloc(total_size));
+  if (!mapping_buf) {
+    return nullptr;
+  }
+  auto result = std::make_unique<fml::MallocMapping>(mapping_buf, total_size);
+
+  memcpy(mapping_buf, &header, sizeof(header));
+  mapping_buf += sizeof(header);
+  for (size_t i = 0; i < assets.size(); i++) {
+    const std::string& name = assets[i].first;
+    uint32_t name_size = name.size();
+    memcpy(mapping_buf, &name_size, sizeof(name_size));
+    mapping_buf += sizeof(name_size);
+    memcpy(mapping_buf, &packed[i].data_size, sizeof(uint64_t));
+    mapping_buf += sizeof(uint64_t);
+    memcpy(mapping_buf, &packed[i].table_offset, sizeof(uint64_t));
+    mapping_buf += sizeof(uint64_t);
+    memcpy(mapping_buf, name.data(), name.size());
+    mapping_buf += name.size();
+  }
+  for (const auto& packed_asset : packed) {
+    size_t table_size = packed_asset.block_offsets.size() * sizeof(uint64_t);
+    memcpy(mapping_buf, packed_asset.block_offsets.data(), table_size);
+    mapping_buf += table_size;
+    memcpy(mapping_buf, packed_asset.compressed.data(),
+           packed_asset.compressed.size());
+    mapping_buf += packed_asset.compressed.size();
+  }
+
+  return result;
+}
+
+AssetPackBundle::AssetPackBundle(std::unique_ptr<fml::Mapping> pack,
+                                 bool is_valid_after_asset_manager_change)
+    : pack_(std::move(pack)) {
+  if (!ParseDirectory()) {
+    FML_DLOG(WARNING) << "Asset pack was not valid.";
+    return;
+  }
+  is_valid_after_asset_manager_change_ = is_valid_after_asset_manager_change;
+  is_valid_ = true;
+}
+
+AssetPackBundle::~AssetPackBundle() = default;
+
+bool AssetPackBundle::ParseDirectory() {
+  if (!pack_ || pack_->GetMapping() == nullptr) {
+    return false;
+  }
+  PackHeader header;
+  size_t offset = 0;
+  if (!ReadBytes(*pack_, &offset, &header, sizeof(header))) {
+    return false;
+  }
+  if (header.signature != PackHeader::kSignature ||
+      header.version != PackHeader::kVersion1 || header.block_size == 0) {
+    return false;
+  }
+  block_size_ = header.block_size;
+  for (uint32_t i = 0; i < header.entry_count; i++) {
+    uint32_t name_size = 0;
+    AssetEntry entry;
+    if (!ReadBytes(*pack_, &offset, &name_size, sizeof(name_size)) ||
+        !ReadBytes(*pack_, &offset, &entry.data_size,
+                   sizeof(entry.data_size)) ||
+        !ReadBytes(*pack_, &offset, &entry.block_table_offset,
+                   sizeof(entry.block_table_offset))) {
+      return false;
+    }
+    if (pack_->GetSize() - offset < name_size) {
+      return false;
+    }
+    std::string name(
+        reinterpret_cast<const char*>(pack_->GetMapping() + offset),
+        name_size);
+    offset += name_size;
+    uint64_t num_blocks =
+        entry.data_size == 0
+            ? 0
+            : (entry.data_size + block_size_ - 1) / block_size_;
+    uint64_t table_size = (num_blocks + 1) * sizeof(uint64_t);
+    if (entry.block_table_offset > pack_->GetSize() ||
+        pack_->GetSize() - entry.block_table_offset < table_size) {
+      return false;
+    }
+    // Validate the block offset table contents up front so that a corrupt
+    // pack is rejected here rather than when an asset is first touched.
+    uint64_t previous_offset = 0;
+    for (uint64_t block = 0; block <= num_blocks; block++) {
+      uint64_t block_offset;
+      memcpy(&block_offset,
+             pack_->GetMapping() + entry.block_table_offset +
+                 block * sizeof(uint64_t),
+             sizeof(block_offset));
+      if (block_offset > pack_->GetSize() ||
+          (block > 0 && block_offset < previous_offset)) {
+        return false;
+      }
+      previous_offset = block_offset;
+    }
+    entries_[std::move(name)] = entry;
+  }
+  return true;
+}
+
+// |AssetResolver|
+bool AssetPackBundle::IsValid() const {
+  return is_valid_;
+}
+
+// |AssetResolver|
+bool AssetPackBundle::IsValidAfterAssetManagerChange() const {
+  return is_valid_after_asset_manager_change_;
+}
+
+// |AssetResolver|
+AssetResolver::AssetResolverType AssetPackBundle::GetType() const {
+  return AssetResolver::AssetResolverType::kAssetPackBundle;
+}
+
+// |AssetResolver|
+std::unique_ptr<fml::Mapping> AssetPackBundle::GetAsMapping(
+    const std::string& asset_name) const {
+  if (!is_valid_) {
+    FML_DLOG(WARNING) << "Asset bundle was not valid.";
+    return nullptr;
+  }
+  auto found = entries_.find(asset_name);
+  if (found == entries_.end()) {
+    return nullptr;
+  }
+  return std::make_unique<LazyInflatedMapping>(pack_, found->second.data_size,
+                                               found->second.block_table_offset,
+                                               block_size_);
+}
+
+// |AssetResolver|
+std::vector<std::unique_ptr<fml::Mapping>> AssetPackBundle::GetAsMappings(
+    const std::string& asset_pattern,
+    const std::optional<std::string>& subdir) const {
+  std::vector<std::unique_ptr<fml::Mapping>> mappings;
+  if (!is_valid_) {
+    FML_DLOG(WARNING) << "Asset bundle was not valid.";
+    return mappings;
+  }
+
+  std::regex asset_regex(asset_pattern);
+  for (const auto& [name, entry] : entries_) {
+    size_t last_slash = name.rfind('/');
+    std::string basename =
+        last_slash == std::string::npos ? name : name.substr(last_slash + 1);
+    if (subdir) {
+      // A flat search within the subdirectory, mirroring the directory
+      // bundle's behavior.
+      if (name != subdir.value() + "/" + basename) {
+        continue;
+      }
+    }
+    if (!std::regex_match(basename, asset_regex)) {
+      continue;
+    }
+    mappings.push_back(std::make_unique<LazyInflatedMapping>(
+        pack_, entry.data_size, entry.block_table_offset, block_size_));
+  }
+
+  return mappings;
+}
+
+}  // namespace flutter
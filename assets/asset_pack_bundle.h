@@ -0,0 +1,111 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_ASSETS_ASSET_PACK_BUNDLE_H_
+#define FLUTTER_ASSETS_ASSET_PACK_BUNDLE_H_
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "flutter/assets/asset_resolver.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// An AssetResolver that serves assets out of a single pack file.
+///
+/// The pack file holds a directory index followed by per-asset data that is
+/// deflate-compressed in fixed-size blocks. The whole file is accessed
+/// through one mapping; an asset's blocks are only inflated the first time
+/// the mapping returned by |GetAsMapping| is touched, so assets that are
+/// never touched are never decompressed.
+///
+/// |RunConfiguration| installs one of these ahead of the corresponding
+/// |DirectoryAssetBundle| whenever the asset directory contains a
+/// |kPackFileName| file, so a pack can be shipped alongside (or instead of)
+/// loose asset files.
+///
+class AssetPackBundle : public AssetResolver {
+ public:
+  // Layout of the fixed-size header at the start of a pack file. The header
+  // is followed by |entry_count| directory records, each of which is a
+  // uint32_t name size, a uint64_t uncompressed data size, a uint64_t
+  // absolute file offset of the asset's block offset table, and the name
+  // bytes. A block offset table holds N + 1 uint64_t absolute file offsets
+  // delimiting the asset's N compressed blocks.
+  struct PackHeader {
+    // A prefix used to identify the pack file format.
+    static const uint32_t kSignature = 0x6B617046;
+    static const uint32_t kVersion1 = 1;
+
+    uint32_t signature = kSignature;
+    uint32_t version = kVersion1;
+    uint32_t entry_count = 0;
+    // Number of uncompressed bytes covered by each compressed block.
+    uint32_t block_size = 0;
+  };
+
+  static constexpr uint32_t kDefaultBlockSize = 64 * 1024;
+
+  // The file name the engine probes for inside an asset directory when
+  // assembling the resolver queue; see |RunConfiguration|.
+  static constexpr const char* kPackFileName = "assets.pack";
+
+  // Serialize the given assets into the pack file format. This is meant for
+  // tooling and tests; the engine only reads packs.
+  static std::unique_ptr<fml::MallocMapping> BuildPack(
+      const std::vector<std::pair<std::string, const fml::Mapping*>>& assets,
+      uint32_t block_size = kDefaultBlockSize);
+
+  AssetPackBundle(std::unique_ptr<fml::Mapping> pack,
+                  bool is_valid_after_asset_manager_change);
+
+  ~AssetPackBundle() override;
+
+ private:
+  struct AssetEntry {
+    uint64_t data_size = 0;
+    uint64_t block_table_offset = 0;
+  };
+
+  const std::shared_ptr<fml::Mapping> pack_;
+  std::map<std::string, AssetEntry> entries_;
+  uint32_t block_size_ = 0;
+  bool is_valid_ = false;
+  bool is_valid_after_asset_manager_change_ = false;
+
+  // |AssetResolver|
+  bool IsValid() const override;
+
+  // |AssetResolver|
+  bool IsValidAfterAssetManagerChange() const override;
+
+  // |AssetResolver|
+  AssetResolver::AssetResolverType GetType() const override;
+
+  // |AssetResolver|
+  std::unique_ptr<fml::Mapping> GetAsMapping(
+      const std::string& asset_name) const override;
+
+  // |AssetResolver|
+  std::vector<std::unique_ptr<fml::Mapping>> GetAsMappings(
+      const std::string& asset_pattern,
+      const std::optional<std::string>& subdir) const override;
+
+  // Reads the directory index out of the pack, validating that every record
+  // and block offset table lies within the mapping.
+  bool ParseDirectory();
+
+  FML_DISALLOW_COPY_AND_ASSIGN(AssetPackBundle);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_ASSETS_ASSET_PACK_BUNDLE_H_
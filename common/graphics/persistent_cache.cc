@@ -78,6 +78,10 @@ void PersistentCache::SetCacheDirectoryPath(std::string path) {
   cache_base_path_ = std::move(path);
 }
 
+std::string PersistentCache::GetCacheDirectoryPath() {
+  return cache_base_path_;
+}
+
 bool PersistentCache::Purge() {
   // Make sure that this is called after the worker task runner setup so all the
   // file system modifications would happen on that single thread to avoid
@@ -241,7 +245,24 @@ std::vector<PersistentCache::SkSLCache> PersistentCache::LoadSkSLs() const {
     fml::UniqueFD fresh_dir =
         fml::OpenDirectoryReadOnly(*cache_directory_, kSkSLSubdirName);
     if (fresh_dir.is_valid()) {
-      fml::VisitFiles(fresh_dir, visitor);
+      // Opening every cache entry separately costs hundreds of small file
+      // reads on a warm start. The entries are therefore consolidated into a
+      // single pack file that can be brought in with one mapping; the
+      // per-file scan only runs when the pack is missing or out of date
+      // (e.g., new shaders were cached during the previous run), and then
+      // rebuilds the pack for the next launch.
+      size_t file_count = 0;
+      fml::VisitFiles(fresh_dir, [&file_count](const fml::UniqueFD& directory,
+                                               const std::string& filename) {
+        file_count++;
+        return true;
+      });
+      if (!LoadSkSLPack(file_count, &result)) {
+        fml::VisitFiles(fresh_dir, visitor);
+        if (!result.empty()) {
+          StoreSkSLPack(result);
+        }
+      }
     }
   }
 
@@ -275,6 +296,53 @@ std::vector<PersistentCache::SkSLCache> PersistentCache::LoadSkSLs() const {
   return result;
 }
 
+bool PersistentCache::LoadSkSLPack(size_t expected_count,
+                                   std::vector<SkSLCache>* result) const {
+  auto file = fml::OpenFileReadOnly(*cache_directory_, kSkSLPackFileName);
+  if (!file.is_valid()) {
+    return false;
+  }
+  auto mapping = std::make_unique<fml::FileMapping>(file);
+  const uint8_t* data = mapping->GetMapping();
+  size_t size = mapping->GetSize();
+  if (size < sizeof(SkSLPackHeader)) {
+    return false;
+  }
+  SkSLPackHeader header(0);
+  memcpy(&header, data, sizeof(SkSLPackHeader));
+  if (header.signature != SkSLPackHeader::kSignature ||
+      header.version != SkSLPackHeader::kVersion1) {
+    FML_LOG(INFO) << "SkSL pack header is corrupt: " << kSkSLPackFileName;
+    return false;
+  }
+  if (header.entry_count != expected_count) {
+    // New entries were cached since the pack was built.
+    return false;
+  }
+  std::vector<SkSLCache> entries;
+  size_t offset = sizeof(SkSLPackHeader);
+  for (uint32_t i = 0; i < header.entry_count; i++) {
+    uint32_t sizes[2];
+    if (size - offset < sizeof(sizes)) {
+      FML_LOG(INFO) << "SkSL pack size is corrupt: " << kSkSLPackFileName;
+      return false;
+    }
+    memcpy(sizes, data + offset, sizeof(sizes));
+    offset += sizeof(sizes);
+    if (size - offset < static_cast<uint64_t>(sizes[0]) + sizes[1]) {
+      FML_LOG(INFO) << "SkSL pack size is corrupt: " << kSkSLPackFileName;
+      return false;
+    }
+    sk_sp<SkData> key = SkData::MakeWithCopy(data + offset, sizes[0]);
+    offset += sizes[0];
+    sk_sp<SkData> value = SkData::MakeWithCopy(data + offset, sizes[1]);
+    offset += sizes[1];
+    entries.push_back({key, value});
+  }
+  result->insert(result->end(), entries.begin(), entries.end());
+  return true;
+}
+
 PersistentCache::PersistentCache(bool read_only)
     : is_read_only_(read_only),
       cache_directory_(MakeCacheDirectory(cache_base_path_, read_only, false)),
@@ -395,6 +463,51 @@ std::unique_ptr<fml::MallocMapping> PersistentCache::BuildCacheObject(
   return mapping;
 }
 
+std::unique_ptr<fml::MallocMapping> PersistentCache::BuildSkSLPack(
+    const std::vector<SkSLCache>& entries) {
+  size_t total_size = sizeof(SkSLPackHeader);
+  for (const auto& entry : entries) {
+    total_size += 2 * sizeof(uint32_t) + entry.key->size() +
+                  entry.value->size();
+  }
+  uint8_t* mapping_buf = reinterpret_cast<uint8_t*>(malloc(total_size));
+  if (!mapping_buf) {
+    return nullptr;
+  }
+  auto mapping = std::make_unique<fml::MallocMapping>(mapping_buf, total_size);
+
+  SkSLPackHeader header(entries.size());
+  memcpy(mapping_buf, &header, sizeof(SkSLPackHeader));
+  mapping_buf += sizeof(SkSLPackHeader);
+  for (const auto& entry : entries) {
+    uint32_t sizes[2] = {static_cast<uint32_t>(entry.key->size()),
+                         static_cast<uint32_t>(entry.value->size())};
+    memcpy(mapping_buf, sizes, sizeof(sizes));
+    mapping_buf += sizeof(sizes);
+    memcpy(mapping_buf, entry.key->data(), entry.key->size());
+    mapping_buf += entry.key->size();
+    memcpy(mapping_buf, entry.value->data(), entry.value->size());
+    mapping_buf += entry.value->size();
+  }
+
+  return mapping;
+}
+
+void PersistentCache::StoreSkSLPack(
+    const std::vector<SkSLCache>& entries) const {
+  if (is_read_only_) {
+    return;
+  }
+
+  std::unique_ptr<fml::MallocMapping> mapping = BuildSkSLPack(entries);
+  if (!mapping) {
+    return;
+  }
+
+  PersistentCacheStore(GetWorkerTaskRunner(), cache_directory_,
+                       kSkSLPackFileName, std::move(mapping));
+}
+
 // |GrContextOptions::PersistentCache|
 void PersistentCache::store(const SkData& key, const SkData& data) {
   stored_new_shaders_ = true;
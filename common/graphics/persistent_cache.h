@@ -43,6 +43,10 @@ class PersistentCache : public GrContextOptions::PersistentCache {
   // affect the cache directory returned by |GetCacheForProcess|.
   static void SetCacheDirectoryPath(std::string path);
 
+  // The directory path set by |SetCacheDirectoryPath|, or an empty string if
+  // the embedder did not supply one.
+  static std::string GetCacheDirectoryPath();
+
   // Convert a binary SkData key into a Base32 encoded string.
   //
   // This is used to specify persistent cache filenames and service protocol
@@ -68,6 +72,22 @@ class PersistentCache : public GrContextOptions::PersistentCache {
     uint32_t key_size;
   };
 
+  // Header written into the single file that consolidates all the SkSL cache
+  // entries. The header is followed by |entry_count| entries, each a pair of
+  // uint32_t sizes (key, value) followed by the key and value bytes.
+  struct SkSLPackHeader {
+    // A prefix used to identify the SkSL pack file format.
+    static const uint32_t kSignature = 0x4B435053;
+    static const uint32_t kVersion1 = 1;
+
+    explicit SkSLPackHeader(uint32_t p_entry_count)
+        : entry_count(p_entry_count) {}
+
+    uint32_t signature = kSignature;
+    uint32_t version = kVersion1;
+    uint32_t entry_count;
+  };
+
   ~PersistentCache() override;
 
   void AddWorkerTaskRunner(const fml::RefPtr<fml::TaskRunner>& task_runner);
@@ -96,8 +116,17 @@ class PersistentCache : public GrContextOptions::PersistentCache {
   };
 
   /// Load all the SkSL shader caches in the right directory.
+  ///
+  /// The caches are read from a single memory-mapped pack file when one is
+  /// present and up to date; otherwise every cache file is opened separately
+  /// and the pack file is rebuilt for the next launch.
   std::vector<SkSLCache> LoadSkSLs() const;
 
+  // Allocate a MallocMapping consolidating the given SkSL caches in the
+  // single-file pack format read by |LoadSkSLs|.
+  static std::unique_ptr<fml::MallocMapping> BuildSkSLPack(
+      const std::vector<SkSLCache>& entries);
+
   //----------------------------------------------------------------------------
   /// @brief      Precompile SkSLs packaged with the application and gathered
   ///             during previous runs in the given context.
@@ -130,6 +159,7 @@ class PersistentCache : public GrContextOptions::PersistentCache {
   static void MarkStrategySet() { strategy_set_ = true; }
 
   static constexpr char kSkSLSubdirName[] = "sksl";
+  static constexpr char kSkSLPackFileName[] = "sksl.pack";
   static constexpr char kAssetFileName[] = "io.flutter.shaders.json";
 
  private:
@@ -163,6 +193,17 @@ class PersistentCache : public GrContextOptions::PersistentCache {
                             const std::string& file_name,
                             bool need_key);
 
+  // Load the consolidated SkSL pack file with a single mapping if it exists
+  // and still matches the number of entries in the SkSL cache directory.
+  // Returns false when the pack is missing or stale so the caller can fall
+  // back to per-file loads.
+  bool LoadSkSLPack(size_t expected_count,
+                    std::vector<SkSLCache>* result) const;
+
+  // Consolidate the given SkSL caches into the single pack file, written
+  // atomically on a worker task runner.
+  void StoreSkSLPack(const std::vector<SkSLCache>& entries) const;
+
   bool IsValid() const;
 
   explicit PersistentCache(bool read_only = false);
@@ -4,6 +4,9 @@
 
 #include "flutter/common/graphics/texture.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace flutter {
 
 ContextListener::ContextListener() = default;
@@ -20,7 +23,12 @@ void TextureRegistry::RegisterTexture(const std::shared_ptr<Texture>& texture) {
   if (!texture) {
     return;
   }
-  mapping_[texture->Id()] = texture;
+  TextureState state;
+  state.texture = texture;
+  // Treat registration as activity so a texture that has yet to be painted
+  // is not evicted immediately.
+  state.last_painted_frame = frame_count_;
+  mapping_[texture->Id()] = std::move(state);
 }
 
 void TextureRegistry::RegisterContextListener(
@@ -40,7 +48,7 @@ void TextureRegistry::UnregisterTexture(int64_t id) {
   if (found == mapping_.end()) {
     return;
   }
-  found->second->OnTextureUnregistered();
+  found->second.texture->OnTextureUnregistered();
   mapping_.erase(found);
 }
 
@@ -51,7 +59,7 @@ void TextureRegistry::UnregisterContextListener(uintptr_t id) {
 
 void TextureRegistry::OnGrContextCreated() {
   for (auto& it : mapping_) {
-    it.second->OnGrContextCreated();
+    it.second.texture->OnGrContextCreated();
   }
 
   // Calling OnGrContextCreated may result in a subsequent call to
@@ -73,7 +81,7 @@ void TextureRegistry::OnGrContextCreated() {
 
 void TextureRegistry::OnGrContextDestroyed() {
   for (auto& it : mapping_) {
-    it.second->OnGrContextDestroyed();
+    it.second.texture->OnGrContextDestroyed();
   }
 
   auto it = ordered_images_.begin();
@@ -92,7 +100,64 @@ void TextureRegistry::OnGrContextDestroyed() {
 
 std::shared_ptr<Texture> TextureRegistry::GetTexture(int64_t id) {
   auto it = mapping_.find(id);
-  return it != mapping_.end() ? it->second : nullptr;
+  return it != mapping_.end() ? it->second.texture : nullptr;
+}
+
+void TextureRegistry::MarkTexturePainted(int64_t id) {
+  auto it = mapping_.find(id);
+  if (it == mapping_.end()) {
+    return;
+  }
+  it->second.last_painted_frame = frame_count_;
+  it->second.evicted = false;
+}
+
+void TextureRegistry::TrimInactiveTextures() {
+  size_t resident_bytes = 0;
+  for (auto& it : mapping_) {
+    TextureState& state = it.second;
+    if (state.evicted) {
+      continue;
+    }
+    if (frame_count_ - state.last_painted_frame >=
+        kInactiveTextureFrameThreshold) {
+      state.texture->OnTextureInactive();
+      state.evicted = true;
+    } else {
+      resident_bytes += state.texture->GetGPUResidentBytes();
+    }
+  }
+
+  if (residency_budget_ > 0 && resident_bytes > residency_budget_) {
+    // The recently painted textures alone exceed the budget. Evict the least
+    // recently painted first, but never a texture painted this frame.
+    std::vector<TextureState*> by_age;
+    for (auto& it : mapping_) {
+      TextureState& state = it.second;
+      if (!state.evicted && state.last_painted_frame != frame_count_) {
+        by_age.push_back(&state);
+      }
+    }
+    std::sort(by_age.begin(), by_age.end(),
+              [](const TextureState* a, const TextureState* b) {
+                return a->last_painted_frame < b->last_painted_frame;
+              });
+    for (TextureState* state : by_age) {
+      if (resident_bytes <= residency_budget_) {
+        break;
+      }
+      resident_bytes -=
+          std::min(resident_bytes, state->texture->GetGPUResidentBytes());
+      state->texture->OnTextureInactive();
+      state->evicted = true;
+    }
+  }
+
+  ++frame_count_;
+}
+
+void TextureRegistry::SetResidencyBudget(size_t bytes) {
+  residency_budget_ = bytes;
 }
 
 }  // namespace flutter
@@ -60,6 +60,17 @@ class Texture : public ContextListener {
   // Called on raster thread.
   virtual void OnTextureUnregistered() = 0;
 
+  // Called on raster thread when the registry evicts this texture's GPU
+  // state after it has gone unpainted for several frames. Implementations
+  // should release any cached GPU resources and re-resolve them during the
+  // next call to Paint. The default implementation does nothing.
+  virtual void OnTextureInactive() {}
+
+  // Called on raster thread. The approximate size in bytes of the GPU state
+  // currently held by this texture, used to enforce the registry's residency
+  // budget. The default implementation reports no resident state.
+  virtual size_t GetGPUResidentBytes() const { return 0; }
+
   int64_t Id() { return id_; }
 
  private:
@@ -87,6 +98,28 @@ class TextureRegistry {
   // Called from raster thread.
   std::shared_ptr<Texture> GetTexture(int64_t id);
 
+  // Called from raster thread each time a texture is painted into a frame.
+  // Keeps the texture's GPU state resident across TrimInactiveTextures.
+  void MarkTexturePainted(int64_t id);
+
+  // Called from raster thread once per rasterized frame. Evicts the GPU
+  // state of textures that have gone unpainted for
+  // kInactiveTextureFrameThreshold frames, then evicts least-recently
+  // painted textures while the resident bytes they report exceed the
+  // residency budget. Evicted textures re-resolve their GPU state during
+  // their next Paint. Textures painted in the current frame are never
+  // evicted by the budget.
+  void TrimInactiveTextures();
+
+  // Called from raster thread. Sets the byte budget enforced by
+  // TrimInactiveTextures. A budget of zero (the default) disables
+  // byte-driven eviction.
+  void SetResidencyBudget(size_t bytes);
+
+  // The number of frames a texture may go unpainted before
+  // TrimInactiveTextures evicts its GPU state.
+  static constexpr uint64_t kInactiveTextureFrameThreshold = 30;
+
   // Called from raster thread.
   void OnGrContextCreated();
 
@@ -94,7 +127,17 @@ class TextureRegistry {
   void OnGrContextDestroyed();
 
  private:
-  std::map<int64_t, std::shared_ptr<Texture>> mapping_;
+  struct TextureState {
+    std::shared_ptr<Texture> texture;
+    // The value of |frame_count_| when the texture was last painted, or
+    // registered.
+    uint64_t last_painted_frame = 0;
+    bool evicted = false;
+  };
+
+  std::map<int64_t, TextureState> mapping_;
+  uint64_t frame_count_ = 0;
+  size_t residency_budget_ = 0;
   size_t image_counter_ = 0;
   // This map keeps track of registered context listeners by their own
   // externally provided id. It indexes into ordered_images_.
@@ -40,11 +40,35 @@ class FrameTiming {
 
   static constexpr int kStatisticsCount = kCount + 5;
 
+  /// The maximum number of sub-phase spans that can be reported per frame.
+  static constexpr size_t kMaxRasterSpans = 16;
+
+  /// A sub-phase of the raster interval recorded by the engine. The label has
+  /// static storage duration and `depth` describes nesting: spans opened while
+  /// another span is still open have a greater depth.
+  struct RasterSpan {
+    const char* label;
+    fml::TimePoint begin;
+    fml::TimePoint end;
+    size_t depth;
+  };
+
   fml::TimePoint Get(Phase phase) const { return data_[phase]; }
   fml::TimePoint Set(Phase phase, fml::TimePoint value) {
     return data_[phase] = value;
   }
 
+  size_t GetRasterSpanCount() const { return raster_span_count_; }
+  const RasterSpan& GetRasterSpan(size_t index) const {
+    return raster_spans_[index];
+  }
+  void SetRasterSpans(const RasterSpan* spans, size_t count) {
+    raster_span_count_ = count < kMaxRasterSpans ? count : kMaxRasterSpans;
+    for (size_t i = 0; i < raster_span_count_; i++) {
+      raster_spans_[i] = spans[i];
+    }
+  }
+
   uint64_t GetFrameNumber() const { return frame_number_; }
   void SetFrameNumber(uint64_t frame_number) { frame_number_ = frame_number; }
   uint64_t GetLayerCacheCount() const { return layer_cache_count_; }
@@ -63,6 +87,8 @@ class FrameTiming {
 
  private:
   fml::TimePoint data_[kCount];
+  RasterSpan raster_spans_[kMaxRasterSpans];
+  size_t raster_span_count_ = 0;
   uint64_t frame_number_;
   size_t layer_cache_count_;
   size_t layer_cache_bytes_;
@@ -198,6 +224,12 @@ struct Settings {
   // after failing to bind to a specified port.
   bool enable_service_port_fallback = false;
 
+  // Defer starting the VM service HTTP server until it is requested through
+  // the service protocol. The service isolate still loads so diagnostics can
+  // be attached on demand, but startup no longer pays for binding the web
+  // server socket.
+  bool defer_vm_service_server = false;
+
   // Font settings
   bool use_test_fonts = false;
 
@@ -221,6 +253,63 @@ struct Settings {
   // Indicates if image reader backed platform views are disabled.
   bool disable_image_reader_platform_views = false;
 
+  // If enabled, LayerTree::Preroll fans independent layer subtrees out to the
+  // concurrent worker pool when it is safe to do so (no raster cache and no
+  // embedded platform views). Small trees keep the serial path.
+  bool enable_parallel_preroll = false;
+
+  // If enabled, display list raster cache entries are rasterized to
+  // software surfaces on the concurrent worker pool and swapped into the
+  // cache when ready, instead of being rasterized inline on the raster
+  // thread where they compete with the frame budget.
+  bool enable_async_raster_cache = false;
+
+  // If enabled, the rasterizer consumes the next ready frame from the
+  // pipeline in the same raster task after presenting, instead of yielding
+  // the raster event loop between frames. The next frame is typically
+  // produced by the UI thread while the present of the previous frame
+  // blocks the raster thread, so consuming it immediately avoids a task
+  // runner round trip per frame, which matters on high refresh rate
+  // displays.
+  bool enable_pipelined_raster = false;
+
+  // If enabled, the animator delays the start of frame production past
+  // vsync by an adaptive offset derived from recent UI frame build
+  // durations, so that input is sampled as late as possible while the
+  // build still completes before the raster deadline. A build that
+  // misses the deadline resets the offset to zero until enough on-time
+  // frames rebuild confidence.
+  bool enable_latency_compensation = false;
+
+  // If enabled, the screenshot and SKP dump service protocol handlers run on
+  // the IO thread: only a cheap recording of the last layer tree happens on
+  // the raster thread, while rasterization, serialization and compression run
+  // off of it, rate limited so that polling diagnostics tools do not jank
+  // production sessions. Screenshots are rendered in software from the
+  // recording, so GPU-resident content (for example, external textures) may
+  // be absent from them.
+  bool enable_async_service_protocol = false;
+
+  // If enabled, shells spawned from an existing shell (engine groups) adopt
+  // the raster cache of the shell they were spawned from instead of building
+  // their own. Spawned shells share one raster thread, so the group then
+  // pools cached pictures and layers under a single GPU budget rather than
+  // duplicating them per engine.
+  bool enable_shared_engine_group_caches = false;
+
+  // If enabled, the thread host pins the UI and raster threads to
+  // performance cores and the IO thread to efficiency cores on platforms
+  // that support affinity requests. Advisory only; the OS may ignore the
+  // hints.
+  bool enable_thread_affinity_policy = false;
+
+  // If enabled, instrumented locks (fml::SharedMutex, which guards the
+  // message loop task queues among others) report blocked acquisitions of
+  // a millisecond or more into the trace ring with owning-thread
+  // attribution, to hunt cross-thread priority inversions that show up as
+  // anonymous gaps in systrace.
+  bool enable_lock_contention_watchdog = false;
+
   // Requests a particular backend to be used (ex "opengles" or "vulkan")
   std::optional<std::string> impeller_backend;
 
@@ -330,6 +419,16 @@ struct Settings {
   // Max bytes threshold of resource cache, or 0 for unlimited.
   size_t resource_cache_max_bytes_threshold = 0;
 
+  /// The maximum width or height (in pixels) of a decoded image for which
+  /// Impeller generates a full mip chain as part of the decode-time texture
+  /// upload, or 0 for no limit.
+  ///
+  /// Generating mips for very large images right after decode can occupy the
+  /// transfer queue for several milliseconds; images above the limit are
+  /// uploaded with a single mip level and sample from the base level when
+  /// minified.
+  uint32_t decode_mipmap_max_dimension = 0;
+
   /// The minimum number of samples to require in multipsampled anti-aliasing.
   ///
   /// Setting this value to 0 or 1 disables MSAA.
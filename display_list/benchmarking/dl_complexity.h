@@ -21,6 +21,24 @@ class DisplayListComplexityCalculator {
   // Returns a calculated complexity score for a given DisplayList object
   virtual unsigned int Compute(const DisplayList* display_list) = 0;
 
+  // Returns the complexity score for a given DisplayList object, walking
+  // the op stream only the first time this calculator scores the list and
+  // memoizing the result on the (immutable) DisplayList for subsequent
+  // queries.
+  //
+  // Callers that adjust the complexity ceiling between queries should use
+  // |Compute| directly as the memoized score reflects the settings in
+  // effect when it was first computed.
+  unsigned int ComputeMemoized(const DisplayList* display_list) {
+    auto cached = display_list->cached_complexity_score(this);
+    if (cached.has_value()) {
+      return cached.value();
+    }
+    unsigned int score = Compute(display_list);
+    display_list->set_cached_complexity_score(this, score);
+    return score;
+  }
+
   // Returns whether a given complexity score meets the threshold for
   // cacheability for this particular ComplexityCalculator
   virtual bool ShouldBeCached(unsigned int complexity_score) = 0;
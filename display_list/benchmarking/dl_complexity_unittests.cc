@@ -64,6 +64,24 @@ TEST(DisplayListComplexity, DisplayListCeiling) {
   }
 }
 
+TEST(DisplayListComplexity, MemoizedComputeMatchesCompute) {
+  auto display_list = GetSampleDisplayList();
+
+  auto calculators = Calculators();
+  for (auto calculator : calculators) {
+    ASSERT_FALSE(
+        display_list->cached_complexity_score(calculator).has_value());
+    auto score = calculator->Compute(display_list.get());
+    ASSERT_EQ(calculator->ComputeMemoized(display_list.get()), score);
+    // The score must now be memoized on the display list and the
+    // memoized query must keep returning the same value.
+    auto cached = display_list->cached_complexity_score(calculator);
+    ASSERT_TRUE(cached.has_value());
+    ASSERT_EQ(cached.value(), score);
+    ASSERT_EQ(calculator->ComputeMemoized(display_list.get()), score);
+  }
+}
+
 TEST(DisplayListComplexity, NestedDisplayList) {
   auto display_list = GetSampleNestedDisplayList();
 
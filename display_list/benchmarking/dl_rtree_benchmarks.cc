@@ -0,0 +1,129 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/benchmarking/benchmarking.h"
+
+#include "flutter/display_list/geometry/dl_rtree.h"
+
+#include <random>
+
+namespace {
+
+template <typename RNG>
+std::vector<SkRect> GenerateRects(RNG& rng, int numRects, int maxSize) {
+  std::uniform_int_distribution pos(0, 4000 - maxSize);
+  std::uniform_int_distribution size(1, maxSize);
+
+  std::vector<SkRect> rects;
+  rects.reserve(numRects);
+  for (int i = 0; i < numRects; ++i) {
+    rects.push_back(
+        SkRect::MakeXYWH(pos(rng), pos(rng), size(rng), size(rng)));
+  }
+  return rects;
+}
+
+std::vector<SkRect> GenerateRects(int numRects, int maxSize) {
+  std::seed_seq seed{2, 1, 3};
+  std::mt19937 rng(seed);
+  return GenerateRects(rng, numRects, maxSize);
+}
+
+}  // namespace
+
+namespace flutter {
+
+static void BM_DlRTree_Build(benchmark::State& state, int numRects) {
+  auto rects = GenerateRects(numRects, 100);
+
+  while (state.KeepRunning()) {
+    DlRTree tree(rects.data(), rects.size());
+  }
+}
+
+static void BM_DlRTree_BuildSTRPacked(benchmark::State& state, int numRects) {
+  auto rects = GenerateRects(numRects, 100);
+
+  while (state.KeepRunning()) {
+    auto tree = DlRTree::MakeSTRPacked(rects.data(), rects.size());
+  }
+}
+
+// Compare with BM_DlRTree_Build at the same size, which is the rebuild
+// an incremental recorder is stuck with when only the one-shot
+// constructor is available.
+static void BM_DlRTree_IncrementalAppend(benchmark::State& state,
+                                         int numRects) {
+  auto rects = GenerateRects(numRects, 100);
+  // 10% of the list is new, the rest is reused from the base tree.
+  int append_count = numRects / 10;
+  int base_count = numRects - append_count;
+  DlRTree base(rects.data(), base_count);
+
+  while (state.KeepRunning()) {
+    DlRTree tree(base, rects.data() + base_count, append_count);
+  }
+}
+
+template <typename Tree>
+static void RunQueryBenchmark(benchmark::State& state, const Tree& tree) {
+  std::seed_seq seed{4, 5, 6};
+  std::mt19937 rng(seed);
+  auto queries = GenerateRects(rng, 100, 200);
+
+  std::vector<int> results;
+  while (state.KeepRunning()) {
+    for (const auto& query : queries) {
+      results.clear();
+      tree.search(query, &results);
+    }
+  }
+}
+
+static void BM_DlRTree_Query(benchmark::State& state, int numRects) {
+  auto rects = GenerateRects(numRects, 100);
+  DlRTree tree(rects.data(), rects.size());
+  RunQueryBenchmark(state, tree);
+}
+
+static void BM_DlRTree_QuerySTRPacked(benchmark::State& state, int numRects) {
+  auto rects = GenerateRects(numRects, 100);
+  auto tree = DlRTree::MakeSTRPacked(rects.data(), rects.size());
+  RunQueryBenchmark(state, *tree);
+}
+
+BENCHMARK_CAPTURE(BM_DlRTree_Build, 1k, 1000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DlRTree_Build, 10k, 10000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DlRTree_Build, 100k, 100000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_DlRTree_BuildSTRPacked, 1k, 1000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DlRTree_BuildSTRPacked, 10k, 10000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DlRTree_BuildSTRPacked, 100k, 100000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_DlRTree_IncrementalAppend, 1k, 1000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DlRTree_IncrementalAppend, 10k, 10000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DlRTree_IncrementalAppend, 100k, 100000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_DlRTree_Query, 1k, 1000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DlRTree_Query, 10k, 10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DlRTree_Query, 100k, 100000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_DlRTree_QuerySTRPacked, 1k, 1000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DlRTree_QuerySTRPacked, 10k, 10000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DlRTree_QuerySTRPacked, 100k, 100000)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace flutter
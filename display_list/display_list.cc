@@ -2,10 +2,12 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
 #include <type_traits>
 
 #include "flutter/display_list/display_list.h"
 #include "flutter/display_list/dl_op_records.h"
+#include "flutter/fml/allocation_metrics.h"
 #include "flutter/fml/trace_event.h"
 
 namespace flutter {
@@ -45,11 +47,74 @@ DisplayList::DisplayList(DisplayListStorage&& storage,
       can_apply_group_opacity_(can_apply_group_opacity),
       is_ui_thread_safe_(is_ui_thread_safe),
       modifies_transparent_black_(modifies_transparent_black),
-      rtree_(std::move(rtree)) {}
+      rtree_(std::move(rtree)),
+      dispatch_index_(rtree_ ? BuildDispatchIndex(storage_)
+                             : DispatchIndex()) {}
 
 DisplayList::~DisplayList() {
-  uint8_t* ptr = storage_.get();
-  DisposeOps(ptr, ptr + byte_count_);
+  for (size_t i = 0; i < storage_.chunk_count(); i++) {
+    DisposeOps(storage_.chunk_begin(i), storage_.chunk_end(i));
+  }
+}
+
+uint8_t* DisplayListStorage::allocate(size_t size) {
+  if (size > remaining_) {
+    if (remaining_ > 0u) {
+      // The record cannot straddle a chunk boundary so the remainder
+      // of the current chunk is abandoned as zeroed padding.
+      used_ += remaining_;
+      remaining_ = 0u;
+    }
+    size_t chunk_size = std::max(size, kChunkSize);
+    auto chunk = static_cast<uint8_t*>(std::malloc(chunk_size));
+    FML_CHECK(chunk);
+    fml::AllocationMetrics::RecordAllocation(chunk_size,
+                                             "display list storage");
+    // The bulk comparisons in |CompareOps| compare the alignment padding
+    // inside and between the op records as well as their fields so all
+    // storage bytes must start out zeroed.
+    memset(chunk, 0, chunk_size);
+    chunks_.emplace_back(chunk);
+    chunk_used_.push_back(0u);
+    remaining_ = chunk_size;
+  }
+  uint8_t* ptr = chunks_.back().get() + chunk_used_.back();
+  chunk_used_.back() += size;
+  remaining_ -= size;
+  used_ += size;
+  return ptr;
+}
+
+DisplayList::DispatchIndex DisplayList::BuildDispatchIndex(
+    const DisplayListStorage& storage) {
+  DispatchIndex index;
+  for (size_t i = 0; i < storage.chunk_count(); i++) {
+    uint8_t* ptr = storage.chunk_begin(i);
+    uint8_t* end = storage.chunk_end(i);
+    while (ptr < end) {
+      auto op = reinterpret_cast<const DLOp*>(ptr);
+      index.locations.push_back(ptr);
+      ptr += op->size;
+      FML_DCHECK(ptr <= end);
+    }
+  }
+  int count = static_cast<int>(index.locations.size());
+  index.next_state_ops.resize(count);
+  int next_state_op = count;
+  for (int i = count - 1; i >= 0; i--) {
+    auto op = reinterpret_cast<const DLOp*>(index.locations[i]);
+    // Every op from kDrawPaint through kDrawShadowTransparentOccluder
+    // is a DrawOpBase subclass whose dispatch method skips itself when
+    // its index is not at or after the next render index.
+    bool is_draw_op =
+        op->type >= DisplayListOpType::kDrawPaint &&
+        op->type <= DisplayListOpType::kDrawShadowTransparentOccluder;
+    if (!is_draw_op) {
+      next_state_op = i;
+    }
+    index.next_state_ops[i] = next_state_op;
+  }
+  return index;
 }
 
 uint32_t DisplayList::next_unique_id() {
@@ -139,8 +204,7 @@ class VectorCuller final : public Culler {
 };
 
 void DisplayList::Dispatch(DlOpReceiver& receiver) const {
-  uint8_t* ptr = storage_.get();
-  Dispatch(receiver, ptr, ptr + byte_count_, NopCuller::instance);
+  Dispatch(receiver, NopCuller::instance);
 }
 
 void DisplayList::Dispatch(DlOpReceiver& receiver,
@@ -164,17 +228,51 @@ void DisplayList::Dispatch(DlOpReceiver& receiver,
     Dispatch(receiver);
     return;
   }
-  uint8_t* ptr = storage_.get();
   std::vector<int> rect_indices;
   rtree->search(cull_rect, &rect_indices);
   VectorCuller culler(rtree, rect_indices);
-  Dispatch(receiver, ptr, ptr + byte_count_, culler);
+  DispatchIndexed(receiver, culler);
 }
 
-void DisplayList::Dispatch(DlOpReceiver& receiver,
-                           uint8_t* ptr,
-                           uint8_t* end,
-                           Culler& culler) const {
+namespace {
+
+// The op type enum values are generated from FOR_EACH_DISPLAY_LIST_OP
+// so they index this table directly. A flattened array of direct
+// function pointers turns each op dispatch into one indexed load and
+// call instead of a switch, which matters on op streams large enough
+// that the dispatch loop itself shows up in replay profiles.
+using DispatchFn = void (*)(DispatchContext&, const DLOp*);
+
+#define DL_OP_DISPATCH_ENTRY(name)                   \
+  [](DispatchContext& ctx, const DLOp* op) {         \
+    static_cast<const name##Op*>(op)->dispatch(ctx); \
+  },
+
+constexpr DispatchFn kDispatchTable[] = {
+    FOR_EACH_DISPLAY_LIST_OP(DL_OP_DISPATCH_ENTRY)
+#ifdef IMPELLER_ENABLE_3D
+        DL_OP_DISPATCH_ENTRY(SetSceneColorSource)
+#endif  // IMPELLER_ENABLE_3D
+};
+
+#undef DL_OP_DISPATCH_ENTRY
+
+constexpr size_t kDispatchTableSize =
+    sizeof(kDispatchTable) / sizeof(kDispatchTable[0]);
+
+}  // namespace
+
+bool DispatchOneOp(DispatchContext& context, const DLOp* op) {
+  size_t index = static_cast<size_t>(op->type);
+  if (index >= kDispatchTableSize) {
+    FML_DCHECK(false);
+    return false;
+  }
+  kDispatchTable[index](context, op);
+  return true;
+}
+
+void DisplayList::Dispatch(DlOpReceiver& receiver, Culler& culler) const {
   DispatchContext context = {
       .receiver = receiver,
       .cur_index = 0,
@@ -184,28 +282,65 @@ void DisplayList::Dispatch(DlOpReceiver& receiver,
   if (!culler.init(context)) {
     return;
   }
+  for (size_t i = 0; i < storage_.chunk_count(); i++) {
+    if (!DispatchChunk(context, storage_.chunk_begin(i),
+                       storage_.chunk_end(i), culler)) {
+      return;
+    }
+  }
+}
+
+bool DisplayList::DispatchChunk(DispatchContext& context,
+                                uint8_t* ptr,
+                                uint8_t* end,
+                                Culler& culler) const {
   while (ptr < end) {
     auto op = reinterpret_cast<const DLOp*>(ptr);
     ptr += op->size;
     FML_DCHECK(ptr <= end);
-    switch (op->type) {
-#define DL_OP_DISPATCH(name)                             \
-  case DisplayListOpType::k##name:                       \
-    static_cast<const name##Op*>(op)->dispatch(context); \
-    break;
-
-      FOR_EACH_DISPLAY_LIST_OP(DL_OP_DISPATCH)
-#ifdef IMPELLER_ENABLE_3D
-      DL_OP_DISPATCH(SetSceneColorSource)
-#endif  // IMPELLER_ENABLE_3D
-
-#undef DL_OP_DISPATCH
+    if (!DispatchOneOp(context, op)) {
+      return false;
+    }
+    culler.update(context);
+  }
+  return true;
+}
 
-      default:
-        FML_DCHECK(false);
-        return;
+void DisplayList::DispatchIndexed(DlOpReceiver& receiver,
+                                  Culler& culler) const {
+  // The jump below relies on the culler advancing |cur_index| for every
+  // dispatched op, which |NopCuller| does not do, and the dispatch index
+  // is only built for DisplayLists that record an R-Tree.
+  FML_DCHECK(dispatch_index_.locations.size() ==
+             dispatch_index_.next_state_ops.size());
+  DispatchContext context = {
+      .receiver = receiver,
+      .cur_index = 0,
+      // next_render_index will be initialized by culler.init()
+      .next_restore_index = std::numeric_limits<int>::max(),
+  };
+  if (!culler.init(context)) {
+    return;
+  }
+  const std::vector<uint8_t*>& locations = dispatch_index_.locations;
+  const std::vector<int>& next_state_ops = dispatch_index_.next_state_ops;
+  int count = static_cast<int>(locations.size());
+  int index = 0;
+  while (index < count) {
+    if (index < context.next_render_index && next_state_ops[index] > index) {
+      // Every op from here up to the next state op or the next render
+      // index (whichever comes first) is a rendering op that would skip
+      // itself, so jump over the entire run in one step.
+      index = std::min(context.next_render_index, next_state_ops[index]);
+      context.cur_index = index;
+      continue;
+    }
+    auto op = reinterpret_cast<const DLOp*>(locations[index]);
+    if (!DispatchOneOp(context, op)) {
+      return;
     }
     culler.update(context);
+    index = context.cur_index;
   }
 }
 
@@ -305,6 +440,90 @@ static bool CompareOps(uint8_t* ptrA,
   return true;
 }
 
+// Ops that do not supply their own deep |equals| method are compared by
+// bulk memcmp so their record bytes fully determine their equality and
+// they can be summarized by a byte hash. Ops that hide |DLOp::equals|
+// with a deep comparison (paths, images and other out-of-line
+// references) can be equal without being byte-identical.
+template <typename T>
+static constexpr bool CanCompareByBytes() {
+  return std::is_same_v<decltype(&T::equals),
+                        DisplayListCompare (DLOp::*)(const DLOp*) const>;
+}
+
+// The 64-bit finalizer from MurmurHash3 used to mix each word of the op
+// stream into the two accumulator lanes of the content hash.
+static inline uint64_t Mix64(uint64_t h) {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdu;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53u;
+  h ^= h >> 33;
+  return h;
+}
+
+static void HashBytes(uint64_t* h1,
+                      uint64_t* h2,
+                      const uint8_t* data,
+                      size_t length) {
+  size_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    uint64_t k;
+    memcpy(&k, data + i, sizeof(k));
+    *h1 = Mix64(*h1 ^ k);
+    *h2 = Mix64(*h2 + k + 0x9e3779b97f4a7c15u);
+  }
+  if (i < length) {
+    uint64_t k = 0;
+    memcpy(&k, data + i, length - i);
+    *h1 = Mix64(*h1 ^ k);
+    *h2 = Mix64(*h2 + k + 0x9e3779b97f4a7c15u);
+  }
+}
+
+void DisplayList::ComputeContentHash() const {
+  uint64_t h1 = byte_count_;
+  uint64_t h2 = op_count_;
+  for (size_t i = 0; i < storage_.chunk_count(); i++) {
+    uint8_t* ptr = storage_.chunk_begin(i);
+    uint8_t* end = storage_.chunk_end(i);
+    while (ptr < end) {
+      auto op = reinterpret_cast<const DLOp*>(ptr);
+      bool hashable;
+      switch (op->type) {
+#define DL_OP_HASHABLE(name)                  \
+  case DisplayListOpType::k##name:            \
+    hashable = CanCompareByBytes<name##Op>(); \
+    break;
+
+        FOR_EACH_DISPLAY_LIST_OP(DL_OP_HASHABLE)
+#ifdef IMPELLER_ENABLE_3D
+        DL_OP_HASHABLE(SetSceneColorSource)
+#endif  // IMPELLER_ENABLE_3D
+
+#undef DL_OP_HASHABLE
+
+        default:
+          FML_DCHECK(false);
+          hashable = false;
+          break;
+      }
+      if (!hashable) {
+        content_hash_state_ = ContentHashState::kUnhashable;
+        return;
+      }
+      // The alignment padding inside the records is zeroed by the storage
+      // allocation (see |DisplayListStorage::allocate|) so hashing the
+      // raw record bytes is consistent with the bulk comparisons.
+      HashBytes(&h1, &h2, ptr, op->size);
+      ptr += op->size;
+      FML_DCHECK(ptr <= end);
+    }
+  }
+  content_hash_ = {h1, h2};
+  content_hash_state_ = ContentHashState::kValid;
+}
+
 bool DisplayList::Equals(const DisplayList* other) const {
   if (this == other) {
     return true;
@@ -312,12 +531,44 @@ bool DisplayList::Equals(const DisplayList* other) const {
   if (byte_count_ != other->byte_count_ || op_count_ != other->op_count_) {
     return false;
   }
-  uint8_t* ptr = storage_.get();
-  uint8_t* o_ptr = other->storage_.get();
-  if (ptr == o_ptr) {
-    return true;
+  // Identical op sequences make identical chunking decisions so equal
+  // lists always have matching per-chunk layouts, but differing op
+  // sequences may pad their chunk tails differently even when the
+  // total byte counts agree.
+  if (storage_.chunk_count() != other->storage_.chunk_count()) {
+    return false;
+  }
+  // When both op streams are fully determined by their bytes, a mismatch
+  // of the lazily computed content hashes proves inequality without
+  // walking the records. A hash match still falls through to the full
+  // comparison to guard against collisions, and repeated comparisons of
+  // retained lists amortize the one-time hash computation.
+  if (content_hash_state_ == ContentHashState::kUnknown) {
+    ComputeContentHash();
+  }
+  if (other->content_hash_state_ == ContentHashState::kUnknown) {
+    other->ComputeContentHash();
+  }
+  if (content_hash_state_ == ContentHashState::kValid &&
+      other->content_hash_state_ == ContentHashState::kValid &&
+      (content_hash_.lo != other->content_hash_.lo ||
+       content_hash_.hi != other->content_hash_.hi)) {
+    return false;
   }
-  return CompareOps(ptr, ptr + byte_count_, o_ptr, o_ptr + other->byte_count_);
+  for (size_t i = 0; i < storage_.chunk_count(); i++) {
+    uint8_t* ptr = storage_.chunk_begin(i);
+    uint8_t* o_ptr = other->storage_.chunk_begin(i);
+    uint8_t* end = storage_.chunk_end(i);
+    uint8_t* o_end = other->storage_.chunk_end(i);
+    if (ptr == o_ptr) {
+      continue;
+    }
+    if (end - ptr != o_end - o_ptr ||
+        !CompareOps(ptr, end, o_ptr, o_end)) {
+      return false;
+    }
+  }
+  return true;
 }
 
 }  // namespace flutter
@@ -5,8 +5,12 @@
 #ifndef FLUTTER_DISPLAY_LIST_DISPLAY_LIST_H_
 #define FLUTTER_DISPLAY_LIST_DISPLAY_LIST_H_
 
+#include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include "flutter/display_list/dl_sampling_options.h"
 #include "flutter/display_list/geometry/dl_rtree.h"
@@ -203,27 +207,58 @@ class SaveLayerOptions {
   };
 };
 
-// Manages a buffer allocated with malloc.
+// Manages the memory of a DisplayList as a sequence of malloc'd chunks.
+// Op records are allocated out of fixed size chunks and are never
+// relocated once they have been recorded, so pointers into the storage
+// remain valid for the lifetime of the storage. Ownership of the chunks
+// is transferred into the DisplayList produced by
+// |DisplayListBuilder::Build| without copying any of the records.
 class DisplayListStorage {
  public:
-  DisplayListStorage() = default;
-  DisplayListStorage(DisplayListStorage&&) = default;
-
-  uint8_t* get() const { return ptr_.get(); }
+  // The default size of each chunk of storage. A record that is larger
+  // than this size is placed in a dedicated chunk of its exact size.
+  static constexpr size_t kChunkSize = 16384u;
 
-  void realloc(size_t count) {
-    ptr_.reset(static_cast<uint8_t*>(std::realloc(ptr_.release(), count)));
-    FML_CHECK(ptr_);
+  DisplayListStorage() = default;
+  DisplayListStorage(DisplayListStorage&& source)
+      : chunks_(std::move(source.chunks_)),
+        chunk_used_(std::move(source.chunk_used_)),
+        remaining_(std::exchange(source.remaining_, 0u)),
+        used_(std::exchange(source.used_, 0u)) {}
+
+  // Allocates |size| bytes for a new op record. Records never straddle
+  // a chunk boundary; if the record does not fit in the remainder of
+  // the current chunk then that remainder is left as zeroed padding
+  // and a new chunk is started.
+  uint8_t* allocate(size_t size);
+
+  // The total number of bytes consumed by the records, including any
+  // zeroed padding left at the tail of chunks whose remainder could
+  // not accommodate the record that followed them.
+  size_t used() const { return used_; }
+
+  size_t chunk_count() const { return chunks_.size(); }
+
+  // The address of the first op record in the indicated chunk.
+  uint8_t* chunk_begin(size_t index) const { return chunks_[index].get(); }
+
+  // The address just past the last op record in the indicated chunk.
+  uint8_t* chunk_end(size_t index) const {
+    return chunks_[index].get() + chunk_used_[index];
   }
 
  private:
   struct FreeDeleter {
     void operator()(uint8_t* p) { std::free(p); }
   };
-  std::unique_ptr<uint8_t, FreeDeleter> ptr_;
+  std::vector<std::unique_ptr<uint8_t, FreeDeleter>> chunks_;
+  std::vector<size_t> chunk_used_;
+  size_t remaining_ = 0u;
+  size_t used_ = 0u;
 };
 
 class Culler;
+struct DispatchContext;
 
 // The base class that contains a sequence of rendering operations
 // for dispatch to a DlOpReceiver. These objects must be instantiated
@@ -279,6 +314,31 @@ class DisplayList : public SkRefCnt {
     return modifies_transparent_black_;
   }
 
+  /// @brief     Returns the complexity score previously memoized for the
+  ///            indicated scorer, if any.
+  ///
+  /// The |scorer| token identifies which scoring scheme produced the
+  /// value, typically the address of a complexity calculator singleton.
+  /// Since DisplayLists are immutable once built, a memoized score never
+  /// needs to be invalidated.
+  /// @see DisplayListComplexityCalculator::Compute
+  std::optional<unsigned int> cached_complexity_score(
+      const void* scorer) const {
+    if (complexity_scorer_ == scorer && scorer != nullptr) {
+      return complexity_score_;
+    }
+    return std::nullopt;
+  }
+
+  /// @brief     Memoizes a complexity score computed by the indicated
+  ///            scorer so that subsequent queries against the same scorer
+  ///            do not have to walk the op stream again.
+  void set_cached_complexity_score(const void* scorer,
+                                   unsigned int score) const {
+    complexity_scorer_ = scorer;
+    complexity_score_ = score;
+  }
+
  private:
   DisplayList(DisplayListStorage&& ptr,
               size_t byte_count,
@@ -295,6 +355,21 @@ class DisplayList : public SkRefCnt {
 
   static void DisposeOps(uint8_t* ptr, uint8_t* end);
 
+  // An acceleration index for culled dispatch, only populated for
+  // DisplayLists that record an R-Tree (and so can be dispatched with
+  // a cull rect). |locations| maps each op index to the address of its
+  // record. |next_state_ops| maps each op index to the first index at
+  // or after it whose op is not a self-culling rendering op (or the
+  // total op count if there is none), which lets culled dispatch jump
+  // over a run of contiguous culled rendering ops in one step instead
+  // of decoding every record just to have it skip itself.
+  struct DispatchIndex {
+    std::vector<uint8_t*> locations;
+    std::vector<int> next_state_ops;
+  };
+
+  static DispatchIndex BuildDispatchIndex(const DisplayListStorage& storage);
+
   const DisplayListStorage storage_;
   const size_t byte_count_;
   const unsigned int op_count_;
@@ -310,13 +385,39 @@ class DisplayList : public SkRefCnt {
   const bool modifies_transparent_black_;
 
   const sk_sp<const DlRTree> rtree_;
+  const DispatchIndex dispatch_index_;
+
+  // Single-slot memo for |cached_complexity_score|; in practice only the
+  // one calculator matching the surface backend ever scores a given list.
+  mutable const void* complexity_scorer_ = nullptr;
+  mutable unsigned int complexity_score_ = 0u;
+
+  // Lazily computed 128-bit hash over the op stream that |Equals| uses to
+  // rule out inequality with a 16-byte comparison before falling back to
+  // the full op walk. Ops that define a deep |equals| method (paths,
+  // images and other out-of-line references) are not fully determined by
+  // their record bytes, so a list containing any of them is marked
+  // unhashable and always takes the full comparison.
+  enum class ContentHashState : uint8_t { kUnknown, kValid, kUnhashable };
+  struct ContentHash {
+    uint64_t lo = 0u;
+    uint64_t hi = 0u;
+  };
+  void ComputeContentHash() const;
+  mutable ContentHashState content_hash_state_ = ContentHashState::kUnknown;
+  mutable ContentHash content_hash_;
+
+  void Dispatch(DlOpReceiver& ctx, Culler& culler) const;
+
+  void DispatchIndexed(DlOpReceiver& ctx, Culler& culler) const;
 
-  void Dispatch(DlOpReceiver& ctx,
-                uint8_t* ptr,
-                uint8_t* end,
-                Culler& culler) const;
+  bool DispatchChunk(DispatchContext& context,
+                     uint8_t* ptr,
+                     uint8_t* end,
+                     Culler& culler) const;
 
   friend class DisplayListBuilder;
+  friend class DisplayListSerializer;
 };
 
 }  // namespace flutter
@@ -250,6 +250,36 @@ TEST_F(DisplayListTest, BuilderCanBeReused) {
   ASSERT_TRUE(dl->Equals(dl2));
 }
 
+TEST_F(DisplayListTest, LargeDisplayListsSpanStorageChunks) {
+  auto build = [](DlCanvas& builder) {
+    builder.SaveLayer(&kTestBounds, nullptr);
+    for (int i = 0; i < 2000; i++) {
+      builder.DrawRect(SkRect::MakeXYWH(i, i, 10, 10), DlPaint());
+    }
+    builder.Restore();
+  };
+  DisplayListBuilder builder1(kTestBounds);
+  DisplayListBuilder builder2(kTestBounds);
+  build(builder1);
+  build(builder2);
+  auto dl1 = builder1.Build();
+  auto dl2 = builder2.Build();
+  // The recording must be large enough to have spilled into more than
+  // one chunk of storage for this test to be meaningful.
+  ASSERT_GT(dl1->bytes(false), sizeof(DisplayList) +  //
+                                   DisplayListStorage::kChunkSize);
+  ASSERT_EQ(dl1->op_count(false), 2002u);
+  ASSERT_TRUE(dl1->Equals(dl2));
+
+  // Dispatching should replay every op in order across the chunk
+  // boundaries, so a re-recorded copy must compare equal.
+  DisplayListBuilder copy_builder(kTestBounds);
+  dl1->Dispatch(ToReceiver(copy_builder));
+  auto copy = copy_builder.Build();
+  ASSERT_EQ(copy->op_count(false), dl1->op_count(false));
+  ASSERT_TRUE(copy->Equals(dl1));
+}
+
 TEST_F(DisplayListTest, SaveRestoreRestoresTransform) {
   SkRect cull_rect = SkRect::MakeLTRB(-10.0f, -10.0f, 500.0f, 500.0f);
   DisplayListBuilder builder(cull_rect);
@@ -1431,6 +1461,125 @@ TEST_F(DisplayListTest, SaveLayerSrcBlendOnChildDoesNotInheritOpacity) {
   EXPECT_EQ(expector.save_layer_count(), 1);
 }
 
+TEST_F(DisplayListTest, EqualsUsesContentHashForByteComparableOps) {
+  auto record = [](DlColor color, SkScalar width) {
+    DisplayListBuilder builder;
+    DlOpReceiver& receiver = ToReceiver(builder);
+    receiver.setColor(color);
+    receiver.setStrokeWidth(width);
+    receiver.drawRect({10, 10, 20, 20});
+    receiver.drawCircle({50, 50}, 20);
+    return builder.Build();
+  };
+  auto dl1 = record(DlColor::kRed(), 2.0f);
+  auto dl2 = record(DlColor::kRed(), 2.0f);
+  auto dl3 = record(DlColor::kBlue(), 2.0f);
+
+  // Separately recorded but identical content compares equal and a
+  // single differing op record compares unequal; repeated queries
+  // exercise the memoized hashes.
+  EXPECT_TRUE(dl1->Equals(dl2));
+  EXPECT_TRUE(dl2->Equals(dl1));
+  EXPECT_FALSE(dl1->Equals(dl3));
+  EXPECT_FALSE(dl3->Equals(dl1));
+  EXPECT_FALSE(dl1->Equals(dl3));
+}
+
+TEST_F(DisplayListTest, EqualsDeepComparesOpsNotComparableByBytes) {
+  auto record = []() {
+    DisplayListBuilder builder;
+    DlOpReceiver& receiver = ToReceiver(builder);
+    SkPath path;
+    path.addOval({10, 10, 40, 40});
+    receiver.drawPath(path);
+    return builder.Build();
+  };
+
+  // Separately recorded paths are equal in content but not in record
+  // bytes, so these lists must take the deep comparison path.
+  EXPECT_TRUE(record()->Equals(record()));
+}
+
+class SharedImageFilterCollector : public virtual DlOpReceiver,
+                                   public IgnoreAttributeDispatchHelper,
+                                   public IgnoreClipDispatchHelper,
+                                   public IgnoreTransformDispatchHelper,
+                                   public IgnoreDrawDispatchHelper {
+ public:
+  void setImageFilter(const DlImageFilter* filter) override {
+    if (filter) {
+      filters_.push_back(filter);
+    }
+  }
+
+  void saveLayer(const SkRect* bounds,
+                 const SaveLayerOptions options,
+                 const DlImageFilter* backdrop) override {
+    if (backdrop) {
+      filters_.push_back(backdrop);
+    }
+  }
+
+  const std::vector<const DlImageFilter*>& filters() const { return filters_; }
+
+ private:
+  std::vector<const DlImageFilter*> filters_;
+};
+
+TEST_F(DisplayListTest, EqualSharedImageFiltersInternedWithinList) {
+  // Two separately constructed, but equal, filters of a type that is
+  // recorded by reference rather than inlined into the op storage.
+  DlComposeImageFilter filter1(kTestBlurImageFilter1, kTestDilateImageFilter1);
+  DlComposeImageFilter filter2(kTestBlurImageFilter1, kTestDilateImageFilter1);
+  ASSERT_EQ(filter1, filter2);
+
+  DisplayListBuilder builder;
+  DlOpReceiver& receiver = ToReceiver(builder);
+  receiver.setImageFilter(&filter1);
+  receiver.drawRect({10, 10, 20, 20});
+  receiver.setImageFilter(nullptr);
+  receiver.setImageFilter(&filter2);
+  receiver.drawRect({30, 30, 40, 40});
+  receiver.setImageFilter(nullptr);
+  receiver.saveLayer(nullptr, SaveLayerOptions::kNoAttributes, &filter1);
+  receiver.drawRect({50, 50, 60, 60});
+  receiver.restore();
+
+  SharedImageFilterCollector collector;
+  builder.Build()->Dispatch(collector);
+
+  // All three references dispatch from the same interned copy of the
+  // filter rather than a separate heap copy per op.
+  ASSERT_EQ(collector.filters().size(), 3u);
+  EXPECT_EQ(collector.filters()[0], collector.filters()[1]);
+  EXPECT_EQ(collector.filters()[0], collector.filters()[2]);
+  EXPECT_TRUE(*collector.filters()[0] == filter1);
+}
+
+TEST_F(DisplayListTest, SharedImageFiltersNotInternedAcrossLists) {
+  DlComposeImageFilter filter(kTestBlurImageFilter1, kTestDilateImageFilter1);
+
+  DisplayListBuilder builder;
+  DlOpReceiver& receiver = ToReceiver(builder);
+  receiver.setImageFilter(&filter);
+  receiver.drawRect({10, 10, 20, 20});
+  auto dl1 = builder.Build();
+
+  receiver.setImageFilter(&filter);
+  receiver.drawRect({10, 10, 20, 20});
+  auto dl2 = builder.Build();
+
+  SharedImageFilterCollector collector;
+  dl1->Dispatch(collector);
+  dl2->Dispatch(collector);
+
+  // Each list owns its own copy so that neither list can prolong the
+  // lifetime of objects recorded into the other.
+  ASSERT_EQ(collector.filters().size(), 2u);
+  EXPECT_NE(collector.filters()[0], collector.filters()[1]);
+  EXPECT_TRUE(*collector.filters()[0] == *collector.filters()[1]);
+}
+
 TEST_F(DisplayListTest, FlutterSvgIssue661BoundsWereEmpty) {
   // See https://github.com/dnfield/flutter_svg/issues/661
 
@@ -3015,6 +3164,37 @@ TEST_F(DisplayListTest, RTreeRenderCulling) {
   }
 }
 
+TEST_F(DisplayListTest, RTreeRenderCullingPreservesInterleavedStateOps) {
+  // Builds long runs of culled rendering ops with attribute ops between
+  // them to exercise the indexed culled dispatch which jumps over the
+  // culled runs but must still dispatch the state ops they surround.
+  DisplayListBuilder main_builder(/*prepare_rtree=*/true);
+  DlOpReceiver& main_receiver = ToReceiver(main_builder);
+  main_receiver.setColor(DlColor::kRed());
+  for (int i = 0; i < 100; i++) {
+    main_receiver.drawRect(SkRect::MakeXYWH(i * 10, 0, 8, 8));
+  }
+  main_receiver.setColor(DlColor::kBlue());
+  for (int i = 0; i < 100; i++) {
+    main_receiver.drawRect(SkRect::MakeXYWH(i * 10, 20, 8, 8));
+  }
+  auto main = main_builder.Build();
+
+  // Only intersects the rect at i == 50 in the second (blue) run.
+  SkIRect cull_rect = {501, 21, 507, 27};
+
+  DisplayListBuilder expected_builder;
+  DlOpReceiver& expected_receiver = ToReceiver(expected_builder);
+  expected_receiver.setColor(DlColor::kRed());
+  expected_receiver.setColor(DlColor::kBlue());
+  expected_receiver.drawRect(SkRect::MakeXYWH(500, 20, 8, 8));
+  auto expected = expected_builder.Build();
+
+  DisplayListBuilder culling_builder;
+  main->Dispatch(ToReceiver(culling_builder), cull_rect);
+  EXPECT_TRUE(DisplayListsEQ_Verbose(culling_builder.Build(), expected));
+}
+
 TEST_F(DisplayListTest, DrawSaveDrawCannotInheritOpacity) {
   DisplayListBuilder builder;
   builder.DrawCircle({10, 10}, 5, DlPaint());
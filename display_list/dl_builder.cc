@@ -9,14 +9,13 @@
 #include "flutter/display_list/dl_op_flags.h"
 #include "flutter/display_list/dl_op_records.h"
 #include "flutter/display_list/effects/dl_color_source.h"
+#include "flutter/display_list/geometry/dl_point_bounds.h"
 #include "flutter/display_list/utils/dl_bounds_accumulator.h"
 #include "fml/logging.h"
 #include "third_party/skia/include/core/SkScalar.h"
 
 namespace flutter {
 
-#define DL_BUILDER_PAGE 4096
-
 // CopyV(dst, src,n, src,n, ...) copies any number of typed srcs into dst.
 static void CopyV(void* dst) {}
 
@@ -35,32 +34,22 @@ static void CopyV(void* dst, const S* src, int n, Rest&&... rest) {
   CopyV(dst, std::forward<Rest>(rest)...);
 }
 
-static constexpr inline bool is_power_of_two(int value) {
-  return (value & (value - 1)) == 0;
-}
-
 template <typename T, typename... Args>
-void* DisplayListBuilder::Push(size_t pod, int render_op_inc, Args&&... args) {
+T* DisplayListBuilder::PushOp(size_t pod, int render_op_inc, Args&&... args) {
   size_t size = SkAlignPtr(sizeof(T) + pod);
   FML_DCHECK(size < (1 << 24));
-  if (used_ + size > allocated_) {
-    static_assert(is_power_of_two(DL_BUILDER_PAGE),
-                  "This math needs updating for non-pow2.");
-    // Next greater multiple of DL_BUILDER_PAGE.
-    allocated_ = (used_ + size + DL_BUILDER_PAGE) & ~(DL_BUILDER_PAGE - 1);
-    storage_.realloc(allocated_);
-    FML_DCHECK(storage_.get());
-    memset(storage_.get() + used_, 0, allocated_ - used_);
-  }
-  FML_DCHECK(used_ + size <= allocated_);
-  auto op = reinterpret_cast<T*>(storage_.get() + used_);
-  used_ += size;
+  auto op = reinterpret_cast<T*>(storage_.allocate(size));
   new (op) T{std::forward<Args>(args)...};
   op->type = T::kType;
   op->size = size;
   render_op_count_ += render_op_inc;
   op_index_++;
-  return op + 1;
+  return op;
+}
+
+template <typename T, typename... Args>
+void* DisplayListBuilder::Push(size_t pod, int render_op_inc, Args&&... args) {
+  return PushOp<T>(pod, render_op_inc, std::forward<Args>(args)...) + 1;
 }
 
 sk_sp<DisplayList> DisplayListBuilder::Build() {
@@ -68,7 +57,7 @@ sk_sp<DisplayList> DisplayListBuilder::Build() {
     restore();
   }
 
-  size_t bytes = used_;
+  size_t bytes = storage_.used();
   int count = render_op_count_;
   size_t nested_bytes = nested_bytes_;
   int nested_count = nested_op_count_;
@@ -76,14 +65,16 @@ sk_sp<DisplayList> DisplayListBuilder::Build() {
   bool is_safe = is_ui_thread_safe_;
   bool affects_transparency = current_layer_->affects_transparent_layer();
 
-  used_ = allocated_ = render_op_count_ = op_index_ = 0;
+  render_op_count_ = op_index_ = 0;
   nested_bytes_ = nested_op_count_ = 0;
   is_ui_thread_safe_ = true;
-  storage_.realloc(bytes);
   layer_stack_.pop_back();
   layer_stack_.emplace_back();
   tracker_.reset();
   current_ = DlPaint();
+  // The ops moved into the built DisplayList now co-own the interned
+  // filters, a fresh recording starts with an empty intern table.
+  interned_image_filters_.clear();
 
   return sk_sp<DisplayList>(new DisplayList(
       std::move(storage_), bytes, count, nested_bytes, nested_count, bounds(),
@@ -104,9 +95,8 @@ DisplayListBuilder::DisplayListBuilder(const SkRect& cull_rect,
 }
 
 DisplayListBuilder::~DisplayListBuilder() {
-  uint8_t* ptr = storage_.get();
-  if (ptr) {
-    DisplayList::DisposeOps(ptr, ptr + used_);
+  for (size_t i = 0; i < storage_.chunk_count(); i++) {
+    DisplayList::DisposeOps(storage_.chunk_begin(i), storage_.chunk_end(i));
   }
 }
 
@@ -262,7 +252,7 @@ void DisplayListBuilder::onSetImageFilter(const DlImageFilter* filter) {
       case DlImageFilterType::kCompose:
       case DlImageFilterType::kLocalMatrix:
       case DlImageFilterType::kColorFilter: {
-        Push<SetSharedImageFilterOp>(0, 0, filter);
+        Push<SetSharedImageFilterOp>(0, 0, InternImageFilter(filter));
         break;
       }
     }
@@ -337,6 +327,17 @@ void DisplayListBuilder::onSetMaskFilter(const DlMaskFilter* filter) {
   }
 }
 
+std::shared_ptr<DlImageFilter> DisplayListBuilder::InternImageFilter(
+    const DlImageFilter* filter) {
+  for (const auto& interned : interned_image_filters_) {
+    if (*interned == *filter) {
+      return interned;
+    }
+  }
+  interned_image_filters_.emplace_back(filter->shared());
+  return interned_image_filters_.back();
+}
+
 void DisplayListBuilder::SetAttributesFromPaint(
     const DlPaint& paint,
     const DisplayListAttributeFlags flags) {
@@ -359,28 +360,26 @@ void DisplayListBuilder::SetAttributesFromPaint(
     setStrokeJoin(paint.getStrokeJoin());
   }
   if (flags.applies_shader()) {
-    setColorSource(paint.getColorSource().get());
+    setColorSource(paint.getColorSourcePtr());
   }
   if (flags.applies_color_filter()) {
     setInvertColors(paint.isInvertColors());
-    setColorFilter(paint.getColorFilter().get());
+    setColorFilter(paint.getColorFilterPtr());
   }
   if (flags.applies_image_filter()) {
-    setImageFilter(paint.getImageFilter().get());
+    setImageFilter(paint.getImageFilterPtr());
   }
   if (flags.applies_path_effect()) {
-    setPathEffect(paint.getPathEffect().get());
+    setPathEffect(paint.getPathEffectPtr());
   }
   if (flags.applies_mask_filter()) {
-    setMaskFilter(paint.getMaskFilter().get());
+    setMaskFilter(paint.getMaskFilterPtr());
   }
 }
 
 void DisplayListBuilder::checkForDeferredSave() {
   if (current_layer_->has_deferred_save_op_) {
-    size_t save_offset_ = used_;
-    Push<SaveOp>(0, 1);
-    current_layer_->save_offset_ = save_offset_;
+    current_layer_->save_op_ = PushOp<SaveOp>(0, 1);
     current_layer_->has_deferred_save_op_ = false;
   }
 }
@@ -397,9 +396,9 @@ void DisplayListBuilder::Save() {
 
 void DisplayListBuilder::Restore() {
   if (layer_stack_.size() > 1) {
-    SaveOpBase* op = reinterpret_cast<SaveOpBase*>(
-        storage_.get() + current_layer_->save_offset());
+    SaveOpBase* op = current_layer_->save_op();
     if (!current_layer_->has_deferred_save_op_) {
+      FML_DCHECK(op != nullptr);
       op->restore_index = op_index_;
       Push<RestoreOp>(0, 1);
     }
@@ -486,7 +485,6 @@ void DisplayListBuilder::saveLayer(const SkRect* bounds,
     current_layer_->is_nop_ = true;
     return;
   }
-  size_t save_layer_offset = used_;
   if (options.renders_with_attributes()) {
     // The actual flood of the outer layer clip will occur after the
     // (eventual) corresponding restore is called, but rather than
@@ -505,11 +503,10 @@ void DisplayListBuilder::saveLayer(const SkRect* bounds,
       FML_DCHECK(unclipped);
     }
     CheckLayerOpacityCompatibility(true);
-    layer_stack_.emplace_back(save_layer_offset, true,
-                              current_.getImageFilter());
+    layer_stack_.emplace_back(nullptr, true, current_.getImageFilter());
   } else {
     CheckLayerOpacityCompatibility(false);
-    layer_stack_.emplace_back(save_layer_offset, true, nullptr);
+    layer_stack_.emplace_back(nullptr, true, nullptr);
   }
   current_layer_ = &layer_stack_.back();
 
@@ -523,13 +520,18 @@ void DisplayListBuilder::saveLayer(const SkRect* bounds,
     // when we tested the PaintResult.
     [[maybe_unused]] bool unclipped = AccumulateUnbounded();
     FML_DCHECK(unclipped);
-    bounds  //
-        ? Push<SaveLayerBackdropBoundsOp>(0, 1, options, *bounds, backdrop)
-        : Push<SaveLayerBackdropOp>(0, 1, options, backdrop);
+    current_layer_->save_op_ =
+        bounds  //
+            ? static_cast<SaveOpBase*>(PushOp<SaveLayerBackdropBoundsOp>(
+                  0, 1, options, *bounds, InternImageFilter(backdrop)))
+            : PushOp<SaveLayerBackdropOp>(0, 1, options,
+                                          InternImageFilter(backdrop));
   } else {
-    bounds  //
-        ? Push<SaveLayerBoundsOp>(0, 1, options, *bounds)
-        : Push<SaveLayerOp>(0, 1, options);
+    current_layer_->save_op_ =
+        bounds  //
+            ? static_cast<SaveOpBase*>(
+                  PushOp<SaveLayerBoundsOp>(0, 1, options, *bounds))
+            : PushOp<SaveLayerOp>(0, 1, options);
   }
 
   if (options.renders_with_attributes()) {
@@ -960,11 +962,7 @@ void DisplayListBuilder::drawPoints(PointMode mode,
 
   FML_DCHECK(count < DlOpReceiver::kMaxDrawPointsCount);
   int bytes = count * sizeof(SkPoint);
-  RectBoundsAccumulator ptBounds;
-  for (size_t i = 0; i < count; i++) {
-    ptBounds.accumulate(pts[i]);
-  }
-  SkRect point_bounds = ptBounds.bounds();
+  SkRect point_bounds = DlComputePointBounds(pts, count);
   if (!AccumulateOpBounds(point_bounds, flags)) {
     return;
   }
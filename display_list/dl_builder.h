@@ -21,6 +21,8 @@
 
 namespace flutter {
 
+struct SaveOpBase;
+
 // The primary class used to build a display list. The list of methods
 // here matches the list of methods invoked on a |DlOpReceiver| combined
 // with the list of methods invoked on a |DlCanvas|.
@@ -259,6 +261,7 @@ class DisplayListBuilder final : public virtual DlCanvas,
       DisplayListBuilder& builder);
   friend DlPaint DisplayListBuilderTestingAttributes(
       DisplayListBuilder& builder);
+  friend class DisplayListSerializer;
 
   void SetAttributesFromPaint(const DlPaint& paint,
                               const DisplayListAttributeFlags flags);
@@ -319,31 +322,31 @@ class DisplayListBuilder final : public virtual DlCanvas,
   }
   // |DlOpReceiver|
   void setColorSource(const DlColorSource* source) override {
-    if (NotEquals(current_.getColorSource(), source)) {
+    if (NotEquals(current_.getColorSourcePtr(), source)) {
       onSetColorSource(source);
     }
   }
   // |DlOpReceiver|
   void setImageFilter(const DlImageFilter* filter) override {
-    if (NotEquals(current_.getImageFilter(), filter)) {
+    if (NotEquals(current_.getImageFilterPtr(), filter)) {
       onSetImageFilter(filter);
     }
   }
   // |DlOpReceiver|
   void setColorFilter(const DlColorFilter* filter) override {
-    if (NotEquals(current_.getColorFilter(), filter)) {
+    if (NotEquals(current_.getColorFilterPtr(), filter)) {
       onSetColorFilter(filter);
     }
   }
   // |DlOpReceiver|
   void setPathEffect(const DlPathEffect* effect) override {
-    if (NotEquals(current_.getPathEffect(), effect)) {
+    if (NotEquals(current_.getPathEffectPtr(), effect)) {
       onSetPathEffect(effect);
     }
   }
   // |DlOpReceiver|
   void setMaskFilter(const DlMaskFilter* filter) override {
-    if (NotEquals(current_.getMaskFilter(), filter)) {
+    if (NotEquals(current_.getMaskFilterPtr(), filter)) {
       onSetMaskFilter(filter);
     }
   }
@@ -486,8 +489,6 @@ class DisplayListBuilder final : public virtual DlCanvas,
   void checkForDeferredSave();
 
   DisplayListStorage storage_;
-  size_t used_ = 0;
-  size_t allocated_ = 0;
   int render_op_count_ = 0;
   int op_index_ = 0;
 
@@ -497,6 +498,9 @@ class DisplayListBuilder final : public virtual DlCanvas,
 
   bool is_ui_thread_safe_ = true;
 
+  template <typename T, typename... Args>
+  T* PushOp(size_t extra, int op_inc, Args&&... args);
+
   template <typename T, typename... Args>
   void* Push(size_t extra, int op_inc, Args&&... args);
 
@@ -511,20 +515,22 @@ class DisplayListBuilder final : public virtual DlCanvas,
   class LayerInfo {
    public:
     explicit LayerInfo(
-        size_t save_offset = 0,
+        SaveOpBase* save_op = nullptr,
         bool has_layer = false,
         const std::shared_ptr<const DlImageFilter>& filter = nullptr)
-        : save_offset_(save_offset),
+        : save_op_(save_op),
           has_layer_(has_layer),
           filter_(filter) {}
 
-    // The offset into the memory buffer where the saveLayer DLOp record
-    // for this saveLayer() call is placed. This may be needed if the
-    // eventual restore() call has discovered important information about
-    // the records inside the saveLayer that may impact how the saveLayer
-    // is handled (e.g., |cannot_inherit_opacity| == false).
-    // This offset is only valid if |has_layer| is true.
-    size_t save_offset() const { return save_offset_; }
+    // The address of the saveLayer DLOp record for this saveLayer()
+    // call. This may be needed if the eventual restore() call has
+    // discovered important information about the records inside the
+    // saveLayer that may impact how the saveLayer is handled (e.g.,
+    // |cannot_inherit_opacity| == false). The chunked storage never
+    // relocates op records so this pointer remains valid until the
+    // DisplayList is built.
+    // This pointer is only valid if |has_layer| is true.
+    SaveOpBase* save_op() const { return save_op_; }
 
     bool has_layer() const { return has_layer_; }
     bool cannot_inherit_opacity() const { return cannot_inherit_opacity_; }
@@ -592,7 +598,7 @@ class DisplayListBuilder final : public virtual DlCanvas,
     bool is_unbounded() const { return is_unbounded_; }
 
    private:
-    size_t save_offset_;
+    SaveOpBase* save_op_;
     bool has_layer_;
     bool cannot_inherit_opacity_ = false;
     bool has_compatible_op_ = false;
@@ -681,6 +687,19 @@ class DisplayListBuilder final : public virtual DlCanvas,
   void onSetPathEffect(const DlPathEffect* effect);
   void onSetMaskFilter(const DlMaskFilter* filter);
 
+  // Returns this list's canonical shared copy of |filter| for ops that
+  // record an out-of-line reference to an ImageFilter (the Compose,
+  // LocalMatrix and ColorFilter variants as well as saveLayer backdrops).
+  // The first time a given filter value is recorded a single shared copy
+  // is made and subsequent equal filters reuse it, so repeated effects
+  // within a list dispatch from one heap object rather than a separate
+  // copy per op.
+  std::shared_ptr<DlImageFilter> InternImageFilter(const DlImageFilter* filter);
+
+  // The canonical copies handed out by |InternImageFilter| for the
+  // DisplayList currently being built, cleared by |Build|.
+  std::vector<std::shared_ptr<DlImageFilter>> interned_image_filters_;
+
   // The DisplayList had an unbounded call with no cull rect or clip
   // to contain it. Should only be called after the stream is fully
   // built.
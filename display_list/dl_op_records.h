@@ -80,6 +80,13 @@ enum class DisplayListCompare {
   kEqual,
 };
 
+struct DLOp;
+
+// Dispatches a single op record to the receiver held by |context|,
+// returning false only if the record's type is unrecognized. Shared by
+// the DisplayList dispatch loops and the serialized capture replay.
+bool DispatchOneOp(DispatchContext& context, const DLOp* op);
+
 // "DLOpPackLabel" is just a label for the pack pragma so it can be popped
 // later.
 #pragma pack(push, DLOpPackLabel, 8)
@@ -296,8 +303,8 @@ struct SetSceneColorSourceOp : DLOp {
 struct SetSharedImageFilterOp : DLOp {
   static const auto kType = DisplayListOpType::kSetSharedImageFilter;
 
-  explicit SetSharedImageFilterOp(const DlImageFilter* filter)
-      : filter(filter->shared()) {}
+  explicit SetSharedImageFilterOp(std::shared_ptr<DlImageFilter> filter)
+      : filter(std::move(filter)) {}
 
   const std::shared_ptr<DlImageFilter> filter;
 
@@ -375,9 +382,9 @@ struct SaveLayerBoundsOp final : SaveOpBase {
 struct SaveLayerBackdropOp final : SaveOpBase {
   static const auto kType = DisplayListOpType::kSaveLayerBackdrop;
 
-  explicit SaveLayerBackdropOp(const SaveLayerOptions& options,
-                               const DlImageFilter* backdrop)
-      : SaveOpBase(options), backdrop(backdrop->shared()) {}
+  SaveLayerBackdropOp(const SaveLayerOptions& options,
+                      std::shared_ptr<DlImageFilter> backdrop)
+      : SaveOpBase(options), backdrop(std::move(backdrop)) {}
 
   const std::shared_ptr<DlImageFilter> backdrop;
 
@@ -399,8 +406,8 @@ struct SaveLayerBackdropBoundsOp final : SaveOpBase {
 
   SaveLayerBackdropBoundsOp(const SaveLayerOptions& options,
                             const SkRect& rect,
-                            const DlImageFilter* backdrop)
-      : SaveOpBase(options), rect(rect), backdrop(backdrop->shared()) {}
+                            std::shared_ptr<DlImageFilter> backdrop)
+      : SaveOpBase(options), rect(rect), backdrop(std::move(backdrop)) {}
 
   const SkRect rect;
   const std::shared_ptr<DlImageFilter> backdrop;
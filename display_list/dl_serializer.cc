@@ -0,0 +1,154 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/dl_serializer.h"
+
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "flutter/display_list/dl_builder.h"
+#include "flutter/display_list/dl_op_records.h"
+#include "flutter/fml/logging.h"
+
+namespace flutter {
+
+namespace {
+
+// Ops that hide |DLOp::equals| with a deep comparison reference
+// out-of-line objects and ops holding reference-counted pointers are
+// not trivially copyable; neither category can be captured verbatim.
+template <typename T>
+constexpr bool CanSerializeOp() {
+  return std::is_same_v<decltype(&T::equals),
+                        DisplayListCompare (DLOp::*)(const DLOp*) const> &&
+         std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>;
+}
+
+bool OpIsSerializable(const DLOp* op) {
+  switch (op->type) {
+#define DL_OP_SERIALIZABLE(name)   \
+  case DisplayListOpType::k##name: \
+    return CanSerializeOp<name##Op>();
+
+    FOR_EACH_DISPLAY_LIST_OP(DL_OP_SERIALIZABLE)
+#ifdef IMPELLER_ENABLE_3D
+    DL_OP_SERIALIZABLE(SetSceneColorSource)
+#endif  // IMPELLER_ENABLE_3D
+
+#undef DL_OP_SERIALIZABLE
+
+    default:
+      return false;
+  }
+}
+
+// Walks the records in [ptr, end) and returns whether every record is
+// well formed and of a serializable type. Rejecting unknown types here
+// is what makes the in-place dispatch safe against truncated or
+// corrupted captures.
+bool ValidateOps(const uint8_t* ptr, const uint8_t* end) {
+  while (ptr < end) {
+    auto op = reinterpret_cast<const DLOp*>(ptr);
+    if (op->size < sizeof(DLOp) ||
+        op->size > static_cast<size_t>(end - ptr) || !OpIsSerializable(op)) {
+      return false;
+    }
+    ptr += op->size;
+  }
+  return true;
+}
+
+}  // namespace
+
+bool DisplayListSerializer::CanSerialize(const DisplayList& list) {
+  const DisplayListStorage& storage = list.storage_;
+  for (size_t i = 0; i < storage.chunk_count(); i++) {
+    if (!ValidateOps(storage.chunk_begin(i), storage.chunk_end(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool DisplayListSerializer::Serialize(const DisplayList& list,
+                                      std::vector<uint8_t>* buffer) {
+  FML_DCHECK(buffer != nullptr);
+  if (!CanSerialize(list)) {
+    return false;
+  }
+  const DisplayListStorage& storage = list.storage_;
+  // The records cannot straddle chunk boundaries and the abandoned tail
+  // of a filled chunk is excluded from its used range, so concatenating
+  // the chunk contents yields a stream that walks record by record.
+  uint64_t byte_count = 0;
+  for (size_t i = 0; i < storage.chunk_count(); i++) {
+    byte_count += storage.chunk_end(i) - storage.chunk_begin(i);
+  }
+  DlSerializedHeader header = {
+      .magic = kMagic,
+      .version = kVersion,
+      .byte_count = byte_count,
+      .op_count = list.op_count(),
+      .reserved = 0u,
+      .bounds = list.bounds(),
+  };
+  buffer->reserve(buffer->size() + sizeof(header) + byte_count);
+  auto header_bytes = reinterpret_cast<const uint8_t*>(&header);
+  buffer->insert(buffer->end(), header_bytes, header_bytes + sizeof(header));
+  for (size_t i = 0; i < storage.chunk_count(); i++) {
+    buffer->insert(buffer->end(), storage.chunk_begin(i),
+                   storage.chunk_end(i));
+  }
+  return true;
+}
+
+bool DisplayListSerializer::Dispatch(const uint8_t* data,
+                                     size_t size,
+                                     DlOpReceiver& receiver) {
+  if (data == nullptr || size < sizeof(DlSerializedHeader)) {
+    return false;
+  }
+  FML_DCHECK(reinterpret_cast<uintptr_t>(data) % 8 == 0);
+  auto header = reinterpret_cast<const DlSerializedHeader*>(data);
+  if (header->magic != kMagic || header->version != kVersion) {
+    return false;
+  }
+  // Trailing bytes are tolerated so that captures can be replayed
+  // straight from page-aligned mappings.
+  if (header->byte_count > size - sizeof(DlSerializedHeader)) {
+    return false;
+  }
+  const uint8_t* ptr = data + sizeof(DlSerializedHeader);
+  const uint8_t* end = ptr + header->byte_count;
+  if (!ValidateOps(ptr, end)) {
+    return false;
+  }
+  DispatchContext context = {
+      .receiver = receiver,
+      .cur_index = 0,
+      // Render everything; captures are replayed without culling.
+      .next_render_index = 0,
+      .next_restore_index = std::numeric_limits<int>::max(),
+  };
+  while (ptr < end) {
+    auto op = reinterpret_cast<const DLOp*>(ptr);
+    ptr += op->size;
+    if (!DispatchOneOp(context, op)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+sk_sp<DisplayList> DisplayListSerializer::Deserialize(const uint8_t* data,
+                                                      size_t size) {
+  DisplayListBuilder builder;
+  if (!Dispatch(data, size, builder.asReceiver())) {
+    return nullptr;
+  }
+  return builder.Build();
+}
+
+}  // namespace flutter
@@ -0,0 +1,87 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_DL_SERIALIZER_H_
+#define FLUTTER_DISPLAY_LIST_DL_SERIALIZER_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "flutter/display_list/display_list.h"
+#include "flutter/display_list/dl_op_receiver.h"
+
+namespace flutter {
+
+/// The fixed header that leads a serialized DisplayList op stream.
+///
+/// All fields are stored in the native byte order of the capturing
+/// device and the header size is a multiple of 8 bytes so that the op
+/// records that follow it retain the alignment they had in the
+/// DisplayList storage.
+struct DlSerializedHeader {
+  uint32_t magic;
+  uint32_t version;
+
+  /// The total size of the op records following the header.
+  uint64_t byte_count;
+
+  uint32_t op_count;
+  uint32_t reserved;
+
+  /// The culled bounds of the captured DisplayList, recorded for
+  /// triage tooling; replay recomputes bounds from the op stream.
+  SkRect bounds;
+};
+
+static_assert(sizeof(DlSerializedHeader) % 8 == 0,
+              "op records must remain 8-byte aligned after the header");
+
+/// A versioned binary capture format for DisplayList op streams.
+///
+/// The serialized form is a |DlSerializedHeader| followed by the raw op
+/// records exactly as they are laid out in the DisplayList storage, so
+/// writing a list is one header write plus one bulk copy per storage
+/// chunk and replay dispatches the records in place from the capture
+/// buffer (typically an mmapped file) with no parse step beyond a
+/// single validating walk.
+///
+/// Only DisplayLists whose ops are fully determined by their record
+/// bytes can be captured. Ops that reference out-of-line objects such
+/// as paths, images, text blobs, vertices and shared filter references
+/// would need type-specific encoders and are reported as
+/// unserializable rather than written as dangling pointers.
+///
+/// The format is not endian- or ABI-portable; captures replay on the
+/// same architecture and engine revision that wrote them, which the
+/// version field guards.
+class DisplayListSerializer {
+ public:
+  static constexpr uint32_t kMagic = 0x4c444c46;  // 'FLDL'
+  static constexpr uint32_t kVersion = 1u;
+
+  /// Returns whether every op record in |list| can be written verbatim.
+  static bool CanSerialize(const DisplayList& list);
+
+  /// Appends the serialized form of |list| to |buffer| and returns
+  /// true, or returns false without modifying |buffer| if the list
+  /// contains ops that cannot be captured.
+  static bool Serialize(const DisplayList& list, std::vector<uint8_t>* buffer);
+
+  /// Validates the buffer and dispatches the contained op records in
+  /// place to |receiver| without copying them. |data| must be 8-byte
+  /// aligned and remain valid for the duration of the call. Returns
+  /// false if the header or any op record fails validation, in which
+  /// case the receiver may have observed a prefix of the stream.
+  static bool Dispatch(const uint8_t* data,
+                       size_t size,
+                       DlOpReceiver& receiver);
+
+  /// Rebuilds an owned DisplayList by replaying the buffer into a
+  /// DisplayListBuilder, or returns nullptr if validation fails.
+  static sk_sp<DisplayList> Deserialize(const uint8_t* data, size_t size);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_DISPLAY_LIST_DL_SERIALIZER_H_
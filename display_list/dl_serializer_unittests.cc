@@ -0,0 +1,103 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/dl_serializer.h"
+
+#include "flutter/display_list/dl_builder.h"
+#include "flutter/display_list/dl_paint.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+static sk_sp<DisplayList> BuildSerializableList() {
+  DisplayListBuilder builder;
+  DlPaint paint;
+  paint.setColor(DlColor::kRed());
+  builder.Save();
+  builder.Translate(10.0f, 10.0f);
+  builder.DrawRect({10, 10, 60, 60}, paint);
+  paint.setColor(DlColor::kBlue());
+  paint.setStrokeWidth(2.0f);
+  paint.setDrawStyle(DlDrawStyle::kStroke);
+  builder.DrawCircle({50, 50}, 20.0f, paint);
+  builder.Restore();
+  builder.DrawOval({20, 20, 40, 30}, paint);
+  return builder.Build();
+}
+
+TEST(DisplayListSerializer, RoundTripEqualsOriginal) {
+  auto dl = BuildSerializableList();
+  ASSERT_TRUE(DisplayListSerializer::CanSerialize(*dl));
+
+  std::vector<uint8_t> buffer;
+  ASSERT_TRUE(DisplayListSerializer::Serialize(*dl, &buffer));
+  ASSERT_GT(buffer.size(), sizeof(DlSerializedHeader));
+
+  auto replayed =
+      DisplayListSerializer::Deserialize(buffer.data(), buffer.size());
+  ASSERT_TRUE(replayed);
+  EXPECT_TRUE(dl->Equals(replayed));
+  EXPECT_EQ(dl->op_count(), replayed->op_count());
+  EXPECT_EQ(dl->bounds(), replayed->bounds());
+}
+
+TEST(DisplayListSerializer, DispatchReplaysInPlace) {
+  auto dl = BuildSerializableList();
+
+  std::vector<uint8_t> buffer;
+  ASSERT_TRUE(DisplayListSerializer::Serialize(*dl, &buffer));
+
+  // Replaying the capture buffer into a fresh builder reproduces the
+  // original op stream.
+  auto replayed = DisplayListSerializer::Deserialize(buffer.data(),
+                                                     buffer.size());
+  ASSERT_TRUE(replayed);
+  std::vector<uint8_t> buffer2;
+  ASSERT_TRUE(DisplayListSerializer::Serialize(*replayed, &buffer2));
+  EXPECT_EQ(buffer, buffer2);
+}
+
+TEST(DisplayListSerializer, RejectsOutOfLineReferences) {
+  DisplayListBuilder builder;
+  SkPath path;
+  path.addOval({10, 10, 40, 40});
+  builder.DrawPath(path, DlPaint());
+  auto dl = builder.Build();
+
+  EXPECT_FALSE(DisplayListSerializer::CanSerialize(*dl));
+  std::vector<uint8_t> buffer;
+  EXPECT_FALSE(DisplayListSerializer::Serialize(*dl, &buffer));
+  EXPECT_TRUE(buffer.empty());
+}
+
+TEST(DisplayListSerializer, RejectsCorruptBuffers) {
+  auto dl = BuildSerializableList();
+  std::vector<uint8_t> buffer;
+  ASSERT_TRUE(DisplayListSerializer::Serialize(*dl, &buffer));
+
+  auto corrupted = buffer;
+  reinterpret_cast<DlSerializedHeader*>(corrupted.data())->magic ^= 1u;
+  EXPECT_FALSE(
+      DisplayListSerializer::Deserialize(corrupted.data(), corrupted.size()));
+
+  corrupted = buffer;
+  reinterpret_cast<DlSerializedHeader*>(corrupted.data())->version += 1u;
+  EXPECT_FALSE(
+      DisplayListSerializer::Deserialize(corrupted.data(), corrupted.size()));
+
+  // A truncated capture fails validation rather than walking off the
+  // end of the buffer.
+  corrupted = buffer;
+  corrupted.resize(corrupted.size() - 8);
+  EXPECT_FALSE(
+      DisplayListSerializer::Deserialize(corrupted.data(), corrupted.size()));
+
+  corrupted.resize(sizeof(DlSerializedHeader) - 1);
+  EXPECT_FALSE(
+      DisplayListSerializer::Deserialize(corrupted.data(), corrupted.size()));
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -4,7 +4,7 @@
 
 #include "flutter/display_list/dl_vertices.h"
 
-#include "flutter/display_list/utils/dl_bounds_accumulator.h"
+#include "flutter/display_list/geometry/dl_point_bounds.h"
 #include "flutter/fml/logging.h"
 
 namespace flutter {
@@ -86,11 +86,7 @@ size_t DlVertices::size() const {
 }
 
 static SkRect compute_bounds(const SkPoint* points, int count) {
-  RectBoundsAccumulator accumulator;
-  for (int i = 0; i < count; i++) {
-    accumulator.accumulate(points[i]);
-  }
-  return accumulator.bounds();
+  return DlComputePointBounds(points, count);
 }
 
 DlVertices::DlVertices(DlVertexMode mode,
@@ -0,0 +1,91 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/geometry/dl_point_bounds.h"
+
+#include <limits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+namespace flutter {
+
+// The vectorized loops below accumulate interleaved {x, y, x, y} lanes
+// using an explicit compare-and-select rather than the native min/max
+// instructions so that NaN coordinates fail the ordered comparison and
+// leave the accumulator untouched, exactly as the scalar code does.
+// The accumulator lanes therefore only ever hold the initial infinities
+// or finite coordinate values, never NaN, which makes the scalar lane
+// merging at the end of each kernel safe.
+
+SkRect DlComputePointBounds(const SkPoint points[], size_t count) {
+  SkScalar min_x = std::numeric_limits<SkScalar>::infinity();
+  SkScalar min_y = std::numeric_limits<SkScalar>::infinity();
+  SkScalar max_x = -std::numeric_limits<SkScalar>::infinity();
+  SkScalar max_y = -std::numeric_limits<SkScalar>::infinity();
+  size_t i = 0;
+#if defined(__SSE2__)
+  if (count >= 4) {
+    __m128 acc_min = _mm_set1_ps(std::numeric_limits<float>::infinity());
+    __m128 acc_max = _mm_set1_ps(-std::numeric_limits<float>::infinity());
+    for (; i + 2 <= count; i += 2) {
+      __m128 p = _mm_loadu_ps(reinterpret_cast<const float*>(points + i));
+      __m128 lt = _mm_cmpgt_ps(acc_min, p);
+      acc_min = _mm_or_ps(_mm_and_ps(lt, p), _mm_andnot_ps(lt, acc_min));
+      __m128 gt = _mm_cmplt_ps(acc_max, p);
+      acc_max = _mm_or_ps(_mm_and_ps(gt, p), _mm_andnot_ps(gt, acc_max));
+    }
+    float mins[4];
+    float maxs[4];
+    _mm_storeu_ps(mins, acc_min);
+    _mm_storeu_ps(maxs, acc_max);
+    min_x = mins[0] < mins[2] ? mins[0] : mins[2];
+    min_y = mins[1] < mins[3] ? mins[1] : mins[3];
+    max_x = maxs[0] > maxs[2] ? maxs[0] : maxs[2];
+    max_y = maxs[1] > maxs[3] ? maxs[1] : maxs[3];
+  }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+  if (count >= 4) {
+    float32x4_t acc_min = vdupq_n_f32(std::numeric_limits<float>::infinity());
+    float32x4_t acc_max = vdupq_n_f32(-std::numeric_limits<float>::infinity());
+    for (; i + 2 <= count; i += 2) {
+      float32x4_t p = vld1q_f32(reinterpret_cast<const float*>(points + i));
+      acc_min = vbslq_f32(vcgtq_f32(acc_min, p), p, acc_min);
+      acc_max = vbslq_f32(vcltq_f32(acc_max, p), p, acc_max);
+    }
+    float mins[4];
+    float maxs[4];
+    vst1q_f32(mins, acc_min);
+    vst1q_f32(maxs, acc_max);
+    min_x = mins[0] < mins[2] ? mins[0] : mins[2];
+    min_y = mins[1] < mins[3] ? mins[1] : mins[3];
+    max_x = maxs[0] > maxs[2] ? maxs[0] : maxs[2];
+    max_y = maxs[1] > maxs[3] ? maxs[1] : maxs[3];
+  }
+#endif
+  for (; i < count; i++) {
+    SkScalar x = points[i].fX;
+    SkScalar y = points[i].fY;
+    if (min_x > x) {
+      min_x = x;
+    }
+    if (min_y > y) {
+      min_y = y;
+    }
+    if (max_x < x) {
+      max_x = x;
+    }
+    if (max_y < y) {
+      max_y = y;
+    }
+  }
+  return (max_x >= min_x && max_y >= min_y)
+             ? SkRect::MakeLTRB(min_x, min_y, max_x, max_y)
+             : SkRect::MakeEmpty();
+}
+
+}  // namespace flutter
@@ -0,0 +1,31 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_GEOMETRY_DL_POINT_BOUNDS_H_
+#define FLUTTER_DISPLAY_LIST_GEOMETRY_DL_POINT_BOUNDS_H_
+
+#include <cstddef>
+
+#include "third_party/skia/include/core/SkPoint.h"
+#include "third_party/skia/include/core/SkRect.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      Computes the axis-aligned bounds of a bulk array of points.
+///
+/// Uses a vectorized (NEON/SSE) kernel on targets that support it so that
+/// the large point payloads recorded for ops like |drawPoints| and
+/// |drawVertices| do not pay for a scalar comparison pair per coordinate
+/// during bounds accumulation.
+///
+/// The result is identical to accumulating every point through a
+/// |RectBoundsAccumulator|, including the treatment of non-finite
+/// coordinates (NaN coordinates never survive the ordered comparisons on
+/// either path). Returns an empty rect if no point produces usable bounds.
+SkRect DlComputePointBounds(const SkPoint points[], size_t count);
+
+}  // namespace flutter
+
+#endif  // FLUTTER_DISPLAY_LIST_GEOMETRY_DL_POINT_BOUNDS_H_
@@ -0,0 +1,72 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/geometry/dl_point_bounds.h"
+#include "gtest/gtest.h"
+
+#include "flutter/display_list/utils/dl_bounds_accumulator.h"
+
+#include <limits>
+#include <random>
+
+namespace flutter {
+namespace testing {
+
+static SkRect ReferenceBounds(const std::vector<SkPoint>& points) {
+  RectBoundsAccumulator accumulator;
+  for (const SkPoint& point : points) {
+    accumulator.accumulate(point);
+  }
+  return accumulator.bounds();
+}
+
+TEST(DisplayListPointBounds, EmptyArray) {
+  EXPECT_EQ(DlComputePointBounds(nullptr, 0u), SkRect::MakeEmpty());
+}
+
+TEST(DisplayListPointBounds, SinglePoint) {
+  SkPoint point = SkPoint::Make(10.0f, 20.0f);
+  EXPECT_EQ(DlComputePointBounds(&point, 1u),
+            SkRect::MakeLTRB(10.0f, 20.0f, 10.0f, 20.0f));
+}
+
+TEST(DisplayListPointBounds, MatchesAccumulatorOnRandomPoints) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> coord(-1000.0f, 1000.0f);
+  // Cover the scalar tail for every count below and beyond the width
+  // of the vectorized kernel.
+  for (size_t count = 2; count < 40; count++) {
+    std::vector<SkPoint> points;
+    for (size_t i = 0; i < count; i++) {
+      points.push_back(SkPoint::Make(coord(rng), coord(rng)));
+    }
+    EXPECT_EQ(DlComputePointBounds(points.data(), points.size()),
+              ReferenceBounds(points))
+        << "count == " << count;
+  }
+}
+
+TEST(DisplayListPointBounds, MatchesAccumulatorOnNonFinitePoints) {
+  auto nan = std::numeric_limits<float>::quiet_NaN();
+  auto inf = std::numeric_limits<float>::infinity();
+  std::vector<SkPoint> points;
+  for (size_t i = 0; i < 20; i++) {
+    points.push_back(SkPoint::Make(i * 10.0f, i * 5.0f));
+    points.push_back(SkPoint::Make(nan, i * 1.0f));
+    points.push_back(SkPoint::Make(i * 1.0f, nan));
+    points.push_back(SkPoint::Make(inf, -inf));
+  }
+  EXPECT_EQ(DlComputePointBounds(points.data(), points.size()),
+            ReferenceBounds(points));
+}
+
+TEST(DisplayListPointBounds, AllNaNPointsYieldEmptyBounds) {
+  auto nan = std::numeric_limits<float>::quiet_NaN();
+  std::vector<SkPoint> points(16, SkPoint::Make(nan, nan));
+  EXPECT_EQ(DlComputePointBounds(points.data(), points.size()),
+            SkRect::MakeEmpty());
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -86,6 +86,25 @@ void DlRegion::SpanBuffer::setChunkSize(SpanChunkHandle handle, size_t size) {
   spans_[handle].left = size;
 }
 
+void DlRegion::SpanBuffer::offsetSpans(int32_t dx) {
+  if (dx == 0) {
+    return;
+  }
+  // Chunks are stored back to back, each prefixed by a span holding the
+  // chunk size; walk them sequentially so the size spans are left alone.
+  size_t handle = 0;
+  while (handle < size_) {
+    size_t chunk_size = getChunkSize(handle);
+    Span* begin = spans_ + handle + 1;
+    Span* end = begin + chunk_size;
+    for (Span* span = begin; span < end; ++span) {
+      span->left += dx;
+      span->right += dx;
+    }
+    handle += chunk_size + 1;
+  }
+}
+
 void DlRegion::SpanBuffer::getSpans(SpanChunkHandle handle,
                                     const DlRegion::Span*& begin,
                                     const DlRegion::Span*& end) const {
@@ -560,6 +579,27 @@ DlRegion DlRegion::MakeIntersection(const DlRegion& a, const DlRegion& b) {
   return res;
 }
 
+DlRegion DlRegion::makeTranslated(int32_t dx, int32_t dy) const {
+  DlRegion res(*this);
+  if (res.isEmpty() || (dx == 0 && dy == 0)) {
+    return res;
+  }
+  res.bounds_.offset(dx, dy);
+  for (auto& line : res.lines_) {
+    line.top += dy;
+    line.bottom += dy;
+  }
+  res.span_buffer_.offsetSpans(dx);
+  return res;
+}
+
+DlRegion DlRegion::unionWithTranslated(int32_t dx, int32_t dy) const {
+  if (isEmpty() || (dx == 0 && dy == 0)) {
+    return *this;
+  }
+  return MakeUnion(*this, makeTranslated(dx, dy));
+}
+
 std::vector<SkIRect> DlRegion::getRects(bool deband) const {
   std::vector<SkIRect> rects;
   if (isEmpty()) {
@@ -41,6 +41,19 @@ class DlRegion {
   /// Matches SkRegion a; a.op(b, SkRegion::kIntersect_Op) behavior.
   static DlRegion MakeIntersection(const DlRegion& a, const DlRegion& b);
 
+  /// Returns copy of this region translated by |dx|, |dy|.
+  /// Because the region stores non-overlapping span lines, translation only
+  /// offsets the existing spans and never needs to rebuild the region from
+  /// individual rectangles.
+  DlRegion makeTranslated(int32_t dx, int32_t dy) const;
+
+  /// Returns union of this region and this region translated by |dx|, |dy|.
+  /// Fast path for accumulating damage of scrolled content, where each
+  /// frame's region is the previous frame's region offset by the scroll
+  /// delta; merges two sets of span lines instead of rebuilding the region
+  /// from individual rectangles.
+  DlRegion unionWithTranslated(int32_t dx, int32_t dy) const;
+
   /// Returns list of non-overlapping rectangles that cover current region.
   /// If |deband| is false, each span line will result in separate rectangles,
   /// closely matching SkRegion::Iterator behavior.
@@ -95,6 +108,7 @@ class DlRegion {
 
     SpanChunkHandle storeChunk(const Span* begin, const Span* end);
     size_t getChunkSize(SpanChunkHandle handle) const;
+    void offsetSpans(int32_t dx);
     void getSpans(SpanChunkHandle handle,
                   const DlRegion::Span*& begin,
                   const DlRegion::Span*& end) const;
@@ -341,6 +341,43 @@ TEST(DisplayListRegion, UnionEmpty) {
   }
 }
 
+TEST(DisplayListRegion, TranslateEmpty) {
+  DlRegion region;
+  DlRegion translated = region.makeTranslated(10, 20);
+  EXPECT_TRUE(translated.isEmpty());
+  EXPECT_TRUE(region.unionWithTranslated(10, 20).isEmpty());
+}
+
+TEST(DisplayListRegion, Translate) {
+  DlRegion region({
+      SkIRect::MakeXYWH(0, 0, 20, 20),
+      SkIRect::MakeXYWH(21, 21, 20, 20),
+  });
+  DlRegion translated = region.makeTranslated(5, -7);
+  EXPECT_EQ(translated.bounds(), SkIRect::MakeLTRB(5, -7, 46, 34));
+  auto rects = translated.getRects();
+  std::vector<SkIRect> expected{
+      SkIRect::MakeXYWH(5, -7, 20, 20),
+      SkIRect::MakeXYWH(26, 14, 20, 20),
+  };
+  EXPECT_EQ(rects, expected);
+}
+
+TEST(DisplayListRegion, UnionWithTranslated) {
+  DlRegion region({
+      SkIRect::MakeXYWH(0, 0, 20, 20),
+      SkIRect::MakeXYWH(21, 21, 20, 20),
+  });
+  DlRegion u = region.unionWithTranslated(0, 10);
+  EXPECT_EQ(u.bounds(), SkIRect::MakeLTRB(0, 0, 41, 51));
+  auto rects = u.getRects();
+  std::vector<SkIRect> expected{
+      SkIRect::MakeXYWH(0, 0, 20, 30),
+      SkIRect::MakeXYWH(21, 21, 20, 30),
+  };
+  EXPECT_EQ(rects, expected);
+}
+
 void CheckEquality(const DlRegion& dl_region, const SkRegion& sk_region) {
   EXPECT_EQ(dl_region.bounds(), sk_region.getBounds());
 
@@ -424,6 +461,20 @@ TEST(DisplayListRegion, TestAgainstSkRegion) {
         SkRegion sk_intersection(sk_region1);
         sk_intersection.op(sk_region2, SkRegion::kIntersect_Op);
         CheckEquality(dl_intersection, sk_intersection);
+
+        std::uniform_int_distribution offset(-100, 100);
+        int32_t dx = offset(rng);
+        int32_t dy = offset(rng);
+
+        DlRegion dl_translated = region1.makeTranslated(dx, dy);
+        SkRegion sk_translated;
+        sk_region1.translate(dx, dy, &sk_translated);
+        CheckEquality(dl_translated, sk_translated);
+
+        DlRegion dl_scrolled = region1.unionWithTranslated(dx, dy);
+        SkRegion sk_scrolled(sk_region1);
+        sk_scrolled.op(sk_translated, SkRegion::kUnion_Op);
+        CheckEquality(dl_scrolled, sk_scrolled);
       }
     }
   }
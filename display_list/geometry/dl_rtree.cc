@@ -5,6 +5,9 @@
 #include "flutter/display_list/geometry/dl_rtree.h"
 #include "flutter/display_list/geometry/dl_region.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "flutter/fml/logging.h"
 
 namespace flutter {
@@ -36,15 +39,7 @@ DlRTree::DlRTree(const SkRect rects[],
 
   // Count the total number of nodes (leaf and internal) up front
   // so we can resize the vector just once.
-  uint32_t total_node_count = leaf_count;
-  uint32_t gen_count = leaf_count;
-  while (gen_count > 1) {
-    uint32_t family_count = (gen_count + kMaxChildren - 1u) / kMaxChildren;
-    total_node_count += family_count;
-    gen_count = family_count;
-  }
-
-  nodes_.resize(total_node_count);
+  nodes_.resize(TotalNodeCount(leaf_count));
 
   // Now place only the tracked rectangles into the nodes array
   // in the first leaf_count_ entries.
@@ -77,8 +72,29 @@ DlRTree::DlRTree(const SkRect rects[],
   // are likely nearly sorted when they are delivered to this constructor
   // so leaving them in their original order should show similar results
   // to what Skia found in their empirical browser tests.
+  //
+  // For rectangle lists that do not arrive in such an order, the
+  // |MakeSTRPacked| factory provides spatially packed leaves at the cost
+  // of losing the insertion order of the search results.
   // ---
 
+  BuildParentGenerations();
+}
+
+uint32_t DlRTree::TotalNodeCount(uint32_t leaf_count) {
+  uint32_t total_node_count = leaf_count;
+  uint32_t gen_count = leaf_count;
+  while (gen_count > 1) {
+    uint32_t family_count = (gen_count + kMaxChildren - 1u) / kMaxChildren;
+    total_node_count += family_count;
+    gen_count = family_count;
+  }
+  return total_node_count;
+}
+
+void DlRTree::BuildParentGenerations() {
+  uint32_t total_node_count = nodes_.size();
+
   // Continually process the previous level (generation) of nodes,
   // combining them into a new generation of parent groups each grouping
   // at most |kMaxChildren| children and joining their bounds into its
@@ -87,7 +103,7 @@ DlRTree::DlRTree(const SkRect rects[],
   // until there is just one node left, which is the root node of
   // the R-Tree.
   uint32_t gen_start = 0;
-  gen_count = leaf_count;
+  uint32_t gen_count = leaf_count_;
   while (gen_count > 1) {
     uint32_t gen_end = gen_start + gen_count;
 
@@ -139,6 +155,112 @@ DlRTree::DlRTree(const SkRect rects[],
   FML_DCHECK(gen_start + gen_count == total_node_count);
 }
 
+DlRTree::DlRTree(const DlRTree& base,
+                 const SkRect rects[],
+                 int N,
+                 const int ids[],
+                 bool p(int))
+    : leaf_count_(0), invalid_id_(base.invalid_id_) {
+  if (N < 0) {
+    FML_DCHECK(N >= 0);
+    return;
+  }
+  FML_DCHECK(N == 0 || rects != nullptr);
+
+  // Count only the additional rectangles that survive the same filtering
+  // as the primary constructor; the base leaves were already filtered
+  // when the base tree was built.
+  int extra_count = 0;
+  for (int i = 0; i < N; i++) {
+    if (!rects[i].isEmpty()) {
+      if (ids == nullptr || p(ids[i])) {
+        extra_count++;
+      }
+    }
+  }
+  leaf_count_ = base.leaf_count_ + extra_count;
+  if (leaf_count_ == 0) {
+    return;
+  }
+
+  nodes_.resize(TotalNodeCount(leaf_count_));
+
+  // Reuse the base leaves as-is and append the newly accepted
+  // rectangles behind them so leaf order still follows insertion order.
+  std::copy(base.nodes_.begin(), base.nodes_.begin() + base.leaf_count_,
+            nodes_.begin());
+  int leaf_index = base.leaf_count_;
+  int id = invalid_id_;
+  for (int i = 0; i < N; i++) {
+    if (!rects[i].isEmpty()) {
+      if (ids == nullptr || p(id = ids[i])) {
+        Node& node = nodes_[leaf_index++];
+        node.bounds = rects[i];
+        node.id = id;
+      }
+    }
+  }
+  FML_DCHECK(leaf_index == leaf_count_);
+
+  BuildParentGenerations();
+}
+
+sk_sp<DlRTree> DlRTree::MakeSTRPacked(const SkRect rects[],
+                                      int N,
+                                      const int ids[],
+                                      bool p(int),
+                                      int invalid_id) {
+  auto tree = sk_sp<DlRTree>(new DlRTree());
+  tree->invalid_id_ = invalid_id;
+  if (N <= 0) {
+    FML_DCHECK(N >= 0);
+    return tree;
+  }
+  FML_DCHECK(rects != nullptr);
+
+  std::vector<Node> leaves;
+  leaves.reserve(N);
+  int id = invalid_id;
+  for (int i = 0; i < N; i++) {
+    if (!rects[i].isEmpty()) {
+      if (ids == nullptr || p(id = ids[i])) {
+        Node& node = leaves.emplace_back();
+        node.bounds = rects[i];
+        node.id = id;
+      }
+    }
+  }
+  uint32_t leaf_count = static_cast<uint32_t>(leaves.size());
+  tree->leaf_count_ = leaf_count;
+  if (leaf_count == 0) {
+    return tree;
+  }
+
+  // Sort-Tile-Recursive packing: order the leaves into vertical slices
+  // by bounds center x, then order each slice by center y, so that each
+  // run of |kMaxChildren| consecutive leaves grouped into a parent by
+  // |BuildParentGenerations| forms a spatially compact tile.
+  std::sort(leaves.begin(), leaves.end(), [](const Node& a, const Node& b) {
+    return a.bounds.centerX() < b.bounds.centerX();
+  });
+  uint32_t page_count = (leaf_count + kMaxChildren - 1u) / kMaxChildren;
+  uint32_t slice_count = static_cast<uint32_t>(
+      std::ceil(std::sqrt(static_cast<double>(page_count))));
+  uint32_t slice_size = slice_count * kMaxChildren;
+  for (uint32_t start = 0; start < leaf_count; start += slice_size) {
+    uint32_t end = std::min(start + slice_size, leaf_count);
+    std::sort(leaves.begin() + start, leaves.begin() + end,
+              [](const Node& a, const Node& b) {
+                return a.bounds.centerY() < b.bounds.centerY();
+              });
+  }
+
+  tree->nodes_.resize(TotalNodeCount(leaf_count));
+  std::copy(leaves.begin(), leaves.end(), tree->nodes_.begin());
+  tree->BuildParentGenerations();
+  return tree;
+}
+
 void DlRTree::search(const SkRect& query, std::vector<int>* results) const {
   FML_DCHECK(results != nullptr);
   if (query.isEmpty()) {
@@ -67,6 +67,46 @@ class DlRTree : public SkRefCnt {
       bool predicate(int id) = [](int) { return true; },
       int invalid_id = -1);
 
+  /// Construct an R-Tree containing all of the rectangles already stored
+  /// in |base| followed by the indicated additional rectangles, as if
+  /// both lists had been passed to the primary constructor in one call.
+  ///
+  /// The leaf nodes of |base| are reused as-is without re-validating
+  /// their rectangles or re-querying the predicate; only the additional
+  /// rectangles are filtered and the internal consolidation nodes are
+  /// rebuilt over the combined list. For an incremental recorder that
+  /// appends a few new operations to a mostly unchanged list this is
+  /// much cheaper than rebuilding the full tree from the original
+  /// rectangles.
+  ///
+  /// The |invalid_id| of the new tree is inherited from |base|.
+  DlRTree(
+      const DlRTree& base,
+      const SkRect rects[],
+      int N,
+      const int ids[] = nullptr,
+      bool predicate(int id) = [](int) { return true; });
+
+  /// Construct an R-Tree over the indicated rectangles with the leaves
+  /// packed in Sort-Tile-Recursive order rather than insertion order.
+  ///
+  /// Grouping spatially adjacent rectangles under common parents tightens
+  /// the internal node bounds and improves query locality for rectangle
+  /// lists that do not arrive in a "page layout" order (see the
+  /// implementation note in the primary constructor).
+  ///
+  /// Note that because the leaves are reordered, the results of |search|
+  /// are not monotonic in the order the rectangles were passed in, so an
+  /// STR-packed tree must not be used where that order matters, such as
+  /// the culled dispatch of a DisplayList. The |id| and |bounds| of each
+  /// search result remain accurate.
+  static sk_sp<DlRTree> MakeSTRPacked(
+      const SkRect rects[],
+      int N,
+      const int ids[] = nullptr,
+      bool predicate(int id) = [](int) { return true; },
+      int invalid_id = -1);
+
   /// Search the rectangles and return a vector of leaf node indices for
   /// rectangles that intersect the query.
   ///
@@ -138,6 +178,17 @@ class DlRTree : public SkRefCnt {
  private:
   static constexpr SkRect kEmpty = SkRect::MakeEmpty();
 
+  DlRTree() : leaf_count_(0), invalid_id_(-1) {}
+
+  // Returns the number of nodes (leaf and internal) needed to build a
+  // tree over the indicated number of leaves.
+  static uint32_t TotalNodeCount(uint32_t leaf_count);
+
+  // Builds the internal consolidation nodes over the leaf nodes already
+  // placed in the first |leaf_count_| entries of |nodes_|, which must
+  // already be resized to |TotalNodeCount(leaf_count_)|.
+  void BuildParentGenerations();
+
   void search(const Node& parent,
               const SkRect& query,
               std::vector<int>* results) const;
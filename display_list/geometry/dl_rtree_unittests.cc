@@ -319,5 +319,115 @@ TEST(DisplayListRTree, Region) {
   EXPECT_EQ(rects.size(), expected_rects.size());
 }
 
+TEST(DisplayListRTree, IncrementalMatchesFullBuild) {
+  // A diagonal of non-overlapping 10x10 rectangles spaced 20
+  // pixels apart, with a few empty rectangles mixed in that both
+  // construction paths must filter out.
+  const int N = 100;
+  SkRect rects[N];
+  int ids[N];
+  for (int i = 0; i < N; i++) {
+    if (i % 10 == 7) {
+      rects[i] = SkRect::MakeEmpty();
+    } else {
+      rects[i] = SkRect::MakeXYWH(i * 20, i * 20, 10, 10);
+    }
+    ids[i] = i + 42;
+  }
+  const int kBaseCount = 60;
+  DlRTree full(rects, N, ids);
+  DlRTree base(rects, kBaseCount, ids);
+  DlRTree incremental(base, rects + kBaseCount, N - kBaseCount,
+                      ids + kBaseCount);
+
+  EXPECT_EQ(incremental.leaf_count(), full.leaf_count());
+  EXPECT_EQ(incremental.node_count(), full.node_count());
+  EXPECT_EQ(incremental.bounds(), full.bounds());
+
+  // Since the incremental constructor preserves leaf order, search
+  // results must be identical to the tree built in one shot.
+  for (int i = 0; i < N; i++) {
+    std::vector<int> full_results;
+    std::vector<int> incremental_results;
+    auto query = SkRect::MakeXYWH(i * 20 + 2, i * 20 + 2, 6, 6);
+    full.search(query, &full_results);
+    incremental.search(query, &incremental_results);
+    EXPECT_EQ(incremental_results, full_results) << "query " << i;
+    for (int result : full_results) {
+      EXPECT_EQ(incremental.id(result), full.id(result));
+      EXPECT_EQ(incremental.bounds(result), full.bounds(result));
+    }
+  }
+}
+
+TEST(DisplayListRTree, IncrementalFromEmptyBase) {
+  const int N = 10;
+  SkRect rects[N];
+  int ids[N];
+  for (int i = 0; i < N; i++) {
+    rects[i] = SkRect::MakeXYWH(i * 20, i * 20, 10, 10);
+    ids[i] = i + 42;
+  }
+  DlRTree base(nullptr, 0);
+  DlRTree incremental(base, rects, N, ids);
+  EXPECT_EQ(incremental.leaf_count(), N);
+  for (int i = 0; i < N; i++) {
+    std::vector<int> results;
+    incremental.search(SkRect::MakeXYWH(i * 20 + 2, i * 20 + 2, 6, 6),
+                       &results);
+    EXPECT_EQ(results.size(), 1u);
+    EXPECT_EQ(incremental.id(results[0]), ids[i]);
+    EXPECT_EQ(incremental.bounds(results[0]), rects[i]);
+  }
+}
+
+TEST(DisplayListRTree, STRPackedGrid) {
+  // Non-overlapping 10 x 10 rectangles delivered in an order that is
+  // deliberately not "page layout" order.
+  const int ROWS = 10;
+  const int COLS = 10;
+  const int N = ROWS * COLS;
+  SkRect rects[N];
+  int ids[N];
+  for (int r = 0; r < ROWS; r++) {
+    int y = r * 20 + 5;
+    for (int c = 0; c < COLS; c++) {
+      int x = c * 20 + 5;
+      int i = r * COLS + c;
+      // Shuffle the grid deterministically across the list.
+      int slot = (i * 37) % N;
+      rects[slot] = SkRect::MakeXYWH(x, y, 10, 10);
+      ids[slot] = i + 42;
+    }
+  }
+  auto tree = DlRTree::MakeSTRPacked(rects, N, ids);
+  EXPECT_EQ(tree->leaf_count(), N);
+  EXPECT_GE(tree->node_count(), N);
+
+  // Each cell query finds exactly its own rectangle; the result index is
+  // determined by the packing order, but the id and bounds must match.
+  for (int i = 0; i < N; i++) {
+    std::vector<int> results;
+    auto query = rects[i].makeInset(2, 2);
+    tree->search(query, &results);
+    EXPECT_EQ(results.size(), 1u) << "query " << i;
+    EXPECT_EQ(tree->id(results[0]), ids[i]) << "query " << i;
+    EXPECT_EQ(tree->bounds(results[0]), rects[i]) << "query " << i;
+  }
+
+  // A query over everything finds every id exactly once.
+  std::vector<int> results;
+  tree->search(tree->bounds(), &results);
+  EXPECT_EQ(results.size(), static_cast<size_t>(N));
+  std::vector<bool> seen(N, false);
+  for (int result : results) {
+    int i = tree->id(result) - 42;
+    ASSERT_GE(i, 0);
+    ASSERT_LT(i, N);
+    EXPECT_FALSE(seen[i]);
+    seen[i] = true;
+  }
+}
+
 }  // namespace testing
 }  // namespace flutter
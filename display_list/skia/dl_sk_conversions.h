@@ -53,16 +53,20 @@ inline SkVertices::VertexMode ToSk(DlVertexMode dl_mode) {
 }
 
 inline SkSamplingOptions ToSk(DlImageSampling sampling) {
-  switch (sampling) {
-    case DlImageSampling::kCubic:
-      return SkSamplingOptions(SkCubicResampler{1 / 3.0f, 1 / 3.0f});
-    case DlImageSampling::kLinear:
-      return SkSamplingOptions(SkFilterMode::kLinear);
-    case DlImageSampling::kMipmapLinear:
-      return SkSamplingOptions(SkFilterMode::kLinear, SkMipmapMode::kLinear);
-    case DlImageSampling::kNearestNeighbor:
-      return SkSamplingOptions(SkFilterMode::kNearest);
-  }
+  // Pre-resolved options indexed by the contiguous enum values so that
+  // per-op translation during dispatch is a table load rather than a
+  // branch and construction.
+  static const SkSamplingOptions kSamplingOptions[] = {
+      // DlImageSampling::kNearestNeighbor
+      SkSamplingOptions(SkFilterMode::kNearest),
+      // DlImageSampling::kLinear
+      SkSamplingOptions(SkFilterMode::kLinear),
+      // DlImageSampling::kMipmapLinear
+      SkSamplingOptions(SkFilterMode::kLinear, SkMipmapMode::kLinear),
+      // DlImageSampling::kCubic
+      SkSamplingOptions(SkCubicResampler{1 / 3.0f, 1 / 3.0f}),
+  };
+  return kSamplingOptions[static_cast<int>(sampling)];
 }
 
 inline SkCanvas::SrcRectConstraint ToSk(
@@ -6,6 +6,7 @@
 
 #include <optional>
 #include <utility>
+#include "flutter/flow/frame_timings.h"
 #include "flutter/flow/layers/layer_tree.h"
 #include "third_party/skia/include/core/SkCanvas.h"
 
@@ -47,12 +48,14 @@ std::optional<SkRect> FrameDamage::ComputeClipRect(
 }
 
 CompositorContext::CompositorContext()
-    : texture_registry_(std::make_shared<TextureRegistry>()),
+    : raster_cache_(std::make_shared<RasterCache>()),
+      texture_registry_(std::make_shared<TextureRegistry>()),
       raster_time_(fixed_refresh_rate_updater_),
       ui_time_(fixed_refresh_rate_updater_) {}
 
 CompositorContext::CompositorContext(Stopwatch::RefreshRateUpdater& updater)
-    : texture_registry_(std::make_shared<TextureRegistry>()),
+    : raster_cache_(std::make_shared<RasterCache>()),
+      texture_registry_(std::make_shared<TextureRegistry>()),
       raster_time_(updater),
       ui_time_(updater) {}
 
@@ -112,16 +115,19 @@ CompositorContext::ScopedFrame::ScopedFrame(
 
 CompositorContext::ScopedFrame::~ScopedFrame() {
   context_.EndFrame(*this, instrumentation_enabled_);
+  context_.frame_arena().Reset();
 }
 
 RasterStatus CompositorContext::ScopedFrame::Raster(
     flutter::LayerTree& layer_tree,
     bool ignore_raster_cache,
-    FrameDamage* frame_damage) {
+    FrameDamage* frame_damage,
+    FrameTimingsRecorder* frame_timings_recorder) {
   TRACE_EVENT0("flutter", "CompositorContext::ScopedFrame::Raster");
 
   std::optional<SkRect> clip_rect;
   if (frame_damage) {
+    ScopedFrameTimingsSpan span(frame_timings_recorder, "ComputeFrameDamage");
     clip_rect = frame_damage->ComputeClipRect(layer_tree, !ignore_raster_cache,
                                               !gr_context_);
 
@@ -132,8 +138,12 @@ RasterStatus CompositorContext::ScopedFrame::Raster(
     }
   }
 
-  bool root_needs_readback = layer_tree.Preroll(
-      *this, ignore_raster_cache, clip_rect ? *clip_rect : kGiantRect);
+  bool root_needs_readback;
+  {
+    ScopedFrameTimingsSpan span(frame_timings_recorder, "LayerPreroll");
+    root_needs_readback = layer_tree.Preroll(
+        *this, ignore_raster_cache, clip_rect ? *clip_rect : kGiantRect);
+  }
   bool needs_save_layer = root_needs_readback && !surface_supports_readback();
   PostPrerollResult post_preroll_result = PostPrerollResult::kSuccess;
   if (view_embedder_ && raster_thread_merger_) {
@@ -148,11 +158,14 @@ RasterStatus CompositorContext::ScopedFrame::Raster(
     return RasterStatus::kSkipAndRetry;
   }
 
-  if (aiks_context_) {
-    PaintLayerTreeImpeller(layer_tree, clip_rect, ignore_raster_cache);
-  } else {
-    PaintLayerTreeSkia(layer_tree, clip_rect, needs_save_layer,
-                       ignore_raster_cache);
+  {
+    ScopedFrameTimingsSpan span(frame_timings_recorder, "PaintLayerTree");
+    if (aiks_context_) {
+      PaintLayerTreeImpeller(layer_tree, clip_rect, ignore_raster_cache);
+    } else {
+      PaintLayerTreeSkia(layer_tree, clip_rect, needs_save_layer,
+                         ignore_raster_cache);
+    }
   }
   return RasterStatus::kSuccess;
 }
@@ -11,6 +11,7 @@
 #include "flutter/common/graphics/texture.h"
 #include "flutter/flow/diff_context.h"
 #include "flutter/flow/embedded_views.h"
+#include "flutter/flow/frame_arena.h"
 #include "flutter/flow/layer_snapshot_store.h"
 #include "flutter/flow/raster_cache.h"
 #include "flutter/flow/stopwatch.h"
@@ -19,8 +20,13 @@
 #include "third_party/skia/include/core/SkCanvas.h"
 #include "third_party/skia/include/gpu/GrDirectContext.h"
 
+namespace fml {
+class ConcurrentTaskRunner;
+}  // namespace fml
+
 namespace flutter {
 
+class FrameTimingsRecorder;
 class LayerTree;
 
 // The result status of CompositorContext::ScopedFrame::Raster.
@@ -135,9 +141,18 @@ class CompositorContext {
 
     impeller::AiksContext* aiks_context() const { return aiks_context_; }
 
+    /// The shared scratch arena for this frame. Reset when the frame ends,
+    /// so allocations must not outlive the frame. Only one frame may be
+    /// live on a compositor context at a time.
+    FrameArena& frame_arena() { return context_.frame_arena(); }
+
+    /// Rasterizes the layer tree. When a frame timings recorder is provided,
+    /// the preroll and paint sub-phases are reported to it as timing spans.
     virtual RasterStatus Raster(LayerTree& layer_tree,
                                 bool ignore_raster_cache,
-                                FrameDamage* frame_damage);
+                                FrameDamage* frame_damage,
+                                FrameTimingsRecorder* frame_timings_recorder =
+                                    nullptr);
 
    private:
     void PaintLayerTreeSkia(flutter::LayerTree& layer_tree,
@@ -182,7 +197,22 @@ class CompositorContext {
 
   void OnGrContextDestroyed();
 
-  RasterCache& raster_cache() { return raster_cache_; }
+  RasterCache& raster_cache() { return *raster_cache_; }
+
+  /// The raster cache as a shareable reference. Shells spawned into the same
+  /// engine group run on one raster thread and may adopt each other's cache
+  /// via |SetRasterCache| to pool cached pictures and layers under a single
+  /// GPU budget.
+  const std::shared_ptr<RasterCache>& shared_raster_cache() const {
+    return raster_cache_;
+  }
+
+  /// Replaces this context's raster cache with one shared with another
+  /// compositor context. Must only be called on the raster thread, and only
+  /// before this context rasterizes its first frame.
+  void SetRasterCache(std::shared_ptr<RasterCache> raster_cache) {
+    raster_cache_ = std::move(raster_cache);
+  }
 
   std::shared_ptr<TextureRegistry> texture_registry() {
     return texture_registry_;
@@ -194,12 +224,31 @@ class CompositorContext {
 
   LayerSnapshotStore& snapshot_store() { return layer_snapshot_store_; }
 
+  /// The per-frame scratch arena shared by raster thread subsystems. Reset
+  /// by ScopedFrame at the end of every frame; its chunks are retained so
+  /// steady state frames allocate without touching the heap.
+  FrameArena& frame_arena() { return frame_arena_; }
+
+  /// The worker pool that LayerTree::Preroll fans independent subtrees out
+  /// to, or null when parallel preroll is disabled.
+  const std::shared_ptr<fml::ConcurrentTaskRunner>&
+  parallel_preroll_task_runner() const {
+    return parallel_preroll_task_runner_;
+  }
+
+  void SetParallelPrerollTaskRunner(
+      std::shared_ptr<fml::ConcurrentTaskRunner> task_runner) {
+    parallel_preroll_task_runner_ = std::move(task_runner);
+  }
+
  private:
-  RasterCache raster_cache_;
+  std::shared_ptr<RasterCache> raster_cache_;
   std::shared_ptr<TextureRegistry> texture_registry_;
   Stopwatch raster_time_;
   Stopwatch ui_time_;
   LayerSnapshotStore layer_snapshot_store_;
+  std::shared_ptr<fml::ConcurrentTaskRunner> parallel_preroll_task_runner_;
+  FrameArena frame_arena_;
 
   /// Only used by default constructor of `CompositorContext`.
   FixedRefreshRateUpdater fixed_refresh_rate_updater_;
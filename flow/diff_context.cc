@@ -7,6 +7,8 @@
 
 namespace flutter {
 
+std::atomic<uint64_t> DiffContext::next_frame_generation_{1};
+
 DiffContext::DiffContext(SkISize frame_size,
                          PaintRegionMap& this_frame_paint_region_map,
                          const PaintRegionMap& last_frame_paint_region_map,
@@ -17,6 +19,7 @@ DiffContext::DiffContext(SkISize frame_size,
       frame_size_(frame_size),
       this_frame_paint_region_map_(this_frame_paint_region_map),
       last_frame_paint_region_map_(last_frame_paint_region_map),
+      frame_generation_(next_frame_generation_.fetch_add(1)),
       has_raster_cache_(has_raster_cache),
       impeller_enabled_(impeller_enabled) {}
 
@@ -257,17 +260,25 @@ void DiffContext::AddDamage(const SkRect& rect) {
 void DiffContext::SetLayerPaintRegion(const Layer* layer,
                                       const PaintRegion& region) {
   this_frame_paint_region_map_[layer->unique_id()] = region;
+  layer->StorePaintRegion(region, frame_generation_);
 }
 
 PaintRegion DiffContext::GetOldLayerPaintRegion(const Layer* layer) const {
   auto i = last_frame_paint_region_map_.find(layer->unique_id());
   if (i != last_frame_paint_region_map_.end()) {
     return i->second;
-  } else {
-    // This is valid when Layer::PreservePaintRegion is called for retained
-    // layer with zero sized parent clip (these layers are not diffed)
-    return PaintRegion();
   }
+  // The layer may have been inside a retained subtree whose children were
+  // skipped in a previous diff, in which case its region was never copied
+  // to the map. The region stamped on the instance is still valid because
+  // every ancestor was retained in between, so the layer could not have
+  // painted anywhere else since the stamp was made.
+  if (const PaintRegion* region = layer->FindPaintRegion(frame_generation_)) {
+    return *region;
+  }
+  // This is valid when Layer::PreservePaintRegion is called for retained
+  // layer with zero sized parent clip (these layers are not diffed)
+  return PaintRegion();
 }
 
 void DiffContext::Statistics::LogStatistics() {
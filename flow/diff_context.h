@@ -5,6 +5,7 @@
 #ifndef FLUTTER_FLOW_DIFF_CONTEXT_H_
 #define FLUTTER_FLOW_DIFF_CONTEXT_H_
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <optional>
@@ -152,15 +153,22 @@ class DiffContext {
   void AddDamage(const PaintRegion& damage);
 
   // Associates the paint region with specified layer and current layer tree.
-  // The paint region can not be stored directly in layer itself, because same
-  // retained layer instance can possibly paint in different locations depending
-  // on ancestor layers.
+  // The region is stored in the per-frame map and also stamped on the layer
+  // with the current frame generation. The map remains authoritative because
+  // the same retained layer instance can possibly paint in different
+  // locations depending on ancestor layers; the stamped copy only serves
+  // lookups for layers whose regions were never copied to the map because
+  // their whole subtree was skipped as retained.
   void SetLayerPaintRegion(const Layer* layer, const PaintRegion& region);
 
   // Retrieves the paint region associated with specified layer and previous
   // frame layer tree.
   PaintRegion GetOldLayerPaintRegion(const Layer* layer) const;
 
+  // Monotonically increasing generation of this diff run, used to stamp
+  // paint regions stored on layer instances.
+  uint64_t frame_generation() const { return frame_generation_; }
+
   // Whether or not a raster cache is being used. If so, we must snap
   // all transformations to physical pixels if the layer may be raster
   // cached.
@@ -251,9 +259,12 @@ class DiffContext {
 
   PaintRegionMap& this_frame_paint_region_map_;
   const PaintRegionMap& last_frame_paint_region_map_;
+  uint64_t frame_generation_;
   bool has_raster_cache_;
   bool impeller_enabled_;
 
+  static std::atomic<uint64_t> next_frame_generation_;
+
   void AddDamage(const SkRect& rect);
 
   void AlignRect(SkIRect& rect,
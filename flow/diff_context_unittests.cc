@@ -32,5 +32,82 @@ TEST_F(DiffContextTest, ClipAlignment) {
   EXPECT_EQ(damage.buffer_damage, SkIRect::MakeLTRB(16, 16, 64, 64));
 }
 
+TEST_F(DiffContextTest, RetainedSubtreeSkipsChildWalk) {
+  // Deep retained subtree next to a changing sibling; the damage of the
+  // changing sibling must stay correct across frames even though the
+  // retained subtree's children are never re-walked and their paint
+  // regions only live stamped on the layer instances.
+  auto retained_child = CreateDisplayListLayer(
+      CreateDisplayList(SkRect::MakeLTRB(10, 10, 30, 30)));
+  auto retained_subtree =
+      CreateContainerLayer(CreateContainerLayer(retained_child));
+
+  MockLayerTree t1;
+  t1.root()->Add(retained_subtree);
+  t1.root()->Add(CreateDisplayListLayer(
+      CreateDisplayList(SkRect::MakeLTRB(50, 50, 60, 60))));
+  DiffLayerTree(t1, MockLayerTree());
+
+  // Fully retained frame produces no damage.
+  MockLayerTree t2;
+  t2.root()->Add(retained_subtree);
+  t2.root()->Add(t1.root()->layers()[1]);
+  auto damage = DiffLayerTree(t2, t1);
+  EXPECT_EQ(damage.frame_damage, SkIRect::MakeEmpty());
+
+  // Replacing the sibling damages only the sibling's regions while the
+  // subtree remains skipped.
+  MockLayerTree t3;
+  t3.root()->Add(retained_subtree);
+  t3.root()->Add(CreateDisplayListLayer(
+      CreateDisplayList(SkRect::MakeLTRB(50, 50, 80, 80))));
+  damage = DiffLayerTree(t3, t2);
+  EXPECT_EQ(damage.frame_damage, SkIRect::MakeLTRB(50, 50, 80, 80));
+
+  // Removing the retained subtree after frames of being skipped must
+  // still produce its full damage from the preserved root region.
+  MockLayerTree t4;
+  t4.root()->Add(t3.root()->layers()[1]);
+  damage = DiffLayerTree(t4, t3);
+  EXPECT_EQ(damage.frame_damage, SkIRect::MakeLTRB(10, 10, 30, 30));
+}
+
+TEST_F(DiffContextTest, RetainedChildRegionFoundWithoutMapEntry) {
+  // After a subtree has been skipped as retained, partially changing it
+  // must find the unchanged grandchildren's old regions from the stamps
+  // on the instances, since they were never copied into the per-frame
+  // paint region map.
+  auto stable_child = CreateDisplayListLayer(
+      CreateDisplayList(SkRect::MakeLTRB(10, 10, 30, 30)));
+  auto changing_child = CreateDisplayListLayer(
+      CreateDisplayList(SkRect::MakeLTRB(40, 40, 50, 50)));
+  auto inner = CreateContainerLayer({stable_child, changing_child});
+  auto outer = CreateContainerLayer(inner);
+
+  MockLayerTree t1;
+  t1.root()->Add(outer);
+  DiffLayerTree(t1, MockLayerTree());
+
+  // Fully retained; inner layers are skipped, not walked.
+  MockLayerTree t2;
+  t2.root()->Add(outer);
+  auto damage = DiffLayerTree(t2, t1);
+  EXPECT_EQ(damage.frame_damage, SkIRect::MakeEmpty());
+
+  // Replace one grandchild; the stable grandchild is retained via its
+  // stamped region and produces no damage.
+  auto new_inner = CreateContainerLayer(
+      {stable_child, CreateDisplayListLayer(
+                         CreateDisplayList(SkRect::MakeLTRB(40, 40, 70, 70)))});
+  new_inner->AssignOldLayer(inner.get());
+  auto new_outer = CreateContainerLayer(new_inner);
+  new_outer->AssignOldLayer(outer.get());
+
+  MockLayerTree t3;
+  t3.root()->Add(new_outer);
+  damage = DiffLayerTree(t3, t2);
+  EXPECT_EQ(damage.frame_damage, SkIRect::MakeLTRB(40, 40, 70, 70));
+}
+
 }  // namespace testing
 }  // namespace flutter
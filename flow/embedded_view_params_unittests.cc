@@ -93,5 +93,33 @@ TEST(EmbeddedViewParams,
   ASSERT_TRUE(SkScalarNearlyEqual(rect.height(), 3));
 }
 
+TEST(EmbeddedViewParams, HashReflectsInputs) {
+  MutatorsStack stack;
+  stack.PushTransform(SkMatrix::Scale(2, 2));
+
+  MutatorsStack stack_same;
+  stack_same.PushTransform(SkMatrix::Scale(2, 2));
+
+  EmbeddedViewParams params(SkMatrix::Scale(2, 2), SkSize::Make(1, 1), stack);
+  EmbeddedViewParams params_same(SkMatrix::Scale(2, 2), SkSize::Make(1, 1),
+                                 stack_same);
+  ASSERT_TRUE(params == params_same);
+  ASSERT_EQ(params.GetHash(), params_same.GetHash());
+
+  EmbeddedViewParams params_other_size(SkMatrix::Scale(2, 2),
+                                       SkSize::Make(2, 2), stack);
+  ASSERT_NE(params.GetHash(), params_other_size.GetHash());
+
+  EmbeddedViewParams params_other_matrix(SkMatrix::Scale(3, 3),
+                                         SkSize::Make(1, 1), stack);
+  ASSERT_NE(params.GetHash(), params_other_matrix.GetHash());
+
+  MutatorsStack stack_other;
+  stack_other.PushOpacity(128);
+  EmbeddedViewParams params_other_stack(SkMatrix::Scale(2, 2),
+                                        SkSize::Make(1, 1), stack_other);
+  ASSERT_NE(params.GetHash(), params_other_stack.GetHash());
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -49,41 +49,86 @@ void ExternalViewEmbedder::SubmitFrame(
   frame->Submit();
 }
 
+std::size_t Mutator::GetHash() const {
+  switch (type_) {
+    case kClipRect:
+      return fml::HashCombine(type_, rect_.fLeft, rect_.fTop, rect_.fRight,
+                              rect_.fBottom);
+    case kClipRRect: {
+      const SkRect& rect = rrect_.rect();
+      std::size_t hash = fml::HashCombine(type_, rect.fLeft, rect.fTop,
+                                          rect.fRight, rect.fBottom);
+      for (auto corner : {SkRRect::kUpperLeft_Corner, SkRRect::kUpperRight_Corner,
+                          SkRRect::kLowerRight_Corner,
+                          SkRRect::kLowerLeft_Corner}) {
+        SkVector radii = rrect_.radii(corner);
+        fml::HashCombineSeed(hash, radii.fX, radii.fY);
+      }
+      return hash;
+    }
+    case kClipPath:
+      // Hashing the path data would cost as much as comparing it; the
+      // generation id identifies the path contents cheaply. Equal paths in
+      // different instances may hash differently, which only costs a missed
+      // reuse, never an incorrect one.
+      return fml::HashCombine(type_, path_->getGenerationID());
+    case kTransform: {
+      std::size_t hash = fml::HashCombine(type_);
+      for (int i = 0; i < 9; i++) {
+        fml::HashCombineSeed(hash, matrix_.get(i));
+      }
+      return hash;
+    }
+    case kOpacity:
+      return fml::HashCombine(type_, alpha_);
+    case kBackdropFilter: {
+      // The filter is hashed by instance identity for the same reason paths
+      // are hashed by generation id.
+      const SkRect& rect = filter_mutation_->GetFilterRect();
+      return fml::HashCombine(type_, &filter_mutation_->GetFilter(),
+                              rect.fLeft, rect.fTop, rect.fRight,
+                              rect.fBottom);
+    }
+  }
+  return fml::HashCombine(type_);
+}
+
+void MutatorsStack::PushMutator(const std::shared_ptr<Mutator>& mutator) {
+  std::size_t hash = GetHash();
+  fml::HashCombineSeed(hash, mutator->GetHash());
+  vector_.push_back(mutator);
+  hash_chain_.push_back(hash);
+}
+
 void MutatorsStack::PushClipRect(const SkRect& rect) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(rect);
-  vector_.push_back(element);
+  PushMutator(std::make_shared<Mutator>(rect));
 }
 
 void MutatorsStack::PushClipRRect(const SkRRect& rrect) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(rrect);
-  vector_.push_back(element);
+  PushMutator(std::make_shared<Mutator>(rrect));
 }
 
 void MutatorsStack::PushClipPath(const SkPath& path) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(path);
-  vector_.push_back(element);
+  PushMutator(std::make_shared<Mutator>(path));
 }
 
 void MutatorsStack::PushTransform(const SkMatrix& matrix) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(matrix);
-  vector_.push_back(element);
+  PushMutator(std::make_shared<Mutator>(matrix));
 }
 
 void MutatorsStack::PushOpacity(const int& alpha) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(alpha);
-  vector_.push_back(element);
+  PushMutator(std::make_shared<Mutator>(alpha));
 }
 
 void MutatorsStack::PushBackdropFilter(
     const std::shared_ptr<const DlImageFilter>& filter,
     const SkRect& filter_rect) {
-  std::shared_ptr<Mutator> element =
-      std::make_shared<Mutator>(filter, filter_rect);
-  vector_.push_back(element);
+  PushMutator(std::make_shared<Mutator>(filter, filter_rect));
 }
 
 void MutatorsStack::Pop() {
   vector_.pop_back();
+  hash_chain_.pop_back();
 }
 
 void MutatorsStack::PopTo(size_t stack_count) {
@@ -112,6 +157,15 @@ const std::vector<std::shared_ptr<Mutator>>::const_iterator MutatorsStack::End()
   return vector_.end();
 }
 
+std::size_t EmbeddedViewParams::GetHash() const {
+  std::size_t hash = mutators_stack_.GetHash();
+  fml::HashCombineSeed(hash, size_points_.width(), size_points_.height());
+  for (int i = 0; i < 9; i++) {
+    fml::HashCombineSeed(hash, matrix_.get(i));
+  }
+  return hash;
+}
+
 bool ExternalViewEmbedder::SupportsDynamicThreadMerging() {
   return false;
 }
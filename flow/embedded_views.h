@@ -11,6 +11,7 @@
 #include "flutter/display_list/dl_builder.h"
 #include "flutter/display_list/skia/dl_sk_canvas.h"
 #include "flutter/flow/surface_frame.h"
+#include "flutter/fml/hash_combine.h"
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/fml/raster_thread_merger.h"
 #include "third_party/skia/include/core/SkMatrix.h"
@@ -127,6 +128,13 @@ class Mutator {
   const int& GetAlpha() const { return alpha_; }
   float GetAlphaFloat() const { return (alpha_ / 255.0f); }
 
+  // Returns a hash of the mutation. Mutators that compare equal usually
+  // hash equally, but paths and backdrop filters are hashed by instance
+  // identity, so equal values in different instances may hash differently.
+  // Unequal hashes are therefore only suitable for quickly rejecting a
+  // cached computation; a matching hash must be confirmed with operator==.
+  std::size_t GetHash() const;
+
   bool operator==(const Mutator& other) const {
     if (type_ != other.type_) {
       return false;
@@ -225,6 +233,14 @@ class MutatorsStack {
   bool is_empty() const { return vector_.empty(); }
   size_t stack_count() const { return vector_.size(); }
 
+  // Returns a hash of the entire stack of mutations in order. The hash is
+  // maintained incrementally as mutators are pushed and popped so querying
+  // it is cheap. See |Mutator::GetHash| for the caveats on using hashes of
+  // mutations as anything other than a fast rejection test.
+  std::size_t GetHash() const {
+    return hash_chain_.empty() ? fml::HashCombine() : hash_chain_.back();
+  }
+
   bool operator==(const MutatorsStack& other) const {
     if (vector_.size() != other.vector_.size()) {
       return false;
@@ -258,7 +274,13 @@ class MutatorsStack {
   }
 
  private:
+  void PushMutator(const std::shared_ptr<Mutator>& mutator);
+
   std::vector<std::shared_ptr<Mutator>> vector_;
+
+  // The hash of each prefix of vector_, so that GetHash is O(1) and Pop
+  // can simply truncate back to the hash of the remaining mutations.
+  std::vector<std::size_t> hash_chain_;
 };  // MutatorsStack
 
 class EmbeddedViewParams {
@@ -271,11 +293,7 @@ class EmbeddedViewParams {
       : matrix_(matrix),
         size_points_(size_points),
         mutators_stack_(mutators_stack) {
-    SkPath path;
-    SkRect starting_rect = SkRect::MakeSize(size_points);
-    path.addRect(starting_rect);
-    path.transform(matrix);
-    final_bounding_rect_ = path.getBounds();
+    matrix.mapRect(&final_bounding_rect_, SkRect::MakeSize(size_points));
   }
 
   // The transformation Matrix corresponding to the sum of all the
@@ -307,6 +325,12 @@ class EmbeddedViewParams {
            matrix_ == other.matrix_;
   }
 
+  // Returns a hash of the inputs (transform, size and mutators stack) that
+  // produced these parameters. Useful as a fast rejection test when reusing
+  // a previous frame's composition; a matching hash should be confirmed
+  // with operator== before the cached result is trusted.
+  std::size_t GetHash() const;
+
  private:
   SkMatrix matrix_;
   SkSize size_points_;
@@ -0,0 +1,59 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/frame_arena.h"
+
+#include <algorithm>
+
+#include "flutter/fml/logging.h"
+
+namespace flutter {
+
+FrameArena::FrameArena() = default;
+
+FrameArena::~FrameArena() = default;
+
+void* FrameArena::Allocate(size_t size, size_t alignment) {
+  FML_DCHECK((alignment & (alignment - 1)) == 0);
+  uintptr_t position = reinterpret_cast<uintptr_t>(cursor_);
+  uintptr_t aligned = (position + alignment - 1) & ~(alignment - 1);
+  size_t padding = aligned - position;
+  if (cursor_ == nullptr || padding + size > remaining_) {
+    // Oversized requests get a dedicated chunk so a single large allocation
+    // cannot strand the tail of the current chunk. Reset consolidates any
+    // overflow chunks away again.
+    const size_t chunk_size = std::max(kChunkSize, size + alignment);
+    chunks_.push_back(Chunk{std::make_unique<uint8_t[]>(chunk_size),  //
+                            chunk_size});
+    cursor_ = chunks_.back().storage.get();
+    remaining_ = chunk_size;
+    position = reinterpret_cast<uintptr_t>(cursor_);
+    aligned = (position + alignment - 1) & ~(alignment - 1);
+    padding = aligned - position;
+  }
+  cursor_ += padding + size;
+  remaining_ -= padding + size;
+  return reinterpret_cast<void*>(aligned);
+}
+
+void FrameArena::Reset() {
+  if (chunks_.empty()) {
+    return;
+  }
+  if (chunks_.size() > 1) {
+    // The frame overflowed the retained chunk. Replace the chunk list with a
+    // single chunk sized to the frame's high water mark so the next frame of
+    // similar complexity is served from one chunk without growing again.
+    size_t total = 0;
+    for (const Chunk& chunk : chunks_) {
+      total += chunk.size;
+    }
+    chunks_.clear();
+    chunks_.push_back(Chunk{std::make_unique<uint8_t[]>(total), total});
+  }
+  cursor_ = chunks_.front().storage.get();
+  remaining_ = chunks_.front().size;
+}
+
+}  // namespace flutter
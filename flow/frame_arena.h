@@ -0,0 +1,133 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_FRAME_ARENA_H_
+#define FLUTTER_FLOW_FRAME_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+
+namespace flutter {
+
+/// A per-frame bump allocator for raster thread scratch memory.
+///
+/// CompositorContext owns one arena that its ScopedFrame shares with every
+/// subsystem rasterizing the frame (via the frame_arena pointers on
+/// PrerollContext and PaintContext). The frame resets the arena when it ends,
+/// and Reset recycles the chunks in place, so once the arena has grown to the
+/// high water mark of the scene, steady state frames serve all of their
+/// frame-temporary allocations with pointer bumps and never touch malloc.
+///
+/// Individual deallocation is a no-op: everything handed out between two
+/// resets is reclaimed in bulk, so arena-backed objects and containers must
+/// not outlive the frame that allocated them. Allocation is not thread safe;
+/// all allocations from an arena must happen on the raster thread.
+class FrameArena {
+ public:
+  static constexpr size_t kChunkSize = 65536;
+
+  FrameArena();
+
+  ~FrameArena();
+
+  /// Allocates uninitialized frame-scoped storage.
+  void* Allocate(size_t size, size_t alignment);
+
+  /// Allocates and constructs a frame-scoped T. T must be trivially
+  /// destructible because destructors never run; the storage is recycled
+  /// wholesale by |Reset|.
+  template <typename T, typename... Args>
+  T* Make(Args&&... args) {
+    static_assert(std::is_trivially_destructible_v<T>,
+                  "Arena storage is recycled without running destructors.");
+    return new (Allocate(sizeof(T), alignof(T)))
+        T(std::forward<Args>(args)...);
+  }
+
+  /// A std compatible allocator over an optional arena. When the arena is
+  /// null the allocator falls back to the heap, which lets subsystems adopt
+  /// arena allocation incrementally: contexts built without an active frame
+  /// (|LayerTree::Flatten|, tests) simply keep their old behavior.
+  template <typename T>
+  class Allocator {
+   public:
+    using value_type = T;
+
+    explicit Allocator(FrameArena* arena) : arena_(arena) {}
+
+    template <typename U>
+    Allocator(const Allocator<U>& other) : arena_(other.arena()) {}
+
+    T* allocate(size_t n) {
+      if (arena_) {
+        return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+      }
+      return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, size_t n) {
+      // Arena storage is recycled in bulk by |FrameArena::Reset|.
+      if (!arena_) {
+        ::operator delete(pointer);
+      }
+    }
+
+    FrameArena* arena() const { return arena_; }
+
+    template <typename U>
+    bool operator==(const Allocator<U>& other) const {
+      return arena_ == other.arena();
+    }
+
+    template <typename U>
+    bool operator!=(const Allocator<U>& other) const {
+      return arena_ != other.arena();
+    }
+
+   private:
+    FrameArena* arena_;
+  };
+
+  /// A vector whose storage comes from the arena. Element destructors run
+  /// normally; only the backing storage is frame-scoped.
+  template <typename T>
+  using Vector = std::vector<T, Allocator<T>>;
+
+  /// Makes a |Vector| backed by `arena`, or by the heap when `arena` is
+  /// null.
+  template <typename T>
+  static Vector<T> MakeVector(FrameArena* arena) {
+    return Vector<T>(Allocator<T>(arena));
+  }
+
+  /// Recycles all outstanding allocations. The backing chunks are retained
+  /// (and consolidated to the high water mark) so the next frame reuses them.
+  void Reset();
+
+  /// The number of chunks allocated so far. Only used by tests.
+  size_t GetChunkCount() const { return chunks_.size(); }
+
+ private:
+  struct Chunk {
+    std::unique_ptr<uint8_t[]> storage;
+    size_t size;
+  };
+
+  std::vector<Chunk> chunks_;
+  uint8_t* cursor_ = nullptr;
+  size_t remaining_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(FrameArena);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_FRAME_ARENA_H_
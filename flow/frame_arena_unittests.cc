@@ -0,0 +1,86 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/frame_arena.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(FrameArenaTest, AllocationsBumpWithinOneChunk) {
+  FrameArena arena;
+  auto* first = arena.Make<int>(1);
+  auto* second = arena.Make<int>(2);
+  EXPECT_EQ(*first, 1);
+  EXPECT_EQ(*second, 2);
+  EXPECT_EQ(arena.GetChunkCount(), 1u);
+  // Consecutive small allocations bump forward through the same chunk.
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(second),
+            reinterpret_cast<uintptr_t>(first) + sizeof(int));
+}
+
+TEST(FrameArenaTest, AllocationsAreAligned) {
+  FrameArena arena;
+  arena.Allocate(1, 1);
+  void* aligned = arena.Allocate(sizeof(double), alignof(double));
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned) % alignof(double), 0u);
+}
+
+TEST(FrameArenaTest, ResetRecyclesChunkStorage) {
+  FrameArena arena;
+  void* first = arena.Allocate(64, 8);
+  arena.Reset();
+  void* second = arena.Allocate(64, 8);
+  // The chunk is retained across Reset, so the next frame's first allocation
+  // reuses the same storage without going back to the heap.
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(arena.GetChunkCount(), 1u);
+}
+
+TEST(FrameArenaTest, ResetConsolidatesOverflowChunks) {
+  FrameArena arena;
+  // Overflow the first chunk to force a second one.
+  arena.Allocate(FrameArena::kChunkSize - 64, 8);
+  arena.Allocate(FrameArena::kChunkSize - 64, 8);
+  EXPECT_EQ(arena.GetChunkCount(), 2u);
+  arena.Reset();
+  EXPECT_EQ(arena.GetChunkCount(), 1u);
+  // The consolidated chunk covers the previous frame's high water mark, so a
+  // frame of the same complexity no longer grows the arena.
+  arena.Allocate(FrameArena::kChunkSize - 64, 8);
+  arena.Allocate(FrameArena::kChunkSize - 64, 8);
+  EXPECT_EQ(arena.GetChunkCount(), 1u);
+}
+
+TEST(FrameArenaTest, OversizedAllocationsGetDedicatedChunks) {
+  FrameArena arena;
+  arena.Allocate(64, 8);
+  arena.Allocate(4 * FrameArena::kChunkSize, 8);
+  EXPECT_EQ(arena.GetChunkCount(), 2u);
+  // The tail of the first chunk is not stranded by the oversized request.
+  arena.Reset();
+  EXPECT_EQ(arena.GetChunkCount(), 1u);
+}
+
+TEST(FrameArenaTest, VectorUsesArenaStorage) {
+  FrameArena arena;
+  auto vector = FrameArena::MakeVector<int>(&arena);
+  vector.resize(100, 7);
+  EXPECT_EQ(arena.GetChunkCount(), 1u);
+  EXPECT_EQ(vector[99], 7);
+}
+
+TEST(FrameArenaTest, VectorFallsBackToHeapWithoutArena) {
+  // Contexts without an active frame pass a null arena; the vector behaves
+  // like a plain heap-backed std::vector.
+  auto vector = FrameArena::MakeVector<int>(nullptr);
+  vector.resize(100, 7);
+  vector.push_back(8);
+  EXPECT_EQ(vector[99], 7);
+  EXPECT_EQ(vector[100], 8);
+}
+
+}  // namespace testing
+}  // namespace flutter
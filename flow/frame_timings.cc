@@ -114,6 +114,17 @@ void FrameTimingsRecorder::RecordBuildStart(fml::TimePoint build_start) {
   (void)status;
 }
 
+void FrameTimingsRecorder::SetOldestInputTimestamp(fml::TimePoint timestamp) {
+  std::scoped_lock state_lock(state_mutex_);
+  oldest_input_timestamp_ = timestamp;
+}
+
+std::optional<fml::TimePoint> FrameTimingsRecorder::GetOldestInputTimestamp()
+    const {
+  std::scoped_lock state_lock(state_mutex_);
+  return oldest_input_timestamp_;
+}
+
 void FrameTimingsRecorder::RecordBuildEnd(fml::TimePoint build_end) {
   fml::Status status = RecordBuildEndImpl(build_end);
   FML_DCHECK(status.ok());
@@ -126,6 +137,41 @@ void FrameTimingsRecorder::RecordRasterStart(fml::TimePoint raster_start) {
   (void)status;
 }
 
+size_t FrameTimingsRecorder::BeginSpan(const char* label) {
+  std::scoped_lock state_lock(state_mutex_);
+  if (span_count_ >= FrameTiming::kMaxRasterSpans) {
+    return FrameTiming::kMaxRasterSpans;
+  }
+  const size_t index = span_count_++;
+  spans_[index].label = label;
+  spans_[index].begin = fml::TimePoint::Now();
+  spans_[index].end = spans_[index].begin;
+  spans_[index].depth = open_span_depth_++;
+  return index;
+}
+
+void FrameTimingsRecorder::EndSpan(size_t index) {
+  std::scoped_lock state_lock(state_mutex_);
+  if (index >= span_count_) {
+    return;
+  }
+  spans_[index].end = fml::TimePoint::Now();
+  if (open_span_depth_ > 0) {
+    open_span_depth_--;
+  }
+}
+
+size_t FrameTimingsRecorder::GetSpanCount() const {
+  std::scoped_lock state_lock(state_mutex_);
+  return span_count_;
+}
+
+FrameTiming::RasterSpan FrameTimingsRecorder::GetSpan(size_t index) const {
+  std::scoped_lock state_lock(state_mutex_);
+  FML_DCHECK(index < span_count_);
+  return spans_[index];
+}
+
 fml::Status FrameTimingsRecorder::RecordVsyncImpl(fml::TimePoint vsync_start,
                                                   fml::TimePoint vsync_target) {
   std::scoped_lock state_lock(state_mutex_);
@@ -200,6 +246,7 @@ FrameTiming FrameTimingsRecorder::RecordRasterEnd(const RasterCache* cache) {
   timing_.SetFrameNumber(GetFrameNumber());
   timing_.SetRasterCacheStatistics(layer_cache_count_, layer_cache_bytes_,
                                    picture_cache_count_, picture_cache_bytes_);
+  timing_.SetRasterSpans(spans_, span_count_);
   return timing_;
 }
 
@@ -224,6 +271,7 @@ std::unique_ptr<FrameTimingsRecorder> FrameTimingsRecorder::CloneUntil(
 
   if (state >= State::kBuildStart) {
     recorder->build_start_ = build_start_;
+    recorder->oldest_input_timestamp_ = oldest_input_timestamp_;
   }
 
   if (state >= State::kBuildEnd) {
@@ -241,6 +289,10 @@ std::unique_ptr<FrameTimingsRecorder> FrameTimingsRecorder::CloneUntil(
     recorder->layer_cache_bytes_ = layer_cache_bytes_;
     recorder->picture_cache_count_ = picture_cache_count_;
     recorder->picture_cache_bytes_ = picture_cache_bytes_;
+    for (size_t i = 0; i < span_count_; i++) {
+      recorder->spans_[i] = spans_[i];
+    }
+    recorder->span_count_ = span_count_;
   }
 
   return recorder;
@@ -280,4 +332,16 @@ void FrameTimingsRecorder::AssertInState(State state) const {
                               << ", actual state " << StateToString(state_);
 }
 
+ScopedFrameTimingsSpan::ScopedFrameTimingsSpan(FrameTimingsRecorder* recorder,
+                                               const char* label)
+    : recorder_(recorder),
+      index_(recorder ? recorder->BeginSpan(label)
+                      : FrameTiming::kMaxRasterSpans) {}
+
+ScopedFrameTimingsSpan::~ScopedFrameTimingsSpan() {
+  if (recorder_) {
+    recorder_->EndSpan(index_);
+  }
+}
+
 }  // namespace flutter
@@ -6,6 +6,7 @@
 #define FLUTTER_FLOW_FRAME_TIMINGS_H_
 
 #include <mutex>
+#include <optional>
 
 #include "flutter/common/settings.h"
 #include "flutter/flow/raster_cache.h"
@@ -93,12 +94,41 @@ class FrameTimingsRecorder {
   /// Records a build start event.
   void RecordBuildStart(fml::TimePoint build_start);
 
+  /// Records the platform timestamp of the oldest input event that
+  /// contributed to this frame. Stamped by the animator when frame building
+  /// begins so input-to-present latency can be derived at raster end.
+  void SetOldestInputTimestamp(fml::TimePoint timestamp);
+
+  /// The oldest contributing input event timestamp, if any input arrived
+  /// since the previous frame was built.
+  std::optional<fml::TimePoint> GetOldestInputTimestamp() const;
+
   /// Records a build end event.
   void RecordBuildEnd(fml::TimePoint build_end);
 
   /// Records a raster start event.
   void RecordRasterStart(fml::TimePoint raster_start);
 
+  /// Opens a hierarchical timing span with the given label and returns its
+  /// index for the matching `EndSpan` call.
+  ///
+  /// The label must have static storage duration. Spans nest: a span opened
+  /// while another span is still open is recorded one level deeper. The span
+  /// table has fixed capacity (`FrameTiming::kMaxRasterSpans`) so no
+  /// allocation happens on the raster thread; when the table is full the span
+  /// is dropped and `FrameTiming::kMaxRasterSpans` is returned.
+  size_t BeginSpan(const char* label);
+
+  /// Closes the span previously opened by `BeginSpan`. Out-of-range indices
+  /// (including the overflow sentinel) are ignored.
+  void EndSpan(size_t index);
+
+  /// The number of spans recorded so far.
+  size_t GetSpanCount() const;
+
+  /// Returns a copy of the span at the given index.
+  FrameTiming::RasterSpan GetSpan(size_t index) const;
+
   /// Clones the recorder until (and including) the specified state.
   std::unique_ptr<FrameTimingsRecorder> CloneUntil(State state);
 
@@ -152,18 +182,40 @@ class FrameTimingsRecorder {
   fml::TimePoint raster_start_;
   fml::TimePoint raster_end_;
   fml::TimePoint raster_end_wall_time_;
+  std::optional<fml::TimePoint> oldest_input_timestamp_;
 
   size_t layer_cache_count_;
   size_t layer_cache_bytes_;
   size_t picture_cache_count_;
   size_t picture_cache_bytes_;
 
+  FrameTiming::RasterSpan spans_[FrameTiming::kMaxRasterSpans];
+  size_t span_count_ = 0;
+  size_t open_span_depth_ = 0;
+
   // Set when `RecordRasterEnd` is called. Cannot be reset once set.
   FrameTiming timing_;
 
   FML_DISALLOW_COPY_ASSIGN_AND_MOVE(FrameTimingsRecorder);
 };
 
+/// Opens a timing span on the recorder for the duration of a C++ scope.
+///
+/// A null recorder is a no-op so call sites that are not always handed a
+/// recorder do not need to branch.
+class ScopedFrameTimingsSpan {
+ public:
+  ScopedFrameTimingsSpan(FrameTimingsRecorder* recorder, const char* label);
+
+  ~ScopedFrameTimingsSpan();
+
+ private:
+  FrameTimingsRecorder* recorder_;
+  size_t index_;
+
+  FML_DISALLOW_COPY_ASSIGN_AND_MOVE(ScopedFrameTimingsSpan);
+};
+
 }  // namespace flutter
 
 #endif  // FLUTTER_FLOW_FRAME_TIMINGS_H_
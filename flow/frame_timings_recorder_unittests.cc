@@ -190,6 +190,22 @@ TEST(FrameTimingsRecorderTest, ClonedHasSameBuildStart) {
   ASSERT_EQ(recorder->GetBuildStartTime(), cloned->GetBuildStartTime());
 }
 
+TEST(FrameTimingsRecorderTest, ClonedHasSameOldestInputTimestamp) {
+  auto recorder = std::make_unique<FrameTimingsRecorder>();
+
+  const auto now = fml::TimePoint::Now();
+  recorder->RecordVsync(now, now + fml::TimeDelta::FromMilliseconds(16));
+  recorder->RecordBuildStart(fml::TimePoint::Now());
+
+  ASSERT_FALSE(recorder->GetOldestInputTimestamp().has_value());
+  const auto input_timestamp = now - fml::TimeDelta::FromMilliseconds(4);
+  recorder->SetOldestInputTimestamp(input_timestamp);
+  ASSERT_EQ(recorder->GetOldestInputTimestamp(), input_timestamp);
+
+  auto cloned = recorder->CloneUntil(FrameTimingsRecorder::State::kBuildStart);
+  ASSERT_EQ(cloned->GetOldestInputTimestamp(), input_timestamp);
+}
+
 TEST(FrameTimingsRecorderTest, ClonedHasSameBuildEnd) {
   auto recorder = std::make_unique<FrameTimingsRecorder>();
 
@@ -285,6 +301,51 @@ TEST(FrameTimingsRecorderTest, ClonedHasSameRasterEndWithCache) {
   ASSERT_EQ(recorder->GetPictureCacheBytes(), cloned->GetPictureCacheBytes());
 }
 
+TEST(FrameTimingsRecorderTest, RecordsHierarchicalSpans) {
+  auto recorder = std::make_unique<FrameTimingsRecorder>();
+
+  const auto st = fml::TimePoint::Now();
+  const auto en = st + fml::TimeDelta::FromMillisecondsF(16);
+  recorder->RecordVsync(st, en);
+  recorder->RecordBuildStart(fml::TimePoint::Now());
+  recorder->RecordBuildEnd(fml::TimePoint::Now());
+  recorder->RecordRasterStart(fml::TimePoint::Now());
+
+  const size_t outer = recorder->BeginSpan("Outer");
+  const size_t inner = recorder->BeginSpan("Inner");
+  recorder->EndSpan(inner);
+  recorder->EndSpan(outer);
+
+  ASSERT_EQ(recorder->GetSpanCount(), 2u);
+  const auto outer_span = recorder->GetSpan(outer);
+  const auto inner_span = recorder->GetSpan(inner);
+  EXPECT_STREQ(outer_span.label, "Outer");
+  EXPECT_STREQ(inner_span.label, "Inner");
+  EXPECT_EQ(outer_span.depth, 0u);
+  EXPECT_EQ(inner_span.depth, 1u);
+  EXPECT_LE(outer_span.begin, inner_span.begin);
+  EXPECT_LE(inner_span.end, outer_span.end);
+
+  const auto timing = recorder->RecordRasterEnd();
+  ASSERT_EQ(timing.GetRasterSpanCount(), 2u);
+  EXPECT_STREQ(timing.GetRasterSpan(0).label, "Outer");
+  EXPECT_STREQ(timing.GetRasterSpan(1).label, "Inner");
+}
+
+TEST(FrameTimingsRecorderTest, SpansAreDroppedWhenTableIsFull) {
+  auto recorder = std::make_unique<FrameTimingsRecorder>();
+
+  for (size_t i = 0; i < FrameTiming::kMaxRasterSpans; i++) {
+    const size_t index = recorder->BeginSpan("Span");
+    ASSERT_EQ(index, i);
+    recorder->EndSpan(index);
+  }
+  const size_t overflow = recorder->BeginSpan("Overflow");
+  EXPECT_EQ(overflow, FrameTiming::kMaxRasterSpans);
+  recorder->EndSpan(overflow);
+  EXPECT_EQ(recorder->GetSpanCount(), FrameTiming::kMaxRasterSpans);
+}
+
 TEST(FrameTimingsRecorderTest, FrameNumberTraceArgIsValid) {
   auto recorder = std::make_unique<FrameTimingsRecorder>();
 
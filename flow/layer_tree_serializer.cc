@@ -0,0 +1,371 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/layer_tree_serializer.h"
+
+#include <cstring>
+#include <map>
+
+#include "flutter/display_list/dl_serializer.h"
+#include "flutter/flow/layers/clip_rect_layer.h"
+#include "flutter/flow/layers/clip_rrect_layer.h"
+#include "flutter/flow/layers/container_layer.h"
+#include "flutter/flow/layers/display_list_layer.h"
+#include "flutter/flow/layers/opacity_layer.h"
+#include "flutter/flow/layers/transform_layer.h"
+
+namespace flutter {
+
+namespace {
+
+// Deeper trees than this are rejected rather than recursed into so a
+// corrupt or hostile buffer cannot exhaust the stack.
+constexpr uint32_t kMaxTreeDepth = 512;
+
+void AppendBytes(std::vector<uint8_t>* buffer, const void* data, size_t size) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  buffer->insert(buffer->end(), bytes, bytes + size);
+}
+
+template <typename T>
+void Append(std::vector<uint8_t>* buffer, const T& value) {
+  AppendBytes(buffer, &value, sizeof(T));
+}
+
+void PadTo8(std::vector<uint8_t>* buffer, size_t base) {
+  while ((buffer->size() - base) % 8 != 0) {
+    buffer->push_back(0u);
+  }
+}
+
+// A bounds-checked cursor over the serialized buffer. Reads never copy
+// more than a record's worth of bytes and failure is sticky.
+class Reader {
+ public:
+  Reader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+  template <typename T>
+  bool Read(T* value) {
+    if (size_ - offset_ < sizeof(T)) {
+      return false;
+    }
+    memcpy(value, data_ + offset_, sizeof(T));
+    offset_ += sizeof(T);
+    return true;
+  }
+
+  // Returns a pointer into the buffer for |size| bytes, or nullptr if
+  // the buffer is exhausted. The returned span keeps the cursor's
+  // 8-byte alignment so DisplayList captures can be replayed in place.
+  const uint8_t* ReadSpan(size_t size) {
+    if (size_ - offset_ < size) {
+      return nullptr;
+    }
+    const uint8_t* span = data_ + offset_;
+    offset_ += size;
+    return span;
+  }
+
+  bool SkipPadding() {
+    while (offset_ % 8 != 0) {
+      if (offset_ >= size_) {
+        return false;
+      }
+      offset_++;
+    }
+    return true;
+  }
+
+  bool complete() const { return offset_ == size_; }
+
+ private:
+  const uint8_t* data_;
+  size_t size_;
+  size_t offset_ = 0;
+};
+
+bool CanSerializeLayer(const Layer* layer, uint32_t depth) {
+  if (layer == nullptr || depth > kMaxTreeDepth) {
+    return false;
+  }
+  switch (layer->layer_type()) {
+    case LayerType::kUnsupported:
+      return false;
+    case LayerType::kDisplayList: {
+      auto* dl_layer = static_cast<const DisplayListLayer*>(layer);
+      return dl_layer->display_list() != nullptr &&
+             DisplayListSerializer::CanSerialize(*dl_layer->display_list());
+    }
+    default:
+      break;
+  }
+  // All remaining supported types are containers.
+  const ContainerLayer* container = layer->as_container_layer();
+  FML_DCHECK(container != nullptr);
+  for (const auto& child : container->layers()) {
+    if (!CanSerializeLayer(child.get(), depth + 1)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Assigns each distinct DisplayList in the tree an index into the
+// capture table, in pre-order of first reference.
+void CollectDisplayLists(const Layer* layer,
+                         std::map<const DisplayList*, uint32_t>* indices,
+                         std::vector<const DisplayList*>* lists) {
+  if (layer->layer_type() == LayerType::kDisplayList) {
+    const DisplayList* list =
+        static_cast<const DisplayListLayer*>(layer)->display_list();
+    if (indices->find(list) == indices->end()) {
+      (*indices)[list] = static_cast<uint32_t>(lists->size());
+      lists->push_back(list);
+    }
+    return;
+  }
+  for (const auto& child : layer->as_container_layer()->layers()) {
+    CollectDisplayLists(child.get(), indices, lists);
+  }
+}
+
+void SerializeLayer(const Layer* layer,
+                    const std::map<const DisplayList*, uint32_t>& indices,
+                    std::vector<uint8_t>* buffer) {
+  const LayerType type = layer->layer_type();
+  Append(buffer, static_cast<uint32_t>(type));
+  switch (type) {
+    case LayerType::kTransform: {
+      SkScalar col_major[16];
+      static_cast<const TransformLayer*>(layer)->transform().getColMajor(
+          col_major);
+      AppendBytes(buffer, col_major, sizeof(col_major));
+      break;
+    }
+    case LayerType::kOpacity: {
+      auto* opacity = static_cast<const OpacityLayer*>(layer);
+      Append(buffer, static_cast<uint32_t>(opacity->alpha()));
+      Append(buffer, opacity->offset());
+      break;
+    }
+    case LayerType::kClipRect: {
+      auto* clip = static_cast<const ClipRectLayer*>(layer);
+      Append(buffer, clip->clip_shape());
+      Append(buffer, static_cast<uint32_t>(clip->clip_behavior()));
+      break;
+    }
+    case LayerType::kClipRRect: {
+      auto* clip = static_cast<const ClipRRectLayer*>(layer);
+      Append(buffer, clip->clip_shape());
+      Append(buffer, static_cast<uint32_t>(clip->clip_behavior()));
+      break;
+    }
+    case LayerType::kDisplayList: {
+      auto* dl_layer = static_cast<const DisplayListLayer*>(layer);
+      Append(buffer, dl_layer->offset());
+      Append(buffer, indices.at(dl_layer->display_list()));
+      return;  // Leaf layer, no children.
+    }
+    case LayerType::kContainer:
+      break;
+    case LayerType::kUnsupported:
+      FML_DCHECK(false) << "rejected by CanSerialize";
+      break;
+  }
+  const auto& children = layer->as_container_layer()->layers();
+  Append(buffer, static_cast<uint32_t>(children.size()));
+  for (const auto& child : children) {
+    SerializeLayer(child.get(), indices, buffer);
+  }
+}
+
+std::shared_ptr<Layer> DeserializeLayer(
+    Reader& reader,
+    const std::vector<sk_sp<DisplayList>>& lists,
+    uint32_t depth) {
+  if (depth > kMaxTreeDepth) {
+    return nullptr;
+  }
+  uint32_t type_value;
+  if (!reader.Read(&type_value)) {
+    return nullptr;
+  }
+  std::shared_ptr<ContainerLayer> container;
+  switch (static_cast<LayerType>(type_value)) {
+    case LayerType::kContainer:
+      container = std::make_shared<ContainerLayer>();
+      break;
+    case LayerType::kTransform: {
+      SkScalar m[16];
+      if (!reader.Read(&m)) {
+        return nullptr;
+      }
+      container = std::make_shared<TransformLayer>(SkM44::ColMajor(m));
+      break;
+    }
+    case LayerType::kOpacity: {
+      uint32_t alpha;
+      SkPoint offset;
+      if (!reader.Read(&alpha) || !reader.Read(&offset) ||
+          alpha > SK_AlphaOPAQUE) {
+        return nullptr;
+      }
+      container = std::make_shared<OpacityLayer>(static_cast<SkAlpha>(alpha),
+                                                 offset);
+      break;
+    }
+    case LayerType::kClipRect: {
+      SkRect rect;
+      uint32_t behavior;
+      if (!reader.Read(&rect) || !reader.Read(&behavior) ||
+          behavior < Clip::hardEdge ||
+          behavior > Clip::antiAliasWithSaveLayer) {
+        return nullptr;
+      }
+      container =
+          std::make_shared<ClipRectLayer>(rect, static_cast<Clip>(behavior));
+      break;
+    }
+    case LayerType::kClipRRect: {
+      SkRRect rrect;
+      uint32_t behavior;
+      if (!reader.Read(&rrect) || !reader.Read(&behavior) ||
+          behavior < Clip::hardEdge ||
+          behavior > Clip::antiAliasWithSaveLayer) {
+        return nullptr;
+      }
+      container =
+          std::make_shared<ClipRRectLayer>(rrect, static_cast<Clip>(behavior));
+      break;
+    }
+    case LayerType::kDisplayList: {
+      SkPoint offset;
+      uint32_t index;
+      if (!reader.Read(&offset) || !reader.Read(&index) ||
+          index >= lists.size()) {
+        return nullptr;
+      }
+      // Cache hints are not carried across processes; the receiving
+      // compositor re-derives caching decisions from its own frames.
+      return std::make_shared<DisplayListLayer>(offset, lists[index],
+                                                /*is_complex=*/false,
+                                                /*will_change=*/false);
+    }
+    default:
+      return nullptr;
+  }
+  uint32_t child_count;
+  if (!reader.Read(&child_count)) {
+    return nullptr;
+  }
+  for (uint32_t i = 0; i < child_count; i++) {
+    std::shared_ptr<Layer> child = DeserializeLayer(reader, lists, depth + 1);
+    if (!child) {
+      return nullptr;
+    }
+    container->Add(std::move(child));
+  }
+  return container;
+}
+
+}  // namespace
+
+bool LayerTreeSerializer::CanSerialize(const LayerTree& tree) {
+  return CanSerializeLayer(tree.root_layer(), 0u);
+}
+
+bool LayerTreeSerializer::Serialize(const LayerTree& tree,
+                                    std::vector<uint8_t>* buffer) {
+  FML_DCHECK(buffer != nullptr);
+  if (!CanSerialize(tree)) {
+    return false;
+  }
+
+  std::map<const DisplayList*, uint32_t> indices;
+  std::vector<const DisplayList*> lists;
+  CollectDisplayLists(tree.root_layer(), &indices, &lists);
+
+  const size_t base = buffer->size();
+
+  LayerTreeSerializedHeader header;
+  header.magic = kMagic;
+  header.version = kVersion;
+  header.frame_width = tree.frame_size().width();
+  header.frame_height = tree.frame_size().height();
+  header.display_list_count = static_cast<uint32_t>(lists.size());
+  header.reserved = 0u;
+  Append(buffer, header);
+
+  for (const DisplayList* list : lists) {
+    // The size prefix is filled in after the capture is written since
+    // DisplayListSerializer appends directly to the buffer.
+    const size_t size_slot = buffer->size();
+    Append(buffer, uint64_t{0});
+    const size_t capture_start = buffer->size();
+    if (!DisplayListSerializer::Serialize(*list, buffer)) {
+      // CanSerialize vetted every list; treat a failure here as a bug
+      // but unwind cleanly.
+      buffer->resize(base);
+      return false;
+    }
+    const uint64_t capture_size = buffer->size() - capture_start;
+    memcpy(buffer->data() + size_slot, &capture_size, sizeof(capture_size));
+    PadTo8(buffer, base);
+  }
+
+  SerializeLayer(tree.root_layer(), indices, buffer);
+  return true;
+}
+
+std::unique_ptr<LayerTree> LayerTreeSerializer::Deserialize(
+    const uint8_t* data,
+    size_t size) {
+  if (data == nullptr || reinterpret_cast<uintptr_t>(data) % 8 != 0) {
+    return nullptr;
+  }
+
+  Reader reader(data, size);
+  LayerTreeSerializedHeader header;
+  if (!reader.Read(&header) || header.magic != kMagic ||
+      header.version != kVersion || header.frame_width < 0 ||
+      header.frame_height < 0) {
+    return nullptr;
+  }
+
+  std::vector<sk_sp<DisplayList>> lists;
+  lists.reserve(header.display_list_count);
+  for (uint32_t i = 0; i < header.display_list_count; i++) {
+    uint64_t capture_size;
+    if (!reader.Read(&capture_size)) {
+      return nullptr;
+    }
+    const uint8_t* capture = reader.ReadSpan(capture_size);
+    if (capture == nullptr) {
+      return nullptr;
+    }
+    sk_sp<DisplayList> list =
+        DisplayListSerializer::Deserialize(capture, capture_size);
+    if (!list) {
+      return nullptr;
+    }
+    lists.push_back(std::move(list));
+    if (!reader.SkipPadding()) {
+      return nullptr;
+    }
+  }
+
+  std::shared_ptr<Layer> root = DeserializeLayer(reader, lists, 0u);
+  if (!root || !reader.complete()) {
+    return nullptr;
+  }
+
+  LayerTree::Config config;
+  config.root_layer = std::move(root);
+  // None of the serializable layer types host platform views.
+  config.has_platform_views = false;
+  return std::make_unique<LayerTree>(
+      config, SkISize::Make(header.frame_width, header.frame_height));
+}
+
+}  // namespace flutter
@@ -0,0 +1,84 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_LAYER_TREE_SERIALIZER_H_
+#define FLUTTER_FLOW_LAYER_TREE_SERIALIZER_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "flutter/flow/layers/layer_tree.h"
+
+namespace flutter {
+
+/// The fixed header that leads a serialized layer tree.
+///
+/// All fields are stored in the native byte order of the producing process
+/// and the header size is a multiple of 8 bytes so that the DisplayList
+/// captures that follow it retain their required alignment.
+struct LayerTreeSerializedHeader {
+  uint32_t magic;
+  uint32_t version;
+  int32_t frame_width;
+  int32_t frame_height;
+
+  /// The number of DisplayList captures between the header and the layer
+  /// records.
+  uint32_t display_list_count;
+  uint32_t reserved;
+};
+
+static_assert(sizeof(LayerTreeSerializedHeader) % 8 == 0,
+              "DisplayList captures must stay 8-byte aligned");
+
+/// A compact binary serialization of a LayerTree and the DisplayLists it
+/// references, for handing scenes from an app process to a compositor
+/// process that rasterizes them without re-recording.
+///
+/// The serialized form is a |LayerTreeSerializedHeader|, a table of
+/// DisplayList captures (each a |uint64_t| size followed by a
+/// |DisplayListSerializer| buffer, padded to 8 bytes), and then a pre-order
+/// stream of layer records: a |LayerType| tag, the layer's parameters, and
+/// for containers a child count followed by the child records.
+///
+/// Only trees built from the structural layer types (containers,
+/// transforms, opacity, rect and rrect clips) and serializable
+/// DisplayLists can be encoded; layers referencing process-local state
+/// (textures, platform views, engine-side filter objects, path clips)
+/// make the tree unserializable. Like the DisplayList capture format,
+/// the encoding is native byte order and not ABI-portable: both ends
+/// must run the same architecture and engine revision, which the
+/// version field guards.
+///
+/// The bytes are transport-agnostic. A shared-memory region is the
+/// intended channel, with the producer serializing into the region and
+/// the consumer deserializing from the mapped pointer (8-byte aligned),
+/// but any byte transport works. The deserialized tree is an ordinary
+/// LayerTree that the receiving shell submits to its rasterizer like
+/// a locally built scene.
+class LayerTreeSerializer {
+ public:
+  static constexpr uint32_t kMagic = 0x544c4c46;  // 'FLLT'
+  static constexpr uint32_t kVersion = 1u;
+
+  /// Returns whether every layer in |tree| can be encoded.
+  static bool CanSerialize(const LayerTree& tree);
+
+  /// Appends the serialized form of |tree| to |buffer| and returns true,
+  /// or returns false without modifying |buffer| if the tree contains
+  /// unsupported layers or unserializable DisplayLists.
+  static bool Serialize(const LayerTree& tree, std::vector<uint8_t>* buffer);
+
+  /// Rebuilds a LayerTree from a serialized buffer, or returns nullptr if
+  /// validation fails. |data| must be 8-byte aligned. The returned tree
+  /// owns rebuilt copies of the DisplayLists and is independent of the
+  /// buffer.
+  static std::unique_ptr<LayerTree> Deserialize(const uint8_t* data,
+                                                size_t size);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_LAYER_TREE_SERIALIZER_H_
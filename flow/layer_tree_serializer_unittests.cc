@@ -0,0 +1,128 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/layer_tree_serializer.h"
+
+#include "flutter/display_list/dl_builder.h"
+#include "flutter/display_list/dl_paint.h"
+#include "flutter/flow/layers/clip_path_layer.h"
+#include "flutter/flow/layers/clip_rect_layer.h"
+#include "flutter/flow/layers/clip_rrect_layer.h"
+#include "flutter/flow/layers/display_list_layer.h"
+#include "flutter/flow/layers/opacity_layer.h"
+#include "flutter/flow/layers/transform_layer.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+static sk_sp<DisplayList> BuildSerializableList() {
+  DisplayListBuilder builder;
+  DlPaint paint;
+  paint.setColor(DlColor::kRed());
+  builder.DrawRect({10, 10, 60, 60}, paint);
+  builder.DrawCircle({50, 50}, 20.0f, paint);
+  return builder.Build();
+}
+
+static std::unique_ptr<LayerTree> BuildSerializableTree() {
+  auto dl = BuildSerializableList();
+  auto root = std::make_shared<TransformLayer>(
+      SkMatrix::Translate(5.0f, 7.0f));
+  auto opacity =
+      std::make_shared<OpacityLayer>(128, SkPoint::Make(1.0f, 2.0f));
+  auto clip = std::make_shared<ClipRectLayer>(SkRect::MakeWH(80.0f, 80.0f),
+                                              Clip::hardEdge);
+  clip->Add(std::make_shared<DisplayListLayer>(SkPoint::Make(3.0f, 4.0f), dl,
+                                               false, false));
+  // Reference the same DisplayList twice to exercise capture dedup.
+  clip->Add(std::make_shared<DisplayListLayer>(SkPoint::Make(30.0f, 4.0f), dl,
+                                               false, false));
+  opacity->Add(clip);
+  root->Add(opacity);
+
+  LayerTree::Config config;
+  config.root_layer = root;
+  return std::make_unique<LayerTree>(config, SkISize::Make(200, 100));
+}
+
+TEST(LayerTreeSerializer, RoundTripPreservesStructure) {
+  auto tree = BuildSerializableTree();
+  ASSERT_TRUE(LayerTreeSerializer::CanSerialize(*tree));
+
+  std::vector<uint8_t> buffer;
+  ASSERT_TRUE(LayerTreeSerializer::Serialize(*tree, &buffer));
+  ASSERT_GT(buffer.size(), sizeof(LayerTreeSerializedHeader));
+
+  auto rebuilt = LayerTreeSerializer::Deserialize(buffer.data(),
+                                                  buffer.size());
+  ASSERT_TRUE(rebuilt);
+  EXPECT_EQ(rebuilt->frame_size(), SkISize::Make(200, 100));
+  EXPECT_FALSE(rebuilt->has_platform_views());
+
+  auto* transform = static_cast<TransformLayer*>(rebuilt->root_layer());
+  ASSERT_EQ(transform->layer_type(), LayerType::kTransform);
+  EXPECT_EQ(transform->transform(),
+            SkM44(SkMatrix::Translate(5.0f, 7.0f)));
+  ASSERT_EQ(transform->layers().size(), 1u);
+
+  auto* opacity = static_cast<OpacityLayer*>(transform->layers()[0].get());
+  ASSERT_EQ(opacity->layer_type(), LayerType::kOpacity);
+  EXPECT_EQ(opacity->alpha(), 128);
+  EXPECT_EQ(opacity->offset(), SkPoint::Make(1.0f, 2.0f));
+  ASSERT_EQ(opacity->layers().size(), 1u);
+
+  auto* clip = static_cast<ClipRectLayer*>(opacity->layers()[0].get());
+  ASSERT_EQ(clip->layer_type(), LayerType::kClipRect);
+  EXPECT_EQ(clip->clip_shape(), SkRect::MakeWH(80.0f, 80.0f));
+  EXPECT_EQ(clip->clip_behavior(), Clip::hardEdge);
+  ASSERT_EQ(clip->layers().size(), 2u);
+
+  auto* leaf = static_cast<DisplayListLayer*>(clip->layers()[0].get());
+  ASSERT_EQ(leaf->layer_type(), LayerType::kDisplayList);
+  EXPECT_EQ(leaf->offset(), SkPoint::Make(3.0f, 4.0f));
+  ASSERT_TRUE(leaf->display_list());
+  EXPECT_TRUE(BuildSerializableList()->Equals(leaf->display_list()));
+
+  auto* leaf2 = static_cast<DisplayListLayer*>(clip->layers()[1].get());
+  EXPECT_EQ(leaf2->offset(), SkPoint::Make(30.0f, 4.0f));
+  ASSERT_TRUE(leaf2->display_list());
+}
+
+TEST(LayerTreeSerializer, RejectsUnsupportedLayers) {
+  SkPath path;
+  path.addOval({10, 10, 40, 40});
+  auto root = std::make_shared<ClipPathLayer>(path, Clip::antiAlias);
+  root->Add(std::make_shared<DisplayListLayer>(
+      SkPoint::Make(0.0f, 0.0f), BuildSerializableList(), false, false));
+
+  LayerTree::Config config;
+  config.root_layer = root;
+  LayerTree tree(config, SkISize::Make(100, 100));
+
+  EXPECT_FALSE(LayerTreeSerializer::CanSerialize(tree));
+  std::vector<uint8_t> buffer;
+  EXPECT_FALSE(LayerTreeSerializer::Serialize(tree, &buffer));
+  EXPECT_TRUE(buffer.empty());
+}
+
+TEST(LayerTreeSerializer, RejectsCorruptBuffers) {
+  auto tree = BuildSerializableTree();
+  std::vector<uint8_t> buffer;
+  ASSERT_TRUE(LayerTreeSerializer::Serialize(*tree, &buffer));
+
+  auto corrupted = buffer;
+  corrupted[0] ^= 0xff;  // Break the magic.
+  EXPECT_FALSE(
+      LayerTreeSerializer::Deserialize(corrupted.data(), corrupted.size()));
+
+  // Truncations anywhere in the stream are rejected rather than
+  // producing a partial tree.
+  for (size_t size = 0; size < buffer.size(); size += 7) {
+    EXPECT_FALSE(LayerTreeSerializer::Deserialize(buffer.data(), size));
+  }
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -21,6 +21,9 @@ class BackdropFilterLayer : public ContainerLayer {
 
   void Paint(PaintContext& context) const override;
 
+  // The filter is a process-local object; not serializable as a container.
+  LayerType layer_type() const override { return LayerType::kUnsupported; }
+
  private:
   std::shared_ptr<const DlImageFilter> filter_;
   DlBlendMode blend_mode_;
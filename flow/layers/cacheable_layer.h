@@ -40,6 +40,11 @@ class CacheableContainerLayer : public ContainerLayer {
     return layer_raster_cache_item_.get();
   }
 
+  // Effect-applying subclasses (filters, shader masks) are not serializable
+  // as plain containers; the ones that are (opacity, clip rect/rrect)
+  // override this again with their own category.
+  LayerType layer_type() const override { return LayerType::kUnsupported; }
+
  protected:
   std::unique_ptr<LayerRasterCacheItem> layer_raster_cache_item_;
 };
@@ -13,6 +13,8 @@ class ClipRectLayer : public ClipShapeLayer<SkRect> {
  public:
   ClipRectLayer(const SkRect& clip_rect, Clip clip_behavior);
 
+  LayerType layer_type() const override { return LayerType::kClipRect; }
+
  protected:
   const SkRect& clip_shape_bounds() const override;
 
@@ -13,6 +13,8 @@ class ClipRRectLayer : public ClipShapeLayer<SkRRect> {
  public:
   ClipRRectLayer(const SkRRect& clip_rrect, Clip clip_behavior);
 
+  LayerType layer_type() const override { return LayerType::kClipRRect; }
+
  protected:
   const SkRect& clip_shape_bounds() const override;
 
@@ -103,14 +103,14 @@ class ClipShapeLayer : public CacheableContainerLayer {
     return clip_behavior_ == Clip::antiAliasWithSaveLayer;
   }
 
+  const ClipShape& clip_shape() const { return clip_shape_; }
+  Clip clip_behavior() const { return clip_behavior_; }
+
  protected:
   virtual const SkRect& clip_shape_bounds() const = 0;
   virtual void ApplyClip(LayerStateStack::MutatorContext& mutator) const = 0;
   virtual ~ClipShapeLayer() = default;
 
-  const ClipShape& clip_shape() const { return clip_shape_; }
-  Clip clip_behavior() const { return clip_behavior_; }
-
  private:
   const ClipShape clip_shape_;
   Clip clip_behavior_;
@@ -6,6 +6,10 @@
 
 #include <optional>
 
+#include "flutter/flow/frame_arena.h"
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
+
 namespace flutter {
 
 ContainerLayer::ContainerLayer() : child_paint_bounds_(SkRect::MakeEmpty()) {}
@@ -17,13 +21,6 @@ void ContainerLayer::Diff(DiffContext* context, const Layer* old_layer) {
   context->SetLayerPaintRegion(this, context->CurrentSubtreeRegion());
 }
 
-void ContainerLayer::PreservePaintRegion(DiffContext* context) {
-  Layer::PreservePaintRegion(context);
-  for (auto& layer : layers_) {
-    layer->PreservePaintRegion(context);
-  }
-}
-
 void ContainerLayer::DiffChildren(DiffContext* context,
                                   const ContainerLayer* old_layer) {
   if (context->IsSubtreeDirty()) {
@@ -133,6 +130,11 @@ void ContainerLayer::PrerollChildren(PrerollContext* context,
   FML_DCHECK(!context->has_platform_view);
   FML_DCHECK(!context->has_texture_layer);
 
+  if (CanPrerollChildrenInParallel(context)) {
+    PrerollChildrenInParallel(context, child_paint_bounds);
+    return;
+  }
+
   bool child_has_platform_view = false;
   bool child_has_texture_layer = false;
   bool all_renderable_state_flags = LayerStateStack::kCallerCanApplyAnything;
@@ -173,6 +175,95 @@ void ContainerLayer::PrerollChildren(PrerollContext* context,
   set_child_paint_bounds(*child_paint_bounds);
 }
 
+bool ContainerLayer::CanPrerollChildrenInParallel(
+    PrerollContext* context) const {
+  return context->parallel_preroll_runner != nullptr &&
+         layers_.size() >= kMinimumParallelPrerollChildren &&
+         context->raster_cache == nullptr &&
+         context->view_embedder == nullptr &&
+         context->state_stack.is_empty();
+}
+
+void ContainerLayer::PrerollChildrenInParallel(PrerollContext* context,
+                                               SkRect* child_paint_bounds) {
+  struct ChildResult {
+    bool has_platform_view = false;
+    bool has_texture_layer = false;
+    bool surface_needs_readback = false;
+    int renderable_state_flags = 0;
+  };
+
+  // Each worker seeds its own state stack from the preroll delegate state so
+  // the subtrees observe the same cull rect and transformation they would in
+  // the serial walk.
+  const SkRect cull_rect = context->state_stack.device_cull_rect();
+  const SkMatrix matrix = context->state_stack.transform_3x3();
+
+  // The result scratch comes from the frame arena when one is active. It is
+  // allocated here on the raster thread before the fan-out; the workers only
+  // write into their own elements and never allocate from the arena.
+  auto results = FrameArena::MakeVector<ChildResult>(context->frame_arena);
+  results.resize(layers_.size());
+  fml::CountDownLatch latch(layers_.size());
+  for (size_t i = 0; i < layers_.size(); i++) {
+    Layer* layer = layers_[i].get();
+    ChildResult* result = &results[i];
+    context->parallel_preroll_runner->PostTask(
+        [layer, result, context, cull_rect, matrix, &latch]() {
+          LayerStateStack state_stack;
+          state_stack.set_preroll_delegate(cull_rect, matrix);
+          PrerollContext child_context = {
+              // clang-format off
+              .raster_cache           = nullptr,
+              .gr_context             = context->gr_context,
+              .view_embedder          = nullptr,
+              .state_stack            = state_stack,
+              .dst_color_space        = context->dst_color_space,
+              .surface_needs_readback = false,
+              .raster_time            = context->raster_time,
+              .ui_time                = context->ui_time,
+              .texture_registry       = context->texture_registry,
+              // clang-format on
+          };
+          layer->Preroll(&child_context);
+          result->has_platform_view = child_context.has_platform_view;
+          result->has_texture_layer = child_context.has_texture_layer;
+          result->surface_needs_readback = child_context.surface_needs_readback;
+          result->renderable_state_flags = child_context.renderable_state_flags;
+          latch.CountDown();
+        });
+  }
+  latch.Wait();
+
+  // Merge the per-child results in child order with the same logic as the
+  // serial walk so the outcome is indistinguishable from it.
+  bool child_has_platform_view = false;
+  bool child_has_texture_layer = false;
+  bool all_renderable_state_flags = LayerStateStack::kCallerCanApplyAnything;
+  for (size_t i = 0; i < layers_.size(); i++) {
+    all_renderable_state_flags &= results[i].renderable_state_flags;
+    if (safe_intersection_test(child_paint_bounds,
+                               layers_[i]->paint_bounds())) {
+      all_renderable_state_flags = 0;
+    }
+    child_paint_bounds->join(layers_[i]->paint_bounds());
+
+    child_has_platform_view =
+        child_has_platform_view || results[i].has_platform_view;
+    child_has_texture_layer =
+        child_has_texture_layer || results[i].has_texture_layer;
+    context->surface_needs_readback =
+        context->surface_needs_readback || results[i].surface_needs_readback;
+  }
+
+  context->has_platform_view = child_has_platform_view;
+  context->has_texture_layer = child_has_texture_layer;
+  context->renderable_state_flags = all_renderable_state_flags;
+  set_subtree_has_platform_view(child_has_platform_view);
+  set_children_renderable_state_flags(all_renderable_state_flags);
+  set_child_paint_bounds(*child_paint_bounds);
+}
+
 void ContainerLayer::PaintChildren(PaintContext& context) const {
   // We can no longer call FML_DCHECK here on the needs_painting(context)
   // condition as that test is only valid for the PaintContext that
@@ -16,7 +16,6 @@ class ContainerLayer : public Layer {
   ContainerLayer();
 
   void Diff(DiffContext* context, const Layer* old_layer) override;
-  void PreservePaintRegion(DiffContext* context) override;
 
   virtual void Add(std::shared_ptr<Layer> layer);
 
@@ -32,6 +31,11 @@ class ContainerLayer : public Layer {
 
   const ContainerLayer* as_container_layer() const override { return this; }
 
+  // Subclasses that add rendering effects on top of plain child composition
+  // must override this again; inheriting kContainer would serialize them as
+  // a bare container and silently drop the effect.
+  LayerType layer_type() const override { return LayerType::kContainer; }
+
   const SkRect& child_paint_bounds() const { return child_paint_bounds_; }
   void set_child_paint_bounds(const SkRect& bounds) {
     child_paint_bounds_ = bounds;
@@ -48,6 +52,23 @@ class ContainerLayer : public Layer {
   void PrerollChildren(PrerollContext* context, SkRect* child_paint_bounds);
 
  private:
+  // The minimum number of children before PrerollChildren considers fanning
+  // the subtrees out to the concurrent workers. Below this the serial walk is
+  // cheaper than the dispatch and join overhead.
+  static constexpr size_t kMinimumParallelPrerollChildren = 8;
+
+  // Whether the children can be prerolled on concurrent workers: a runner
+  // must be available, there must be enough children to amortize the fan-out,
+  // and the subtrees must not touch state shared across workers (the raster
+  // cache, an external view embedder, or pending entries on the state stack).
+  bool CanPrerollChildrenInParallel(PrerollContext* context) const;
+
+  // Prerolls every child in its own PrerollContext on the concurrent workers,
+  // joins, and then merges the per-child results in child order exactly as
+  // the serial walk in PrerollChildren would.
+  void PrerollChildrenInParallel(PrerollContext* context,
+                                 SkRect* child_paint_bounds);
+
   std::vector<std::shared_ptr<Layer>> layers_;
   SkRect child_paint_bounds_;
   int children_renderable_state_flags_ = 0;
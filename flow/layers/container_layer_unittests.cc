@@ -9,6 +9,7 @@
 #include "flutter/flow/testing/diff_context_test.h"
 #include "flutter/flow/testing/layer_test.h"
 #include "flutter/flow/testing/mock_layer.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "gtest/gtest.h"
 #include "include/core/SkMatrix.h"
@@ -763,6 +764,51 @@ TEST_F(ContainerLayerDiffTest, ReplaceLayer) {
   EXPECT_EQ(damage.frame_damage, SkIRect::MakeLTRB(200, 0, 250, 150));
 }
 
+TEST_F(ContainerLayerTest, ParallelPrerollMatchesSerialPreroll) {
+  constexpr int kChildCount = 10;
+  auto serial_layer = std::make_shared<ContainerLayer>();
+  auto parallel_layer = std::make_shared<ContainerLayer>();
+  for (int i = 0; i < kChildCount; i++) {
+    SkPath child_path;
+    child_path.addRect(SkRect::MakeXYWH(i * 10.0f, 5.0f, 8.0f, 8.0f));
+    serial_layer->Add(std::make_shared<MockLayer>(child_path));
+    parallel_layer->Add(std::make_shared<MockLayer>(child_path));
+  }
+
+  serial_layer->Preroll(preroll_context());
+
+  auto loop = fml::ConcurrentMessageLoop::Create(2);
+  auto task_runner = loop->GetTaskRunner();
+  // Parallel preroll requires that the subtrees cannot touch the raster cache
+  // or an external view embedder.
+  preroll_context()->raster_cache = nullptr;
+  preroll_context()->view_embedder = nullptr;
+  preroll_context()->parallel_preroll_runner = task_runner.get();
+  parallel_layer->Preroll(preroll_context());
+
+  EXPECT_EQ(parallel_layer->paint_bounds(), serial_layer->paint_bounds());
+  EXPECT_EQ(parallel_layer->child_paint_bounds(),
+            serial_layer->child_paint_bounds());
+  EXPECT_EQ(parallel_layer->children_renderable_state_flags(),
+            serial_layer->children_renderable_state_flags());
+}
+
+TEST_F(ContainerLayerTest, SmallTreesKeepTheSerialPrerollPath) {
+  auto loop = fml::ConcurrentMessageLoop::Create(2);
+  auto task_runner = loop->GetTaskRunner();
+
+  SkPath child_path;
+  child_path.addRect(5.0f, 6.0f, 20.5f, 21.5f);
+  auto layer = std::make_shared<ContainerLayer>();
+  layer->Add(std::make_shared<MockLayer>(child_path));
+
+  // A single child is below the fan-out heuristic, so the serial path runs
+  // even with a runner and a raster cache available.
+  preroll_context()->parallel_preroll_runner = task_runner.get();
+  layer->Preroll(preroll_context());
+  EXPECT_EQ(layer->paint_bounds(), child_path.getBounds());
+}
+
 }  // namespace testing
 }  // namespace flutter
 
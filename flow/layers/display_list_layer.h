@@ -25,6 +25,10 @@ class DisplayListLayer : public Layer {
 
   DisplayList* display_list() const { return display_list_.get(); }
 
+  const SkPoint& offset() const { return offset_; }
+
+  LayerType layer_type() const override { return LayerType::kDisplayList; }
+
   bool IsReplacing(DiffContext* context, const Layer* layer) const override;
 
   void Diff(DiffContext* context, const Layer* old_layer) override;
@@ -42,7 +42,10 @@ static bool IsDisplayListWorthRasterizing(
     return true;
   }
 
-  unsigned int complexity_score = complexity_calculator->Compute(display_list);
+  // The complexity score is memoized on the immutable display list, so
+  // re-evaluating cacheability every frame only walks the op stream once.
+  unsigned int complexity_score =
+      complexity_calculator->ComputeMemoized(display_list);
   return complexity_calculator->ShouldBeCached(complexity_score);
 }
 
@@ -90,6 +93,10 @@ void DisplayListRasterCacheItem::PrerollSetup(PrerollContext* context,
     return;
   }
 
+  // The memoized score is also consulted in PrerollFinalize to charge
+  // this entry against the cache's per-frame admission budget.
+  complexity_score_ = complexity_calculator->ComputeMemoized(display_list());
+
   if (context->raster_cached_entries && context->raster_cache) {
     context->raster_cached_entries->push_back(this);
     cache_state_ = CacheState::kCurrent;
@@ -111,12 +118,16 @@ void DisplayListRasterCacheItem::PrerollFinalize(PrerollContext* context,
   if (!visible ||
       cache_info.accesses_since_visible <= raster_cache->access_threshold()) {
     cache_state_ = kNone;
-  } else {
-    if (cache_info.has_image) {
-      context->renderable_state_flags |=
-          LayerStateStack::kCallerCanApplyOpacity;
-    }
+  } else if (cache_info.has_image) {
+    context->renderable_state_flags |= LayerStateStack::kCallerCanApplyOpacity;
+    cache_state_ = kCurrent;
+  } else if (raster_cache->AdmitForCaching(complexity_score_)) {
     cache_state_ = kCurrent;
+  } else {
+    // The per-frame admission budget is spent; skip populating this
+    // entry now. It remains marked as seen and can be admitted on a
+    // later, cheaper frame.
+    cache_state_ = kNone;
   }
   return;
 }
@@ -166,11 +177,15 @@ bool DisplayListRasterCacheItem::TryToPrepareRasterCache(
       .flow_type          = flow_type,
       // clang-format on
   };
+  // A display list that references images with threading requirements
+  // (e.g. Ganesh texture-backed images) cannot be replayed into a software
+  // surface on a concurrent worker; such entries stay on the synchronous
+  // path.
   return context.raster_cache->UpdateCacheEntry(
       id.value(), r_context,
       [display_list = display_list_](DlCanvas* canvas) {
         canvas->DrawDisplayList(display_list);
       },
-      display_list_->rtree());
+      display_list_->rtree(), display_list_->isUIThreadSafe());
 }
 }  // namespace flutter
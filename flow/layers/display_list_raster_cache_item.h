@@ -55,6 +55,10 @@ class DisplayListRasterCacheItem : public RasterCacheItem {
   SkPoint offset_;
   bool is_complex_;
   bool will_change_;
+  // The memoized complexity score of the display list, charged against
+  // the raster cache's per-frame admission budget when a new
+  // rasterization is scheduled.
+  unsigned int complexity_score_ = 0;
 };
 
 }  // namespace flutter
@@ -34,6 +34,10 @@
 
 class GrDirectContext;
 
+namespace fml {
+class ConcurrentTaskRunner;
+}  // namespace fml
+
 namespace flutter {
 
 namespace testing {
@@ -42,6 +46,7 @@ class MockLayer;
 
 class ContainerLayer;
 class DisplayListLayer;
+class FrameArena;
 class PerformanceOverlayLayer;
 class TextureLayer;
 class RasterCacheItem;
@@ -51,6 +56,20 @@ static constexpr SkRect kGiantRect = SkRect::MakeLTRB(-1E9F, -1E9F, 1E9F, 1E9F);
 // This should be an exact copy of the Clip enum in painting.dart.
 enum Clip { none, hardEdge, antiAlias, antiAliasWithSaveLayer };
 
+// The categories of layers that LayerTreeSerializer can encode. Declared on
+// the layer classes themselves (see |Layer::layer_type|) since the engine
+// builds without RTTI. Values are part of the serialized format and must not
+// be reordered.
+enum class LayerType : uint32_t {
+  kUnsupported = 0,
+  kContainer = 1,
+  kTransform = 2,
+  kOpacity = 3,
+  kClipRect = 4,
+  kClipRRect = 5,
+  kDisplayList = 6,
+};
+
 struct PrerollContext {
   RasterCache* raster_cache;
   GrDirectContext* gr_context;
@@ -82,6 +101,17 @@ struct PrerollContext {
   int renderable_state_flags = 0;
 
   std::vector<RasterCacheItem*>* raster_cached_entries;
+
+  // When set, ContainerLayer may preroll large groups of sibling subtrees on
+  // the workers of this runner instead of walking them serially. Only safe
+  // subtrees are fanned out; see ContainerLayer::PrerollChildren.
+  fml::ConcurrentTaskRunner* parallel_preroll_runner = nullptr;
+
+  // The shared scratch arena of the frame being prerolled, reset when the
+  // frame ends. Null when there is no active frame (LayerTree::Flatten,
+  // tests); adopters must fall back to the heap in that case. Not thread
+  // safe: worker threads spawned during preroll must not allocate from it.
+  FrameArena* frame_arena = nullptr;
 };
 
 struct PaintContext {
@@ -119,6 +149,10 @@ struct PaintContext {
   bool enable_leaf_layer_tracing = false;
   bool impeller_enabled = false;
   impeller::AiksContext* aiks_context;
+
+  // The shared scratch arena of the frame being painted; see the notes on
+  // PrerollContext::frame_arena.
+  FrameArena* frame_arena = nullptr;
 };
 
 // Represents a single composited layer. Created on the UI thread but then
@@ -158,7 +192,10 @@ class Layer {
 
   // Used when diffing retained layer; In case the layer is identical, it
   // doesn't need to be diffed, but the paint region needs to be stored in diff
-  // context so that it can be used in next frame
+  // context so that it can be used in next frame. Children of a retained
+  // subtree are not walked; their paint regions stay stamped on the layer
+  // instances from the frame they were last diffed and remain valid as long
+  // as every ancestor is retained (see DiffContext::GetOldLayerPaintRegion).
   virtual void PreservePaintRegion(DiffContext* context) {
     // retained layer means same instance so 'this' is used to index into both
     // current and old region
@@ -252,6 +289,23 @@ class Layer {
   virtual RasterCacheKeyID caching_key_id() const {
     return RasterCacheKeyID(unique_id_, RasterCacheKeyType::kLayer);
   }
+
+  // Whether the raster cache entries produced for this layer are exempt
+  // from sweep eviction while unused; see |RasterCache|. Set from the
+  // framework through |EngineLayer| for known-expensive subtrees that
+  // leave and re-enter the tree, so their cached images survive the
+  // frames in between. The flag is sampled during preroll; entries keep
+  // the pinned state they last saw, so a pinned layer that never re-enters
+  // the tree holds its entries until the cache is cleared.
+  bool raster_cache_pinned() const { return raster_cache_pinned_; }
+  void set_raster_cache_pinned(bool pinned) { raster_cache_pinned_ = pinned; }
+
+  // The serializable category of this layer; see |LayerType|. Layers that
+  // depend on process-local state (textures, platform views, engine-side
+  // filter objects) report kUnsupported, which makes any tree containing
+  // them unserializable.
+  virtual LayerType layer_type() const { return LayerType::kUnsupported; }
+
   virtual const ContainerLayer* as_container_layer() const { return nullptr; }
   virtual const DisplayListLayer* as_display_list_layer() const {
     return nullptr;
@@ -263,13 +317,48 @@ class Layer {
   virtual const testing::MockLayer* as_mock_layer() const { return nullptr; }
 
  private:
+  // Paint regions of the two most recent frame generations, maintained by
+  // DiffContext. Keeping the stamped regions on the layer instance allows
+  // retained subtrees to be skipped during diff without re-walking their
+  // children to copy regions between the per-frame maps; two slots are
+  // needed because the same instance can be diffed at a new location in a
+  // frame whose diff still needs the previous generation's region.
+  struct StampedPaintRegion {
+    PaintRegion region;
+    uint64_t generation = 0;
+  };
+
+  // Stores |region| stamped with |generation|, pushing a region from an
+  // older generation into the second slot.
+  void StorePaintRegion(const PaintRegion& region, uint64_t generation) const {
+    if (stamped_paint_regions_[0].generation != generation) {
+      stamped_paint_regions_[1] = stamped_paint_regions_[0];
+    }
+    stamped_paint_regions_[0] = {region, generation};
+  }
+
+  // Returns the most recently stored paint region stamped with a
+  // generation older than |generation|, or nullptr if none is stored.
+  const PaintRegion* FindPaintRegion(uint64_t generation) const {
+    for (const auto& stamped : stamped_paint_regions_) {
+      if (stamped.generation != 0 && stamped.generation < generation) {
+        return &stamped.region;
+      }
+    }
+    return nullptr;
+  }
+
   SkRect paint_bounds_;
   uint64_t unique_id_;
   uint64_t original_layer_id_;
   bool subtree_has_platform_view_;
+  bool raster_cache_pinned_ = false;
+  mutable StampedPaintRegion stamped_paint_regions_[2];
 
   static uint64_t NextUniqueID();
 
+  friend class DiffContext;
+
   FML_DISALLOW_COPY_AND_ASSIGN(Layer);
 };
 
@@ -0,0 +1,38 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/layers/layer_arena.h"
+
+#include <algorithm>
+
+#include "flutter/fml/logging.h"
+
+namespace flutter {
+
+LayerArena::LayerArena() = default;
+
+LayerArena::~LayerArena() = default;
+
+void* LayerArena::Allocate(size_t size, size_t alignment) {
+  FML_DCHECK((alignment & (alignment - 1)) == 0);
+  uintptr_t position = reinterpret_cast<uintptr_t>(cursor_);
+  uintptr_t aligned = (position + alignment - 1) & ~(alignment - 1);
+  size_t padding = aligned - position;
+  if (cursor_ == nullptr || padding + size > remaining_) {
+    // Oversized requests get a dedicated chunk so a single large allocation
+    // cannot strand the tail of the current chunk.
+    const size_t chunk_size = std::max(kChunkSize, size + alignment);
+    chunks_.push_back(std::make_unique<uint8_t[]>(chunk_size));
+    cursor_ = chunks_.back().get();
+    remaining_ = chunk_size;
+    position = reinterpret_cast<uintptr_t>(cursor_);
+    aligned = (position + alignment - 1) & ~(alignment - 1);
+    padding = aligned - position;
+  }
+  cursor_ += padding + size;
+  remaining_ -= padding + size;
+  return reinterpret_cast<void*>(aligned);
+}
+
+}  // namespace flutter
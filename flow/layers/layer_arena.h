@@ -0,0 +1,94 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_LAYERS_LAYER_ARENA_H_
+#define FLUTTER_FLOW_LAYERS_LAYER_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+
+namespace flutter {
+
+/// A frame-scoped bump allocator for layer construction.
+///
+/// SceneBuilder allocates every layer of a frame from one arena so that
+/// building a deep tree costs a handful of chunk allocations instead of one
+/// malloc per layer. Individual deallocation is a no-op: each allocation pins
+/// the arena through the allocator copy stored in its shared_ptr control
+/// block, and the chunks are returned to the system in bulk once the last
+/// layer (including layers retained across frames by EngineLayer) is
+/// destroyed.
+///
+/// Allocation is not thread safe; all allocations from an arena must happen
+/// on the UI thread. The final release, and therefore the bulk free, may
+/// happen on any thread.
+class LayerArena {
+ public:
+  static constexpr size_t kChunkSize = 16384;
+
+  LayerArena();
+
+  ~LayerArena();
+
+  /// Allocates and constructs a T whose storage (object and shared_ptr
+  /// control block) comes from the arena.
+  template <typename T, typename... Args>
+  static std::shared_ptr<T> Make(const std::shared_ptr<LayerArena>& arena,
+                                 Args&&... args) {
+    return std::allocate_shared<T>(Allocator<T>(arena),
+                                   std::forward<Args>(args)...);
+  }
+
+  /// The number of chunks allocated so far. Only used by tests.
+  size_t GetChunkCount() const { return chunks_.size(); }
+
+ private:
+  template <typename T>
+  struct Allocator {
+    using value_type = T;
+
+    explicit Allocator(std::shared_ptr<LayerArena> arena)
+        : arena_(std::move(arena)) {}
+
+    template <typename U>
+    Allocator(const Allocator<U>& other) : arena_(other.arena_) {}
+
+    T* allocate(size_t n) {
+      return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* pointer, size_t n) {
+      // Bulk freed when the last allocator copy releases the arena.
+    }
+
+    template <typename U>
+    bool operator==(const Allocator<U>& other) const {
+      return arena_ == other.arena_;
+    }
+
+    template <typename U>
+    bool operator!=(const Allocator<U>& other) const {
+      return arena_ != other.arena_;
+    }
+
+    std::shared_ptr<LayerArena> arena_;
+  };
+
+  void* Allocate(size_t size, size_t alignment);
+
+  std::vector<std::unique_ptr<uint8_t[]>> chunks_;
+  uint8_t* cursor_ = nullptr;
+  size_t remaining_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(LayerArena);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_LAYERS_LAYER_ARENA_H_
@@ -0,0 +1,74 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/layers/layer_arena.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+struct DestructionCounter {
+  explicit DestructionCounter(int* counter) : counter(counter) {}
+  ~DestructionCounter() { (*counter)++; }
+
+  int* counter;
+  char payload[48] = {};
+};
+
+}  // namespace
+
+TEST(LayerArenaTest, ManyAllocationsShareChunks) {
+  auto arena = std::make_shared<LayerArena>();
+  std::vector<std::shared_ptr<DestructionCounter>> objects;
+  int destroyed = 0;
+  for (int i = 0; i < 100; i++) {
+    objects.push_back(
+        LayerArena::Make<DestructionCounter>(arena, &destroyed));
+  }
+  // 100 objects of ~64 bytes (plus control blocks) fit in a few 16KB chunks.
+  EXPECT_LE(arena->GetChunkCount(), 2u);
+  objects.clear();
+  EXPECT_EQ(destroyed, 100);
+}
+
+TEST(LayerArenaTest, AllocationsOutliveTheArenaHandle) {
+  int destroyed = 0;
+  std::shared_ptr<DestructionCounter> object;
+  {
+    auto arena = std::make_shared<LayerArena>();
+    object = LayerArena::Make<DestructionCounter>(arena, &destroyed);
+  }
+  // The allocation pins the arena chunks even though the handle is gone.
+  EXPECT_EQ(destroyed, 0);
+  EXPECT_NE(object->counter, nullptr);
+  object.reset();
+  EXPECT_EQ(destroyed, 1);
+}
+
+TEST(LayerArenaTest, OversizedAllocationsGetDedicatedChunks) {
+  auto arena = std::make_shared<LayerArena>();
+  struct Large {
+    char payload[LayerArena::kChunkSize] = {};
+  };
+  auto large = LayerArena::Make<Large>(arena, Large{});
+  EXPECT_EQ(arena->GetChunkCount(), 1u);
+  auto small = LayerArena::Make<int>(arena, 42);
+  EXPECT_EQ(arena->GetChunkCount(), 2u);
+  EXPECT_EQ(*small, 42);
+}
+
+TEST(LayerArenaTest, AllocationsAreAligned) {
+  auto arena = std::make_shared<LayerArena>();
+  auto a = LayerArena::Make<char>(arena, 'a');
+  auto b = LayerArena::Make<double>(arena, 1.5);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(b.get()) % alignof(double), 0u);
+  EXPECT_EQ(*a, 'a');
+  EXPECT_EQ(*b, 1.5);
+}
+
+}  // namespace testing
+}  // namespace flutter
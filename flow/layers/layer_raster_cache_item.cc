@@ -54,7 +54,8 @@ void LayerRasterCacheItem::PrerollFinalize(PrerollContext* context,
   if (num_cache_attempts_ >= layer_cached_threshold_) {
     // the layer can be cached
     cache_state_ = CacheState::kCurrent;
-    context->raster_cache->MarkSeen(key_id_, matrix_, true);
+    context->raster_cache->MarkSeen(key_id_, matrix_, true,
+                                    layer_->raster_cache_pinned());
   } else {
     num_cache_attempts_++;
     // access current layer
@@ -69,7 +70,7 @@ void LayerRasterCacheItem::PrerollFinalize(PrerollContext* context,
       }
       cache_state_ = CacheState::kChildren;
       context->raster_cache->MarkSeen(layer_children_id_.value(), matrix_,
-                                      true);
+                                      true, layer_->raster_cache_pinned());
     }
   }
 }
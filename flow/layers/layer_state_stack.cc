@@ -59,6 +59,7 @@ class DummyDelegate : public LayerStateStack::Delegate {
   void transform(const SkM44& m44) override {}
   void transform(const SkMatrix& matrix) override {}
   void integralTransform() override {}
+  void setTransform(const SkM44& m44) override {}
 
   void clipRect(const SkRect& rect, ClipOp op, bool is_aa) override {}
   void clipRRect(const SkRRect& rrect, ClipOp op, bool is_aa) override {}
@@ -117,6 +118,7 @@ class DlCanvasDelegate : public LayerStateStack::Delegate {
     SkM44 matrix = RasterCacheUtil::GetIntegralTransCTM(matrix_4x4());
     canvas_->SetTransform(matrix);
   }
+  void setTransform(const SkM44& m44) override { canvas_->SetTransform(m44); }
 
   void clipRect(const SkRect& rect, ClipOp op, bool is_aa) override {
     canvas_->ClipRect(rect, op, is_aa);
@@ -175,6 +177,7 @@ class PrerollDelegate : public LayerStateStack::Delegate {
           RasterCacheUtil::GetIntegralTransCTM(tracker_.matrix_3x3()));
     }
   }
+  void setTransform(const SkM44& m44) override { tracker_.setTransform(m44); }
 
   void clipRect(const SkRect& rect, ClipOp op, bool is_aa) override {
     tracker_.clipRect(rect, op, is_aa);
@@ -366,17 +369,56 @@ class BackdropFilterEntry : public SaveLayerEntry {
   FML_DISALLOW_COPY_ASSIGN_AND_MOVE(BackdropFilterEntry);
 };
 
-class TranslateEntry : public LayerStateStack::StateEntry {
+// Base class for the entries that mutate only the transform. The composed
+// transform is snapshotted the first time the mutation is applied against a
+// tracking delegate so that reapplying the entry on a newly installed
+// delegate (as happens for every overlay canvas recorded by a
+// PlatformViewLayer) installs the precomputed matrix directly instead of
+// recomposing the chain of relative mutations one entry at a time.
+//
+// Clip entries are deliberately left relative - the clip shape itself must
+// be conveyed to the new delegate and it is guaranteed to be applied under
+// the correct transform because the entries replay in their original order.
+class TransformEntry : public LayerStateStack::StateEntry {
  public:
-  TranslateEntry(SkScalar tx, SkScalar ty) : tx_(tx), ty_(ty) {}
-
   void apply(LayerStateStack* stack) const override {
-    stack->delegate_->translate(tx_, ty_);
+    applyTransform(stack);
+    if (stack->delegate_ != DummyDelegate::kInstance) {
+      snapshot_ = stack->delegate_->matrix_4x4();
+      has_snapshot_ = true;
+    }
+  }
+  void reapply(LayerStateStack* stack) const override {
+    if (has_snapshot_) {
+      stack->delegate_->setTransform(snapshot_);
+    } else {
+      // The entry was pushed while no delegate was tracking the transform;
+      // fall back to the relative mutation and snapshot the result now.
+      apply(stack);
+    }
   }
+
+ protected:
+  virtual void applyTransform(LayerStateStack* stack) const = 0;
+
+ private:
+  mutable SkM44 snapshot_;
+  mutable bool has_snapshot_ = false;
+};
+
+class TranslateEntry : public TransformEntry {
+ public:
+  TranslateEntry(SkScalar tx, SkScalar ty) : tx_(tx), ty_(ty) {}
+
   void update_mutators(MutatorsStack* mutators_stack) const override {
     mutators_stack->PushTransform(SkMatrix::Translate(tx_, ty_));
   }
 
+ protected:
+  void applyTransform(LayerStateStack* stack) const override {
+    stack->delegate_->translate(tx_, ty_);
+  }
+
  private:
   const SkScalar tx_;
   const SkScalar ty_;
@@ -384,45 +426,50 @@ class TranslateEntry : public LayerStateStack::StateEntry {
   FML_DISALLOW_COPY_ASSIGN_AND_MOVE(TranslateEntry);
 };
 
-class TransformMatrixEntry : public LayerStateStack::StateEntry {
+class TransformMatrixEntry : public TransformEntry {
  public:
   explicit TransformMatrixEntry(const SkMatrix& matrix) : matrix_(matrix) {}
 
-  void apply(LayerStateStack* stack) const override {
-    stack->delegate_->transform(matrix_);
-  }
   void update_mutators(MutatorsStack* mutators_stack) const override {
     mutators_stack->PushTransform(matrix_);
   }
 
+ protected:
+  void applyTransform(LayerStateStack* stack) const override {
+    stack->delegate_->transform(matrix_);
+  }
+
  private:
   const SkMatrix matrix_;
 
   FML_DISALLOW_COPY_ASSIGN_AND_MOVE(TransformMatrixEntry);
 };
 
-class TransformM44Entry : public LayerStateStack::StateEntry {
+class TransformM44Entry : public TransformEntry {
  public:
   explicit TransformM44Entry(const SkM44& m44) : m44_(m44) {}
 
-  void apply(LayerStateStack* stack) const override {
-    stack->delegate_->transform(m44_);
-  }
   void update_mutators(MutatorsStack* mutators_stack) const override {
     mutators_stack->PushTransform(m44_.asM33());
   }
 
+ protected:
+  void applyTransform(LayerStateStack* stack) const override {
+    stack->delegate_->transform(m44_);
+  }
+
  private:
   const SkM44 m44_;
 
   FML_DISALLOW_COPY_ASSIGN_AND_MOVE(TransformM44Entry);
 };
 
-class IntegralTransformEntry : public LayerStateStack::StateEntry {
+class IntegralTransformEntry : public TransformEntry {
  public:
   IntegralTransformEntry() = default;
 
-  void apply(LayerStateStack* stack) const override {
+ protected:
+  void applyTransform(LayerStateStack* stack) const override {
     stack->delegate_->integralTransform();
   }
 
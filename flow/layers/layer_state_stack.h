@@ -418,6 +418,7 @@ class LayerStateStack {
   friend class OpacityEntry;
   friend class ImageFilterEntry;
   friend class ColorFilterEntry;
+  friend class TransformEntry;
   friend class TranslateEntry;
   friend class TransformMatrixEntry;
   friend class TransformM44Entry;
@@ -463,6 +464,12 @@ class LayerStateStack {
     virtual void transform(const SkMatrix& matrix) = 0;
     virtual void integralTransform() = 0;
 
+    // Replaces the current transform with the indicated absolute matrix.
+    // Used when reapplying a transform entry whose composed result was
+    // snapshotted the first time it was applied so that a newly installed
+    // delegate does not have to recompose the chain of relative mutations.
+    virtual void setTransform(const SkM44& m44) = 0;
+
     virtual void clipRect(const SkRect& rect, ClipOp op, bool is_aa) = 0;
     virtual void clipRRect(const SkRRect& rrect, ClipOp op, bool is_aa) = 0;
     virtual void clipPath(const SkPath& path, ClipOp op, bool is_aa) = 0;
@@ -132,6 +132,57 @@ TEST(LayerStateStack, OldDelegateIsRolledBack) {
   ASSERT_TRUE(canvas.GetTransform().isIdentity());
 }
 
+TEST(LayerStateStack, TransformSnapshotsSurviveDelegateSwitch) {
+  LayerStateStack state_stack;
+  DisplayListBuilder builder;
+  DisplayListBuilder builder2;
+
+  state_stack.set_delegate(&builder);
+
+  // Nested transform mutations of every flavor, with a clip in between
+  // so the clip must replay under the transform prefix that preceded it.
+  auto mutator = state_stack.save();
+  mutator.translate(10, 10);
+  mutator.transform(SkMatrix::Scale(2, 2));
+  mutator.clipRect(SkRect::MakeWH(50, 50), false);
+  mutator.transform(SkM44::Rotate({0, 1, 0}, SK_ScalarPI / 6));
+  mutator.integralTransform();
+
+  const SkM44 expected_transform = state_stack.transform_4x4();
+  const SkRect expected_cull = state_stack.device_cull_rect();
+
+  // Switching delegates replays the recorded state; the resulting
+  // transform and clip must be identical on the new delegate.
+  state_stack.set_delegate(&builder2);
+
+  ASSERT_EQ(state_stack.transform_4x4(), expected_transform);
+  ASSERT_EQ(state_stack.device_cull_rect(), expected_cull);
+  ASSERT_EQ(builder2.GetTransformFullPerspective(), expected_transform);
+
+  // And again back to a preroll delegate which tracks rather than renders.
+  state_stack.set_preroll_delegate(kGiantRect, SkMatrix::I());
+
+  ASSERT_EQ(state_stack.transform_4x4(), expected_transform);
+}
+
+TEST(LayerStateStack, TransformsPushedWithoutDelegateReplayCorrectly) {
+  LayerStateStack state_stack;
+  DisplayListBuilder builder;
+
+  // Mutations recorded with no delegate installed have no transform to
+  // snapshot and must fall back to replaying the relative mutations when
+  // a tracking delegate arrives.
+  auto mutator = state_stack.save();
+  mutator.translate(10, 10);
+  mutator.transform(SkMatrix::Scale(2, 2));
+
+  state_stack.set_delegate(&builder);
+
+  SkMatrix expected = SkMatrix::Translate(10, 10);
+  expected.preConcat(SkMatrix::Scale(2, 2));
+  ASSERT_EQ(builder.GetTransform(), expected);
+}
+
 TEST(LayerStateStack, Opacity) {
   SkRect rect = {10, 10, 20, 20};
 
@@ -23,7 +23,8 @@ LayerTree::LayerTree(const Config& config, const SkISize& frame_size)
       rasterizer_tracing_threshold_(config.rasterizer_tracing_threshold),
       checkerboard_raster_cache_images_(
           config.checkerboard_raster_cache_images),
-      checkerboard_offscreen_layers_(config.checkerboard_offscreen_layers) {}
+      checkerboard_offscreen_layers_(config.checkerboard_offscreen_layers),
+      has_platform_views_(config.has_platform_views) {}
 
 inline SkColorSpace* GetColorSpace(DlCanvas* canvas) {
   return canvas ? canvas->GetImageInfo().colorSpace() : nullptr;
@@ -61,11 +62,18 @@ bool LayerTree::Preroll(CompositorContext::ScopedFrame& frame,
       .ui_time                       = frame.context().ui_time(),
       .texture_registry              = frame.context().texture_registry(),
       .raster_cached_entries         = &raster_cache_items_,
+      .parallel_preroll_runner       =
+          frame.context().parallel_preroll_task_runner().get(),
+      .frame_arena                   = &frame.frame_arena(),
       // clang-format on
   };
 
   root_layer_->Preroll(&context);
 
+  // The preroll pass measured the tree; replace the conservative
+  // construction-time value with the exact one.
+  has_platform_views_ = context.has_platform_view;
+
   return context.surface_needs_readback;
 }
 
@@ -141,6 +149,7 @@ void LayerTree::Paint(CompositorContext::ScopedFrame& frame,
       .enable_leaf_layer_tracing     = enable_leaf_layer_tracing_,
       .impeller_enabled              = !!frame.aiks_context(),
       .aiks_context                  = frame.aiks_context(),
+      .frame_arena                   = &frame.frame_arena(),
       // clang-format on
   };
 
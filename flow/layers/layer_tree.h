@@ -26,6 +26,11 @@ class LayerTree {
     uint32_t rasterizer_tracing_threshold = 0;
     bool checkerboard_raster_cache_images = false;
     bool checkerboard_offscreen_layers = false;
+    // Whether any PlatformViewLayer exists anywhere in the tree. The scene
+    // builder knows this exactly; the conservative default keeps full
+    // external view embedder bookkeeping for trees built by other clients
+    // until a preroll pass has measured the tree.
+    bool has_platform_views = true;
   };
 
   LayerTree(const Config& config, const SkISize& frame_size);
@@ -81,6 +86,13 @@ class LayerTree {
     return enable_leaf_layer_tracing_;
   }
 
+  /// Whether any PlatformViewLayer exists anywhere in the tree. Frames
+  /// without platform views can skip external view embedder bookkeeping
+  /// entirely. Seeded from `Config::has_platform_views` and refined by
+  /// `Preroll`, so it is exact once either the scene builder supplied it or
+  /// the tree has been prerolled, and conservatively true before that.
+  bool has_platform_views() const { return has_platform_views_; }
+
  private:
   std::shared_ptr<Layer> root_layer_;
   SkISize frame_size_ = SkISize::MakeEmpty();  // Physical pixels.
@@ -88,6 +100,7 @@ class LayerTree {
   bool checkerboard_raster_cache_images_;
   bool checkerboard_offscreen_layers_;
   bool enable_leaf_layer_tracing_ = false;
+  bool has_platform_views_;
 
   PaintRegionMap paint_region_map_;
 
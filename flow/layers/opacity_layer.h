@@ -47,6 +47,12 @@ class OpacityLayer : public CacheableContainerLayer {
 
   SkScalar opacity() const { return alpha_ * 1.0f / SK_AlphaOPAQUE; }
 
+  SkAlpha alpha() const { return alpha_; }
+
+  const SkPoint& offset() const { return offset_; }
+
+  LayerType layer_type() const override { return LayerType::kOpacity; }
+
  private:
   SkAlpha alpha_;
   SkPoint offset_;
@@ -26,11 +26,20 @@ void PlatformViewLayer::Preroll(PrerollContext* context) {
   set_subtree_has_platform_view(true);
   MutatorsStack mutators;
   context->state_stack.fill(&mutators);
-  std::unique_ptr<EmbeddedViewParams> params =
-      std::make_unique<EmbeddedViewParams>(context->state_stack.transform_3x3(),
-                                           size_, mutators);
-  context->view_embedder->PrerollCompositeEmbeddedView(view_id_,
-                                                       std::move(params));
+  SkMatrix transform = context->state_stack.transform_3x3();
+  // Reuse the previous frame's composition when the inputs are unchanged.
+  // The stack hash rejects nearly all mismatches cheaply; the equality
+  // check guards against hash collisions before the cached result is
+  // trusted.
+  if (last_params_ == nullptr || last_params_->transformMatrix() != transform ||
+      last_params_->sizePoints() != size_ ||
+      last_params_->mutatorsStack().GetHash() != mutators.GetHash() ||
+      last_params_->mutatorsStack() != mutators) {
+    last_params_ = std::make_unique<EmbeddedViewParams>(transform, size_,
+                                                        std::move(mutators));
+  }
+  context->view_embedder->PrerollCompositeEmbeddedView(
+      view_id_, std::make_unique<EmbeddedViewParams>(*last_params_));
   context->view_embedder->PushVisitedPlatformView(view_id_);
 }
 
@@ -24,6 +24,13 @@ class PlatformViewLayer : public Layer {
   SkSize size_;
   int64_t view_id_;
 
+  // The parameters composed for the view embedder on the previous frame.
+  // When the framework retains the platform view's layer across frames the
+  // surrounding transform and mutators are usually unchanged, so Preroll
+  // can hand the embedder a copy of the previous composition instead of
+  // recomputing it.
+  std::unique_ptr<EmbeddedViewParams> last_params_;
+
   FML_DISALLOW_COPY_AND_ASSIGN(PlatformViewLayer);
 };
 
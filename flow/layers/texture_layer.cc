@@ -66,6 +66,9 @@ void TextureLayer::Paint(PaintContext& context) const {
       .paint = context.state_stack.fill(paint),
   };
   texture->Paint(ctx, paint_bounds(), freeze_, sampling_);
+  // Keeps the texture's GPU state resident across the registry's per-frame
+  // inactivity trim.
+  context.texture_registry->MarkTexturePainted(texture_id_);
 }
 
 }  // namespace flutter
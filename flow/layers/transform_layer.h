@@ -23,6 +23,10 @@ class TransformLayer : public ContainerLayer {
 
   void Paint(PaintContext& context) const override;
 
+  LayerType layer_type() const override { return LayerType::kTransform; }
+
+  const SkM44& transform() const { return transform_; }
+
  private:
   SkM44 transform_;
 
@@ -189,6 +189,60 @@ TEST(MutatorsStack, Equality) {
   ASSERT_TRUE(stack == stack_other);
 }
 
+TEST(MutatorsStack, HashTracksPushAndPop) {
+  MutatorsStack stack;
+  std::size_t empty_hash = stack.GetHash();
+
+  stack.PushTransform(SkMatrix::Scale(2, 2));
+  std::size_t one_hash = stack.GetHash();
+  ASSERT_NE(one_hash, empty_hash);
+
+  stack.PushClipRect(SkRect::MakeWH(10, 10));
+  ASSERT_NE(stack.GetHash(), one_hash);
+
+  stack.Pop();
+  ASSERT_EQ(stack.GetHash(), one_hash);
+
+  stack.Pop();
+  ASSERT_EQ(stack.GetHash(), empty_hash);
+}
+
+TEST(MutatorsStack, HashMatchesForEqualStacks) {
+  MutatorsStack stack;
+  stack.PushTransform(SkMatrix::Scale(2, 2));
+  stack.PushClipRect(SkRect::MakeWH(10, 10));
+  stack.PushClipRRect(SkRRect::MakeRectXY(SkRect::MakeWH(10, 10), 2, 2));
+  stack.PushOpacity(240);
+
+  MutatorsStack stack_other;
+  stack_other.PushTransform(SkMatrix::Scale(2, 2));
+  stack_other.PushClipRect(SkRect::MakeWH(10, 10));
+  stack_other.PushClipRRect(SkRRect::MakeRectXY(SkRect::MakeWH(10, 10), 2, 2));
+  stack_other.PushOpacity(240);
+
+  ASSERT_TRUE(stack == stack_other);
+  ASSERT_EQ(stack.GetHash(), stack_other.GetHash());
+}
+
+TEST(MutatorsStack, HashDiffersForDifferentMutations) {
+  MutatorsStack stack;
+  stack.PushTransform(SkMatrix::Scale(2, 2));
+
+  MutatorsStack stack_other;
+  stack_other.PushTransform(SkMatrix::Scale(3, 3));
+
+  ASSERT_NE(stack.GetHash(), stack_other.GetHash());
+
+  // Same mutations in a different order also hash differently.
+  MutatorsStack ab;
+  ab.PushClipRect(SkRect::MakeWH(10, 10));
+  ab.PushOpacity(240);
+  MutatorsStack ba;
+  ba.PushOpacity(240);
+  ba.PushClipRect(SkRect::MakeWH(10, 10));
+  ASSERT_NE(ab.GetHash(), ba.GetHash());
+}
+
 TEST(Mutator, Initialization) {
   SkRect rect = SkRect::MakeEmpty();
   Mutator mutator = Mutator(rect);
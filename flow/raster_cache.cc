@@ -4,6 +4,7 @@
 
 #include "flutter/flow/raster_cache.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <vector>
 
@@ -13,25 +14,39 @@
 #include "flutter/flow/layers/layer.h"
 #include "flutter/flow/paint_utils.h"
 #include "flutter/flow/raster_cache_util.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/trace_event.h"
 #include "third_party/skia/include/core/SkCanvas.h"
 #include "third_party/skia/include/core/SkColorSpace.h"
 #include "third_party/skia/include/core/SkImage.h"
 #include "third_party/skia/include/core/SkSurface.h"
-#include "third_party/skia/include/gpu/GrDirectContext.h"
-#include "third_party/skia/include/gpu/ganesh/SkSurfaceGanesh.h"
 
 namespace flutter {
 
-RasterCacheResult::RasterCacheResult(sk_sp<DlImage> image,
-                                     const SkRect& logical_rect,
-                                     const char* type,
-                                     sk_sp<const DlRTree> rtree)
+RasterCacheResult::RasterCacheResult(
+    sk_sp<DlImage> image,
+    const SkRect& logical_rect,
+    const char* type,
+    sk_sp<const DlRTree> rtree,
+    sk_sp<SkSurface> surface,
+    std::shared_ptr<RasterCacheSurfacePool> pool)
     : image_(std::move(image)),
       logical_rect_(logical_rect),
       flow_(type),
-      rtree_(std::move(rtree)) {}
+      rtree_(std::move(rtree)),
+      surface_(std::move(surface)),
+      pool_(std::move(pool)) {}
+
+RasterCacheResult::~RasterCacheResult() {
+  if (pool_ && surface_) {
+    // Release the snapshot before the surface so that the next render
+    // into the pooled surface can reuse the backing store instead of
+    // triggering a copy-on-write of the still referenced pixels.
+    image_.reset();
+    pool_->ReleaseSurface(std::move(surface_));
+  }
+}
 
 void RasterCacheResult::draw(DlCanvas& canvas,
                              const DlPaint* paint,
@@ -72,7 +87,8 @@ RasterCache::RasterCache(size_t access_threshold,
                          size_t display_list_cache_limit_per_frame)
     : access_threshold_(access_threshold),
       display_list_cache_limit_per_frame_(display_list_cache_limit_per_frame),
-      checkerboard_images_(false) {}
+      checkerboard_images_(false),
+      surface_pool_(std::make_shared<RasterCacheSurfacePool>()) {}
 
 /// @note Procedure doesn't copy all closures.
 std::unique_ptr<RasterCacheResult> RasterCache::Rasterize(
@@ -90,10 +106,7 @@ std::unique_ptr<RasterCacheResult> RasterCache::Rasterize(
                                  sk_ref_sp(context.dst_color_space));
 
   sk_sp<SkSurface> surface =
-      context.gr_context
-          ? SkSurfaces::RenderTarget(context.gr_context, skgpu::Budgeted::kYes,
-                                     image_info)
-          : SkSurfaces::Raster(image_info);
+      surface_pool_->AcquireSurface(context.gr_context, image_info);
 
   if (!surface) {
     return nullptr;
@@ -112,21 +125,119 @@ std::unique_ptr<RasterCacheResult> RasterCache::Rasterize(
 
   auto image = DlImage::Make(surface->makeImageSnapshot());
   return std::make_unique<RasterCacheResult>(
-      image, context.logical_rect, context.flow_type, std::move(rtree));
+      image, context.logical_rect, context.flow_type, std::move(rtree),
+      std::move(surface), surface_pool_);
+}
+
+// Rasterizes an entry to a software surface on a worker thread. Neither
+// the GrDirectContext nor the surface pool can be used off the raster
+// thread, so asynchronous population always renders to a raster surface
+// that bypasses the pool. Callers are responsible for only routing
+// entries here whose draw function is safe to replay off the raster
+// thread; in particular, texture-backed images cannot be drawn into a
+// raster surface without a readback through the GrDirectContext.
+static std::unique_ptr<RasterCacheResult> RasterizeOnWorker(
+    const SkMatrix& ctm,
+    const SkRect& logical_rect,
+    sk_sp<SkColorSpace> dst_color_space,
+    const char* flow_type,
+    bool checkerboard,
+    const sk_sp<const DlRTree>& rtree,
+    const std::function<void(DlCanvas*)>& draw_function) {
+  auto matrix = RasterCacheUtil::GetIntegralTransCTM(ctm);
+  SkRect dest_rect =
+      RasterCacheUtil::GetRoundedOutDeviceBounds(logical_rect, matrix);
+
+  const SkImageInfo image_info = SkImageInfo::MakeN32Premul(
+      dest_rect.width(), dest_rect.height(), std::move(dst_color_space));
+
+  sk_sp<SkSurface> surface = SkSurfaces::Raster(image_info);
+  if (!surface) {
+    return nullptr;
+  }
+
+  DlSkCanvasAdapter canvas(surface->getCanvas());
+  canvas.Clear(DlColor::kTransparent());
+
+  canvas.Translate(-dest_rect.left(), -dest_rect.top());
+  canvas.Transform(matrix);
+  draw_function(&canvas);
+
+  if (checkerboard) {
+    DrawCheckerboard(&canvas, logical_rect);
+  }
+
+  auto image = DlImage::Make(surface->makeImageSnapshot());
+  return std::make_unique<RasterCacheResult>(image, logical_rect, flow_type,
+                                             rtree);
+}
+
+void RasterCache::SetAsyncWorkerTaskRunner(
+    std::shared_ptr<fml::ConcurrentTaskRunner> task_runner) {
+  async_worker_ = std::move(task_runner);
 }
 
 bool RasterCache::UpdateCacheEntry(
     const RasterCacheKeyID& id,
     const Context& raster_cache_context,
     const std::function<void(DlCanvas*)>& render_function,
-    sk_sp<const DlRTree> rtree) const {
+    sk_sp<const DlRTree> rtree,
+    bool async_safe) const {
   RasterCacheKey key = RasterCacheKey(id, raster_cache_context.matrix);
   Entry& entry = cache_[key];
+  if (!entry.image && entry.pending) {
+    // Swap in a completed asynchronous rasterization, or keep waiting.
+    bool done = false;
+    {
+      std::scoped_lock lock(entry.pending->mutex);
+      if (entry.pending->done) {
+        entry.image = std::move(entry.pending->result);
+        done = true;
+      }
+    }
+    if (done) {
+      entry.pending.reset();
+      if (entry.image) {
+        RasterCacheMetrics& metrics = GetMetricsForKind(key.kind());
+        metrics.created_count++;
+        metrics.created_bytes += entry.image->image_bytes();
+      }
+    }
+    return entry.image != nullptr;
+  }
   if (!entry.image) {
+    if (async_worker_ && async_safe &&
+        id.type() == RasterCacheKeyType::kDisplayList) {
+      // Posting the task is cheap, but still count it against the
+      // per-frame admission limit so a complex screen warms a bounded
+      // number of entries per frame.
+      display_list_cached_this_frame_++;
+      auto pending = std::make_shared<AsyncRasterization>();
+      entry.pending = pending;
+      bool checkerboard = checkerboard_images_;
+      async_worker_->PostTask(
+          [pending, ctm = SkMatrix(raster_cache_context.matrix),
+           logical_rect = SkRect(raster_cache_context.logical_rect),
+           dst_color_space = sk_ref_sp(raster_cache_context.dst_color_space),
+           flow_type = raster_cache_context.flow_type, checkerboard,
+           rtree = std::move(rtree), render_function]() {
+            auto result =
+                RasterizeOnWorker(ctm, logical_rect, dst_color_space,
+                                  flow_type, checkerboard, rtree,
+                                  render_function);
+            std::scoped_lock lock(pending->mutex);
+            pending->result = std::move(result);
+            pending->done = true;
+          });
+      return false;
+    }
     void (*func)(DlCanvas*, const SkRect& rect) = DrawCheckerboard;
     entry.image = Rasterize(raster_cache_context, std::move(rtree),
                             render_function, func);
     if (entry.image != nullptr) {
+      RasterCacheMetrics& metrics = GetMetricsForKind(key.kind());
+      metrics.created_count++;
+      metrics.created_bytes += entry.image->image_bytes();
       switch (id.type()) {
         case RasterCacheKeyType::kDisplayList: {
           display_list_cached_this_frame_++;
@@ -143,11 +254,14 @@ bool RasterCache::UpdateCacheEntry(
 
 RasterCache::CacheInfo RasterCache::MarkSeen(const RasterCacheKeyID& id,
                                              const SkMatrix& matrix,
-                                             bool visible) const {
+                                             bool visible,
+                                             bool pinned) const {
   RasterCacheKey key = RasterCacheKey(id, matrix);
   Entry& entry = cache_[key];
   entry.encountered_this_frame = true;
   entry.visible_this_frame = visible;
+  entry.pinned = pinned;
+  entry.last_used_frame = frame_number_;
   if (visible || entry.accesses_since_visible > 0) {
     entry.accesses_since_visible++;
   }
@@ -193,15 +307,62 @@ bool RasterCache::Draw(const RasterCacheKeyID& id,
 }
 
 void RasterCache::BeginFrame() {
+  frame_number_++;
   display_list_cached_this_frame_ = 0;
+  admission_score_used_ = 0;
   picture_metrics_ = {};
   layer_metrics_ = {};
 }
 
+bool RasterCache::AdmitForCaching(unsigned int complexity_score) const {
+  if (admission_score_budget_ == 0) {
+    return true;
+  }
+  if (admission_score_used_ + complexity_score > admission_score_budget_) {
+    return false;
+  }
+  admission_score_used_ += complexity_score;
+  return true;
+}
+
+void RasterCache::UpdateAdmissionBudget(fml::TimeDelta raster_duration,
+                                        fml::Milliseconds frame_budget) {
+  if (frame_budget.count() <= 0) {
+    return;
+  }
+  unsigned int frame_budget_score =
+      frame_budget.count() * kComplexityScorePerMillisecond;
+  double raster_ms = raster_duration.ToMillisecondsF();
+  if (raster_ms > frame_budget.count()) {
+    // The frame ran long. Only admit work that is repaid within
+    // kAdmissionRepaymentFrames frames of reuse, halving further if
+    // frames continue to run over budget.
+    unsigned int target = frame_budget_score / kAdmissionRepaymentFrames;
+    if (admission_score_budget_ == 0 || admission_score_budget_ > target) {
+      admission_score_budget_ = target;
+    } else {
+      admission_score_budget_ =
+          std::max(kMinimumAdmissionScoreBudget, admission_score_budget_ / 2);
+    }
+  } else if (admission_score_budget_ != 0 &&
+             raster_ms < frame_budget.count() / 2) {
+    // The frame finished with plenty of headroom; replenish the budget
+    // and release the limit once it covers a full frame of work.
+    unsigned int replenished = admission_score_budget_ +
+                               frame_budget_score / kAdmissionRepaymentFrames;
+    admission_score_budget_ = replenished > frame_budget_score ? 0 : replenished;
+  }
+}
+
 void RasterCache::UpdateMetrics() {
   for (auto it = cache_.begin(); it != cache_.end(); ++it) {
     Entry& entry = it->second;
-    FML_DCHECK(entry.encountered_this_frame);
+    // Pinned entries survive eviction without being encountered while
+    // their subtree is absent from the tree; they do not count as in use.
+    if (!entry.encountered_this_frame) {
+      FML_DCHECK(entry.pinned);
+      continue;
+    }
     if (entry.image) {
       RasterCacheMetrics& metrics = GetMetricsForKind(it->first.kind());
       metrics.in_use_count++;
@@ -216,7 +377,7 @@ void RasterCache::EvictUnusedCacheEntries() {
 
   for (auto it = cache_.begin(); it != cache_.end(); ++it) {
     Entry& entry = it->second;
-    if (!entry.encountered_this_frame) {
+    if (!entry.encountered_this_frame && !entry.pinned) {
       dead.push_back(it);
     }
   }
@@ -238,6 +399,10 @@ void RasterCache::EndFrame() {
 
 void RasterCache::Clear() {
   cache_.clear();
+  // The entries just destroyed returned their surfaces to the pool;
+  // drop them as well since Clear is used when the GrContext that
+  // created them is going away.
+  surface_pool_->Clear();
   picture_metrics_ = {};
   layer_metrics_ = {};
 }
@@ -291,6 +456,24 @@ void RasterCache::TraceStatsToTimeline() const {
 #endif  // !FLUTTER_RELEASE
 }
 
+std::vector<RasterCache::EntryInfo> RasterCache::GetEntryInfos() const {
+  std::vector<EntryInfo> infos;
+  infos.reserve(cache_.size());
+  for (const auto& item : cache_) {
+    const Entry& entry = item.second;
+    EntryInfo info;
+    info.unique_id = item.first.id().unique_id();
+    info.type = item.first.id().type();
+    info.bytes = entry.image ? entry.image->image_bytes() : 0;
+    info.access_count = entry.accesses_since_visible;
+    info.last_used_frame = entry.last_used_frame;
+    info.pinned = entry.pinned;
+    info.has_image = entry.image != nullptr;
+    infos.push_back(info);
+  }
+  return infos;
+}
+
 size_t RasterCache::EstimateLayerCacheByteSize() const {
   size_t layer_cache_bytes = 0;
   for (const auto& item : cache_) {
@@ -313,7 +496,8 @@ size_t RasterCache::EstimatePictureCacheByteSize() const {
   return picture_cache_bytes;
 }
 
-RasterCacheMetrics& RasterCache::GetMetricsForKind(RasterCacheKeyKind kind) {
+RasterCacheMetrics& RasterCache::GetMetricsForKind(
+    RasterCacheKeyKind kind) const {
   switch (kind) {
     case RasterCacheKeyKind::kDisplayListMetrics:
       return picture_metrics_;
@@ -6,13 +6,17 @@
 #define FLUTTER_FLOW_RASTER_CACHE_H_
 
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "flutter/display_list/dl_canvas.h"
 #include "flutter/flow/raster_cache_key.h"
+#include "flutter/flow/raster_cache_surface_pool.h"
 #include "flutter/flow/raster_cache_util.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/weak_ptr.h"
+#include "flutter/fml/time/time_delta.h"
 #include "flutter/fml/trace_event.h"
 #include "third_party/skia/include/core/SkMatrix.h"
 #include "third_party/skia/include/core/SkRect.h"
@@ -20,6 +24,10 @@
 class GrDirectContext;
 class SkColorSpace;
 
+namespace fml {
+class ConcurrentTaskRunner;
+}  // namespace fml
+
 namespace flutter {
 
 enum class RasterCacheLayerStrategy { kLayer, kLayerChildren };
@@ -29,9 +37,13 @@ class RasterCacheResult {
   RasterCacheResult(sk_sp<DlImage> image,
                     const SkRect& logical_rect,
                     const char* type,
-                    sk_sp<const DlRTree> rtree = nullptr);
+                    sk_sp<const DlRTree> rtree = nullptr,
+                    sk_sp<SkSurface> surface = nullptr,
+                    std::shared_ptr<RasterCacheSurfacePool> pool = nullptr);
 
-  virtual ~RasterCacheResult() = default;
+  // Returns the backing surface to the pool, if any, so that a later
+  // rasterization of the same dimensions can reuse it.
+  virtual ~RasterCacheResult();
 
   virtual void draw(DlCanvas& canvas,
                     const DlPaint* paint,
@@ -50,6 +62,8 @@ class RasterCacheResult {
   SkRect logical_rect_;
   fml::tracing::TraceFlow flow_;
   sk_sp<const DlRTree> rtree_;
+  sk_sp<SkSurface> surface_;
+  std::shared_ptr<RasterCacheSurfacePool> pool_;
 };
 
 class Layer;
@@ -58,6 +72,17 @@ struct PrerollContext;
 struct PaintContext;
 
 struct RasterCacheMetrics {
+  /**
+   * The number of cache entries whose images were created in this frame,
+   * including asynchronous rasterizations swapped in this frame.
+   */
+  size_t created_count = 0;
+
+  /**
+   * The size of all of the images created in this frame.
+   */
+  size_t created_bytes = 0;
+
   /**
    * The number of cache entries with images evicted in this frame.
    */
@@ -215,6 +240,63 @@ class RasterCache {
    */
   size_t access_threshold() const { return access_threshold_; }
 
+  // The GPU backed complexity calculators pin their ShouldBeCached
+  // threshold of 200000 score units at roughly one millisecond of raster
+  // work; the same scale converts measured frame times into admission
+  // budget.
+  static constexpr unsigned int kComplexityScorePerMillisecond = 200000;
+
+  // The number of frames of reuse within which an admitted entry is
+  // expected to repay its rasterize-once cost. Matches the default
+  // access_threshold, so an entry has typically already been reused this
+  // often before it is considered for admission.
+  static constexpr unsigned int kAdmissionRepaymentFrames = 3;
+
+  // The floor for a tightened admission budget so that cache population
+  // slows down under load but never stalls entirely.
+  static constexpr unsigned int kMinimumAdmissionScoreBudget =
+      kComplexityScorePerMillisecond / 4;
+
+  /**
+   * @brief Decide whether a new rasterization costing |complexity_score|
+   * units of work may be scheduled this frame, consuming that much of the
+   * per-frame admission budget if so.
+   *
+   * The budget is expressed in DisplayListComplexityCalculator score
+   * units. A budget of zero disables admission control and admits
+   * everything, which is the state the cache starts in until
+   * |UpdateAdmissionBudget| observes a frame that ran over its raster
+   * budget. Refused entries remain marked as seen and can be admitted on
+   * a later frame once the budget has headroom again.
+   */
+  bool AdmitForCaching(unsigned int complexity_score) const;
+
+  /**
+   * @brief Adapt the per-frame admission budget from the measured raster
+   * time of the frame that just ended.
+   *
+   * When the frame ran over |frame_budget| the admission budget is
+   * tightened so that only entries whose rasterize-once cost is repaid
+   * within |kAdmissionRepaymentFrames| frames of reuse fit, halving
+   * further if frames continue to run long. Frames that finish with
+   * ample headroom replenish the budget and eventually release the limit
+   * entirely.
+   */
+  void UpdateAdmissionBudget(fml::TimeDelta raster_duration,
+                             fml::Milliseconds frame_budget);
+
+  unsigned int admission_score_budget() const {
+    return admission_score_budget_;
+  }
+
+  /**
+   * @brief The pool of rasterization surfaces that evicted entries
+   * return their backing stores to. Exposed so that the shell can tie
+   * the pool budget to the GPU resource cache limit and so that pool
+   * hit/miss counters can be inspected.
+   */
+  RasterCacheSurfacePool& surface_pool() const { return *surface_pool_; }
+
   bool GenerateNewCacheInThisFrame() const {
     // Disabling caching when access_threshold is zero is historic behavior.
     return access_threshold_ != 0 && display_list_cached_this_frame_ <
@@ -233,7 +315,8 @@ class RasterCache {
    */
   CacheInfo MarkSeen(const RasterCacheKeyID& id,
                      const SkMatrix& matrix,
-                     bool visible) const;
+                     bool visible,
+                     bool pinned = false) const;
 
   /**
    * Returns the access count (i.e. accesses_since_visible) for the given
@@ -241,30 +324,115 @@ class RasterCache {
    */
   int GetAccessCount(const RasterCacheKeyID& id, const SkMatrix& matrix) const;
 
+  /**
+   * Populates the entry for the given key, either synchronously or - for
+   * display list entries when a worker task runner has been installed - by
+   * posting the rasterization to a concurrent worker. Callers must only
+   * pass |async_safe| as true if replaying |render_function| off the
+   * raster thread is safe, i.e. it references no images with threading
+   * requirements (such as Ganesh texture-backed images, which cannot be
+   * read back without the GrDirectContext).
+   */
   bool UpdateCacheEntry(const RasterCacheKeyID& id,
                         const Context& raster_cache_context,
                         const std::function<void(DlCanvas*)>& render_function,
-                        sk_sp<const DlRTree> rtree = nullptr) const;
+                        sk_sp<const DlRTree> rtree = nullptr,
+                        bool async_safe = false) const;
+
+  /**
+   * A snapshot of one cache entry for introspection; see |GetEntryInfos|.
+   */
+  struct EntryInfo {
+    uint64_t unique_id = 0;
+    RasterCacheKeyType type = RasterCacheKeyType::kLayer;
+    size_t bytes = 0;
+    size_t access_count = 0;
+    uint64_t last_used_frame = 0;
+    bool pinned = false;
+    bool has_image = false;
+  };
+
+  /**
+   * @brief Describe every entry in the cache, including entries that have
+   * not (or not yet) been populated with an image, so churn can be
+   * diagnosed entry by entry. Exposed through the getRasterCacheEntries
+   * service protocol extension; must be called on the raster thread.
+   *
+   * Entries produced for the children of a container
+   * (|RasterCacheKeyType::kLayerChildren|) report a unique_id of zero
+   * since their identity is the set of child layer ids.
+   */
+  std::vector<EntryInfo> GetEntryInfos() const;
+
+  /**
+   * The index of the frame currently being built, incremented by
+   * |BeginFrame|. Entry |EntryInfo::last_used_frame| values are on this
+   * timeline.
+   */
+  uint64_t frame_number() const { return frame_number_; }
+
+  /**
+   * @brief Enables asynchronous population of display list cache entries
+   * by rasterizing them to software surfaces on |task_runner| and
+   * swapping the completed images into the cache on a later frame,
+   * instead of rasterizing inline on the raster thread.
+   *
+   * Only display list entries are populated asynchronously; display
+   * lists are immutable and safe to replay from a worker thread while
+   * layer entries reference layer tree state owned by the raster thread
+   * and keep the synchronous path.
+   */
+  void SetAsyncWorkerTaskRunner(
+      std::shared_ptr<fml::ConcurrentTaskRunner> task_runner);
+
+  bool async_population_enabled() const { return async_worker_ != nullptr; }
 
  private:
+  // Completion slot shared between the raster thread and the worker task
+  // rasterizing a display list entry. The worker fills the slot under the
+  // mutex; the raster thread swaps a completed result into the cache
+  // entry the next time the entry is prepared. If the entry is evicted
+  // while the task is in flight the orphaned slot simply expires with
+  // the worker's reference.
+  struct AsyncRasterization {
+    std::mutex mutex;
+    std::unique_ptr<RasterCacheResult> result;
+    bool done = false;
+  };
+
   struct Entry {
     bool encountered_this_frame = false;
     bool visible_this_frame = false;
+    // Pinned entries are exempt from |EvictUnusedCacheEntries| and keep
+    // their images while the subtree that produced them is absent from
+    // the tree. The flag tracks the pinned state the entry last saw in
+    // |MarkSeen|.
+    bool pinned = false;
     size_t accesses_since_visible = 0;
+    // The value of |frame_number()| when the entry was last encountered.
+    uint64_t last_used_frame = 0;
     std::unique_ptr<RasterCacheResult> image;
+    std::shared_ptr<AsyncRasterization> pending;
   };
 
   void UpdateMetrics();
 
-  RasterCacheMetrics& GetMetricsForKind(RasterCacheKeyKind kind);
+  RasterCacheMetrics& GetMetricsForKind(RasterCacheKeyKind kind) const;
 
   const size_t access_threshold_;
   const size_t display_list_cache_limit_per_frame_;
   mutable size_t display_list_cached_this_frame_ = 0;
-  RasterCacheMetrics layer_metrics_;
-  RasterCacheMetrics picture_metrics_;
+  unsigned int admission_score_budget_ = 0;
+  mutable unsigned int admission_score_used_ = 0;
+  uint64_t frame_number_ = 0;
+  // Mutable because entry creation in the logically-const
+  // |UpdateCacheEntry| contributes to the per-frame creation counters.
+  mutable RasterCacheMetrics layer_metrics_;
+  mutable RasterCacheMetrics picture_metrics_;
   mutable RasterCacheKey::Map<Entry> cache_;
   bool checkerboard_images_;
+  std::shared_ptr<RasterCacheSurfacePool> surface_pool_;
+  std::shared_ptr<fml::ConcurrentTaskRunner> async_worker_;
 
   void TraceStatsToTimeline() const;
 
@@ -0,0 +1,98 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/raster_cache_surface_pool.h"
+
+#include "third_party/skia/include/core/SkColorSpace.h"
+#include "third_party/skia/include/gpu/GrDirectContext.h"
+#include "third_party/skia/include/gpu/ganesh/SkSurfaceGanesh.h"
+
+namespace flutter {
+
+RasterCacheSurfacePool::RasterCacheSurfacePool(size_t budget_bytes)
+    : budget_bytes_(budget_bytes) {}
+
+uint32_t RasterCacheSurfacePool::SizeClassOf(int width, int height) {
+  auto class_of = [](uint32_t dimension) -> uint32_t {
+    uint32_t size_class = 0;
+    while ((1u << size_class) < dimension) {
+      size_class++;
+    }
+    return size_class;
+  };
+  return (class_of(static_cast<uint32_t>(width)) << 16) |
+         class_of(static_cast<uint32_t>(height));
+}
+
+sk_sp<SkSurface> RasterCacheSurfacePool::AcquireSurface(
+    GrDirectContext* context,
+    const SkImageInfo& image_info) {
+  uint32_t size_class = SizeClassOf(image_info.width(), image_info.height());
+  for (auto it = surfaces_.begin(); it != surfaces_.end(); ++it) {
+    if (it->size_class != size_class || it->context != context) {
+      continue;
+    }
+    const SkImageInfo& pooled_info = it->surface->imageInfo();
+    if (pooled_info.dimensions() != image_info.dimensions() ||
+        pooled_info.colorType() != image_info.colorType() ||
+        pooled_info.alphaType() != image_info.alphaType() ||
+        !SkColorSpace::Equals(pooled_info.colorSpace(),
+                              image_info.colorSpace())) {
+      continue;
+    }
+    sk_sp<SkSurface> surface = std::move(it->surface);
+    pooled_bytes_ -= it->bytes;
+    surfaces_.erase(it);
+    hit_count_++;
+    return surface;
+  }
+  miss_count_++;
+  return context ? SkSurfaces::RenderTarget(context, skgpu::Budgeted::kYes,
+                                            image_info)
+                 : SkSurfaces::Raster(image_info);
+}
+
+void RasterCacheSurfacePool::ReleaseSurface(sk_sp<SkSurface> surface) {
+  if (!surface) {
+    return;
+  }
+  const SkImageInfo& image_info = surface->imageInfo();
+  // The context pointer is only ever compared against the context of a
+  // later acquisition, never dereferenced, so a released surface that
+  // outlives its context merely goes unmatched until it is trimmed or
+  // the pool is cleared.
+  GrDirectContext* context = GrAsDirectContext(surface->recordingContext());
+  PooledSurface pooled = {
+      .context = context,
+      .size_class = SizeClassOf(image_info.width(), image_info.height()),
+      .bytes = image_info.computeMinByteSize(),
+      .surface = std::move(surface),
+  };
+  pooled_bytes_ += pooled.bytes;
+  surfaces_.push_back(std::move(pooled));
+  TrimToBudget();
+}
+
+void RasterCacheSurfacePool::Clear() {
+  surfaces_.clear();
+  pooled_bytes_ = 0u;
+}
+
+void RasterCacheSurfacePool::SetBudget(size_t budget_bytes) {
+  budget_bytes_ = budget_bytes;
+  TrimToBudget();
+}
+
+void RasterCacheSurfacePool::TrimToBudget() {
+  size_t trimmed = 0;
+  while (trimmed < surfaces_.size() && pooled_bytes_ > budget_bytes_) {
+    pooled_bytes_ -= surfaces_[trimmed].bytes;
+    trimmed++;
+  }
+  if (trimmed > 0) {
+    surfaces_.erase(surfaces_.begin(), surfaces_.begin() + trimmed);
+  }
+}
+
+}  // namespace flutter
@@ -0,0 +1,110 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_RASTER_CACHE_SURFACE_POOL_H_
+#define FLUTTER_FLOW_RASTER_CACHE_SURFACE_POOL_H_
+
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkImageInfo.h"
+#include "third_party/skia/include/core/SkRefCnt.h"
+#include "third_party/skia/include/core/SkSurface.h"
+
+class GrDirectContext;
+
+namespace flutter {
+
+/**
+ * A pool of rasterization surfaces released by destroyed RasterCache
+ * entries, bucketed into power-of-two size classes, so that entries
+ * rasterized on later frames reuse the existing backing stores instead
+ * of churning the allocator with a fresh allocation per entry.
+ *
+ * Surfaces are only handed back out for an exact dimension and pixel
+ * geometry match within their size class; snapshotting a sub-rectangle
+ * of an oversized pooled surface would force a copy of the backing
+ * texture, which defeats the reuse the pool exists to provide. The
+ * power-of-two class acts as a cheap first-pass filter when searching
+ * the pool.
+ *
+ * The pool is not thread safe and is only accessed from the raster
+ * thread alongside the RasterCache that owns it.
+ */
+class RasterCacheSurfacePool {
+ public:
+  static constexpr size_t kDefaultBudgetBytes = 16u * 1024u * 1024u;
+
+  explicit RasterCacheSurfacePool(size_t budget_bytes = kDefaultBudgetBytes);
+
+  /**
+   * Returns a pooled surface whose dimensions and pixel geometry match
+   * |image_info| and whose owning context matches |context|, or creates
+   * a new surface (a GPU render target when |context| is non-null, a
+   * raster surface otherwise). Returns nullptr if a new surface cannot
+   * be created.
+   */
+  sk_sp<SkSurface> AcquireSurface(GrDirectContext* context,
+                                  const SkImageInfo& image_info);
+
+  /**
+   * Returns |surface| to the pool for reuse by a later acquisition.
+   * The oldest pooled surfaces are dropped while the pool is over
+   * budget.
+   */
+  void ReleaseSurface(sk_sp<SkSurface> surface);
+
+  /**
+   * Drops all pooled surfaces, e.g. when the GrContext that created
+   * them is being destroyed.
+   */
+  void Clear();
+
+  /**
+   * Sets the byte budget for pooled (idle) surfaces and trims the pool
+   * to the new budget. Typically wired to a fraction of the GPU
+   * resource cache limit.
+   */
+  void SetBudget(size_t budget_bytes);
+
+  size_t budget() const { return budget_bytes_; }
+
+  size_t pooled_bytes() const { return pooled_bytes_; }
+  size_t pooled_count() const { return surfaces_.size(); }
+
+  /**
+   * The number of acquisitions that were satisfied by a pooled surface
+   * and the number that had to allocate, for inspection of pool
+   * effectiveness.
+   */
+  size_t hit_count() const { return hit_count_; }
+  size_t miss_count() const { return miss_count_; }
+
+ private:
+  struct PooledSurface {
+    GrDirectContext* context;
+    uint32_t size_class;
+    size_t bytes;
+    sk_sp<SkSurface> surface;
+  };
+
+  // Packs the power-of-two classes of the dimensions into one key.
+  static uint32_t SizeClassOf(int width, int height);
+
+  void TrimToBudget();
+
+  size_t budget_bytes_;
+  size_t pooled_bytes_ = 0u;
+  size_t hit_count_ = 0u;
+  size_t miss_count_ = 0u;
+
+  // Oldest surfaces first; trimming drops from the front.
+  std::vector<PooledSurface> surfaces_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(RasterCacheSurfacePool);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_RASTER_CACHE_SURFACE_POOL_H_
@@ -0,0 +1,115 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/raster_cache_surface_pool.h"
+
+#include "gtest/gtest.h"
+#include "third_party/skia/include/core/SkImageInfo.h"
+#include "third_party/skia/include/core/SkSurface.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(RasterCacheSurfacePool, AcquireWithEmptyPoolAllocates) {
+  RasterCacheSurfacePool pool;
+
+  auto surface =
+      pool.AcquireSurface(nullptr, SkImageInfo::MakeN32Premul(100, 100));
+  ASSERT_TRUE(surface);
+  EXPECT_EQ(pool.hit_count(), 0u);
+  EXPECT_EQ(pool.miss_count(), 1u);
+  EXPECT_EQ(pool.pooled_count(), 0u);
+  EXPECT_EQ(pool.pooled_bytes(), 0u);
+}
+
+TEST(RasterCacheSurfacePool, ReleasedSurfaceIsReusedForSameInfo) {
+  RasterCacheSurfacePool pool;
+  auto image_info = SkImageInfo::MakeN32Premul(100, 100);
+
+  auto surface = pool.AcquireSurface(nullptr, image_info);
+  ASSERT_TRUE(surface);
+  SkSurface* raw_surface = surface.get();
+
+  pool.ReleaseSurface(std::move(surface));
+  EXPECT_EQ(pool.pooled_count(), 1u);
+  EXPECT_EQ(pool.pooled_bytes(), image_info.computeMinByteSize());
+
+  auto reused = pool.AcquireSurface(nullptr, image_info);
+  ASSERT_TRUE(reused);
+  EXPECT_EQ(reused.get(), raw_surface);
+  EXPECT_EQ(pool.hit_count(), 1u);
+  EXPECT_EQ(pool.miss_count(), 1u);
+  EXPECT_EQ(pool.pooled_count(), 0u);
+  EXPECT_EQ(pool.pooled_bytes(), 0u);
+}
+
+TEST(RasterCacheSurfacePool, DimensionMismatchAllocatesFreshSurface) {
+  RasterCacheSurfacePool pool;
+
+  auto surface =
+      pool.AcquireSurface(nullptr, SkImageInfo::MakeN32Premul(100, 100));
+  ASSERT_TRUE(surface);
+  SkSurface* raw_surface = surface.get();
+  pool.ReleaseSurface(std::move(surface));
+
+  // 90x90 shares the 128x128 size class with 100x100 but the pooled
+  // surface must not be handed out for the smaller dimensions.
+  auto smaller =
+      pool.AcquireSurface(nullptr, SkImageInfo::MakeN32Premul(90, 90));
+  ASSERT_TRUE(smaller);
+  EXPECT_NE(smaller.get(), raw_surface);
+  EXPECT_EQ(pool.hit_count(), 0u);
+  EXPECT_EQ(pool.miss_count(), 2u);
+  EXPECT_EQ(pool.pooled_count(), 1u);
+}
+
+TEST(RasterCacheSurfacePool, TrimsOldestSurfacesToBudget) {
+  auto image_info = SkImageInfo::MakeN32Premul(100, 100);
+  // Room for one pooled surface but not two.
+  RasterCacheSurfacePool pool(image_info.computeMinByteSize() + 1u);
+
+  auto first = pool.AcquireSurface(nullptr, image_info);
+  auto second = pool.AcquireSurface(nullptr, image_info);
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(second);
+  SkSurface* raw_second = second.get();
+
+  pool.ReleaseSurface(std::move(first));
+  pool.ReleaseSurface(std::move(second));
+  EXPECT_EQ(pool.pooled_count(), 1u);
+  EXPECT_LE(pool.pooled_bytes(), pool.budget());
+
+  // The older surface was dropped; the newer one survives for reuse.
+  auto reused = pool.AcquireSurface(nullptr, image_info);
+  EXPECT_EQ(reused.get(), raw_second);
+}
+
+TEST(RasterCacheSurfacePool, SetBudgetTrimsImmediately) {
+  RasterCacheSurfacePool pool;
+  auto image_info = SkImageInfo::MakeN32Premul(100, 100);
+
+  pool.ReleaseSurface(pool.AcquireSurface(nullptr, image_info));
+  pool.ReleaseSurface(
+      pool.AcquireSurface(nullptr, SkImageInfo::MakeN32Premul(50, 50)));
+  EXPECT_EQ(pool.pooled_count(), 2u);
+
+  pool.SetBudget(0u);
+  EXPECT_EQ(pool.pooled_count(), 0u);
+  EXPECT_EQ(pool.pooled_bytes(), 0u);
+}
+
+TEST(RasterCacheSurfacePool, ClearDropsAllSurfaces) {
+  RasterCacheSurfacePool pool;
+
+  pool.ReleaseSurface(
+      pool.AcquireSurface(nullptr, SkImageInfo::MakeN32Premul(100, 100)));
+  EXPECT_EQ(pool.pooled_count(), 1u);
+
+  pool.Clear();
+  EXPECT_EQ(pool.pooled_count(), 0u);
+  EXPECT_EQ(pool.pooled_bytes(), 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
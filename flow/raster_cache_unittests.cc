@@ -15,6 +15,9 @@
 #include "flutter/flow/raster_cache_item.h"
 #include "flutter/flow/testing/layer_test.h"
 #include "flutter/flow/testing/mock_raster_cache.h"
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/fml/time/time_delta.h"
 #include "flutter/testing/assertions_skia.h"
 #include "gtest/gtest.h"
 #include "third_party/skia/include/core/SkMatrix.h"
@@ -91,6 +94,123 @@ TEST(RasterCache, MetricsOmitUnpopulatedEntries) {
   ASSERT_EQ(cache.picture_metrics().total_bytes(), 25624u);
 }
 
+TEST(RasterCache, AsyncPopulationSwapsInCompletedDisplayListEntries) {
+  size_t threshold = 1;
+  flutter::RasterCache cache(threshold);
+  auto worker_loop = fml::ConcurrentMessageLoop::Create(1);
+  cache.SetAsyncWorkerTaskRunner(worker_loop->GetTaskRunner());
+  ASSERT_TRUE(cache.async_population_enabled());
+
+  SkMatrix matrix = SkMatrix::I();
+
+  auto display_list = GetSampleDisplayList();
+
+  MockCanvas dummy_canvas(1000, 1000);
+  DlPaint paint;
+
+  LayerStateStack preroll_state_stack;
+  preroll_state_stack.set_preroll_delegate(kGiantRect, matrix);
+  LayerStateStack paint_state_stack;
+  preroll_state_stack.set_delegate(&dummy_canvas);
+
+  FixedRefreshRateStopwatch raster_time;
+  FixedRefreshRateStopwatch ui_time;
+  PrerollContextHolder preroll_context_holder = GetSamplePrerollContextHolder(
+      preroll_state_stack, &cache, &raster_time, &ui_time);
+  PaintContextHolder paint_context_holder = GetSamplePaintContextHolder(
+      paint_state_stack, &cache, &raster_time, &ui_time);
+  auto& preroll_context = preroll_context_holder.preroll_context;
+  auto& paint_context = paint_context_holder.paint_context;
+
+  cache.BeginFrame();
+  DisplayListRasterCacheItem display_list_item(display_list, SkPoint(), true,
+                                               false);
+
+  // 1st access is not over the threshold yet.
+  ASSERT_FALSE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+
+  cache.EndFrame();
+  cache.BeginFrame();
+
+  // 2nd access posts the rasterization to the worker instead of
+  // populating the entry inline, so the entry is not drawable yet.
+  ASSERT_FALSE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+  ASSERT_FALSE(display_list_item.Draw(paint_context, &dummy_canvas, &paint));
+
+  // Wait for the single worker to drain the rasterization task.
+  fml::AutoResetWaitableEvent latch;
+  worker_loop->GetTaskRunner()->PostTask([&latch]() { latch.Signal(); });
+  latch.Wait();
+
+  cache.EndFrame();
+  cache.BeginFrame();
+
+  // The next preparation swaps the completed image into the entry.
+  ASSERT_TRUE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+  ASSERT_TRUE(display_list_item.Draw(paint_context, &dummy_canvas, &paint));
+
+  cache.EndFrame();
+  ASSERT_EQ(cache.picture_metrics().total_count(), 1u);
+}
+
+TEST(RasterCache, AsyncPopulationSkipsNonThreadSafeDisplayLists) {
+  size_t threshold = 1;
+  flutter::RasterCache cache(threshold);
+  auto worker_loop = fml::ConcurrentMessageLoop::Create(1);
+  cache.SetAsyncWorkerTaskRunner(worker_loop->GetTaskRunner());
+  ASSERT_TRUE(cache.async_population_enabled());
+
+  SkMatrix matrix = SkMatrix::I();
+
+  // DlImageSkia reports that it is not safe to use off its owning thread,
+  // so a display list drawing one must not be replayed on a worker.
+  DisplayListBuilder builder(SkRect::MakeWH(150, 100));
+  builder.DrawImage(MakeTestImage(50, 50, 10), SkPoint{10, 10},
+                    DlImageSampling::kNearestNeighbor);
+  auto display_list = builder.Build();
+  ASSERT_FALSE(display_list->isUIThreadSafe());
+
+  MockCanvas dummy_canvas(1000, 1000);
+  DlPaint paint;
+
+  LayerStateStack preroll_state_stack;
+  preroll_state_stack.set_preroll_delegate(kGiantRect, matrix);
+  LayerStateStack paint_state_stack;
+  preroll_state_stack.set_delegate(&dummy_canvas);
+
+  FixedRefreshRateStopwatch raster_time;
+  FixedRefreshRateStopwatch ui_time;
+  PrerollContextHolder preroll_context_holder = GetSamplePrerollContextHolder(
+      preroll_state_stack, &cache, &raster_time, &ui_time);
+  PaintContextHolder paint_context_holder = GetSamplePaintContextHolder(
+      paint_state_stack, &cache, &raster_time, &ui_time);
+  auto& preroll_context = preroll_context_holder.preroll_context;
+  auto& paint_context = paint_context_holder.paint_context;
+
+  cache.BeginFrame();
+  DisplayListRasterCacheItem display_list_item(display_list, SkPoint(), true,
+                                               false);
+
+  // 1st access is not over the threshold yet.
+  ASSERT_FALSE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+
+  cache.EndFrame();
+  cache.BeginFrame();
+
+  // 2nd access populates the entry inline rather than posting it to the
+  // worker, so the entry is immediately drawable.
+  ASSERT_TRUE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+  ASSERT_TRUE(display_list_item.Draw(paint_context, &dummy_canvas, &paint));
+
+  cache.EndFrame();
+  ASSERT_EQ(cache.picture_metrics().total_count(), 1u);
+}
+
 TEST(RasterCache, ThresholdIsRespectedForDisplayList) {
   size_t threshold = 2;
   flutter::RasterCache cache(threshold);
@@ -143,6 +263,104 @@ TEST(RasterCache, ThresholdIsRespectedForDisplayList) {
   ASSERT_TRUE(display_list_item.Draw(paint_context, &dummy_canvas, &paint));
 }
 
+TEST(RasterCache, AdmissionBudgetAdaptsToMeasuredRasterTime) {
+  flutter::RasterCache cache;
+  const fml::Milliseconds frame_budget(16.0);
+  unsigned int frame_budget_score = static_cast<unsigned int>(
+      frame_budget.count() * RasterCache::kComplexityScorePerMillisecond);
+  unsigned int repayment_target =
+      frame_budget_score / RasterCache::kAdmissionRepaymentFrames;
+
+  // Admission control is disabled until a frame runs over budget.
+  ASSERT_EQ(cache.admission_score_budget(), 0u);
+  ASSERT_TRUE(cache.AdmitForCaching(10u * frame_budget_score));
+
+  // An over-budget frame tightens the budget to the repayment target.
+  cache.UpdateAdmissionBudget(fml::TimeDelta::FromMilliseconds(20),
+                              frame_budget);
+  ASSERT_EQ(cache.admission_score_budget(), repayment_target);
+
+  cache.BeginFrame();
+  ASSERT_TRUE(cache.AdmitForCaching(repayment_target));
+  ASSERT_FALSE(cache.AdmitForCaching(1u));
+
+  // The budget is per frame; the refused score fits again next frame.
+  cache.BeginFrame();
+  ASSERT_TRUE(cache.AdmitForCaching(1u));
+
+  // Repeated over-budget frames keep halving the budget down to a floor.
+  for (int i = 0; i < 32; i++) {
+    cache.UpdateAdmissionBudget(fml::TimeDelta::FromMilliseconds(20),
+                                frame_budget);
+  }
+  ASSERT_EQ(cache.admission_score_budget(),
+            RasterCache::kMinimumAdmissionScoreBudget);
+
+  // Frames with ample headroom replenish and eventually release the limit.
+  for (int i = 0; i < 32 && cache.admission_score_budget() != 0u; i++) {
+    cache.UpdateAdmissionBudget(fml::TimeDelta::FromMilliseconds(4),
+                                frame_budget);
+  }
+  ASSERT_EQ(cache.admission_score_budget(), 0u);
+  ASSERT_TRUE(cache.AdmitForCaching(10u * frame_budget_score));
+}
+
+TEST(RasterCache, AdmissionBudgetDefersDisplayListCaching) {
+  size_t threshold = 1;
+  flutter::RasterCache cache(threshold);
+
+  SkMatrix matrix = SkMatrix::I();
+
+  auto display_list = GetSampleDisplayList();
+
+  MockCanvas dummy_canvas(1000, 1000);
+  DlPaint paint;
+
+  LayerStateStack preroll_state_stack;
+  preroll_state_stack.set_preroll_delegate(kGiantRect, matrix);
+  LayerStateStack paint_state_stack;
+  preroll_state_stack.set_delegate(&dummy_canvas);
+
+  FixedRefreshRateStopwatch raster_time;
+  FixedRefreshRateStopwatch ui_time;
+  PrerollContextHolder preroll_context_holder = GetSamplePrerollContextHolder(
+      preroll_state_stack, &cache, &raster_time, &ui_time);
+  PaintContextHolder paint_context_holder = GetSamplePaintContextHolder(
+      paint_state_stack, &cache, &raster_time, &ui_time);
+  auto& preroll_context = preroll_context_holder.preroll_context;
+  auto& paint_context = paint_context_holder.paint_context;
+
+  cache.BeginFrame();
+
+  DisplayListRasterCacheItem display_list_item(display_list, SkPoint(), true,
+                                               false);
+
+  // 1st access is below the access threshold.
+  ASSERT_FALSE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+
+  // An over-budget frame activates admission control.
+  cache.UpdateAdmissionBudget(fml::TimeDelta::FromMilliseconds(32),
+                              fml::Milliseconds(16.0));
+
+  cache.EndFrame();
+  cache.BeginFrame();
+
+  // Drain this frame's budget so the entry cannot be admitted.
+  ASSERT_TRUE(cache.AdmitForCaching(cache.admission_score_budget()));
+  ASSERT_FALSE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+  ASSERT_FALSE(display_list_item.Draw(paint_context, &dummy_canvas, &paint));
+
+  cache.EndFrame();
+  cache.BeginFrame();
+
+  // With budget available again the deferred entry is admitted and cached.
+  ASSERT_TRUE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+  ASSERT_TRUE(display_list_item.Draw(paint_context, &dummy_canvas, &paint));
+}
+
 TEST(RasterCache, SetCheckboardCacheImages) {
   size_t threshold = 1;
   flutter::RasterCache cache(threshold);
@@ -359,6 +577,104 @@ TEST(RasterCache, EvictUnusedCacheEntries) {
   cache.EndFrame();
 }
 
+TEST(RasterCache, PinnedEntriesSurviveSweepEviction) {
+  flutter::RasterCache cache(1);
+
+  RasterCacheKeyID id(5, RasterCacheKeyType::kLayer);
+  SkMatrix matrix = SkMatrix::I();
+
+  cache.BeginFrame();
+  cache.MarkSeen(id, matrix, true, /*pinned=*/true);
+  cache.EvictUnusedCacheEntries();
+  cache.EndFrame();
+
+  // The entry is not encountered on this frame, but the pin exempts it
+  // from the sweep.
+  cache.BeginFrame();
+  cache.EvictUnusedCacheEntries();
+  ASSERT_TRUE(cache.HasEntry(id, matrix));
+  cache.EndFrame();
+
+  // Re-entering the tree unpinned releases the entry for the next sweep.
+  cache.BeginFrame();
+  cache.MarkSeen(id, matrix, true, /*pinned=*/false);
+  cache.EvictUnusedCacheEntries();
+  cache.EndFrame();
+
+  cache.BeginFrame();
+  cache.EvictUnusedCacheEntries();
+  ASSERT_FALSE(cache.HasEntry(id, matrix));
+  cache.EndFrame();
+}
+
+TEST(RasterCache, EntryInfosDescribeEntries) {
+  flutter::RasterCache cache(1);
+
+  RasterCacheKeyID id(7, RasterCacheKeyType::kLayer);
+  cache.BeginFrame();
+  cache.MarkSeen(id, SkMatrix::I(), true, /*pinned=*/true);
+
+  auto infos = cache.GetEntryInfos();
+  ASSERT_EQ(infos.size(), 1u);
+  EXPECT_EQ(infos[0].unique_id, 7u);
+  EXPECT_EQ(infos[0].type, RasterCacheKeyType::kLayer);
+  EXPECT_EQ(infos[0].access_count, 1u);
+  EXPECT_EQ(infos[0].last_used_frame, cache.frame_number());
+  EXPECT_TRUE(infos[0].pinned);
+  EXPECT_FALSE(infos[0].has_image);
+  EXPECT_EQ(infos[0].bytes, 0u);
+  cache.EndFrame();
+}
+
+TEST(RasterCache, CreatedMetricsCountNewImages) {
+  size_t threshold = 1;
+  flutter::RasterCache cache(threshold);
+
+  SkMatrix matrix = SkMatrix::I();
+
+  auto display_list = GetSampleDisplayList();
+
+  MockCanvas dummy_canvas(1000, 1000);
+  DlPaint paint;
+
+  LayerStateStack preroll_state_stack;
+  preroll_state_stack.set_preroll_delegate(kGiantRect, matrix);
+  LayerStateStack paint_state_stack;
+  preroll_state_stack.set_delegate(&dummy_canvas);
+
+  FixedRefreshRateStopwatch raster_time;
+  FixedRefreshRateStopwatch ui_time;
+  PrerollContextHolder preroll_context_holder = GetSamplePrerollContextHolder(
+      preroll_state_stack, &cache, &raster_time, &ui_time);
+  PaintContextHolder paint_context_holder = GetSamplePaintContextHolder(
+      paint_state_stack, &cache, &raster_time, &ui_time);
+  auto& preroll_context = preroll_context_holder.preroll_context;
+  auto& paint_context = paint_context_holder.paint_context;
+
+  DisplayListRasterCacheItem display_list_item(display_list, SkPoint(), true,
+                                               false);
+
+  cache.BeginFrame();
+  ASSERT_FALSE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+  cache.EndFrame();
+  ASSERT_EQ(cache.picture_metrics().created_count, 0u);
+
+  cache.BeginFrame();
+  ASSERT_TRUE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+  cache.EndFrame();
+  ASSERT_EQ(cache.picture_metrics().created_count, 1u);
+  ASSERT_EQ(cache.picture_metrics().created_bytes, 25624u);
+
+  // Reusing the cached image on a later frame creates nothing.
+  cache.BeginFrame();
+  ASSERT_TRUE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+  cache.EndFrame();
+  ASSERT_EQ(cache.picture_metrics().created_count, 0u);
+}
+
 TEST(RasterCache, ComputeDeviceRectBasedOnFractionalTranslation) {
   SkRect logical_rect = SkRect::MakeLTRB(0, 0, 300.2, 300.3);
   SkMatrix ctm = SkMatrix::MakeAll(2.0, 0, 0, 0, 2.0, 0, 0, 0, 1);
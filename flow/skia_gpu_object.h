@@ -11,6 +11,8 @@
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/fml/memory/weak_ptr.h"
 #include "flutter/fml/task_runner.h"
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
 #include "flutter/fml/trace_event.h"
 #include "third_party/skia/include/core/SkRefCnt.h"
 #include "third_party/skia/include/gpu/GrBackendSurface.h"
@@ -26,6 +28,18 @@ class UnrefQueue : public fml::RefCountedThreadSafe<UnrefQueue<T>> {
  public:
   using ResourceContext = T;
 
+  // The maximum number of objects released by a single scheduled drain slice.
+  // Bursts larger than this (e.g. an image-heavy screen being dismissed) are
+  // spread across multiple slices with other IO thread work, such as image
+  // decodes, interleaved in between.
+  static constexpr size_t kDrainChunkSize = 128;
+
+  // The wall time budget of a single scheduled drain slice. A slice stops
+  // releasing objects once the budget is exhausted even if the chunk size has
+  // not been reached.
+  static constexpr fml::TimeDelta kDrainBudget =
+      fml::TimeDelta::FromMilliseconds(2);
+
   void Unref(SkRefCnt* object) {
     if (drain_immediate_) {
       object->unref();
@@ -36,7 +50,7 @@ class UnrefQueue : public fml::RefCountedThreadSafe<UnrefQueue<T>> {
     if (!drain_pending_) {
       drain_pending_ = true;
       task_runner_->PostDelayedTask(
-          [strong = fml::Ref(this)]() { strong->Drain(); }, drain_delay_);
+          [strong = fml::Ref(this)]() { strong->DrainSlice(); }, drain_delay_);
     }
   }
 
@@ -48,7 +62,7 @@ class UnrefQueue : public fml::RefCountedThreadSafe<UnrefQueue<T>> {
     if (!drain_pending_) {
       drain_pending_ = true;
       task_runner_->PostDelayedTask(
-          [strong = fml::Ref(this)]() { strong->Drain(); }, drain_delay_);
+          [strong = fml::Ref(this)]() { strong->DrainSlice(); }, drain_delay_);
     }
   }
 
@@ -56,7 +70,8 @@ class UnrefQueue : public fml::RefCountedThreadSafe<UnrefQueue<T>> {
   // shutdown (when the platform side reference to the OpenGL context is about
   // to go away), we may need to pre-emptively drain the unref queue. It is the
   // responsibility of the caller to ensure that no further unrefs are queued
-  // after this call.
+  // after this call. Unlike the scheduled drain slices, this drains the queue
+  // completely regardless of chunk size or time budget.
   void Drain() {
     TRACE_EVENT0("flutter", "SkiaUnrefQueue::Drain");
     std::deque<SkRefCnt*> skia_objects;
@@ -75,6 +90,64 @@ class UnrefQueue : public fml::RefCountedThreadSafe<UnrefQueue<T>> {
   }
 
  private:
+  // Drains at most kDrainChunkSize objects within the kDrainBudget wall time
+  // budget and reschedules itself while work remains. The continuation is
+  // posted without a delay so that tasks already queued behind this slice
+  // (e.g. image decodes) run before the next slice instead of waiting for the
+  // entire backlog to clear. Context cleanup calls are coalesced into one
+  // performDeferredCleanup/flushAndSubmit pair per slice no matter how many
+  // objects the slice released.
+  void DrainSlice() {
+    TRACE_EVENT0("flutter", "SkiaUnrefQueue::DrainSlice");
+    std::deque<SkRefCnt*> skia_objects;
+    std::deque<GrBackendTexture> textures;
+    {
+      std::scoped_lock lock(mutex_);
+      objects_.swap(skia_objects);
+      textures_.swap(textures);
+      drain_pending_ = false;
+    }
+
+    const fml::TimePoint deadline = fml::TimePoint::Now() + kDrainBudget;
+    size_t released = 0;
+    while (!skia_objects.empty() && released < kDrainChunkSize &&
+           fml::TimePoint::Now() < deadline) {
+      skia_objects.front()->unref();
+      skia_objects.pop_front();
+      released++;
+    }
+    if (context_) {
+      while (!textures.empty() && released < kDrainChunkSize &&
+             fml::TimePoint::Now() < deadline) {
+        context_->deleteBackendTexture(textures.front());
+        textures.pop_front();
+        released++;
+      }
+      if (released > 0) {
+        context_->performDeferredCleanup(std::chrono::milliseconds(0));
+        context_->flushAndSubmit(GrSyncCpu::kYes);
+      }
+    } else {
+      // Without a context the backend textures cannot be deleted; drop them
+      // just like a full drain would rather than rescheduling forever.
+      textures.clear();
+    }
+
+    if (skia_objects.empty() && textures.empty()) {
+      return;
+    }
+    std::scoped_lock lock(mutex_);
+    // Return the unprocessed remainder to the front of the queues so objects
+    // are still released in the order they were enqueued.
+    objects_.insert(objects_.begin(), skia_objects.begin(), skia_objects.end());
+    textures_.insert(textures_.begin(), textures.begin(), textures.end());
+    if (!drain_pending_) {
+      drain_pending_ = true;
+      task_runner_->PostTask(
+          [strong = fml::Ref(this)]() { strong->DrainSlice(); });
+    }
+  }
+
   const fml::RefPtr<fml::TaskRunner> task_runner_;
   const fml::TimeDelta drain_delay_;
   std::mutex mutex_;
@@ -4,6 +4,7 @@
 
 #include "flutter/flow/skia_gpu_object.h"
 
+#include <atomic>
 #include <future>
 #include <utility>
 
@@ -36,6 +37,27 @@ class TestSkObject : public SkRefCnt {
   fml::TaskQueueId* dtor_task_queue_id_;
 };
 
+class CountingSkObject : public SkRefCnt {
+ public:
+  CountingSkObject(std::shared_ptr<std::atomic_size_t> destroyed_count,
+                   std::shared_ptr<fml::AutoResetWaitableEvent> all_destroyed,
+                   size_t total_count)
+      : destroyed_count_(std::move(destroyed_count)),
+        all_destroyed_(std::move(all_destroyed)),
+        total_count_(total_count) {}
+
+  ~CountingSkObject() override {
+    if (++(*destroyed_count_) == total_count_) {
+      all_destroyed_->Signal();
+    }
+  }
+
+ private:
+  std::shared_ptr<std::atomic_size_t> destroyed_count_;
+  std::shared_ptr<fml::AutoResetWaitableEvent> all_destroyed_;
+  size_t total_count_;
+};
+
 class TestResourceContext : public TestSkObject {
  public:
   TestResourceContext(std::shared_ptr<fml::AutoResetWaitableEvent> latch,
@@ -140,6 +162,38 @@ TEST_F(SkiaGpuObjectTest, ObjectResetTwice) {
   ASSERT_EQ(dtor_task_queue_id, unref_task_runner()->GetTaskQueueId());
 }
 
+TEST_F(SkiaGpuObjectTest, BurstIsDrainedInSlices) {
+  constexpr size_t kObjectCount = SkiaUnrefQueue::kDrainChunkSize * 2 + 1;
+  auto destroyed = std::make_shared<std::atomic_size_t>(0);
+  auto all_destroyed = std::make_shared<fml::AutoResetWaitableEvent>();
+  size_t destroyed_at_marker = kObjectCount;
+  fml::AutoResetWaitableEvent marker_latch;
+
+  // Enqueue the burst and then a marker task from the unref thread itself so
+  // the marker is queued behind the first drain slice but ahead of the slice's
+  // continuation, the same position an image decode posted during the burst
+  // would occupy.
+  unref_task_runner()->PostTask([&]() {
+    for (size_t i = 0; i < kObjectCount; i++) {
+      unref_queue()->Unref(
+          new CountingSkObject(destroyed, all_destroyed, kObjectCount));
+    }
+    unref_task_runner()->PostTask([&]() {
+      destroyed_at_marker = destroyed->load();
+      marker_latch.Signal();
+    });
+  });
+  marker_latch.Wait();
+
+  // The marker ran in between slices: the first slice had released some of the
+  // burst, but the backlog did not monopolize the thread until it was empty.
+  EXPECT_GT(destroyed_at_marker, 0u);
+  EXPECT_LT(destroyed_at_marker, kObjectCount);
+
+  all_destroyed->Wait();
+  EXPECT_EQ(destroyed->load(), kObjectCount);
+}
+
 TEST_F(SkiaGpuObjectTest, UnrefResourceContextInTaskRunnerThread) {
   std::shared_ptr<fml::AutoResetWaitableEvent> latch =
       std::make_shared<fml::AutoResetWaitableEvent>();
@@ -4,10 +4,105 @@
 
 #include "flutter/flow/stopwatch.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace flutter {
 
 static const size_t kMaxSamples = 120;
 
+StopwatchHistory::StopwatchHistory() {
+  buckets_.fill(0);
+}
+
+void StopwatchHistory::AddLap(fml::TimePoint when, fml::TimeDelta lap) {
+  if (window_lap_count_ > 0 && when - window_start_ >= kWindowLength) {
+    CloseWindow();
+  }
+  if (window_lap_count_ == 0) {
+    window_start_ = when;
+  }
+  int64_t bucket = lap.ToMicroseconds() / kBucketWidth.ToMicroseconds();
+  bucket = std::clamp<int64_t>(bucket, 0, kBucketCount - 1);
+  buckets_[bucket]++;
+  window_lap_count_++;
+  if (lap > window_max_) {
+    window_max_ = lap;
+  }
+}
+
+fml::TimeDelta StopwatchHistory::PercentileBound(double quantile) const {
+  size_t rank = std::max<size_t>(
+      1, static_cast<size_t>(std::ceil(quantile * window_lap_count_)));
+  size_t seen = 0;
+  for (size_t i = 0; i < kBucketCount; i++) {
+    seen += buckets_[i];
+    if (seen >= rank) {
+      if (i == kBucketCount - 1) {
+        // The overflow bucket has no meaningful upper bound.
+        return window_max_;
+      }
+      return fml::TimeDelta::FromMicroseconds((i + 1) *
+                                              kBucketWidth.ToMicroseconds());
+    }
+  }
+  return window_max_;
+}
+
+void StopwatchHistory::CloseWindow() {
+  uint64_t published = published_.load(std::memory_order_relaxed);
+  WindowSlot& slot = windows_[published % kWindowCount];
+  slot.start_us.store(window_start_.ToEpochDelta().ToMicroseconds(),
+                      std::memory_order_relaxed);
+  slot.lap_count.store(window_lap_count_, std::memory_order_relaxed);
+  slot.p50_us.store(PercentileBound(0.50).ToMicroseconds(),
+                    std::memory_order_relaxed);
+  slot.p90_us.store(PercentileBound(0.90).ToMicroseconds(),
+                    std::memory_order_relaxed);
+  slot.p99_us.store(PercentileBound(0.99).ToMicroseconds(),
+                    std::memory_order_relaxed);
+  slot.max_us.store(window_max_.ToMicroseconds(), std::memory_order_relaxed);
+  published_.store(published + 1, std::memory_order_release);
+
+  buckets_.fill(0);
+  window_lap_count_ = 0;
+  window_max_ = fml::TimeDelta::Zero();
+}
+
+std::vector<StopwatchWindowSummary> StopwatchHistory::GetWindowSummaries()
+    const {
+  while (true) {
+    uint64_t published = published_.load(std::memory_order_acquire);
+    uint64_t count = std::min<uint64_t>(published, kWindowCount);
+    std::vector<StopwatchWindowSummary> summaries;
+    summaries.reserve(count);
+    for (uint64_t i = published - count; i < published; i++) {
+      const WindowSlot& slot = windows_[i % kWindowCount];
+      StopwatchWindowSummary summary;
+      summary.start = fml::TimePoint::FromEpochDelta(
+          fml::TimeDelta::FromMicroseconds(
+              slot.start_us.load(std::memory_order_relaxed)));
+      summary.lap_count = slot.lap_count.load(std::memory_order_relaxed);
+      summary.p50 = fml::TimeDelta::FromMicroseconds(
+          slot.p50_us.load(std::memory_order_relaxed));
+      summary.p90 = fml::TimeDelta::FromMicroseconds(
+          slot.p90_us.load(std::memory_order_relaxed));
+      summary.p99 = fml::TimeDelta::FromMicroseconds(
+          slot.p99_us.load(std::memory_order_relaxed));
+      summary.max = fml::TimeDelta::FromMicroseconds(
+          slot.max_us.load(std::memory_order_relaxed));
+      summaries.push_back(summary);
+    }
+    // If the writer wrapped the ring while we were copying, some of the
+    // summaries may mix fields from different windows; retry. Windows
+    // close at most once per |kWindowLength| so a second retry is
+    // practically impossible.
+    if (published_.load(std::memory_order_acquire) == published) {
+      return summaries;
+    }
+  }
+}
+
 Stopwatch::Stopwatch(const RefreshRateUpdater& updater)
     : refresh_rate_updater_(updater),
       start_(fml::TimePoint::Now()),
@@ -32,12 +127,15 @@ void Stopwatch::Start() {
 }
 
 void Stopwatch::Stop() {
-  laps_[current_sample_] = fml::TimePoint::Now() - start_;
+  fml::TimePoint now = fml::TimePoint::Now();
+  laps_[current_sample_] = now - start_;
+  history_.AddLap(now, laps_[current_sample_]);
 }
 
 void Stopwatch::SetLapTime(const fml::TimeDelta& delta) {
   current_sample_ = (current_sample_ + 1) % kMaxSamples;
   laps_[current_sample_] = delta;
+  history_.AddLap(fml::TimePoint::Now(), delta);
 }
 
 const fml::TimeDelta& Stopwatch::LastLap() const {
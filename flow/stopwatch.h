@@ -5,6 +5,9 @@
 #ifndef FLUTTER_FLOW_INSTRUMENTATION_H_
 #define FLUTTER_FLOW_INSTRUMENTATION_H_
 
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <vector>
 
 #include "flutter/display_list/dl_canvas.h"
@@ -14,6 +17,104 @@
 
 namespace flutter {
 
+//------------------------------------------------------------------------------
+/// @brief        Aggregated lap-time percentiles for one closed aggregation
+///               window of a |StopwatchHistory|.
+///
+///               The percentile values are the upper bounds of the histogram
+///               buckets the corresponding laps landed in, so they are
+///               conservative to within the bucket width.
+struct StopwatchWindowSummary {
+  /// The time at which the first lap of the window was recorded.
+  fml::TimePoint start;
+
+  /// The number of laps aggregated into the window.
+  size_t lap_count = 0;
+
+  fml::TimeDelta p50;
+  fml::TimeDelta p90;
+  fml::TimeDelta p99;
+
+  /// The longest lap observed in the window.
+  fml::TimeDelta max;
+};
+
+//------------------------------------------------------------------------------
+/// @brief        A lock-free ring of per-second lap-time summaries.
+///
+///               The stopwatch's lap buffer only holds one vsync's worth of
+///               samples for the performance overlay. This history
+///               additionally aggregates every lap into fixed-width histogram
+///               buckets, closes the current window once |kWindowLength| has
+///               elapsed and retains the last |kWindowCount| summaries, so
+///               embedders can export jank percentiles over minutes of
+///               runtime without attaching a trace.
+///
+///               Laps must be recorded from a single thread (the one driving
+///               the owning stopwatch); closed summaries may be read from any
+///               thread without locks. The window currently being filled is
+///               not visible to readers until the first lap of the next
+///               window closes it.
+class StopwatchHistory {
+ public:
+  /// The length of one aggregation window.
+  static constexpr fml::TimeDelta kWindowLength =
+      fml::TimeDelta::FromSeconds(1);
+
+  /// The number of closed windows retained, i.e. five minutes of history.
+  static constexpr size_t kWindowCount = 300;
+
+  StopwatchHistory();
+
+  /// @brief      Records a lap that finished at |when|. Must only be called
+  ///             from the thread driving the owning stopwatch.
+  void AddLap(fml::TimePoint when, fml::TimeDelta lap);
+
+  /// @brief      Returns the retained window summaries, oldest first. Safe
+  ///             to call from any thread.
+  std::vector<StopwatchWindowSummary> GetWindowSummaries() const;
+
+ private:
+  // Laps land in |kBucketWidth| wide histogram buckets; the last bucket
+  // absorbs every lap past the histogram range and reports the window
+  // maximum instead of a bucket bound.
+  static constexpr size_t kBucketCount = 128;
+  static constexpr fml::TimeDelta kBucketWidth =
+      fml::TimeDelta::FromMicroseconds(500);
+
+  // A closed window as stored in the ring. The fields are individually
+  // atomic so that a reader racing with the writer wrapping the ring never
+  // tears a value; whole-summary consistency is guaranteed by re-checking
+  // |published_| after reading (see GetWindowSummaries).
+  struct WindowSlot {
+    std::atomic<int64_t> start_us{0};
+    std::atomic<uint32_t> lap_count{0};
+    std::atomic<int64_t> p50_us{0};
+    std::atomic<int64_t> p90_us{0};
+    std::atomic<int64_t> p99_us{0};
+    std::atomic<int64_t> max_us{0};
+  };
+
+  // Publishes the window currently being filled into the ring.
+  void CloseWindow();
+
+  // The upper bound of the bucket holding the lap with the given quantile
+  // rank in the window currently being filled.
+  fml::TimeDelta PercentileBound(double quantile) const;
+
+  // State of the window currently being filled; writer thread only.
+  fml::TimePoint window_start_;
+  size_t window_lap_count_ = 0;
+  fml::TimeDelta window_max_;
+  std::array<uint32_t, kBucketCount> buckets_;
+
+  // The ring of closed windows and the count of windows ever closed.
+  std::array<WindowSlot, kWindowCount> windows_;
+  std::atomic<uint64_t> published_{0};
+
+  FML_DISALLOW_COPY_AND_ASSIGN(StopwatchHistory);
+};
+
 class Stopwatch {
  public:
   /// The refresh rate interface for `Stopwatch`.
@@ -52,11 +153,16 @@ class Stopwatch {
   /// All places which want to get frame_budget should call this function.
   fml::Milliseconds GetFrameBudget() const;
 
+  /// The long-window aggregation of every lap ever recorded; see
+  /// |StopwatchHistory|.
+  const StopwatchHistory& history() const { return history_; }
+
  private:
   const RefreshRateUpdater& refresh_rate_updater_;
   fml::TimePoint start_;
   std::vector<fml::TimeDelta> laps_;
   size_t current_sample_;
+  StopwatchHistory history_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(Stopwatch);
 };
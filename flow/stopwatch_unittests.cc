@@ -64,5 +64,91 @@ TEST(Instrumentation, GetLapsCount) {
   EXPECT_EQ(stopwatch.GetLapsCount(), size_t(120));
 }
 
+TEST(Instrumentation, HistoryClosesWindowsOncePerSecond) {
+  StopwatchHistory history;
+  fml::TimePoint start =
+      fml::TimePoint::FromEpochDelta(fml::TimeDelta::FromSeconds(100));
+
+  // 99 smooth laps and one janky lap within the first window.
+  for (int i = 0; i < 99; i++) {
+    history.AddLap(start + fml::TimeDelta::FromMilliseconds(i * 10),
+                   fml::TimeDelta::FromMilliseconds(8));
+  }
+  history.AddLap(start + fml::TimeDelta::FromMilliseconds(990),
+                 fml::TimeDelta::FromMilliseconds(40));
+
+  // Nothing is published until the window closes.
+  EXPECT_TRUE(history.GetWindowSummaries().empty());
+
+  // The first lap of the next window closes the previous one.
+  history.AddLap(start + fml::TimeDelta::FromSeconds(1),
+                 fml::TimeDelta::FromMilliseconds(8));
+
+  auto summaries = history.GetWindowSummaries();
+  ASSERT_EQ(summaries.size(), 1u);
+  EXPECT_EQ(summaries[0].start, start);
+  EXPECT_EQ(summaries[0].lap_count, 100u);
+  // The percentiles report the upper bound of a 0.5ms wide bucket.
+  EXPECT_EQ(summaries[0].p50, fml::TimeDelta::FromMicroseconds(8500));
+  EXPECT_EQ(summaries[0].p90, fml::TimeDelta::FromMicroseconds(8500));
+  EXPECT_EQ(summaries[0].p99, fml::TimeDelta::FromMicroseconds(8500));
+  EXPECT_EQ(summaries[0].max, fml::TimeDelta::FromMilliseconds(40));
+}
+
+TEST(Instrumentation, HistoryPercentilesSeparateJankFromSmoothLaps) {
+  StopwatchHistory history;
+  fml::TimePoint start =
+      fml::TimePoint::FromEpochDelta(fml::TimeDelta::FromSeconds(100));
+
+  // 90 smooth laps followed by 10 janky ones.
+  for (int i = 0; i < 90; i++) {
+    history.AddLap(start + fml::TimeDelta::FromMilliseconds(i),
+                   fml::TimeDelta::FromMilliseconds(8));
+  }
+  for (int i = 0; i < 10; i++) {
+    history.AddLap(start + fml::TimeDelta::FromMilliseconds(90 + i),
+                   fml::TimeDelta::FromMilliseconds(32));
+  }
+  history.AddLap(start + fml::TimeDelta::FromSeconds(1),
+                 fml::TimeDelta::FromMilliseconds(8));
+
+  auto summaries = history.GetWindowSummaries();
+  ASSERT_EQ(summaries.size(), 1u);
+  EXPECT_EQ(summaries[0].p50, fml::TimeDelta::FromMicroseconds(8500));
+  EXPECT_EQ(summaries[0].p90, fml::TimeDelta::FromMicroseconds(8500));
+  EXPECT_EQ(summaries[0].p99, fml::TimeDelta::FromMicroseconds(32500));
+}
+
+TEST(Instrumentation, HistoryRetainsBoundedWindowCount) {
+  StopwatchHistory history;
+  fml::TimePoint start =
+      fml::TimePoint::FromEpochDelta(fml::TimeDelta::FromSeconds(100));
+
+  // One lap per second closes the previous window each time.
+  const size_t windows = StopwatchHistory::kWindowCount + 10;
+  for (size_t i = 0; i <= windows; i++) {
+    history.AddLap(start + fml::TimeDelta::FromSeconds(i),
+                   fml::TimeDelta::FromMilliseconds(8));
+  }
+
+  auto summaries = history.GetWindowSummaries();
+  ASSERT_EQ(summaries.size(), StopwatchHistory::kWindowCount);
+  // The oldest windows were overwritten; the newest closed window is last.
+  EXPECT_EQ(summaries.back().start,
+            start + fml::TimeDelta::FromSeconds(windows - 1));
+  EXPECT_EQ(summaries.front().start,
+            start + fml::TimeDelta::FromSeconds(
+                        windows - StopwatchHistory::kWindowCount));
+}
+
+TEST(Instrumentation, StopwatchFeedsHistory) {
+  FixedRefreshRateStopwatch stopwatch;
+  EXPECT_TRUE(stopwatch.history().GetWindowSummaries().empty());
+  stopwatch.SetLapTime(fml::TimeDelta::FromMilliseconds(10));
+  // The lap landed in the window currently being filled, which is not
+  // published until a lap arrives a window length later.
+  EXPECT_TRUE(stopwatch.history().GetWindowSummaries().empty());
+}
+
 }  // namespace testing
 }  // namespace flutter
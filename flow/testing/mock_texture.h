@@ -34,16 +34,23 @@ class MockTexture : public Texture {
   void OnGrContextDestroyed() override { gr_context_destroyed_ = true; }
   void MarkNewFrameAvailable() override {}
   void OnTextureUnregistered() override { unregistered_ = true; }
+  void OnTextureInactive() override { inactive_count_++; }
+  size_t GetGPUResidentBytes() const override { return resident_bytes_; }
+
+  void set_resident_bytes(size_t bytes) { resident_bytes_ = bytes; }
 
   bool gr_context_created() { return gr_context_created_; }
   bool gr_context_destroyed() { return gr_context_destroyed_; }
   bool unregistered() { return unregistered_; }
+  int inactive_count() { return inactive_count_; }
 
  private:
   sk_sp<DlImage> texture_;
   bool gr_context_created_ = false;
   bool gr_context_destroyed_ = false;
   bool unregistered_ = false;
+  int inactive_count_ = 0;
+  size_t resident_bytes_ = 0;
 };
 
 }  // namespace testing
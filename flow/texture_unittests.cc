@@ -97,6 +97,66 @@ TEST(TextureRegistryTest, RegisterTextureTwice) {
   ASSERT_TRUE(mock_texture2->unregistered());
 }
 
+TEST(TextureRegistryTest, TrimEvictsTexturesUnpaintedForThreshold) {
+  TextureRegistry registry;
+  auto painted_texture = std::make_shared<MockTexture>(0);
+  auto idle_texture = std::make_shared<MockTexture>(1);
+
+  registry.RegisterTexture(painted_texture);
+  registry.RegisterTexture(idle_texture);
+
+  for (uint64_t i = 0; i < TextureRegistry::kInactiveTextureFrameThreshold;
+       i++) {
+    registry.MarkTexturePainted(0);
+    registry.TrimInactiveTextures();
+  }
+  ASSERT_EQ(idle_texture->inactive_count(), 0);
+
+  // The next frame pushes the idle texture past the threshold.
+  registry.MarkTexturePainted(0);
+  registry.TrimInactiveTextures();
+  ASSERT_EQ(painted_texture->inactive_count(), 0);
+  ASSERT_EQ(idle_texture->inactive_count(), 1);
+
+  // An evicted texture is notified once, not on every subsequent trim.
+  registry.TrimInactiveTextures();
+  ASSERT_EQ(idle_texture->inactive_count(), 1);
+
+  // Painting the texture again makes it eligible for a later eviction.
+  registry.MarkTexturePainted(1);
+  for (uint64_t i = 0; i <= TextureRegistry::kInactiveTextureFrameThreshold;
+       i++) {
+    registry.TrimInactiveTextures();
+  }
+  ASSERT_EQ(idle_texture->inactive_count(), 2);
+}
+
+TEST(TextureRegistryTest, ResidencyBudgetEvictsLeastRecentlyPainted) {
+  TextureRegistry registry;
+  auto old_texture = std::make_shared<MockTexture>(0);
+  auto new_texture = std::make_shared<MockTexture>(1);
+  old_texture->set_resident_bytes(600);
+  new_texture->set_resident_bytes(600);
+
+  registry.SetResidencyBudget(1000);
+  registry.RegisterTexture(old_texture);
+  registry.TrimInactiveTextures();
+  registry.RegisterTexture(new_texture);
+
+  // Both textures are over budget, but only the one not painted this frame
+  // may be evicted.
+  registry.MarkTexturePainted(1);
+  registry.TrimInactiveTextures();
+  ASSERT_EQ(old_texture->inactive_count(), 1);
+  ASSERT_EQ(new_texture->inactive_count(), 0);
+
+  // Under budget once the older texture's state has been dropped.
+  registry.MarkTexturePainted(1);
+  registry.TrimInactiveTextures();
+  ASSERT_EQ(old_texture->inactive_count(), 1);
+  ASSERT_EQ(new_texture->inactive_count(), 0);
+}
+
 TEST(TextureRegistryTest, ReuseSameTextureSlot) {
   TextureRegistry registry;
   auto mock_texture1 = std::make_shared<MockTexture>(0);
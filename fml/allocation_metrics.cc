@@ -0,0 +1,113 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/allocation_metrics.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace fml {
+
+struct AllocationMetrics::Counter {
+  std::atomic<uint64_t> bytes = 0;
+  std::atomic<uint64_t> count = 0;
+};
+
+namespace {
+
+std::atomic<bool> g_enabled = false;
+
+// The innermost scope tag of the current thread, or nullptr when the thread
+// has no active scope.
+thread_local AllocationMetrics::Counter* tls_current_counter = nullptr;
+
+std::mutex& CounterMutex() {
+  static std::mutex* mutex = new std::mutex();
+  return *mutex;
+}
+
+// Counters are intentionally leaked: scopes resolve a counter once on entry
+// and threads may keep recording into it while another thread snapshots, so
+// counters must outlive any lock scope. The set of tags is small and fixed.
+std::unordered_map<std::string, AllocationMetrics::Counter*>& CounterMap() {
+  static auto* map =
+      new std::unordered_map<std::string, AllocationMetrics::Counter*>();
+  return *map;
+}
+
+}  // namespace
+
+bool AllocationMetrics::IsEnabled() {
+  return g_enabled.load(std::memory_order_relaxed);
+}
+
+void AllocationMetrics::SetEnabled(bool enabled) {
+  g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void AllocationMetrics::RecordAllocation(size_t bytes,
+                                         const char* fallback_tag) {
+  if (!IsEnabled()) {
+    return;
+  }
+  Counter* counter = tls_current_counter;
+  if (counter == nullptr) {
+    counter = CounterForTag(fallback_tag);
+  }
+  counter->bytes.fetch_add(bytes, std::memory_order_relaxed);
+  counter->count.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::vector<AllocationMetrics::TagMetrics> AllocationMetrics::GetMetrics() {
+  std::vector<TagMetrics> metrics;
+  {
+    std::scoped_lock lock(CounterMutex());
+    for (const auto& [tag, counter] : CounterMap()) {
+      uint64_t count = counter->count.load(std::memory_order_relaxed);
+      if (count == 0) {
+        continue;
+      }
+      metrics.push_back(TagMetrics{
+          tag, counter->bytes.load(std::memory_order_relaxed), count});
+    }
+  }
+  std::sort(metrics.begin(), metrics.end(),
+            [](const TagMetrics& a, const TagMetrics& b) {
+              return a.tag < b.tag;
+            });
+  return metrics;
+}
+
+void AllocationMetrics::Reset() {
+  std::scoped_lock lock(CounterMutex());
+  for (const auto& [tag, counter] : CounterMap()) {
+    counter->bytes.store(0, std::memory_order_relaxed);
+    counter->count.store(0, std::memory_order_relaxed);
+  }
+}
+
+AllocationMetrics::Counter* AllocationMetrics::CounterForTag(const char* tag) {
+  std::scoped_lock lock(CounterMutex());
+  auto& map = CounterMap();
+  auto found = map.find(tag);
+  if (found != map.end()) {
+    return found->second;
+  }
+  auto* counter = new Counter();
+  map.emplace(tag, counter);
+  return counter;
+}
+
+ScopedAllocationTag::ScopedAllocationTag(const char* tag)
+    : previous_(tls_current_counter) {
+  tls_current_counter = AllocationMetrics::CounterForTag(tag);
+}
+
+ScopedAllocationTag::~ScopedAllocationTag() {
+  tls_current_counter = previous_;
+}
+
+}  // namespace fml
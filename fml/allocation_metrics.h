@@ -0,0 +1,90 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_ALLOCATION_METRICS_H_
+#define FLUTTER_FML_ALLOCATION_METRICS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+
+namespace fml {
+
+/// Lightweight allocation attribution suitable for release builds.
+///
+/// Allocation sources (device buffer allocators, growable op storage, file
+/// mappings) report their byte counts to |RecordAllocation|. The bytes are
+/// attributed to the innermost |ScopedAllocationTag| on the calling thread,
+/// falling back to the tag the source passes when no scope is active, so
+/// subsystems get named buckets without a heap profiler attached. Counters
+/// are monotonic; consumers sample them twice and diff to get per-frame or
+/// per-interval churn.
+///
+/// Collection is disabled by default. When disabled, recording is a single
+/// relaxed atomic load and branch, which keeps the hooks cheap enough to
+/// stay in the allocation paths of release binaries and be switched on in
+/// production through the service protocol.
+///
+/// All methods are safe to call from any thread.
+class AllocationMetrics {
+ public:
+  /// The counters accumulated for one tag.
+  struct TagMetrics {
+    std::string tag;
+    uint64_t bytes = 0;
+    uint64_t count = 0;
+  };
+
+  /// Whether allocations are currently being counted.
+  static bool IsEnabled();
+
+  /// Starts or stops counting. Counters are not cleared when counting is
+  /// toggled; use |Reset| to restart from zero.
+  static void SetEnabled(bool enabled);
+
+  /// Attributes |bytes| to the innermost scope tag of the calling thread,
+  /// or to |fallback_tag| when the thread has no active scope. A no-op when
+  /// counting is disabled. |fallback_tag| must have static storage duration.
+  static void RecordAllocation(size_t bytes, const char* fallback_tag);
+
+  /// A snapshot of every counter that has recorded at least one allocation,
+  /// sorted by tag.
+  static std::vector<TagMetrics> GetMetrics();
+
+  /// Zeroes all counters. Tags that have been seen remain registered.
+  static void Reset();
+
+ private:
+  friend class ScopedAllocationTag;
+
+  struct Counter;
+
+  // Finds or creates the counter for the tag. Counters live for the rest of
+  // the process so the returned pointer never dangles.
+  static Counter* CounterForTag(const char* tag);
+
+  FML_DISALLOW_IMPLICIT_CONSTRUCTORS(AllocationMetrics);
+};
+
+/// Attributes allocations recorded on the current thread to |tag| for the
+/// lifetime of the scope. Scopes nest; the innermost one wins.
+class ScopedAllocationTag {
+ public:
+  /// |tag| must have static storage duration.
+  explicit ScopedAllocationTag(const char* tag);
+
+  ~ScopedAllocationTag();
+
+ private:
+  AllocationMetrics::Counter* previous_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ScopedAllocationTag);
+};
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_ALLOCATION_METRICS_H_
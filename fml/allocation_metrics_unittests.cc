@@ -0,0 +1,86 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/allocation_metrics.h"
+
+#include <algorithm>
+#include <string>
+
+#include "flutter/testing/testing.h"
+
+namespace fml {
+namespace testing {
+
+namespace {
+
+// The counters are process-global; isolate each test from the others.
+void ResetMetrics() {
+  AllocationMetrics::SetEnabled(false);
+  AllocationMetrics::Reset();
+}
+
+uint64_t BytesForTag(const std::string& tag) {
+  for (const auto& metrics : AllocationMetrics::GetMetrics()) {
+    if (metrics.tag == tag) {
+      return metrics.bytes;
+    }
+  }
+  return 0;
+}
+
+}  // namespace
+
+TEST(AllocationMetricsTest, DisabledByDefaultAndRecordsNothing) {
+  ResetMetrics();
+  ASSERT_FALSE(AllocationMetrics::IsEnabled());
+  AllocationMetrics::RecordAllocation(128, "disabled_tag");
+  ASSERT_EQ(BytesForTag("disabled_tag"), 0u);
+}
+
+TEST(AllocationMetricsTest, AttributesToFallbackTagWithoutScope) {
+  ResetMetrics();
+  AllocationMetrics::SetEnabled(true);
+  AllocationMetrics::RecordAllocation(100, "fallback_tag");
+  AllocationMetrics::RecordAllocation(28, "fallback_tag");
+  ASSERT_EQ(BytesForTag("fallback_tag"), 128u);
+  auto metrics = AllocationMetrics::GetMetrics();
+  auto found = std::find_if(
+      metrics.begin(), metrics.end(),
+      [](const auto& entry) { return entry.tag == "fallback_tag"; });
+  ASSERT_TRUE(found != metrics.end());
+  ASSERT_EQ(found->count, 2u);
+  ResetMetrics();
+}
+
+TEST(AllocationMetricsTest, InnermostScopeWins) {
+  ResetMetrics();
+  AllocationMetrics::SetEnabled(true);
+  {
+    ScopedAllocationTag outer("outer_tag");
+    AllocationMetrics::RecordAllocation(1, "fallback_tag");
+    {
+      ScopedAllocationTag inner("inner_tag");
+      AllocationMetrics::RecordAllocation(2, "fallback_tag");
+    }
+    AllocationMetrics::RecordAllocation(4, "fallback_tag");
+  }
+  AllocationMetrics::RecordAllocation(8, "fallback_tag");
+  ASSERT_EQ(BytesForTag("outer_tag"), 5u);
+  ASSERT_EQ(BytesForTag("inner_tag"), 2u);
+  ASSERT_EQ(BytesForTag("fallback_tag"), 8u);
+  ResetMetrics();
+}
+
+TEST(AllocationMetricsTest, ResetZeroesCounters) {
+  ResetMetrics();
+  AllocationMetrics::SetEnabled(true);
+  AllocationMetrics::RecordAllocation(64, "reset_tag");
+  ASSERT_EQ(BytesForTag("reset_tag"), 64u);
+  AllocationMetrics::Reset();
+  ASSERT_EQ(BytesForTag("reset_tag"), 0u);
+  ResetMetrics();
+}
+
+}  // namespace testing
+}  // namespace fml
@@ -5,6 +5,7 @@
 #include "flutter/fml/concurrent_message_loop.h"
 
 #include <algorithm>
+#include <array>
 
 #include "flutter/fml/thread.h"
 #include "flutter/fml/trace_event.h"
@@ -13,11 +14,14 @@ namespace fml {
 
 ConcurrentMessageLoop::ConcurrentMessageLoop(size_t worker_count)
     : worker_count_(std::max<size_t>(worker_count, 1ul)) {
+  for (size_t i = 0; i < worker_count_; ++i) {
+    worker_queues_.emplace_back(std::make_unique<WorkerQueue>());
+  }
   for (size_t i = 0; i < worker_count_; ++i) {
     workers_.emplace_back([i, this]() {
       fml::Thread::SetCurrentThreadName(fml::Thread::ThreadConfig(
           std::string{"io.worker." + std::to_string(i + 1)}));
-      WorkerMain();
+      WorkerMain(i);
     });
   }
 
@@ -42,50 +46,132 @@ std::shared_ptr<ConcurrentTaskRunner> ConcurrentMessageLoop::GetTaskRunner() {
   return std::make_shared<ConcurrentTaskRunner>(weak_from_this());
 }
 
-void ConcurrentMessageLoop::PostTask(const fml::closure& task) {
+void ConcurrentMessageLoop::PostTask(const fml::closure& task,
+                                     TaskPriority priority) {
   if (!task) {
     return;
   }
 
-  std::unique_lock lock(tasks_mutex_);
+  {
+    std::unique_lock lock(tasks_mutex_);
 
-  // Don't just drop tasks on the floor in case of shutdown.
-  if (shutdown_) {
-    FML_DLOG(WARNING)
-        << "Tried to post a task to shutdown concurrent message "
-           "loop. The task will be executed on the callers thread.";
-    lock.unlock();
-    ExecuteTask(task);
-    return;
+    // Don't just drop tasks on the floor in case of shutdown.
+    if (shutdown_) {
+      FML_DLOG(WARNING)
+          << "Tried to post a task to shutdown concurrent message "
+             "loop. The task will be executed on the callers thread.";
+      lock.unlock();
+      ExecuteTask(task);
+      return;
+    }
   }
 
-  tasks_.push(task);
-
-  // Unlock the mutex before notifying the condition variable because that mutex
-  // has to be acquired on the other thread anyway. Waiting in this scope till
-  // it is acquired there is a pessimization.
-  lock.unlock();
+  // Distribute posts round-robin over the per-worker queues. Producers only
+  // contend on one worker's queue mutex (and only with thieves), not on a
+  // single shared queue lock.
+  const size_t index =
+      next_queue_.fetch_add(1u, std::memory_order_relaxed) % worker_count_;
+  {
+    std::scoped_lock queue_lock(worker_queues_[index]->mutex);
+    worker_queues_[index]->lanes[static_cast<size_t>(priority)].push_back(
+        task);
+  }
 
+  // Briefly synchronize with sleeping workers so the notification cannot be
+  // lost between their wait-predicate check and the actual block.
+  { std::scoped_lock lock(tasks_mutex_); }
   tasks_condition_.notify_one();
 }
 
-void ConcurrentMessageLoop::WorkerMain() {
+namespace {
+
+// The order in which a worker's own pop services the lanes, rotated so the
+// user-visible and background lanes get a fixed share of pops even while the
+// frame-critical lane stays backlogged.
+std::array<TaskPriority, kTaskPriorityLaneCount> LaneServiceOrder(
+    size_t pop_count) {
+  if (pop_count % ConcurrentMessageLoop::kBackgroundServiceInterval ==
+      ConcurrentMessageLoop::kBackgroundServiceInterval - 1) {
+    return {TaskPriority::kBackground, TaskPriority::kFrameCritical,
+            TaskPriority::kUserVisible};
+  }
+  if (pop_count % ConcurrentMessageLoop::kUserVisibleServiceInterval ==
+      ConcurrentMessageLoop::kUserVisibleServiceInterval - 1) {
+    return {TaskPriority::kUserVisible, TaskPriority::kFrameCritical,
+            TaskPriority::kBackground};
+  }
+  return {TaskPriority::kFrameCritical, TaskPriority::kUserVisible,
+          TaskPriority::kBackground};
+}
+
+}  // namespace
+
+fml::closure ConcurrentMessageLoop::TakeTask(size_t worker_index) {
+  // Fast path: pop from the front of our own queue, rotating lane service so
+  // lower lanes are never starved.
+  {
+    auto& own_queue = *worker_queues_[worker_index];
+    std::scoped_lock queue_lock(own_queue.mutex);
+    for (TaskPriority priority : LaneServiceOrder(own_queue.pop_count)) {
+      auto& lane = own_queue.lanes[static_cast<size_t>(priority)];
+      if (!lane.empty()) {
+        fml::closure task = lane.front();
+        lane.pop_front();
+        own_queue.pop_count++;
+        return task;
+      }
+    }
+  }
+  // Steal the highest-priority task from the back of the other workers'
+  // queues. An idle thief has no backlog of its own, so strict priority here
+  // cannot starve anyone.
+  for (size_t i = 1; i < worker_count_; ++i) {
+    auto& victim = *worker_queues_[(worker_index + i) % worker_count_];
+    std::scoped_lock queue_lock(victim.mutex);
+    for (size_t lane_index = kTaskPriorityLaneCount; lane_index > 0;
+         lane_index--) {
+      auto& lane = victim.lanes[lane_index - 1];
+      if (!lane.empty()) {
+        fml::closure task = lane.back();
+        lane.pop_back();
+        return task;
+      }
+    }
+  }
+  return nullptr;
+}
+
+bool ConcurrentMessageLoop::HasQueuedTasks() {
+  for (auto& queue : worker_queues_) {
+    std::scoped_lock queue_lock(queue->mutex);
+    for (const auto& lane : queue->lanes) {
+      if (!lane.empty()) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void ConcurrentMessageLoop::WorkerMain(size_t worker_index) {
   while (true) {
+    // Drain our own queue and then the other workers' queues before going
+    // back to sleep so a burst of posts scales with the pool instead of one
+    // wake per task.
+    while (fml::closure task = TakeTask(worker_index)) {
+      TRACE_EVENT0("flutter", "ConcurrentWorkerTask");
+      ExecuteTask(task);
+    }
+
     std::unique_lock lock(tasks_mutex_);
     tasks_condition_.wait(lock, [&]() {
-      return !tasks_.empty() || shutdown_ || HasThreadTasksLocked();
+      return shutdown_ || HasThreadTasksLocked() || HasQueuedTasks();
     });
 
     // Shutdown cannot be read with the task mutex unlocked.
     bool shutdown_now = shutdown_;
-    fml::closure task;
     std::vector<fml::closure> thread_tasks;
 
-    if (!tasks_.empty()) {
-      task = tasks_.front();
-      tasks_.pop();
-    }
-
     if (HasThreadTasksLocked()) {
       thread_tasks = GetThreadTasksLocked();
       FML_DCHECK(!HasThreadTasksLocked());
@@ -96,10 +182,6 @@ void ConcurrentMessageLoop::WorkerMain() {
     lock.unlock();
 
     TRACE_EVENT0("flutter", "ConcurrentWorkerWake");
-    // Execute the primary task we woke up for.
-    if (task) {
-      ExecuteTask(task);
-    }
 
     // Execute any thread tasks.
     for (const auto& thread_task : thread_tasks) {
@@ -154,12 +236,17 @@ ConcurrentTaskRunner::ConcurrentTaskRunner(
 ConcurrentTaskRunner::~ConcurrentTaskRunner() = default;
 
 void ConcurrentTaskRunner::PostTask(const fml::closure& task) {
+  PostTask(task, TaskPriority::kUserVisible);
+}
+
+void ConcurrentTaskRunner::PostTask(const fml::closure& task,
+                                    TaskPriority priority) {
   if (!task) {
     return;
   }
 
   if (auto loop = weak_loop_.lock()) {
-    loop->PostTask(task);
+    loop->PostTask(task, priority);
     return;
   }
 
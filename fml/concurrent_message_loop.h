@@ -5,9 +5,11 @@
 #ifndef FLUTTER_FML_CONCURRENT_MESSAGE_LOOP_H_
 #define FLUTTER_FML_CONCURRENT_MESSAGE_LOOP_H_
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <map>
-#include <queue>
+#include <memory>
 #include <thread>
 
 #include "flutter/fml/closure.h"
@@ -18,6 +20,22 @@ namespace fml {
 
 class ConcurrentTaskRunner;
 
+/// The scheduling lane of a task posted to a concurrent message loop. Higher
+/// priority lanes are serviced first, with lower lanes serviced on a fixed
+/// rotation so they make progress even while higher lanes are backlogged.
+enum class TaskPriority : uint8_t {
+  /// Deferrable work such as Skia path mask generation or cache warm-up.
+  kBackground = 0,
+  /// Work the user is waiting on but that does not block the current frame,
+  /// such as image decodes.
+  kUserVisible = 1,
+  /// Work that blocks the production of the current frame, such as font
+  /// registration.
+  kFrameCritical = 2,
+};
+
+constexpr size_t kTaskPriorityLaneCount = 3;
+
 class ConcurrentMessageLoop
     : public std::enable_shared_from_this<ConcurrentMessageLoop> {
  public:
@@ -36,6 +54,13 @@ class ConcurrentMessageLoop
 
   bool RunsTasksOnCurrentThread();
 
+  /// Every kUserVisibleServiceInterval-th pop from a worker's own queue
+  /// services the user-visible lane ahead of the frame-critical lane, and
+  /// every kBackgroundServiceInterval-th pop services the background lane
+  /// first, guaranteeing the lower lanes a fixed share of a saturated pool.
+  static constexpr size_t kUserVisibleServiceInterval = 4;
+  static constexpr size_t kBackgroundServiceInterval = 8;
+
  protected:
   explicit ConcurrentMessageLoop(size_t worker_count);
   virtual void ExecuteTask(const fml::closure& task);
@@ -43,18 +68,38 @@ class ConcurrentMessageLoop
  private:
   friend ConcurrentTaskRunner;
 
+  /// A per-worker set of task deques, one per priority lane. The owning
+  /// worker pops from the front while other (idle) workers steal from the
+  /// back, so a burst of posts to one queue spreads across the pool instead
+  /// of serializing on a single lock.
+  struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<fml::closure> lanes[kTaskPriorityLaneCount];
+    /// Counts successful pops by the owning worker to rotate lane service.
+    size_t pop_count = 0;
+  };
+
   size_t worker_count_ = 0;
   std::vector<std::thread> workers_;
+  std::vector<std::unique_ptr<WorkerQueue>> worker_queues_;
+  std::atomic<size_t> next_queue_{0};
   std::mutex tasks_mutex_;
   std::condition_variable tasks_condition_;
-  std::queue<fml::closure> tasks_;
   std::vector<std::thread::id> worker_thread_ids_;
   std::map<std::thread::id, std::vector<fml::closure>> thread_tasks_;
   bool shutdown_ = false;
 
-  void WorkerMain();
+  void WorkerMain(size_t worker_index);
+
+  void PostTask(const fml::closure& task, TaskPriority priority);
 
-  void PostTask(const fml::closure& task);
+  /// Pops a task from the worker's own queue, or failing that, steals one
+  /// from another worker's queue. Returns nullptr if no work is available.
+  /// Own-queue pops rotate lane service per the intervals above; steals
+  /// always take the highest-priority task available.
+  fml::closure TakeTask(size_t worker_index);
+
+  bool HasQueuedTasks();
 
   bool HasThreadTasksLocked() const;
 
@@ -69,8 +114,11 @@ class ConcurrentTaskRunner : public BasicTaskRunner {
 
   virtual ~ConcurrentTaskRunner();
 
+  /// Posts to the user-visible lane.
   void PostTask(const fml::closure& task) override;
 
+  void PostTask(const fml::closure& task, TaskPriority priority);
+
  private:
   friend ConcurrentMessageLoop;
 
@@ -11,6 +11,8 @@
 
 #ifdef FML_OS_ANDROID
 #include "flutter/fml/platform/android/cpu_affinity.h"
+#elif defined(FML_OS_LINUX)
+#include "flutter/fml/platform/linux/cpu_affinity.h"
 #endif  // FML_OS_ANDROID
 
 namespace fml {
@@ -18,6 +20,8 @@ namespace fml {
 std::optional<size_t> EfficiencyCoreCount() {
 #ifdef FML_OS_ANDROID
   return AndroidEfficiencyCoreCount();
+#elif defined(FML_OS_LINUX)
+  return LinuxEfficiencyCoreCount();
 #else
   return std::nullopt;
 #endif
@@ -26,6 +30,8 @@ std::optional<size_t> EfficiencyCoreCount() {
 bool RequestAffinity(CpuAffinity affinity) {
 #ifdef FML_OS_ANDROID
   return AndroidRequestAffinity(affinity);
+#elif defined(FML_OS_LINUX)
+  return LinuxRequestAffinity(affinity);
 #else
   return true;
 #endif
@@ -326,6 +326,42 @@ TEST(FileTest, MappingDontNeedSafeTest) {
   ASSERT_TRUE(fml::UnlinkFile(dir.fd(), "my_contents"));
 }
 
+TEST(FileTest, MappingAdviseTest) {
+  fml::ScopedTemporaryDirectory dir;
+
+  {
+    auto file = fml::OpenFile(dir.fd(), "my_contents", true,
+                              fml::FilePermission::kReadWrite);
+    WriteStringToFile(file, "some content");
+  }
+
+  {
+    auto file = fml::OpenFile(dir.fd(), "my_contents", false,
+                              fml::FilePermission::kRead);
+    fml::FileMapping mapping(file);
+    ASSERT_TRUE(mapping.IsValid());
+    // Hints are advisory; success is expected for a valid mapping but the
+    // contents must remain readable either way.
+    mapping.Advise(fml::FileMapping::Advice::kWillNeed);
+    mapping.Advise(fml::FileMapping::Advice::kSequential);
+    ASSERT_EQ(std::string(reinterpret_cast<const char*>(mapping.GetMapping()),
+                          mapping.GetSize()),
+              "some content");
+  }
+
+  {
+    // Advising an empty mapping reports failure without crashing.
+    auto file = fml::OpenFile(dir.fd(), "empty_contents", true,
+                              fml::FilePermission::kReadWrite);
+    fml::FileMapping mapping(file);
+    ASSERT_TRUE(mapping.IsValid());
+    ASSERT_FALSE(mapping.Advise(fml::FileMapping::Advice::kWillNeed));
+    ASSERT_TRUE(fml::UnlinkFile(dir.fd(), "empty_contents"));
+  }
+
+  ASSERT_TRUE(fml::UnlinkFile(dir.fd(), "my_contents"));
+}
+
 TEST(FileTest, FileTestsWork) {
   fml::ScopedTemporaryDirectory dir;
   ASSERT_TRUE(dir.fd().is_valid());
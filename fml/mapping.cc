@@ -9,6 +9,8 @@
 #include <memory>
 #include <sstream>
 
+#include "flutter/fml/allocation_metrics.h"
+
 namespace fml {
 
 // FileMapping
@@ -38,6 +40,7 @@ std::unique_ptr<FileMapping> FileMapping::CreateReadOnly(
     return nullptr;
   }
 
+  AllocationMetrics::RecordAllocation(mapping->GetSize(), "fml mappings");
   return mapping;
 }
 
@@ -63,15 +66,20 @@ std::unique_ptr<FileMapping> FileMapping::CreateReadExecute(
     return nullptr;
   }
 
+  AllocationMetrics::RecordAllocation(mapping->GetSize(), "fml mappings");
   return mapping;
 }
 
 // Data Mapping
 
-DataMapping::DataMapping(std::vector<uint8_t> data) : data_(std::move(data)) {}
+DataMapping::DataMapping(std::vector<uint8_t> data) : data_(std::move(data)) {
+  AllocationMetrics::RecordAllocation(data_.size(), "fml mappings");
+}
 
 DataMapping::DataMapping(const std::string& string)
-    : data_(string.begin(), string.end()) {}
+    : data_(string.begin(), string.end()) {
+  AllocationMetrics::RecordAllocation(data_.size(), "fml mappings");
+}
 
 DataMapping::~DataMapping() = default;
 
@@ -133,6 +141,7 @@ MallocMapping::~MallocMapping() {
 }
 
 MallocMapping MallocMapping::Copy(const void* begin, size_t length) {
+  AllocationMetrics::RecordAllocation(length, "fml mappings");
   auto result =
       MallocMapping(reinterpret_cast<uint8_t*>(malloc(length)), length);
   FML_CHECK(result.GetMapping() != nullptr);
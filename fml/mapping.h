@@ -44,6 +44,19 @@ class FileMapping final : public Mapping {
     kExecute,
   };
 
+  /// Access-pattern hints forwarded to the kernel via madvise (or the
+  /// platform equivalent).
+  enum class Advice {
+    kNormal,
+    kRandom,
+    kSequential,
+    /// Asks the kernel to asynchronously prefetch the mapped pages ahead of
+    /// first use. Useful for snapshot and asset mappings that are about to
+    /// be read in their entirety, where demand paging would otherwise stall
+    /// startup on a page fault per 4KB read.
+    kWillNeed,
+  };
+
   explicit FileMapping(const fml::UniqueFD& fd,
                        std::initializer_list<Protection> protection = {
                            Protection::kRead});
@@ -76,6 +89,11 @@ class FileMapping final : public Mapping {
 
   bool IsValid() const;
 
+  /// Applies the given access-pattern hint to the entire mapping. Returns
+  /// true if the hint was accepted by the kernel. Hints are advisory only;
+  /// failure is not fatal and callers need not check the result.
+  bool Advise(Advice advice);
+
  private:
   bool valid_ = false;
   size_t size_ = 0;
@@ -64,6 +64,16 @@ void MessageLoopImpl::PostTask(const fml::closure& task,
   task_queue_->RegisterTask(queue_id_, task, target_time);
 }
 
+void MessageLoopImpl::PostTaskBatch(const std::vector<fml::closure>& tasks,
+                                    fml::TimePoint target_time) {
+  if (terminated_) {
+    // If the message loop has already been terminated, PostTaskBatch should
+    // destruct |tasks| synchronously within this function.
+    return;
+  }
+  task_queue_->RegisterTasks(queue_id_, tasks, target_time);
+}
+
 void MessageLoopImpl::AddTaskObserver(intptr_t key,
                                       const fml::closure& callback) {
   FML_DCHECK(callback != nullptr);
@@ -41,6 +41,9 @@ class MessageLoopImpl : public Wakeable,
 
   void PostTask(const fml::closure& task, fml::TimePoint target_time);
 
+  void PostTaskBatch(const std::vector<fml::closure>& tasks,
+                     fml::TimePoint target_time);
+
   void AddTaskObserver(intptr_t key, const fml::closure& callback);
 
   void RemoveTaskObserver(intptr_t key);
@@ -40,6 +40,7 @@ TaskQueueEntry::TaskQueueEntry(TaskQueueId created_for_arg)
   wakeable = NULL;
   task_observers = TaskObservers();
   task_source = std::make_unique<TaskSource>(created_for);
+  immediate_task_ring = std::make_unique<MpscTaskRing>();
 }
 
 MessageLoopTaskQueues* MessageLoopTaskQueues::GetInstance() {
@@ -48,6 +49,7 @@ MessageLoopTaskQueues* MessageLoopTaskQueues::GetInstance() {
 }
 
 TaskQueueId MessageLoopTaskQueues::CreateTaskQueue() {
+  fml::UniqueLock entries_lock(*entries_mutex_);
   std::lock_guard guard(queue_mutex_);
   TaskQueueId loop_id = TaskQueueId(task_queue_id_counter_);
   ++task_queue_id_counter_;
@@ -56,7 +58,9 @@ TaskQueueId MessageLoopTaskQueues::CreateTaskQueue() {
 }
 
 MessageLoopTaskQueues::MessageLoopTaskQueues()
-    : task_queue_id_counter_(0), order_(0) {
+    : entries_mutex_(fml::SharedMutex::Create("MessageLoopTaskQueues")),
+      task_queue_id_counter_(0),
+      order_(0) {
   tls_task_source_grade.reset(
       new TaskSourceGradeHolder{TaskSourceGrade::kUnspecified});
 }
@@ -64,6 +68,7 @@ MessageLoopTaskQueues::MessageLoopTaskQueues()
 MessageLoopTaskQueues::~MessageLoopTaskQueues() = default;
 
 void MessageLoopTaskQueues::Dispose(TaskQueueId queue_id) {
+  fml::UniqueLock entries_lock(*entries_mutex_);
   std::lock_guard guard(queue_mutex_);
   const auto& queue_entry = queue_entries_.at(queue_id);
   FML_DCHECK(queue_entry->subsumed_by == kUnmerged);
@@ -79,6 +84,7 @@ void MessageLoopTaskQueues::DisposeTasks(TaskQueueId queue_id) {
   std::lock_guard guard(queue_mutex_);
   const auto& queue_entry = queue_entries_.at(queue_id);
   FML_DCHECK(queue_entry->subsumed_by == kUnmerged);
+  FlushImmediateTasksUnlocked(queue_id);
   auto& subsumed_set = queue_entry->owner_of;
   queue_entry->task_source->ShutDown();
   for (auto& subsumed : subsumed_set) {
@@ -90,13 +96,60 @@ TaskSourceGrade MessageLoopTaskQueues::GetCurrentTaskSourceGrade() {
   return tls_task_source_grade.get()->task_source_grade;
 }
 
+bool MessageLoopTaskQueues::TryRegisterTaskLockFree(TaskQueueId queue_id,
+                                                    size_t order,
+                                                    const fml::closure& task,
+                                                    fml::TimePoint target_time) {
+  fml::SharedLock entries_lock(*entries_mutex_);
+  auto found = queue_entries_.find(queue_id);
+  if (found == queue_entries_.end()) {
+    return false;
+  }
+  const auto& queue_entry = found->second;
+  // Merged queues need to resolve the loop to wake under the full lock.
+  if (queue_entry->subsumed_by != kUnmerged || !queue_entry->owner_of.empty()) {
+    return false;
+  }
+  if (!queue_entry->immediate_task_ring->TryPush(order, task, target_time)) {
+    return false;
+  }
+  // The wakeable is set at most once (enforced by SetWakeable) and writers
+  // hold |entries_mutex_| exclusively, so this read is synchronized. An
+  // immediate task can always wake at its own target time: it is never later
+  // than any pending wake.
+  if (queue_entry->wakeable) {
+    queue_entry->wakeable->WakeUp(target_time);
+  }
+  return true;
+}
+
+void MessageLoopTaskQueues::FlushImmediateTasksUnlocked(TaskQueueId queue_id) {
+  const auto& entry = queue_entries_.at(queue_id);
+  auto flush_ring = [](TaskQueueEntry& target) {
+    target.immediate_task_ring->Drain([&target](MpscTaskRing::Entry& ring_entry) {
+      target.task_source->RegisterTask({ring_entry.order, ring_entry.task,
+                                        ring_entry.target_time,
+                                        TaskSourceGrade::kUnspecified});
+    });
+  };
+  flush_ring(*entry);
+  for (TaskQueueId subsumed : entry->owner_of) {
+    flush_ring(*queue_entries_.at(subsumed));
+  }
+}
+
 void MessageLoopTaskQueues::RegisterTask(
     TaskQueueId queue_id,
     const fml::closure& task,
     fml::TimePoint target_time,
     fml::TaskSourceGrade task_source_grade) {
-  std::lock_guard guard(queue_mutex_);
   size_t order = order_++;
+  if (task_source_grade == TaskSourceGrade::kUnspecified &&
+      target_time <= fml::TimePoint::Now() &&
+      TryRegisterTaskLockFree(queue_id, order, task, target_time)) {
+    return;
+  }
+  std::lock_guard guard(queue_mutex_);
   const auto& queue_entry = queue_entries_.at(queue_id);
   queue_entry->task_source->RegisterTask(
       {order, task, target_time, task_source_grade});
@@ -105,6 +158,37 @@ void MessageLoopTaskQueues::RegisterTask(
     loop_to_wake = queue_entry->subsumed_by;
   }
 
+  FlushImmediateTasksUnlocked(loop_to_wake);
+
+  // This can happen when the secondary tasks are paused.
+  if (HasPendingTasksUnlocked(loop_to_wake)) {
+    WakeUpUnlocked(loop_to_wake, GetNextWakeTimeUnlocked(loop_to_wake));
+  }
+}
+
+void MessageLoopTaskQueues::RegisterTasks(
+    TaskQueueId queue_id,
+    const std::vector<fml::closure>& tasks,
+    fml::TimePoint target_time,
+    fml::TaskSourceGrade task_source_grade) {
+  if (tasks.empty()) {
+    return;
+  }
+  std::lock_guard guard(queue_mutex_);
+  const auto& queue_entry = queue_entries_.at(queue_id);
+  for (const auto& task : tasks) {
+    FML_DCHECK(task != nullptr);
+    size_t order = order_++;
+    queue_entry->task_source->RegisterTask(
+        {order, task, target_time, task_source_grade});
+  }
+  TaskQueueId loop_to_wake = queue_id;
+  if (queue_entry->subsumed_by != kUnmerged) {
+    loop_to_wake = queue_entry->subsumed_by;
+  }
+
+  FlushImmediateTasksUnlocked(loop_to_wake);
+
   // This can happen when the secondary tasks are paused.
   if (HasPendingTasksUnlocked(loop_to_wake)) {
     WakeUpUnlocked(loop_to_wake, GetNextWakeTimeUnlocked(loop_to_wake));
@@ -119,6 +203,7 @@ bool MessageLoopTaskQueues::HasPendingTasks(TaskQueueId queue_id) const {
 fml::closure MessageLoopTaskQueues::GetNextTaskToRun(TaskQueueId queue_id,
                                                      fml::TimePoint from_time) {
   std::lock_guard guard(queue_mutex_);
+  FlushImmediateTasksUnlocked(queue_id);
   if (!HasPendingTasksUnlocked(queue_id)) {
     return nullptr;
   }
@@ -157,11 +242,13 @@ size_t MessageLoopTaskQueues::GetNumPendingTasks(TaskQueueId queue_id) const {
 
   size_t total_tasks = 0;
   total_tasks += queue_entry->task_source->GetNumPendingTasks();
+  total_tasks += queue_entry->immediate_task_ring->GetCount();
 
   auto& subsumed_set = queue_entry->owner_of;
   for (auto& subsumed : subsumed_set) {
     const auto& subsumed_entry = queue_entries_.at(subsumed);
     total_tasks += subsumed_entry->task_source->GetNumPendingTasks();
+    total_tasks += subsumed_entry->immediate_task_ring->GetCount();
   }
   return total_tasks;
 }
@@ -205,6 +292,7 @@ std::vector<fml::closure> MessageLoopTaskQueues::GetObserversToNotify(
 
 void MessageLoopTaskQueues::SetWakeable(TaskQueueId queue_id,
                                         fml::Wakeable* wakeable) {
+  fml::UniqueLock entries_lock(*entries_mutex_);
   std::lock_guard guard(queue_mutex_);
   FML_CHECK(!queue_entries_.at(queue_id)->wakeable)
       << "Wakeable can only be set once.";
@@ -215,6 +303,7 @@ bool MessageLoopTaskQueues::Merge(TaskQueueId owner, TaskQueueId subsumed) {
   if (owner == subsumed) {
     return true;
   }
+  fml::UniqueLock entries_lock(*entries_mutex_);
   std::lock_guard guard(queue_mutex_);
   auto& owner_entry = queue_entries_.at(owner);
   auto& subsumed_entry = queue_entries_.at(subsumed);
@@ -255,6 +344,8 @@ bool MessageLoopTaskQueues::Merge(TaskQueueId owner, TaskQueueId subsumed) {
   owner_entry->owner_of.insert(subsumed);
   subsumed_entry->subsumed_by = owner;
 
+  FlushImmediateTasksUnlocked(owner);
+
   if (HasPendingTasksUnlocked(owner)) {
     WakeUpUnlocked(owner, GetNextWakeTimeUnlocked(owner));
   }
@@ -263,6 +354,7 @@ bool MessageLoopTaskQueues::Merge(TaskQueueId owner, TaskQueueId subsumed) {
 }
 
 bool MessageLoopTaskQueues::Unmerge(TaskQueueId owner, TaskQueueId subsumed) {
+  fml::UniqueLock entries_lock(*entries_mutex_);
   std::lock_guard guard(queue_mutex_);
   const auto& owner_entry = queue_entries_.at(owner);
   if (owner_entry->owner_of.empty()) {
@@ -294,6 +386,9 @@ bool MessageLoopTaskQueues::Unmerge(TaskQueueId owner, TaskQueueId subsumed) {
   queue_entries_.at(subsumed)->subsumed_by = kUnmerged;
   owner_entry->owner_of.erase(subsumed);
 
+  FlushImmediateTasksUnlocked(owner);
+  FlushImmediateTasksUnlocked(subsumed);
+
   if (HasPendingTasksUnlocked(owner)) {
     WakeUpUnlocked(owner, GetNextWakeTimeUnlocked(owner));
   }
@@ -329,6 +424,7 @@ void MessageLoopTaskQueues::PauseSecondarySource(TaskQueueId queue_id) {
 void MessageLoopTaskQueues::ResumeSecondarySource(TaskQueueId queue_id) {
   std::lock_guard guard(queue_mutex_);
   queue_entries_.at(queue_id)->task_source->ResumeSecondary();
+  FlushImmediateTasksUnlocked(queue_id);
   // Schedule a wake as needed.
   if (HasPendingTasksUnlocked(queue_id)) {
     WakeUpUnlocked(queue_id, GetNextWakeTimeUnlocked(queue_id));
@@ -345,25 +441,32 @@ bool MessageLoopTaskQueues::HasPendingTasksUnlocked(
     return false;
   }
 
-  if (!entry->task_source->IsEmpty()) {
+  if (!entry->task_source->IsEmpty() ||
+      !entry->immediate_task_ring->IsEmpty()) {
     return true;
   }
 
   auto& subsumed_set = entry->owner_of;
   return std::any_of(
       subsumed_set.begin(), subsumed_set.end(), [&](const auto& subsumed) {
-        return !queue_entries_.at(subsumed)->task_source->IsEmpty();
+        const auto& subsumed_entry = queue_entries_.at(subsumed);
+        return !subsumed_entry->task_source->IsEmpty() ||
+               !subsumed_entry->immediate_task_ring->IsEmpty();
       });
 }
 
 fml::TimePoint MessageLoopTaskQueues::GetNextWakeTimeUnlocked(
-    TaskQueueId queue_id) const {
+    TaskQueueId queue_id) {
   return PeekNextTaskUnlocked(queue_id).task.GetTargetTime();
 }
 
 TaskSource::TopTask MessageLoopTaskQueues::PeekNextTaskUnlocked(
-    TaskQueueId owner) const {
+    TaskQueueId owner) {
   FML_DCHECK(HasPendingTasksUnlocked(owner));
+  // A lock-free producer may have pushed onto the ring after the caller's
+  // flush: |HasPendingTasksUnlocked| counts ring entries, so flush again here
+  // to guarantee the task sources reflect everything the check observed.
+  FlushImmediateTasksUnlocked(owner);
   const auto& entry = queue_entries_.at(owner);
   if (entry->owner_of.empty()) {
     FML_CHECK(!entry->task_source->IsEmpty());
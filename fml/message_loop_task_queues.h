@@ -15,6 +15,7 @@
 #include "flutter/fml/delayed_task.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/ref_counted.h"
+#include "flutter/fml/mpsc_task_ring.h"
 #include "flutter/fml/synchronization/shared_mutex.h"
 #include "flutter/fml/task_queue_id.h"
 #include "flutter/fml/task_source.h"
@@ -36,6 +37,11 @@ class TaskQueueEntry {
   TaskObservers task_observers;
   std::unique_ptr<TaskSource> task_source;
 
+  /// Lock-free fast path for non-delayed, unspecified-grade tasks posted from
+  /// other threads. Drained into |task_source| by the dispatcher under the
+  /// queue mutex before tasks are peeked or popped.
+  std::unique_ptr<MpscTaskRing> immediate_task_ring;
+
   /// Set of the TaskQueueIds which is owned by this TaskQueue. If the set is
   /// empty, this TaskQueue does not own any other TaskQueues.
   std::set<TaskQueueId> owner_of;
@@ -83,6 +89,15 @@ class MessageLoopTaskQueues {
                     fml::TaskSourceGrade task_source_grade =
                         fml::TaskSourceGrade::kUnspecified);
 
+  /// Registers all of |tasks| under a single lock acquisition with a single
+  /// wake-up, preserving the order of the vector. Cheaper than N calls to
+  /// RegisterTask when posting task batches across threads.
+  void RegisterTasks(TaskQueueId queue_id,
+                     const std::vector<fml::closure>& tasks,
+                     fml::TimePoint target_time,
+                     fml::TaskSourceGrade task_source_grade =
+                         fml::TaskSourceGrade::kUnspecified);
+
   bool HasPendingTasks(TaskQueueId queue_id) const;
 
   fml::closure GetNextTaskToRun(TaskQueueId queue_id, fml::TimePoint from_time);
@@ -146,13 +161,35 @@ class MessageLoopTaskQueues {
 
   void WakeUpUnlocked(TaskQueueId queue_id, fml::TimePoint time) const;
 
+  /// Attempts to register a non-delayed, unspecified-grade task on the
+  /// per-queue MPSC ring without acquiring |queue_mutex_|. Returns false if
+  /// the fast path is unavailable (ring full, queue merged or disposed) and
+  /// the caller must use the locked path.
+  bool TryRegisterTaskLockFree(TaskQueueId queue_id,
+                               size_t order,
+                               const fml::closure& task,
+                               fml::TimePoint target_time);
+
+  /// Moves all ring tasks for |queue_id| (and any queues it subsumes) into
+  /// their task sources. Must be called with |queue_mutex_| held before
+  /// peeking or popping tasks.
+  void FlushImmediateTasksUnlocked(TaskQueueId queue_id);
+
   bool HasPendingTasksUnlocked(TaskQueueId queue_id) const;
 
-  TaskSource::TopTask PeekNextTaskUnlocked(TaskQueueId owner) const;
+  TaskSource::TopTask PeekNextTaskUnlocked(TaskQueueId owner);
 
-  fml::TimePoint GetNextWakeTimeUnlocked(TaskQueueId queue_id) const;
+  fml::TimePoint GetNextWakeTimeUnlocked(TaskQueueId queue_id);
 
   mutable std::mutex queue_mutex_;
+
+  /// Guards the structure of |queue_entries_| and the merge state of each
+  /// entry against the lock-free producer path. Writers (create, dispose,
+  /// merge, unmerge, set-wakeable) hold this exclusively in addition to
+  /// |queue_mutex_|; ring producers hold it shared. Always acquired before
+  /// |queue_mutex_| when both are taken.
+  std::unique_ptr<fml::SharedMutex> entries_mutex_;
+
   std::map<TaskQueueId, std::unique_ptr<TaskQueueEntry>> queue_entries_;
 
   size_t task_queue_id_counter_ = 0;
@@ -66,5 +66,57 @@ static void BM_RegisterAndGetTasks(benchmark::State& state) {  // NOLINT
 
 BENCHMARK(BM_RegisterAndGetTasks);
 
+// Many producer threads hammering a single task queue with immediate tasks,
+// modeling cross-thread PostTask storms onto the UI TaskRunner. This
+// exercises the lock-free MPSC ring fast path in RegisterTask.
+static void BM_RegisterTasksContended(benchmark::State& state) {  // NOLINT
+  auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
+  auto queue_id = task_queue->CreateTaskQueue();
+
+  const int num_producers = 8;
+  const int num_tasks_per_producer = 500;
+
+  while (state.KeepRunning()) {
+    const fml::TimePoint past = fml::TimePoint::Now();
+
+    std::vector<std::thread> producers;
+    producers.reserve(num_producers);
+
+    CountDownLatch producers_ready(num_producers);
+    CountDownLatch producers_done(num_producers);
+
+    for (int i = 0; i < num_producers; i++) {
+      producers.emplace_back([&task_queue, queue_id, past, &producers_ready,
+                              &producers_done]() {
+        producers_ready.CountDown();
+        producers_ready.Wait();
+        for (int j = 0; j < num_tasks_per_producer; j++) {
+          task_queue->RegisterTask(queue_id, [] {}, past);
+        }
+        producers_done.CountDown();
+      });
+    }
+
+    producers_done.Wait();
+
+    int num_invocations = 0;
+    const auto now = fml::TimePoint::Now();
+    for (;;) {
+      fml::closure invocation = task_queue->GetNextTaskToRun(queue_id, now);
+      if (!invocation) {
+        break;
+      }
+      num_invocations++;
+    }
+    assert(num_invocations == num_producers * num_tasks_per_producer);
+
+    for (auto& producer : producers) {
+      producer.join();
+    }
+  }
+}
+
+BENCHMARK(BM_RegisterTasksContended);
+
 }  // namespace benchmarking
 }  // namespace fml
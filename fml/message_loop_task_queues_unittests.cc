@@ -7,6 +7,7 @@
 #include "flutter/fml/message_loop_task_queues.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <thread>
 #include <utility>
@@ -52,6 +53,31 @@ TEST(MessageLoopTaskQueue, RegisterOneTask) {
   ASSERT_TRUE(task_queue->GetNumPendingTasks(queue_id) == 1);
 }
 
+TEST(MessageLoopTaskQueue, RegisterTaskBatchWakesOnce) {
+  auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
+  auto queue_id = task_queue->CreateTaskQueue();
+  int wake_count = 0;
+  auto wakeable = std::make_unique<TestWakeable>(
+      [&wake_count](fml::TimePoint wake_time) { wake_count++; });
+  task_queue->SetWakeable(queue_id, wakeable.get());
+
+  std::vector<fml::closure> batch;
+  std::vector<int> ran;
+  for (int i = 0; i < 10; i++) {
+    batch.push_back([i, &ran]() { ran.push_back(i); });
+  }
+  task_queue->RegisterTasks(queue_id, batch, ChronoTicksSinceEpoch());
+  ASSERT_EQ(wake_count, 1);
+  ASSERT_EQ(task_queue->GetNumPendingTasks(queue_id), 10u);
+
+  const auto now = ChronoTicksSinceEpoch();
+  while (auto invocation = task_queue->GetNextTaskToRun(queue_id, now)) {
+    invocation();
+  }
+  ASSERT_EQ(ran.size(), 10u);
+  ASSERT_TRUE(std::is_sorted(ran.begin(), ran.end()));
+}
+
 TEST(MessageLoopTaskQueue, RegisterTwoTasksAndCount) {
   auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
   auto queue_id = task_queue->CreateTaskQueue();
@@ -413,6 +439,45 @@ TEST(MessageLoopTaskQueue, ConcurrentQueueAndTaskCreatingCounts) {
   ASSERT_EQ(pending_tasks, kThreadCount * kThreadTaskCount);
 }
 
+TEST(MessageLoopTaskQueue, ConcurrentLockFreeProducersWithDrainingConsumer) {
+  auto task_queues = fml::MessageLoopTaskQueues::GetInstance();
+  auto queue_id = task_queues->CreateTaskQueue();
+
+  constexpr size_t kProducerCount = 4;
+  constexpr size_t kTasksPerProducer = 2000;
+
+  std::atomic_size_t executed_count = 0;
+
+  // Already-due tasks with the default grade take the lock-free ring fast
+  // path, racing pushes against the consumer's check-then-peek sequence in
+  // GetNextTaskToRun.
+  auto producer_main = [&]() {
+    for (size_t i = 0; i < kTasksPerProducer; i++) {
+      task_queues->RegisterTask(
+          queue_id, [&executed_count] { executed_count++; },
+          ChronoTicksSinceEpoch());
+    }
+  };
+
+  std::vector<std::thread> producers;
+  for (size_t i = 0; i < kProducerCount; i++) {
+    producers.emplace_back(producer_main);
+  }
+
+  while (executed_count < kProducerCount * kTasksPerProducer) {
+    if (auto invocation =
+            task_queues->GetNextTaskToRun(queue_id, fml::TimePoint::Max())) {
+      invocation();
+    }
+  }
+
+  for (auto& producer : producers) {
+    producer.join();
+  }
+
+  ASSERT_FALSE(task_queues->HasPendingTasks(queue_id));
+}
+
 TEST(MessageLoopTaskQueue, RegisterTaskWakesUpOwnerQueue) {
   auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
   auto platform_queue = task_queue->CreateTaskQueue();
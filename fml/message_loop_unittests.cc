@@ -6,6 +6,7 @@
 
 #include "flutter/fml/message_loop.h"
 
+#include <algorithm>
 #include <iostream>
 #include <thread>
 
@@ -212,3 +213,89 @@ TEST(MessageLoop, CanCreateConcurrentMessageLoop) {
   latch.Wait();
   ASSERT_GE(thread_ids.size(), 1u);
 }
+
+TEST(MessageLoop, ConcurrentMessageLoopServicesHigherPriorityLanesFirst) {
+  // A single worker makes the pop order deterministic.
+  auto loop = fml::ConcurrentMessageLoop::Create(1u);
+  auto task_runner = loop->GetTaskRunner();
+
+  fml::AutoResetWaitableEvent blocker;
+  std::mutex order_mutex;
+  std::vector<std::string> order;
+  constexpr size_t kBackgroundCount = 4;
+  fml::CountDownLatch done(kBackgroundCount + 1);
+
+  // Occupy the worker so the remaining posts pile up in the lanes.
+  task_runner->PostTask([&]() { blocker.Wait(); });
+  for (size_t i = 0; i < kBackgroundCount; ++i) {
+    task_runner->PostTask(
+        [&]() {
+          {
+            std::scoped_lock lock(order_mutex);
+            order.emplace_back("background");
+          }
+          done.CountDown();
+        },
+        fml::TaskPriority::kBackground);
+  }
+  task_runner->PostTask(
+      [&]() {
+        {
+          std::scoped_lock lock(order_mutex);
+          order.emplace_back("critical");
+        }
+        done.CountDown();
+      },
+      fml::TaskPriority::kFrameCritical);
+
+  blocker.Signal();
+  done.Wait();
+
+  // The frame-critical task was posted last but must run first.
+  std::scoped_lock lock(order_mutex);
+  ASSERT_EQ(order.size(), kBackgroundCount + 1);
+  ASSERT_EQ(order.front(), "critical");
+}
+
+TEST(MessageLoop, ConcurrentMessageLoopDoesNotStarveLowerLanes) {
+  auto loop = fml::ConcurrentMessageLoop::Create(1u);
+  auto task_runner = loop->GetTaskRunner();
+
+  fml::AutoResetWaitableEvent blocker;
+  std::mutex order_mutex;
+  std::vector<std::string> order;
+  constexpr size_t kCriticalCount = 20;
+  fml::CountDownLatch done(kCriticalCount + 1);
+
+  task_runner->PostTask([&]() { blocker.Wait(); });
+  for (size_t i = 0; i < kCriticalCount; ++i) {
+    task_runner->PostTask(
+        [&]() {
+          {
+            std::scoped_lock lock(order_mutex);
+            order.emplace_back("critical");
+          }
+          done.CountDown();
+        },
+        fml::TaskPriority::kFrameCritical);
+  }
+  task_runner->PostTask(
+      [&]() {
+        {
+          std::scoped_lock lock(order_mutex);
+          order.emplace_back("background");
+        }
+        done.CountDown();
+      },
+      fml::TaskPriority::kBackground);
+
+  blocker.Signal();
+  done.Wait();
+
+  // The rotation must service the background task before the frame-critical
+  // backlog is fully drained.
+  std::scoped_lock lock(order_mutex);
+  const auto found = std::find(order.begin(), order.end(), "background");
+  ASSERT_NE(found, order.end());
+  ASSERT_LT(static_cast<size_t>(found - order.begin()), kCriticalCount);
+}
@@ -0,0 +1,85 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/mpsc_task_ring.h"
+
+#include "flutter/fml/logging.h"
+
+namespace fml {
+
+MpscTaskRing::MpscTaskRing(size_t capacity)
+    : capacity_(capacity),
+      mask_(capacity - 1),
+      slots_(std::make_unique<Slot[]>(capacity)),
+      enqueue_pos_(0),
+      dequeue_pos_(0) {
+  FML_CHECK((capacity >= 2) && ((capacity & (capacity - 1)) == 0))
+      << "MpscTaskRing capacity must be a power of two.";
+  for (size_t i = 0; i < capacity_; i++) {
+    slots_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+MpscTaskRing::~MpscTaskRing() = default;
+
+bool MpscTaskRing::TryPush(size_t order,
+                           const fml::closure& task,
+                           fml::TimePoint target_time) {
+  size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  for (;;) {
+    Slot& slot = slots_[pos & mask_];
+    size_t sequence = slot.sequence.load(std::memory_order_acquire);
+    intptr_t difference =
+        static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+    if (difference == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        slot.entry.order = order;
+        slot.entry.task = task;
+        slot.entry.target_time = target_time;
+        slot.sequence.store(pos + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (difference < 0) {
+      // The slot one lap behind has not been consumed: the ring is full.
+      return false;
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+void MpscTaskRing::Drain(const std::function<void(Entry&)>& visitor) {
+  size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+  for (;;) {
+    Slot& slot = slots_[pos & mask_];
+    size_t sequence = slot.sequence.load(std::memory_order_acquire);
+    intptr_t difference =
+        static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+    if (difference != 0) {
+      // Either empty, or a producer has claimed the slot but not yet
+      // published it. In both cases the drain stops here; the producer's
+      // wake-up will trigger another drain.
+      break;
+    }
+    visitor(slot.entry);
+    slot.entry.task = nullptr;
+    slot.sequence.store(pos + capacity_, std::memory_order_release);
+    pos++;
+  }
+  dequeue_pos_.store(pos, std::memory_order_relaxed);
+}
+
+bool MpscTaskRing::IsEmpty() const {
+  return dequeue_pos_.load(std::memory_order_acquire) ==
+         enqueue_pos_.load(std::memory_order_acquire);
+}
+
+size_t MpscTaskRing::GetCount() const {
+  size_t dequeue = dequeue_pos_.load(std::memory_order_acquire);
+  size_t enqueue = enqueue_pos_.load(std::memory_order_acquire);
+  return enqueue >= dequeue ? enqueue - dequeue : 0;
+}
+
+}  // namespace fml
@@ -0,0 +1,79 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_MPSC_TASK_RING_H_
+#define FLUTTER_FML_MPSC_TASK_RING_H_
+
+#include <atomic>
+#include <functional>
+#include <memory>
+
+#include "flutter/fml/closure.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace fml {
+
+/// A bounded, lock-free, multi-producer single-consumer ring buffer of
+/// immediate tasks.
+///
+/// This is the fast path used by `MessageLoopTaskQueues` for non-delayed,
+/// unspecified-grade tasks: any number of producer threads may `TryPush`
+/// concurrently without taking the global queue mutex, while the consumer
+/// (the dispatcher, holding the queue mutex) periodically drains the ring
+/// into the `TaskSource` via `Drain`.
+///
+/// The implementation uses per-slot sequence numbers (a bounded Vyukov
+/// queue). `TryPush` returns false when the ring is full; callers are
+/// expected to fall back to the locked path in that case, so the ring never
+/// blocks and never drops tasks.
+class MpscTaskRing {
+ public:
+  static constexpr size_t kDefaultCapacity = 512;
+
+  struct Entry {
+    size_t order = 0;
+    fml::closure task;
+    fml::TimePoint target_time;
+  };
+
+  /// Constructs a ring with the given capacity, which must be a power of two.
+  explicit MpscTaskRing(size_t capacity = kDefaultCapacity);
+
+  ~MpscTaskRing();
+
+  /// Attempts to enqueue a task without blocking. May be called from any
+  /// number of threads concurrently. Returns false if the ring is full.
+  bool TryPush(size_t order, const fml::closure& task, fml::TimePoint target_time);
+
+  /// Pops all currently enqueued tasks in FIFO order, invoking |visitor| for
+  /// each. Must only be called from one thread at a time (the dispatcher,
+  /// holding the queue mutex).
+  void Drain(const std::function<void(Entry&)>& visitor);
+
+  /// Returns true if no tasks are enqueued. Safe to call from any thread,
+  /// though the answer may be stale by the time it is observed.
+  bool IsEmpty() const;
+
+  /// Returns the approximate number of enqueued tasks.
+  size_t GetCount() const;
+
+ private:
+  struct Slot {
+    std::atomic<size_t> sequence;
+    Entry entry;
+  };
+
+  const size_t capacity_;
+  const size_t mask_;
+  std::unique_ptr<Slot[]> slots_;
+  alignas(64) std::atomic<size_t> enqueue_pos_;
+  alignas(64) std::atomic<size_t> dequeue_pos_;
+
+  FML_DISALLOW_COPY_ASSIGN_AND_MOVE(MpscTaskRing);
+};
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_MPSC_TASK_RING_H_
@@ -0,0 +1,78 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/mpsc_task_ring.h"
+
+#include <thread>
+#include <vector>
+
+#include "flutter/fml/synchronization/count_down_latch.h"
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace testing {
+
+TEST(MpscTaskRing, StartsEmpty) {
+  MpscTaskRing ring;
+  ASSERT_TRUE(ring.IsEmpty());
+  ASSERT_EQ(ring.GetCount(), 0u);
+}
+
+TEST(MpscTaskRing, DrainsInFifoOrder) {
+  MpscTaskRing ring;
+  const auto now = fml::TimePoint::Now();
+  for (size_t i = 0; i < 10; i++) {
+    ASSERT_TRUE(ring.TryPush(i, [] {}, now));
+  }
+  ASSERT_EQ(ring.GetCount(), 10u);
+  size_t expected_order = 0;
+  ring.Drain([&expected_order](MpscTaskRing::Entry& entry) {
+    ASSERT_EQ(entry.order, expected_order);
+    expected_order++;
+  });
+  ASSERT_EQ(expected_order, 10u);
+  ASSERT_TRUE(ring.IsEmpty());
+}
+
+TEST(MpscTaskRing, RejectsPushWhenFull) {
+  MpscTaskRing ring(4);
+  const auto now = fml::TimePoint::Now();
+  for (size_t i = 0; i < 4; i++) {
+    ASSERT_TRUE(ring.TryPush(i, [] {}, now));
+  }
+  ASSERT_FALSE(ring.TryPush(4, [] {}, now));
+  ring.Drain([](MpscTaskRing::Entry& entry) {});
+  ASSERT_TRUE(ring.TryPush(5, [] {}, now));
+}
+
+TEST(MpscTaskRing, ConcurrentProducersAreAllObserved) {
+  MpscTaskRing ring(1024);
+  const auto now = fml::TimePoint::Now();
+  const size_t num_producers = 4;
+  const size_t tasks_per_producer = 100;
+
+  CountDownLatch ready(num_producers);
+  std::vector<std::thread> producers;
+  producers.reserve(num_producers);
+  for (size_t i = 0; i < num_producers; i++) {
+    producers.emplace_back([&ring, &ready, now, i]() {
+      ready.CountDown();
+      ready.Wait();
+      for (size_t j = 0; j < tasks_per_producer; j++) {
+        ASSERT_TRUE(ring.TryPush(i * tasks_per_producer + j, [] {}, now));
+      }
+    });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+
+  size_t drained = 0;
+  ring.Drain([&drained](MpscTaskRing::Entry& entry) { drained++; });
+  ASSERT_EQ(drained, num_producers * tasks_per_producer);
+  ASSERT_TRUE(ring.IsEmpty());
+}
+
+}  // namespace testing
+}  // namespace fml
@@ -0,0 +1,71 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/platform/linux/cpu_affinity.h"
+
+#include <sched.h>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "flutter/fml/logging.h"
+
+namespace fml {
+
+/// The CPUSpeedTracker is initialized once the first time a thread affinity is
+/// requested.
+std::once_flag gLinuxCPUTrackerFlag;
+static CPUSpeedTracker* gLinuxCPUTracker;
+
+// For each CPU index provided, attempts to open the file
+// /sys/devices/system/cpu/cpu$NUM/cpufreq/cpuinfo_max_freq and parse a number
+// containing the CPU frequency.
+static void InitCPUInfo(size_t cpu_count) {
+  std::vector<CpuIndexAndSpeed> cpu_speeds;
+
+  for (auto i = 0u; i < cpu_count; i++) {
+    auto path = "/sys/devices/system/cpu/cpu" + std::to_string(i) +
+                "/cpufreq/cpuinfo_max_freq";
+    auto speed = ReadIntFromFile(path);
+    if (speed.has_value()) {
+      cpu_speeds.push_back({.index = i, .speed = speed.value()});
+    }
+  }
+  gLinuxCPUTracker = new CPUSpeedTracker(cpu_speeds);
+}
+
+static bool SetUpCPUTracker() {
+  // Populate CPU Info if uninitialized.
+  auto count = std::thread::hardware_concurrency();
+  std::call_once(gLinuxCPUTrackerFlag, [count]() { InitCPUInfo(count); });
+  if (gLinuxCPUTracker == nullptr || !gLinuxCPUTracker->IsValid()) {
+    return false;
+  }
+  return true;
+}
+
+std::optional<size_t> LinuxEfficiencyCoreCount() {
+  if (!SetUpCPUTracker()) {
+    return std::nullopt;
+  }
+  auto result = gLinuxCPUTracker->GetIndices(CpuAffinity::kEfficiency).size();
+  FML_DCHECK(result > 0);
+  return result;
+}
+
+bool LinuxRequestAffinity(CpuAffinity affinity) {
+  if (!SetUpCPUTracker()) {
+    return true;
+  }
+
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (const auto index : gLinuxCPUTracker->GetIndices(affinity)) {
+    CPU_SET(index, &set);
+  }
+  // Pid 0 applies the mask to the calling thread.
+  return sched_setaffinity(0, sizeof(set), &set) == 0;
+}
+
+}  // namespace fml
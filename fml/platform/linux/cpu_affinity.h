@@ -0,0 +1,17 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include "flutter/fml/cpu_affinity.h"
+
+namespace fml {
+
+/// @brief Linux specific implementation of EfficiencyCoreCount.
+std::optional<size_t> LinuxEfficiencyCoreCount();
+
+/// @brief Linux specific implementation of RequestAffinity.
+bool LinuxRequestAffinity(CpuAffinity affinity);
+
+}  // namespace fml
@@ -107,4 +107,26 @@ bool FileMapping::IsValid() const {
   return valid_;
 }
 
+bool FileMapping::Advise(Advice advice) {
+  if (mapping_ == nullptr || size_ == 0) {
+    return false;
+  }
+  int posix_advice = MADV_NORMAL;
+  switch (advice) {
+    case Advice::kNormal:
+      posix_advice = MADV_NORMAL;
+      break;
+    case Advice::kRandom:
+      posix_advice = MADV_RANDOM;
+      break;
+    case Advice::kSequential:
+      posix_advice = MADV_SEQUENTIAL;
+      break;
+    case Advice::kWillNeed:
+      posix_advice = MADV_WILLNEED;
+      break;
+  }
+  return ::madvise(mapping_, size_, posix_advice) == 0;
+}
+
 }  // namespace fml
@@ -5,26 +5,59 @@
 #include "flutter/fml/platform/posix/shared_mutex_posix.h"
 
 #include "flutter/fml/logging.h"
+#include "flutter/fml/synchronization/contention_watchdog.h"
+#include "flutter/fml/time/time_point.h"
 
 namespace fml {
 
-SharedMutex* SharedMutex::Create() {
-  return new SharedMutexPosix();
+SharedMutex* SharedMutex::Create(const char* name) {
+  return new SharedMutexPosix(name);
 }
 
-SharedMutexPosix::SharedMutexPosix() {
+SharedMutexPosix::SharedMutexPosix(const char* name) : name_(name) {
   FML_CHECK(pthread_rwlock_init(&rwlock_, nullptr) == 0);
 }
 
 void SharedMutexPosix::Lock() {
-  pthread_rwlock_wrlock(&rwlock_);
+  if (ContentionWatchdog::IsEnabled()) {
+    if (pthread_rwlock_trywrlock(&rwlock_) != 0) {
+      // Snapshot the owner before blocking; by the time the wait ends the
+      // lock has changed hands at least once.
+      const int64_t owner =
+          exclusive_owner_.load(std::memory_order_relaxed);
+      const TimePoint wait_start = TimePoint::Now();
+      pthread_rwlock_wrlock(&rwlock_);
+      const TimeDelta wait = TimePoint::Now() - wait_start;
+      if (wait >= ContentionWatchdog::GetThreshold()) {
+        ContentionWatchdog::ReportWait(name_, wait, owner);
+      }
+    }
+    exclusive_owner_.store(ContentionWatchdog::CurrentThreadId(),
+                           std::memory_order_relaxed);
+  } else {
+    pthread_rwlock_wrlock(&rwlock_);
+  }
 }
 
 void SharedMutexPosix::LockShared() {
-  pthread_rwlock_rdlock(&rwlock_);
+  if (ContentionWatchdog::IsEnabled()) {
+    if (pthread_rwlock_tryrdlock(&rwlock_) != 0) {
+      const int64_t owner =
+          exclusive_owner_.load(std::memory_order_relaxed);
+      const TimePoint wait_start = TimePoint::Now();
+      pthread_rwlock_rdlock(&rwlock_);
+      const TimeDelta wait = TimePoint::Now() - wait_start;
+      if (wait >= ContentionWatchdog::GetThreshold()) {
+        ContentionWatchdog::ReportWait(name_, wait, owner);
+      }
+    }
+  } else {
+    pthread_rwlock_rdlock(&rwlock_);
+  }
 }
 
 void SharedMutexPosix::Unlock() {
+  exclusive_owner_.store(0, std::memory_order_relaxed);
   pthread_rwlock_unlock(&rwlock_);
 }
 
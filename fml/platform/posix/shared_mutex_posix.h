@@ -5,6 +5,7 @@
 #ifndef FLUTTER_FML_SYNCHRONIZATION_SHARED_MUTEX_POSIX_H_
 #define FLUTTER_FML_SYNCHRONIZATION_SHARED_MUTEX_POSIX_H_
 
+#include <atomic>
 #include <shared_mutex>
 
 #include "flutter/fml/synchronization/shared_mutex.h"
@@ -19,10 +20,17 @@ class SharedMutexPosix : public SharedMutex {
   virtual void UnlockShared();
 
  private:
-  friend SharedMutex* SharedMutex::Create();
-  SharedMutexPosix();
+  friend SharedMutex* SharedMutex::Create(const char* name);
+  explicit SharedMutexPosix(const char* name);
 
   pthread_rwlock_t rwlock_;
+
+  // For ContentionWatchdog attribution; see shared_mutex.h.
+  const char* name_;
+  // The ContentionWatchdog thread id of the current exclusive holder, or 0
+  // when unheld or held in shared mode. Only maintained while the watchdog
+  // is enabled.
+  std::atomic<int64_t> exclusive_owner_ = 0;
 };
 
 }  // namespace fml
@@ -123,4 +123,25 @@ bool FileMapping::IsValid() const {
   return valid_;
 }
 
+bool FileMapping::Advise(Advice advice) {
+  if (mapping_ == nullptr || size_ == 0) {
+    return false;
+  }
+  switch (advice) {
+    case Advice::kNormal:
+    case Advice::kRandom:
+    case Advice::kSequential:
+      // The Windows VM manager does not take access-pattern hints for mapped
+      // views; these are no-ops.
+      return true;
+    case Advice::kWillNeed: {
+      WIN32_MEMORY_RANGE_ENTRY range = {};
+      range.VirtualAddress = mapping_;
+      range.NumberOfBytes = size_;
+      return ::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &range, 0) != 0;
+    }
+  }
+  return false;
+}
+
 }  // namespace fml
@@ -4,24 +4,135 @@
 
 #include "flutter/fml/string_conversion.h"
 
-#include <codecvt>
-#include <locale>
+#include <cstdint>
+#include <cstring>
 #include <sstream>
 #include <string>
 
-#include "flutter/fml/build_config.h"
+namespace fml {
 
-#if defined(FML_OS_WIN)
-// TODO(naifu): https://github.com/flutter/flutter/issues/98074
-// Eliminate this workaround for a link error on Windows when the underlying
-// bug is fixed.
-std::locale::id std::codecvt<char16_t, char, _Mbstatet>::id;
-#endif  // defined(FML_OS_WIN)
+namespace {
 
-namespace fml {
+constexpr char32_t kReplacementCharacter = 0xFFFD;
 
-using Utf16StringConverter =
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t>;
+// Returns the length of the leading all-ASCII run, scanning a word at a time.
+// The bulk of the strings on the channel and paragraph paths are ASCII, so
+// both converters copy this run with a trivial widening/narrowing loop and
+// only run the full decoder on the remainder.
+size_t ScanAsciiRun(const char* data, size_t size) {
+  size_t i = 0;
+  constexpr size_t kWordBytes = sizeof(uint64_t);
+  while (i + kWordBytes <= size) {
+    uint64_t word;
+    std::memcpy(&word, data + i, kWordBytes);
+    if (word & 0x8080808080808080ull) {
+      break;
+    }
+    i += kWordBytes;
+  }
+  while (i < size && !(static_cast<uint8_t>(data[i]) & 0x80)) {
+    i++;
+  }
+  return i;
+}
+
+size_t ScanAsciiRun(const char16_t* data, size_t size) {
+  size_t i = 0;
+  constexpr size_t kWordUnits = sizeof(uint64_t) / sizeof(char16_t);
+  while (i + kWordUnits <= size) {
+    uint64_t word;
+    std::memcpy(&word, data + i, sizeof(uint64_t));
+    if (word & 0xFF80FF80FF80FF80ull) {
+      break;
+    }
+    i += kWordUnits;
+  }
+  while (i < size && data[i] < 0x80) {
+    i++;
+  }
+  return i;
+}
+
+// Decodes the code point starting at |i| and advances |i| past it. Invalid
+// sequences decode to the replacement character and consume a single byte,
+// so the counting and encoding passes always agree on output sizes.
+char32_t DecodeUtf8(const char* data, size_t size, size_t& i) {
+  uint8_t byte = static_cast<uint8_t>(data[i]);
+  if (byte < 0x80) {
+    i += 1;
+    return byte;
+  }
+  size_t length;
+  char32_t code_point;
+  if ((byte & 0xE0) == 0xC0) {
+    length = 2;
+    code_point = byte & 0x1F;
+  } else if ((byte & 0xF0) == 0xE0) {
+    length = 3;
+    code_point = byte & 0x0F;
+  } else if ((byte & 0xF8) == 0xF0) {
+    length = 4;
+    code_point = byte & 0x07;
+  } else {
+    i += 1;
+    return kReplacementCharacter;
+  }
+  if (length > size - i) {
+    i += 1;
+    return kReplacementCharacter;
+  }
+  for (size_t j = 1; j < length; ++j) {
+    uint8_t trail = static_cast<uint8_t>(data[i + j]);
+    if ((trail & 0xC0) != 0x80) {
+      i += 1;
+      return kReplacementCharacter;
+    }
+    code_point = (code_point << 6) | (trail & 0x3F);
+  }
+  // Reject overlong encodings, surrogates, and out-of-range code points.
+  constexpr char32_t kMinimumForLength[] = {0, 0, 0x80, 0x800, 0x10000};
+  if (code_point < kMinimumForLength[length] || code_point > 0x10FFFF ||
+      (code_point >= 0xD800 && code_point <= 0xDFFF)) {
+    i += 1;
+    return kReplacementCharacter;
+  }
+  i += length;
+  return code_point;
+}
+
+// Decodes the code point starting at |i| and advances |i| past it. Unpaired
+// surrogates decode to the replacement character.
+char32_t DecodeUtf16(const char16_t* data, size_t size, size_t& i) {
+  char16_t unit = data[i];
+  if (unit >= 0xD800 && unit <= 0xDBFF && i + 1 < size &&
+      data[i + 1] >= 0xDC00 && data[i + 1] <= 0xDFFF) {
+    char32_t code_point =
+        0x10000 + ((static_cast<char32_t>(unit - 0xD800) << 10) |
+                   (data[i + 1] - 0xDC00));
+    i += 2;
+    return code_point;
+  }
+  i += 1;
+  if (unit >= 0xD800 && unit <= 0xDFFF) {
+    return kReplacementCharacter;
+  }
+  return unit;
+}
+
+constexpr size_t Utf8EncodedSize(char32_t code_point) {
+  if (code_point < 0x80) {
+    return 1;
+  }
+  if (code_point < 0x800) {
+    return 2;
+  }
+  if (code_point < 0x10000) {
+    return 3;
+  }
+  return 4;
+}
+
+}  // namespace
 
 std::string Join(const std::vector<std::string>& vec, const char* delim) {
   std::stringstream res;
@@ -35,13 +146,73 @@ std::string Join(const std::vector<std::string>& vec, const char* delim) {
 }
 
 std::string Utf16ToUtf8(const std::u16string_view string) {
-  Utf16StringConverter converter;
-  return converter.to_bytes(string.data());
+  const char16_t* data = string.data();
+  const size_t size = string.size();
+  const size_t ascii_run = ScanAsciiRun(data, size);
+
+  // Counting pass so the output is sized exactly once.
+  size_t bytes = ascii_run;
+  for (size_t i = ascii_run; i < size;) {
+    bytes += Utf8EncodedSize(DecodeUtf16(data, size, i));
+  }
+
+  std::string result;
+  result.resize(bytes);
+  char* out = result.data();
+  for (size_t i = 0; i < ascii_run; ++i) {
+    out[i] = static_cast<char>(data[i]);
+  }
+  size_t o = ascii_run;
+  for (size_t i = ascii_run; i < size;) {
+    char32_t code_point = DecodeUtf16(data, size, i);
+    if (code_point < 0x80) {
+      out[o++] = static_cast<char>(code_point);
+    } else if (code_point < 0x800) {
+      out[o++] = static_cast<char>(0xC0 | (code_point >> 6));
+      out[o++] = static_cast<char>(0x80 | (code_point & 0x3F));
+    } else if (code_point < 0x10000) {
+      out[o++] = static_cast<char>(0xE0 | (code_point >> 12));
+      out[o++] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+      out[o++] = static_cast<char>(0x80 | (code_point & 0x3F));
+    } else {
+      out[o++] = static_cast<char>(0xF0 | (code_point >> 18));
+      out[o++] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+      out[o++] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+      out[o++] = static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+  }
+  return result;
 }
 
 std::u16string Utf8ToUtf16(const std::string_view string) {
-  Utf16StringConverter converter;
-  return converter.from_bytes(string.data());
+  const char* data = string.data();
+  const size_t size = string.size();
+  const size_t ascii_run = ScanAsciiRun(data, size);
+
+  // Counting pass so the output is sized exactly once.
+  size_t units = ascii_run;
+  for (size_t i = ascii_run; i < size;) {
+    units += DecodeUtf8(data, size, i) >= 0x10000 ? 2 : 1;
+  }
+
+  std::u16string result;
+  result.resize(units);
+  char16_t* out = result.data();
+  for (size_t i = 0; i < ascii_run; ++i) {
+    out[i] = static_cast<char16_t>(data[i]);
+  }
+  size_t o = ascii_run;
+  for (size_t i = ascii_run; i < size;) {
+    char32_t code_point = DecodeUtf8(data, size, i);
+    if (code_point >= 0x10000) {
+      code_point -= 0x10000;
+      out[o++] = static_cast<char16_t>(0xD800 + (code_point >> 10));
+      out[o++] = static_cast<char16_t>(0xDC00 + (code_point & 0x3FF));
+    } else {
+      out[o++] = static_cast<char16_t>(code_point);
+    }
+  }
+  return result;
 }
 
 }  // namespace fml
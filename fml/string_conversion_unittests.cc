@@ -33,5 +33,36 @@ TEST(StringConversion, Utf16ToUtf8Unicode) {
   EXPECT_EQ(Utf16ToUtf8(u"\x2603"), "\xe2\x98\x83");
 }
 
+TEST(StringConversion, Utf8ToUtf16SupplementaryPlane) {
+  // U+1F600 encodes as a surrogate pair.
+  EXPECT_EQ(Utf8ToUtf16("\xf0\x9f\x98\x80"), u"\xd83d\xde00");
+}
+
+TEST(StringConversion, Utf16ToUtf8SupplementaryPlane) {
+  EXPECT_EQ(Utf16ToUtf8(u"\xd83d\xde00"), "\xf0\x9f\x98\x80");
+}
+
+TEST(StringConversion, Utf8ToUtf16MixedAsciiAndMultibyte) {
+  EXPECT_EQ(Utf8ToUtf16("hello \xe2\x98\x83 world"), u"hello \x2603 world");
+}
+
+TEST(StringConversion, Utf8ToUtf16InvalidBytesAreReplaced) {
+  // A lone continuation byte decodes to the replacement character.
+  EXPECT_EQ(Utf8ToUtf16("a\x80z"), u"a\xfffdz");
+  // An overlong encoding of '/' is not accepted.
+  EXPECT_EQ(Utf8ToUtf16("\xc0\xaf"), u"\xfffd\xfffd");
+}
+
+TEST(StringConversion, Utf16ToUtf8UnpairedSurrogateIsReplaced) {
+  EXPECT_EQ(Utf16ToUtf8(u"a\xd800z"), "a\xef\xbf\xbdz");
+}
+
+TEST(StringConversion, RoundTripPreservesEmbeddedNulls) {
+  std::string utf8("a\0b", 3);
+  std::u16string utf16(u"a\0b", 3);
+  EXPECT_EQ(Utf8ToUtf16(utf8), utf16);
+  EXPECT_EQ(Utf16ToUtf8(utf16), utf8);
+}
+
 }  // namespace testing
 }  // namespace fml
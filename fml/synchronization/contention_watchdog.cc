@@ -0,0 +1,58 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/synchronization/contention_watchdog.h"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+
+#include "flutter/fml/trace_event_interned.h"
+
+namespace fml {
+
+namespace {
+
+std::atomic<bool> gWatchdogEnabled = false;
+std::atomic<int64_t> gThresholdMicros =
+    ContentionWatchdog::kDefaultThresholdMicros;
+
+}  // namespace
+
+void ContentionWatchdog::SetEnabled(bool enabled) {
+  gWatchdogEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool ContentionWatchdog::IsEnabled() {
+  return gWatchdogEnabled.load(std::memory_order_relaxed);
+}
+
+void ContentionWatchdog::SetThreshold(TimeDelta threshold) {
+  gThresholdMicros.store(threshold.ToMicroseconds(),
+                         std::memory_order_relaxed);
+}
+
+TimeDelta ContentionWatchdog::GetThreshold() {
+  return TimeDelta::FromMicroseconds(
+      gThresholdMicros.load(std::memory_order_relaxed));
+}
+
+int64_t ContentionWatchdog::CurrentThreadId() {
+  static thread_local int64_t tls_thread_id = static_cast<int64_t>(
+      std::hash<std::thread::id>()(std::this_thread::get_id()));
+  return tls_thread_id;
+}
+
+void ContentionWatchdog::ReportWait(const char* name,
+                                    TimeDelta wait,
+                                    int64_t owner_thread) {
+  // Contended multi-millisecond waits are rare, so the per-report intern
+  // lookup is not worth caching at call sites.
+  const uint32_t interned_id = tracing::InternTraceString(
+      "fml", name, "wait_micros", "owner_thread");
+  tracing::RecordInternedInstantWithArgs(interned_id, wait.ToMicroseconds(),
+                                         owner_thread);
+}
+
+}  // namespace fml
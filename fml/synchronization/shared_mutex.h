@@ -10,7 +10,9 @@ namespace fml {
 // Interface for a reader/writer lock.
 class SharedMutex {
  public:
-  static SharedMutex* Create();
+  // |name| must be a string literal; it identifies this lock in
+  // ContentionWatchdog reports when the watchdog is enabled.
+  static SharedMutex* Create(const char* name = "SharedMutex");
   virtual ~SharedMutex() = default;
 
   virtual void Lock() = 0;
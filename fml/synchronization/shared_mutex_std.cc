@@ -4,21 +4,55 @@
 
 #include "flutter/fml/synchronization/shared_mutex_std.h"
 
+#include "flutter/fml/synchronization/contention_watchdog.h"
+#include "flutter/fml/time/time_point.h"
+
 namespace fml {
 
-SharedMutex* SharedMutex::Create() {
-  return new SharedMutexStd();
+SharedMutex* SharedMutex::Create(const char* name) {
+  return new SharedMutexStd(name);
 }
 
 void SharedMutexStd::Lock() {
-  mutex_.lock();
+  if (ContentionWatchdog::IsEnabled()) {
+    if (!mutex_.try_lock()) {
+      // Snapshot the owner before blocking; by the time the wait ends the
+      // lock has changed hands at least once.
+      const int64_t owner =
+          exclusive_owner_.load(std::memory_order_relaxed);
+      const TimePoint wait_start = TimePoint::Now();
+      mutex_.lock();
+      const TimeDelta wait = TimePoint::Now() - wait_start;
+      if (wait >= ContentionWatchdog::GetThreshold()) {
+        ContentionWatchdog::ReportWait(name_, wait, owner);
+      }
+    }
+    exclusive_owner_.store(ContentionWatchdog::CurrentThreadId(),
+                           std::memory_order_relaxed);
+  } else {
+    mutex_.lock();
+  }
 }
 
 void SharedMutexStd::LockShared() {
-  mutex_.lock_shared();
+  if (ContentionWatchdog::IsEnabled()) {
+    if (!mutex_.try_lock_shared()) {
+      const int64_t owner =
+          exclusive_owner_.load(std::memory_order_relaxed);
+      const TimePoint wait_start = TimePoint::Now();
+      mutex_.lock_shared();
+      const TimeDelta wait = TimePoint::Now() - wait_start;
+      if (wait >= ContentionWatchdog::GetThreshold()) {
+        ContentionWatchdog::ReportWait(name_, wait, owner);
+      }
+    }
+  } else {
+    mutex_.lock_shared();
+  }
 }
 
 void SharedMutexStd::Unlock() {
+  exclusive_owner_.store(0, std::memory_order_relaxed);
   mutex_.unlock();
 }
 
@@ -7,6 +7,7 @@
 
 #include "flutter/fml/synchronization/shared_mutex.h"
 
+#include <atomic>
 #include <shared_mutex>
 
 namespace fml {
@@ -19,10 +20,17 @@ class SharedMutexStd : public SharedMutex {
   virtual void UnlockShared();
 
  private:
-  friend SharedMutex* SharedMutex::Create();
-  SharedMutexStd() = default;
+  friend SharedMutex* SharedMutex::Create(const char* name);
+  explicit SharedMutexStd(const char* name) : name_(name) {}
 
   std::shared_timed_mutex mutex_;
+
+  // For ContentionWatchdog attribution; see shared_mutex.h.
+  const char* name_;
+  // The ContentionWatchdog thread id of the current exclusive holder, or 0
+  // when unheld or held in shared mode. Only maintained while the watchdog
+  // is enabled.
+  std::atomic<int64_t> exclusive_owner_ = 0;
 };
 
 }  // namespace fml
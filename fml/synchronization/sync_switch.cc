@@ -19,7 +19,8 @@ SyncSwitch::Handlers& SyncSwitch::Handlers::SetIfFalse(
 }
 
 SyncSwitch::SyncSwitch(bool value)
-    : mutex_(std::unique_ptr<fml::SharedMutex>(fml::SharedMutex::Create())),
+    : mutex_(std::unique_ptr<fml::SharedMutex>(
+          fml::SharedMutex::Create("SyncSwitch"))),
       value_(value) {}
 
 void SyncSwitch::Execute(const SyncSwitch::Handlers& handlers) const {
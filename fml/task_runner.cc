@@ -25,6 +25,10 @@ void TaskRunner::PostTask(const fml::closure& task) {
   loop_->PostTask(task, fml::TimePoint::Now());
 }
 
+void TaskRunner::PostTaskBatch(const std::vector<fml::closure>& tasks) {
+  loop_->PostTaskBatch(tasks, fml::TimePoint::Now());
+}
+
 void TaskRunner::PostTaskForTime(const fml::closure& task,
                                  fml::TimePoint target_time) {
   loop_->PostTask(task, target_time);
@@ -38,6 +38,12 @@ class TaskRunner : public fml::RefCountedThreadSafe<TaskRunner>,
 
   virtual void PostTask(const fml::closure& task) override;
 
+  /// Schedules all of |tasks| on the TaskRunner's associated event loop in
+  /// order, under a single queue lock acquisition and a single loop wake-up.
+  /// Prefer this over N calls to PostTask when dispatching a burst of work to
+  /// another thread.
+  virtual void PostTaskBatch(const std::vector<fml::closure>& tasks);
+
   virtual void PostTaskForTime(const fml::closure& task,
                                fml::TimePoint target_time);
 
@@ -78,6 +78,9 @@ Thread::Thread(const ThreadConfigSetter& setter, const ThreadConfig& config)
   thread_ = std::make_unique<std::thread>(
       [&latch, &runner, setter, config]() -> void {
         setter(config);
+        if (config.affinity.has_value()) {
+          fml::RequestAffinity(config.affinity.value());
+        }
         fml::MessageLoop::EnsureInitializedForCurrentThread();
         auto& loop = MessageLoop::GetCurrent();
         runner = loop.GetTaskRunner();
@@ -96,6 +99,11 @@ fml::RefPtr<fml::TaskRunner> Thread::GetTaskRunner() const {
   return task_runner_;
 }
 
+void Thread::SetAffinity(CpuAffinity affinity) {
+  task_runner_->PostTask(
+      [affinity]() { fml::RequestAffinity(affinity); });
+}
+
 void Thread::Join() {
   if (joined_) {
     return;
@@ -8,9 +8,11 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <thread>
 
+#include "flutter/fml/cpu_affinity.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/task_runner.h"
 
@@ -32,8 +34,13 @@ class Thread {
 
   /// The ThreadConfig is the thread info include thread name, thread priority.
   struct ThreadConfig {
+    ThreadConfig(const std::string& name,
+                 ThreadPriority priority,
+                 std::optional<CpuAffinity> affinity)
+        : name(name), priority(priority), affinity(affinity) {}
+
     ThreadConfig(const std::string& name, ThreadPriority priority)
-        : name(name), priority(priority) {}
+        : ThreadConfig(name, priority, std::nullopt) {}
 
     explicit ThreadConfig(const std::string& name)
         : ThreadConfig(name, ThreadPriority::kNormal) {}
@@ -42,6 +49,10 @@ class Thread {
 
     std::string name;
     ThreadPriority priority;
+
+    /// If set, the CPU core class the thread is pinned to at startup on
+    /// platforms that support affinity requests. Requests are advisory only.
+    std::optional<CpuAffinity> affinity;
   };
 
   using ThreadConfigSetter = std::function<void(const ThreadConfig&)>;
@@ -57,6 +68,12 @@ class Thread {
 
   void Join();
 
+  /// Requests the given affinity for this thread at runtime (for example to
+  /// move a raster thread onto performance cores for the duration of an
+  /// animation). The request is posted to the thread and applied
+  /// asynchronously; like all affinity requests it is advisory only.
+  void SetAffinity(CpuAffinity affinity);
+
   static void SetCurrentThreadName(const ThreadConfig& config);
 
  private:
@@ -0,0 +1,259 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/trace_event_interned.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace fml {
+namespace tracing {
+
+#if FLUTTER_TIMELINE_ENABLED
+
+namespace {
+
+enum class RecordPhase : uint8_t {
+  kBegin,
+  kEnd,
+  kInstant,
+};
+
+struct TraceRecord {
+  uint32_t interned_id = 0;
+  RecordPhase phase = RecordPhase::kInstant;
+  bool has_args = false;
+  int64_t timestamp_micros = 0;
+  int64_t args[2] = {0, 0};
+};
+
+struct InternedEntry {
+  const char* category_group;
+  const char* name;
+  const char* arg0_name;
+  const char* arg1_name;
+};
+
+/// A bounded single-writer ring of trace records. The owning thread records;
+/// the flusher reads from any thread. Each slot carries a sequence number so
+/// a flusher that has been lapped by the writer skips torn slots instead of
+/// reporting garbage.
+class ThreadTraceBuffer {
+ public:
+  static constexpr size_t kCapacity = 4096;  // Must be a power of two.
+
+  void Record(const TraceRecord& record) {
+    const uint64_t pos = write_pos_.load(std::memory_order_relaxed);
+    Slot& slot = slots_[pos & (kCapacity - 1)];
+    slot.sequence.store(0, std::memory_order_release);  // Mark in-progress.
+    slot.record = record;
+    slot.sequence.store(pos + 1, std::memory_order_release);
+    write_pos_.store(pos + 1, std::memory_order_release);
+  }
+
+  template <typename Visitor>
+  void Flush(Visitor&& visitor) {
+    const uint64_t write_pos = write_pos_.load(std::memory_order_acquire);
+    uint64_t read_pos = read_pos_;
+    // If the writer lapped us, skip ahead to the oldest complete record.
+    if (write_pos - read_pos > kCapacity) {
+      read_pos = write_pos - kCapacity;
+    }
+    for (; read_pos < write_pos; read_pos++) {
+      const Slot& slot = slots_[read_pos & (kCapacity - 1)];
+      TraceRecord record = slot.record;
+      if (slot.sequence.load(std::memory_order_acquire) != read_pos + 1) {
+        // Torn or overwritten while reading; drop it.
+        continue;
+      }
+      visitor(record);
+    }
+    read_pos_ = read_pos;
+  }
+
+ private:
+  struct Slot {
+    std::atomic<uint64_t> sequence{0};
+    TraceRecord record;
+  };
+
+  Slot slots_[kCapacity];
+  std::atomic<uint64_t> write_pos_{0};
+  uint64_t read_pos_ = 0;  // Only touched under the registry flush mutex.
+};
+
+/// Owns every per-thread buffer for the life of the process; threads cache a
+/// raw pointer in a thread_local. Buffers from exited threads remain
+/// registered so their tail records still get flushed.
+class TraceBufferRegistry {
+ public:
+  static TraceBufferRegistry* GetInstance() {
+    static TraceBufferRegistry* registry = new TraceBufferRegistry();
+    return registry;
+  }
+
+  ThreadTraceBuffer* CreateBuffer() {
+    std::lock_guard lock(mutex_);
+    buffers_.push_back(std::make_unique<ThreadTraceBuffer>());
+    return buffers_.back().get();
+  }
+
+  template <typename Visitor>
+  void FlushAll(Visitor&& visitor) {
+    std::lock_guard lock(mutex_);
+    for (auto& buffer : buffers_) {
+      buffer->Flush(visitor);
+    }
+  }
+
+ private:
+  TraceBufferRegistry() = default;
+
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<ThreadTraceBuffer>> buffers_;
+};
+
+thread_local ThreadTraceBuffer* tls_trace_buffer = nullptr;
+
+inline ThreadTraceBuffer* GetThreadTraceBuffer() {
+  if (tls_trace_buffer == nullptr) {
+    tls_trace_buffer = TraceBufferRegistry::GetInstance()->CreateBuffer();
+  }
+  return tls_trace_buffer;
+}
+
+struct InternTable {
+  std::mutex mutex;
+  std::vector<InternedEntry> entries;
+};
+
+InternTable* GetInternTable() {
+  static InternTable* table = new InternTable();
+  return table;
+}
+
+}  // namespace
+
+uint32_t InternTraceString(const char* category_group,
+                           const char* name,
+                           const char* arg0_name,
+                           const char* arg1_name) {
+  auto* table = GetInternTable();
+  std::lock_guard lock(table->mutex);
+  for (uint32_t i = 0; i < table->entries.size(); i++) {
+    if (table->entries[i].category_group == category_group &&
+        table->entries[i].name == name &&
+        table->entries[i].arg0_name == arg0_name &&
+        table->entries[i].arg1_name == arg1_name) {
+      return i;
+    }
+  }
+  table->entries.push_back({category_group, name, arg0_name, arg1_name});
+  return table->entries.size() - 1;
+}
+
+void RecordInternedBegin(uint32_t interned_id) {
+  GetThreadTraceBuffer()->Record(
+      {interned_id, RecordPhase::kBegin, false, TraceGetTimelineMicros()});
+}
+
+void RecordInternedEnd(uint32_t interned_id) {
+  GetThreadTraceBuffer()->Record(
+      {interned_id, RecordPhase::kEnd, false, TraceGetTimelineMicros()});
+}
+
+void RecordInternedInstant(uint32_t interned_id) {
+  GetThreadTraceBuffer()->Record(
+      {interned_id, RecordPhase::kInstant, false, TraceGetTimelineMicros()});
+}
+
+void RecordInternedInstantWithArgs(uint32_t interned_id,
+                                   int64_t arg0,
+                                   int64_t arg1) {
+  GetThreadTraceBuffer()->Record({interned_id,
+                                  RecordPhase::kInstant,
+                                  true,
+                                  TraceGetTimelineMicros(),
+                                  {arg0, arg1}});
+}
+
+void FlushInternedTraceEvents() {
+  // Snapshot the intern table so flushing does not hold its lock while
+  // calling into the timeline.
+  std::vector<InternedEntry> entries;
+  {
+    auto* table = GetInternTable();
+    std::lock_guard lock(table->mutex);
+    entries = table->entries;
+  }
+
+  TraceBufferRegistry::GetInstance()->FlushAll([&](const TraceRecord& record) {
+    if (record.interned_id >= entries.size()) {
+      return;
+    }
+    const InternedEntry& entry = entries[record.interned_id];
+    Dart_Timeline_Event_Type type = Dart_Timeline_Event_Instant;
+    switch (record.phase) {
+      case RecordPhase::kBegin:
+        type = Dart_Timeline_Event_Begin;
+        break;
+      case RecordPhase::kEnd:
+        type = Dart_Timeline_Event_End;
+        break;
+      case RecordPhase::kInstant:
+        type = Dart_Timeline_Event_Instant;
+        break;
+    }
+    std::vector<const char*> names;
+    std::vector<std::string> values;
+    if (record.has_args) {
+      if (entry.arg0_name != nullptr) {
+        names.push_back(entry.arg0_name);
+        values.push_back(std::to_string(record.args[0]));
+      }
+      if (entry.arg1_name != nullptr) {
+        names.push_back(entry.arg1_name);
+        values.push_back(std::to_string(record.args[1]));
+      }
+    }
+    TraceTimelineEvent(entry.category_group,     // category
+                       entry.name,               // name
+                       record.timestamp_micros,  // timestamp_micros
+                       0,                        // identifier
+                       0,                        // flow_id_count
+                       nullptr,                  // flow_ids
+                       type,                     // type
+                       names,                    // names
+                       values                    // values
+    );
+  });
+}
+
+#else  // FLUTTER_TIMELINE_ENABLED
+
+uint32_t InternTraceString(const char* category_group,
+                           const char* name,
+                           const char* arg0_name,
+                           const char* arg1_name) {
+  return 0;
+}
+
+void RecordInternedBegin(uint32_t interned_id) {}
+
+void RecordInternedEnd(uint32_t interned_id) {}
+
+void RecordInternedInstant(uint32_t interned_id) {}
+
+void RecordInternedInstantWithArgs(uint32_t interned_id,
+                                   int64_t arg0,
+                                   int64_t arg1) {}
+
+void FlushInternedTraceEvents() {}
+
+#endif  // FLUTTER_TIMELINE_ENABLED
+
+}  // namespace tracing
+}  // namespace fml
@@ -0,0 +1,114 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_TRACE_EVENT_INTERNED_H_
+#define FLUTTER_FML_TRACE_EVENT_INTERNED_H_
+
+#include <cstdint>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/trace_event.h"
+
+// An allocation-free trace path for always-on field diagnostics.
+//
+// The regular TRACE_EVENT macros copy their argument strings and call into
+// the Dart timeline synchronously. On hot paths that run with tracing
+// permanently enabled (e.g. Rasterizer::DoDraw) that cost is visible in
+// profiles. The interned variant registers the category/name pair exactly
+// once per call site into a global string table and records each event as a
+// fixed-size POD record (id, phase, timestamp) into a per-thread ring
+// buffer. Recording an event is a couple of relaxed atomic operations and a
+// store; no locks and no allocations are taken after the first hit.
+//
+// Buffered records are forwarded to the Dart timeline when
+// FlushInternedTraceEvents() is called (typically by the service protocol or
+// at frame boundaries on a background thread). The ring is bounded; if a
+// thread records faster than it is flushed, the oldest records are
+// overwritten.
+
+namespace fml {
+namespace tracing {
+
+/// Registers a category/name pair into the global intern table and returns
+/// its id. Thread-safe; intended to be called once per call site through the
+/// FML_TRACE_DURATION_INTERNED macro. The pointers must be string literals
+/// (they are retained, not copied). The optional argument names label the
+/// two integer payloads of |RecordInternedInstantWithArgs| records made
+/// against the returned id.
+uint32_t InternTraceString(const char* category_group,
+                           const char* name,
+                           const char* arg0_name = nullptr,
+                           const char* arg1_name = nullptr);
+
+/// Records a begin/end/instant event against an interned id. The timestamp
+/// is sampled inside the call.
+void RecordInternedBegin(uint32_t interned_id);
+void RecordInternedEnd(uint32_t interned_id);
+void RecordInternedInstant(uint32_t interned_id);
+
+/// Records an instant event carrying two integer arguments; the argument
+/// names are the ones registered with the interned id. Same cost profile as
+/// the other record calls: no locks, no allocations.
+void RecordInternedInstantWithArgs(uint32_t interned_id,
+                                   int64_t arg0,
+                                   int64_t arg1);
+
+/// Drains all per-thread ring buffers into the Dart timeline. Safe to call
+/// from any thread; expensive relative to recording, so callers should
+/// invoke it off the UI and raster threads.
+void FlushInternedTraceEvents();
+
+/// RAII duration helper used by FML_TRACE_DURATION_INTERNED.
+class ScopedInternedDuration {
+ public:
+  explicit ScopedInternedDuration(uint32_t interned_id)
+      : interned_id_(interned_id) {
+    RecordInternedBegin(interned_id_);
+  }
+
+  ~ScopedInternedDuration() { RecordInternedEnd(interned_id_); }
+
+ private:
+  const uint32_t interned_id_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ScopedInternedDuration);
+};
+
+}  // namespace tracing
+}  // namespace fml
+
+#if !defined(OS_FUCHSIA)
+
+#define __FML__INTERNED_TOKEN_CAT__(x, y) x##y
+#define __FML__INTERNED_TOKEN_CAT__2(x, y) __FML__INTERNED_TOKEN_CAT__(x, y)
+
+#define FML_TRACE_DURATION_INTERNED(category_group, name)            \
+  static const uint32_t __FML__INTERNED_TOKEN_CAT__2(                \
+      __fml_interned_id_,                                            \
+      __LINE__) = ::fml::tracing::InternTraceString(category_group,  \
+                                                    name);           \
+  ::fml::tracing::ScopedInternedDuration __FML__INTERNED_TOKEN_CAT__2( \
+      __fml_interned_scope_,                                         \
+      __LINE__)(__FML__INTERNED_TOKEN_CAT__2(__fml_interned_id_, __LINE__));
+
+#define FML_TRACE_INSTANT_INTERNED(category_group, name)            \
+  {                                                                 \
+    static const uint32_t __FML__INTERNED_TOKEN_CAT__2(             \
+        __fml_interned_id_,                                         \
+        __LINE__) = ::fml::tracing::InternTraceString(category_group, name); \
+    ::fml::tracing::RecordInternedInstant(                          \
+        __FML__INTERNED_TOKEN_CAT__2(__fml_interned_id_, __LINE__)); \
+  }
+
+#else  // !defined(OS_FUCHSIA)
+
+// Fuchsia forwards to the system tracer which has its own interning.
+#define FML_TRACE_DURATION_INTERNED(category_group, name) \
+  TRACE_EVENT0(category_group, name)
+#define FML_TRACE_INSTANT_INTERNED(category_group, name) \
+  TRACE_EVENT_INSTANT0(category_group, name)
+
+#endif  // !defined(OS_FUCHSIA)
+
+#endif  // FLUTTER_FML_TRACE_EVENT_INTERNED_H_
@@ -4,6 +4,7 @@
 
 #include "impeller/aiks/aiks_context.h"
 
+#include "flutter/fml/trace_event.h"
 #include "impeller/aiks/picture.h"
 #include "impeller/typographer/typographer_context.h"
 
@@ -11,7 +12,8 @@ namespace impeller {
 
 AiksContext::AiksContext(
     std::shared_ptr<Context> context,
-    std::shared_ptr<TypographerContext> typographer_context)
+    std::shared_ptr<TypographerContext> typographer_context,
+    std::optional<std::string> pipeline_usage_directory)
     : context_(std::move(context)) {
   if (!context_ || !context_->IsValid()) {
     return;
@@ -23,9 +25,44 @@ AiksContext::AiksContext(
     return;
   }
 
+  if (pipeline_usage_directory.has_value()) {
+    SetupPipelineWarmUp(pipeline_usage_directory.value());
+  }
+
   is_valid_ = true;
 }
 
+void AiksContext::SetupPipelineWarmUp(const std::string& directory) {
+  auto manifest = std::make_shared<PipelineUsageManifest>(directory);
+  if (!manifest->IsValid()) {
+    return;
+  }
+  pipeline_usage_manifest_ = manifest;
+  content_context_->SetVariantUsageCallback(
+      [manifest](const std::string& family,
+                 const ContentContextOptions& options) {
+        manifest->RecordUsage(family, options);
+      });
+
+  auto known_variants = manifest->GetKnownVariants();
+  if (known_variants.empty()) {
+    return;
+  }
+  // Pre-create the variants used by previous sessions off the setup thread
+  // so that the first frames do not pay pipeline compilation costs at draw
+  // time. The content context synchronizes variant creation internally, so
+  // frames that start before the warm-up finishes are still correct.
+  warmup_thread_ = std::make_unique<fml::Thread>("ImpellerPSOWarmUp");
+  warmup_thread_->GetTaskRunner()->PostTask(
+      [content_context = content_context_.get(), manifest,
+       known_variants = std::move(known_variants)]() {
+        TRACE_EVENT0("impeller", "PipelineVariantWarmUp");
+        for (const auto& [family, options] : known_variants) {
+          content_context->WarmUpVariant(family, options);
+        }
+      });
+}
+
 AiksContext::~AiksContext() = default;
 
 bool AiksContext::IsValid() const {
@@ -40,13 +77,15 @@ ContentContext& AiksContext::GetContentContext() const {
   return *content_context_;
 }
 
-bool AiksContext::Render(const Picture& picture, RenderTarget& render_target) {
+bool AiksContext::Render(const Picture& picture,
+                         RenderTarget& render_target,
+                         const std::optional<IRect>& damage) {
   if (!IsValid()) {
     return false;
   }
 
   if (picture.pass) {
-    return picture.pass->Render(*content_context_, render_target);
+    return picture.pass->Render(*content_context_, render_target, damage);
   }
 
   return true;
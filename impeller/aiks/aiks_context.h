@@ -5,9 +5,14 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <string>
 
 #include "flutter/fml/macros.h"
+#include "flutter/fml/thread.h"
+#include "impeller/aiks/pipeline_usage_manifest.h"
 #include "impeller/entity/contents/content_context.h"
+#include "impeller/geometry/rect.h"
 #include "impeller/renderer/context.h"
 #include "impeller/renderer/render_target.h"
 #include "impeller/typographer/typographer_context.h"
@@ -28,8 +33,17 @@ class AiksContext {
   ///                             `nullptr` is supplied, then attempting to draw
   ///                             text with Aiks will result in validation
   ///                             errors.
-  AiksContext(std::shared_ptr<Context> context,
-              std::shared_ptr<TypographerContext> typographer_context);
+  /// @param pipeline_usage_directory  Optional directory holding the
+  ///                             persistent pipeline usage manifest. When
+  ///                             supplied, the pipeline variants recorded by
+  ///                             previous sessions are pre-created on a
+  ///                             background thread during setup, and the
+  ///                             variants used by this session are recorded
+  ///                             for the next launch.
+  AiksContext(
+      std::shared_ptr<Context> context,
+      std::shared_ptr<TypographerContext> typographer_context,
+      std::optional<std::string> pipeline_usage_directory = std::nullopt);
 
   ~AiksContext();
 
@@ -39,11 +53,25 @@ class AiksContext {
 
   ContentContext& GetContentContext() const;
 
-  bool Render(const Picture& picture, RenderTarget& render_target);
+  /// Render the picture into the given render target.
+  ///
+  /// If `damage` is supplied, only the given region of the target is
+  /// repainted; the rest of the target's existing contents are preserved.
+  bool Render(const Picture& picture,
+              RenderTarget& render_target,
+              const std::optional<IRect>& damage = std::nullopt);
 
  private:
+  // Records this session's pipeline variant usage and replays the previous
+  // session's on the warm-up thread.
+  void SetupPipelineWarmUp(const std::string& directory);
+
   std::shared_ptr<Context> context_;
   std::unique_ptr<ContentContext> content_context_;
+  std::shared_ptr<PipelineUsageManifest> pipeline_usage_manifest_;
+  // Declared after content_context_ so that the warm-up thread is joined
+  // before the content context is torn down.
+  std::unique_ptr<fml::Thread> warmup_thread_;
   bool is_valid_ = false;
 
   AiksContext(const AiksContext&) = delete;
@@ -0,0 +1,173 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/display_list/dl_serializer.h"
+#include "flutter/fml/file.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/paths.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "impeller/aiks/aiks_context.h"
+#include "impeller/display_list/dl_dispatcher.h"
+#include "impeller/playground/playground.h"
+#include "impeller/playground/playground_impl.h"
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/render_target.h"
+#include "impeller/typographer/backends/skia/typographer_context_skia.h"
+
+//------------------------------------------------------------------------------
+// Replays captured DisplayLists (the DisplayListSerializer format, typically
+// written by the frame capture tooling from a real application session)
+// through AiksContext::Render on each backend the host supports, so frame
+// costs can be regression-gated against real workloads instead of synthetic
+// op patterns.
+//
+// Captures are read from the directory named by the
+// IMPELLER_REPLAY_CAPTURE_DIR environment variable; one benchmark per capture
+// per backend is registered. Without the variable the suite registers
+// nothing, so the target stays runnable in environments without captures.
+//------------------------------------------------------------------------------
+
+namespace impeller {
+namespace {
+
+// The logical frame size captures are replayed into. Captures record culled
+// bounds, but a fixed target keeps timings comparable across captures.
+constexpr ISize kReplayFrameSize = {1280, 720};
+
+// Blocks until every command buffer submitted so far has executed, so an
+// iteration measures GPU execution rather than just encode and submit. The
+// empty buffer acts as a serialization point on the context's queue.
+bool DrainGPU(const std::shared_ptr<Context>& context) {
+  auto buffer = context->CreateCommandBuffer();
+  if (!buffer) {
+    return false;
+  }
+  fml::AutoResetWaitableEvent latch;
+  if (!buffer->SubmitCommands([&latch](CommandBuffer::Status) {
+        latch.Signal();
+      })) {
+    return false;
+  }
+  latch.Wait();
+  return true;
+}
+
+void BM_ReplayCapture(benchmark::State& state,
+                      PlaygroundBackend backend,
+                      const std::shared_ptr<fml::Mapping>& capture) {
+  auto playground = PlaygroundImpl::Create(backend, PlaygroundSwitches{});
+  if (!playground || !playground->GetContext()) {
+    state.SkipWithError("Could not create a context for the backend.");
+    return;
+  }
+  auto context = playground->GetContext();
+  AiksContext aiks_context(context, TypographerContextSkia::Make());
+  if (!aiks_context.IsValid()) {
+    state.SkipWithError("Could not create the Aiks context.");
+    return;
+  }
+
+  DlDispatcher dispatcher;
+  if (!flutter::DisplayListSerializer::Dispatch(
+          capture->GetMapping(), capture->GetSize(), dispatcher)) {
+    state.SkipWithError("Capture failed validation.");
+    return;
+  }
+  Picture picture = dispatcher.EndRecordingAsPicture();
+
+  RenderTargetAllocator allocator(context->GetResourceAllocator());
+  RenderTarget target;
+  if (context->GetCapabilities()->SupportsOffscreenMSAA()) {
+    target = RenderTarget::CreateOffscreenMSAA(*context, allocator,
+                                               kReplayFrameSize, "Replay");
+  } else {
+    target = RenderTarget::CreateOffscreen(*context, allocator,
+                                           kReplayFrameSize, "Replay");
+  }
+  if (!target.IsValid()) {
+    state.SkipWithError("Could not create the offscreen render target.");
+    return;
+  }
+
+  // Warm pipelines and caches outside the measured iterations; the suite
+  // measures steady-state frame costs, not first-frame compilation.
+  if (!aiks_context.Render(picture, target) || !DrainGPU(context)) {
+    state.SkipWithError("Could not replay the capture.");
+    return;
+  }
+
+  while (state.KeepRunning()) {
+    if (!aiks_context.Render(picture, target) || !DrainGPU(context)) {
+      state.SkipWithError("Could not replay the capture.");
+      return;
+    }
+  }
+
+  const auto* header =
+      reinterpret_cast<const flutter::DlSerializedHeader*>(
+          capture->GetMapping());
+  state.counters["OpCount"] = header->op_count;
+  state.SetItemsProcessed(state.iterations() * header->op_count);
+}
+
+// Registers the replay benchmarks before benchmark::Initialize runs in the
+// shared benchmarking main.
+struct ReplayBenchmarkRegistrar {
+  ReplayBenchmarkRegistrar() {
+    const char* capture_dir = std::getenv("IMPELLER_REPLAY_CAPTURE_DIR");
+    if (capture_dir == nullptr) {
+      return;
+    }
+    std::vector<std::pair<std::string, std::shared_ptr<fml::Mapping>>>
+        captures;
+    fml::UniqueFD directory = fml::OpenDirectory(
+        capture_dir, /*create_if_necessary=*/false, fml::FilePermission::kRead);
+    if (!directory.is_valid()) {
+      return;
+    }
+    fml::VisitFiles(directory, [&](const fml::UniqueFD& dir,
+                                   const std::string& name) {
+      std::shared_ptr<fml::Mapping> mapping = fml::FileMapping::CreateReadOnly(
+          fml::paths::JoinPaths({capture_dir, name}));
+      // Skip files that are not captures rather than failing the suite; the
+      // benchmark itself rejects captures that fail full validation.
+      if (mapping != nullptr &&
+          mapping->GetSize() >= sizeof(flutter::DlSerializedHeader) &&
+          reinterpret_cast<const flutter::DlSerializedHeader*>(
+              mapping->GetMapping())
+                  ->magic == flutter::DisplayListSerializer::kMagic) {
+        captures.emplace_back(name, std::move(mapping));
+      }
+      return true;
+    });
+
+    for (auto backend : {PlaygroundBackend::kMetal, PlaygroundBackend::kVulkan,
+                         PlaygroundBackend::kOpenGLES}) {
+      if (!Playground::SupportsBackend(backend)) {
+        continue;
+      }
+      for (const auto& [name, mapping] : captures) {
+        auto benchmark_name = "BM_ReplayCapture/" + name + "/" +
+                              PlaygroundBackendToString(backend);
+        benchmark::RegisterBenchmark(
+            benchmark_name.c_str(),
+            [backend, mapping = mapping](benchmark::State& state) {
+              BM_ReplayCapture(state, backend, mapping);
+            })
+            ->Unit(benchmark::kMillisecond);
+      }
+    }
+  }
+};
+
+ReplayBenchmarkRegistrar registrar;
+
+}  // namespace
+}  // namespace impeller
@@ -1439,6 +1439,35 @@ TEST_P(AiksTest, CanRenderTextFrame) {
   ASSERT_TRUE(OpenPlaygroundHere(canvas.EndRecordingAsPicture()));
 }
 
+TEST_P(AiksTest, CanRenderTextWithFixedKernelMaskBlur) {
+  Canvas canvas;
+  canvas.DrawPaint({.color = Color(0.1, 0.1, 0.1, 1.0)});
+
+  auto mapping = flutter::testing::OpenFixtureAsSkData("Roboto-Regular.ttf");
+  ASSERT_TRUE(mapping);
+  SkFont sk_font(SkTypeface::MakeFromData(mapping), 50);
+  auto blob = SkTextBlob::MakeFromString("shadowed text", sk_font);
+  ASSERT_TRUE(blob);
+  auto frame = MakeTextFrameFromTextBlobSkia(blob);
+
+  // Small sigmas are blurred with the fixed kernel in the glyph shader.
+  Paint shadow_paint;
+  shadow_paint.color = Color::Black();
+  shadow_paint.mask_blur_descriptor = Paint::MaskBlurDescriptor{
+      .style = FilterContents::BlurStyle::kNormal,
+      .sigma = Sigma(2),
+  };
+  canvas.DrawTextFrame(frame, Point(100, 150), shadow_paint);
+  canvas.DrawTextFrame(frame, Point(97, 147), {.color = Color::Yellow()});
+
+  // Larger sigmas fall back to the full gaussian filter.
+  shadow_paint.mask_blur_descriptor->sigma = Sigma(12);
+  canvas.DrawTextFrame(frame, Point(100, 300), shadow_paint);
+  canvas.DrawTextFrame(frame, Point(97, 297), {.color = Color::Yellow()});
+
+  ASSERT_TRUE(OpenPlaygroundHere(canvas.EndRecordingAsPicture()));
+}
+
 TEST_P(AiksTest, CanRenderTextFrameSTB) {
   Canvas canvas;
   canvas.DrawPaint({.color = Color(0.1, 0.1, 0.1, 1.0)});
@@ -1450,6 +1479,53 @@ TEST_P(AiksTest, CanRenderTextFrameSTB) {
   ASSERT_TRUE(OpenPlaygroundHere(canvas.EndRecordingAsPicture()));
 }
 
+TEST_P(AiksTest, AdjacentCompatibleTextDrawsAreMergedIntoOneEntity) {
+  auto mapping = flutter::testing::OpenFixtureAsSkData("Roboto-Regular.ttf");
+  ASSERT_TRUE(mapping);
+  SkFont sk_font(SkTypeface::MakeFromData(mapping), 30);
+  auto blob = SkTextBlob::MakeFromString("Tile", sk_font);
+  ASSERT_TRUE(blob);
+  auto frame = MakeTextFrameFromTextBlobSkia(blob);
+
+  Paint text_paint;
+  text_paint.color = Color::Black();
+
+  // Consecutive draws that differ only by translation collapse into a single
+  // entity.
+  Canvas canvas;
+  for (int i = 0; i < 10; i++) {
+    canvas.DrawTextFrame(frame, Point(100, 100 + i * 50), text_paint);
+  }
+  Picture picture = canvas.EndRecordingAsPicture();
+  ASSERT_EQ(picture.pass->GetElementCount(), 1u);
+
+  // A color change breaks the run.
+  Paint red_paint;
+  red_paint.color = Color::Red();
+  Canvas canvas_colors;
+  canvas_colors.DrawTextFrame(frame, Point(100, 100), text_paint);
+  canvas_colors.DrawTextFrame(frame, Point(100, 150), red_paint);
+  Picture two_colors = canvas_colors.EndRecordingAsPicture();
+  ASSERT_EQ(two_colors.pass->GetElementCount(), 2u);
+
+  // Any other draw in between breaks the run.
+  Canvas canvas_interleaved;
+  canvas_interleaved.DrawTextFrame(frame, Point(100, 100), text_paint);
+  canvas_interleaved.DrawRect(Rect::MakeXYWH(0, 0, 10, 10),
+                              Paint{.color = Color::Blue()});
+  canvas_interleaved.DrawTextFrame(frame, Point(100, 150), text_paint);
+  Picture interleaved = canvas_interleaved.EndRecordingAsPicture();
+  ASSERT_EQ(interleaved.pass->GetElementCount(), 3u);
+
+  // Rotated draws are not merged.
+  Canvas canvas_rotated;
+  canvas_rotated.DrawTextFrame(frame, Point(100, 100), text_paint);
+  canvas_rotated.Rotate(Radians{kPiOver4});
+  canvas_rotated.DrawTextFrame(frame, Point(100, 150), text_paint);
+  Picture rotated = canvas_rotated.EndRecordingAsPicture();
+  ASSERT_EQ(rotated.pass->GetElementCount(), 2u);
+}
+
 TEST_P(AiksTest, TextFrameSubpixelAlignment) {
   std::array<Scalar, 20> phase_offsets;
   for (Scalar& offset : phase_offsets) {
@@ -2187,6 +2263,24 @@ TEST_P(AiksTest, DrawRectStrokesWithBevelJoinRenderCorrectly) {
   ASSERT_TRUE(OpenPlaygroundHere(canvas.EndRecordingAsPicture()));
 }
 
+TEST_P(AiksTest, FilledAndStrokedRRectsRenderCorrectly) {
+  Canvas canvas;
+  canvas.DrawPaint({.color = Color::White()});
+
+  Paint paint;
+  paint.color = Color::CornflowerBlue();
+  canvas.DrawRRect(Rect::MakeXYWH(100, 100, 200, 150), {30, 30}, paint);
+  canvas.DrawCircle({500, 175}, 75, paint);
+
+  paint.color = Color::Crimson();
+  paint.style = Paint::Style::kStroke;
+  paint.stroke_width = 10;
+  canvas.DrawRRect(Rect::MakeXYWH(100, 350, 200, 150), {30, 30}, paint);
+  canvas.DrawCircle({500, 425}, 75, paint);
+
+  ASSERT_TRUE(OpenPlaygroundHere(canvas.EndRecordingAsPicture()));
+}
+
 TEST_P(AiksTest, SaveLayerDrawsBehindSubsequentEntities) {
   // Compare with https://fiddle.skia.org/c/9e03de8567ffb49e7e83f53b64bcf636
   Canvas canvas;
@@ -2401,6 +2495,29 @@ TEST_P(AiksTest, OpacityPeepHoleApplicationTest) {
 
   delegate = std::make_shared<OpacityPeepholePassDelegate>(paint);
   ASSERT_TRUE(delegate->CanCollapseIntoParentPass(entity_pass.get()));
+
+  // Several non-overlapping draws (e.g. a faded list item) can also be
+  // folded.
+  for (int i = 1; i < 6; i++) {
+    Entity non_overlapping;
+    non_overlapping.SetContents(SolidColorContents::Make(
+        PathBuilder{}
+            .AddRect(Rect::MakeXYWH(i * 200.0f, 0, 100, 100))
+            .TakePath(),
+        Color::Red()));
+    entity_pass->AddEntity(non_overlapping);
+  }
+  delegate = std::make_shared<OpacityPeepholePassDelegate>(paint);
+  ASSERT_TRUE(delegate->CanCollapseIntoParentPass(entity_pass.get()));
+
+  // A draw that overlaps a previous draw prevents folding.
+  Entity overlapping;
+  overlapping.SetContents(SolidColorContents::Make(
+      PathBuilder{}.AddRect(Rect::MakeLTRB(50, 0, 150, 100)).TakePath(),
+      Color::Red()));
+  entity_pass->AddEntity(overlapping);
+  delegate = std::make_shared<OpacityPeepholePassDelegate>(paint);
+  ASSERT_FALSE(delegate->CanCollapseIntoParentPass(entity_pass.get()));
 }
 
 TEST_P(AiksTest, DrawPaintAbsorbsClears) {
@@ -14,6 +14,7 @@
 #include "impeller/entity/contents/atlas_contents.h"
 #include "impeller/entity/contents/clip_contents.h"
 #include "impeller/entity/contents/solid_rrect_blur_contents.h"
+#include "impeller/entity/contents/solid_rrect_contents.h"
 #include "impeller/entity/contents/text_contents.h"
 #include "impeller/entity/contents/texture_contents.h"
 #include "impeller/entity/contents/vertices_contents.h"
@@ -50,6 +51,7 @@ void Canvas::Reset() {
   base_pass_ = nullptr;
   current_pass_ = nullptr;
   xformation_stack_ = {};
+  text_merge_candidate_.reset();
 }
 
 void Canvas::Save() {
@@ -177,7 +179,7 @@ void Canvas::DrawPath(const Path& path, const Paint& paint) {
   entity.SetBlendMode(paint.blend_mode);
   entity.SetContents(paint.WithFilters(paint.CreateContentsForEntity(path)));
 
-  GetCurrentPass().AddEntity(entity);
+  AddEntityToCurrentPass(std::move(entity));
 }
 
 void Canvas::DrawPaint(const Paint& paint) {
@@ -187,7 +189,7 @@ void Canvas::DrawPaint(const Paint& paint) {
   entity.SetBlendMode(paint.blend_mode);
   entity.SetContents(paint.CreateContentsForEntity({}, true));
 
-  GetCurrentPass().AddEntity(entity);
+  AddEntityToCurrentPass(std::move(entity));
 }
 
 bool Canvas::AttemptDrawBlurredRRect(const Rect& rect,
@@ -221,7 +223,41 @@ bool Canvas::AttemptDrawBlurredRRect(const Rect& rect,
   entity.SetBlendMode(new_paint.blend_mode);
   entity.SetContents(new_paint.WithFilters(std::move(contents)));
 
-  GetCurrentPass().AddEntity(entity);
+  AddEntityToCurrentPass(std::move(entity));
+
+  return true;
+}
+
+bool Canvas::AttemptDrawSolidRRect(const Rect& rect,
+                                   Scalar corner_radius,
+                                   const Paint& paint) {
+  if (paint.color_source.GetType() != ColorSource::Type::kColor ||
+      paint.mask_blur_descriptor.has_value()) {
+    return false;
+  }
+
+  std::optional<Scalar> stroke_width;
+  if (paint.style == Paint::Style::kStroke) {
+    // Square corners need join handling that the distance field cannot
+    // express; only stroke rounded corners analytically.
+    if (corner_radius <= 0) {
+      return false;
+    }
+    stroke_width = paint.stroke_width;
+  }
+
+  auto contents = std::make_shared<SolidRRectContents>();
+  contents->SetColor(paint.color);
+  contents->SetRRect(rect, corner_radius);
+  contents->SetStrokeWidth(stroke_width);
+
+  Entity entity;
+  entity.SetTransformation(GetCurrentTransformation());
+  entity.SetClipDepth(GetClipDepth());
+  entity.SetBlendMode(paint.blend_mode);
+  entity.SetContents(paint.WithFilters(std::move(contents)));
+
+  AddEntityToCurrentPass(std::move(entity));
 
   return true;
 }
@@ -245,7 +281,7 @@ void Canvas::DrawLine(const Point& p0, const Point& p1, const Paint& paint) {
   entity.SetContents(paint.WithFilters(paint.CreateContentsForGeometry(
       Geometry::MakeLine(p0, p1, paint.stroke_width, paint.stroke_cap))));
 
-  GetCurrentPass().AddEntity(entity);
+  AddEntityToCurrentPass(std::move(entity));
 }
 
 void Canvas::DrawRect(Rect rect, const Paint& paint) {
@@ -265,13 +301,17 @@ void Canvas::DrawRect(Rect rect, const Paint& paint) {
   entity.SetContents(paint.WithFilters(
       paint.CreateContentsForGeometry(Geometry::MakeRect(rect))));
 
-  GetCurrentPass().AddEntity(entity);
+  AddEntityToCurrentPass(std::move(entity));
 }
 
 void Canvas::DrawRRect(Rect rect, Point corner_radii, const Paint& paint) {
-  if (corner_radii.x == corner_radii.y &&
-      AttemptDrawBlurredRRect(rect, corner_radii.x, paint)) {
-    return;
+  if (corner_radii.x == corner_radii.y) {
+    if (AttemptDrawBlurredRRect(rect, corner_radii.x, paint)) {
+      return;
+    }
+    if (AttemptDrawSolidRRect(rect, corner_radii.x, paint)) {
+      return;
+    }
   }
   auto path = PathBuilder{}
                   .SetConvexity(Convexity::kConvex)
@@ -286,7 +326,7 @@ void Canvas::DrawRRect(Rect rect, Point corner_radii, const Paint& paint) {
     entity.SetContents(paint.WithFilters(
         paint.CreateContentsForGeometry(Geometry::MakeFillPath(path))));
 
-    GetCurrentPass().AddEntity(entity);
+    AddEntityToCurrentPass(std::move(entity));
     return;
   }
   DrawPath(path, paint);
@@ -294,9 +334,11 @@ void Canvas::DrawRRect(Rect rect, Point corner_radii, const Paint& paint) {
 
 void Canvas::DrawCircle(Point center, Scalar radius, const Paint& paint) {
   Size half_size(radius, radius);
-  if (AttemptDrawBlurredRRect(
-          Rect::MakeOriginSize(center - half_size, half_size * 2), radius,
-          paint)) {
+  Rect bounds = Rect::MakeOriginSize(center - half_size, half_size * 2);
+  if (AttemptDrawBlurredRRect(bounds, radius, paint)) {
+    return;
+  }
+  if (AttemptDrawSolidRRect(bounds, radius, paint)) {
     return;
   }
   auto circle_path =
@@ -401,7 +443,7 @@ void Canvas::ClipGeometry(std::unique_ptr<Geometry> geometry,
   entity.SetContents(std::move(contents));
   entity.SetClipDepth(GetClipDepth());
 
-  GetCurrentPass().AddEntity(entity);
+  AddEntityToCurrentPass(std::move(entity));
 
   ++xformation_stack_.back().clip_depth;
   xformation_stack_.back().contains_clips = true;
@@ -440,7 +482,7 @@ void Canvas::RestoreClip() {
   entity.SetContents(std::make_shared<ClipRestoreContents>());
   entity.SetClipDepth(GetClipDepth());
 
-  GetCurrentPass().AddEntity(entity);
+  AddEntityToCurrentPass(std::move(entity));
 }
 
 void Canvas::DrawPoints(std::vector<Point> points,
@@ -459,7 +501,7 @@ void Canvas::DrawPoints(std::vector<Point> points,
       Geometry::MakePointField(std::move(points), radius,
                                /*round=*/point_style == PointStyle::kRound))));
 
-  GetCurrentPass().AddEntity(entity);
+  AddEntityToCurrentPass(std::move(entity));
 }
 
 void Canvas::DrawPicture(const Picture& picture) {
@@ -534,7 +576,7 @@ void Canvas::DrawImageRect(const std::shared_ptr<Image>& image,
   entity.SetContents(paint.WithFilters(contents));
   entity.SetTransformation(GetCurrentTransformation());
 
-  GetCurrentPass().AddEntity(entity);
+  AddEntityToCurrentPass(std::move(entity));
 }
 
 Picture Canvas::EndRecordingAsPicture() {
@@ -552,6 +594,21 @@ EntityPass& Canvas::GetCurrentPass() {
   return *current_pass_;
 }
 
+void Canvas::AddEntityToCurrentPass(Entity entity) {
+  // Cull entities that lie entirely outside of the running culling bounds.
+  // The cull rect is a conservative superset of the current clip coverage, so
+  // anything `Entity::ShouldRender` rejects against it would also be dropped
+  // at render time; culling here avoids ever building contents geometry or
+  // commands for it. Clip entities are never culled since
+  // `ClipContents::ShouldRender` always returns true, which keeps the clip
+  // depth bookkeeping intact.
+  const std::optional<Rect>& cull_rect = xformation_stack_.back().cull_rect;
+  if (cull_rect.has_value() && !entity.ShouldRender(cull_rect)) {
+    return;
+  }
+  GetCurrentPass().AddEntity(std::move(entity));
+}
+
 size_t Canvas::GetClipDepth() const {
   return xformation_stack_.back().clip_depth;
 }
@@ -574,9 +631,68 @@ void Canvas::SaveLayer(const Paint& paint,
   }
 }
 
+bool Canvas::TryMergeTextFrame(const std::shared_ptr<TextFrame>& text_frame,
+                               const Matrix& transform,
+                               const Paint& paint) {
+  if (!text_merge_candidate_.has_value()) {
+    return false;
+  }
+  // Candidates are only ever recorded for unfiltered draws, so a draw that
+  // would wrap its contents in filters can never match one.
+  if (paint.image_filter || paint.HasColorFilter() ||
+      paint.mask_blur_descriptor.has_value()) {
+    return false;
+  }
+  const TextMergeCandidate& candidate = text_merge_candidate_.value();
+  EntityPass& pass = GetCurrentPass();
+  if (candidate.pass != &pass ||
+      pass.GetElementCount() != candidate.element_count) {
+    // Something else was drawn since the candidate was recorded, so merging
+    // would reorder draws.
+    return false;
+  }
+  if (candidate.blend_mode != paint.blend_mode ||
+      candidate.clip_depth != GetClipDepth() ||
+      !(candidate.color == paint.color) ||
+      candidate.atlas_type != text_frame->GetAtlasType()) {
+    return false;
+  }
+  // The translation delta is folded into the local glyph positions, which is
+  // only exact when the basis is a plain scale shared by both draws.
+  if (!transform.IsTranslationScaleOnly() ||
+      !candidate.transform.IsTranslationScaleOnly()) {
+    return false;
+  }
+  Scalar scale_x = candidate.transform.m[0];
+  Scalar scale_y = candidate.transform.m[5];
+  if (transform.m[0] != scale_x || transform.m[5] != scale_y ||
+      transform.m[10] != candidate.transform.m[10] ||
+      transform.m[14] != candidate.transform.m[14] ||
+      ScalarNearlyZero(scale_x) || ScalarNearlyZero(scale_y)) {
+    return false;
+  }
+  Vector2 local_offset((transform.m[12] - candidate.transform.m[12]) / scale_x,
+                       (transform.m[13] - candidate.transform.m[13]) / scale_y);
+  candidate.contents->AppendTextFrame(text_frame, local_offset);
+  return true;
+}
+
+// The glyph blur shader's fixed 5x5 kernel spaces its taps one standard
+// deviation apart, which starts to visibly undersample the gaussian once a
+// standard deviation spans more than a few atlas texels.
+static constexpr Scalar kMaxFixedKernelBlurSigma = 4.0f;
+
 void Canvas::DrawTextFrame(const std::shared_ptr<TextFrame>& text_frame,
                            Point position,
                            const Paint& paint) {
+  Matrix transform =
+      GetCurrentTransformation() * Matrix::MakeTranslation(position);
+
+  if (TryMergeTextFrame(text_frame, transform, paint)) {
+    return;
+  }
+  text_merge_candidate_.reset();
+
   Entity entity;
   entity.SetClipDepth(GetClipDepth());
   entity.SetBlendMode(paint.blend_mode);
@@ -585,8 +701,24 @@ void Canvas::DrawTextFrame(const std::shared_ptr<TextFrame>& text_frame,
   text_contents->SetTextFrame(text_frame);
   text_contents->SetColor(paint.color);
 
-  entity.SetTransformation(GetCurrentTransformation() *
-                           Matrix::MakeTranslation(position));
+  entity.SetTransformation(transform);
+
+  // Text shadows are solid-color draws with a small `kNormal` mask blur.
+  // Those can blur the glyph coverage directly in the glyph shader with a
+  // fixed kernel, which avoids the multi-pass gaussian filter and its
+  // offscreen passes that `WithMaskBlur` would otherwise set up.
+  bool fixed_kernel_blur = false;
+  if (paint.mask_blur_descriptor.has_value() &&
+      paint.mask_blur_descriptor->style == FilterContents::BlurStyle::kNormal &&
+      !paint.image_filter && !paint.HasColorFilter() &&
+      text_frame->GetAtlasType() == GlyphAtlas::Type::kAlphaBitmap) {
+    Scalar sigma = paint.mask_blur_descriptor->sigma.sigma;
+    Scalar screen_sigma = sigma * transform.GetMaxBasisLengthXY();
+    if (sigma > 0 && screen_sigma <= kMaxFixedKernelBlurSigma) {
+      text_contents->SetMaskBlurSigma(sigma);
+      fixed_kernel_blur = true;
+    }
+  }
 
   // TODO(bdero): This mask blur application is a hack. It will always wind up
   //              doing a gaussian blur that affects the color source itself
@@ -594,10 +726,32 @@ void Canvas::DrawTextFrame(const std::shared_ptr<TextFrame>& text_frame,
   //              needs to be reworked in order to interact correctly with
   //              mask filters.
   //              https://github.com/flutter/flutter/issues/133297
-  entity.SetContents(
-      paint.WithFilters(paint.WithMaskBlur(std::move(text_contents), true)));
+  std::shared_ptr<Contents> contents =
+      fixed_kernel_blur
+          ? text_contents
+          : paint.WithFilters(paint.WithMaskBlur(text_contents, true));
+  bool filtered = fixed_kernel_blur || contents != text_contents;
+  entity.SetContents(std::move(contents));
+
+  EntityPass& pass = GetCurrentPass();
+  size_t element_count = pass.GetElementCount();
+  AddEntityToCurrentPass(std::move(entity));
 
-  GetCurrentPass().AddEntity(entity);
+  // Unfiltered text draws that actually landed in the pass become candidates
+  // for merging subsequent compatible draws. Anything drawn in between bumps
+  // the element count, which invalidates the candidate.
+  if (!filtered && pass.GetElementCount() == element_count + 1) {
+    text_merge_candidate_ = TextMergeCandidate{
+        .contents = std::move(text_contents),
+        .transform = transform,
+        .blend_mode = paint.blend_mode,
+        .clip_depth = GetClipDepth(),
+        .color = paint.color,
+        .atlas_type = text_frame->GetAtlasType(),
+        .pass = &pass,
+        .element_count = pass.GetElementCount(),
+    };
+  }
 }
 
 static bool UseColorSourceContents(
@@ -637,7 +791,7 @@ void Canvas::DrawVertices(const std::shared_ptr<VerticesGeometry>& vertices,
   if (UseColorSourceContents(vertices, paint)) {
     auto contents = paint.CreateContentsForGeometry(vertices);
     entity.SetContents(paint.WithFilters(std::move(contents)));
-    GetCurrentPass().AddEntity(entity);
+    AddEntityToCurrentPass(std::move(entity));
     return;
   }
 
@@ -675,7 +829,7 @@ void Canvas::DrawVertices(const std::shared_ptr<VerticesGeometry>& vertices,
   contents->SetSourceContents(std::move(src_contents));
   entity.SetContents(paint.WithFilters(std::move(contents)));
 
-  GetCurrentPass().AddEntity(entity);
+  AddEntityToCurrentPass(std::move(entity));
 }
 
 void Canvas::DrawAtlas(const std::shared_ptr<Image>& atlas,
@@ -706,7 +860,7 @@ void Canvas::DrawAtlas(const std::shared_ptr<Image>& atlas,
   entity.SetBlendMode(paint.blend_mode);
   entity.SetContents(paint.WithFilters(contents));
 
-  GetCurrentPass().AddEntity(entity);
+  AddEntityToCurrentPass(std::move(entity));
 }
 
 }  // namespace impeller
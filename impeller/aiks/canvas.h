@@ -29,6 +29,7 @@
 namespace impeller {
 
 class Entity;
+class TextContents;
 
 struct CanvasStackEntry {
   Matrix xformation;
@@ -162,10 +163,27 @@ class Canvas {
   Picture EndRecordingAsPicture();
 
  private:
+  //----------------------------------------------------------------------------
+  /// @brief  Bookkeeping for merging adjacent compatible text draws into a
+  ///         single entity. The candidate is only valid while it remains the
+  ///         last element of the pass it was recorded against.
+  ///
+  struct TextMergeCandidate {
+    std::shared_ptr<TextContents> contents;
+    Matrix transform;
+    BlendMode blend_mode = BlendMode::kSourceOver;
+    size_t clip_depth = 0;
+    Color color;
+    GlyphAtlas::Type atlas_type = GlyphAtlas::Type::kAlphaBitmap;
+    EntityPass* pass = nullptr;
+    size_t element_count = 0;
+  };
+
   std::unique_ptr<EntityPass> base_pass_;
   EntityPass* current_pass_ = nullptr;
   std::deque<CanvasStackEntry> xformation_stack_;
   std::optional<Rect> initial_cull_rect_;
+  std::optional<TextMergeCandidate> text_merge_candidate_;
 
   void Initialize(std::optional<Rect> cull_rect);
 
@@ -173,6 +191,14 @@ class Canvas {
 
   EntityPass& GetCurrentPass();
 
+  //----------------------------------------------------------------------------
+  /// @brief  Adds the entity to the current pass, unless its coverage lies
+  ///         entirely outside of the current culling bounds, in which case
+  ///         the entity is dropped without ever building geometry or
+  ///         commands for it.
+  ///
+  void AddEntityToCurrentPass(Entity entity);
+
   size_t GetClipDepth() const;
 
   void ClipGeometry(std::unique_ptr<Geometry> geometry,
@@ -191,6 +217,21 @@ class Canvas {
                                Scalar corner_radius,
                                const Paint& paint);
 
+  //----------------------------------------------------------------------------
+  /// @brief  Attempts to append the text frame to the previous text entity
+  ///         instead of emitting a new draw. Only succeeds when the previous
+  ///         entity is still the last element of the current pass and shares
+  ///         the paint, clip depth, atlas type, and scale of this draw, with
+  ///         a transform that differs only by translation.
+  ///
+  bool TryMergeTextFrame(const std::shared_ptr<TextFrame>& text_frame,
+                         const Matrix& transform,
+                         const Paint& paint);
+
+  bool AttemptDrawSolidRRect(const Rect& rect,
+                             Scalar corner_radius,
+                             const Paint& paint);
+
   Canvas(const Canvas&) = delete;
 
   Canvas& operator=(const Canvas&) = delete;
@@ -336,6 +336,43 @@ TEST(AiksCanvasTest, PathClipDiffAgainstFullyCoveredCullRect) {
   ASSERT_EQ(canvas.GetCurrentLocalCullingBounds().value(), result_cull);
 }
 
+TEST(AiksCanvasTest, DrawsOutsideCullRectAreCulled) {
+  Canvas canvas(Rect::MakeXYWH(0, 0, 100, 100));
+  Paint paint;
+
+  canvas.DrawCircle(Point(50, 50), 10, paint);
+  canvas.DrawCircle(Point(500, 500), 10, paint);
+
+  Picture picture = canvas.EndRecordingAsPicture();
+  ASSERT_EQ(picture.pass->GetElementCount(), 1u);
+}
+
+TEST(AiksCanvasTest, DrawsAreNotCulledWithoutCullRect) {
+  Canvas canvas;
+  Paint paint;
+
+  canvas.DrawCircle(Point(50, 50), 10, paint);
+  canvas.DrawCircle(Point(500, 500), 10, paint);
+
+  Picture picture = canvas.EndRecordingAsPicture();
+  ASSERT_EQ(picture.pass->GetElementCount(), 2u);
+}
+
+TEST(AiksCanvasTest, DrawsOutsideIntersectClipAreCulled) {
+  Canvas canvas;
+  Paint paint;
+
+  canvas.ClipRect(Rect::MakeXYWH(0, 0, 100, 100),
+                  Entity::ClipOperation::kIntersect);
+  canvas.DrawCircle(Point(50, 50), 10, paint);
+  canvas.DrawCircle(Point(500, 500), 10, paint);
+
+  Picture picture = canvas.EndRecordingAsPicture();
+  // The clip entity and the visible circle survive; the offscreen circle is
+  // dropped at record time.
+  ASSERT_EQ(picture.pass->GetElementCount(), 2u);
+}
+
 }  // namespace testing
 }  // namespace impeller
 
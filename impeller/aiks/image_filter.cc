@@ -21,9 +21,10 @@ std::shared_ptr<ImageFilter> ImageFilter::MakeBlur(
     Sigma sigma_x,
     Sigma sigma_y,
     FilterContents::BlurStyle blur_style,
-    Entity::TileMode tile_mode) {
+    Entity::TileMode tile_mode,
+    FilterContents::BlurQuality quality) {
   return std::make_shared<BlurImageFilter>(sigma_x, sigma_y, blur_style,
-                                           tile_mode);
+                                           tile_mode, quality);
 }
 
 std::shared_ptr<ImageFilter> ImageFilter::MakeDilate(Radius radius_x,
@@ -71,18 +72,20 @@ std::shared_ptr<FilterContents> ImageFilter::GetFilterContents() const {
 BlurImageFilter::BlurImageFilter(Sigma sigma_x,
                                  Sigma sigma_y,
                                  FilterContents::BlurStyle blur_style,
-                                 Entity::TileMode tile_mode)
+                                 Entity::TileMode tile_mode,
+                                 FilterContents::BlurQuality quality)
     : sigma_x_(sigma_x),
       sigma_y_(sigma_y),
       blur_style_(blur_style),
-      tile_mode_(tile_mode) {}
+      tile_mode_(tile_mode),
+      quality_(quality) {}
 
 BlurImageFilter::~BlurImageFilter() = default;
 
 std::shared_ptr<FilterContents> BlurImageFilter::WrapInput(
     const FilterInput::Ref& input) const {
   return FilterContents::MakeGaussianBlur(input, sigma_x_, sigma_y_,
-                                          blur_style_, tile_mode_);
+                                          blur_style_, tile_mode_, quality_);
 }
 
 std::shared_ptr<ImageFilter> BlurImageFilter::Clone() const {
@@ -48,7 +48,9 @@ class ImageFilter {
       Sigma sigma_x,
       Sigma sigma_y,
       FilterContents::BlurStyle blur_style,
-      Entity::TileMode tile_mode);
+      Entity::TileMode tile_mode,
+      FilterContents::BlurQuality quality =
+          FilterContents::BlurQuality::kHigh);
 
   static std::shared_ptr<ImageFilter> MakeDilate(Radius radius_x,
                                                  Radius radius_y);
@@ -97,7 +99,9 @@ class BlurImageFilter : public ImageFilter {
   BlurImageFilter(Sigma sigma_x,
                   Sigma sigma_y,
                   FilterContents::BlurStyle blur_style,
-                  Entity::TileMode tile_mode);
+                  Entity::TileMode tile_mode,
+                  FilterContents::BlurQuality quality =
+                      FilterContents::BlurQuality::kHigh);
 
   ~BlurImageFilter() override;
 
@@ -116,6 +120,7 @@ class BlurImageFilter : public ImageFilter {
   Sigma sigma_y_;
   FilterContents::BlurStyle blur_style_;
   Entity::TileMode tile_mode_;
+  FilterContents::BlurQuality quality_;
 };
 
 /*******************************************************************************
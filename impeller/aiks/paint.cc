@@ -63,7 +63,7 @@ std::shared_ptr<Contents> Paint::CreateContentsForGeometry(
     // we need to be careful to only apply the color filter to the source
     // colors. CreateMaskBlur is able to handle this case.
     return mask_blur_descriptor->CreateMaskBlur(
-        contents, needs_color_filter ? color_filter : nullptr);
+        contents, needs_color_filter ? color_filter : nullptr, blur_quality);
   }
 
   return contents;
@@ -96,7 +96,7 @@ std::shared_ptr<Contents> Paint::WithMaskBlur(std::shared_ptr<Contents> input,
                                               bool is_solid_color) const {
   if (mask_blur_descriptor.has_value()) {
     input = mask_blur_descriptor->CreateMaskBlur(FilterInput::Make(input),
-                                                 is_solid_color);
+                                                 is_solid_color, blur_quality);
   }
   return input;
 }
@@ -140,13 +140,14 @@ std::shared_ptr<Contents> Paint::WithColorFilter(
 
 std::shared_ptr<FilterContents> Paint::MaskBlurDescriptor::CreateMaskBlur(
     std::shared_ptr<ColorSourceContents> color_source_contents,
-    const std::shared_ptr<ColorFilter>& color_filter) const {
+    const std::shared_ptr<ColorFilter>& color_filter,
+    FilterContents::BlurQuality quality) const {
   // If it's a solid color and there is no color filter, then we can just get
   // away with doing one Gaussian blur.
   if (color_source_contents->IsSolidColor() && !color_filter) {
     return FilterContents::MakeGaussianBlur(
         FilterInput::Make(color_source_contents), sigma, sigma, style,
-        Entity::TileMode::kDecal);
+        Entity::TileMode::kDecal, quality);
   }
 
   /// 1. Create an opaque white mask of the original geometry.
@@ -158,7 +159,8 @@ std::shared_ptr<FilterContents> Paint::MaskBlurDescriptor::CreateMaskBlur(
   /// 2. Blur the mask.
 
   auto blurred_mask = FilterContents::MakeGaussianBlur(
-      FilterInput::Make(mask), sigma, sigma, style, Entity::TileMode::kDecal);
+      FilterInput::Make(mask), sigma, sigma, style, Entity::TileMode::kDecal,
+      quality);
 
   /// 3. Replace the geometry of the original color source with a rectangle that
   ///    covers the full region of the blurred mask. Note that geometry is in
@@ -190,10 +192,11 @@ std::shared_ptr<FilterContents> Paint::MaskBlurDescriptor::CreateMaskBlur(
 
 std::shared_ptr<FilterContents> Paint::MaskBlurDescriptor::CreateMaskBlur(
     const FilterInput::Ref& input,
-    bool is_solid_color) const {
+    bool is_solid_color,
+    FilterContents::BlurQuality quality) const {
   if (is_solid_color) {
-    return FilterContents::MakeGaussianBlur(input, sigma, sigma, style,
-                                            Entity::TileMode::kDecal);
+    return FilterContents::MakeGaussianBlur(
+        input, sigma, sigma, style, Entity::TileMode::kDecal, quality);
   }
   return FilterContents::MakeBorderMaskBlur(input, sigma, sigma, style);
 }
@@ -44,11 +44,13 @@ struct Paint {
 
     std::shared_ptr<FilterContents> CreateMaskBlur(
         std::shared_ptr<ColorSourceContents> color_source_contents,
-        const std::shared_ptr<ColorFilter>& color_filter) const;
+        const std::shared_ptr<ColorFilter>& color_filter,
+        FilterContents::BlurQuality quality) const;
 
     std::shared_ptr<FilterContents> CreateMaskBlur(
         const FilterInput::Ref& input,
-        bool is_solid_color) const;
+        bool is_solid_color,
+        FilterContents::BlurQuality quality) const;
   };
 
   Color color = Color::Black();
@@ -67,6 +69,10 @@ struct Paint {
   std::shared_ptr<ColorFilter> color_filter;
   std::optional<MaskBlurDescriptor> mask_blur_descriptor;
 
+  /// The quality/bandwidth trade-off for any Gaussian blurs this paint
+  /// produces. See `FilterContents::BlurQuality`.
+  FilterContents::BlurQuality blur_quality = FilterContents::BlurQuality::kHigh;
+
   std::shared_ptr<ColorFilter> GetColorFilter() const;
 
   /// @brief      Wrap this paint's configured filters to the given contents.
@@ -14,6 +14,16 @@
 
 namespace impeller {
 
+namespace {
+// The maximum number of elements in a pass that the opacity peephole will
+// attempt to fold. The all-pairs coverage intersection check below is
+// quadratic in the number of drawing commands, so the bound is kept small
+// enough that the record time cost stays negligible while still covering
+// typical faded list items: a clip, a handful of non-overlapping draws (rect
+// batches, images, text runs), and a restore.
+constexpr size_t kMaxOpacityPeepholeElementCount = 10u;
+}  // namespace
+
 /// PaintPassDelegate
 /// ----------------------------------------------
 
@@ -84,19 +94,12 @@ bool OpacityPeepholePassDelegate::CanCollapseIntoParentPass(
     return false;
   }
 
-  // Note: determing whether any coverage intersects has quadradic complexity in
-  // the number of rectangles, and depending on whether or not we cache at
-  // different levels of the entity tree may end up cubic. In the interest of
-  // proving whether or not this optimization is valuable, we only consider very
-  // simple peephole optimizations here - where there is a single drawing
-  // command wrapped in save layer. This would indicate something like an
-  // Opacity or FadeTransition wrapping a very simple widget, like in the
-  // CupertinoPicker.
-  if (entity_pass->GetElementCount() > 3) {
-    // Single paint command with a save layer would be:
-    // 1. clip
-    // 2. draw command
-    // 3. restore.
+  // Note: determing whether any coverage intersects has quadradic complexity
+  // in the number of rectangles, and depending on whether or not we cache at
+  // different levels of the entity tree may end up cubic. Limiting the element
+  // count keeps that check cheap while still covering something like an
+  // Opacity or FadeTransition wrapping a typical list item.
+  if (entity_pass->GetElementCount() > kMaxOpacityPeepholeElementCount) {
     return false;
   }
   bool all_can_accept = true;
@@ -48,8 +48,9 @@ class PaintPassDelegate final : public EntityPassDelegate {
 /// A delegate that attempts to forward opacity from a save layer to
 /// child contents.
 ///
-/// Currently this has a hardcoded limit of 3 entities in a pass, and
-/// cannot forward to child subpass delegates.
+/// Currently this has a small hardcoded limit on the number of entities in a
+/// pass, only folds when no two entity coverages overlap, and cannot forward
+/// to child subpass delegates.
 class OpacityPeepholePassDelegate final : public EntityPassDelegate {
  public:
   explicit OpacityPeepholePassDelegate(Paint paint);
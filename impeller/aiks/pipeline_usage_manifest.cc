@@ -0,0 +1,122 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/aiks/pipeline_usage_manifest.h"
+
+#include <sstream>
+
+#include "flutter/fml/file.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/mapping.h"
+
+namespace impeller {
+
+namespace {
+
+// First line of the manifest file. Bumped whenever the file format changes;
+// manifests with a different header are discarded wholesale.
+constexpr const char* kManifestHeader = "impeller-pso-usage v1";
+
+}  // namespace
+
+PipelineUsageManifest::PipelineUsageManifest(const std::string& directory) {
+  directory_ = fml::OpenDirectory(directory.c_str(),
+                                  /*create_if_necessary=*/true,
+                                  fml::FilePermission::kReadWrite);
+  if (!directory_.is_valid()) {
+    FML_LOG(INFO) << "Could not open pipeline usage manifest directory: "
+                  << directory;
+    return;
+  }
+  is_valid_ = true;
+
+  auto mapping = fml::FileMapping::CreateReadOnly(directory_,  //
+                                                  kManifestFileName);
+  if (!mapping || mapping->GetSize() == 0u) {
+    // No manifest yet; the first session writes one on teardown.
+    return;
+  }
+
+  std::istringstream stream(std::string(
+      reinterpret_cast<const char*>(mapping->GetMapping()),  //
+      mapping->GetSize()));
+  std::string header;
+  std::getline(stream, header);
+  if (header != kManifestHeader) {
+    return;
+  }
+  std::string line;
+  while (std::getline(stream, line)) {
+    std::istringstream line_stream(line);
+    std::string family;
+    uint64_t key = 0u;
+    if (!(line_stream >> family >> std::hex >> key)) {
+      continue;
+    }
+    if (known_entries_.insert({family, key}).second) {
+      entries_.emplace_back(family, key);
+    }
+  }
+}
+
+PipelineUsageManifest::~PipelineUsageManifest() {
+  Save();
+}
+
+bool PipelineUsageManifest::IsValid() const {
+  return is_valid_;
+}
+
+std::vector<std::pair<std::string, ContentContextOptions>>
+PipelineUsageManifest::GetKnownVariants() const {
+  std::vector<std::pair<std::string, ContentContextOptions>> variants;
+  std::scoped_lock lock(mutex_);
+  variants.reserve(entries_.size());
+  for (const auto& [family, key] : entries_) {
+    auto options = ContentContextOptions::FromKey(key);
+    if (!options.has_value()) {
+      continue;
+    }
+    variants.emplace_back(family, options.value());
+  }
+  return variants;
+}
+
+void PipelineUsageManifest::RecordUsage(const std::string& family,
+                                        const ContentContextOptions& options) {
+  const uint64_t key = options.ToKey();
+  std::scoped_lock lock(mutex_);
+  if (!known_entries_.insert({family, key}).second) {
+    return;
+  }
+  entries_.emplace_back(family, key);
+  dirty_ = true;
+}
+
+bool PipelineUsageManifest::Save() {
+  if (!is_valid_) {
+    return false;
+  }
+  std::ostringstream stream;
+  {
+    std::scoped_lock lock(mutex_);
+    if (!dirty_) {
+      return true;
+    }
+    stream << kManifestHeader << "\n";
+    for (const auto& [family, key] : entries_) {
+      stream << family << " " << std::hex << key << "\n";
+    }
+    dirty_ = false;
+  }
+  auto contents = stream.str();
+  if (!fml::WriteAtomically(directory_, kManifestFileName,
+                            fml::DataMapping(contents))) {
+    FML_LOG(INFO) << "Could not write pipeline usage manifest.";
+    return false;
+  }
+  return true;
+}
+
+}  // namespace impeller
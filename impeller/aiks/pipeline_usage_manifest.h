@@ -0,0 +1,76 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "flutter/fml/unique_fd.h"
+#include "impeller/entity/contents/content_context.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      A persistent record of the pipeline variants used by previous
+///             sessions.
+///
+///             The first use of a new blend/geometry combination compiles a
+///             pipeline state object at draw time, which can hitch the first
+///             frame that needs it. The manifest records, per pipeline
+///             family, the `ContentContextOptions` variants a session
+///             actually requested so the next launch can pre-create exactly
+///             those variants before the first frame.
+///
+///             The manifest is a small text file inside the supplied
+///             directory. All methods are thread-safe.
+class PipelineUsageManifest {
+ public:
+  static constexpr const char* kManifestFileName =
+      "impeller_pso_usage.manifest";
+
+  /// Opens (or prepares to create) the manifest inside `directory`, creating
+  /// the directory if needed.
+  explicit PipelineUsageManifest(const std::string& directory);
+
+  ~PipelineUsageManifest();
+
+  bool IsValid() const;
+
+  /// The variants recorded by previous sessions, in the order they were
+  /// first used. Entries whose family or options fail to decode (for
+  /// example, ones written by a different engine version) are skipped.
+  std::vector<std::pair<std::string, ContentContextOptions>> GetKnownVariants()
+      const;
+
+  /// Records that this session used the given variant. New entries are
+  /// written back to disk by `Save`, which is called at the latest from the
+  /// destructor.
+  void RecordUsage(const std::string& family,
+                   const ContentContextOptions& options);
+
+  /// Writes the manifest back to disk if any new variants were recorded
+  /// since the last save. Returns true if nothing needed saving or the write
+  /// succeeded.
+  bool Save();
+
+ private:
+  fml::UniqueFD directory_;
+  bool is_valid_ = false;
+
+  mutable std::mutex mutex_;
+  // All entries, both loaded and newly recorded, in first-use order.
+  std::vector<std::pair<std::string, uint64_t>> entries_;
+  std::set<std::pair<std::string, uint64_t>> known_entries_;
+  bool dirty_ = false;
+
+  PipelineUsageManifest(const PipelineUsageManifest&) = delete;
+
+  PipelineUsageManifest& operator=(const PipelineUsageManifest&) = delete;
+};
+
+}  // namespace impeller
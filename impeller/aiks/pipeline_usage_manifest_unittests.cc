@@ -0,0 +1,95 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/file.h"
+#include "flutter/testing/testing.h"
+#include "impeller/aiks/pipeline_usage_manifest.h"
+
+namespace impeller {
+namespace testing {
+
+TEST(ContentContextOptionsKey, RoundTripsThroughKey) {
+  ContentContextOptions options;
+  options.sample_count = SampleCount::kCount4;
+  options.blend_mode = BlendMode::kColorBurn;
+  options.stencil_compare = CompareFunction::kGreaterEqual;
+  options.stencil_operation = StencilOperation::kDecrementWrap;
+  options.primitive_type = PrimitiveType::kTriangleStrip;
+  options.color_attachment_pixel_format = PixelFormat::kB8G8R8A8UNormInt;
+  options.has_stencil_attachment = false;
+  options.wireframe = true;
+  options.is_for_rrect_blur_clear = true;
+
+  auto decoded = ContentContextOptions::FromKey(options.ToKey());
+  ASSERT_TRUE(decoded.has_value());
+  ASSERT_TRUE(ContentContextOptions::Equal{}(options, decoded.value()));
+}
+
+TEST(ContentContextOptionsKey, RejectsMalformedKeys) {
+  // Unknown format version.
+  ASSERT_FALSE(ContentContextOptions::FromKey(0u).has_value());
+  // Out-of-range blend mode.
+  uint64_t key = ContentContextOptions{}.ToKey();
+  ASSERT_FALSE(ContentContextOptions::FromKey(key | 0xffu).has_value());
+  // Reserved bits set.
+  ASSERT_FALSE(ContentContextOptions::FromKey(key | (1ull << 45)).has_value());
+}
+
+TEST(PipelineUsageManifest, PersistsRecordedVariantsAcrossSessions) {
+  fml::ScopedTemporaryDirectory temp_dir;
+
+  ContentContextOptions options;
+  options.blend_mode = BlendMode::kPlus;
+  options.primitive_type = PrimitiveType::kTriangleStrip;
+
+  {
+    PipelineUsageManifest manifest(temp_dir.path());
+    ASSERT_TRUE(manifest.IsValid());
+    ASSERT_TRUE(manifest.GetKnownVariants().empty());
+    manifest.RecordUsage("SolidFill", options);
+    manifest.RecordUsage("SolidFill", options);  // Duplicates are dropped.
+    manifest.RecordUsage("Texture", ContentContextOptions{});
+    ASSERT_TRUE(manifest.Save());
+  }
+
+  PipelineUsageManifest manifest(temp_dir.path());
+  ASSERT_TRUE(manifest.IsValid());
+  auto variants = manifest.GetKnownVariants();
+  ASSERT_EQ(variants.size(), 2u);
+  EXPECT_EQ(variants[0].first, "SolidFill");
+  EXPECT_TRUE(ContentContextOptions::Equal{}(variants[0].second, options));
+  EXPECT_EQ(variants[1].first, "Texture");
+}
+
+TEST(PipelineUsageManifest, PersistsRuntimeEffectVariants) {
+  // The family name embeds the shader's code hash so the next session can
+  // match the recorded variants to the shader once it is loaded. The format
+  // must stay stable across engine revisions.
+  ASSERT_EQ(ContentContext::RuntimeEffectFamilyName(0xabc123u),
+            "runtime_effect/abc123");
+
+  fml::ScopedTemporaryDirectory temp_dir;
+
+  ContentContextOptions options;
+  options.sample_count = SampleCount::kCount4;
+  options.blend_mode = BlendMode::kSourceOver;
+
+  {
+    PipelineUsageManifest manifest(temp_dir.path());
+    ASSERT_TRUE(manifest.IsValid());
+    manifest.RecordUsage(ContentContext::RuntimeEffectFamilyName(0xabc123u),
+                         options);
+    ASSERT_TRUE(manifest.Save());
+  }
+
+  PipelineUsageManifest manifest(temp_dir.path());
+  ASSERT_TRUE(manifest.IsValid());
+  auto variants = manifest.GetKnownVariants();
+  ASSERT_EQ(variants.size(), 1u);
+  EXPECT_EQ(variants[0].first, "runtime_effect/abc123");
+  EXPECT_TRUE(ContentContextOptions::Equal{}(variants[0].second, options));
+}
+
+}  // namespace testing
+}  // namespace impeller
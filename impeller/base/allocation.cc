@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <cstring>
 
+#include "flutter/fml/allocation_metrics.h"
 #include "flutter/fml/logging.h"
 #include "impeller/base/validation.h"
 
@@ -75,6 +76,8 @@ bool Allocation::Reserve(size_t reserved) {
     return false;
   }
 
+  fml::AllocationMetrics::RecordAllocation(reserved - reserved_,
+                                           "impeller host memory");
   buffer_ = static_cast<uint8_t*>(new_allocation);
   reserved_ = reserved;
 
@@ -46,7 +46,8 @@ class IPLR_CAPABILITY("mutex") Mutex {
 class IPLR_CAPABILITY("mutex") RWMutex {
  public:
   RWMutex()
-      : mutex_(std::unique_ptr<fml::SharedMutex>(fml::SharedMutex::Create())) {}
+      : mutex_(std::unique_ptr<fml::SharedMutex>(
+            fml::SharedMutex::Create("ImpellerRWMutex"))) {}
 
   ~RWMutex() = default;
 
@@ -2,8 +2,14 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
+#include <mutex>
+#include <sstream>
 #include <system_error>
+#include <thread>
+#include <vector>
 
 #include "flutter/fml/backtrace.h"
 #include "flutter/fml/command_line.h"
@@ -22,38 +28,30 @@ namespace impeller {
 namespace compiler {
 
 // Sets the file access mode of the file at path 'p' to 0644.
-static bool SetPermissiveAccess(const std::filesystem::path& p) {
+static bool SetPermissiveAccess(const std::filesystem::path& p,
+                                std::ostream& error_stream) {
   auto permissions =
       std::filesystem::perms::owner_read | std::filesystem::perms::owner_write |
       std::filesystem::perms::group_read | std::filesystem::perms::others_read;
   std::error_code error;
   std::filesystem::permissions(p, permissions, error);
   if (error) {
-    std::cerr << "Failed to set access on file '" << p
-              << "': " << error.message() << std::endl;
+    error_stream << "Failed to set access on file '" << p
+                 << "': " << error.message() << std::endl;
     return false;
   }
   return true;
 }
 
-bool Main(const fml::CommandLine& command_line) {
-  fml::InstallCrashHandler();
-  if (command_line.HasOption("help")) {
-    Switches::PrintHelp(std::cout);
-    return true;
-  }
-
-  Switches switches(command_line);
-  if (!switches.AreValid(std::cerr)) {
-    std::cerr << "Invalid flags specified." << std::endl;
-    Switches::PrintHelp(std::cerr);
-    return false;
-  }
-
+// Performs a single shader compilation described by the given (already
+// validated) switches. Errors are written to |error_stream| so batch mode can
+// report them without interleaving output from parallel jobs.
+static bool CompileShader(const Switches& switches,
+                          std::ostream& error_stream) {
   std::shared_ptr<fml::FileMapping> source_file_mapping =
       fml::FileMapping::CreateReadOnly(switches.source_file_name);
   if (!source_file_mapping) {
-    std::cerr << "Could not open input file." << std::endl;
+    error_stream << "Could not open input file." << std::endl;
     return false;
   }
 
@@ -98,8 +96,8 @@ bool Main(const fml::CommandLine& command_line) {
     Compiler sksl_compiler =
         Compiler(source_file_mapping, sksl_options, sksl_reflector_options);
     if (!sksl_compiler.IsValid()) {
-      std::cerr << "Compilation to SkSL failed." << std::endl;
-      std::cerr << sksl_compiler.GetErrorMessages() << std::endl;
+      error_stream << "Compilation to SkSL failed." << std::endl;
+      error_stream << sksl_compiler.GetErrorMessages() << std::endl;
       return false;
     }
     sksl_mapping = sksl_compiler.GetSLShaderSource();
@@ -107,8 +105,8 @@ bool Main(const fml::CommandLine& command_line) {
 
   Compiler compiler(source_file_mapping, options, reflector_options);
   if (!compiler.IsValid()) {
-    std::cerr << "Compilation failed." << std::endl;
-    std::cerr << compiler.GetErrorMessages() << std::endl;
+    error_stream << "Compilation failed." << std::endl;
+    error_stream << compiler.GetErrorMessages() << std::endl;
     return false;
   }
 
@@ -117,8 +115,8 @@ bool Main(const fml::CommandLine& command_line) {
   if (!fml::WriteAtomically(*switches.working_directory,
                             Utf8FromPath(spriv_file_name).c_str(),
                             *compiler.GetSPIRVAssembly())) {
-    std::cerr << "Could not write file to " << switches.spirv_file_name
-              << std::endl;
+    error_stream << "Could not write file to " << switches.spirv_file_name
+                 << std::endl;
     return false;
   }
 
@@ -127,12 +125,12 @@ bool Main(const fml::CommandLine& command_line) {
   if (switches.iplr) {
     auto reflector = compiler.GetReflector();
     if (reflector == nullptr) {
-      std::cerr << "Could not create reflector." << std::endl;
+      error_stream << "Could not create reflector." << std::endl;
       return false;
     }
     auto stage_data = reflector->GetRuntimeStageData();
     if (!stage_data) {
-      std::cerr << "Runtime stage information was nil." << std::endl;
+      error_stream << "Runtime stage information was nil." << std::endl;
       return false;
     }
     if (sksl_mapping) {
@@ -142,28 +140,28 @@ bool Main(const fml::CommandLine& command_line) {
                                   ? stage_data->CreateJsonMapping()
                                   : stage_data->CreateMapping();
     if (!stage_data_mapping) {
-      std::cerr << "Runtime stage data could not be created." << std::endl;
+      error_stream << "Runtime stage data could not be created." << std::endl;
       return false;
     }
     if (!fml::WriteAtomically(*switches.working_directory,         //
                               Utf8FromPath(sl_file_name).c_str(),  //
                               *stage_data_mapping                  //
                               )) {
-      std::cerr << "Could not write file to " << switches.sl_file_name
-                << std::endl;
+      error_stream << "Could not write file to " << switches.sl_file_name
+                   << std::endl;
       return false;
     }
     // Tools that consume the runtime stage data expect the access mode to
     // be 0644.
-    if (!SetPermissiveAccess(sl_file_name)) {
+    if (!SetPermissiveAccess(sl_file_name, error_stream)) {
       return false;
     }
   } else {
     if (!fml::WriteAtomically(*switches.working_directory,
                               Utf8FromPath(sl_file_name).c_str(),
                               *compiler.GetSLShaderSource())) {
-      std::cerr << "Could not write file to " << switches.sl_file_name
-                << std::endl;
+      error_stream << "Could not write file to " << switches.sl_file_name
+                   << std::endl;
       return false;
     }
   }
@@ -176,8 +174,8 @@ bool Main(const fml::CommandLine& command_line) {
               *switches.working_directory,
               Utf8FromPath(reflection_json_name).c_str(),
               *compiler.GetReflector()->GetReflectionJSON())) {
-        std::cerr << "Could not write reflection json to "
-                  << switches.reflection_json_name << std::endl;
+        error_stream << "Could not write reflection json to "
+                     << switches.reflection_json_name << std::endl;
         return false;
       }
     }
@@ -190,8 +188,8 @@ bool Main(const fml::CommandLine& command_line) {
               *switches.working_directory,
               Utf8FromPath(reflection_header_name).c_str(),
               *compiler.GetReflector()->GetReflectionHeader())) {
-        std::cerr << "Could not write reflection header to "
-                  << switches.reflection_header_name << std::endl;
+        error_stream << "Could not write reflection header to "
+                     << switches.reflection_header_name << std::endl;
         return false;
       }
     }
@@ -203,8 +201,8 @@ bool Main(const fml::CommandLine& command_line) {
       if (!fml::WriteAtomically(*switches.working_directory,
                                 Utf8FromPath(reflection_cc_name).c_str(),
                                 *compiler.GetReflector()->GetReflectionCC())) {
-        std::cerr << "Could not write reflection CC to "
-                  << switches.reflection_cc_name << std::endl;
+        error_stream << "Could not write reflection CC to "
+                     << switches.reflection_cc_name << std::endl;
         return false;
       }
     }
@@ -233,8 +231,8 @@ bool Main(const fml::CommandLine& command_line) {
     if (!fml::WriteAtomically(*switches.working_directory,
                               Utf8FromPath(depfile_path).c_str(),
                               *compiler.CreateDepfileContents({result_file}))) {
-      std::cerr << "Could not write depfile to " << switches.depfile_path
-                << std::endl;
+      error_stream << "Could not write depfile to " << switches.depfile_path
+                   << std::endl;
       return false;
     }
   }
@@ -242,6 +240,101 @@ bool Main(const fml::CommandLine& command_line) {
   return true;
 }
 
+// Compiles every entry of the given batch file in parallel across hardware
+// threads within this process. Each non-empty line of the batch file is a
+// complete impellerc argument list for one shader. This avoids paying
+// process startup, shaderc initialization, and include reads once per
+// shader when building large shader bundles.
+static bool RunBatchMode(const std::string& batch_file_path) {
+  auto batch_mapping = fml::FileMapping::CreateReadOnly(batch_file_path);
+  if (!batch_mapping || batch_mapping->GetMapping() == nullptr) {
+    std::cerr << "Could not open batch file '" << batch_file_path << "'."
+              << std::endl;
+    return false;
+  }
+
+  std::vector<std::vector<std::string>> jobs;
+  std::stringstream batch_stream(std::string(
+      reinterpret_cast<const char*>(batch_mapping->GetMapping()),
+      batch_mapping->GetSize()));
+  std::string line;
+  while (std::getline(batch_stream, line)) {
+    std::stringstream line_stream(line);
+    std::vector<std::string> arguments;
+    std::string argument;
+    while (line_stream >> argument) {
+      arguments.push_back(std::move(argument));
+    }
+    if (!arguments.empty()) {
+      jobs.push_back(std::move(arguments));
+    }
+  }
+  if (jobs.empty()) {
+    return true;
+  }
+
+  size_t worker_count = std::max<size_t>(
+      1u, std::min<size_t>(std::thread::hardware_concurrency(), jobs.size()));
+  std::atomic<size_t> next_job{0};
+  std::atomic<bool> all_succeeded{true};
+  std::mutex output_mutex;
+  std::vector<std::thread> workers;
+  for (size_t i = 0; i < worker_count; i++) {
+    workers.emplace_back([&]() {
+      while (true) {
+        size_t job_index = next_job.fetch_add(1);
+        if (job_index >= jobs.size()) {
+          break;
+        }
+        const auto& arguments = jobs[job_index];
+        auto job_command_line = fml::CommandLineFromIteratorsWithArgv0(
+            "impellerc", arguments.begin(), arguments.end());
+        // Errors are buffered per job so that parallel failures do not
+        // interleave on stderr.
+        std::stringstream errors;
+        Switches switches(job_command_line);
+        bool success =
+            switches.AreValid(errors) && CompileShader(switches, errors);
+        if (!success) {
+          all_succeeded = false;
+          std::scoped_lock lock(output_mutex);
+          std::cerr << "Failed to compile '" << switches.source_file_name
+                    << "'." << std::endl;
+          std::cerr << errors.str();
+        }
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  return all_succeeded;
+}
+
+bool Main(const fml::CommandLine& command_line) {
+  fml::InstallCrashHandler();
+  if (command_line.HasOption("help")) {
+    Switches::PrintHelp(std::cout);
+    return true;
+  }
+
+  // Batch mode compiles a manifest of shaders within this one process
+  // instead of paying a process invocation per shader.
+  std::string batch_file_path;
+  if (command_line.GetOptionValue("batch", &batch_file_path)) {
+    return RunBatchMode(batch_file_path);
+  }
+
+  Switches switches(command_line);
+  if (!switches.AreValid(std::cerr)) {
+    std::cerr << "Invalid flags specified." << std::endl;
+    Switches::PrintHelp(std::cerr);
+    return false;
+  }
+
+  return CompileShader(switches, std::cerr);
+}
+
 }  // namespace compiler
 }  // namespace impeller
 
@@ -5,12 +5,26 @@
 #include "impeller/compiler/includer.h"
 
 #include <cstring>
+#include <map>
+#include <mutex>
 
 #include "flutter/fml/paths.h"
 
 namespace impeller {
 namespace compiler {
 
+namespace {
+
+// Include file mappings shared by every compilation in the process, keyed by
+// the include directory name joined with the requested source. Shader
+// library headers are pulled in by almost every shader, and they do not
+// change while the compiler is running, so each file is opened and mapped
+// only once even when batch mode compiles many shaders in parallel.
+std::mutex include_cache_mutex;
+std::map<std::string, std::shared_ptr<fml::FileMapping>> include_cache;
+
+}  // namespace
+
 Includer::Includer(std::shared_ptr<fml::UniqueFD> working_directory,
                    std::vector<IncludeDir> include_dirs,
                    std::function<void(std::string)> on_file_included)
@@ -21,7 +35,7 @@ Includer::Includer(std::shared_ptr<fml::UniqueFD> working_directory,
 // |shaderc::CompileOptions::IncluderInterface|
 Includer::~Includer() = default;
 
-std::unique_ptr<fml::FileMapping> Includer::TryOpenMapping(
+std::shared_ptr<fml::FileMapping> Includer::TryOpenMapping(
     const IncludeDir& dir,
     const char* requested_source) {
   if (!dir.dir || !dir.dir->is_valid()) {
@@ -37,17 +51,34 @@ std::unique_ptr<fml::FileMapping> Includer::TryOpenMapping(
     return nullptr;
   }
 
-  auto mapping = fml::FileMapping::CreateReadOnly(*dir.dir, requested_source);
-  if (!mapping || !mapping->IsValid()) {
-    return nullptr;
+  auto include_path = fml::paths::JoinPaths({dir.name, requested_source});
+
+  std::shared_ptr<fml::FileMapping> mapping;
+  {
+    std::scoped_lock lock(include_cache_mutex);
+    auto found = include_cache.find(include_path);
+    if (found != include_cache.end()) {
+      mapping = found->second;
+    }
+  }
+
+  if (!mapping) {
+    mapping = fml::FileMapping::CreateReadOnly(*dir.dir, requested_source);
+    if (!mapping || !mapping->IsValid()) {
+      return nullptr;
+    }
+    std::scoped_lock lock(include_cache_mutex);
+    include_cache[include_path] = mapping;
   }
 
-  on_file_included_(fml::paths::JoinPaths({dir.name, requested_source}));
+  // Still reported on cache hits so each compilation's depfile stays
+  // complete.
+  on_file_included_(include_path);
 
   return mapping;
 }
 
-std::unique_ptr<fml::FileMapping> Includer::FindFirstMapping(
+std::shared_ptr<fml::FileMapping> Includer::FindFirstMapping(
     const char* requested_source) {
   // Always try the working directory first no matter what the include
   // directories are.
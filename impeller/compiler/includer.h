@@ -16,9 +16,9 @@ namespace compiler {
 
 struct IncluderData {
   std::string file_name;
-  std::unique_ptr<fml::Mapping> mapping;
+  std::shared_ptr<fml::Mapping> mapping;
 
-  IncluderData(std::string p_file_name, std::unique_ptr<fml::Mapping> p_mapping)
+  IncluderData(std::string p_file_name, std::shared_ptr<fml::Mapping> p_mapping)
       : file_name(std::move(p_file_name)), mapping(std::move(p_mapping)) {}
 };
 
@@ -45,11 +45,11 @@ class Includer final : public shaderc::CompileOptions::IncluderInterface {
   std::vector<IncludeDir> include_dirs_;
   std::function<void(std::string)> on_file_included_;
 
-  std::unique_ptr<fml::FileMapping> TryOpenMapping(
+  std::shared_ptr<fml::FileMapping> TryOpenMapping(
       const IncludeDir& dir,
       const char* requested_source);
 
-  std::unique_ptr<fml::FileMapping> FindFirstMapping(
+  std::shared_ptr<fml::FileMapping> FindFirstMapping(
       const char* requested_source);
 
   Includer(const Includer&) = delete;
@@ -76,6 +76,10 @@ void Switches::PrintHelp(std::ostream& stream) {
             "targeting metal)"
          << std::endl;
   stream << "[optional] --require-framebuffer-fetch" << std::endl;
+  stream << "[optional] --batch=<batch_file> (compiles each line of the "
+            "batch file, a complete impellerc argument list, in parallel; "
+            "all other arguments are ignored)"
+         << std::endl;
 }
 
 Switches::Switches() = default;
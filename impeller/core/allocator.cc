@@ -4,6 +4,7 @@
 
 #include "impeller/core/allocator.h"
 
+#include "flutter/fml/allocation_metrics.h"
 #include "impeller/base/validation.h"
 #include "impeller/core/device_buffer.h"
 #include "impeller/core/formats.h"
@@ -43,7 +44,11 @@ std::shared_ptr<DeviceBuffer> Allocator::CreateBufferWithCopy(
 
 std::shared_ptr<DeviceBuffer> Allocator::CreateBuffer(
     const DeviceBufferDescriptor& desc) {
-  return OnCreateBuffer(desc);
+  auto buffer = OnCreateBuffer(desc);
+  if (buffer) {
+    fml::AllocationMetrics::RecordAllocation(desc.size, "impeller buffers");
+  }
+  return buffer;
 }
 
 std::shared_ptr<Texture> Allocator::CreateTexture(
@@ -55,11 +60,22 @@ std::shared_ptr<Texture> Allocator::CreateTexture(
     return nullptr;
   }
 
-  return OnCreateTexture(desc);
+  auto texture = OnCreateTexture(desc);
+  if (texture) {
+    fml::AllocationMetrics::RecordAllocation(desc.GetByteSizeOfBaseMipLevel(),
+                                             "impeller textures");
+  }
+  return texture;
 }
 
 void Allocator::DidAcquireSurfaceFrame() {}
 
+std::pair<uint64_t, uint64_t> Allocator::GetAllocatedAndUsedMemory() const {
+  return {0u, 0u};
+}
+
+void Allocator::PerformIdleMaintenance() {}
+
 uint16_t Allocator::MinimumBytesPerRow(PixelFormat format) const {
   return BytesPerPixelForPixelFormat(format);
 }
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <string>
+#include <utility>
 
 #include "flutter/fml/macros.h"
 #include "flutter/fml/mapping.h"
@@ -51,6 +52,24 @@ class Allocator {
   /// allocation pools.
   virtual void DidAcquireSurfaceFrame();
 
+  //----------------------------------------------------------------------------
+  /// @brief      The total size in bytes of the memory blocks the allocator
+  ///             has reserved from the device, and the bytes within those
+  ///             blocks occupied by live allocations. The difference between
+  ///             the two is memory that is reserved but unavailable for new
+  ///             large allocations due to fragmentation. Backends without
+  ///             this introspection report zeroes.
+  ///
+  virtual std::pair<uint64_t, uint64_t> GetAllocatedAndUsedMemory() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Gives the allocator an opportunity to perform housekeeping
+  ///             off the frame's critical path. Called when the animator
+  ///             reports that no frame is being produced. The default
+  ///             implementation is a no-op.
+  ///
+  virtual void PerformIdleMaintenance();
+
  protected:
   Allocator();
 
@@ -4,11 +4,17 @@
 
 #include "impeller/core/device_buffer.h"
 
+#include "impeller/core/resource_watermarks.h"
+
 namespace impeller {
 
-DeviceBuffer::DeviceBuffer(DeviceBufferDescriptor desc) : desc_(desc) {}
+DeviceBuffer::DeviceBuffer(DeviceBufferDescriptor desc) : desc_(desc) {
+  ResourceWatermarks::RecordAllocation(desc_.resource_class, desc_.size);
+}
 
-DeviceBuffer::~DeviceBuffer() = default;
+DeviceBuffer::~DeviceBuffer() {
+  ResourceWatermarks::RecordDeallocation(desc_.resource_class, desc_.size);
+}
 
 // |Buffer|
 std::shared_ptr<const DeviceBuffer> DeviceBuffer::GetDeviceBuffer(
@@ -7,12 +7,15 @@
 #include <cstddef>
 
 #include "impeller/core/formats.h"
+#include "impeller/core/resource_watermarks.h"
 
 namespace impeller {
 
 struct DeviceBufferDescriptor {
   StorageMode storage_mode = StorageMode::kDeviceTransient;
   size_t size = 0u;
+  /// Memory accounting tag; has no effect on the allocated buffer.
+  ResourceClass resource_class = ResourceClass::kUnknown;
 };
 
 }  // namespace impeller
@@ -6,6 +6,8 @@
 
 #include <algorithm>
 #include <cstring>
+#include <functional>
+#include <string_view>
 
 #include "flutter/fml/logging.h"
 
@@ -72,17 +74,64 @@ BufferView HostBuffer::Emplace(size_t length,
   return BufferView{shared_from_this(), GetBuffer(), Range{old_length, length}};
 }
 
+BufferView HostBuffer::EmplaceUniformData(const void* buffer,
+                                          size_t length,
+                                          size_t align) {
+  const uint64_t hash = std::hash<std::string_view>{}(
+      std::string_view(reinterpret_cast<const char*>(buffer), length));
+  auto interned = interned_uniforms_.find(hash);
+  if (interned != interned_uniforms_.end()) {
+    const Range& range = interned->second;
+    // Hashes may collide and earlier blocks may have been emplaced with a
+    // smaller alignment, so verify before returning the existing view.
+    if (range.length == length && (range.offset % align) == 0u &&
+        ::memcmp(GetBuffer() + range.offset, buffer, length) == 0) {
+      return BufferView{shared_from_this(), GetBuffer(), range};
+    }
+  }
+  auto view = Emplace(buffer, length, align);
+  if (view) {
+    interned_uniforms_[hash] = view.range;
+  }
+  return view;
+}
+
 std::shared_ptr<const DeviceBuffer> HostBuffer::GetDeviceBuffer(
     Allocator& allocator) const {
   if (generation_ == device_buffer_generation_) {
     return device_buffer_;
   }
-  auto new_buffer = allocator.CreateBufferWithCopy(GetBuffer(), GetLength());
-  if (!new_buffer) {
+
+  const size_t length = GetLength();
+
+  // Prefer overwriting the ring slot's device buffer in place. The slot was
+  // last written kDeviceBufferRingSize resets ago, so the GPU is done with
+  // it; the use count check additionally skips reuse while any other C++
+  // holder (for example, a pending blit) still references the buffer.
+  std::shared_ptr<DeviceBuffer>& recycled = device_buffer_ring_[ring_index_];
+  if (recycled && recycled.use_count() == 1 &&
+      recycled->GetDeviceBufferDescriptor().size >= length &&
+      recycled->CopyHostBuffer(GetBuffer(), Range{0, length})) {
+    recycled->SetLabel(label_);
+    device_buffer_generation_ = generation_;
+    device_buffer_ = recycled;
+    return device_buffer_;
+  }
+
+  // Allocate the slot's buffer at the reserved (power of two) capacity so
+  // that it can absorb same-sized frames on later laps around the ring.
+  DeviceBufferDescriptor desc;
+  desc.storage_mode = StorageMode::kHostVisible;
+  desc.size = std::max(GetReservedLength(), length);
+  desc.resource_class = ResourceClass::kGeometryBuffer;
+  auto new_buffer = allocator.CreateBuffer(desc);
+  if (!new_buffer ||
+      !new_buffer->CopyHostBuffer(GetBuffer(), Range{0, length})) {
     return nullptr;
   }
   new_buffer->SetLabel(label_);
   device_buffer_generation_ = generation_;
+  recycled = new_buffer;
   device_buffer_ = std::move(new_buffer);
   return device_buffer_;
 }
@@ -90,6 +139,10 @@ std::shared_ptr<const DeviceBuffer> HostBuffer::GetDeviceBuffer(
 void HostBuffer::Reset() {
   generation_ += 1;
   device_buffer_ = nullptr;
+  interned_uniforms_.clear();
+  // Advance to the next device buffer in the ring; see
+  // kDeviceBufferRingSize.
+  ring_index_ = (ring_index_ + 1u) % kDeviceBufferRingSize;
   bool did_truncate = Truncate(0);
   FML_CHECK(did_truncate);
 }
@@ -5,9 +5,11 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 
 #include "flutter/fml/macros.h"
 #include "impeller/base/allocation.h"
@@ -43,9 +45,9 @@ class HostBuffer final : public std::enable_shared_from_this<HostBuffer>,
   [[nodiscard]] BufferView EmplaceUniform(const UniformType& uniform) {
     const auto alignment =
         std::max(alignof(UniformType), DefaultUniformAlignment());
-    return Emplace(reinterpret_cast<const void*>(&uniform),  // buffer
-                   sizeof(UniformType),                      // size
-                   alignment                                 // alignment
+    return EmplaceUniformData(reinterpret_cast<const void*>(&uniform),  //
+                              sizeof(UniformType),                      //
+                              alignment                                 //
     );
   }
 
@@ -121,9 +123,32 @@ class HostBuffer final : public std::enable_shared_from_this<HostBuffer>,
   size_t GetSize() const;
 
  private:
+  //----------------------------------------------------------------------------
+  /// @brief      Emplace uniform data onto the host buffer, returning the view
+  ///             of a previously emplaced block with identical contents when
+  ///             there is one. Entities within a frame overwhelmingly bind the
+  ///             same frame-constant uniform blocks (transforms, resolve
+  ///             info), so interning them avoids uploading one copy per draw.
+  [[nodiscard]] BufferView EmplaceUniformData(const void* buffer,
+                                              size_t length,
+                                              size_t align);
+
+  //----------------------------------------------------------------------------
+  /// The number of device buffers rotated through by |Reset|. Pool recycling
+  /// hands the same HostBuffer back frame after frame, and by the time a
+  /// ring slot comes around again the GPU has long finished consuming the
+  /// frame that last wrote to it, so the slot's device buffer can be
+  /// overwritten in place instead of re-allocated. Three deep matches the
+  /// maximum number of frames in flight.
+  static constexpr size_t kDeviceBufferRingSize = 3u;
+
   mutable std::shared_ptr<DeviceBuffer> device_buffer_;
   mutable size_t device_buffer_generation_ = 0u;
+  mutable std::array<std::shared_ptr<DeviceBuffer>, kDeviceBufferRingSize>
+      device_buffer_ring_;
+  size_t ring_index_ = 0u;
   size_t generation_ = 1u;
+  std::unordered_map<uint64_t, Range> interned_uniforms_;
   std::string label_;
 
   // |Buffer|
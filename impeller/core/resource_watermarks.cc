@@ -0,0 +1,73 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/core/resource_watermarks.h"
+
+#include <atomic>
+
+namespace impeller {
+
+namespace {
+
+struct ClassCounters {
+  std::atomic<int64_t> live_bytes = 0;
+  std::atomic<int64_t> peak_bytes = 0;
+};
+
+ClassCounters gCounters[kResourceClassCount];
+
+ClassCounters& CountersFor(ResourceClass resource_class) {
+  auto index = static_cast<size_t>(resource_class);
+  if (index >= kResourceClassCount) {
+    index = static_cast<size_t>(ResourceClass::kUnknown);
+  }
+  return gCounters[index];
+}
+
+}  // namespace
+
+void ResourceWatermarks::RecordAllocation(ResourceClass resource_class,
+                                          size_t bytes) {
+  if (bytes == 0u) {
+    return;
+  }
+  auto& counters = CountersFor(resource_class);
+  const int64_t live = counters.live_bytes.fetch_add(
+                           static_cast<int64_t>(bytes),
+                           std::memory_order_relaxed) +
+                       static_cast<int64_t>(bytes);
+  int64_t peak = counters.peak_bytes.load(std::memory_order_relaxed);
+  while (live > peak && !counters.peak_bytes.compare_exchange_weak(
+                            peak, live, std::memory_order_relaxed)) {
+  }
+}
+
+void ResourceWatermarks::RecordDeallocation(ResourceClass resource_class,
+                                            size_t bytes) {
+  if (bytes == 0u) {
+    return;
+  }
+  CountersFor(resource_class)
+      .live_bytes.fetch_sub(static_cast<int64_t>(bytes),
+                            std::memory_order_relaxed);
+}
+
+ResourceWatermarks::Watermark ResourceWatermarks::GetWatermark(
+    ResourceClass resource_class) {
+  auto& counters = CountersFor(resource_class);
+  Watermark watermark;
+  watermark.live_bytes = counters.live_bytes.load(std::memory_order_relaxed);
+  watermark.peak_bytes = counters.peak_bytes.load(std::memory_order_relaxed);
+  return watermark;
+}
+
+void ResourceWatermarks::ResetPeaks() {
+  for (auto& counters : gCounters) {
+    counters.peak_bytes.store(counters.live_bytes.load(
+                                  std::memory_order_relaxed),
+                              std::memory_order_relaxed);
+  }
+}
+
+}  // namespace impeller
@@ -0,0 +1,85 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      A coarse classification of what a GPU allocation serves. The
+///             class is carried on the buffer or texture descriptor and only
+///             feeds memory accounting; it has no effect on the allocated
+///             resource.
+///
+enum class ResourceClass : uint8_t {
+  kUnknown,
+  kOnscreenTarget,
+  kOffscreenTarget,
+  kGlyphAtlas,
+  kImage,
+  kGeometryBuffer,
+};
+
+constexpr size_t kResourceClassCount =
+    static_cast<size_t>(ResourceClass::kGeometryBuffer) + 1u;
+
+constexpr const char* ResourceClassToString(ResourceClass resource_class) {
+  switch (resource_class) {
+    case ResourceClass::kUnknown:
+      return "Unknown";
+    case ResourceClass::kOnscreenTarget:
+      return "OnscreenTarget";
+    case ResourceClass::kOffscreenTarget:
+      return "OffscreenTarget";
+    case ResourceClass::kGlyphAtlas:
+      return "GlyphAtlas";
+    case ResourceClass::kImage:
+      return "Image";
+    case ResourceClass::kGeometryBuffer:
+      return "GeometryBuffer";
+  }
+  return "Unknown";
+}
+
+//------------------------------------------------------------------------------
+/// @brief      Process-global live and peak byte counts per resource class.
+///
+///             Textures and device buffers record their descriptor-derived
+///             sizes here on construction and destruction, so the counts
+///             cover every backend, including resources that wrap externally
+///             owned memory such as swapchain images. Sizes are estimates
+///             computed from descriptors (base mip level for textures) and
+///             may undercount driver-side padding.
+///
+///             All methods are thread safe and allocation free.
+///
+class ResourceWatermarks {
+ public:
+  struct Watermark {
+    /// Bytes currently alive in this class.
+    int64_t live_bytes = 0;
+    /// Highest value of `live_bytes` since startup or the last `ResetPeaks`.
+    int64_t peak_bytes = 0;
+  };
+
+  static void RecordAllocation(ResourceClass resource_class, size_t bytes);
+
+  static void RecordDeallocation(ResourceClass resource_class, size_t bytes);
+
+  static Watermark GetWatermark(ResourceClass resource_class);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Resets every peak to the current live count so a new
+  ///             observation interval can begin.
+  ///
+  static void ResetPeaks();
+
+ private:
+  ResourceWatermarks() = delete;
+};
+
+}  // namespace impeller
@@ -0,0 +1,60 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/testing/testing.h"
+#include "impeller/core/resource_watermarks.h"
+#include "impeller/core/texture_descriptor.h"
+
+namespace impeller {
+namespace testing {
+
+// The watermarks are process-global; every test works off deltas from the
+// counts it observes on entry.
+
+TEST(ResourceWatermarksTest, TracksLiveAndPeakBytes) {
+  const auto before =
+      ResourceWatermarks::GetWatermark(ResourceClass::kGlyphAtlas);
+
+  ResourceWatermarks::RecordAllocation(ResourceClass::kGlyphAtlas, 100u);
+  ResourceWatermarks::RecordAllocation(ResourceClass::kGlyphAtlas, 50u);
+
+  auto watermark =
+      ResourceWatermarks::GetWatermark(ResourceClass::kGlyphAtlas);
+  EXPECT_EQ(watermark.live_bytes - before.live_bytes, 150);
+  EXPECT_GE(watermark.peak_bytes, before.live_bytes + 150);
+
+  ResourceWatermarks::RecordDeallocation(ResourceClass::kGlyphAtlas, 50u);
+
+  watermark = ResourceWatermarks::GetWatermark(ResourceClass::kGlyphAtlas);
+  EXPECT_EQ(watermark.live_bytes - before.live_bytes, 100);
+  // The peak is a high water mark and does not recede with deallocations.
+  EXPECT_GE(watermark.peak_bytes, before.live_bytes + 150);
+
+  ResourceWatermarks::RecordDeallocation(ResourceClass::kGlyphAtlas, 100u);
+}
+
+TEST(ResourceWatermarksTest, ResetPeaksClampsToLiveBytes) {
+  ResourceWatermarks::RecordAllocation(ResourceClass::kImage, 200u);
+  ResourceWatermarks::RecordDeallocation(ResourceClass::kImage, 200u);
+
+  ResourceWatermarks::ResetPeaks();
+
+  const auto watermark =
+      ResourceWatermarks::GetWatermark(ResourceClass::kImage);
+  EXPECT_EQ(watermark.peak_bytes, watermark.live_bytes);
+}
+
+TEST(ResourceWatermarksTest, ResourceClassDoesNotAffectDescriptorEquality) {
+  TextureDescriptor desc_a = {.size = ISize(100, 100)};
+  TextureDescriptor desc_b = {.size = ISize(100, 100)};
+  desc_a.resource_class = ResourceClass::kOffscreenTarget;
+  desc_b.resource_class = ResourceClass::kUnknown;
+
+  // The tag only feeds accounting; cached targets with different tags must
+  // still compare equal.
+  EXPECT_EQ(desc_a, desc_b);
+}
+
+}  // namespace testing
+}  // namespace impeller
@@ -0,0 +1,109 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/core/staging_belt.h"
+
+#include "impeller/core/allocator.h"
+#include "impeller/core/device_buffer_descriptor.h"
+
+namespace impeller {
+
+StagingBelt::StagingBelt(std::shared_ptr<Allocator> allocator,
+                         size_t base_chunk_size)
+    : allocator_(std::move(allocator)), base_chunk_size_(base_chunk_size) {}
+
+StagingBelt::~StagingBelt() = default;
+
+std::shared_ptr<DeviceBuffer> StagingBelt::Acquire(size_t length) {
+  if (!allocator_) {
+    return nullptr;
+  }
+
+  DeviceBufferDescriptor desc;
+  desc.storage_mode = StorageMode::kHostVisible;
+
+  // Find the smallest size class that can hold the request.
+  size_t class_index = 0u;
+  size_t chunk_size = base_chunk_size_;
+  while (chunk_size < length && class_index + 1u < kSizeClassCount) {
+    chunk_size <<= 1u;
+    class_index++;
+  }
+
+  // Requests larger than the biggest size class get a dedicated allocation
+  // that is not retained by the belt.
+  if (length > chunk_size) {
+    desc.size = length;
+    return allocator_->CreateBuffer(desc);
+  }
+
+  Lock lock(chunks_mutex_);
+  SizeClass& size_class = size_classes_[class_index];
+
+  // Hand out the least recently used idle chunk. The rotation keeps the time
+  // between successive reuses of any one chunk as long as possible so that
+  // command buffers still consuming it have had a chance to drain.
+  for (size_t i = 0u; i < size_class.chunks.size(); i++) {
+    auto& chunk = size_class.chunks[(size_class.next + i) %
+                                    size_class.chunks.size()];
+    if (chunk.use_count() == 1) {
+      size_class.next = (size_class.next + i + 1u) % size_class.chunks.size();
+      return chunk;
+    }
+  }
+
+  desc.size = chunk_size;
+  auto chunk = allocator_->CreateBuffer(desc);
+  if (!chunk) {
+    return nullptr;
+  }
+  chunk->SetLabel("StagingBelt Chunk");
+
+  if (size_class.chunks.size() < kMaxChunkCount &&
+      ReserveBudget(chunk_size)) {
+    size_class.chunks.push_back(chunk);
+    size_class.next = 0u;
+    retained_bytes_ += chunk_size;
+  }
+  // Otherwise the class is at capacity (or the budget is exhausted) with
+  // every retained chunk in flight; the allocation above services this
+  // request as a one-shot buffer.
+  return chunk;
+}
+
+bool StagingBelt::ReserveBudget(size_t length) {
+  const size_t budget = kMaxRetainedFactor * base_chunk_size_;
+  if (length > budget) {
+    return false;
+  }
+  // Evict idle chunks, largest size classes first, until the request fits.
+  // Chunks that are still in flight are never evicted.
+  for (size_t i = kSizeClassCount; i > 0u && retained_bytes_ + length > budget;
+       i--) {
+    SizeClass& size_class = size_classes_[i - 1u];
+    const size_t chunk_size = base_chunk_size_ << (i - 1u);
+    for (auto it = size_class.chunks.begin();
+         it != size_class.chunks.end() && retained_bytes_ + length > budget;) {
+      if (it->use_count() == 1) {
+        it = size_class.chunks.erase(it);
+        size_class.next = 0u;
+        retained_bytes_ -= chunk_size;
+      } else {
+        it++;
+      }
+    }
+  }
+  return retained_bytes_ + length <= budget;
+}
+
+size_t StagingBelt::GetChunkCount() const {
+  Lock lock(chunks_mutex_);
+  size_t count = 0u;
+  for (const auto& size_class : size_classes_) {
+    count += size_class.chunks.size();
+  }
+  return count;
+}
+
+}  // namespace impeller
@@ -0,0 +1,112 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "impeller/base/thread.h"
+#include "impeller/core/device_buffer.h"
+
+namespace impeller {
+
+class Allocator;
+
+//------------------------------------------------------------------------------
+/// @brief      A belt of persistently mapped host-visible staging buffers for
+///             one-shot uploads (image decodes and blit sources).
+///
+///             Acquiring a buffer from the belt hands back an idle chunk
+///             instead of allocating (and mapping) a fresh device buffer per
+///             upload. Chunks are pooled in power-of-two size classes starting
+///             at the base chunk size, so steady-state decode of multi-MB
+///             images reuses warm buffers of a matching size; requests larger
+///             than the biggest size class fall through to dedicated
+///             allocations. A chunk is considered idle again once the belt
+///             holds the only reference to it; in-flight blit command buffers
+///             retain their source buffers until the GPU has consumed them.
+///             Within a size class, chunks are recycled in rotation so the
+///             least recently used one is handed out first, giving pending
+///             work the longest possible window to drain.
+///
+///             The total memory retained by the belt is budgeted; retaining a
+///             new chunk evicts idle chunks from other size classes when the
+///             budget would otherwise be exceeded.
+///
+///             The belt is thread-safe.
+///
+class StagingBelt {
+ public:
+  //----------------------------------------------------------------------------
+  /// The size of chunks in the smallest size class. Each subsequent class
+  /// doubles the chunk size.
+  static constexpr size_t kDefaultChunkSize = 4u * 1024u * 1024u;
+
+  //----------------------------------------------------------------------------
+  /// The number of power-of-two size classes. Requests larger than the
+  /// biggest class are serviced with dedicated one-shot allocations.
+  static constexpr size_t kSizeClassCount = 5u;
+
+  //----------------------------------------------------------------------------
+  /// The maximum number of chunks retained per size class. Requests that
+  /// arrive while every chunk of a class is in flight are serviced with
+  /// dedicated one-shot allocations rather than growing the belt without
+  /// bound.
+  static constexpr size_t kMaxChunkCount = 8u;
+
+  //----------------------------------------------------------------------------
+  /// The total retained memory budget, expressed as a multiple of the base
+  /// chunk size (64MB with the default base size).
+  static constexpr size_t kMaxRetainedFactor = 16u;
+
+  explicit StagingBelt(std::shared_ptr<Allocator> allocator,
+                       size_t base_chunk_size = kDefaultChunkSize);
+
+  ~StagingBelt();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Acquire a host-visible buffer with capacity for at least
+  ///             `length` bytes. The buffer is recycled by the belt once the
+  ///             caller (and any command buffers consuming it) release their
+  ///             references.
+  ///
+  /// @return     The buffer, or nullptr on allocation failure.
+  ///
+  std::shared_ptr<DeviceBuffer> Acquire(size_t length);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The number of chunks currently retained by the belt across
+  ///             all size classes.
+  ///
+  size_t GetChunkCount() const;
+
+ private:
+  struct SizeClass {
+    std::vector<std::shared_ptr<DeviceBuffer>> chunks;
+    size_t next = 0u;
+  };
+
+  //----------------------------------------------------------------------------
+  /// @brief      Evict idle chunks (largest classes first) until `length`
+  ///             additional bytes fit within the retained memory budget.
+  ///
+  /// @return     Whether the budget can accommodate `length` more bytes.
+  ///
+  bool ReserveBudget(size_t length) IPLR_REQUIRES(chunks_mutex_);
+
+  std::shared_ptr<Allocator> allocator_;
+  const size_t base_chunk_size_;
+
+  mutable Mutex chunks_mutex_;
+  SizeClass size_classes_[kSizeClassCount] IPLR_GUARDED_BY(chunks_mutex_);
+  size_t retained_bytes_ IPLR_GUARDED_BY(chunks_mutex_) = 0u;
+
+  StagingBelt(const StagingBelt&) = delete;
+
+  StagingBelt& operator=(const StagingBelt&) = delete;
+};
+
+}  // namespace impeller
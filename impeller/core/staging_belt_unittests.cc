@@ -0,0 +1,130 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <vector>
+
+#include "flutter/testing/testing.h"
+#include "impeller/core/allocator.h"
+#include "impeller/core/staging_belt.h"
+#include "impeller/renderer/testing/mocks.h"
+
+namespace impeller {
+namespace testing {
+
+namespace {
+class TestAllocator : public Allocator {
+ public:
+  TestAllocator() = default;
+
+  ~TestAllocator() = default;
+
+  ISize GetMaxTextureSizeSupported() const override {
+    return ISize(1024, 1024);
+  };
+
+  std::shared_ptr<DeviceBuffer> OnCreateBuffer(
+      const DeviceBufferDescriptor& desc) override {
+    return std::make_shared<MockDeviceBuffer>(desc);
+  };
+
+  std::shared_ptr<Texture> OnCreateTexture(
+      const TextureDescriptor& desc) override {
+    return std::make_shared<MockTexture>(desc);
+  };
+};
+}  // namespace
+
+TEST(StagingBeltTest, RecyclesIdleChunks) {
+  auto belt = StagingBelt(std::make_shared<TestAllocator>(), 1024u);
+
+  auto buffer_1 = belt.Acquire(512u);
+  ASSERT_TRUE(buffer_1);
+  ASSERT_EQ(buffer_1->GetDeviceBufferDescriptor().size, 1024u);
+  ASSERT_EQ(belt.GetChunkCount(), 1u);
+
+  // The first chunk is still held, so a second acquisition gets a new chunk.
+  auto buffer_2 = belt.Acquire(512u);
+  ASSERT_TRUE(buffer_2);
+  ASSERT_NE(buffer_1, buffer_2);
+  ASSERT_EQ(belt.GetChunkCount(), 2u);
+
+  // Releasing a chunk makes it eligible for reuse.
+  auto released = buffer_1.get();
+  buffer_1.reset();
+  auto buffer_3 = belt.Acquire(512u);
+  ASSERT_EQ(buffer_3.get(), released);
+  ASSERT_EQ(belt.GetChunkCount(), 2u);
+}
+
+TEST(StagingBeltTest, PoolsRequestsBySizeClass) {
+  auto belt = StagingBelt(std::make_shared<TestAllocator>(), 1024u);
+
+  // A request larger than the base chunk size is pooled in the next
+  // power-of-two size class rather than falling through to a one-shot
+  // allocation.
+  auto large = belt.Acquire(3000u);
+  ASSERT_TRUE(large);
+  ASSERT_EQ(large->GetDeviceBufferDescriptor().size, 4096u);
+  ASSERT_EQ(belt.GetChunkCount(), 1u);
+
+  // Small requests do not reuse the larger chunk.
+  auto released = large.get();
+  large.reset();
+  auto small = belt.Acquire(512u);
+  ASSERT_NE(small.get(), released);
+  ASSERT_EQ(small->GetDeviceBufferDescriptor().size, 1024u);
+
+  // A matching request reuses the idle chunk from its own class.
+  auto reused = belt.Acquire(2500u);
+  ASSERT_EQ(reused.get(), released);
+}
+
+TEST(StagingBeltTest, OversizeRequestsAreNotRetained) {
+  auto belt = StagingBelt(std::make_shared<TestAllocator>(), 1024u);
+
+  // Larger than the biggest size class (16x the base chunk size).
+  auto buffer = belt.Acquire(32768u);
+  ASSERT_TRUE(buffer);
+  ASSERT_EQ(buffer->GetDeviceBufferDescriptor().size, 32768u);
+  ASSERT_EQ(belt.GetChunkCount(), 0u);
+}
+
+TEST(StagingBeltTest, EvictsIdleChunksToStayWithinBudget) {
+  auto belt = StagingBelt(std::make_shared<TestAllocator>(), 1024u);
+
+  // Fill the smallest size class and release everything; eight idle 1KB
+  // chunks remain retained.
+  {
+    std::vector<std::shared_ptr<DeviceBuffer>> held;
+    for (size_t i = 0u; i < StagingBelt::kMaxChunkCount; i++) {
+      held.push_back(belt.Acquire(512u));
+      ASSERT_TRUE(held.back());
+    }
+  }
+  ASSERT_EQ(belt.GetChunkCount(), StagingBelt::kMaxChunkCount);
+
+  // Two held 8KB chunks exceed the 16KB budget together with the idle 1KB
+  // chunks, which get evicted to make room.
+  auto buffer_1 = belt.Acquire(8192u);
+  auto buffer_2 = belt.Acquire(8192u);
+  ASSERT_TRUE(buffer_1);
+  ASSERT_TRUE(buffer_2);
+  ASSERT_EQ(belt.GetChunkCount(), 2u);
+}
+
+TEST(StagingBeltTest, DoesNotGrowBeyondMaxChunkCount) {
+  auto belt = StagingBelt(std::make_shared<TestAllocator>(), 1024u);
+
+  // Hold every chunk the belt is willing to retain, plus one more.
+  std::vector<std::shared_ptr<DeviceBuffer>> held;
+  for (size_t i = 0u; i < StagingBelt::kMaxChunkCount + 1u; i++) {
+    held.push_back(belt.Acquire(512u));
+    ASSERT_TRUE(held.back());
+  }
+  ASSERT_EQ(belt.GetChunkCount(), StagingBelt::kMaxChunkCount);
+}
+
+}  // namespace testing
+}  // namespace impeller
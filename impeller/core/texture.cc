@@ -5,12 +5,22 @@
 #include "impeller/core/texture.h"
 
 #include "impeller/base/validation.h"
+#include "impeller/core/resource_watermarks.h"
 
 namespace impeller {
 
-Texture::Texture(TextureDescriptor desc) : desc_(desc) {}
+Texture::Texture(TextureDescriptor desc) : desc_(desc) {
+  // Accounting at the base class covers every backend, including textures
+  // that wrap externally owned memory such as swapchain images. The base mip
+  // level is an estimate; mip tails and driver padding are not counted.
+  ResourceWatermarks::RecordAllocation(desc_.resource_class,
+                                       desc_.GetByteSizeOfBaseMipLevel());
+}
 
-Texture::~Texture() = default;
+Texture::~Texture() {
+  ResourceWatermarks::RecordDeallocation(desc_.resource_class,
+                                         desc_.GetByteSizeOfBaseMipLevel());
+}
 
 bool Texture::SetContents(const uint8_t* contents,
                           size_t length,
@@ -16,7 +16,9 @@ std::string TextureDescriptorToString(const TextureDescriptor& desc) {
   stream << "Size=" << desc.size << ",";
   stream << "MipCount=" << desc.mip_count << ",";
   stream << "SampleCount=" << static_cast<size_t>(desc.sample_count) << ",";
-  stream << "Compression=" << CompressionTypeToString(desc.compression_type);
+  stream << "Compression=" << CompressionTypeToString(desc.compression_type)
+         << ",";
+  stream << "ResourceClass=" << ResourceClassToString(desc.resource_class);
   return stream.str();
 }
 
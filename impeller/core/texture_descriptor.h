@@ -7,6 +7,7 @@
 #include <optional>
 
 #include "impeller/core/formats.h"
+#include "impeller/core/resource_watermarks.h"
 #include "impeller/geometry/size.h"
 #include "impeller/image/decompressed_image.h"
 
@@ -46,6 +47,10 @@ struct TextureDescriptor {
       static_cast<TextureUsageMask>(TextureUsage::kShaderRead);
   SampleCount sample_count = SampleCount::kCount1;
   CompressionType compression_type = CompressionType::kLossless;
+  /// Memory accounting tag; has no effect on the allocated texture and is
+  /// deliberately excluded from equality so cached targets with different
+  /// tags still match.
+  ResourceClass resource_class = ResourceClass::kUnknown;
 
   constexpr size_t GetByteSizeOfBaseMipLevel() const {
     if (!IsValid()) {
@@ -44,11 +44,9 @@ std::shared_ptr<impeller::VerticesGeometry> MakeVertices(
 
   std::vector<Color> colors;
   if (vertices->colors()) {
-    colors.reserve(vertices->vertex_count());
-    for (auto i = 0; i < vertices->vertex_count(); i++) {
-      colors.push_back(
-          skia_conversions::ToColor(vertices->colors()[i]).Premultiply());
-    }
+    colors = skia_conversions::ToColors(vertices->colors(),
+                                        vertices->vertex_count());
+    Color::PremultiplyInPlace(colors.data(), colors.size());
   }
   std::vector<Point> texture_coordinates;
   if (vertices->texture_coordinates()) {
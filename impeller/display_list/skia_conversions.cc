@@ -3,6 +3,10 @@
 // found in the LICENSE file.
 
 #include "impeller/display_list/skia_conversions.h"
+
+#include <cstring>
+#include <type_traits>
+
 #include "display_list/dl_color.h"
 #include "third_party/skia/modules/skparagraph/include/Paragraph.h"
 
@@ -30,8 +34,13 @@ std::vector<Rect> ToRects(const SkRect tex[], int count) {
 
 std::vector<Point> ToPoints(const SkPoint points[], int count) {
   std::vector<Point> result(count);
-  for (auto i = 0; i < count; i++) {
-    result[i] = ToPoint(points[i]);
+  // SkPoint and Point are both a pair of 32 bit floats so the bulk point
+  // payloads of ops like |drawPoints| can be converted with a single copy
+  // instead of a scalar conversion per point.
+  static_assert(sizeof(Point) == sizeof(SkPoint));
+  static_assert(std::is_same_v<decltype(Point::x), SkScalar>);
+  if (count > 0) {
+    std::memcpy(result.data(), points, count * sizeof(SkPoint));
   }
   return result;
 }
@@ -148,6 +157,16 @@ Color ToColor(const flutter::DlColor& color) {
   };
 }
 
+std::vector<Color> ToColors(const flutter::DlColor colors[], int count) {
+  auto result = std::vector<Color>(count);
+  // `DlColor` is a packed 32-bit ARGB value, which allows the list to be
+  // unpacked with the vectorized batch converter.
+  static_assert(sizeof(flutter::DlColor) == sizeof(uint32_t));
+  Color::UnpackARGB(reinterpret_cast<const uint32_t*>(colors), count,
+                    result.data());
+  return result;
+}
+
 std::vector<Matrix> ToRSXForms(const SkRSXform xform[], int count) {
   auto result = std::vector<Matrix>();
   for (int i = 0; i < count; i++) {
@@ -194,14 +213,15 @@ void ConvertStops(const flutter::DlGradientColorSourceBase* gradient,
                   std::vector<float>& stops) {
   FML_DCHECK(gradient->stop_count() >= 2);
 
-  auto* dl_colors = gradient->colors();
   auto* dl_stops = gradient->stops();
+  std::vector<Color> dl_colors =
+      ToColors(gradient->colors(), gradient->stop_count());
   if (dl_stops[0] != 0.0) {
-    colors.emplace_back(skia_conversions::ToColor(dl_colors[0]));
+    colors.emplace_back(dl_colors[0]);
     stops.emplace_back(0);
   }
   for (auto i = 0; i < gradient->stop_count(); i++) {
-    colors.emplace_back(skia_conversions::ToColor(dl_colors[i]));
+    colors.emplace_back(dl_colors[i]);
     stops.emplace_back(std::clamp(dl_stops[i], 0.0f, 1.0f));
   }
   if (dl_stops[gradient->stop_count() - 1] != 1.0) {
@@ -35,6 +35,8 @@ Point ToPoint(const SkPoint& point);
 
 Color ToColor(const flutter::DlColor& color);
 
+std::vector<Color> ToColors(const flutter::DlColor colors[], int count);
+
 std::vector<Matrix> ToRSXForms(const SkRSXform xform[], int count);
 
 PathBuilder::RoundingRadii ToRoundingRadii(const SkRRect& rrect);
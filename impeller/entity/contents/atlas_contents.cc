@@ -21,6 +21,7 @@
 #include "impeller/entity/texture_fill.frag.h"
 #include "impeller/entity/texture_fill.vert.h"
 #include "impeller/geometry/color.h"
+#include "impeller/geometry/vector.h"
 #include "impeller/renderer/render_pass.h"
 #include "impeller/renderer/sampler_library.h"
 #include "impeller/renderer/vertex_buffer_builder.h"
@@ -65,6 +66,15 @@ void AtlasContents::SetCullRect(std::optional<Rect> cull_rect) {
   cull_rect_ = cull_rect;
 }
 
+// Per-sprite instance data for the instanced atlas texture draw. This must
+// match the std140 layout of the SpriteInfo buffer in
+// texture_fill_instanced.vert.
+struct SpriteData {
+  Matrix transform;
+  // The sprite's sample rect in texel space, packed as x, y, width, height.
+  Vector4 sample_rect;
+};
+
 struct AtlasBlenderKey {
   Color color;
   Rect rect;
@@ -385,6 +395,11 @@ bool AtlasTextureContents::Render(const ContentContext& renderer,
     transforms = parent_.GetTransforms();
   }
 
+  if (renderer.GetDeviceCapabilities().SupportsSSBO()) {
+    return RenderInstanced(renderer, entity, pass, texture, texture_coords,
+                           transforms);
+  }
+
   const Size texture_size(texture->GetSize());
   VertexBufferBuilder<VS::PerVertexData> vertex_builder;
   vertex_builder.Reserve(texture_coords.size() * 6);
@@ -434,6 +449,71 @@ bool AtlasTextureContents::Render(const ContentContext& renderer,
   return pass.AddCommand(std::move(cmd));
 }
 
+bool AtlasTextureContents::RenderInstanced(
+    const ContentContext& renderer,
+    const Entity& entity,
+    RenderPass& pass,
+    const std::shared_ptr<Texture>& texture,
+    const std::vector<Rect>& texture_coords,
+    const std::vector<Matrix>& transforms) const {
+  using VS = TextureFillInstancedPipeline::VertexShader;
+  using FS = TextureFillInstancedPipeline::FragmentShader;
+
+  if (texture_coords.empty()) {
+    return true;
+  }
+
+  std::vector<SpriteData> sprites;
+  sprites.reserve(texture_coords.size());
+  for (size_t i = 0; i < texture_coords.size(); i++) {
+    auto sample_rect = texture_coords[i];
+    sprites.push_back(SpriteData{
+        .transform = transforms[i],
+        .sample_rect = Vector4(sample_rect.origin.x, sample_rect.origin.y,
+                               sample_rect.size.width, sample_rect.size.height),
+    });
+  }
+
+  // The vertex shader expands this unit quad to each sprite's bounds, so the
+  // vertex buffer is the same for every sprite and every frame.
+  VertexBufferBuilder<VS::PerVertexData> vertex_builder;
+  vertex_builder.Reserve(6);
+  constexpr Scalar width[6] = {0, 1, 0, 1, 0, 1};
+  constexpr Scalar height[6] = {0, 0, 1, 0, 1, 1};
+  for (size_t j = 0; j < 6; j++) {
+    VS::PerVertexData data;
+    data.unit_position = Point(width[j], height[j]);
+    vertex_builder.AppendVertex(data);
+  }
+
+  Command cmd;
+  DEBUG_COMMAND_INFO(cmd, "AtlasTextureInstanced");
+
+  auto& host_buffer = pass.GetTransientsBuffer();
+
+  VS::FrameInfo frame_info;
+  frame_info.mvp = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                   entity.GetTransformation();
+  frame_info.texture_size = Point(Size(texture->GetSize()));
+  frame_info.texture_sampler_y_coord_scale = texture->GetYCoordScale();
+  frame_info.alpha = alpha_;
+
+  auto options = OptionsFromPassAndEntity(pass, entity);
+  cmd.pipeline = renderer.GetTextureFillInstancedPipeline(options);
+  cmd.stencil_reference = entity.GetClipDepth();
+  cmd.instance_count = sprites.size();
+  cmd.BindVertices(vertex_builder.CreateVertexBuffer(host_buffer));
+  VS::BindFrameInfo(cmd, host_buffer.EmplaceUniform(frame_info));
+  VS::BindSpriteInfo(
+      cmd, host_buffer.Emplace(sprites.data(),
+                               sprites.size() * sizeof(SpriteData),
+                               DefaultUniformAlignment()));
+  FS::BindTextureSampler(cmd, texture,
+                         renderer.GetContext()->GetSamplerLibrary()->GetSampler(
+                             parent_.GetSamplerDescriptor()));
+  return pass.AddCommand(std::move(cmd));
+}
+
 // AtlasColorContents
 // ---------------------------------------------------------
 
@@ -117,6 +117,17 @@ class AtlasTextureContents final : public Contents {
   void SetSubAtlas(const std::shared_ptr<SubAtlasResult>& subatlas);
 
  private:
+  /// @brief Render the sprites as a single instanced draw, with the
+  ///        per-sprite transforms and sample rects uploaded as an instance
+  ///        buffer instead of being expanded into vertices on the CPU.
+  ///        Requires SSBO support.
+  bool RenderInstanced(const ContentContext& renderer,
+                       const Entity& entity,
+                       RenderPass& pass,
+                       const std::shared_ptr<Texture>& texture,
+                       const std::vector<Rect>& texture_coords,
+                       const std::vector<Matrix>& transforms) const;
+
   const AtlasContents& parent_;
   Scalar alpha_ = 1.0;
   Rect coverage_;
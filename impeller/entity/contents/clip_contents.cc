@@ -30,6 +30,20 @@ void ClipContents::SetClipOperation(Entity::ClipOperation clip_op) {
   clip_op_ = clip_op;
 }
 
+std::optional<Rect> ClipContents::GetScissorRect(const Entity& entity) const {
+  if (clip_op_ != Entity::ClipOperation::kIntersect || !geometry_) {
+    return std::nullopt;
+  }
+  if (!entity.GetTransformation().IsTranslationScaleOnly()) {
+    return std::nullopt;
+  }
+  auto rect = geometry_->AsAxisAlignedRect();
+  if (!rect.has_value()) {
+    return std::nullopt;
+  }
+  return rect->TransformBounds(entity.GetTransformation());
+}
+
 std::optional<Rect> ClipContents::GetCoverage(const Entity& entity) const {
   return std::nullopt;
 };
@@ -25,6 +25,13 @@ class ClipContents final : public Contents {
 
   void SetClipOperation(Entity::ClipOperation clip_op);
 
+  //----------------------------------------------------------------------------
+  /// @brief Returns the clip rect in render target space if this clip is an
+  ///        axis aligned rect intersect clip under a translation/scale
+  ///        transform. Such clips can be applied as a scissor on subsequent
+  ///        commands instead of a stencil write.
+  std::optional<Rect> GetScissorRect(const Entity& entity) const;
+
   // |Contents|
   std::optional<Rect> GetCoverage(const Entity& entity) const override;
 
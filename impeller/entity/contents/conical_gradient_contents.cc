@@ -130,9 +130,7 @@ bool ConicalGradientContents::RenderTexture(const ContentContext& renderer,
   using VS = ConicalGradientFillPipeline::VertexShader;
   using FS = ConicalGradientFillPipeline::FragmentShader;
 
-  auto gradient_data = CreateGradientBuffer(colors_, stops_);
-  auto gradient_texture =
-      CreateGradientTexture(gradient_data, renderer.GetContext());
+  auto gradient_texture = CreateGradientTexture(colors_, stops_, renderer);
   if (gradient_texture == nullptr) {
     return false;
   }
@@ -4,7 +4,10 @@
 
 #include "impeller/entity/contents/content_context.h"
 
+#include <charconv>
 #include <memory>
+#include <sstream>
+#include <string_view>
 
 #include "impeller/base/strings.h"
 #include "impeller/core/formats.h"
@@ -20,6 +23,64 @@
 
 namespace impeller {
 
+namespace {
+
+// Bit layout of the serialized ContentContextOptions key. The format version
+// lives in the topmost nibble so that layout changes invalidate manifests
+// written by older engines instead of decoding into bogus options.
+constexpr uint64_t kOptionsKeyFormatVersion = 1;
+constexpr int kOptionsKeyVersionShift = 60;
+
+}  // namespace
+
+uint64_t ContentContextOptions::ToKey() const {
+  return (kOptionsKeyFormatVersion << kOptionsKeyVersionShift) |
+         (static_cast<uint64_t>(is_for_rrect_blur_clear) << 38) |
+         (static_cast<uint64_t>(wireframe) << 37) |
+         (static_cast<uint64_t>(has_stencil_attachment) << 36) |
+         (static_cast<uint64_t>(primitive_type) << 32) |
+         (static_cast<uint64_t>(stencil_operation) << 28) |
+         (static_cast<uint64_t>(stencil_compare) << 24) |
+         (static_cast<uint64_t>(color_attachment_pixel_format) << 16) |
+         (static_cast<uint64_t>(sample_count) << 8) |
+         static_cast<uint64_t>(blend_mode);
+}
+
+std::optional<ContentContextOptions> ContentContextOptions::FromKey(
+    uint64_t key) {
+  if ((key >> kOptionsKeyVersionShift) != kOptionsKeyFormatVersion) {
+    return std::nullopt;
+  }
+  const uint64_t blend = key & 0xffu;
+  const uint64_t samples = (key >> 8) & 0xffu;
+  const uint64_t format = (key >> 16) & 0xffu;
+  const uint64_t compare = (key >> 24) & 0xfu;
+  const uint64_t stencil_op = (key >> 28) & 0xfu;
+  const uint64_t primitive = (key >> 32) & 0xfu;
+  const uint64_t reserved = (key >> 39) & ((1ull << 21) - 1);
+  if (reserved != 0u ||  //
+      blend > static_cast<uint64_t>(BlendMode::kLast) ||
+      (samples != static_cast<uint64_t>(SampleCount::kCount1) &&
+       samples != static_cast<uint64_t>(SampleCount::kCount4)) ||
+      format > static_cast<uint64_t>(PixelFormat::kD32FloatS8UInt) ||
+      compare > static_cast<uint64_t>(CompareFunction::kGreaterEqual) ||
+      stencil_op > static_cast<uint64_t>(StencilOperation::kDecrementWrap) ||
+      primitive > static_cast<uint64_t>(PrimitiveType::kPoint)) {
+    return std::nullopt;
+  }
+  ContentContextOptions options;
+  options.blend_mode = static_cast<BlendMode>(blend);
+  options.sample_count = static_cast<SampleCount>(samples);
+  options.color_attachment_pixel_format = static_cast<PixelFormat>(format);
+  options.stencil_compare = static_cast<CompareFunction>(compare);
+  options.stencil_operation = static_cast<StencilOperation>(stencil_op);
+  options.primitive_type = static_cast<PrimitiveType>(primitive);
+  options.has_stencil_attachment = (key >> 36) & 1u;
+  options.wireframe = (key >> 37) & 1u;
+  options.is_for_rrect_blur_clear = (key >> 38) & 1u;
+  return options;
+}
+
 void ContentContextOptions::ApplyToPipelineDescriptor(
     PipelineDescriptor& desc) const {
   auto pipeline_blend = blend_mode;
@@ -211,6 +272,7 @@ ContentContext::ContentContext(
     radial_gradient_ssbo_fill_pipelines_.CreateDefault(*context_, options);
     conical_gradient_ssbo_fill_pipelines_.CreateDefault(*context_, options);
     sweep_gradient_ssbo_fill_pipelines_.CreateDefault(*context_, options);
+    texture_fill_instanced_pipelines_.CreateDefault(*context_, options);
   } else {
     linear_gradient_fill_pipelines_.CreateDefault(*context_, options);
     radial_gradient_fill_pipelines_.CreateDefault(*context_, options);
@@ -313,6 +375,7 @@ ContentContext::ContentContext(
       {static_cast<int32_t>(BlendSelectValues::kSoftLight), supports_decal});
 
   rrect_blur_pipelines_.CreateDefault(*context_, options_trianglestrip);
+  rrect_pipelines_.CreateDefault(*context_, options_trianglestrip);
   texture_blend_pipelines_.CreateDefault(*context_, options);
   texture_pipelines_.CreateDefault(*context_, options);
   position_uv_pipelines_.CreateDefault(*context_, options);
@@ -330,7 +393,9 @@ ContentContext::ContentContext(
   srgb_to_linear_filter_pipelines_.CreateDefault(*context_,
                                                  options_trianglestrip);
   glyph_atlas_pipelines_.CreateDefault(*context_, options);
+  glyph_atlas_blur_pipelines_.CreateDefault(*context_, options);
   glyph_atlas_color_pipelines_.CreateDefault(*context_, options);
+  glyph_atlas_sdf_pipelines_.CreateDefault(*context_, options);
   geometry_color_pipelines_.CreateDefault(*context_, options);
   yuv_to_rgb_filter_pipelines_.CreateDefault(*context_, options_trianglestrip);
   porter_duff_blend_pipelines_.CreateDefault(*context_, options_trianglestrip,
@@ -351,6 +416,19 @@ ContentContext::ContentContext(
         UvComputeShaderPipeline::MakeDefaultPipelineDescriptor(*context_);
     uv_compute_pipelines_ =
         context_->GetPipelineLibrary()->GetPipeline(uv_pipeline_desc).Get();
+
+    auto gradient_pipeline_desc =
+        GradientComputeShaderPipeline::MakeDefaultPipelineDescriptor(*context_);
+    gradient_compute_pipelines_ = context_->GetPipelineLibrary()
+                                      ->GetPipeline(gradient_pipeline_desc)
+                                      .Get();
+
+    auto stroke_pipeline_desc =
+        StrokeSegmentComputeShaderPipeline::MakeDefaultPipelineDescriptor(
+            *context_);
+    stroke_segment_compute_pipelines_ = context_->GetPipelineLibrary()
+                                            ->GetPipeline(stroke_pipeline_desc)
+                                            .Get();
   }
 
   /// Setup default clip pipeline.
@@ -377,6 +455,98 @@ ContentContext::ContentContext(
   clip_pipelines_.SetDefault(options, std::make_unique<ClipPipeline>(
                                           *context_, clip_pipeline_descriptor));
 
+  // Name the variant families so that pipeline usage recorded by one session
+  // can be replayed by name from the persistent manifest in the next one.
+  // Renaming a family orphans (but does not break) its recorded entries.
+  RegisterVariantFamily("SolidFill", solid_fill_pipelines_);
+  RegisterVariantFamily("LinearGradientFill", linear_gradient_fill_pipelines_);
+  RegisterVariantFamily("RadialGradientFill", radial_gradient_fill_pipelines_);
+  RegisterVariantFamily("ConicalGradientFill",
+                        conical_gradient_fill_pipelines_);
+  RegisterVariantFamily("SweepGradientFill", sweep_gradient_fill_pipelines_);
+  RegisterVariantFamily("LinearGradientSSBOFill",
+                        linear_gradient_ssbo_fill_pipelines_);
+  RegisterVariantFamily("RadialGradientSSBOFill",
+                        radial_gradient_ssbo_fill_pipelines_);
+  RegisterVariantFamily("ConicalGradientSSBOFill",
+                        conical_gradient_ssbo_fill_pipelines_);
+  RegisterVariantFamily("SweepGradientSSBOFill",
+                        sweep_gradient_ssbo_fill_pipelines_);
+  RegisterVariantFamily("RRectBlur", rrect_blur_pipelines_);
+  RegisterVariantFamily("RRect", rrect_pipelines_);
+  RegisterVariantFamily("TextureBlend", texture_blend_pipelines_);
+  RegisterVariantFamily("Texture", texture_pipelines_);
+  RegisterVariantFamily("TextureFillInstanced",
+                        texture_fill_instanced_pipelines_);
+#ifdef IMPELLER_ENABLE_OPENGLES
+  RegisterVariantFamily("TextureExternal", texture_external_pipelines_);
+#endif  // IMPELLER_ENABLE_OPENGLES
+  RegisterVariantFamily("PositionUV", position_uv_pipelines_);
+  RegisterVariantFamily("TiledTexture", tiled_texture_pipelines_);
+  RegisterVariantFamily("GaussianBlurDecal",
+                        gaussian_blur_noalpha_decal_pipelines_);
+  RegisterVariantFamily("GaussianBlur",
+                        gaussian_blur_noalpha_nodecal_pipelines_);
+  RegisterVariantFamily("BorderMaskBlur", border_mask_blur_pipelines_);
+  RegisterVariantFamily("MorphologyFilter", morphology_filter_pipelines_);
+  RegisterVariantFamily("ColorMatrixColorFilter",
+                        color_matrix_color_filter_pipelines_);
+  RegisterVariantFamily("LinearToSrgbFilter", linear_to_srgb_filter_pipelines_);
+  RegisterVariantFamily("SrgbToLinearFilter", srgb_to_linear_filter_pipelines_);
+  RegisterVariantFamily("Clip", clip_pipelines_);
+  RegisterVariantFamily("GlyphAtlas", glyph_atlas_pipelines_);
+  RegisterVariantFamily("GlyphAtlasBlur", glyph_atlas_blur_pipelines_);
+  RegisterVariantFamily("GlyphAtlasColor", glyph_atlas_color_pipelines_);
+  RegisterVariantFamily("GlyphAtlasSdf", glyph_atlas_sdf_pipelines_);
+  RegisterVariantFamily("GeometryColor", geometry_color_pipelines_);
+  RegisterVariantFamily("YUVToRGBFilter", yuv_to_rgb_filter_pipelines_);
+  RegisterVariantFamily("PorterDuffBlend", porter_duff_blend_pipelines_);
+  RegisterVariantFamily("BlendColor", blend_color_pipelines_);
+  RegisterVariantFamily("BlendColorBurn", blend_colorburn_pipelines_);
+  RegisterVariantFamily("BlendColorDodge", blend_colordodge_pipelines_);
+  RegisterVariantFamily("BlendDarken", blend_darken_pipelines_);
+  RegisterVariantFamily("BlendDifference", blend_difference_pipelines_);
+  RegisterVariantFamily("BlendExclusion", blend_exclusion_pipelines_);
+  RegisterVariantFamily("BlendHardLight", blend_hardlight_pipelines_);
+  RegisterVariantFamily("BlendHue", blend_hue_pipelines_);
+  RegisterVariantFamily("BlendLighten", blend_lighten_pipelines_);
+  RegisterVariantFamily("BlendLuminosity", blend_luminosity_pipelines_);
+  RegisterVariantFamily("BlendMultiply", blend_multiply_pipelines_);
+  RegisterVariantFamily("BlendOverlay", blend_overlay_pipelines_);
+  RegisterVariantFamily("BlendSaturation", blend_saturation_pipelines_);
+  RegisterVariantFamily("BlendScreen", blend_screen_pipelines_);
+  RegisterVariantFamily("BlendSoftLight", blend_softlight_pipelines_);
+  RegisterVariantFamily("FramebufferBlendColor",
+                        framebuffer_blend_color_pipelines_);
+  RegisterVariantFamily("FramebufferBlendColorBurn",
+                        framebuffer_blend_colorburn_pipelines_);
+  RegisterVariantFamily("FramebufferBlendColorDodge",
+                        framebuffer_blend_colordodge_pipelines_);
+  RegisterVariantFamily("FramebufferBlendDarken",
+                        framebuffer_blend_darken_pipelines_);
+  RegisterVariantFamily("FramebufferBlendDifference",
+                        framebuffer_blend_difference_pipelines_);
+  RegisterVariantFamily("FramebufferBlendExclusion",
+                        framebuffer_blend_exclusion_pipelines_);
+  RegisterVariantFamily("FramebufferBlendHardLight",
+                        framebuffer_blend_hardlight_pipelines_);
+  RegisterVariantFamily("FramebufferBlendHue",
+                        framebuffer_blend_hue_pipelines_);
+  RegisterVariantFamily("FramebufferBlendLighten",
+                        framebuffer_blend_lighten_pipelines_);
+  RegisterVariantFamily("FramebufferBlendLuminosity",
+                        framebuffer_blend_luminosity_pipelines_);
+  RegisterVariantFamily("FramebufferBlendMultiply",
+                        framebuffer_blend_multiply_pipelines_);
+  RegisterVariantFamily("FramebufferBlendOverlay",
+                        framebuffer_blend_overlay_pipelines_);
+  RegisterVariantFamily("FramebufferBlendSaturation",
+                        framebuffer_blend_saturation_pipelines_);
+  RegisterVariantFamily("FramebufferBlendScreen",
+                        framebuffer_blend_screen_pipelines_);
+  RegisterVariantFamily("FramebufferBlendSoftLight",
+                        framebuffer_blend_softlight_pipelines_);
+
   is_valid_ = true;
 }
 
@@ -459,4 +629,70 @@ void ContentContext::SetWireframe(bool wireframe) {
   wireframe_ = wireframe;
 }
 
+void ContentContext::SetVariantUsageCallback(VariantUsageCallback callback) {
+  variant_usage_callback_ = std::move(callback);
+}
+
+bool ContentContext::WarmUpVariant(const std::string& family,
+                                   const ContentContextOptions& options) {
+  // Runtime effect shaders are loaded by the framework well after setup, so
+  // their recorded variants cannot be pre-created here. Park the options
+  // until the shader is registered (on first draw or via explicit
+  // precompilation), at which point they are replayed.
+  constexpr std::string_view kRuntimeEffectPrefix = "runtime_effect/";
+  if (family.compare(0, kRuntimeEffectPrefix.size(), kRuntimeEffectPrefix) ==
+      0) {
+    uint64_t shader_hash = 0;
+    auto hex = family.substr(kRuntimeEffectPrefix.size());
+    auto [ptr, ec] =
+        std::from_chars(hex.data(), hex.data() + hex.size(), shader_hash, 16);
+    if (ec != std::errc() || ptr != hex.data() + hex.size() || hex.empty()) {
+      return false;
+    }
+    std::scoped_lock lock(variants_mutex_);
+    runtime_effect_variants_[shader_hash].push_back(options);
+    return true;
+  }
+
+  auto found = variant_families_.find(family);
+  if (found == variant_families_.end()) {
+    return false;
+  }
+  // Warm-up work must not delay the pipelines a frame is actually blocked
+  // on; backends with compilation queues rank it behind them.
+  return found->second(options, PipelineCreationPriority::kSpeculative);
+}
+
+std::string ContentContext::RuntimeEffectFamilyName(uint64_t shader_hash) {
+  std::stringstream stream;
+  stream << "runtime_effect/" << std::hex << shader_hash;
+  return stream.str();
+}
+
+void ContentContext::RecordRuntimeEffectUsage(
+    uint64_t shader_hash,
+    const ContentContextOptions& options) const {
+  if (!variant_usage_callback_) {
+    return;
+  }
+  {
+    std::scoped_lock lock(variants_mutex_);
+    if (!recorded_runtime_effects_.emplace(shader_hash, options.ToKey())
+             .second) {
+      return;
+    }
+  }
+  variant_usage_callback_(RuntimeEffectFamilyName(shader_hash), options);
+}
+
+std::vector<ContentContextOptions>
+ContentContext::GetRecordedRuntimeEffectVariants(uint64_t shader_hash) const {
+  std::scoped_lock lock(variants_mutex_);
+  auto found = runtime_effect_variants_.find(shader_hash);
+  if (found == runtime_effect_variants_.end()) {
+    return {};
+  }
+  return found->second;
+}
+
 }  // namespace impeller
@@ -4,10 +4,16 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <initializer_list>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <set>
+#include <string>
 #include <unordered_map>
+#include <utility>
 
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/hash_combine.h"
@@ -15,6 +21,7 @@
 #include "flutter/fml/macros.h"
 #include "impeller/base/validation.h"
 #include "impeller/core/formats.h"
+#include "impeller/entity/contents/filters/filter_snapshot_cache.h"
 #include "impeller/entity/entity.h"
 #include "impeller/renderer/capabilities.h"
 #include "impeller/renderer/pipeline.h"
@@ -37,7 +44,11 @@
 #include "impeller/entity/conical_gradient_fill.frag.h"
 #include "impeller/entity/glyph_atlas.frag.h"
 #include "impeller/entity/glyph_atlas.vert.h"
+#include "impeller/entity/glyph_atlas_blur.frag.h"
+#include "impeller/entity/glyph_atlas_blur.vert.h"
 #include "impeller/entity/glyph_atlas_color.frag.h"
+#include "impeller/entity/glyph_atlas_sdf.frag.h"
+#include "impeller/entity/gradient.comp.h"
 #include "impeller/entity/gradient_fill.vert.h"
 #include "impeller/entity/linear_gradient_fill.frag.h"
 #include "impeller/entity/linear_to_srgb_filter.frag.h"
@@ -48,11 +59,13 @@
 #include "impeller/entity/porter_duff_blend.frag.h"
 #include "impeller/entity/porter_duff_blend.vert.h"
 #include "impeller/entity/radial_gradient_fill.frag.h"
+#include "impeller/entity/rrect.frag.h"
 #include "impeller/entity/rrect_blur.frag.h"
 #include "impeller/entity/rrect_blur.vert.h"
 #include "impeller/entity/solid_fill.frag.h"
 #include "impeller/entity/solid_fill.vert.h"
 #include "impeller/entity/srgb_to_linear_filter.frag.h"
+#include "impeller/entity/stroke_segment.comp.h"
 #include "impeller/entity/srgb_to_linear_filter.vert.h"
 #include "impeller/entity/sweep_gradient_fill.frag.h"
 #include "impeller/entity/texture_fill.frag.h"
@@ -75,6 +88,7 @@
 #include "impeller/entity/linear_gradient_ssbo_fill.frag.h"
 #include "impeller/entity/radial_gradient_ssbo_fill.frag.h"
 #include "impeller/entity/sweep_gradient_ssbo_fill.frag.h"
+#include "impeller/entity/texture_fill_instanced.vert.h"
 
 #include "impeller/entity/advanced_blend.frag.h"
 #include "impeller/entity/advanced_blend.vert.h"
@@ -122,9 +136,15 @@ using SweepGradientSSBOFillPipeline =
                     SweepGradientSsboFillFragmentShader>;
 using RRectBlurPipeline =
     RenderPipelineT<RrectBlurVertexShader, RrectBlurFragmentShader>;
+// The analytic rrect fill shares the blur's pass-through vertex stage.
+using RRectPipeline =
+    RenderPipelineT<RrectBlurVertexShader, RrectFragmentShader>;
 using BlendPipeline = RenderPipelineT<BlendVertexShader, BlendFragmentShader>;
 using TexturePipeline =
     RenderPipelineT<TextureFillVertexShader, TextureFillFragmentShader>;
+using TextureFillInstancedPipeline =
+    RenderPipelineT<TextureFillInstancedVertexShader,
+                    TextureFillFragmentShader>;
 using PositionUVPipeline =
     RenderPipelineT<TextureFillVertexShader, TiledTextureFillFragmentShader>;
 using TiledTexturePipeline =
@@ -151,8 +171,12 @@ using SrgbToLinearFilterPipeline =
                     SrgbToLinearFilterFragmentShader>;
 using GlyphAtlasPipeline =
     RenderPipelineT<GlyphAtlasVertexShader, GlyphAtlasFragmentShader>;
+using GlyphAtlasBlurPipeline =
+    RenderPipelineT<GlyphAtlasBlurVertexShader, GlyphAtlasBlurFragmentShader>;
 using GlyphAtlasColorPipeline =
     RenderPipelineT<GlyphAtlasVertexShader, GlyphAtlasColorFragmentShader>;
+using GlyphAtlasSdfPipeline =
+    RenderPipelineT<GlyphAtlasVertexShader, GlyphAtlasSdfFragmentShader>;
 using PorterDuffBlendPipeline =
     RenderPipelineT<PorterDuffBlendVertexShader, PorterDuffBlendFragmentShader>;
 // Instead of requiring new shaders for clips, the solid fill stages are used
@@ -244,8 +268,14 @@ using FramebufferBlendSoftLightPipeline =
 
 /// Geometry Pipelines
 using PointsComputeShaderPipeline = ComputePipelineBuilder<PointsComputeShader>;
+using StrokeSegmentComputeShaderPipeline =
+    ComputePipelineBuilder<StrokeSegmentComputeShader>;
 using UvComputeShaderPipeline = ComputePipelineBuilder<UvComputeShader>;
 
+/// Gradient Pipelines
+using GradientComputeShaderPipeline =
+    ComputePipelineBuilder<GradientComputeShader>;
+
 #ifdef IMPELLER_ENABLE_OPENGLES
 using TextureExternalPipeline =
     RenderPipelineT<TextureFillVertexShader, TextureFillExternalFragmentShader>;
@@ -297,6 +327,17 @@ struct ContentContextOptions {
     }
   };
 
+  /// Encodes these options as a stable 64-bit key suitable for persisting in
+  /// a pipeline usage manifest across sessions. The bit layout is versioned;
+  /// keys written with a different layout fail to decode rather than
+  /// producing bogus options.
+  uint64_t ToKey() const;
+
+  /// Decodes a key produced by |ToKey|. Returns `std::nullopt` for keys with
+  /// out-of-range values or an unknown format version (for example, keys
+  /// written by a different engine version).
+  static std::optional<ContentContextOptions> FromKey(uint64_t key);
+
   void ApplyToPipelineDescriptor(PipelineDescriptor& desc) const;
 };
 
@@ -371,6 +412,11 @@ class ContentContext {
     return GetPipeline(rrect_blur_pipelines_, opts);
   }
 
+  std::shared_ptr<Pipeline<PipelineDescriptor>> GetRRectPipeline(
+      ContentContextOptions opts) const {
+    return GetPipeline(rrect_pipelines_, opts);
+  }
+
   std::shared_ptr<Pipeline<PipelineDescriptor>> GetSweepGradientFillPipeline(
       ContentContextOptions opts) const {
     return GetPipeline(sweep_gradient_fill_pipelines_, opts);
@@ -391,6 +437,12 @@ class ContentContext {
     return GetPipeline(texture_pipelines_, opts);
   }
 
+  std::shared_ptr<Pipeline<PipelineDescriptor>> GetTextureFillInstancedPipeline(
+      ContentContextOptions opts) const {
+    FML_DCHECK(GetDeviceCapabilities().SupportsSSBO());
+    return GetPipeline(texture_fill_instanced_pipelines_, opts);
+  }
+
 #ifdef IMPELLER_ENABLE_OPENGLES
   std::shared_ptr<Pipeline<PipelineDescriptor>> GetTextureExternalPipeline(
       ContentContextOptions opts) const {
@@ -455,11 +507,21 @@ class ContentContext {
     return GetPipeline(glyph_atlas_pipelines_, opts);
   }
 
+  std::shared_ptr<Pipeline<PipelineDescriptor>> GetGlyphAtlasBlurPipeline(
+      ContentContextOptions opts) const {
+    return GetPipeline(glyph_atlas_blur_pipelines_, opts);
+  }
+
   std::shared_ptr<Pipeline<PipelineDescriptor>> GetGlyphAtlasColorPipeline(
       ContentContextOptions opts) const {
     return GetPipeline(glyph_atlas_color_pipelines_, opts);
   }
 
+  std::shared_ptr<Pipeline<PipelineDescriptor>> GetGlyphAtlasSdfPipeline(
+      ContentContextOptions opts) const {
+    return GetPipeline(glyph_atlas_sdf_pipelines_, opts);
+  }
+
   std::shared_ptr<Pipeline<PipelineDescriptor>> GetGeometryColorPipeline(
       ContentContextOptions opts) const {
     return GetPipeline(geometry_color_pipelines_, opts);
@@ -655,12 +717,61 @@ class ContentContext {
     return uv_compute_pipelines_;
   }
 
+  std::shared_ptr<Pipeline<ComputePipelineDescriptor>>
+  GetGradientComputePipeline() const {
+    FML_DCHECK(GetDeviceCapabilities().SupportsCompute());
+    return gradient_compute_pipelines_;
+  }
+
+  std::shared_ptr<Pipeline<ComputePipelineDescriptor>>
+  GetStrokeComputePipeline() const {
+    FML_DCHECK(GetDeviceCapabilities().SupportsCompute());
+    return stroke_segment_compute_pipelines_;
+  }
+
   std::shared_ptr<Context> GetContext() const;
 
   const Capabilities& GetDeviceCapabilities() const;
 
   void SetWireframe(bool wireframe);
 
+  using VariantUsageCallback =
+      std::function<void(const std::string& family,
+                         const ContentContextOptions& options)>;
+
+  /// Sets a callback invoked on the requesting thread whenever a pipeline
+  /// variant is created for the first time. This feeds the persistent usage
+  /// manifest so that the same variants can be pre-created on the next
+  /// launch. Must be set before pipelines are requested concurrently.
+  void SetVariantUsageCallback(VariantUsageCallback callback);
+
+  /// Pre-creates a pipeline variant of the named family, typically one
+  /// recorded in a previous session's usage manifest. Returns false if the
+  /// family is unknown or unsupported by the current device. Safe to call
+  /// from a background thread while other threads request pipelines.
+  ///
+  /// Runtime effect families (named `runtime_effect/<code hash>`) cannot be
+  /// pre-created before their shader is loaded; their recorded options are
+  /// retained instead and replayed when the shader is first registered (see
+  /// |GetRecordedRuntimeEffectVariants|).
+  bool WarmUpVariant(const std::string& family,
+                     const ContentContextOptions& options);
+
+  /// The family name under which a runtime effect with the given code hash
+  /// is recorded in the usage manifest.
+  static std::string RuntimeEffectFamilyName(uint64_t shader_hash);
+
+  /// Records that a runtime effect pipeline variant was used this session so
+  /// the next launch can pre-create it as soon as the shader is available.
+  /// Repeat uses of the same variant are recorded once.
+  void RecordRuntimeEffectUsage(uint64_t shader_hash,
+                                const ContentContextOptions& options) const;
+
+  /// The variants recorded for the given runtime effect by previous
+  /// sessions' usage manifests, in first-use order.
+  std::vector<ContentContextOptions> GetRecordedRuntimeEffectVariants(
+      uint64_t shader_hash) const;
+
   using SubpassCallback =
       std::function<bool(const ContentContext&, RenderPass&)>;
 
@@ -679,6 +790,11 @@ class ContentContext {
     return render_target_cache_;
   }
 
+  /// @brief  Retrieve the cross-frame cache of rendered filter snapshots.
+  std::shared_ptr<FilterSnapshotCache> GetFilterSnapshotCache() const {
+    return filter_snapshot_cache_;
+  }
+
  private:
   std::shared_ptr<Context> context_;
   std::shared_ptr<LazyGlyphAtlas> lazy_glyph_atlas_;
@@ -728,7 +844,12 @@ class ContentContext {
 
     size_t GetPipelineCount() const { return pipelines_.size(); }
 
+    void SetName(std::string name) { name_ = std::move(name); }
+
+    const std::string& GetName() const { return name_; }
+
    private:
+    std::string name_;
     std::optional<ContentContextOptions> default_options_;
     std::unordered_map<ContentContextOptions,
                        std::unique_ptr<PipelineT>,
@@ -764,8 +885,11 @@ class ContentContext {
   mutable Variants<SweepGradientSSBOFillPipeline>
       sweep_gradient_ssbo_fill_pipelines_;
   mutable Variants<RRectBlurPipeline> rrect_blur_pipelines_;
+  mutable Variants<RRectPipeline> rrect_pipelines_;
   mutable Variants<BlendPipeline> texture_blend_pipelines_;
   mutable Variants<TexturePipeline> texture_pipelines_;
+  mutable Variants<TextureFillInstancedPipeline>
+      texture_fill_instanced_pipelines_;
 #ifdef IMPELLER_ENABLE_OPENGLES
   mutable Variants<TextureExternalPipeline> texture_external_pipelines_;
 #endif  // IMPELLER_ENABLE_OPENGLES
@@ -783,7 +907,9 @@ class ContentContext {
   mutable Variants<SrgbToLinearFilterPipeline> srgb_to_linear_filter_pipelines_;
   mutable Variants<ClipPipeline> clip_pipelines_;
   mutable Variants<GlyphAtlasPipeline> glyph_atlas_pipelines_;
+  mutable Variants<GlyphAtlasBlurPipeline> glyph_atlas_blur_pipelines_;
   mutable Variants<GlyphAtlasColorPipeline> glyph_atlas_color_pipelines_;
+  mutable Variants<GlyphAtlasSdfPipeline> glyph_atlas_sdf_pipelines_;
   mutable Variants<GeometryColorPipeline> geometry_color_pipelines_;
   mutable Variants<YUVToRGBFilterPipeline> yuv_to_rgb_filter_pipelines_;
   mutable Variants<PorterDuffBlendPipeline> porter_duff_blend_pipelines_;
@@ -838,11 +964,55 @@ class ContentContext {
       point_field_compute_pipelines_;
   mutable std::shared_ptr<Pipeline<ComputePipelineDescriptor>>
       uv_compute_pipelines_;
+  mutable std::shared_ptr<Pipeline<ComputePipelineDescriptor>>
+      gradient_compute_pipelines_;
+  mutable std::shared_ptr<Pipeline<ComputePipelineDescriptor>>
+      stroke_segment_compute_pipelines_;
+
+  // Registers a variant family under a stable name so its usage can be
+  // recorded to and replayed from the persistent manifest.
+  template <class TypedPipeline>
+  void RegisterVariantFamily(const std::string& name,
+                             Variants<TypedPipeline>& container) {
+    container.SetName(name);
+    variant_families_[name] = [this, &container](
+                                  ContentContextOptions opts,
+                                  PipelineCreationPriority priority) {
+      if (container.GetDefault() == nullptr) {
+        // The family exists but is unsupported by this device (for example,
+        // SSBO gradients without SSBO support).
+        return false;
+      }
+      return GetPipeline(container, opts, priority) != nullptr;
+    };
+  }
+
+  std::unordered_map<
+      std::string,
+      std::function<bool(ContentContextOptions, PipelineCreationPriority)>>
+      variant_families_;
+  VariantUsageCallback variant_usage_callback_;
+
+  // Options recorded for runtime effects by previous sessions, keyed by
+  // shader code hash, waiting for the shader to be loaded and registered.
+  mutable std::unordered_map<uint64_t, std::vector<ContentContextOptions>>
+      runtime_effect_variants_;
+  // Runtime effect variants already reported to the usage callback this
+  // session, deduplicated so hot draw paths do not hit the manifest lock.
+  mutable std::set<std::pair<uint64_t, uint64_t>> recorded_runtime_effects_;
+
+  // Guards the variant containers, which are shared between the raster
+  // thread and the background thread that pre-creates variants recorded in
+  // previous sessions. The lock is never held while waiting on pipeline
+  // compilation.
+  mutable std::mutex variants_mutex_;
 
   template <class TypedPipeline>
   std::shared_ptr<Pipeline<PipelineDescriptor>> GetPipeline(
       Variants<TypedPipeline>& container,
-      ContentContextOptions opts) const {
+      ContentContextOptions opts,
+      PipelineCreationPriority priority =
+          PipelineCreationPriority::kFrameBlocking) const {
     if (!IsValid()) {
       return nullptr;
     }
@@ -851,8 +1021,15 @@ class ContentContext {
       opts.wireframe = true;
     }
 
-    if (auto found = container.Get(opts)) {
-      return found->WaitAndGet();
+    TypedPipeline* cached = nullptr;
+    size_t variants_count = 0u;
+    {
+      std::scoped_lock lock(variants_mutex_);
+      cached = container.Get(opts);
+      variants_count = container.GetPipelineCount();
+    }
+    if (cached) {
+      return cached->WaitAndGet();
     }
 
     auto prototype = container.GetDefault();
@@ -865,16 +1042,32 @@ class ContentContext {
       return nullptr;
     }
 
+    if (variant_usage_callback_ && !container.GetName().empty()) {
+      variant_usage_callback_(container.GetName(), opts);
+    }
+
     auto variant_future = pipeline->CreateVariant(
-        [&opts, variants_count =
-                    container.GetPipelineCount()](PipelineDescriptor& desc) {
+        [&opts, variants_count](PipelineDescriptor& desc) {
           opts.ApplyToPipelineDescriptor(desc);
           desc.SetLabel(
               SPrintF("%s V#%zu", desc.GetLabel().c_str(), variants_count));
-        });
+        },
+        priority);
     auto variant = std::make_unique<TypedPipeline>(std::move(variant_future));
     auto variant_pipeline = variant->WaitAndGet();
-    container.Set(opts, std::move(variant));
+    {
+      std::scoped_lock lock(variants_mutex_);
+      if (TypedPipeline* existing = container.Get(opts)) {
+        // Another thread created the same variant while this one was
+        // compiling; keep the one already in the container.
+        cached = existing;
+      } else {
+        container.Set(opts, std::move(variant));
+      }
+    }
+    if (cached) {
+      return cached->WaitAndGet();
+    }
     return variant_pipeline;
   }
 
@@ -884,6 +1077,8 @@ class ContentContext {
   std::shared_ptr<scene::SceneContext> scene_context_;
 #endif  // IMPELLER_ENABLE_3D
   std::shared_ptr<RenderTargetAllocator> render_target_cache_;
+  std::shared_ptr<FilterSnapshotCache> filter_snapshot_cache_ =
+      std::make_shared<FilterSnapshotCache>();
   bool wireframe_ = false;
 
   ContentContext(const ContentContext&) = delete;
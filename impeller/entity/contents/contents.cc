@@ -123,6 +123,10 @@ std::optional<Color> Contents::AsBackgroundColor(const Entity& entity,
   return {};
 }
 
+std::optional<std::pair<Rect, Color>> Contents::AsSolidColorRect() const {
+  return std::nullopt;
+}
+
 const FilterContents* Contents::AsFilter() const {
   return nullptr;
 }
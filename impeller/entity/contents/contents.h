@@ -6,6 +6,7 @@
 
 #include <functional>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "flutter/fml/macros.h"
@@ -166,6 +167,15 @@ class Contents {
   virtual std::optional<Color> AsBackgroundColor(const Entity& entity,
                                                  ISize target_size) const;
 
+  //----------------------------------------------------------------------------
+  /// @brief Returns the rect and (unpremultiplied) color if this Contents
+  ///        draws a single solid color fill of an axis aligned rect.
+  ///
+  ///        Consecutive draws for which this returns a value can be merged
+  ///        into one batched draw call by `EntityPass::AddEntity`.
+  ///
+  virtual std::optional<std::pair<Rect, Color>> AsSolidColorRect() const;
+
   //----------------------------------------------------------------------------
   /// @brief Cast to a filter. Returns `nullptr` if this Contents is not a
   ///        filter.
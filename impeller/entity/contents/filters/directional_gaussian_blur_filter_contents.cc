@@ -8,6 +8,7 @@
 #include <utility>
 #include <valarray>
 
+#include "flutter/fml/hash_combine.h"
 #include "impeller/base/strings.h"
 #include "impeller/base/validation.h"
 #include "impeller/core/formats.h"
@@ -40,6 +41,34 @@ Sigma ScaleSigma(Sigma sigma) {
   return Sigma(clamped * scalar);
 }
 
+// Returns the power-of-two downsample scale permitted for a blur of the given
+// radius at the given quality. Blurring at a lower resolution with a
+// proportionally smaller radius is visually near-identical once the radius is
+// large enough to hide the resampling, and cuts bandwidth by the square of
+// the scale.
+static Scalar DownsampleLadderScale(Scalar radius,
+                                    FilterContents::BlurQuality quality) {
+  if (quality == FilterContents::BlurQuality::kHigh) {
+    return 1.0;
+  }
+  // The minimum blur radius that must remain after downsampling. Keeps small
+  // blurs pixel exact.
+  constexpr Scalar kMinScaledRadius = 4.0;
+  const Scalar min_scale =
+      quality == FilterContents::BlurQuality::kMedium ? 0.5 : 0.25;
+  Scalar scale = 1.0;
+  while (scale > min_scale && radius * scale * 0.5 >= kMinScaledRadius) {
+    scale *= 0.5;
+  }
+  return scale;
+}
+
+static void HashCombineMatrix(std::size_t& seed, const Matrix& matrix) {
+  for (Scalar element : matrix.m) {
+    fml::HashCombineSeed(seed, element);
+  }
+}
+
 DirectionalGaussianBlurFilterContents::DirectionalGaussianBlurFilterContents() =
     default;
 
@@ -75,6 +104,10 @@ void DirectionalGaussianBlurFilterContents::SetIsSecondPass(
   is_second_pass_ = is_second_pass;
 }
 
+void DirectionalGaussianBlurFilterContents::SetQuality(BlurQuality quality) {
+  quality_ = quality;
+}
+
 std::optional<Entity> DirectionalGaussianBlurFilterContents::RenderFilter(
     const FilterInput::Vector& inputs,
     const ContentContext& renderer,
@@ -129,6 +162,28 @@ std::optional<Entity> DirectionalGaussianBlurFilterContents::RenderFilter(
                                 entity.GetClipDepth());  // No blur to render.
   }
 
+  // The blurred output is a pure function of the input snapshot and the blur
+  // parameters, so consult the cross-frame snapshot cache before re-rendering.
+  // The key includes the input texture's identity, which changes whenever the
+  // filtered content is re-rendered, so hits only occur for stable inputs
+  // (e.g. image-backed or raster-cached content).
+  std::size_t cache_seed = fml::HashCombine(
+      reinterpret_cast<uintptr_t>(input_snapshot->texture.get()),
+      blur_sigma_.sigma, secondary_blur_sigma_.sigma, blur_direction_.x,
+      blur_direction_.y, static_cast<uint64_t>(tile_mode_), is_second_pass_,
+      static_cast<uint64_t>(quality_));
+  HashCombineMatrix(cache_seed, input_snapshot->transform);
+  HashCombineMatrix(cache_seed, entity.GetTransformation());
+  HashCombineMatrix(cache_seed, effect_transform);
+  uint64_t cache_key = cache_seed;
+
+  auto snapshot_cache = renderer.GetFilterSnapshotCache();
+  if (auto cached = snapshot_cache->Get(cache_key); cached.has_value()) {
+    cached->opacity = input_snapshot->opacity;
+    return Entity::FromSnapshot(cached.value(), entity.GetBlendMode(),
+                                entity.GetClipDepth());
+  }
+
   // A matrix that rotates the snapshot space such that the blur direction is
   // +X.
   auto texture_rotate = Matrix::MakeRotationZ(
@@ -258,6 +313,14 @@ std::optional<Entity> DirectionalGaussianBlurFilterContents::RenderFilter(
     Scalar y_radius = std::abs(pass_transform.GetDirectionScale(Vector2(
         0, !is_second_pass_ ? 1 : Radius{secondary_blur_sigma_}.radius)));
     scale.y = scale_curve(y_radius);
+
+    // Lower quality settings snap onto a power-of-two downsample ladder for
+    // big radii. The output snapshot transform below already compensates for
+    // `scale`, so coverage is unaffected.
+    scale.x = std::min(
+        scale.x,
+        DownsampleLadderScale(transformed_blur_radius_length, quality_));
+    scale.y = std::min(scale.y, DownsampleLadderScale(y_radius, quality_));
   }
 
   Vector2 scaled_size = pass_texture_rect.size * scale;
@@ -276,15 +339,18 @@ std::optional<Entity> DirectionalGaussianBlurFilterContents::RenderFilter(
   sampler_desc.width_address_mode = SamplerAddressMode::kClampToEdge;
   sampler_desc.width_address_mode = SamplerAddressMode::kClampToEdge;
 
-  return Entity::FromSnapshot(
-      Snapshot{.texture = out_texture,
-               .transform = texture_rotate.Invert() *
-                            Matrix::MakeTranslation(pass_texture_rect.origin) *
-                            Matrix::MakeScale((1 / scale) *
-                                              (scaled_size / floored_size)),
-               .sampler_descriptor = sampler_desc,
-               .opacity = input_snapshot->opacity},
-      entity.GetBlendMode(), entity.GetClipDepth());
+  Snapshot output_snapshot{
+      .texture = out_texture,
+      .transform =
+          texture_rotate.Invert() *
+          Matrix::MakeTranslation(pass_texture_rect.origin) *
+          Matrix::MakeScale((1 / scale) * (scaled_size / floored_size)),
+      .sampler_descriptor = sampler_desc,
+      .opacity = input_snapshot->opacity};
+  snapshot_cache->Put(cache_key, output_snapshot);
+
+  return Entity::FromSnapshot(output_snapshot, entity.GetBlendMode(),
+                              entity.GetClipDepth());
 }
 
 std::optional<Rect>
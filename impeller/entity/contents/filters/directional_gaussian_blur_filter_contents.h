@@ -69,6 +69,10 @@ class DirectionalGaussianBlurFilterContents final : public FilterContents {
   /// beginning of the chain.
   void SetIsSecondPass(bool is_second_pass);
 
+  /// Set the quality/bandwidth trade-off for this blur.
+  /// See `FilterContents::BlurQuality`.
+  void SetQuality(BlurQuality quality);
+
   // |FilterContents|
   std::optional<Rect> GetFilterSourceCoverage(
       const Matrix& effect_transform,
@@ -95,6 +99,7 @@ class DirectionalGaussianBlurFilterContents final : public FilterContents {
   BlurStyle blur_style_ = BlurStyle::kNormal;
   Entity::TileMode tile_mode_ = Entity::TileMode::kDecal;
   bool is_second_pass_ = false;
+  BlurQuality quality_ = BlurQuality::kHigh;
 
   DirectionalGaussianBlurFilterContents(
       const DirectionalGaussianBlurFilterContents&) = delete;
@@ -37,7 +37,8 @@ std::shared_ptr<FilterContents> FilterContents::MakeDirectionalGaussianBlur(
     BlurStyle blur_style,
     Entity::TileMode tile_mode,
     bool is_second_pass,
-    Sigma secondary_sigma) {
+    Sigma secondary_sigma,
+    BlurQuality quality) {
   auto blur = std::make_shared<DirectionalGaussianBlurFilterContents>();
   blur->SetInputs({std::move(input)});
   blur->SetSigma(sigma);
@@ -46,6 +47,7 @@ std::shared_ptr<FilterContents> FilterContents::MakeDirectionalGaussianBlur(
   blur->SetTileMode(tile_mode);
   blur->SetIsSecondPass(is_second_pass);
   blur->SetSecondarySigma(secondary_sigma);
+  blur->SetQuality(quality);
   return blur;
 }
 
@@ -54,7 +56,8 @@ std::shared_ptr<FilterContents> FilterContents::MakeGaussianBlur(
     Sigma sigma_x,
     Sigma sigma_y,
     BlurStyle blur_style,
-    Entity::TileMode tile_mode) {
+    Entity::TileMode tile_mode,
+    BlurQuality quality) {
   std::shared_ptr<FilterContents> x_blur = MakeDirectionalGaussianBlur(
       /*input=*/input,
       /*sigma=*/sigma_x,
@@ -62,7 +65,8 @@ std::shared_ptr<FilterContents> FilterContents::MakeGaussianBlur(
       /*blur_style=*/BlurStyle::kNormal,
       /*tile_mode=*/tile_mode,
       /*is_second_pass=*/false,
-      /*secondary_sigma=*/{});
+      /*secondary_sigma=*/{},
+      /*quality=*/quality);
   std::shared_ptr<FilterContents> y_blur = MakeDirectionalGaussianBlur(
       /*input=*/FilterInput::Make(x_blur),
       /*sigma=*/sigma_y,
@@ -70,7 +74,8 @@ std::shared_ptr<FilterContents> FilterContents::MakeGaussianBlur(
       /*blur_style=*/blur_style,
       /*tile_mode=*/tile_mode,
       /*is_second_pass=*/true,
-      /*secondary_sigma=*/sigma_x);
+      /*secondary_sigma=*/sigma_x,
+      /*quality=*/quality);
   return y_blur;
 }
 
@@ -31,6 +31,19 @@ class FilterContents : public Contents {
 
   enum class MorphType { kDilate, kErode };
 
+  /// The quality/bandwidth trade-off for Gaussian blurs. Lower qualities
+  /// snap the blur pass onto a power-of-two downsample ladder when the blur
+  /// radius is large enough to hide the resampling, cutting bandwidth by the
+  /// square of the scale at visually near-identical output.
+  enum class BlurQuality {
+    /// Blur at the resolution chosen by the internal scale curve only.
+    kHigh,
+    /// Permit blurring at up to half resolution for large radii.
+    kMedium,
+    /// Permit blurring at up to quarter resolution for large radii.
+    kLow,
+  };
+
   /// Creates a gaussian blur that operates in one direction.
   /// See also: `MakeGaussianBlur`
   static std::shared_ptr<FilterContents> MakeDirectionalGaussianBlur(
@@ -40,7 +53,8 @@ class FilterContents : public Contents {
       BlurStyle blur_style = BlurStyle::kNormal,
       Entity::TileMode tile_mode = Entity::TileMode::kDecal,
       bool is_second_pass = false,
-      Sigma secondary_sigma = {});
+      Sigma secondary_sigma = {},
+      BlurQuality quality = BlurQuality::kHigh);
 
   /// Creates a gaussian blur that operates in 2 dimensions.
   /// See also: `MakeDirectionalGaussianBlur`
@@ -49,7 +63,8 @@ class FilterContents : public Contents {
       Sigma sigma_x,
       Sigma sigma_y,
       BlurStyle blur_style = BlurStyle::kNormal,
-      Entity::TileMode tile_mode = Entity::TileMode::kDecal);
+      Entity::TileMode tile_mode = Entity::TileMode::kDecal,
+      BlurQuality quality = BlurQuality::kHigh);
 
   static std::shared_ptr<FilterContents> MakeBorderMaskBlur(
       FilterInput::Ref input,
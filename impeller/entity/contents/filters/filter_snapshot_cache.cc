@@ -0,0 +1,67 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/contents/filters/filter_snapshot_cache.h"
+
+#include <utility>
+
+namespace impeller {
+
+FilterSnapshotCache::FilterSnapshotCache(size_t budget_bytes)
+    : budget_bytes_(budget_bytes) {}
+
+FilterSnapshotCache::~FilterSnapshotCache() = default;
+
+std::optional<Snapshot> FilterSnapshotCache::Get(uint64_t key) {
+  auto found = index_.find(key);
+  if (found == index_.end()) {
+    return std::nullopt;
+  }
+  // Move the entry to the front of the LRU list.
+  entries_.splice(entries_.begin(), entries_, found->second);
+  return entries_.front().snapshot;
+}
+
+void FilterSnapshotCache::Put(uint64_t key, Snapshot snapshot) {
+  if (!snapshot.texture) {
+    return;
+  }
+  size_t byte_size =
+      snapshot.texture->GetTextureDescriptor().GetByteSizeOfBaseMipLevel();
+
+  auto found = index_.find(key);
+  if (found != index_.end()) {
+    cached_byte_size_ -= found->second->byte_size;
+    cached_byte_size_ += byte_size;
+    found->second->snapshot = std::move(snapshot);
+    found->second->byte_size = byte_size;
+    entries_.splice(entries_.begin(), entries_, found->second);
+    EvictToBudget();
+    return;
+  }
+
+  entries_.push_front({key, std::move(snapshot), byte_size});
+  index_[key] = entries_.begin();
+  cached_byte_size_ += byte_size;
+  EvictToBudget();
+}
+
+size_t FilterSnapshotCache::GetCachedByteSize() const {
+  return cached_byte_size_;
+}
+
+size_t FilterSnapshotCache::GetEntryCount() const {
+  return entries_.size();
+}
+
+void FilterSnapshotCache::EvictToBudget() {
+  while (cached_byte_size_ > budget_bytes_ && entries_.size() > 1u) {
+    const auto& entry = entries_.back();
+    cached_byte_size_ -= entry.byte_size;
+    index_.erase(entry.key);
+    entries_.pop_back();
+  }
+}
+
+}  // namespace impeller
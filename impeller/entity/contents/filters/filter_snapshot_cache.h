@@ -0,0 +1,72 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <unordered_map>
+
+#include "impeller/renderer/snapshot.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief A budget-managed LRU cache of rendered filter `Snapshot`s, keyed
+///        by a hash of the filter parameters and input texture identity.
+///
+///        Expensive filters (Gaussian blur in particular) consult this cache
+///        before re-rendering their output. A cache key is only stable across
+///        frames when the filter's input resolves to the same texture with the
+///        same transform, so entries naturally miss whenever the filtered
+///        content changes. Least recently used entries are evicted once the
+///        combined texture size of the cached snapshots exceeds the budget.
+///
+///        One instance is owned by the `ContentContext` so cached output
+///        survives across frames. See `ContentContext::GetFilterSnapshotCache`.
+///
+class FilterSnapshotCache {
+ public:
+  /// The default maximum combined byte size of the cached snapshot textures.
+  static constexpr size_t kDefaultBudgetBytes = 32u * 1024u * 1024u;
+
+  explicit FilterSnapshotCache(size_t budget_bytes = kDefaultBudgetBytes);
+
+  ~FilterSnapshotCache();
+
+  /// @brief Returns the cached snapshot for `key` and marks it as most
+  ///        recently used, or std::nullopt on a miss.
+  std::optional<Snapshot> Get(uint64_t key);
+
+  /// @brief Stores a rendered snapshot under `key`, evicting least recently
+  ///        used entries if the budget is exceeded. Snapshots without a
+  ///        texture are not cached.
+  void Put(uint64_t key, Snapshot snapshot);
+
+  size_t GetCachedByteSize() const;
+
+  size_t GetEntryCount() const;
+
+ private:
+  struct CacheEntry {
+    uint64_t key = 0u;
+    Snapshot snapshot;
+    size_t byte_size = 0u;
+  };
+
+  /// Entries ordered from most to least recently used.
+  std::list<CacheEntry> entries_;
+  std::unordered_map<uint64_t, std::list<CacheEntry>::iterator> index_;
+  size_t cached_byte_size_ = 0u;
+  const size_t budget_bytes_;
+
+  void EvictToBudget();
+
+  FilterSnapshotCache(const FilterSnapshotCache&) = delete;
+
+  FilterSnapshotCache& operator=(const FilterSnapshotCache&) = delete;
+};
+
+}  // namespace impeller
@@ -0,0 +1,72 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/testing/testing.h"
+#include "impeller/entity/contents/filters/filter_snapshot_cache.h"
+#include "impeller/entity/entity_playground.h"
+
+namespace impeller {
+namespace testing {
+
+class FilterSnapshotCacheTest : public EntityPlayground {
+ public:
+  std::shared_ptr<Texture> MakeTexture(ISize size) {
+    TextureDescriptor desc = {
+        .format = PixelFormat::kB8G8R8A8UNormInt,
+        .size = size,
+    };
+    return GetContentContext()
+        ->GetContext()
+        ->GetResourceAllocator()
+        ->CreateTexture(desc);
+  }
+};
+
+INSTANTIATE_PLAYGROUND_SUITE(FilterSnapshotCacheTest);
+
+TEST_P(FilterSnapshotCacheTest, GetReturnsStoredSnapshot) {
+  FilterSnapshotCache cache;
+  ASSERT_FALSE(cache.Get(1u).has_value());
+
+  auto texture = MakeTexture(ISize(10, 10));
+  cache.Put(1u, Snapshot{.texture = texture});
+
+  auto snapshot = cache.Get(1u);
+  ASSERT_TRUE(snapshot.has_value());
+  ASSERT_EQ(snapshot->texture, texture);
+  ASSERT_EQ(cache.GetEntryCount(), 1u);
+}
+
+TEST_P(FilterSnapshotCacheTest, EvictsLeastRecentlyUsedEntryOverBudget) {
+  auto texture_a = MakeTexture(ISize(10, 10));
+  auto texture_b = MakeTexture(ISize(10, 10));
+  auto texture_c = MakeTexture(ISize(10, 10));
+  size_t texture_size =
+      texture_a->GetTextureDescriptor().GetByteSizeOfBaseMipLevel();
+
+  // Budget for exactly two textures.
+  FilterSnapshotCache cache(texture_size * 2);
+  cache.Put(1u, Snapshot{.texture = texture_a});
+  cache.Put(2u, Snapshot{.texture = texture_b});
+  ASSERT_EQ(cache.GetCachedByteSize(), texture_size * 2);
+
+  // Touch the first entry so the second becomes least recently used.
+  ASSERT_TRUE(cache.Get(1u).has_value());
+
+  cache.Put(3u, Snapshot{.texture = texture_c});
+  ASSERT_EQ(cache.GetEntryCount(), 2u);
+  ASSERT_TRUE(cache.Get(1u).has_value());
+  ASSERT_FALSE(cache.Get(2u).has_value());
+  ASSERT_TRUE(cache.Get(3u).has_value());
+}
+
+TEST_P(FilterSnapshotCacheTest, SnapshotsWithoutTexturesAreNotCached) {
+  FilterSnapshotCache cache;
+  cache.Put(1u, Snapshot{});
+  ASSERT_FALSE(cache.Get(1u).has_value());
+  ASSERT_EQ(cache.GetEntryCount(), 0u);
+}
+
+}  // namespace testing
+}  // namespace impeller
@@ -9,6 +9,10 @@
 #include "flutter/fml/logging.h"
 #include "impeller/core/texture.h"
 #include "impeller/entity/contents/content_context.h"
+#include "impeller/renderer/blit_pass.h"
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/compute_command.h"
+#include "impeller/renderer/compute_pass.h"
 #include "impeller/renderer/context.h"
 #include "impeller/renderer/render_pass.h"
 
@@ -42,6 +46,102 @@ std::shared_ptr<Texture> CreateGradientTexture(
   return texture;
 }
 
+static std::shared_ptr<Texture> CreateGradientTextureGPU(
+    const std::vector<Color>& colors,
+    const std::vector<Scalar>& stops,
+    const ContentContext& renderer) {
+  FML_DCHECK(renderer.GetDeviceCapabilities().SupportsCompute());
+
+  uint32_t texture_size = CalculateGradientTextureSize(colors, stops);
+  if (texture_size == 0) {
+    FML_DLOG(ERROR) << "Invalid gradient data.";
+    return nullptr;
+  }
+
+  auto context = renderer.GetContext();
+
+  impeller::TextureDescriptor texture_descriptor;
+  texture_descriptor.storage_mode = impeller::StorageMode::kDevicePrivate;
+  texture_descriptor.format = PixelFormat::kR8G8B8A8UNormInt;
+  texture_descriptor.size = {texture_size, 1};
+  auto texture =
+      context->GetResourceAllocator()->CreateTexture(texture_descriptor);
+  if (!texture) {
+    FML_DLOG(ERROR) << "Could not create Impeller texture.";
+    return nullptr;
+  }
+
+  // One packed R8G8B8A8 texel per invocation; the blit below copies them
+  // into the texture without the texels ever visiting the host.
+  DeviceBufferDescriptor buffer_desc;
+  buffer_desc.size = texture_size * sizeof(uint32_t);
+  buffer_desc.storage_mode = StorageMode::kDevicePrivate;
+  auto texel_buffer =
+      context->GetResourceAllocator()->CreateBuffer(buffer_desc);
+  if (!texel_buffer) {
+    FML_DLOG(ERROR) << "Could not create gradient texel buffer.";
+    return nullptr;
+  }
+
+  auto cmd_buffer = context->CreateCommandBuffer();
+  if (!cmd_buffer) {
+    return nullptr;
+  }
+  auto compute_pass = cmd_buffer->CreateComputePass();
+  auto& host_buffer = compute_pass->GetTransientsBuffer();
+
+  auto stop_data = CreateGradientColors(colors, stops);
+  auto color_view =
+      host_buffer.Emplace(stop_data.data(), stop_data.size() * sizeof(StopData),
+                          DefaultUniformAlignment());
+
+  {
+    using GS = GradientComputeShader;
+    ComputeCommand cmd;
+    DEBUG_COMMAND_INFO(cmd, "Gradient LUT");
+    cmd.pipeline = renderer.GetGradientComputePipeline();
+
+    GS::FrameInfo frame_info;
+    frame_info.colors_length = stop_data.size();
+    frame_info.texel_count = texture_size;
+
+    GS::BindFrameInfo(cmd, host_buffer.EmplaceUniform(frame_info));
+    GS::BindColorData(cmd, color_view);
+    GS::BindTexelData(cmd, texel_buffer->AsBufferView());
+
+    if (!compute_pass->AddCommand(std::move(cmd))) {
+      return nullptr;
+    }
+  }
+
+  compute_pass->SetGridSize(ISize(texture_size, 1));
+  compute_pass->SetThreadGroupSize(ISize(texture_size, 1));
+  if (!compute_pass->EncodeCommands()) {
+    return nullptr;
+  }
+
+  auto blit_pass = cmd_buffer->CreateBlitPass();
+  blit_pass->AddCopy(texel_buffer->AsBufferView(), texture);
+  if (!blit_pass->EncodeCommands(context->GetResourceAllocator()) ||
+      !cmd_buffer->SubmitCommands()) {
+    return nullptr;
+  }
+
+  texture->SetLabel(impeller::SPrintF("Gradient(%p)", texture.get()).c_str());
+  return texture;
+}
+
+std::shared_ptr<Texture> CreateGradientTexture(
+    const std::vector<Color>& colors,
+    const std::vector<Scalar>& stops,
+    const ContentContext& renderer) {
+  if (renderer.GetDeviceCapabilities().SupportsCompute()) {
+    return CreateGradientTextureGPU(colors, stops, renderer);
+  }
+  auto gradient_data = CreateGradientBuffer(colors, stops);
+  return CreateGradientTexture(gradient_data, renderer.GetContext());
+}
+
 std::vector<StopData> CreateGradientColors(const std::vector<Color>& colors,
                                            const std::vector<Scalar>& stops) {
   FML_DCHECK(stops.size() == colors.size());
@@ -19,6 +19,7 @@
 namespace impeller {
 
 class Context;
+class ContentContext;
 
 /**
  * @brief Create a host visible texture that contains the gradient defined
@@ -28,6 +29,20 @@ std::shared_ptr<Texture> CreateGradientTexture(
     const GradientData& gradient_data,
     const std::shared_ptr<impeller::Context>& context);
 
+/**
+ * @brief Create a texture that contains the gradient defined by the provided
+ * colors and stops.
+ *
+ * On backends with compute support the lookup table is written by a compute
+ * shader directly into a device private texture, skipping the CPU
+ * interpolation and host upload entirely. Otherwise this falls back to the
+ * host visible path above.
+ */
+std::shared_ptr<Texture> CreateGradientTexture(
+    const std::vector<Color>& colors,
+    const std::vector<Scalar>& stops,
+    const ContentContext& renderer);
+
 struct StopData {
   Color color;
   Scalar stop;
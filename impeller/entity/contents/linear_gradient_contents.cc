@@ -71,9 +71,7 @@ bool LinearGradientContents::RenderTexture(const ContentContext& renderer,
   using VS = LinearGradientFillPipeline::VertexShader;
   using FS = LinearGradientFillPipeline::FragmentShader;
 
-  auto gradient_data = CreateGradientBuffer(colors_, stops_);
-  auto gradient_texture =
-      CreateGradientTexture(gradient_data, renderer.GetContext());
+  auto gradient_texture = CreateGradientTexture(colors_, stops_, renderer);
   if (gradient_texture == nullptr) {
     return false;
   }
@@ -129,9 +129,7 @@ bool RadialGradientContents::RenderTexture(const ContentContext& renderer,
   using VS = RadialGradientFillPipeline::VertexShader;
   using FS = RadialGradientFillPipeline::FragmentShader;
 
-  auto gradient_data = CreateGradientBuffer(colors_, stops_);
-  auto gradient_texture =
-      CreateGradientTexture(gradient_data, renderer.GetContext());
+  auto gradient_texture = CreateGradientTexture(colors_, stops_, renderer);
   if (gradient_texture == nullptr) {
     return false;
   }
@@ -22,6 +22,121 @@
 
 namespace impeller {
 
+namespace {
+
+// Builds the pipeline descriptor shared by rendering and precompilation: the
+// runtime effect vertex stage paired with the stage's fragment function,
+// targeting the default attachment formats. The stage's function must
+// already be registered. Callers apply their ContentContextOptions on top.
+PipelineDescriptor MakeBasePipelineDescriptor(const Context& context,
+                                              const std::string& entrypoint) {
+  auto library = context.GetShaderLibrary();
+  const auto& caps = context.GetCapabilities();
+  const auto color_attachment_format = caps->GetDefaultColorFormat();
+  const auto stencil_attachment_format = caps->GetDefaultStencilFormat();
+
+  using VS = RuntimeEffectVertexShader;
+  PipelineDescriptor desc;
+  desc.SetLabel("Runtime Stage");
+  desc.AddStageEntrypoint(
+      library->GetFunction(VS::kEntrypointName, ShaderStage::kVertex));
+  desc.AddStageEntrypoint(
+      library->GetFunction(entrypoint, ShaderStage::kFragment));
+  auto vertex_descriptor = std::make_shared<VertexDescriptor>();
+  vertex_descriptor->SetStageInputs(VS::kAllShaderStageInputs,
+                                    VS::kInterleavedBufferLayout);
+  desc.SetVertexDescriptor(std::move(vertex_descriptor));
+  desc.SetColorAttachmentDescriptor(
+      0u, {.format = color_attachment_format, .blending_enabled = true});
+
+  StencilAttachmentDescriptor stencil0;
+  stencil0.stencil_compare = CompareFunction::kEqual;
+  desc.SetStencilAttachmentDescriptors(stencil0);
+  desc.SetStencilPixelFormat(stencil_attachment_format);
+  return desc;
+}
+
+}  // namespace
+
+std::shared_ptr<const ShaderFunction> RuntimeEffectContents::RegisterShader(
+    const std::shared_ptr<Context>& context,
+    const std::shared_ptr<RuntimeStage>& runtime_stage) {
+  auto library = context->GetShaderLibrary();
+
+  std::shared_ptr<const ShaderFunction> function = library->GetFunction(
+      runtime_stage->GetEntrypoint(), ShaderStage::kFragment);
+
+  if (function && runtime_stage->IsDirty()) {
+    context->GetPipelineLibrary()->RemovePipelinesWithEntryPoint(function);
+    library->UnregisterFunction(runtime_stage->GetEntrypoint(),
+                                ShaderStage::kFragment);
+
+    function = nullptr;
+  }
+
+  if (!function) {
+    std::promise<bool> promise;
+    auto future = promise.get_future();
+
+    library->RegisterFunction(
+        runtime_stage->GetEntrypoint(),
+        ToShaderStage(runtime_stage->GetShaderStage()),
+        runtime_stage->GetCodeMapping(),
+        fml::MakeCopyable([promise = std::move(promise)](bool result) mutable {
+          promise.set_value(result);
+        }));
+
+    if (!future.get()) {
+      VALIDATION_LOG << "Failed to build runtime effect (entry point: "
+                     << runtime_stage->GetEntrypoint() << ")";
+      return nullptr;
+    }
+
+    function = library->GetFunction(runtime_stage->GetEntrypoint(),
+                                    ShaderStage::kFragment);
+    if (!function) {
+      VALIDATION_LOG
+          << "Failed to fetch runtime effect function immediately after "
+             "registering it (entry point: "
+          << runtime_stage->GetEntrypoint() << ")";
+      return nullptr;
+    }
+
+    runtime_stage->SetClean();
+  }
+
+  return function;
+}
+
+bool RuntimeEffectContents::PrecompilePipeline(
+    const std::shared_ptr<Context>& context,
+    const std::shared_ptr<RuntimeStage>& runtime_stage) {
+  if (!context || !runtime_stage || !runtime_stage->IsValid()) {
+    return false;
+  }
+
+  if (!RegisterShader(context, runtime_stage)) {
+    return false;
+  }
+
+  PipelineDescriptor desc =
+      MakeBasePipelineDescriptor(*context, runtime_stage->GetEntrypoint());
+
+  // The variant a typical onscreen pass requests. The expensive step is
+  // compiling the shader module itself; sibling variants created at draw
+  // time share it, and backends with persistent pipeline caches reuse the
+  // compiled state across sessions.
+  ContentContextOptions options;
+  options.color_attachment_pixel_format =
+      context->GetCapabilities()->GetDefaultColorFormat();
+  if (context->GetCapabilities()->SupportsOffscreenMSAA()) {
+    options.sample_count = SampleCount::kCount4;
+  }
+  options.ApplyToPipelineDescriptor(desc);
+
+  return context->GetPipelineLibrary()->GetPipeline(desc).Get() != nullptr;
+}
+
 void RuntimeEffectContents::SetRuntimeStage(
     std::shared_ptr<RuntimeStage> runtime_stage) {
   runtime_stage_ = std::move(runtime_stage);
@@ -60,46 +175,34 @@ bool RuntimeEffectContents::Render(const ContentContext& renderer,
 
   // TODO(113719): Register the shader function earlier.
 
-  std::shared_ptr<const ShaderFunction> function = library->GetFunction(
-      runtime_stage_->GetEntrypoint(), ShaderStage::kFragment);
-
-  if (function && runtime_stage_->IsDirty()) {
-    context->GetPipelineLibrary()->RemovePipelinesWithEntryPoint(function);
-    library->UnregisterFunction(runtime_stage_->GetEntrypoint(),
-                                ShaderStage::kFragment);
-
-    function = nullptr;
-  }
+  const bool was_registered =
+      library->GetFunction(runtime_stage_->GetEntrypoint(),
+                           ShaderStage::kFragment) != nullptr &&
+      !runtime_stage_->IsDirty();
 
+  std::shared_ptr<const ShaderFunction> function =
+      RegisterShader(context, runtime_stage_);
   if (!function) {
-    std::promise<bool> promise;
-    auto future = promise.get_future();
-
-    library->RegisterFunction(
-        runtime_stage_->GetEntrypoint(),
-        ToShaderStage(runtime_stage_->GetShaderStage()),
-        runtime_stage_->GetCodeMapping(),
-        fml::MakeCopyable([promise = std::move(promise)](bool result) mutable {
-          promise.set_value(result);
-        }));
-
-    if (!future.get()) {
-      VALIDATION_LOG << "Failed to build runtime effect (entry point: "
-                     << runtime_stage_->GetEntrypoint() << ")";
-      return false;
-    }
+    return false;
+  }
 
-    function = library->GetFunction(runtime_stage_->GetEntrypoint(),
-                                    ShaderStage::kFragment);
-    if (!function) {
-      VALIDATION_LOG
-          << "Failed to fetch runtime effect function immediately after "
-             "registering it (entry point: "
-          << runtime_stage_->GetEntrypoint() << ")";
-      return false;
+  if (!was_registered) {
+    // First use of this shader this session: begin creating the variants
+    // recorded by previous sessions' usage manifests without waiting on
+    // them, so draws that need those variants later find them built.
+    auto recorded = renderer.GetRecordedRuntimeEffectVariants(
+        runtime_stage_->GetCodeHash());
+    if (!recorded.empty()) {
+      std::vector<PipelineDescriptor> warm_descriptors;
+      warm_descriptors.reserve(recorded.size());
+      for (const auto& recorded_options : recorded) {
+        PipelineDescriptor warm_desc = MakeBasePipelineDescriptor(
+            *context, runtime_stage_->GetEntrypoint());
+        recorded_options.ApplyToPipelineDescriptor(warm_desc);
+        warm_descriptors.push_back(std::move(warm_desc));
+      }
+      context->GetPipelineLibrary()->WarmUp(warm_descriptors);
     }
-
-    runtime_stage_->SetClean();
   }
 
   //--------------------------------------------------------------------------
@@ -113,28 +216,9 @@ bool RuntimeEffectContents::Render(const ContentContext& renderer,
   /// Get or create runtime stage pipeline.
   ///
 
-  const auto& caps = context->GetCapabilities();
-  const auto color_attachment_format = caps->GetDefaultColorFormat();
-  const auto stencil_attachment_format = caps->GetDefaultStencilFormat();
-
   using VS = RuntimeEffectVertexShader;
-  PipelineDescriptor desc;
-  desc.SetLabel("Runtime Stage");
-  desc.AddStageEntrypoint(
-      library->GetFunction(VS::kEntrypointName, ShaderStage::kVertex));
-  desc.AddStageEntrypoint(library->GetFunction(runtime_stage_->GetEntrypoint(),
-                                               ShaderStage::kFragment));
-  auto vertex_descriptor = std::make_shared<VertexDescriptor>();
-  vertex_descriptor->SetStageInputs(VS::kAllShaderStageInputs,
-                                    VS::kInterleavedBufferLayout);
-  desc.SetVertexDescriptor(std::move(vertex_descriptor));
-  desc.SetColorAttachmentDescriptor(
-      0u, {.format = color_attachment_format, .blending_enabled = true});
-
-  StencilAttachmentDescriptor stencil0;
-  stencil0.stencil_compare = CompareFunction::kEqual;
-  desc.SetStencilAttachmentDescriptors(stencil0);
-  desc.SetStencilPixelFormat(stencil_attachment_format);
+  PipelineDescriptor desc =
+      MakeBasePipelineDescriptor(*context, runtime_stage_->GetEntrypoint());
 
   auto options = OptionsFromPassAndEntity(pass, entity);
   if (geometry_result.prevent_overdraw) {
@@ -150,6 +234,10 @@ bool RuntimeEffectContents::Render(const ContentContext& renderer,
     return false;
   }
 
+  // Feed the usage manifest so the next session can pre-create this variant
+  // as soon as the shader is loaded.
+  renderer.RecordRuntimeEffectUsage(runtime_stage_->GetCodeHash(), options);
+
   Command cmd;
   DEBUG_COMMAND_INFO(cmd, "RuntimeEffectContents");
   cmd.pipeline = pipeline;
@@ -14,6 +14,9 @@
 
 namespace impeller {
 
+class Context;
+class ShaderFunction;
+
 class RuntimeEffectContents final : public ColorSourceContents {
  public:
   struct TextureInput {
@@ -21,6 +24,23 @@ class RuntimeEffectContents final : public ColorSourceContents {
     std::shared_ptr<Texture> texture;
   };
 
+  /// Registers (or re-registers, after a hot reload marked the stage dirty)
+  /// the stage's shader function with the context's shader library, blocking
+  /// until backend compilation finishes. Returns the compiled function, or
+  /// nullptr if compilation failed. Safe to call from any thread.
+  static std::shared_ptr<const ShaderFunction> RegisterShader(
+      const std::shared_ptr<Context>& context,
+      const std::shared_ptr<RuntimeStage>& runtime_stage);
+
+  /// Compiles the stage's shader function and builds the pipeline variant a
+  /// typical onscreen pass will request, blocking until both are in the
+  /// caches a later draw hits. Used by the FragmentProgram precompilation
+  /// API so that shader-driven transitions do not pay compilation costs at
+  /// draw time. Returns false if compilation failed.
+  static bool PrecompilePipeline(
+      const std::shared_ptr<Context>& context,
+      const std::shared_ptr<RuntimeStage>& runtime_stage);
+
   void SetRuntimeStage(std::shared_ptr<RuntimeStage> runtime_stage);
 
   void SetUniformData(std::shared_ptr<std::vector<uint8_t>> uniform_data);
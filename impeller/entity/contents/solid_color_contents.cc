@@ -103,6 +103,19 @@ std::optional<Color> SolidColorContents::AsBackgroundColor(
              : std::optional<Color>();
 }
 
+std::optional<std::pair<Rect, Color>> SolidColorContents::AsSolidColorRect()
+    const {
+  auto geometry = GetGeometry();
+  if (geometry == nullptr) {
+    return std::nullopt;
+  }
+  auto rect = geometry->AsAxisAlignedRect();
+  if (!rect.has_value()) {
+    return std::nullopt;
+  }
+  return std::make_pair(rect.value(), GetColor());
+}
+
 bool SolidColorContents::ApplyColorFilter(
     const ColorFilterProc& color_filter_proc) {
   color_ = color_filter_proc(color_);
@@ -51,6 +51,9 @@ class SolidColorContents final : public ColorSourceContents {
   std::optional<Color> AsBackgroundColor(const Entity& entity,
                                          ISize target_size) const override;
 
+  // |Contents|
+  std::optional<std::pair<Rect, Color>> AsSolidColorRect() const override;
+
   // |Contents|
   [[nodiscard]] bool ApplyColorFilter(
       const ColorFilterProc& color_filter_proc) override;
@@ -0,0 +1,104 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/contents/solid_rect_batch_contents.h"
+
+#include "impeller/entity/contents/content_context.h"
+#include "impeller/entity/entity.h"
+#include "impeller/renderer/render_pass.h"
+#include "impeller/renderer/vertex_buffer_builder.h"
+
+namespace impeller {
+
+SolidRectBatchContents::SolidRectBatchContents() = default;
+
+SolidRectBatchContents::~SolidRectBatchContents() = default;
+
+void SolidRectBatchContents::AddRect(Rect rect,
+                                     const Matrix& transform,
+                                     Color color) {
+  auto transformed_bounds = rect.TransformBounds(transform);
+  entries_.push_back({rect, transform, color, transformed_bounds});
+  coverage_ = Rect::Union(coverage_, transformed_bounds);
+}
+
+size_t SolidRectBatchContents::GetRectCount() const {
+  return entries_.size();
+}
+
+std::optional<Rect> SolidRectBatchContents::GetCoverage(
+    const Entity& entity) const {
+  if (!coverage_.has_value()) {
+    return std::nullopt;
+  }
+  return coverage_->TransformBounds(entity.GetTransformation());
+}
+
+bool SolidRectBatchContents::CanInheritOpacity(const Entity& entity) const {
+  // Modulating each rect's color only matches save layer opacity semantics
+  // when no two rects overlap. The batch is only attempted for small element
+  // counts by the opacity peephole, so the pairwise check stays cheap.
+  for (size_t i = 0; i < entries_.size(); i++) {
+    for (size_t j = i + 1; j < entries_.size(); j++) {
+      if (entries_[i].transformed_bounds.IntersectsWithRect(
+              entries_[j].transformed_bounds)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void SolidRectBatchContents::SetInheritedOpacity(Scalar opacity) {
+  inherited_opacity_ = opacity;
+}
+
+bool SolidRectBatchContents::Render(const ContentContext& renderer,
+                                    const Entity& entity,
+                                    RenderPass& pass) const {
+  if (entries_.empty()) {
+    return true;
+  }
+
+  using VS = GeometryColorPipeline::VertexShader;
+  using FS = GeometryColorPipeline::FragmentShader;
+
+  VertexBufferBuilder<VS::PerVertexData> vertex_builder;
+  vertex_builder.Reserve(entries_.size() * 6);
+  constexpr size_t indices[6] = {0, 1, 2, 1, 2, 3};
+  for (const auto& entry : entries_) {
+    auto transformed_points = entry.rect.GetTransformedPoints(entry.transform);
+    auto color = entry.color.Premultiply();
+
+    for (size_t j = 0; j < 6; j++) {
+      VS::PerVertexData data;
+      data.position = transformed_points[indices[j]];
+      data.color = color;
+      vertex_builder.AppendVertex(data);
+    }
+  }
+
+  Command cmd;
+  DEBUG_COMMAND_INFO(cmd, "SolidRectBatch");
+  cmd.stencil_reference = entity.GetClipDepth();
+
+  auto& host_buffer = pass.GetTransientsBuffer();
+  auto opts = OptionsFromPassAndEntity(pass, entity);
+  opts.primitive_type = PrimitiveType::kTriangle;
+  cmd.pipeline = renderer.GetGeometryColorPipeline(opts);
+  cmd.BindVertices(vertex_builder.CreateVertexBuffer(host_buffer));
+
+  VS::FrameInfo frame_info;
+  frame_info.mvp = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                   entity.GetTransformation();
+  VS::BindFrameInfo(cmd, host_buffer.EmplaceUniform(frame_info));
+
+  FS::FragInfo frag_info;
+  frag_info.alpha = inherited_opacity_;
+  FS::BindFragInfo(cmd, host_buffer.EmplaceUniform(frag_info));
+
+  return pass.AddCommand(std::move(cmd));
+}
+
+}  // namespace impeller
@@ -0,0 +1,71 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <vector>
+
+#include "impeller/entity/contents/contents.h"
+#include "impeller/geometry/color.h"
+#include "impeller/geometry/matrix.h"
+#include "impeller/geometry/rect.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief A run of solid color axis aligned rect draws that share a blend
+///        mode and clip depth, rendered as a single draw call.
+///
+///        `EntityPass::AddEntity` folds compatible consecutive solid color
+///        rect entities into one of these so that list style scenes with many
+///        small rects do not pay per-rect draw call overhead. Each rect's
+///        transform is baked into the vertex positions on the CPU and a per
+///        vertex color carries the rect's fill color.
+///
+class SolidRectBatchContents final : public Contents {
+ public:
+  SolidRectBatchContents();
+
+  ~SolidRectBatchContents() override;
+
+  /// @brief Append a rect to the batch. The transform must not have
+  ///        perspective since it is baked into the vertex positions.
+  void AddRect(Rect rect, const Matrix& transform, Color color);
+
+  size_t GetRectCount() const;
+
+  // |Contents|
+  std::optional<Rect> GetCoverage(const Entity& entity) const override;
+
+  // |Contents|
+  bool Render(const ContentContext& renderer,
+              const Entity& entity,
+              RenderPass& pass) const override;
+
+  // |Contents|
+  bool CanInheritOpacity(const Entity& entity) const override;
+
+  // |Contents|
+  void SetInheritedOpacity(Scalar opacity) override;
+
+ private:
+  struct RectEntry {
+    Rect rect;
+    Matrix transform;
+    Color color;
+    /// The rect's coverage with `transform` applied. Cached for the pairwise
+    /// overlap check in `CanInheritOpacity`.
+    Rect transformed_bounds;
+  };
+
+  std::vector<RectEntry> entries_;
+  std::optional<Rect> coverage_;
+  Scalar inherited_opacity_ = 1.0;
+
+  SolidRectBatchContents(const SolidRectBatchContents&) = delete;
+
+  SolidRectBatchContents& operator=(const SolidRectBatchContents&) = delete;
+};
+
+}  // namespace impeller
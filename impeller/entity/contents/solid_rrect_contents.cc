@@ -0,0 +1,139 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/contents/solid_rrect_contents.h"
+
+#include <algorithm>
+
+#include "impeller/entity/contents/content_context.h"
+#include "impeller/entity/entity.h"
+#include "impeller/renderer/render_pass.h"
+#include "impeller/renderer/vertex_buffer_builder.h"
+
+namespace impeller {
+
+SolidRRectContents::SolidRRectContents() = default;
+
+SolidRRectContents::~SolidRRectContents() = default;
+
+void SolidRRectContents::SetRRect(std::optional<Rect> rect,
+                                  Scalar corner_radius) {
+  rect_ = rect;
+  corner_radius_ = corner_radius;
+}
+
+void SolidRRectContents::SetStrokeWidth(std::optional<Scalar> stroke_width) {
+  stroke_width_ = stroke_width;
+}
+
+void SolidRRectContents::SetColor(Color color) {
+  color_ = color.Premultiply();
+}
+
+Color SolidRRectContents::GetColor() const {
+  return color_;
+}
+
+Scalar SolidRRectContents::Padding(const Entity& entity) const {
+  Scalar padding =
+      stroke_width_.has_value() ? std::max(*stroke_width_, 0.0f) * 0.5f : 0.0f;
+  Scalar scale = entity.GetTransformation().GetMaxBasisLength();
+  if (scale > 0.0f) {
+    padding += 1.0f / scale;
+  }
+  return padding;
+}
+
+std::optional<Rect> SolidRRectContents::GetCoverage(
+    const Entity& entity) const {
+  if (!rect_.has_value()) {
+    return std::nullopt;
+  }
+
+  Scalar padding = Padding(entity);
+
+  auto ltrb = rect_->GetLTRB();
+  Rect bounds = Rect::MakeLTRB(ltrb[0] - padding, ltrb[1] - padding,
+                               ltrb[2] + padding, ltrb[3] + padding);
+  return bounds.TransformBounds(entity.GetTransformation());
+}
+
+bool SolidRRectContents::Render(const ContentContext& renderer,
+                                const Entity& entity,
+                                RenderPass& pass) const {
+  if (!rect_.has_value()) {
+    return true;
+  }
+
+  Scalar scale = entity.GetTransformation().GetMaxBasisLength();
+  if (scale <= 0.0f) {
+    return true;
+  }
+
+  using VS = RRectPipeline::VertexShader;
+  using FS = RRectPipeline::FragmentShader;
+
+  VertexBufferBuilder<VS::PerVertexData> vtx_builder;
+
+  auto positive_rect = rect_->GetPositive();
+  Scalar padding = Padding(entity);
+  {
+    auto left = -padding;
+    auto top = -padding;
+    auto right = positive_rect.size.width + padding;
+    auto bottom = positive_rect.size.height + padding;
+
+    vtx_builder.AddVertices({
+        {Point(left, top)},
+        {Point(right, top)},
+        {Point(left, bottom)},
+        {Point(right, bottom)},
+    });
+  }
+
+  Command cmd;
+  DEBUG_COMMAND_INFO(cmd, "RRect");
+  ContentContextOptions opts = OptionsFromPassAndEntity(pass, entity);
+  opts.primitive_type = PrimitiveType::kTriangleStrip;
+  Color color = color_;
+  if (entity.GetBlendMode() == BlendMode::kClear) {
+    opts.is_for_rrect_blur_clear = true;
+    color = Color::White();
+  }
+  cmd.pipeline = renderer.GetRRectPipeline(opts);
+  cmd.stencil_reference = entity.GetClipDepth();
+
+  cmd.BindVertices(vtx_builder.CreateVertexBuffer(pass.GetTransientsBuffer()));
+
+  VS::FrameInfo frame_info;
+  frame_info.mvp = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                   entity.GetTransformation() *
+                   Matrix::MakeTranslation({positive_rect.origin});
+  VS::BindFrameInfo(cmd, pass.GetTransientsBuffer().EmplaceUniform(frame_info));
+
+  FS::FragInfo frag_info;
+  frag_info.color = color;
+  frag_info.rect_size = Point(positive_rect.size);
+  frag_info.corner_radius =
+      std::min(corner_radius_, std::min(positive_rect.size.width / 2.0f,
+                                        positive_rect.size.height / 2.0f));
+  frag_info.stroke_half_width =
+      stroke_width_.has_value() ? std::max(*stroke_width_, 0.0f) * 0.5f : -1.0f;
+  frag_info.pixel_scale = scale;
+  FS::BindFragInfo(cmd, pass.GetTransientsBuffer().EmplaceUniform(frag_info));
+
+  if (!pass.AddCommand(std::move(cmd))) {
+    return false;
+  }
+
+  return true;
+}
+
+bool SolidRRectContents::ApplyColorFilter(
+    const ColorFilterProc& color_filter_proc) {
+  color_ = color_filter_proc(color_);
+  return true;
+}
+
+}  // namespace impeller
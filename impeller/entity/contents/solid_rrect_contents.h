@@ -0,0 +1,62 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <optional>
+
+#include "impeller/entity/contents/contents.h"
+#include "impeller/geometry/color.h"
+
+namespace impeller {
+
+/// @brief  Draws a solid color rounded rectangle analytically with a signed
+/// distance field instead of converting it to a path and tessellating. Only
+/// supports RRects with fully symmetrical radii. Also produces correct
+/// results for circles (corner_radius=width/2=height/2).
+class SolidRRectContents final : public Contents {
+ public:
+  SolidRRectContents();
+
+  ~SolidRRectContents() override;
+
+  void SetRRect(std::optional<Rect> rect, Scalar corner_radius = 0);
+
+  /// @brief  Render a stroke centered on the rrect boundary instead of a
+  /// fill. Passing `std::nullopt` restores fill rendering.
+  void SetStrokeWidth(std::optional<Scalar> stroke_width);
+
+  void SetColor(Color color);
+
+  Color GetColor() const;
+
+  // |Contents|
+  std::optional<Rect> GetCoverage(const Entity& entity) const override;
+
+  // |Contents|
+  bool Render(const ContentContext& renderer,
+              const Entity& entity,
+              RenderPass& pass) const override;
+
+  // |Contents|
+  [[nodiscard]] bool ApplyColorFilter(
+      const ColorFilterProc& color_filter_proc) override;
+
+ private:
+  /// @brief  The local space padding around the rrect needed to cover the
+  /// stroke band and one physical pixel of anti-aliasing.
+  Scalar Padding(const Entity& entity) const;
+
+  std::optional<Rect> rect_;
+  Scalar corner_radius_;
+  std::optional<Scalar> stroke_width_;
+
+  Color color_;
+
+  SolidRRectContents(const SolidRRectContents&) = delete;
+
+  SolidRRectContents& operator=(const SolidRRectContents&) = delete;
+};
+
+}  // namespace impeller
@@ -135,9 +135,7 @@ bool SweepGradientContents::RenderTexture(const ContentContext& renderer,
   using VS = SweepGradientFillPipeline::VertexShader;
   using FS = SweepGradientFillPipeline::FragmentShader;
 
-  auto gradient_data = CreateGradientBuffer(colors_, stops_);
-  auto gradient_texture =
-      CreateGradientTexture(gradient_data, renderer.GetContext());
+  auto gradient_texture = CreateGradientTexture(colors_, stops_, renderer);
   if (gradient_texture == nullptr) {
     return false;
   }
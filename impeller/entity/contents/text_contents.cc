@@ -4,6 +4,8 @@
 
 #include "impeller/entity/contents/text_contents.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <optional>
 #include <type_traits>
@@ -20,12 +22,28 @@
 
 namespace impeller {
 
+// Distance field glyphs are rasterized at a power-of-two scale so that an
+// animated scale transition only re-rasterizes when it crosses a bucket
+// boundary instead of every frame.
+static Scalar RoundSdfFontScale(Scalar scale) {
+  if (scale <= 0) {
+    return 1;
+  }
+  return std::exp2(std::ceil(std::log2(scale)));
+}
+
 TextContents::TextContents() = default;
 
 TextContents::~TextContents() = default;
 
 void TextContents::SetTextFrame(const std::shared_ptr<TextFrame>& frame) {
-  frame_ = frame;
+  frames_ = {FrameEntry{frame, Vector2{}}};
+}
+
+void TextContents::AppendTextFrame(const std::shared_ptr<TextFrame>& frame,
+                                   Vector2 local_offset) {
+  FML_DCHECK(!frames_.empty());
+  frames_.push_back(FrameEntry{frame, local_offset});
 }
 
 std::shared_ptr<GlyphAtlas> TextContents::ResolveAtlas(
@@ -48,8 +66,28 @@ Color TextContents::GetColor() const {
   return color_.WithAlpha(color_.alpha * inherited_opacity_);
 }
 
+void TextContents::SetUseSignedDistanceField(bool value) {
+  use_sdf_ = value;
+}
+
+void TextContents::SetMaskBlurSigma(Scalar sigma) {
+  mask_blur_sigma_ = sigma;
+}
+
+GlyphAtlas::Type TextContents::GetAtlasType() const {
+  GlyphAtlas::Type type = frames_.front().frame->GetAtlasType();
+  if (use_sdf_ && type == GlyphAtlas::Type::kAlphaBitmap) {
+    return GlyphAtlas::Type::kSignedDistanceField;
+  }
+  return type;
+}
+
 bool TextContents::CanInheritOpacity(const Entity& entity) const {
-  return !frame_->MaybeHasOverlapping();
+  // Frames merged from separate draws may overlap each other, as do the
+  // inflated quads of blurred glyphs, so only a single unblurred frame
+  // without overlapping glyphs can take the fast path.
+  return frames_.size() == 1u && !mask_blur_sigma_.has_value() &&
+         !frames_.front().frame->MaybeHasOverlapping();
 }
 
 void TextContents::SetInheritedOpacity(Scalar opacity) {
@@ -61,13 +99,32 @@ void TextContents::SetOffset(Vector2 offset) {
 }
 
 std::optional<Rect> TextContents::GetCoverage(const Entity& entity) const {
-  return frame_->GetBounds().TransformBounds(entity.GetTransformation());
+  std::optional<Rect> bounds;
+  for (const FrameEntry& entry : frames_) {
+    bounds = Rect::Union(entry.frame->GetBounds().Shift(entry.local_offset),
+                         bounds);
+  }
+  if (!bounds.has_value()) {
+    return std::nullopt;
+  }
+  if (mask_blur_sigma_.has_value()) {
+    // The blurred coverage extends past the glyph bounds by the kernel's
+    // reach. This matches the quad inflation in the blur vertex shader.
+    bounds = bounds->Expand(2.0f * mask_blur_sigma_.value() + 1.0f);
+  }
+  return bounds->TransformBounds(entity.GetTransformation());
 }
 
 void TextContents::PopulateGlyphAtlas(
     const std::shared_ptr<LazyGlyphAtlas>& lazy_glyph_atlas,
     Scalar scale) {
-  lazy_glyph_atlas->AddTextFrame(*frame_, scale);
+  GlyphAtlas::Type type = GetAtlasType();
+  if (type == GlyphAtlas::Type::kSignedDistanceField) {
+    scale = RoundSdfFontScale(scale);
+  }
+  for (const FrameEntry& entry : frames_) {
+    lazy_glyph_atlas->AddTextFrame(*entry.frame, scale, type);
+  }
   scale_ = scale;
 }
 
@@ -79,7 +136,7 @@ bool TextContents::Render(const ContentContext& renderer,
     return true;
   }
 
-  auto type = frame_->GetAtlasType();
+  auto type = GetAtlasType();
   auto atlas =
       ResolveAtlas(*renderer.GetContext(), type, renderer.GetLazyGlyphAtlas());
 
@@ -93,16 +150,32 @@ bool TextContents::Render(const ContentContext& renderer,
   DEBUG_COMMAND_INFO(cmd, "TextFrame");
   auto opts = OptionsFromPassAndEntity(pass, entity);
   opts.primitive_type = PrimitiveType::kTriangle;
-  if (type == GlyphAtlas::Type::kAlphaBitmap) {
-    cmd.pipeline = renderer.GetGlyphAtlasPipeline(opts);
-  } else {
-    cmd.pipeline = renderer.GetGlyphAtlasColorPipeline(opts);
+  // The fixed-kernel mask blur is only produced by the canvas for alpha
+  // bitmap glyphs.
+  const bool use_mask_blur = mask_blur_sigma_.has_value();
+  FML_DCHECK(!use_mask_blur || type == GlyphAtlas::Type::kAlphaBitmap);
+  switch (type) {
+    case GlyphAtlas::Type::kAlphaBitmap:
+      cmd.pipeline = use_mask_blur ? renderer.GetGlyphAtlasBlurPipeline(opts)
+                                   : renderer.GetGlyphAtlasPipeline(opts);
+      break;
+    case GlyphAtlas::Type::kColorBitmap:
+      cmd.pipeline = renderer.GetGlyphAtlasColorPipeline(opts);
+      break;
+    case GlyphAtlas::Type::kSignedDistanceField:
+      cmd.pipeline = renderer.GetGlyphAtlasSdfPipeline(opts);
+      break;
   }
   cmd.stencil_reference = entity.GetClipDepth();
 
   using VS = GlyphAtlasPipeline::VertexShader;
   using FS = GlyphAtlasPipeline::FragmentShader;
 
+  // The blur variant declares the same vertex attributes, so the vertex data
+  // built below serves both pipelines.
+  static_assert(sizeof(GlyphAtlasBlurPipeline::VertexShader::PerVertexData) ==
+                sizeof(VS::PerVertexData));
+
   // Common vertex uniforms for all glyphs.
   VS::FrameInfo frame_info;
   frame_info.mvp = Matrix::MakeOrthographic(pass.GetRenderTargetSize());
@@ -115,10 +188,38 @@ bool TextContents::Render(const ContentContext& renderer,
   frame_info.entity_transform = entity.GetTransformation();
   frame_info.text_color = ToVector(color.Premultiply());
 
-  VS::BindFrameInfo(cmd, pass.GetTransientsBuffer().EmplaceUniform(frame_info));
+  if (use_mask_blur) {
+    // The blur variant consumes the same frame information plus the blur
+    // standard deviation in local units.
+    using BVS = GlyphAtlasBlurPipeline::VertexShader;
+    BVS::FrameInfo blur_frame_info;
+    blur_frame_info.mvp = frame_info.mvp;
+    blur_frame_info.atlas_size = frame_info.atlas_size;
+    blur_frame_info.offset = frame_info.offset;
+    blur_frame_info.is_translation_scale = frame_info.is_translation_scale;
+    blur_frame_info.entity_transform = frame_info.entity_transform;
+    blur_frame_info.text_color = frame_info.text_color;
+    blur_frame_info.blur_sigma = mask_blur_sigma_.value();
+    BVS::BindFrameInfo(
+        cmd, pass.GetTransientsBuffer().EmplaceUniform(blur_frame_info));
+  } else {
+    VS::BindFrameInfo(cmd,
+                      pass.GetTransientsBuffer().EmplaceUniform(frame_info));
+  }
 
   SamplerDescriptor sampler_desc;
-  if (frame_info.is_translation_scale) {
+  if (use_mask_blur) {
+    // The kernel taps land at fractional texel offsets, which need linear
+    // filtering to interpolate.
+    sampler_desc.min_filter = MinMagFilter::kLinear;
+    sampler_desc.mag_filter = MinMagFilter::kLinear;
+  } else if (type == GlyphAtlas::Type::kSignedDistanceField) {
+    // The distance field must be interpolated between texels for the
+    // smoothstep in the fragment shader to reconstruct a clean boundary at
+    // scales other than the one the field was generated at.
+    sampler_desc.min_filter = MinMagFilter::kLinear;
+    sampler_desc.mag_filter = MinMagFilter::kLinear;
+  } else if (frame_info.is_translation_scale) {
     sampler_desc.min_filter = MinMagFilter::kNearest;
     sampler_desc.mag_filter = MinMagFilter::kNearest;
   } else {
@@ -132,12 +233,42 @@ bool TextContents::Render(const ContentContext& renderer,
   }
   sampler_desc.mip_filter = MipFilter::kNearest;
 
-  FS::BindGlyphAtlasSampler(
-      cmd,                  // command
-      atlas->GetTexture(),  // texture
-      renderer.GetContext()->GetSamplerLibrary()->GetSampler(
-          sampler_desc)  // sampler
-  );
+  if (use_mask_blur) {
+    using BFS = GlyphAtlasBlurPipeline::FragmentShader;
+    BFS::BindGlyphAtlasSampler(
+        cmd,                  // command
+        atlas->GetTexture(),  // texture
+        renderer.GetContext()->GetSamplerLibrary()->GetSampler(
+            sampler_desc)  // sampler
+    );
+  } else if (type == GlyphAtlas::Type::kSignedDistanceField) {
+    using SDFS = GlyphAtlasSdfPipeline::FragmentShader;
+    SDFS::FragInfo sdf_frag_info;
+    // One physical pixel of anti-aliasing: a screen pixel covers
+    // scale_ / screen_scale atlas pixels, and the field encodes one atlas
+    // pixel of distance as 1 / (2 * kGlyphSdfSpread) of the sampled value.
+    Scalar screen_scale =
+        std::max(entity.GetTransformation().GetMaxBasisLengthXY(),
+                 kEhCloseEnough);
+    sdf_frag_info.smoothing = std::clamp(
+        0.5f * (scale_ / screen_scale) / (2.0f * kGlyphSdfSpread), 1e-3f,
+        0.49f);
+    SDFS::BindFragInfo(
+        cmd, pass.GetTransientsBuffer().EmplaceUniform(sdf_frag_info));
+    SDFS::BindGlyphAtlasSampler(
+        cmd,                  // command
+        atlas->GetTexture(),  // texture
+        renderer.GetContext()->GetSamplerLibrary()->GetSampler(
+            sampler_desc)  // sampler
+    );
+  } else {
+    FS::BindGlyphAtlasSampler(
+        cmd,                  // command
+        atlas->GetTexture(),  // texture
+        renderer.GetContext()->GetSamplerLibrary()->GetSampler(
+            sampler_desc)  // sampler
+    );
+  }
 
   // Common vertex information for all glyphs.
   // All glyphs are given the same vertex information in the form of a
@@ -152,8 +283,10 @@ bool TextContents::Render(const ContentContext& renderer,
 
   auto& host_buffer = pass.GetTransientsBuffer();
   size_t vertex_count = 0;
-  for (const auto& run : frame_->GetRuns()) {
-    vertex_count += run.GetGlyphPositions().size();
+  for (const FrameEntry& entry : frames_) {
+    for (const auto& run : entry.frame->GetRuns()) {
+      vertex_count += run.GetGlyphPositions().size();
+    }
   }
   vertex_count *= 6;
 
@@ -163,38 +296,43 @@ bool TextContents::Render(const ContentContext& renderer,
         VS::PerVertexData vtx;
         VS::PerVertexData* vtx_contents =
             reinterpret_cast<VS::PerVertexData*>(contents);
-        for (const TextRun& run : frame_->GetRuns()) {
-          const Font& font = run.GetFont();
-          Scalar rounded_scale = TextFrame::RoundScaledFontSize(
-              scale_, font.GetMetrics().point_size);
-          const FontGlyphAtlas* font_atlas =
-              atlas->GetFontGlyphAtlas(font, rounded_scale);
-          if (!font_atlas) {
-            VALIDATION_LOG << "Could not find font in the atlas.";
-            continue;
-          }
-
-          for (const TextRun::GlyphPosition& glyph_position :
-               run.GetGlyphPositions()) {
-            std::optional<Rect> maybe_atlas_glyph_bounds =
-                font_atlas->FindGlyphBounds(glyph_position.glyph);
-            if (!maybe_atlas_glyph_bounds.has_value()) {
-              VALIDATION_LOG << "Could not find glyph position in the atlas.";
+        for (const FrameEntry& entry : frames_) {
+          for (const TextRun& run : entry.frame->GetRuns()) {
+            const Font& font = run.GetFont();
+            Scalar rounded_scale = TextFrame::RoundScaledFontSize(
+                scale_, font.GetMetrics().point_size);
+            const FontGlyphAtlas* font_atlas =
+                atlas->GetFontGlyphAtlas(font, rounded_scale);
+            if (!font_atlas) {
+              VALIDATION_LOG << "Could not find font in the atlas.";
               continue;
             }
-            const Rect& atlas_glyph_bounds = maybe_atlas_glyph_bounds.value();
-            vtx.atlas_glyph_bounds = Vector4(
-                atlas_glyph_bounds.origin.x, atlas_glyph_bounds.origin.y,
-                atlas_glyph_bounds.size.width, atlas_glyph_bounds.size.height);
-            vtx.glyph_bounds = Vector4(glyph_position.glyph.bounds.origin.x,
-                                       glyph_position.glyph.bounds.origin.y,
-                                       glyph_position.glyph.bounds.size.width,
-                                       glyph_position.glyph.bounds.size.height);
-            vtx.glyph_position = glyph_position.position;
-
-            for (const Point& point : unit_points) {
-              vtx.unit_position = point;
-              std::memcpy(vtx_contents++, &vtx, sizeof(VS::PerVertexData));
+
+            for (const TextRun::GlyphPosition& glyph_position :
+                 run.GetGlyphPositions()) {
+              std::optional<Rect> maybe_atlas_glyph_bounds =
+                  font_atlas->FindGlyphBounds(glyph_position.glyph);
+              if (!maybe_atlas_glyph_bounds.has_value()) {
+                VALIDATION_LOG << "Could not find glyph position in the atlas.";
+                continue;
+              }
+              const Rect& atlas_glyph_bounds = maybe_atlas_glyph_bounds.value();
+              vtx.atlas_glyph_bounds =
+                  Vector4(atlas_glyph_bounds.origin.x,
+                          atlas_glyph_bounds.origin.y,
+                          atlas_glyph_bounds.size.width,
+                          atlas_glyph_bounds.size.height);
+              vtx.glyph_bounds =
+                  Vector4(glyph_position.glyph.bounds.origin.x,
+                          glyph_position.glyph.bounds.origin.y,
+                          glyph_position.glyph.bounds.size.width,
+                          glyph_position.glyph.bounds.size.height);
+              vtx.glyph_position = glyph_position.position + entry.local_offset;
+
+              for (const Point& point : unit_points) {
+                vtx.unit_position = point;
+                std::memcpy(vtx_contents++, &vtx, sizeof(VS::PerVertexData));
+              }
             }
           }
         }
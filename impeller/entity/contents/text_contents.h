@@ -6,6 +6,7 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 #include <variant>
 #include <vector>
 
@@ -28,10 +29,36 @@ class TextContents final : public Contents {
 
   void SetTextFrame(const std::shared_ptr<TextFrame>& frame);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Append an additional text frame to be rendered as part of
+  ///             this contents, offset in local space. The canvas uses this
+  ///             to collapse adjacent compatible text draws into a single
+  ///             draw call.
+  ///
+  void AppendTextFrame(const std::shared_ptr<TextFrame>& frame,
+                       Vector2 local_offset);
+
   void SetColor(Color color);
 
   Color GetColor() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Render non-color glyphs from a signed distance field atlas
+  ///             instead of scale-exact bitmaps. A single distance field entry
+  ///             serves a wide range of scales, which keeps the glyph atlas
+  ///             stable while text animates its scale. Color glyphs are
+  ///             unaffected.
+  ///
+  void SetUseSignedDistanceField(bool value);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Blur the glyph coverage in the glyph shader with a small
+  ///             fixed kernel instead of routing the draw through a full
+  ///             gaussian filter. The canvas uses this for text shadows,
+  ///             which are solid-color alpha bitmap draws with small sigmas.
+  ///
+  void SetMaskBlurSigma(Scalar sigma);
+
   // |Contents|
   bool CanInheritOpacity(const Entity& entity) const override;
 
@@ -56,11 +83,20 @@ class TextContents final : public Contents {
               RenderPass& pass) const override;
 
  private:
-  std::shared_ptr<TextFrame> frame_;
+  struct FrameEntry {
+    std::shared_ptr<TextFrame> frame;
+    Vector2 local_offset;
+  };
+
+  std::vector<FrameEntry> frames_;
   Scalar scale_ = 1.0;
   Color color_;
   Scalar inherited_opacity_ = 1.0;
   Vector2 offset_;
+  bool use_sdf_ = false;
+  std::optional<Scalar> mask_blur_sigma_;
+
+  GlyphAtlas::Type GetAtlasType() const;
 
   std::shared_ptr<GlyphAtlas> ResolveAtlas(
       Context& context,
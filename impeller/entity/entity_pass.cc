@@ -4,6 +4,7 @@
 
 #include "impeller/entity/entity_pass.h"
 
+#include <cmath>
 #include <memory>
 #include <utility>
 #include <variant>
@@ -19,6 +20,7 @@
 #include "impeller/entity/contents/filters/color_filter_contents.h"
 #include "impeller/entity/contents/filters/inputs/filter_input.h"
 #include "impeller/entity/contents/framebuffer_blend_contents.h"
+#include "impeller/entity/contents/solid_rect_batch_contents.h"
 #include "impeller/entity/contents/texture_contents.h"
 #include "impeller/entity/entity.h"
 #include "impeller/entity/inline_pass_context.h"
@@ -44,6 +46,25 @@ std::tuple<std::optional<Color>, BlendMode> ElementAsBackgroundColor(
   }
   return {};
 }
+
+/// Returns the rect and color of the entity if it can participate in a solid
+/// rect batch: a solid color axis aligned rect fill with a pipeline blend mode
+/// and no perspective in its transform (the transform gets baked into vertex
+/// positions on the CPU, which is only exact for affine transforms).
+std::optional<std::pair<Rect, Color>> AsRectBatchCandidate(
+    const Entity& entity) {
+  if (entity.GetBlendMode() > Entity::kLastPipelineBlendMode) {
+    return std::nullopt;
+  }
+  if (entity.GetTransformation().HasPerspective()) {
+    return std::nullopt;
+  }
+  const auto& contents = entity.GetContents();
+  if (!contents) {
+    return std::nullopt;
+  }
+  return contents->AsSolidColorRect();
+}
 }  // namespace
 
 const std::string EntityPass::kCaptureDocumentName = "EntityPass";
@@ -76,10 +97,60 @@ void EntityPass::AddEntity(Entity entity) {
   if (entity.GetBlendMode() > Entity::kLastPipelineBlendMode) {
     advanced_blend_reads_from_pass_texture_ += 1;
   }
+
+  if (TryFoldIntoRectBatch(entity)) {
+    return;
+  }
+  open_rect_batch_ = nullptr;
   elements_.emplace_back(std::move(entity));
 }
 
+bool EntityPass::TryFoldIntoRectBatch(const Entity& entity) {
+  if (elements_.empty()) {
+    return false;
+  }
+  auto candidate = AsRectBatchCandidate(entity);
+  if (!candidate.has_value()) {
+    return false;
+  }
+  Entity* previous = std::get_if<Entity>(&elements_.back());
+  if (previous == nullptr ||
+      previous->GetBlendMode() != entity.GetBlendMode() ||
+      previous->GetClipDepth() != entity.GetClipDepth()) {
+    return false;
+  }
+
+  // Fold into the already open batch if the previous element is it.
+  if (open_rect_batch_ && previous->GetContents() == open_rect_batch_) {
+    open_rect_batch_->AddRect(candidate->first, entity.GetTransformation(),
+                              candidate->second);
+    return true;
+  }
+
+  // Never convert the first element of the pass into a batch. If it covers
+  // the pass it participates in the clear color optimization in `OnRender`,
+  // which would silently drop every other rect folded into it.
+  if (elements_.size() < 2u) {
+    return false;
+  }
+  auto previous_candidate = AsRectBatchCandidate(*previous);
+  if (!previous_candidate.has_value()) {
+    return false;
+  }
+
+  auto batch = std::make_shared<SolidRectBatchContents>();
+  batch->AddRect(previous_candidate->first, previous->GetTransformation(),
+                 previous_candidate->second);
+  batch->AddRect(candidate->first, entity.GetTransformation(),
+                 candidate->second);
+  previous->SetContents(batch);
+  previous->SetTransformation(Matrix());
+  open_rect_batch_ = std::move(batch);
+  return true;
+}
+
 void EntityPass::SetElements(std::vector<Element> elements) {
+  open_rect_batch_ = nullptr;
   elements_ = std::move(elements);
 }
 
@@ -217,6 +288,7 @@ EntityPass* EntityPass::AddSubpass(std::unique_ptr<EntityPass> pass) {
   }
 
   auto subpass_pointer = pass.get();
+  open_rect_batch_ = nullptr;
   elements_.emplace_back(std::move(pass));
   return subpass_pointer;
 }
@@ -227,6 +299,7 @@ void EntityPass::AddSubpassInline(std::unique_ptr<EntityPass> pass) {
   }
   FML_DCHECK(pass->superpass_ == nullptr);
 
+  open_rect_batch_ = nullptr;
   elements_.insert(elements_.end(),
                    std::make_move_iterator(pass->elements_.begin()),
                    std::make_move_iterator(pass->elements_.end()));
@@ -298,7 +371,8 @@ uint32_t EntityPass::GetTotalPassReads(ContentContext& renderer) const {
 }
 
 bool EntityPass::Render(ContentContext& renderer,
-                        const RenderTarget& render_target) const {
+                        const RenderTarget& render_target,
+                        const std::optional<IRect>& damage) const {
   auto capture =
       renderer.GetContext()->capture.GetDocument(kCaptureDocumentName);
 
@@ -332,11 +406,14 @@ bool EntityPass::Render(ContentContext& renderer,
   ClipCoverageStack clip_coverage_stack = {ClipCoverageLayer{
       .coverage = Rect::MakeSize(root_render_target.GetRenderTargetSize()),
       .clip_depth = 0}};
+  AnalyticClipStack analytic_clip_stack;
 
   bool reads_from_onscreen_backdrop = GetTotalPassReads(renderer) > 0;
   // In this branch path, we need to render everything to an offscreen texture
   // and then blit the results onto the onscreen texture. If using this branch,
   // there's no need to set up a stencil attachment on the root render target.
+  // Damage is ignored here since the final blit overwrites the whole target
+  // anyway.
   if (reads_from_onscreen_backdrop) {
     auto offscreen_target =
         CreateRenderTarget(renderer, root_render_target.GetRenderTargetSize(),
@@ -350,7 +427,8 @@ bool EntityPass::Render(ContentContext& renderer,
                   Point(),                     // global_pass_position
                   Point(),                     // local_pass_position
                   0,                           // pass_depth
-                  clip_coverage_stack          // clip_coverage_stack
+                  clip_coverage_stack,         // clip_coverage_stack
+                  analytic_clip_stack          // analytic_clip_stack
                   )) {
       // Validation error messages are triggered for all `OnRender()` failure
       // cases.
@@ -415,6 +493,29 @@ bool EntityPass::Render(ContentContext& renderer,
   // If we make it this far, that means the context is capable of rendering
   // everything directly to the onscreen texture.
 
+  // If a damage region was supplied, restrict rendering to it. The damage is
+  // applied as a root analytic clip layer (scissoring every command) and also
+  // shrinks the root clip coverage so that entities entirely outside of the
+  // damage are culled. The attachment's prior contents are loaded rather than
+  // cleared so that the undamaged region survives.
+  bool has_partial_damage = false;
+  if (damage.has_value()) {
+    auto target_rect =
+        IRect::MakeSize(root_render_target.GetRenderTargetSize());
+    auto clipped_damage = damage->Intersection(target_rect);
+    if (!clipped_damage.has_value() || clipped_damage->IsEmpty()) {
+      // Nothing within the target changed; leave it untouched.
+      return true;
+    }
+    if (!(clipped_damage.value() == target_rect)) {
+      has_partial_damage = true;
+      clip_coverage_stack.back().coverage = Rect(clipped_damage.value());
+      analytic_clip_stack.push_back(
+          AnalyticClipLayer{.scissor = clipped_damage.value(),  //
+                            .clip_depth = 0});
+    }
+  }
+
   // The safety check for fetching this color attachment is at the beginning of
   // this method.
   auto color0 = root_render_target.GetColorAttachments().find(0u)->second;
@@ -450,6 +551,11 @@ bool EntityPass::Render(ContentContext& renderer,
 
   // Set up the clear color of the root pass.
   color0.clear_color = GetClearColor(render_target.GetRenderTargetSize());
+  if (has_partial_damage) {
+    // Partial repaint: preserve the attachment contents outside of the damage
+    // region instead of clearing.
+    color0.load_action = LoadAction::kLoad;
+  }
   root_render_target.SetColorAttachment(color0, 0);
 
   EntityPassTarget pass_target(
@@ -465,7 +571,14 @@ bool EntityPass::Render(ContentContext& renderer,
       Point(),                                   // global_pass_position
       Point(),                                   // local_pass_position
       0,                                         // pass_depth
-      clip_coverage_stack);                      // clip_coverage_stack
+      clip_coverage_stack,                       // clip_coverage_stack
+      analytic_clip_stack,                       // analytic_clip_stack
+      0,                                         // clip_depth_floor
+      nullptr,                                   // backdrop_filter_contents
+      std::nullopt,                              // collapsed_parent_pass
+      // Collapsing background elements into the clear color would lose them
+      // when the attachment is loaded instead of cleared.
+      !has_partial_damage);  // collapse_clear_colors
 }
 
 EntityPass::EntityResult EntityPass::GetEntityForElement(
@@ -477,6 +590,7 @@ EntityPass::EntityResult EntityPass::GetEntityForElement(
     Point global_pass_position,
     uint32_t pass_depth,
     ClipCoverageStack& clip_coverage_stack,
+    AnalyticClipStack& analytic_clip_stack,
     size_t clip_depth_floor) const {
   Entity element_entity;
 
@@ -521,6 +635,7 @@ EntityPass::EntityResult EntityPass::GetEntityForElement(
               Point(),                       // local_pass_position
               pass_depth,                    // pass_depth
               clip_coverage_stack,           // clip_coverage_stack
+              analytic_clip_stack,           // analytic_clip_stack
               clip_depth_,                   // clip_depth_floor
               nullptr,                       // backdrop_filter_contents
               pass_context.GetRenderPass(pass_depth)  // collapsed_parent_pass
@@ -623,6 +738,7 @@ EntityPass::EntityResult EntityPass::GetEntityForElement(
     // the subpass will affect in the parent pass.
     ClipCoverageStack subpass_clip_coverage_stack = {ClipCoverageLayer{
         .coverage = subpass_coverage, .clip_depth = subpass->clip_depth_}};
+    AnalyticClipStack subpass_analytic_clip_stack;
 
     // Stencil textures aren't shared between EntityPasses (as much of the
     // time they are transient).
@@ -636,6 +752,7 @@ EntityPass::EntityResult EntityPass::GetEntityForElement(
                 global_pass_position,         // local_pass_position
             ++pass_depth,                     // pass_depth
             subpass_clip_coverage_stack,      // clip_coverage_stack
+            subpass_analytic_clip_stack,      // analytic_clip_stack
             subpass->clip_depth_,             // clip_depth_floor
             subpass_backdrop_filter_contents  // backdrop_filter_contents
             )) {
@@ -686,6 +803,7 @@ bool EntityPass::RenderElement(Entity& element_entity,
                                int32_t pass_depth,
                                ContentContext& renderer,
                                ClipCoverageStack& clip_coverage_stack,
+                               AnalyticClipStack& analytic_clip_stack,
                                Point global_pass_position) const {
   auto result = pass_context.GetRenderPass(pass_depth);
   if (!result.pass) {
@@ -704,11 +822,13 @@ bool EntityPass::RenderElement(Entity& element_entity,
     // Restore any clips that were recorded before the backdrop filter was
     // applied.
     auto& replay_entities = clip_replay_->GetReplayEntities();
-    for (const auto& entity : replay_entities) {
-      if (!entity.Render(renderer, *result.pass)) {
+    for (const auto& replay : replay_entities) {
+      result.pass->SetDefaultScissor(replay.scissor);
+      if (!replay.entity.Render(renderer, *result.pass)) {
         VALIDATION_LOG << "Failed to render entity for clip restore.";
       }
     }
+    result.pass->SetDefaultScissor(std::nullopt);
 
     auto size_rect = Rect::MakeSize(result.pass->GetRenderTargetSize());
     auto msaa_backdrop_contents = TextureContents::MakeRect(size_rect);
@@ -767,6 +887,34 @@ bool EntityPass::RenderElement(Entity& element_entity,
         // whole screen is already being clipped, so skip it.
         return true;
       }
+
+      // If the clip is an axis aligned rect intersection, apply it as a
+      // scissor on subsequent commands rather than writing to the clip
+      // buffer. This elides both the clip draw and the corresponding restore
+      // draw.
+      auto scissor_rect =
+          static_cast<ClipContents*>(element_entity.GetContents().get())
+              ->GetScissorRect(element_entity);
+      if (scissor_rect.has_value()) {
+        auto scissor = IRect::MakeLTRB(
+            std::round(scissor_rect->GetLeft()),    //
+            std::round(scissor_rect->GetTop()),     //
+            std::round(scissor_rect->GetRight()),   //
+            std::round(scissor_rect->GetBottom()));
+        auto clipped = scissor.Intersection(
+            IRect::MakeSize(result.pass->GetRenderTargetSize()));
+        if (clipped.has_value() && !analytic_clip_stack.empty()) {
+          clipped = clipped->Intersection(analytic_clip_stack.back().scissor);
+        }
+        // An empty scissor is left on the stencil path, since zero sized
+        // scissor rects aren't portable across backends.
+        if (clipped.has_value() && !clipped->IsEmpty()) {
+          analytic_clip_stack.push_back(AnalyticClipLayer{
+              .scissor = clipped.value(),
+              .clip_depth = element_entity.GetClipDepth() + 1});
+          return true;
+        }
+      }
     } break;
     case Contents::ClipCoverage::Type::kRestore: {
       if (clip_coverage_stack.back().clip_depth <=
@@ -789,8 +937,25 @@ bool EntityPass::RenderElement(Entity& element_entity,
         // Make the coverage rectangle relative to the current pass.
         restore_coverage->origin -= global_pass_position;
       }
+      size_t popped_layer_count =
+          clip_coverage_stack.size() - (restoration_index + 1);
       clip_coverage_stack.resize(restoration_index + 1);
 
+      // Pop any analytic clips being restored before rendering so that the
+      // restore draw (if any) is scissored by the outer analytic clip.
+      size_t analytic_popped = 0;
+      while (!analytic_clip_stack.empty() &&
+             analytic_clip_stack.back().clip_depth >
+                 element_entity.GetClipDepth()) {
+        analytic_clip_stack.pop_back();
+        ++analytic_popped;
+      }
+      if (analytic_popped >= popped_layer_count) {
+        // All of the restored clips were applied analytically, so there's no
+        // stencil state to repair.
+        return true;
+      }
+
       if (!clip_coverage_stack.back().coverage.has_value()) {
         // Running this restore op won't make anything renderable, so skip it.
         return true;
@@ -814,9 +979,27 @@ bool EntityPass::RenderElement(Entity& element_entity,
   }
 #endif
 
-  element_entity.SetClipDepth(element_entity.GetClipDepth() - clip_depth_floor);
-  clip_replay_->RecordEntity(element_entity, clip_coverage.type);
-  if (!element_entity.Render(renderer, *result.pass)) {
+  // Analytic clips don't write to the clip buffer, so the clip depth of every
+  // subsequent draw needs to be lowered by the number of active analytic
+  // clips in addition to the clip depth floor. A root damage scissor layer
+  // (clip depth zero) doesn't correspond to a recorded clip and so doesn't
+  // count; actual clip layers always have a depth of at least one.
+  size_t elided_clip_count = analytic_clip_stack.size();
+  if (!analytic_clip_stack.empty() &&
+      analytic_clip_stack.front().clip_depth == 0u) {
+    elided_clip_count -= 1;
+  }
+  element_entity.SetClipDepth(element_entity.GetClipDepth() - clip_depth_floor -
+                              elided_clip_count);
+  std::optional<IRect> scissor =
+      analytic_clip_stack.empty()
+          ? std::nullopt
+          : std::optional<IRect>(analytic_clip_stack.back().scissor);
+  clip_replay_->RecordEntity(element_entity, clip_coverage.type, scissor);
+  result.pass->SetDefaultScissor(scissor);
+  bool rendered = element_entity.Render(renderer, *result.pass);
+  result.pass->SetDefaultScissor(std::nullopt);
+  if (!rendered) {
     VALIDATION_LOG << "Failed to render entity.";
     return false;
   }
@@ -832,10 +1015,12 @@ bool EntityPass::OnRender(
     Point local_pass_position,
     uint32_t pass_depth,
     ClipCoverageStack& clip_coverage_stack,
+    AnalyticClipStack& analytic_clip_stack,
     size_t clip_depth_floor,
     std::shared_ptr<Contents> backdrop_filter_contents,
     const std::optional<InlinePassContext::RenderPassResult>&
-        collapsed_parent_pass) const {
+        collapsed_parent_pass,
+    bool collapse_clear_colors) const {
   TRACE_EVENT0("impeller", "EntityPass::OnRender");
 
   auto context = renderer.GetContext();
@@ -871,10 +1056,12 @@ bool EntityPass::OnRender(
     backdrop_entity.SetClipDepth(clip_depth_floor);
 
     RenderElement(backdrop_entity, clip_depth_floor, pass_context, pass_depth,
-                  renderer, clip_coverage_stack, global_pass_position);
+                  renderer, clip_coverage_stack, analytic_clip_stack,
+                  global_pass_position);
   }
 
-  bool is_collapsing_clear_colors = !collapsed_parent_pass &&
+  bool is_collapsing_clear_colors = collapse_clear_colors &&
+                                    !collapsed_parent_pass &&
                                     // Backdrop filters act as a entity before
                                     // everything and disrupt the optimization.
                                     !backdrop_filter_proc_;
@@ -898,6 +1085,7 @@ bool EntityPass::OnRender(
                             global_pass_position,  // global_pass_position
                             pass_depth,            // pass_depth
                             clip_coverage_stack,   // clip_coverage_stack
+                            analytic_clip_stack,   // analytic_clip_stack
                             clip_depth_floor);     // clip_depth_floor
 
     switch (result.status) {
@@ -967,7 +1155,7 @@ bool EntityPass::OnRender(
     ///
     if (!RenderElement(result.entity, clip_depth_floor, pass_context,
                        pass_depth, renderer, clip_coverage_stack,
-                       global_pass_position)) {
+                       analytic_clip_stack, global_pass_position)) {
       // Specific validation logs are handled in `render_element()`.
       return false;
     }
@@ -1083,6 +1271,10 @@ size_t EntityPass::GetElementCount() const {
 }
 
 std::unique_ptr<EntityPass> EntityPass::Clone() const {
+  // Seal any open rect batch; the cloned elements share its contents pointer,
+  // so folding more rects into it would mutate the clone as well.
+  open_rect_batch_ = nullptr;
+
   std::vector<Element> new_elements;
   new_elements.reserve(elements_.size());
 
@@ -1163,12 +1355,13 @@ void EntityPass::SetEnableOffscreenCheckerboard(bool enabled) {
 EntityPassClipRecorder::EntityPassClipRecorder() {}
 
 void EntityPassClipRecorder::RecordEntity(const Entity& entity,
-                                          Contents::ClipCoverage::Type type) {
+                                          Contents::ClipCoverage::Type type,
+                                          std::optional<IRect> scissor) {
   switch (type) {
     case Contents::ClipCoverage::Type::kNoChange:
       return;
     case Contents::ClipCoverage::Type::kAppend:
-      rendered_clip_entities_.push_back(entity);
+      rendered_clip_entities_.push_back({entity, scissor});
       break;
     case Contents::ClipCoverage::Type::kRestore:
       rendered_clip_entities_.pop_back();
@@ -1176,7 +1369,8 @@ void EntityPassClipRecorder::RecordEntity(const Entity& entity,
   }
 }
 
-const std::vector<Entity>& EntityPassClipRecorder::GetReplayEntities() const {
+const std::vector<EntityPassClipRecorder::ReplayEntity>&
+EntityPassClipRecorder::GetReplayEntities() const {
   return rendered_clip_entities_;
 }
 
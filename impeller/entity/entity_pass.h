@@ -21,6 +21,7 @@ namespace impeller {
 
 class ContentContext;
 class EntityPassClipRecorder;
+class SolidRectBatchContents;
 
 class EntityPass {
  public:
@@ -49,6 +50,18 @@ class EntityPass {
 
   using ClipCoverageStack = std::vector<ClipCoverageLayer>;
 
+  /// A clip applied as a command scissor rect instead of a stencil write.
+  /// Axis aligned rect intersect clips qualify for this; see
+  /// `ClipContents::GetScissorRect`. The scissor holds the accumulated
+  /// intersection of all analytic clips up to `clip_depth`, in render target
+  /// coordinates.
+  struct AnalyticClipLayer {
+    IRect scissor;
+    size_t clip_depth;
+  };
+
+  using AnalyticClipStack = std::vector<AnalyticClipLayer>;
+
   EntityPass();
 
   ~EntityPass();
@@ -90,8 +103,19 @@ class EntityPass {
 
   EntityPass* GetSuperpass() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief  Render this pass and all of its subpasses into the given render
+  ///         target.
+  ///
+  ///         If `damage` is supplied, rendering is restricted to the given
+  ///         region of the render target: the existing attachment contents are
+  ///         loaded instead of cleared, all commands are scissored to the
+  ///         damage region, and entities that don't intersect it are culled.
+  ///         Pixels outside of the damage region are left untouched.
+  ///
   bool Render(ContentContext& renderer,
-              const RenderTarget& render_target) const;
+              const RenderTarget& render_target,
+              const std::optional<IRect>& damage = std::nullopt) const;
 
   /// @brief  Iterate all elements (entities and subpasses) in this pass,
   ///         recursively including elements of child passes. The iteration
@@ -194,6 +218,7 @@ class EntityPass {
                      int32_t pass_depth,
                      ContentContext& renderer,
                      ClipCoverageStack& clip_coverage_stack,
+                     AnalyticClipStack& analytic_clip_stack,
                      Point global_pass_position) const;
 
   EntityResult GetEntityForElement(const EntityPass::Element& element,
@@ -204,6 +229,7 @@ class EntityPass {
                                    Point global_pass_position,
                                    uint32_t pass_depth,
                                    ClipCoverageStack& clip_coverage_stack,
+                                   AnalyticClipStack& analytic_clip_stack,
                                    size_t clip_depth_floor) const;
 
   //----------------------------------------------------------------------------
@@ -244,6 +270,10 @@ class EntityPass {
   ///                                      Used to cull Elements that we
   ///                                      know won't result in a visible
   ///                                      change.
+  /// @param[in]  analytic_clip_stack      A global stack of clips that are
+  ///                                      applied as command scissors instead
+  ///                                      of stencil writes. Parallels
+  ///                                      `clip_coverage_stack`.
   /// @param[in]  clip_depth_floor         The clip depth that a value of
   ///                                      zero corresponds to in the given
   ///                                      `pass_target` clip buffer.
@@ -262,6 +292,11 @@ class EntityPass {
   ///                                      creating a new `RenderPass`. This
   ///                                      "collapses" the Elements into the
   ///                                      parent pass.
+  /// @param[in]  collapse_clear_colors    Whether background elements may be
+  ///                                      folded into the pass clear color.
+  ///                                      Disabled when rendering with partial
+  ///                                      damage, since the attachment is
+  ///                                      loaded rather than cleared.
   ///
   bool OnRender(ContentContext& renderer,
                 Capture& capture,
@@ -271,10 +306,12 @@ class EntityPass {
                 Point local_pass_position,
                 uint32_t pass_depth,
                 ClipCoverageStack& clip_coverage_stack,
+                AnalyticClipStack& analytic_clip_stack,
                 size_t clip_depth_floor = 0,
                 std::shared_ptr<Contents> backdrop_filter_contents = nullptr,
                 const std::optional<InlinePassContext::RenderPassResult>&
-                    collapsed_parent_pass = std::nullopt) const;
+                    collapsed_parent_pass = std::nullopt,
+                bool collapse_clear_colors = true) const;
 
   /// The list of renderable items in the scene. Each of these items is
   /// evaluated and recorded to an `EntityPassTarget` by the `OnRender` method.
@@ -303,6 +340,22 @@ class EntityPass {
 
   uint32_t GetTotalPassReads(ContentContext& renderer) const;
 
+  //----------------------------------------------------------------------------
+  /// @brief  Attempts to merge the given entity into a batch with the
+  ///         previously added element when both are solid color axis aligned
+  ///         rect fills sharing a blend mode and clip depth.
+  ///
+  ///         Returns true if the entity was folded into a batch, in which case
+  ///         the caller must not append it as a separate element.
+  ///
+  bool TryFoldIntoRectBatch(const Entity& entity);
+
+  /// The batch that the most recently added element renders with, if any.
+  /// Reset whenever an unbatchable element is appended (and in `Clone()`,
+  /// since clones share the batch contents pointer and further folding would
+  /// mutate the cloned pass).
+  mutable std::shared_ptr<SolidRectBatchContents> open_rect_batch_;
+
   BackdropFilterProc backdrop_filter_proc_ = nullptr;
 
   std::shared_ptr<EntityPassDelegate> delegate_ =
@@ -320,17 +373,27 @@ class EntityPass {
 ///        stencil buffer is left in an identical state.
 class EntityPassClipRecorder {
  public:
+  struct ReplayEntity {
+    Entity entity;
+    /// The analytic clip scissor that was active when the clip was rendered,
+    /// if any. Applied to the replayed stencil writes so the replay leaves
+    /// the stencil buffer in an identical state.
+    std::optional<IRect> scissor;
+  };
+
   EntityPassClipRecorder();
 
   ~EntityPassClipRecorder() = default;
 
   /// @brief Record the entity based on the provided coverage [type].
-  void RecordEntity(const Entity& entity, Contents::ClipCoverage::Type type);
+  void RecordEntity(const Entity& entity,
+                    Contents::ClipCoverage::Type type,
+                    std::optional<IRect> scissor = std::nullopt);
 
-  const std::vector<Entity>& GetReplayEntities() const;
+  const std::vector<ReplayEntity>& GetReplayEntities() const;
 
  private:
-  std::vector<Entity> rendered_clip_entities_;
+  std::vector<ReplayEntity> rendered_clip_entities_;
 };
 
 }  // namespace impeller
@@ -136,6 +136,58 @@ TEST_P(EntityTest, EntityPassRespectsSubpassBoundsLimit) {
   ASSERT_RECT_NEAR(coverage.value(), Rect::MakeLTRB(50, 50, 900, 900));
 }
 
+static Entity MakeSolidRectEntity(Rect rect, Color color) {
+  Entity entity;
+  auto contents = std::make_shared<SolidColorContents>();
+  contents->SetGeometry(Geometry::MakeRect(rect));
+  contents->SetColor(color);
+  entity.SetContents(std::move(contents));
+  return entity;
+}
+
+TEST_P(EntityTest, EntityPassBatchesConsecutiveSolidRects) {
+  EntityPass pass;
+
+  // The first element is never batched so that the clear color optimization
+  // still applies; the second and third fold into one batch element.
+  pass.AddEntity(MakeSolidRectEntity(Rect::MakeLTRB(0, 0, 10, 10),  //
+                                     Color::Red()));
+  pass.AddEntity(MakeSolidRectEntity(Rect::MakeLTRB(10, 0, 20, 10),  //
+                                     Color::Green()));
+  pass.AddEntity(MakeSolidRectEntity(Rect::MakeLTRB(20, 0, 30, 10),  //
+                                     Color::Blue()));
+  ASSERT_EQ(pass.GetElementCount(), 2u);
+
+  // An entity with a different clip depth breaks the run.
+  Entity clipped = MakeSolidRectEntity(Rect::MakeLTRB(30, 0, 40, 10),  //
+                                       Color::White());
+  clipped.SetClipDepth(1u);
+  pass.AddEntity(clipped);
+  ASSERT_EQ(pass.GetElementCount(), 3u);
+
+  // The batched rects still contribute to the elements coverage.
+  auto coverage = pass.GetElementsCoverage(std::nullopt);
+  ASSERT_TRUE(coverage.has_value());
+  ASSERT_RECT_NEAR(coverage.value(), Rect::MakeLTRB(0, 0, 40, 10));
+}
+
+TEST_P(EntityTest, EntityPassDoesNotBatchIncompatibleEntities) {
+  EntityPass pass;
+
+  pass.AddEntity(MakeSolidRectEntity(Rect::MakeLTRB(0, 0, 10, 10),  //
+                                     Color::Red()));
+
+  // A non-rect geometry between rect fills prevents folding.
+  Entity path_entity;
+  path_entity.SetContents(SolidColorContents::Make(
+      PathBuilder{}.AddCircle({50, 50}, 10).TakePath(), Color::Red()));
+  pass.AddEntity(path_entity);
+
+  pass.AddEntity(MakeSolidRectEntity(Rect::MakeLTRB(10, 0, 20, 10),  //
+                                     Color::Green()));
+  ASSERT_EQ(pass.GetElementCount(), 3u);
+}
+
 TEST_P(EntityTest, EntityPassCanMergeSubpassIntoParent) {
   // Both a red and a blue box should appear if the pass merging has worked
   // correctly.
@@ -1682,6 +1734,54 @@ TEST_P(EntityTest, ClipContentsGetClipCoverageIsCorrect) {
   }
 }
 
+TEST_P(EntityTest, ClipContentsGetScissorRectIsCorrect) {
+  // Axis aligned rect intersect clip under a translation/scale transform.
+  {
+    auto clip = std::make_shared<ClipContents>();
+    clip->SetClipOperation(Entity::ClipOperation::kIntersect);
+    clip->SetGeometry(Geometry::MakeRect(Rect::MakeLTRB(0, 0, 50, 50)));
+
+    Entity entity;
+    entity.SetTransformation(Matrix::MakeTranslation({10, 20, 0}) *
+                             Matrix::MakeScale({2, 2, 1}));
+    auto result = clip->GetScissorRect(entity);
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_RECT_NEAR(result.value(), Rect::MakeLTRB(10, 20, 110, 120));
+  }
+
+  // Rotated transforms can't be expressed as a scissor.
+  {
+    auto clip = std::make_shared<ClipContents>();
+    clip->SetClipOperation(Entity::ClipOperation::kIntersect);
+    clip->SetGeometry(Geometry::MakeRect(Rect::MakeLTRB(0, 0, 50, 50)));
+
+    Entity entity;
+    entity.SetTransformation(Matrix::MakeRotationZ(Degrees(45)));
+
+    ASSERT_FALSE(clip->GetScissorRect(entity).has_value());
+  }
+
+  // Non-rect geometry can't be expressed as a scissor.
+  {
+    auto clip = std::make_shared<ClipContents>();
+    clip->SetClipOperation(Entity::ClipOperation::kIntersect);
+    clip->SetGeometry(Geometry::MakeFillPath(
+        PathBuilder{}.AddCircle({25, 25}, 25).TakePath()));
+
+    ASSERT_FALSE(clip->GetScissorRect(Entity{}).has_value());
+  }
+
+  // Difference clips can't be expressed as a scissor.
+  {
+    auto clip = std::make_shared<ClipContents>();
+    clip->SetClipOperation(Entity::ClipOperation::kDifference);
+    clip->SetGeometry(Geometry::MakeRect(Rect::MakeLTRB(0, 0, 50, 50)));
+
+    ASSERT_FALSE(clip->GetScissorRect(Entity{}).has_value());
+  }
+}
+
 TEST_P(EntityTest, RRectShadowTest) {
   auto callback = [&](ContentContext& context, RenderPass& pass) {
     static Color color = Color::Red();
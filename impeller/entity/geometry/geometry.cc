@@ -129,4 +129,8 @@ bool Geometry::IsAxisAlignedRect() const {
   return false;
 }
 
+std::optional<Rect> Geometry::AsAxisAlignedRect() const {
+  return std::nullopt;
+}
+
 }  // namespace impeller
@@ -103,6 +103,11 @@ class Geometry {
   virtual bool CoversArea(const Matrix& transform, const Rect& rect) const;
 
   virtual bool IsAxisAlignedRect() const;
+
+  /// @brief    Returns the rect if this geometry is an axis aligned rect that
+  ///           requires no tessellation. Used to fold simple fills into
+  ///           batched draws.
+  virtual std::optional<Rect> AsAxisAlignedRect() const;
 };
 
 }  // namespace impeller
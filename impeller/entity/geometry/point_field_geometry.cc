@@ -157,6 +157,7 @@ GeometryResult PointFieldGeometry::GetPositionBufferGPU(
   DeviceBufferDescriptor buffer_desc;
   buffer_desc.size = total * sizeof(Point);
   buffer_desc.storage_mode = StorageMode::kDevicePrivate;
+  buffer_desc.resource_class = ResourceClass::kGeometryBuffer;
 
   auto geometry_buffer = renderer.GetContext()
                              ->GetResourceAllocator()
@@ -192,6 +193,7 @@ GeometryResult PointFieldGeometry::GetPositionBufferGPU(
     DeviceBufferDescriptor buffer_desc;
     buffer_desc.size = total * sizeof(Vector4);
     buffer_desc.storage_mode = StorageMode::kDevicePrivate;
+    buffer_desc.resource_class = ResourceClass::kGeometryBuffer;
 
     auto geometry_uv_buffer = renderer.GetContext()
                                   ->GetResourceAllocator()
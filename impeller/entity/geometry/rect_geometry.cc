@@ -59,4 +59,8 @@ bool RectGeometry::IsAxisAlignedRect() const {
   return true;
 }
 
+std::optional<Rect> RectGeometry::AsAxisAlignedRect() const {
+  return rect_;
+}
+
 }  // namespace impeller
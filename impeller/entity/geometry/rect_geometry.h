@@ -20,6 +20,9 @@ class RectGeometry : public Geometry {
   // |Geometry|
   bool IsAxisAlignedRect() const override;
 
+  // |Geometry|
+  std::optional<Rect> AsAxisAlignedRect() const override;
+
  private:
   // |Geometry|
   GeometryResult GetPositionBuffer(const ContentContext& renderer,
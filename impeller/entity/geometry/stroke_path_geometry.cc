@@ -5,6 +5,8 @@
 #include "impeller/entity/geometry/stroke_path_geometry.h"
 
 #include "impeller/geometry/path_builder.h"
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/compute_command.h"
 
 namespace impeller {
 
@@ -436,10 +438,154 @@ StrokePathGeometry::CreateSolidStrokeVertices(
   return vtx_builder;
 }
 
+bool StrokePathGeometry::CanUseComputeStroke(
+    const ContentContext& renderer) const {
+  if (!renderer.GetDeviceCapabilities().SupportsCompute()) {
+    return false;
+  }
+  // The compute stroker emits one quad per polyline segment and lets the
+  // triangle strip bridge adjacent segments, which matches bevel joins. It
+  // can extend the stroke ends for square caps but generates no round
+  // geometry and cannot jump between contours or close a loop.
+  if (stroke_join_ != Join::kBevel || stroke_cap_ == Cap::kRound) {
+    return false;
+  }
+  if (path_.GetComponentCount(Path::ComponentType::kContour) != 1u) {
+    return false;
+  }
+  ContourComponent contour;
+  if (!path_.GetContourComponentAtIndex(0u, contour) || contour.is_closed) {
+    return false;
+  }
+  return true;
+}
+
+GeometryResult StrokePathGeometry::GetPositionBufferGPU(
+    const ContentContext& renderer,
+    const Entity& entity,
+    RenderPass& pass,
+    std::optional<Rect> texture_coverage,
+    std::optional<Matrix> effect_transform) {
+  FML_DCHECK(renderer.GetDeviceCapabilities().SupportsCompute());
+  if (stroke_width_ < 0.0) {
+    return {};
+  }
+  auto determinant = entity.GetTransformation().GetDeterminant();
+  if (determinant == 0) {
+    return {};
+  }
+
+  Scalar min_size = 1.0f / sqrt(std::abs(determinant));
+  Scalar stroke_width = std::max(stroke_width_, min_size);
+
+  // The polyline is still generated on the CPU, where unchanged paths hit
+  // the flattening cache; only the per-vertex stroke expansion moves to the
+  // GPU.
+  auto polyline =
+      path_.CreatePolyline(entity.GetTransformation().GetMaxBasisLength());
+  auto point_count = polyline.points->size();
+  if (point_count < 2u) {
+    return {};
+  }
+  auto total = (point_count - 1u) * 4u;
+
+  auto cmd_buffer = renderer.GetContext()->CreateCommandBuffer();
+  auto compute_pass = cmd_buffer->CreateComputePass();
+  auto& host_buffer = compute_pass->GetTransientsBuffer();
+
+  auto polyline_data =
+      host_buffer.Emplace(polyline.points->data(), point_count * sizeof(Point),
+                          DefaultUniformAlignment());
+
+  DeviceBufferDescriptor buffer_desc;
+  buffer_desc.size = total * sizeof(Point);
+  buffer_desc.storage_mode = StorageMode::kDevicePrivate;
+
+  auto geometry_buffer = renderer.GetContext()
+                             ->GetResourceAllocator()
+                             ->CreateBuffer(buffer_desc)
+                             ->AsBufferView();
+
+  BufferView output;
+  {
+    using SS = StrokeSegmentComputeShader;
+
+    ComputeCommand cmd;
+    DEBUG_COMMAND_INFO(cmd, "Stroke Geometry");
+    cmd.pipeline = renderer.GetStrokeComputePipeline();
+
+    SS::FrameInfo frame_info;
+    frame_info.count = point_count;
+    frame_info.width = stroke_width;
+    frame_info.cap = static_cast<uint32_t>(stroke_cap_);
+
+    SS::BindFrameInfo(cmd, host_buffer.EmplaceUniform(frame_info));
+    SS::BindPolylineData(cmd, polyline_data);
+    SS::BindGeometryData(cmd, geometry_buffer);
+
+    if (!compute_pass->AddCommand(std::move(cmd))) {
+      return {};
+    }
+    output = geometry_buffer;
+  }
+
+  if (texture_coverage.has_value() && effect_transform.has_value()) {
+    DeviceBufferDescriptor uv_buffer_desc;
+    uv_buffer_desc.size = total * sizeof(Vector4);
+    uv_buffer_desc.storage_mode = StorageMode::kDevicePrivate;
+
+    auto geometry_uv_buffer = renderer.GetContext()
+                                  ->GetResourceAllocator()
+                                  ->CreateBuffer(uv_buffer_desc)
+                                  ->AsBufferView();
+
+    using UV = UvComputeShader;
+
+    ComputeCommand cmd;
+    DEBUG_COMMAND_INFO(cmd, "UV Geometry");
+    cmd.pipeline = renderer.GetUvComputePipeline();
+
+    UV::FrameInfo frame_info;
+    frame_info.count = total;
+    frame_info.effect_transform = effect_transform.value();
+    frame_info.texture_origin = {0, 0};
+    frame_info.texture_size = Vector2(texture_coverage.value().size);
+
+    UV::BindFrameInfo(cmd, host_buffer.EmplaceUniform(frame_info));
+    UV::BindGeometryData(cmd, geometry_buffer);
+    UV::BindGeometryUVData(cmd, geometry_uv_buffer);
+
+    if (!compute_pass->AddCommand(std::move(cmd))) {
+      return {};
+    }
+    output = geometry_uv_buffer;
+  }
+
+  compute_pass->SetGridSize(ISize(total, 1));
+  compute_pass->SetThreadGroupSize(ISize(total, 1));
+
+  if (!compute_pass->EncodeCommands() || !cmd_buffer->SubmitCommands()) {
+    return {};
+  }
+
+  return {
+      .type = PrimitiveType::kTriangleStrip,
+      .vertex_buffer = {.vertex_buffer = output,
+                        .vertex_count = total,
+                        .index_type = IndexType::kNone},
+      .transform = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                   entity.GetTransformation(),
+      .prevent_overdraw = true,
+  };
+}
+
 GeometryResult StrokePathGeometry::GetPositionBuffer(
     const ContentContext& renderer,
     const Entity& entity,
     RenderPass& pass) {
+  if (CanUseComputeStroke(renderer)) {
+    return GetPositionBufferGPU(renderer, entity, pass);
+  }
   if (stroke_width_ < 0.0) {
     return {};
   }
@@ -472,6 +618,10 @@ GeometryResult StrokePathGeometry::GetPositionUVBuffer(
     const ContentContext& renderer,
     const Entity& entity,
     RenderPass& pass) {
+  if (CanUseComputeStroke(renderer)) {
+    return GetPositionBufferGPU(renderer, entity, pass, texture_coverage,
+                                effect_transform);
+  }
   if (stroke_width_ < 0.0) {
     return {};
   }
@@ -64,6 +64,18 @@ class StrokePathGeometry : public Geometry {
 
   bool SkipRendering() const;
 
+  /// @brief Whether the stroke can be expanded on the GPU. The compute
+  ///        stroker only produces bevel joins and butt or square caps on a
+  ///        single open contour; everything else takes the CPU stroker.
+  bool CanUseComputeStroke(const ContentContext& renderer) const;
+
+  GeometryResult GetPositionBufferGPU(
+      const ContentContext& renderer,
+      const Entity& entity,
+      RenderPass& pass,
+      std::optional<Rect> texture_coverage = std::nullopt,
+      std::optional<Matrix> effect_transform = std::nullopt);
+
   static Scalar CreateBevelAndGetDirection(
       VertexBufferBuilder<SolidFillVertexShader::PerVertexData>& vtx_builder,
       const Point& position,
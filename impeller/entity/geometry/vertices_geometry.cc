@@ -123,6 +123,7 @@ GeometryResult VerticesGeometry::GetPositionBuffer(
   DeviceBufferDescriptor buffer_desc;
   buffer_desc.size = total_vtx_bytes + total_idx_bytes;
   buffer_desc.storage_mode = StorageMode::kHostVisible;
+  buffer_desc.resource_class = ResourceClass::kGeometryBuffer;
 
   auto buffer =
       renderer.GetContext()->GetResourceAllocator()->CreateBuffer(buffer_desc);
@@ -183,6 +184,7 @@ GeometryResult VerticesGeometry::GetPositionColorBuffer(
   DeviceBufferDescriptor buffer_desc;
   buffer_desc.size = total_vtx_bytes + total_idx_bytes;
   buffer_desc.storage_mode = StorageMode::kHostVisible;
+  buffer_desc.resource_class = ResourceClass::kGeometryBuffer;
 
   auto buffer =
       renderer.GetContext()->GetResourceAllocator()->CreateBuffer(buffer_desc);
@@ -254,6 +256,7 @@ GeometryResult VerticesGeometry::GetPositionUVBuffer(
   DeviceBufferDescriptor buffer_desc;
   buffer_desc.size = total_vtx_bytes + total_idx_bytes;
   buffer_desc.storage_mode = StorageMode::kHostVisible;
+  buffer_desc.resource_class = ResourceClass::kGeometryBuffer;
 
   auto buffer =
       renderer.GetContext()->GetResourceAllocator()->CreateBuffer(buffer_desc);
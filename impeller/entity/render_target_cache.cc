@@ -7,8 +7,16 @@
 
 namespace impeller {
 
-RenderTargetCache::RenderTargetCache(std::shared_ptr<Allocator> allocator)
-    : RenderTargetAllocator(std::move(allocator)) {}
+namespace {
+size_t TextureByteSize(const std::shared_ptr<Texture>& texture) {
+  return texture->GetTextureDescriptor().GetByteSizeOfBaseMipLevel();
+}
+}  // namespace
+
+RenderTargetCache::RenderTargetCache(std::shared_ptr<Allocator> allocator,
+                                     size_t budget_bytes)
+    : RenderTargetAllocator(std::move(allocator)),
+      budget_bytes_(budget_bytes) {}
 
 void RenderTargetCache::Start() {
   for (auto& td : texture_data_) {
@@ -18,12 +26,42 @@ void RenderTargetCache::Start() {
 
 void RenderTargetCache::End() {
   std::vector<TextureData> retain;
+  size_t idle_bytes = 0u;
 
-  for (const auto& td : texture_data_) {
+  for (auto& td : texture_data_) {
     if (td.used_this_frame) {
+      td.unused_frame_count = 0;
       retain.push_back(td);
+      continue;
     }
+    if (++td.unused_frame_count > kMaxUnusedFrameCount) {
+      continue;
+    }
+    idle_bytes += TextureByteSize(td.texture);
+    retain.push_back(td);
   }
+
+  // Evict the textures that have gone unused the longest until the idle
+  // retained textures fit in the budget. Textures used this frame always
+  // survive, as they may still be attached to pending render passes.
+  while (idle_bytes > budget_bytes_) {
+    auto oldest = retain.end();
+    for (auto it = retain.begin(); it != retain.end(); ++it) {
+      if (it->unused_frame_count == 0) {
+        continue;
+      }
+      if (oldest == retain.end() ||
+          it->unused_frame_count > oldest->unused_frame_count) {
+        oldest = it;
+      }
+    }
+    if (oldest == retain.end()) {
+      break;
+    }
+    idle_bytes -= TextureByteSize(oldest->texture);
+    retain.erase(oldest);
+  }
+
   texture_data_.swap(retain);
 }
 
@@ -42,15 +80,32 @@ std::shared_ptr<Texture> RenderTargetCache::CreateTexture(
     FML_DCHECK(td.texture != nullptr);
     if (!td.used_this_frame && desc == other_desc) {
       td.used_this_frame = true;
+      td.unused_frame_count = 0;
       return td.texture;
     }
   }
+  // Transient attachments (MSAA and depth-stencil) are cleared on load and
+  // discarded on store, so their contents never outlive a single render pass.
+  // Once every pass holding a matching transient texture has been torn down
+  // (leaving the cache with the only reference), a later pass in the same
+  // frame can alias the allocation instead of creating another one. Passes
+  // execute in submission order on a single queue, so the aliased memory is
+  // never in contention.
+  if (desc.storage_mode == StorageMode::kDeviceTransient) {
+    for (auto& td : texture_data_) {
+      const auto other_desc = td.texture->GetTextureDescriptor();
+      if (td.used_this_frame && td.texture.use_count() == 1 &&
+          desc == other_desc) {
+        return td.texture;
+      }
+    }
+  }
   auto result = RenderTargetAllocator::CreateTexture(desc);
   if (result == nullptr) {
     return result;
   }
-  texture_data_.push_back(
-      TextureData{.used_this_frame = true, .texture = result});
+  texture_data_.push_back(TextureData{
+      .used_this_frame = true, .unused_frame_count = 0, .texture = result});
   return result;
 }
 
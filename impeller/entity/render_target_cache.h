@@ -8,13 +8,30 @@
 
 namespace impeller {
 
-/// @brief An implementation of the [RenderTargetAllocator] that caches all
-///        allocated texture data for one frame.
+/// @brief An implementation of the [RenderTargetAllocator] that caches
+///        allocated texture data across frames.
 ///
-///        Any textures unused after a frame are immediately discarded.
+///        Textures are matched by descriptor equality. Textures that go
+///        unused are retained for a small number of frames (subject to a
+///        byte budget) so that screens which allocate identical offscreen
+///        targets every frame reach a steady state with zero render target
+///        allocations, even when a target occasionally skips a frame.
+///
+///        Transient (memoryless where supported) attachments whose passes
+///        have already been torn down may additionally be aliased by later
+///        passes within the same frame.
 class RenderTargetCache : public RenderTargetAllocator {
  public:
-  explicit RenderTargetCache(std::shared_ptr<Allocator> allocator);
+  /// The maximum number of bytes of idle (unused in the current frame)
+  /// texture data to retain across frames.
+  static constexpr size_t kDefaultBudgetBytes = 64u * 1024u * 1024u;
+
+  /// The number of consecutive frames a texture may go unused before it is
+  /// evicted regardless of the budget.
+  static constexpr uint32_t kMaxUnusedFrameCount = 4u;
+
+  explicit RenderTargetCache(std::shared_ptr<Allocator> allocator,
+                             size_t budget_bytes = kDefaultBudgetBytes);
 
   ~RenderTargetCache() = default;
 
@@ -34,10 +51,14 @@ class RenderTargetCache : public RenderTargetAllocator {
  private:
   struct TextureData {
     bool used_this_frame;
+    /// The number of consecutive frames the texture has gone unused. Always
+    /// zero while `used_this_frame` is true.
+    uint32_t unused_frame_count;
     std::shared_ptr<Texture> texture;
   };
 
   std::vector<TextureData> texture_data_;
+  size_t budget_bytes_;
 
   RenderTargetCache(const RenderTargetCache&) = delete;
 
@@ -52,24 +52,87 @@ TEST(RenderTargetCacheTest, CachesUsedTexturesAcrossFrames) {
 
   render_target_cache.Start();
   // Create two textures of the same exact size/shape. Both should be marked
-  // as used this frame, so the cached data set will contain two.
-  render_target_cache.CreateTexture(desc);
-  render_target_cache.CreateTexture(desc);
+  // as used this frame, so the cached data set will contain two. The returned
+  // textures are held for the duration of the frame so that they coexist, as
+  // they would when attached to pending render passes.
+  auto texture_1 = render_target_cache.CreateTexture(desc);
+  auto texture_2 = render_target_cache.CreateTexture(desc);
 
   ASSERT_EQ(render_target_cache.CachedTextureCount(), 2u);
 
   render_target_cache.End();
   render_target_cache.Start();
 
-  // Next frame, only create one texture. The set will still contain two,
-  // but one will be removed at the end of the frame.
+  // Next frame, only create one texture. The set still contains two; the idle
+  // texture is retained (within budget) in case it's requested again soon.
   render_target_cache.CreateTexture(desc);
   ASSERT_EQ(render_target_cache.CachedTextureCount(), 2u);
 
   render_target_cache.End();
+  ASSERT_EQ(render_target_cache.CachedTextureCount(), 2u);
+
+  // After going unused for the maximum number of frames, the idle texture is
+  // evicted while the recurring one survives.
+  for (uint32_t i = 0; i < RenderTargetCache::kMaxUnusedFrameCount; i++) {
+    render_target_cache.Start();
+    render_target_cache.CreateTexture(desc);
+    render_target_cache.End();
+  }
   ASSERT_EQ(render_target_cache.CachedTextureCount(), 1u);
 }
 
+TEST(RenderTargetCacheTest, EvictsIdleTexturesOverBudget) {
+  auto allocator = std::make_shared<TestAllocator>();
+  auto desc = TextureDescriptor{
+      .format = PixelFormat::kR8G8B8A8UNormInt,
+      .size = ISize(100, 100),
+      .usage = static_cast<TextureUsageMask>(TextureUsage::kRenderTarget)};
+  // A budget that fits exactly one idle 100x100 RGBA texture.
+  auto render_target_cache =
+      RenderTargetCache(allocator, desc.GetByteSizeOfBaseMipLevel());
+
+  render_target_cache.Start();
+  auto texture_1 = render_target_cache.CreateTexture(desc);
+  auto texture_2 = render_target_cache.CreateTexture(desc);
+  render_target_cache.End();
+
+  // Both textures were used this frame, so both survive regardless of the
+  // budget.
+  ASSERT_EQ(render_target_cache.CachedTextureCount(), 2u);
+
+  // Next frame, neither texture is used. Together they exceed the budget, so
+  // one of them is evicted at the end of the frame.
+  render_target_cache.Start();
+  render_target_cache.End();
+  ASSERT_EQ(render_target_cache.CachedTextureCount(), 1u);
+}
+
+TEST(RenderTargetCacheTest, AliasesReleasedTransientTexturesWithinAFrame) {
+  auto allocator = std::make_shared<TestAllocator>();
+  auto render_target_cache = RenderTargetCache(allocator);
+  auto desc = TextureDescriptor{
+      .storage_mode = StorageMode::kDeviceTransient,
+      .format = PixelFormat::kR8G8B8A8UNormInt,
+      .size = ISize(100, 100),
+      .usage = static_cast<TextureUsageMask>(TextureUsage::kRenderTarget)};
+
+  render_target_cache.Start();
+  // While both passes still hold their transient textures, the requests must
+  // be served by distinct allocations.
+  auto texture_1 = render_target_cache.CreateTexture(desc);
+  auto texture_2 = render_target_cache.CreateTexture(desc);
+  ASSERT_NE(texture_1, texture_2);
+  ASSERT_EQ(render_target_cache.CachedTextureCount(), 2u);
+
+  // Once the passes have been torn down, a later request in the same frame
+  // aliases an existing allocation instead of growing the cache.
+  texture_1.reset();
+  texture_2.reset();
+  auto texture_3 = render_target_cache.CreateTexture(desc);
+  ASSERT_NE(texture_3, nullptr);
+  ASSERT_EQ(render_target_cache.CachedTextureCount(), 2u);
+}
+
 TEST(RenderTargetCacheTest, DoesNotPersistFailedAllocations) {
   auto allocator = std::make_shared<TestAllocator>();
   auto render_target_cache = RenderTargetCache(allocator);
@@ -16,7 +16,6 @@ uniform BlendInfo {
   float16_t src_input_alpha;
   float16_t color_factor;
   f16vec4 color;  // This color input is expected to be unpremultiplied.
-  float supports_decal_sampler_address_mode;
 }
 blend_info;
 
@@ -29,7 +28,7 @@ in vec2 v_src_texture_coords;
 out f16vec4 frag_color;
 
 f16vec4 Sample(f16sampler2D texture_sampler, vec2 texture_coords) {
-  if (supports_decal > 0.0) {
+  if (supports_decal > 0) {
     return texture(texture_sampler, texture_coords);
   }
   return IPHalfSampleDecal(texture_sampler, texture_coords);
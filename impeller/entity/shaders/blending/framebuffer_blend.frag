@@ -33,7 +33,7 @@ in vec2 v_src_texture_coords;
 out vec4 frag_color;
 
 vec4 Sample(sampler2D texture_sampler, vec2 texture_coords) {
-  if (supports_decal > 1) {
+  if (supports_decal > 0) {
     return texture(texture_sampler, texture_coords);
   }
   return IPSampleDecal(texture_sampler, texture_coords);
@@ -0,0 +1,44 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+precision mediump float;
+
+#include <impeller/types.glsl>
+
+uniform f16sampler2D glyph_atlas_sampler;
+
+in highp vec2 v_uv;
+in highp vec4 v_uv_bounds;
+in highp vec2 v_blur_step;
+
+IMPELLER_MAYBE_FLAT in f16vec4 v_text_color;
+
+out f16vec4 frag_color;
+
+// Samples the glyph's coverage, treating anything outside of the glyph's own
+// atlas rectangle as transparent so that the kernel never reads adjacent
+// glyphs.
+float SampleGlyph(vec2 uv) {
+  if (any(lessThan(uv, v_uv_bounds.xy)) ||
+      any(greaterThan(uv, v_uv_bounds.zw))) {
+    return 0.0;
+  }
+  return float(texture(glyph_atlas_sampler, uv).a);
+}
+
+void main() {
+  // A 5x5 binomial kernel with taps spaced one standard deviation apart.
+  // This is a coarse approximation of a gaussian that is cheap enough to run
+  // per fragment; the canvas only routes small shadow sigmas to this shader.
+  const float kWeights[5] = float[](1.0, 4.0, 6.0, 4.0, 1.0);
+
+  float total = 0.0;
+  for (int i = 0; i < 5; i++) {
+    for (int j = 0; j < 5; j++) {
+      vec2 uv = v_uv + vec2(float(i - 2), float(j - 2)) * v_blur_step;
+      total += kWeights[i] * kWeights[j] * SampleGlyph(uv);
+    }
+  }
+  frag_color = float16_t(total / 256.0) * v_text_color;
+}
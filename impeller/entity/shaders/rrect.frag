@@ -0,0 +1,42 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+precision highp float;
+
+#include <impeller/types.glsl>
+
+uniform FragInfo {
+  f16vec4 color;
+  vec2 rect_size;
+  float corner_radius;
+  float stroke_half_width;
+  float pixel_scale;
+}
+frag_info;
+
+in vec2 v_position;
+
+out f16vec4 frag_color;
+
+float RRectDistance(vec2 sample_position, vec2 half_size) {
+  vec2 space = abs(sample_position) - half_size + frag_info.corner_radius;
+  return length(max(space, 0.0)) + min(max(space.x, space.y), 0.0) -
+         frag_info.corner_radius;
+}
+
+void main() {
+  vec2 half_size = frag_info.rect_size * 0.5;
+  vec2 sample_position = v_position - half_size;
+
+  float dist = RRectDistance(sample_position, half_size);
+  if (frag_info.stroke_half_width >= 0.0) {
+    // Strokes are a band of the distance field centered on the boundary.
+    dist = abs(dist) - frag_info.stroke_half_width;
+  }
+
+  // One physical pixel of linear anti-aliasing along the boundary.
+  float16_t coverage =
+      float16_t(clamp(0.5 - dist * frag_info.pixel_scale, 0.0, 1.0));
+  frag_color = frag_info.color * coverage;
+}
@@ -0,0 +1,47 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <impeller/conversions.glsl>
+#include <impeller/types.glsl>
+
+// Instanced variant of texture_fill.vert used for atlas draws. Each instance
+// renders one sprite: the unit quad in the vertex buffer is scaled to the
+// sprite's sample rect size and transformed by the sprite's matrix here
+// instead of being expanded into six pretransformed vertices on the CPU.
+
+struct Sprite {
+  mat4 transform;
+  // The sprite's sample rect in texel space, packed as x, y, width, height.
+  vec4 sample_rect;
+};
+
+layout(std140) readonly buffer SpriteInfo {
+  Sprite sprites[];
+}
+sprite_info;
+
+uniform FrameInfo {
+  mat4 mvp;
+  vec2 texture_size;
+  float texture_sampler_y_coord_scale;
+  float16_t alpha;
+}
+frame_info;
+
+// A corner of the unit quad; one of (0,0), (1,0), (0,1), or (1,1).
+in vec2 unit_position;
+
+out vec2 v_texture_coords;
+IMPELLER_MAYBE_FLAT out float16_t v_alpha;
+
+void main() {
+  Sprite sprite = sprite_info.sprites[gl_InstanceIndex];
+  vec2 sprite_position = unit_position * sprite.sample_rect.zw;
+  gl_Position =
+      frame_info.mvp * sprite.transform * vec4(sprite_position, 0.0, 1.0);
+  v_alpha = frame_info.alpha;
+  v_texture_coords = IPRemapCoords(
+      (sprite.sample_rect.xy + sprite_position) / frame_info.texture_size,
+      frame_info.texture_sampler_y_coord_scale);
+}
@@ -10,11 +10,21 @@
 #include <sstream>
 #include <type_traits>
 
+#include "flutter/fml/build_config.h"
 #include "impeller/base/strings.h"
 #include "impeller/geometry/constants.h"
 #include "impeller/geometry/scalar.h"
 #include "impeller/geometry/vector.h"
 
+#if defined(FML_ARCH_CPU_ARM_FAMILY) && defined(__ARM_NEON)
+#define IMPELLER_GEOMETRY_HAS_NEON 1
+#include <arm_neon.h>
+#elif defined(FML_ARCH_CPU_X86_FAMILY)
+// SSE2 is baseline for every x86 target the engine builds for.
+#define IMPELLER_GEOMETRY_HAS_SSE 1
+#include <emmintrin.h>
+#endif
+
 namespace impeller {
 
 #define _IMPELLER_ASSERT_BLEND_MODE(blend_mode)                            \
@@ -395,6 +405,130 @@ Color Color::SRGBToLinear() const {
   return Color(conversion(red), conversion(green), conversion(blue), alpha);
 }
 
+// The batch kernels below process one color per four-wide float lane set. A
+// `Color` is four tightly packed `Scalar`s, which allows whole colors to be
+// loaded and stored directly.
+static_assert(sizeof(Color) == 4 * sizeof(Scalar));
+
+void Color::UnpackARGB(const uint32_t argb[], size_t count, Color colors[]) {
+  size_t i = 0;
+#if defined(IMPELLER_GEOMETRY_HAS_NEON)
+  const float32x4_t scale = vdupq_n_f32(1.0f / 255.0f);
+  const uint32x4_t mask = vdupq_n_u32(0xFF);
+  for (; i + 4 <= count; i += 4) {
+    const uint32x4_t packed = vld1q_u32(argb + i);
+    float32x4x4_t rgba;
+    rgba.val[0] = vmulq_f32(
+        vcvtq_f32_u32(vandq_u32(vshrq_n_u32(packed, 16), mask)), scale);
+    rgba.val[1] = vmulq_f32(
+        vcvtq_f32_u32(vandq_u32(vshrq_n_u32(packed, 8), mask)), scale);
+    rgba.val[2] = vmulq_f32(vcvtq_f32_u32(vandq_u32(packed, mask)), scale);
+    rgba.val[3] = vmulq_f32(vcvtq_f32_u32(vshrq_n_u32(packed, 24)), scale);
+    vst4q_f32(reinterpret_cast<float*>(colors + i), rgba);
+  }
+#elif defined(IMPELLER_GEOMETRY_HAS_SSE)
+  const __m128 scale = _mm_set1_ps(1.0f / 255.0f);
+  const __m128i zero = _mm_setzero_si128();
+  for (; i < count; i++) {
+    // Expand the little endian {B, G, R, A} bytes into 32-bit lanes and
+    // shuffle them into RGBA order.
+    __m128i packed = _mm_cvtsi32_si128(static_cast<int32_t>(argb[i]));
+    packed = _mm_unpacklo_epi16(_mm_unpacklo_epi8(packed, zero), zero);
+    __m128 channels = _mm_mul_ps(_mm_cvtepi32_ps(packed), scale);
+    channels = _mm_shuffle_ps(channels, channels, _MM_SHUFFLE(3, 0, 1, 2));
+    _mm_storeu_ps(reinterpret_cast<float*>(colors + i), channels);
+  }
+#endif
+  constexpr Scalar scalar_scale = 1.0f / 255.0f;
+  for (; i < count; i++) {
+    const uint32_t packed = argb[i];
+    colors[i] = Color(((packed >> 16) & 0xFF) * scalar_scale,  //
+                      ((packed >> 8) & 0xFF) * scalar_scale,   //
+                      (packed & 0xFF) * scalar_scale,          //
+                      (packed >> 24) * scalar_scale);
+  }
+}
+
+void Color::PremultiplyInPlace(Color colors[], size_t count) {
+  size_t i = 0;
+#if defined(IMPELLER_GEOMETRY_HAS_NEON)
+  for (; i < count; i++) {
+    float* channels = reinterpret_cast<float*>(colors + i);
+    const float32x4_t color = vld1q_f32(channels);
+    float32x4_t alpha = vdupq_lane_f32(vget_high_f32(color), 1);
+    alpha = vsetq_lane_f32(1.0f, alpha, 3);
+    vst1q_f32(channels, vmulq_f32(color, alpha));
+  }
+#elif defined(IMPELLER_GEOMETRY_HAS_SSE)
+  for (; i < count; i++) {
+    float* channels = reinterpret_cast<float*>(colors + i);
+    const float alpha = channels[3];
+    const __m128 color = _mm_loadu_ps(channels);
+    _mm_storeu_ps(channels,
+                  _mm_mul_ps(color, _mm_shuffle_ps(color, color, 0xFF)));
+    // The lane product above squared the alpha channel; restore it.
+    channels[3] = alpha;
+  }
+#endif
+  for (; i < count; i++) {
+    colors[i] = colors[i].Premultiply();
+  }
+}
+
+void Color::ToR8G8B8A8(const Color colors[], size_t count, uint8_t bytes[]) {
+  size_t i = 0;
+#if defined(IMPELLER_GEOMETRY_HAS_NEON)
+  const float* channels = reinterpret_cast<const float*>(colors);
+  const float32x4_t scale = vdupq_n_f32(255.0f);
+  const float32x4_t half = vdupq_n_f32(0.5f);
+  for (; i + 4 <= count; i += 4) {
+    // Round each channel to the nearest byte value, saturating out of range
+    // channels while narrowing.
+    const uint32x4_t c0 =
+        vcvtq_u32_f32(vmlaq_f32(half, vld1q_f32(channels + i * 4 + 0), scale));
+    const uint32x4_t c1 =
+        vcvtq_u32_f32(vmlaq_f32(half, vld1q_f32(channels + i * 4 + 4), scale));
+    const uint32x4_t c2 =
+        vcvtq_u32_f32(vmlaq_f32(half, vld1q_f32(channels + i * 4 + 8), scale));
+    const uint32x4_t c3 =
+        vcvtq_u32_f32(vmlaq_f32(half, vld1q_f32(channels + i * 4 + 12), scale));
+    const uint16x8_t lo = vcombine_u16(vqmovn_u32(c0), vqmovn_u32(c1));
+    const uint16x8_t hi = vcombine_u16(vqmovn_u32(c2), vqmovn_u32(c3));
+    vst1q_u8(bytes + i * 4, vcombine_u8(vqmovn_u16(lo), vqmovn_u16(hi)));
+  }
+#elif defined(IMPELLER_GEOMETRY_HAS_SSE)
+  const float* channels = reinterpret_cast<const float*>(colors);
+  const __m128 scale = _mm_set1_ps(255.0f);
+  const __m128 half = _mm_set1_ps(0.5f);
+  for (; i + 4 <= count; i += 4) {
+    // Round each channel to the nearest byte value, saturating out of range
+    // channels while packing.
+    const __m128i c0 = _mm_cvttps_epi32(
+        _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(channels + i * 4 + 0), scale),
+                   half));
+    const __m128i c1 = _mm_cvttps_epi32(
+        _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(channels + i * 4 + 4), scale),
+                   half));
+    const __m128i c2 = _mm_cvttps_epi32(
+        _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(channels + i * 4 + 8), scale),
+                   half));
+    const __m128i c3 = _mm_cvttps_epi32(
+        _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(channels + i * 4 + 12), scale),
+                   half));
+    const __m128i packed =
+        _mm_packus_epi16(_mm_packs_epi32(c0, c1), _mm_packs_epi32(c2, c3));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes + i * 4), packed);
+  }
+#endif
+  for (; i < count; i++) {
+    const auto converted = colors[i].Clamp01().ToR8G8B8A8();
+    bytes[i * 4 + 0] = converted[0];
+    bytes[i * 4 + 1] = converted[1];
+    bytes[i * 4 + 2] = converted[2];
+    bytes[i * 4 + 3] = converted[3];
+  }
+}
+
 std::string ColorToString(const Color& color) {
   return SPrintF("R=%.1f,G=%.1f,B=%.1f,A=%.1f",  //
                  color.red,                      //
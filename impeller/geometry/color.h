@@ -876,6 +876,23 @@ struct Color {
   ///        premultipled, the conversion output will be incorrect.
   Color SRGBToLinear() const;
 
+  /// @brief Unpack a list of packed 32-bit ARGB colors (8 bits per channel,
+  ///        alpha in the most significant byte) into normalized colors.
+  ///
+  ///        `colors` must have capacity for `count` entries. The conversion
+  ///        is vectorized where the target architecture allows.
+  static void UnpackARGB(const uint32_t argb[], size_t count, Color colors[]);
+
+  /// @brief Premultiply a list of colors in place.
+  static void PremultiplyInPlace(Color colors[], size_t count);
+
+  /// @brief Convert a list of colors to their R8G8B8A8 representations,
+  ///        writing four bytes per color. Channels are saturated to the
+  ///        0 to 255 range.
+  ///
+  ///        `bytes` must have capacity for `count * 4` bytes.
+  static void ToR8G8B8A8(const Color colors[], size_t count, uint8_t bytes[]);
+
   constexpr bool IsTransparent() const { return alpha == 0.0f; }
 
   constexpr bool IsOpaque() const { return alpha == 1.0f; }
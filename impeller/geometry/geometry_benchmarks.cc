@@ -4,8 +4,10 @@
 
 #include "flutter/benchmarking/benchmarking.h"
 
+#include "impeller/geometry/matrix.h"
 #include "impeller/geometry/path.h"
 #include "impeller/geometry/path_builder.h"
+#include "impeller/geometry/rect.h"
 #include "impeller/tessellator/tessellator.h"
 
 namespace impeller {
@@ -67,6 +69,25 @@ BENCHMARK_CAPTURE(BM_Polyline, cubic_polyline_tess, CreateCubic(), true);
 BENCHMARK_CAPTURE(BM_Polyline, quad_polyline, CreateQuadratic(), false);
 BENCHMARK_CAPTURE(BM_Polyline, quad_polyline_tess, CreateQuadratic(), true);
 
+static void BM_MatrixMultiply(benchmark::State& state) {
+  Matrix a = Matrix::MakeRotationZ(Radians{0.5f}).Translate({10, 20, 0});
+  Matrix b = Matrix::MakeRotationZ(Radians{0.01f});
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(a * b);
+  }
+}
+BENCHMARK(BM_MatrixMultiply);
+
+static void BM_RectTransformBounds(benchmark::State& state) {
+  Rect rect = Rect::MakeLTRB(0, 0, 100, 100);
+  Matrix transform =
+      Matrix::MakeRotationZ(Radians{0.3f}).Translate({10, 20, 0});
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(rect.TransformBounds(transform));
+  }
+}
+BENCHMARK(BM_RectTransformBounds);
+
 namespace {
 Path CreateCubic() {
   return PathBuilder{}
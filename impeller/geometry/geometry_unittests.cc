@@ -1430,6 +1430,57 @@ TEST(GeometryTest, ColorR8G8B8A8) {
   }
 }
 
+TEST(GeometryTest, ColorBatchConversions) {
+  // Use a count that isn't a multiple of the vector width so that both the
+  // vectorized kernels and their scalar tails are exercised.
+  {
+    std::vector<uint32_t> argb = {0xFF000000, 0x80FF0000, 0x4000FF00,
+                                  0x200000FF, 0xFFFFFFFF, 0x00000000,
+                                  0xFF336699};
+    std::vector<Color> colors(argb.size());
+    Color::UnpackARGB(argb.data(), argb.size(), colors.data());
+    for (size_t i = 0; i < argb.size(); i++) {
+      Color expected(((argb[i] >> 16) & 0xFF) / 255.0f,  //
+                     ((argb[i] >> 8) & 0xFF) / 255.0f,   //
+                     (argb[i] & 0xFF) / 255.0f,          //
+                     (argb[i] >> 24) / 255.0f);
+      ASSERT_COLOR_NEAR(colors[i], expected);
+    }
+  }
+
+  {
+    std::vector<Color> colors = {
+        Color(1.0, 0.5, 0.2, 0.5),  Color(1.0, 1.0, 1.0, 1.0),
+        Color(0.2, 0.4, 0.6, 0.0),  Color(0.1, 0.2, 0.3, 0.25),
+        Color(0.9, 0.8, 0.7, 0.75),
+    };
+    std::vector<Color> expected;
+    for (const auto& color : colors) {
+      expected.push_back(color.Premultiply());
+    }
+    Color::PremultiplyInPlace(colors.data(), colors.size());
+    for (size_t i = 0; i < colors.size(); i++) {
+      ASSERT_COLOR_NEAR(colors[i], expected[i]);
+    }
+  }
+
+  {
+    std::vector<Color> colors = {
+        Color(1.0, 0.5, 0.2, 0.5), Color(0.0, 0.0, 0.0, 0.0),
+        Color(1.0, 1.0, 1.0, 1.0), Color(0.25, 0.5, 0.75, 1.0),
+        Color(0.4, 0.3, 0.2, 0.1),
+    };
+    std::vector<uint8_t> bytes(colors.size() * 4);
+    Color::ToR8G8B8A8(colors.data(), colors.size(), bytes.data());
+    for (size_t i = 0; i < colors.size(); i++) {
+      auto expected = colors[i].ToR8G8B8A8();
+      for (size_t channel = 0; channel < 4; channel++) {
+        ASSERT_NEAR(bytes[i * 4 + channel], expected[channel], 1);
+      }
+    }
+  }
+}
+
 TEST(GeometryTest, ColorLerp) {
   {
     Color a(0.0, 0.0, 0.0, 0.0);
@@ -2196,6 +2247,59 @@ TEST(GeometryTest, PathBuilderSetsCorrectContourPropertiesForAddCommands) {
   }
 }
 
+TEST(GeometryTest, PathBuilderDetectsConvexity) {
+  // Rects, ovals, and rounded rects are detected without an explicit
+  // SetConvexity call.
+  ASSERT_TRUE(PathBuilder{}
+                  .AddRect(Rect::MakeXYWH(0, 0, 100, 100))
+                  .TakePath()
+                  .IsConvex());
+  ASSERT_TRUE(PathBuilder{}.AddCircle({100, 100}, 50).TakePath().IsConvex());
+  ASSERT_TRUE(PathBuilder{}
+                  .AddRoundedRect(Rect::MakeXYWH(0, 0, 100, 100), 10)
+                  .TakePath()
+                  .IsConvex());
+
+  // The fill of an open contour is its implicit closure, which for a
+  // triangle is convex.
+  ASSERT_TRUE(PathBuilder{}
+                  .MoveTo({0, 0})
+                  .LineTo({100, 0})
+                  .LineTo({50, 100})
+                  .TakePath()
+                  .IsConvex());
+
+  // A reflex vertex is detected.
+  ASSERT_FALSE(PathBuilder{}
+                   .MoveTo({0, 0})
+                   .LineTo({100, 0})
+                   .LineTo({50, 50})
+                   .LineTo({100, 100})
+                   .LineTo({0, 100})
+                   .Close()
+                   .TakePath()
+                   .IsConvex());
+
+  // Multiple filled contours are never treated as convex.
+  ASSERT_FALSE(PathBuilder{}
+                   .AddRect(Rect::MakeXYWH(0, 0, 10, 10))
+                   .AddRect(Rect::MakeXYWH(20, 0, 10, 10))
+                   .TakePath()
+                   .IsConvex());
+
+  // An explicit convexity override is preserved.
+  ASSERT_TRUE(PathBuilder{}
+                  .MoveTo({0, 0})
+                  .LineTo({100, 0})
+                  .LineTo({50, 50})
+                  .LineTo({100, 100})
+                  .LineTo({0, 100})
+                  .Close()
+                  .SetConvexity(Convexity::kConvex)
+                  .TakePath()
+                  .IsConvex());
+}
+
 TEST(GeometryTest, PathCreatePolylineGeneratesCorrectContourData) {
   Path::Polyline polyline = PathBuilder{}
                                 .AddLine({100, 100}, {200, 100})
@@ -2303,6 +2407,45 @@ TEST(GeometryTest, PolylineFailsWithNullptrBuffer) {
                             "");
 }
 
+TEST(GeometryTest, PolylineCachedFlatteningIsStable) {
+  Path path = PathBuilder{}
+                  .MoveTo({10, 10})
+                  .CubicCurveTo({20, 80}, {80, 20}, {90, 90})
+                  .TakePath();
+
+  auto first = path.CreatePolyline(1.0f);
+  auto second = path.CreatePolyline(1.0f);
+  ASSERT_EQ(*first.points, *second.points);
+  ASSERT_EQ(first.contours.size(), second.contours.size());
+
+  // Scales within the same power-of-two bucket share a flattening result.
+  auto bucketed = path.CreatePolyline(0.9f);
+  ASSERT_EQ(*first.points, *bucketed.points);
+
+  // A different bucket produces a denser flattening.
+  auto finer = path.CreatePolyline(4.0f);
+  ASSERT_GT(finer.points->size(), first.points->size());
+}
+
+TEST(GeometryTest, PathGenerationIDChangesWithGeometry) {
+  PathBuilder builder;
+  builder.MoveTo({10, 10}).LineTo({100, 100});
+  Path path = builder.CopyPath();
+
+  // Copies of a path share a generation.
+  Path copy = path;
+  ASSERT_EQ(copy.GetGenerationID(), path.GetGenerationID());
+
+  // Mutating the builder's path produces a new generation.
+  builder.LineTo({200, 100});
+  Path mutated = builder.CopyPath();
+  ASSERT_NE(mutated.GetGenerationID(), path.GetGenerationID());
+
+  // Non-geometric changes do not advance the generation.
+  Path odd_fill = builder.CopyPath(FillType::kOdd);
+  ASSERT_EQ(odd_fill.GetGenerationID(), mutated.GetGenerationID());
+}
+
 TEST(GeometryTest, MatrixPrinting) {
   {
     std::stringstream stream;
@@ -9,57 +9,56 @@
 
 namespace impeller {
 
-static void AppendColor(const Color& color, GradientData* data) {
-  auto converted = color.ToR8G8B8A8();
-  data->color_bytes.push_back(converted[0]);
-  data->color_bytes.push_back(converted[1]);
-  data->color_bytes.push_back(converted[2]);
-  data->color_bytes.push_back(converted[3]);
+uint32_t CalculateGradientTextureSize(const std::vector<Color>& colors,
+                                      const std::vector<Scalar>& stops) {
+  FML_DCHECK(stops.size() == colors.size());
+
+  if (stops.size() == 2) {
+    return colors.size();
+  }
+  auto minimum_delta = 1.0;
+  for (size_t i = 1; i < stops.size(); i++) {
+    auto value = stops[i] - stops[i - 1];
+    // Smaller than kEhCloseEnough
+    if (value < 0.0001) {
+      continue;
+    }
+    if (value < minimum_delta) {
+      minimum_delta = value;
+    }
+  }
+  // Avoid creating textures that are absurdly large due to stops that are
+  // very close together.
+  // TODO(jonahwilliams): this should use a platform specific max texture
+  // size.
+  return std::min(static_cast<uint32_t>(std::round(1.0 / minimum_delta)) + 1,
+                  1024u);
 }
 
 GradientData CreateGradientBuffer(const std::vector<Color>& colors,
                                   const std::vector<Scalar>& stops) {
   FML_DCHECK(stops.size() == colors.size());
 
-  uint32_t texture_size;
-  if (stops.size() == 2) {
-    texture_size = colors.size();
-  } else {
-    auto minimum_delta = 1.0;
-    for (size_t i = 1; i < stops.size(); i++) {
-      auto value = stops[i] - stops[i - 1];
-      // Smaller than kEhCloseEnough
-      if (value < 0.0001) {
-        continue;
-      }
-      if (value < minimum_delta) {
-        minimum_delta = value;
-      }
-    }
-    // Avoid creating textures that are absurdly large due to stops that are
-    // very close together.
-    // TODO(jonahwilliams): this should use a platform specific max texture
-    // size.
-    texture_size = std::min(
-        static_cast<uint32_t>(std::round(1.0 / minimum_delta)) + 1, 1024u);
-  }
+  uint32_t texture_size = CalculateGradientTextureSize(colors, stops);
   GradientData data = {
       .color_bytes = {},
       .texture_size = texture_size,
   };
-  data.color_bytes.reserve(texture_size * 4);
+
+  // Collect the texel colors and convert them to bytes in a single
+  // vectorized batch at the end.
+  std::vector<Color> texel_colors;
+  texel_colors.reserve(texture_size);
 
   if (texture_size == colors.size() && colors.size() <= 1024) {
-    for (auto i = 0u; i < colors.size(); i++) {
-      AppendColor(colors[i], &data);
-    }
+    texel_colors = colors;
   } else {
     Color previous_color = colors[0];
     auto previous_stop = 0.0;
     auto previous_color_index = 0;
 
     // The first index is always equal to the first color, exactly.
-    AppendColor(previous_color, &data);
+    texel_colors.push_back(previous_color);
 
     for (auto i = 1u; i < texture_size - 1; i++) {
       auto scaled_i = i / (texture_size - 1.0);
@@ -67,7 +66,7 @@ GradientData CreateGradientBuffer(const std::vector<Color>& colors,
       auto next_stop = stops[previous_color_index + 1];
       // We're almost exactly equal to the next stop.
       if (ScalarNearlyEqual(scaled_i, next_stop)) {
-        AppendColor(next_color, &data);
+        texel_colors.push_back(next_color);
 
         previous_color = next_color;
         previous_stop = next_stop;
@@ -75,9 +74,7 @@ GradientData CreateGradientBuffer(const std::vector<Color>& colors,
       } else if (scaled_i < next_stop) {
         // We're still between the current stop and the next stop.
         auto t = (scaled_i - previous_stop) / (next_stop - previous_stop);
-        auto mixed_color = Color::Lerp(previous_color, next_color, t);
-
-        AppendColor(mixed_color, &data);
+        texel_colors.push_back(Color::Lerp(previous_color, next_color, t));
       } else {
         // We've slightly overshot the previous stop.
         previous_color = next_color;
@@ -87,14 +84,16 @@ GradientData CreateGradientBuffer(const std::vector<Color>& colors,
         auto next_stop = stops[previous_color_index + 1];
 
         auto t = (scaled_i - previous_stop) / (next_stop - previous_stop);
-        auto mixed_color = Color::Lerp(previous_color, next_color, t);
-
-        AppendColor(mixed_color, &data);
+        texel_colors.push_back(Color::Lerp(previous_color, next_color, t));
       }
     }
     // The last index is always equal to the last color, exactly.
-    AppendColor(colors.back(), &data);
+    texel_colors.push_back(colors.back());
   }
+
+  data.color_bytes.resize(texel_colors.size() * 4);
+  Color::ToR8G8B8A8(texel_colors.data(), texel_colors.size(),
+                    data.color_bytes.data());
   return data;
 }
 
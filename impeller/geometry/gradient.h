@@ -20,6 +20,17 @@ struct GradientData {
   uint32_t texture_size;
 };
 
+/**
+ * @brief Compute the lookup texture width required to represent the gradient
+ * described by colors and stops without visible banding.
+ *
+ * @param colors
+ * @param stops
+ * @return the texture size.
+ */
+uint32_t CalculateGradientTextureSize(const std::vector<Color>& colors,
+                                      const std::vector<Scalar>& stops);
+
 /**
  * @brief Populate a vector with the interpolated color bytes for the linear
  * gradient described by colors and stops.
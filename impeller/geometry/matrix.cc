@@ -7,6 +7,17 @@
 #include <climits>
 #include <sstream>
 
+#include "flutter/fml/build_config.h"
+
+#if defined(FML_ARCH_CPU_ARM_FAMILY) && defined(__ARM_NEON)
+#define IMPELLER_GEOMETRY_HAS_NEON 1
+#include <arm_neon.h>
+#elif defined(FML_ARCH_CPU_X86_FAMILY)
+// SSE is baseline for every x86 target the engine builds for.
+#define IMPELLER_GEOMETRY_HAS_SSE 1
+#include <xmmintrin.h>
+#endif
+
 namespace impeller {
 
 Matrix::Matrix(const MatrixDecomposition& d) : Matrix() {
@@ -85,6 +96,89 @@ Matrix::Matrix(const MatrixDecomposition& d) : Matrix() {
   }
 }
 
+Matrix Matrix::operator*(const Matrix& o) const {
+#if defined(IMPELLER_GEOMETRY_HAS_NEON)
+  Matrix result;
+  const float32x4_t a0 = vld1q_f32(m + 0);
+  const float32x4_t a1 = vld1q_f32(m + 4);
+  const float32x4_t a2 = vld1q_f32(m + 8);
+  const float32x4_t a3 = vld1q_f32(m + 12);
+  for (int i = 0; i < 4; i++) {
+    const float32x4_t b = vld1q_f32(o.m + i * 4);
+    const float32x2_t b_lo = vget_low_f32(b);
+    const float32x2_t b_hi = vget_high_f32(b);
+    float32x4_t c = vmulq_lane_f32(a0, b_lo, 0);
+    c = vmlaq_lane_f32(c, a1, b_lo, 1);
+    c = vmlaq_lane_f32(c, a2, b_hi, 0);
+    c = vmlaq_lane_f32(c, a3, b_hi, 1);
+    vst1q_f32(result.m + i * 4, c);
+  }
+  return result;
+#elif defined(IMPELLER_GEOMETRY_HAS_SSE)
+  Matrix result;
+  const __m128 a0 = _mm_loadu_ps(m + 0);
+  const __m128 a1 = _mm_loadu_ps(m + 4);
+  const __m128 a2 = _mm_loadu_ps(m + 8);
+  const __m128 a3 = _mm_loadu_ps(m + 12);
+  for (int i = 0; i < 4; i++) {
+    const __m128 b = _mm_loadu_ps(o.m + i * 4);
+    __m128 c = _mm_mul_ps(a0, _mm_shuffle_ps(b, b, 0x00));
+    c = _mm_add_ps(c, _mm_mul_ps(a1, _mm_shuffle_ps(b, b, 0x55)));
+    c = _mm_add_ps(c, _mm_mul_ps(a2, _mm_shuffle_ps(b, b, 0xAA)));
+    c = _mm_add_ps(c, _mm_mul_ps(a3, _mm_shuffle_ps(b, b, 0xFF)));
+    _mm_storeu_ps(result.m + i * 4, c);
+  }
+  return result;
+#else
+  return Multiply(o);
+#endif
+}
+
+void Matrix::TransformPoints(Point* points, size_t count) const {
+  if (HasPerspective()) {
+    for (size_t i = 0; i < count; i++) {
+      points[i] = *this * points[i];
+    }
+    return;
+  }
+
+  // Without perspective, a 2D point transforms as:
+  //   x' = x * m[0] + y * m[4] + m[12]
+  //   y' = x * m[1] + y * m[5] + m[13]
+  // The vector paths below process two interleaved (x, y) pairs per register.
+  size_t i = 0;
+#if defined(IMPELLER_GEOMETRY_HAS_NEON)
+  const float32x4_t scale = {m[0], m[5], m[0], m[5]};
+  const float32x4_t skew = {m[4], m[1], m[4], m[1]};
+  const float32x4_t translate = {m[12], m[13], m[12], m[13]};
+  auto* data = reinterpret_cast<Scalar*>(points);
+  for (; i + 2 <= count; i += 2) {
+    const float32x4_t xy = vld1q_f32(data + i * 2);
+    const float32x4_t yx = vrev64q_f32(xy);
+    float32x4_t result = vmlaq_f32(translate, xy, scale);
+    result = vmlaq_f32(result, yx, skew);
+    vst1q_f32(data + i * 2, result);
+  }
+#elif defined(IMPELLER_GEOMETRY_HAS_SSE)
+  const __m128 scale = _mm_setr_ps(m[0], m[5], m[0], m[5]);
+  const __m128 skew = _mm_setr_ps(m[4], m[1], m[4], m[1]);
+  const __m128 translate = _mm_setr_ps(m[12], m[13], m[12], m[13]);
+  auto* data = reinterpret_cast<Scalar*>(points);
+  for (; i + 2 <= count; i += 2) {
+    const __m128 xy = _mm_loadu_ps(data + i * 2);
+    const __m128 yx = _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(2, 3, 0, 1));
+    __m128 result = _mm_add_ps(translate, _mm_mul_ps(xy, scale));
+    result = _mm_add_ps(result, _mm_mul_ps(yx, skew));
+    _mm_storeu_ps(data + i * 2, result);
+  }
+#endif
+  for (; i < count; i++) {
+    const Point point = points[i];
+    points[i] = Point(point.x * m[0] + point.y * m[4] + m[12],
+                      point.x * m[1] + point.y * m[5] + m[13]);
+  }
+}
+
 Matrix Matrix::operator+(const Matrix& o) const {
   return Matrix(
       m[0] + o.m[0], m[1] + o.m[1], m[2] + o.m[2], m[3] + o.m[3],         //
@@ -391,7 +391,9 @@ struct Matrix {
 
   Matrix operator-(const Vector3& t) const { return Translate(-t); }
 
-  Matrix operator*(const Matrix& m) const { return Multiply(m); }
+  // Defined out-of-line so the hot path can use SIMD intrinsics where they
+  // are available. `Multiply` remains the portable reference implementation.
+  Matrix operator*(const Matrix& m) const;
 
   Matrix operator+(const Matrix& m) const;
 
@@ -429,6 +431,15 @@ struct Matrix {
     return result * w;
   }
 
+  //----------------------------------------------------------------------------
+  /// @brief      Transform `count` points in place by this matrix, applying
+  ///             the same perspective division as `operator*(const Point&)`.
+  ///
+  ///             Affine matrices take a vectorized fast path, making this
+  ///             significantly cheaper than transforming points one at a time.
+  ///
+  void TransformPoints(Point* points, size_t count) const;
+
   constexpr Vector4 TransformDirection(const Vector4& v) const {
     return Vector4(v.x * m[0] + v.y * m[4] + v.z * m[8],
                    v.x * m[1] + v.y * m[5] + v.z * m[9],
@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "flutter/impeller/geometry/matrix.h"
@@ -24,5 +26,28 @@ TEST(MatrixTest, Multiply) {
                                         11.0, 21.0, 0.0, 1.0)));
 }
 
+TEST(MatrixTest, TransformPointsMatchesSinglePointTransform) {
+  std::vector<Point> points = {{0, 0},  {1, 0},       {0, 1},    {10, -4},
+                               {-3, 7}, {0.5, 2.25},  {100, 100}};
+  std::vector<Matrix> matrices = {
+      Matrix(),
+      Matrix::MakeTranslation({10, 20, 0}),
+      Matrix::MakeScale({2, -3, 1}),
+      Matrix::MakeRotationZ(Radians{kPiOver4}),
+      Matrix::MakeRotationZ(Radians{kPiOver4}).Translate({5, -2, 0}),
+      // A perspective matrix exercises the per-point divide path.
+      Matrix::MakePerspective(Radians{1}, 1.0f, 1, 10) *
+          Matrix::MakeTranslation({0, 0, 5}),
+  };
+  for (const auto& matrix : matrices) {
+    // Use an odd count so the vectorized path leaves a scalar tail.
+    auto transformed = points;
+    matrix.TransformPoints(transformed.data(), transformed.size());
+    for (size_t i = 0; i < points.size(); i++) {
+      EXPECT_POINT_NEAR(transformed[i], matrix * points[i]);
+    }
+  }
+}
+
 }  // namespace testing
 }  // namespace impeller
@@ -4,6 +4,8 @@
 
 #include "impeller/geometry/path.h"
 
+#include <atomic>
+#include <cmath>
 #include <optional>
 #include <variant>
 
@@ -13,6 +15,25 @@
 
 namespace impeller {
 
+namespace {
+// Rounds a polyline scale up to the nearest power of two so that nearby
+// scales share one cache bucket. Flattening at the bucket's upper bound
+// means the cached result is never coarser than what the caller asked for.
+Scalar QuantizePolylineScale(Scalar scale) {
+  if (scale <= 0 || !std::isfinite(scale)) {
+    return scale;
+  }
+  return std::exp2(std::ceil(std::log2(scale)));
+}
+
+// Generations are never reused, so a path whose builder mutated it can never
+// collide with cached artifacts keyed by an earlier generation.
+uint64_t NextPathGeneration() {
+  static std::atomic<uint64_t> next_generation{1u};
+  return next_generation.fetch_add(1u, std::memory_order_relaxed);
+}
+}  // namespace
+
 Path::Path() {
   AddContourComponent({});
 };
@@ -55,6 +76,15 @@ FillType Path::GetFillType() const {
   return fill_;
 }
 
+uint64_t Path::GetGenerationID() const {
+  return generation_id_;
+}
+
+void Path::InvalidateGeometryCaches() {
+  polyline_cache_.reset();
+  generation_id_ = NextPathGeneration();
+}
+
 bool Path::IsConvex() const {
   return convexity_ == Convexity::kConvex;
 }
@@ -64,6 +94,7 @@ void Path::SetConvexity(Convexity value) {
 }
 
 void Path::Shift(Point shift) {
+  InvalidateGeometryCaches();
   size_t currentIndex = 0;
   for (const auto& component : components_) {
     switch (component.type) {
@@ -91,24 +122,28 @@ void Path::Shift(Point shift) {
 }
 
 Path& Path::AddLinearComponent(Point p1, Point p2) {
+  InvalidateGeometryCaches();
   linears_.emplace_back(p1, p2);
   components_.emplace_back(ComponentType::kLinear, linears_.size() - 1);
   return *this;
 }
 
 Path& Path::AddQuadraticComponent(Point p1, Point cp, Point p2) {
+  InvalidateGeometryCaches();
   quads_.emplace_back(p1, cp, p2);
   components_.emplace_back(ComponentType::kQuadratic, quads_.size() - 1);
   return *this;
 }
 
 Path& Path::AddCubicComponent(Point p1, Point cp1, Point cp2, Point p2) {
+  InvalidateGeometryCaches();
   cubics_.emplace_back(p1, cp1, cp2, p2);
   components_.emplace_back(ComponentType::kCubic, cubics_.size() - 1);
   return *this;
 }
 
 Path& Path::AddContourComponent(Point destination, bool is_closed) {
+  InvalidateGeometryCaches();
   if (components_.size() > 0 &&
       components_.back().type == ComponentType::kContour) {
     // Never insert contiguous contours.
@@ -121,6 +156,7 @@ Path& Path::AddContourComponent(Point destination, bool is_closed) {
 }
 
 void Path::SetContourClosed(bool is_closed) {
+  InvalidateGeometryCaches();
   contours_.back().is_closed = is_closed;
 }
 
@@ -239,6 +275,32 @@ Path::Polyline Path::CreatePolyline(
     Path::Polyline::ReclaimPointBufferCallback reclaim) const {
   Polyline polyline(std::move(point_buffer), std::move(reclaim));
 
+  Scalar quantized_scale = QuantizePolylineScale(scale);
+  if (!polyline_cache_) {
+    polyline_cache_ = std::make_shared<PolylineCache>();
+  }
+  for (const auto& entry : polyline_cache_->entries) {
+    if (entry.scale == quantized_scale) {
+      *polyline.points = entry.points;
+      polyline.contours = entry.contours;
+      return polyline;
+    }
+  }
+
+  FlattenIntoPolyline(polyline, quantized_scale);
+
+  if (polyline_cache_->entries.size() >= kMaxCachedPolylines) {
+    polyline_cache_->entries.erase(polyline_cache_->entries.begin());
+  }
+  polyline_cache_->entries.push_back(CachedPolyline{
+      .scale = quantized_scale,
+      .points = *polyline.points,
+      .contours = polyline.contours,
+  });
+  return polyline;
+}
+
+void Path::FlattenIntoPolyline(Polyline& polyline, Scalar scale) const {
   auto get_path_component = [this](size_t component_i) -> PathComponentVariant {
     if (component_i >= components_.size()) {
       return std::monostate{};
@@ -358,7 +420,6 @@ Path::Polyline Path::CreatePolyline(
     }
   }
   end_contour();
-  return polyline;
 }
 
 std::optional<Rect> Path::GetBoundingBox() const {
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <set>
 #include <tuple>
@@ -134,6 +136,13 @@ class Path {
 
   size_t GetComponentCount(std::optional<ComponentType> type = {}) const;
 
+  /// An identifier for the path's geometry that changes whenever the path is
+  /// mutated by its builder. Copies of a path share the same generation.
+  ///
+  /// Suitable as a cache key for artifacts derived from the path's geometry,
+  /// such as tessellation results.
+  uint64_t GetGenerationID() const;
+
   FillType GetFillType() const;
 
   bool IsConvex() const;
@@ -163,6 +172,11 @@ class Path {
   /// It is suitable to use the max basis length of the matrix used to transform
   /// the path. If the provided scale is 0, curves will revert to straight
   /// lines.
+  ///
+  /// The scale is rounded up to the nearest power of two and the flattening
+  /// result is memoized per scale bucket, so repeatedly drawing an unchanged
+  /// path (including under an animated transform) copies the cached points
+  /// instead of re-flattening every curve.
   Polyline CreatePolyline(
       Scalar scale,
       Polyline::PointBufferPtr point_buffer =
@@ -212,6 +226,31 @@ class Path {
         : type(a_type), index(a_index) {}
   };
 
+  /// The maximum number of scale buckets a path caches flattening results
+  /// for. Once full, the oldest entry is evicted.
+  static constexpr size_t kMaxCachedPolylines = 4u;
+
+  struct CachedPolyline {
+    Scalar scale;
+    std::vector<Point> points;
+    std::vector<PolylineContour> contours;
+  };
+
+  /// Flattening results memoized by `CreatePolyline`, shared by copies of
+  /// this path. Paths are externally immutable, so the cache is only detached
+  /// (never mutated in place) when `PathBuilder` changes the path's geometry.
+  struct PolylineCache {
+    std::vector<CachedPolyline> entries;
+  };
+
+  /// @brief Flatten the path's curves into `polyline` at the given scale
+  ///        without consulting the polyline cache.
+  void FlattenIntoPolyline(Polyline& polyline, Scalar scale) const;
+
+  /// @brief Called whenever `PathBuilder` changes the path's geometry to
+  ///        detach the polyline cache and advance the generation.
+  void InvalidateGeometryCaches();
+
   FillType fill_ = FillType::kNonZero;
   Convexity convexity_ = Convexity::kUnknown;
   std::vector<ComponentIndexPair> components_;
@@ -221,6 +260,8 @@ class Path {
   std::vector<ContourComponent> contours_;
 
   std::optional<Rect> computed_bounds_;
+  uint64_t generation_id_ = 0u;
+  mutable std::shared_ptr<PolylineCache> polyline_cache_;
 };
 
 }  // namespace impeller
@@ -15,13 +15,14 @@ PathBuilder::~PathBuilder() = default;
 Path PathBuilder::CopyPath(FillType fill) const {
   auto path = prototype_;
   path.SetFillType(fill);
+  path.SetConvexity(ResolveConvexity());
   return path;
 }
 
 Path PathBuilder::TakePath(FillType fill) {
   auto path = prototype_;
   path.SetFillType(fill);
-  path.SetConvexity(convexity_);
+  path.SetConvexity(ResolveConvexity());
   if (!did_compute_bounds_) {
     path.ComputeBounds();
   }
@@ -32,20 +33,20 @@ Path PathBuilder::TakePath(FillType fill) {
 PathBuilder& PathBuilder::MoveTo(Point point, bool relative) {
   current_ = relative ? current_ + point : point;
   subpath_start_ = current_;
-  prototype_.AddContourComponent(current_);
+  AddContourComponent(current_);
   return *this;
 }
 
 PathBuilder& PathBuilder::Close() {
   LineTo(subpath_start_);
-  prototype_.SetContourClosed(true);
-  prototype_.AddContourComponent(current_);
+  SetContourClosed(true);
+  AddContourComponent(current_);
   return *this;
 }
 
 PathBuilder& PathBuilder::LineTo(Point point, bool relative) {
   point = relative ? current_ + point : point;
-  prototype_.AddLinearComponent(current_, point);
+  AddLinearComponent(current_, point);
   current_ = point;
   return *this;
 }
@@ -53,7 +54,7 @@ PathBuilder& PathBuilder::LineTo(Point point, bool relative) {
 PathBuilder& PathBuilder::HorizontalLineTo(Scalar x, bool relative) {
   Point endpoint =
       relative ? Point{current_.x + x, current_.y} : Point{x, current_.y};
-  prototype_.AddLinearComponent(current_, endpoint);
+  AddLinearComponent(current_, endpoint);
   current_ = endpoint;
   return *this;
 }
@@ -61,7 +62,7 @@ PathBuilder& PathBuilder::HorizontalLineTo(Scalar x, bool relative) {
 PathBuilder& PathBuilder::VerticalLineTo(Scalar y, bool relative) {
   Point endpoint =
       relative ? Point{current_.x, current_.y + y} : Point{current_.x, y};
-  prototype_.AddLinearComponent(current_, endpoint);
+  AddLinearComponent(current_, endpoint);
   current_ = endpoint;
   return *this;
 }
@@ -71,7 +72,7 @@ PathBuilder& PathBuilder::QuadraticCurveTo(Point controlPoint,
                                            bool relative) {
   point = relative ? current_ + point : point;
   controlPoint = relative ? current_ + controlPoint : controlPoint;
-  prototype_.AddQuadraticComponent(current_, controlPoint, point);
+  AddQuadraticComponent(current_, controlPoint, point);
   current_ = point;
   return *this;
 }
@@ -88,14 +89,14 @@ PathBuilder& PathBuilder::CubicCurveTo(Point controlPoint1,
   controlPoint1 = relative ? current_ + controlPoint1 : controlPoint1;
   controlPoint2 = relative ? current_ + controlPoint2 : controlPoint2;
   point = relative ? current_ + point : point;
-  prototype_.AddCubicComponent(current_, controlPoint1, controlPoint2, point);
+  AddCubicComponent(current_, controlPoint1, controlPoint2, point);
   current_ = point;
   return *this;
 }
 
 PathBuilder& PathBuilder::AddQuadraticCurve(Point p1, Point cp, Point p2) {
   MoveTo(p1);
-  prototype_.AddQuadraticComponent(p1, cp, p2);
+  AddQuadraticComponent(p1, cp, p2);
   return *this;
 }
 
@@ -104,7 +105,7 @@ PathBuilder& PathBuilder::AddCubicCurve(Point p1,
                                         Point cp2,
                                         Point p2) {
   MoveTo(p1);
-  prototype_.AddCubicComponent(p1, cp1, cp2, p2);
+  AddCubicComponent(p1, cp1, cp2, p2);
   return *this;
 }
 
@@ -152,7 +153,7 @@ PathBuilder& PathBuilder::AddRoundedRect(Rect rect, RoundingRadii radii) {
   //----------------------------------------------------------------------------
   // Top line.
   //
-  prototype_.AddLinearComponent(
+  AddLinearComponent(
       {rect.origin.x + radii.top_left.x, rect.origin.y},
       {rect.origin.x + rect.size.width - radii.top_right.x, rect.origin.y});
 
@@ -164,7 +165,7 @@ PathBuilder& PathBuilder::AddRoundedRect(Rect rect, RoundingRadii radii) {
   //----------------------------------------------------------------------------
   // Right line.
   //
-  prototype_.AddLinearComponent(
+  AddLinearComponent(
       {rect.origin.x + rect.size.width, rect.origin.y + radii.top_right.y},
       {rect.origin.x + rect.size.width,
        rect.origin.y + rect.size.height - radii.bottom_right.y});
@@ -177,7 +178,7 @@ PathBuilder& PathBuilder::AddRoundedRect(Rect rect, RoundingRadii radii) {
   //----------------------------------------------------------------------------
   // Bottom line.
   //
-  prototype_.AddLinearComponent(
+  AddLinearComponent(
       {rect.origin.x + rect.size.width - radii.bottom_right.x,
        rect.origin.y + rect.size.height},
       {rect.origin.x + radii.bottom_left.x, rect.origin.y + rect.size.height});
@@ -190,7 +191,7 @@ PathBuilder& PathBuilder::AddRoundedRect(Rect rect, RoundingRadii radii) {
   //----------------------------------------------------------------------------
   // Left line.
   //
-  prototype_.AddLinearComponent(
+  AddLinearComponent(
       {rect.origin.x, rect.origin.y + rect.size.height - radii.bottom_left.y},
       {rect.origin.x, rect.origin.y + radii.top_left.y});
 
@@ -207,7 +208,7 @@ PathBuilder& PathBuilder::AddRoundedRect(Rect rect, RoundingRadii radii) {
 PathBuilder& PathBuilder::AddRoundedRectTopLeft(Rect rect,
                                                 RoundingRadii radii) {
   const auto magic_top_left = radii.top_left * kArcApproximationMagic;
-  prototype_.AddCubicComponent(
+  AddCubicComponent(
       {rect.origin.x, rect.origin.y + radii.top_left.y},
       {rect.origin.x, rect.origin.y + radii.top_left.y - magic_top_left.y},
       {rect.origin.x + radii.top_left.x - magic_top_left.x, rect.origin.y},
@@ -218,7 +219,7 @@ PathBuilder& PathBuilder::AddRoundedRectTopLeft(Rect rect,
 PathBuilder& PathBuilder::AddRoundedRectTopRight(Rect rect,
                                                  RoundingRadii radii) {
   const auto magic_top_right = radii.top_right * kArcApproximationMagic;
-  prototype_.AddCubicComponent(
+  AddCubicComponent(
       {rect.origin.x + rect.size.width - radii.top_right.x, rect.origin.y},
       {rect.origin.x + rect.size.width - radii.top_right.x + magic_top_right.x,
        rect.origin.y},
@@ -231,7 +232,7 @@ PathBuilder& PathBuilder::AddRoundedRectTopRight(Rect rect,
 PathBuilder& PathBuilder::AddRoundedRectBottomRight(Rect rect,
                                                     RoundingRadii radii) {
   const auto magic_bottom_right = radii.bottom_right * kArcApproximationMagic;
-  prototype_.AddCubicComponent(
+  AddCubicComponent(
       {rect.origin.x + rect.size.width,
        rect.origin.y + rect.size.height - radii.bottom_right.y},
       {rect.origin.x + rect.size.width, rect.origin.y + rect.size.height -
@@ -248,7 +249,7 @@ PathBuilder& PathBuilder::AddRoundedRectBottomRight(Rect rect,
 PathBuilder& PathBuilder::AddRoundedRectBottomLeft(Rect rect,
                                                    RoundingRadii radii) {
   const auto magic_bottom_left = radii.bottom_left * kArcApproximationMagic;
-  prototype_.AddCubicComponent(
+  AddCubicComponent(
       {rect.origin.x + radii.bottom_left.x, rect.origin.y + rect.size.height},
       {rect.origin.x + radii.bottom_left.x - magic_bottom_left.x,
        rect.origin.y + rect.size.height},
@@ -303,7 +304,7 @@ PathBuilder& PathBuilder::AddArc(const Rect& oval_bounds,
     Point cp1 = p1 + Vector2(-p1_unit.y, p1_unit.x) * arc_cp_lengths;
     Point cp2 = p2 + Vector2(p2_unit.y, -p2_unit.x) * arc_cp_lengths;
 
-    prototype_.AddCubicComponent(p1, cp1, cp2, p2);
+    AddCubicComponent(p1, cp1, cp2, p2);
     current_ = p2;
 
     start.radians += quadrant_angle;
@@ -328,37 +329,37 @@ PathBuilder& PathBuilder::AddOval(const Rect& container) {
   //----------------------------------------------------------------------------
   // Top right arc.
   //
-  prototype_.AddCubicComponent({c.x, c.y - r.y},        // p1
-                               {c.x + m.x, c.y - r.y},  // cp1
-                               {c.x + r.x, c.y - m.y},  // cp2
-                               {c.x + r.x, c.y}         // p2
+  AddCubicComponent({c.x, c.y - r.y},        // p1
+                    {c.x + m.x, c.y - r.y},  // cp1
+                    {c.x + r.x, c.y - m.y},  // cp2
+                    {c.x + r.x, c.y}         // p2
   );
 
   //----------------------------------------------------------------------------
   // Bottom right arc.
   //
-  prototype_.AddCubicComponent({c.x + r.x, c.y},        // p1
-                               {c.x + r.x, c.y + m.y},  // cp1
-                               {c.x + m.x, c.y + r.y},  // cp2
-                               {c.x, c.y + r.y}         // p2
+  AddCubicComponent({c.x + r.x, c.y},        // p1
+                    {c.x + r.x, c.y + m.y},  // cp1
+                    {c.x + m.x, c.y + r.y},  // cp2
+                    {c.x, c.y + r.y}         // p2
   );
 
   //----------------------------------------------------------------------------
   // Bottom left arc.
   //
-  prototype_.AddCubicComponent({c.x, c.y + r.y},        // p1
-                               {c.x - m.x, c.y + r.y},  // cp1
-                               {c.x - r.x, c.y + m.y},  // cp2
-                               {c.x - r.x, c.y}         // p2
+  AddCubicComponent({c.x, c.y + r.y},        // p1
+                    {c.x - m.x, c.y + r.y},  // cp1
+                    {c.x - r.x, c.y + m.y},  // cp2
+                    {c.x - r.x, c.y}         // p2
   );
 
   //----------------------------------------------------------------------------
   // Top left arc.
   //
-  prototype_.AddCubicComponent({c.x - r.x, c.y},        // p1
-                               {c.x - r.x, c.y - m.y},  // cp1
-                               {c.x - m.x, c.y - r.y},  // cp2
-                               {c.x, c.y - r.y}         // p2
+  AddCubicComponent({c.x - r.x, c.y},        // p1
+                    {c.x - r.x, c.y - m.y},  // cp1
+                    {c.x - m.x, c.y - r.y},  // cp2
+                    {c.x, c.y - r.y}         // p2
   );
 
   Close();
@@ -368,7 +369,7 @@ PathBuilder& PathBuilder::AddOval(const Rect& container) {
 
 PathBuilder& PathBuilder::AddLine(const Point& p1, const Point& p2) {
   MoveTo(p1);
-  prototype_.AddLinearComponent(p1, p2);
+  AddLinearComponent(p1, p2);
   return *this;
 }
 
@@ -378,16 +379,16 @@ const Path& PathBuilder::GetCurrentPath() const {
 
 PathBuilder& PathBuilder::AddPath(const Path& path) {
   auto linear = [&](size_t index, const LinearPathComponent& l) {
-    prototype_.AddLinearComponent(l.p1, l.p2);
+    AddLinearComponent(l.p1, l.p2);
   };
   auto quadratic = [&](size_t index, const QuadraticPathComponent& q) {
-    prototype_.AddQuadraticComponent(q.p1, q.cp, q.p2);
+    AddQuadraticComponent(q.p1, q.cp, q.p2);
   };
   auto cubic = [&](size_t index, const CubicPathComponent& c) {
-    prototype_.AddCubicComponent(c.p1, c.cp1, c.cp2, c.p2);
+    AddCubicComponent(c.p1, c.cp1, c.cp2, c.p2);
   };
   auto move = [&](size_t index, const ContourComponent& m) {
-    prototype_.AddContourComponent(m.destination);
+    AddContourComponent(m.destination);
   };
   path.EnumerateComponents(linear, quadratic, cubic, move);
   return *this;
@@ -395,6 +396,7 @@ PathBuilder& PathBuilder::AddPath(const Path& path) {
 
 PathBuilder& PathBuilder::Shift(Point offset) {
   prototype_.Shift(offset);
+  convexity_detector_.Shift(offset);
   return *this;
 }
 
@@ -404,4 +406,163 @@ PathBuilder& PathBuilder::SetBounds(Rect bounds) {
   return *this;
 }
 
+Convexity PathBuilder::ResolveConvexity() const {
+  // An explicit override always wins so that callers converting paths from
+  // sources with their own convexity analysis keep their answer.
+  if (convexity_ == Convexity::kConvex) {
+    return Convexity::kConvex;
+  }
+  return convexity_detector_.IsConvex() ? Convexity::kConvex
+                                        : Convexity::kUnknown;
+}
+
+void PathBuilder::AddContourComponent(const Point& destination) {
+  prototype_.AddContourComponent(destination);
+  convexity_detector_.MoveTo(destination);
+}
+
+void PathBuilder::SetContourClosed(bool is_closed) {
+  prototype_.SetContourClosed(is_closed);
+  if (is_closed) {
+    convexity_detector_.Close();
+  }
+}
+
+void PathBuilder::AddLinearComponent(const Point& p1, const Point& p2) {
+  prototype_.AddLinearComponent(p1, p2);
+  convexity_detector_.Extend(p1);
+  convexity_detector_.Extend(p2);
+}
+
+void PathBuilder::AddQuadraticComponent(const Point& p1,
+                                        const Point& cp,
+                                        const Point& p2) {
+  prototype_.AddQuadraticComponent(p1, cp, p2);
+  convexity_detector_.Extend(p1);
+  convexity_detector_.Extend(cp);
+  convexity_detector_.Extend(p2);
+}
+
+void PathBuilder::AddCubicComponent(const Point& p1,
+                                    const Point& cp1,
+                                    const Point& cp2,
+                                    const Point& p2) {
+  prototype_.AddCubicComponent(p1, cp1, cp2, p2);
+  convexity_detector_.Extend(p1);
+  convexity_detector_.Extend(cp1);
+  convexity_detector_.Extend(cp2);
+  convexity_detector_.Extend(p2);
+}
+
+void PathBuilder::ConvexityDetector::MoveTo(const Point& point) {
+  FinishContour();
+  contour_start_ = point;
+  last_point_ = point;
+}
+
+void PathBuilder::ConvexityDetector::Extend(const Point& point) {
+  if (!is_convex_) {
+    last_point_ = point;
+    return;
+  }
+  if (contour_is_closed_) {
+    // Segments appended after a close without a move reopen the contour;
+    // give up rather than model the seam.
+    is_convex_ = false;
+    return;
+  }
+  Point direction = point - last_point_;
+  last_point_ = point;
+  if (direction.IsZero()) {
+    return;
+  }
+  if (!contour_has_direction_) {
+    if (filled_contours_ > 0u) {
+      // A second contour with segments can never fill a convex shape.
+      is_convex_ = false;
+      return;
+    }
+    contour_has_direction_ = true;
+    first_direction_ = direction;
+  } else {
+    AddTurn(last_direction_, direction);
+  }
+  // A convex traversal sweeps through at most one full revolution, so the
+  // direction along each axis may reverse at most twice.
+  int dx_sign = direction.x > 0 ? 1 : (direction.x < 0 ? -1 : 0);
+  if (dx_sign != 0) {
+    if (dx_sign_ != 0 && dx_sign != dx_sign_ && ++dx_sign_changes_ > 2) {
+      is_convex_ = false;
+    }
+    dx_sign_ = dx_sign;
+  }
+  int dy_sign = direction.y > 0 ? 1 : (direction.y < 0 ? -1 : 0);
+  if (dy_sign != 0) {
+    if (dy_sign_ != 0 && dy_sign != dy_sign_ && ++dy_sign_changes_ > 2) {
+      is_convex_ = false;
+    }
+    dy_sign_ = dy_sign;
+  }
+  last_direction_ = direction;
+}
+
+void PathBuilder::ConvexityDetector::Close() {
+  if (contour_has_direction_) {
+    AddTurn(last_direction_, first_direction_);
+  }
+  contour_is_closed_ = true;
+}
+
+void PathBuilder::ConvexityDetector::Shift(const Point& offset) {
+  contour_start_ += offset;
+  last_point_ += offset;
+}
+
+bool PathBuilder::ConvexityDetector::IsConvex() const {
+  if (!is_convex_) {
+    return false;
+  }
+  if (!contour_has_direction_ && filled_contours_ == 0u) {
+    // No geometry at all; leave empty paths unknown.
+    return false;
+  }
+  if (contour_has_direction_ && !contour_is_closed_) {
+    // The filled region of an open contour closes implicitly; check the
+    // closing edge as though Close had been called.
+    ConvexityDetector copy = *this;
+    copy.Extend(contour_start_);
+    copy.Close();
+    return copy.is_convex_;
+  }
+  return true;
+}
+
+void PathBuilder::ConvexityDetector::FinishContour() {
+  if (contour_has_direction_) {
+    filled_contours_++;
+  }
+  contour_has_direction_ = false;
+  contour_is_closed_ = false;
+  turn_direction_ = 0.0f;
+  dx_sign_ = 0;
+  dy_sign_ = 0;
+  dx_sign_changes_ = 0;
+  dy_sign_changes_ = 0;
+}
+
+void PathBuilder::ConvexityDetector::AddTurn(const Point& from,
+                                             const Point& to) {
+  Scalar cross = from.Cross(to);
+  if (cross != 0.0f) {
+    if (turn_direction_ == 0.0f) {
+      turn_direction_ = cross > 0 ? 1.0f : -1.0f;
+    } else if ((cross > 0) != (turn_direction_ > 0)) {
+      is_convex_ = false;
+    }
+  } else if (from.Dot(to) < 0) {
+    // A 180 degree reversal pinches the contour.
+    is_convex_ = false;
+  }
+}
+
 }  // namespace impeller
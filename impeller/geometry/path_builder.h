@@ -145,12 +145,75 @@ class PathBuilder {
   PathBuilder& AddPath(const Path& path);
 
  private:
+  /// @brief Incrementally tracks whether the contours added so far describe
+  ///        a convex shape.
+  ///
+  ///        Curves are judged by their control polygons: a Bezier curve is
+  ///        contained in the convex hull of its control points, so a convex
+  ///        control polygon implies a convex curve. The analysis is
+  ///        conservative and only ever errs towards reporting a convex path
+  ///        as non-convex.
+  class ConvexityDetector {
+   public:
+    /// @brief Begin a new contour at `point`.
+    void MoveTo(const Point& point);
+
+    /// @brief Extend the current contour to `point`.
+    void Extend(const Point& point);
+
+    /// @brief Mark the current contour as closed.
+    void Close();
+
+    /// @brief Translate the tracked points by `offset`.
+    void Shift(const Point& offset);
+
+    /// @brief Whether the geometry added so far is convex. Open contours
+    ///        are treated as implicitly closed, mirroring how fills treat
+    ///        them.
+    bool IsConvex() const;
+
+   private:
+    void FinishContour();
+
+    void AddTurn(const Point& from, const Point& to);
+
+    bool is_convex_ = true;
+    bool contour_has_direction_ = false;
+    bool contour_is_closed_ = false;
+    size_t filled_contours_ = 0u;
+    Point contour_start_;
+    Point last_point_;
+    Point first_direction_;
+    Point last_direction_;
+    Scalar turn_direction_ = 0.0f;
+    int dx_sign_ = 0;
+    int dy_sign_ = 0;
+    int dx_sign_changes_ = 0;
+    int dy_sign_changes_ = 0;
+  };
+
   Point subpath_start_;
   Point current_;
   Path prototype_;
-  Convexity convexity_;
+  Convexity convexity_ = Convexity::kUnknown;
+  ConvexityDetector convexity_detector_;
   bool did_compute_bounds_ = false;
 
+  Convexity ResolveConvexity() const;
+
+  void AddContourComponent(const Point& destination);
+
+  void SetContourClosed(bool is_closed);
+
+  void AddLinearComponent(const Point& p1, const Point& p2);
+
+  void AddQuadraticComponent(const Point& p1, const Point& cp, const Point& p2);
+
+  void AddCubicComponent(const Point& p1,
+                         const Point& cp1,
+                         const Point& cp2,
+                         const Point& p2);
+
   PathBuilder& AddRoundedRectTopLeft(Rect rect, RoundingRadii radii);
 
   PathBuilder& AddRoundedRectTopRight(Rect rect, RoundingRadii radii);
@@ -198,18 +198,16 @@ struct TRect {
             TPoint(right, bottom)};
   }
 
-  constexpr std::array<TPoint<T>, 4> GetTransformedPoints(
+  std::array<TPoint<T>, 4> GetTransformedPoints(
       const Matrix& transform) const {
     auto points = GetPoints();
-    for (size_t i = 0; i < points.size(); i++) {
-      points[i] = transform * points[i];
-    }
+    transform.TransformPoints(points.data(), points.size());
     return points;
   }
 
   /// @brief  Creates a new bounding box that contains this transformed
   ///         rectangle.
-  constexpr TRect TransformBounds(const Matrix& transform) const {
+  TRect TransformBounds(const Matrix& transform) const {
     auto points = GetTransformedPoints(transform);
     return TRect::MakePointBounds(points.begin(), points.end()).value();
   }
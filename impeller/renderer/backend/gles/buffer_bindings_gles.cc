@@ -177,6 +177,10 @@ bool BufferBindingsGLES::UnbindVertexAttributes(const ProcTableGLES& gl) const {
   return true;
 }
 
+void BufferBindingsGLES::DidBindProgram() {
+  bound_texture_units_.clear();
+}
+
 GLint BufferBindingsGLES::ComputeTextureLocation(
     const ShaderMetadata* metadata) {
   auto location = binding_map_.find(metadata->name);
@@ -356,36 +360,62 @@ std::optional<size_t> BufferBindingsGLES::BindTextures(
       return std::nullopt;
     }
 
-    //--------------------------------------------------------------------------
-    /// Set the active texture unit.
-    ///
     if (active_index >= gl.GetCapabilities()->GetMaxTextureUnits(stage)) {
       VALIDATION_LOG << "Texture units specified exceed the capabilities for "
                         "this shader stage.";
       return std::nullopt;
     }
-    gl.ActiveTexture(GL_TEXTURE0 + active_index);
 
-    //--------------------------------------------------------------------------
-    /// Bind the texture.
-    ///
-    if (!texture_gles.Bind()) {
-      return std::nullopt;
-    }
+    const auto texture_handle = texture_gles.GetGLHandle();
+    const Sampler* sampler = data.second.sampler.resource.get();
+    const bool unit_unchanged =
+        texture_handle.has_value() &&
+        active_index < bound_texture_units_.size() &&
+        bound_texture_units_[active_index].texture == texture_handle.value() &&
+        bound_texture_units_[active_index].sampler == sampler;
+
+    if (!unit_unchanged) {
+      //------------------------------------------------------------------------
+      /// Set the active texture unit.
+      ///
+      gl.ActiveTexture(GL_TEXTURE0 + active_index);
+
+      //------------------------------------------------------------------------
+      /// Bind the texture.
+      ///
+      if (!texture_gles.Bind()) {
+        return std::nullopt;
+      }
 
-    //--------------------------------------------------------------------------
-    /// If there is a sampler for the texture at the same index, configure the
-    /// bound texture using that sampler.
-    ///
-    const auto& sampler_gles = SamplerGLES::Cast(*data.second.sampler.resource);
-    if (!sampler_gles.ConfigureBoundTexture(texture_gles, gl)) {
-      return std::nullopt;
+      //------------------------------------------------------------------------
+      /// If there is a sampler for the texture at the same index, configure
+      /// the bound texture using that sampler.
+      ///
+      const auto& sampler_gles = SamplerGLES::Cast(*sampler);
+      if (!sampler_gles.ConfigureBoundTexture(texture_gles, gl)) {
+        return std::nullopt;
+      }
+
+      if (texture_handle.has_value()) {
+        if (active_index >= bound_texture_units_.size()) {
+          bound_texture_units_.resize(active_index + 1u);
+        }
+        bound_texture_units_[active_index] =
+            BoundTextureUnit{texture_handle.value(), sampler};
+      }
     }
 
     //--------------------------------------------------------------------------
-    /// Set the texture uniform location.
+    /// Set the texture uniform location. Uniform values persist on the
+    /// program object, so only the first assignment of a unit to this
+    /// location makes it to the driver.
     ///
-    gl.Uniform1i(location, active_index);
+    const GLint unit = static_cast<GLint>(active_index);
+    if (auto assigned = sampler_unit_uniforms_.find(location);
+        assigned == sampler_unit_uniforms_.end() || assigned->second != unit) {
+      gl.Uniform1i(location, unit);
+      sampler_unit_uniforms_[location] = unit;
+    }
 
     //--------------------------------------------------------------------------
     /// Bump up the active index at binding.
@@ -42,6 +42,14 @@ class BufferBindingsGLES {
 
   bool UnbindVertexAttributes(const ProcTableGLES& gl) const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Notifies the bindings that their program has just been bound.
+  ///             Texture unit state is global to the context and may have been
+  ///             changed by other programs, so the unit bookkeeping used to
+  ///             skip redundant binds is discarded.
+  ///
+  void DidBindProgram();
+
  private:
   //----------------------------------------------------------------------------
   /// @brief      The arguments to glVertexAttribPointer.
@@ -56,6 +64,22 @@ class BufferBindingsGLES {
   };
   std::vector<VertexAttribPointer> vertex_attrib_arrays_;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The texture/sampler pairing last bound to a texture unit
+  ///             while this program has been continuously bound. Valid only
+  ///             until the program is rebound (see |DidBindProgram|).
+  ///
+  struct BoundTextureUnit {
+    GLuint texture = 0u;
+    const Sampler* sampler = nullptr;
+  };
+  std::vector<BoundTextureUnit> bound_texture_units_;
+
+  // The texture unit last assigned to each sampler uniform location. Uniform
+  // values persist on the program object, so unlike the unit bookkeeping
+  // above this survives program rebinds.
+  std::unordered_map<GLint, GLint> sampler_unit_uniforms_;
+
   std::unordered_map<std::string, GLint> uniform_locations_;
 
   using BindingMap = std::unordered_map<std::string, std::vector<GLint>>;
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -58,6 +60,12 @@ struct HandleGLES {
  private:
   friend class ReactorGLES;
 
+  // The GL name slot shared by all copies of this handle. The reactor
+  // publishes the name once the handle becomes live (and clears it when the
+  // handle is collected) so that lookups of live handles need not acquire
+  // the reactor's handle lock.
+  std::shared_ptr<std::atomic<GLuint>> gl_name_;
+
   HandleGLES(HandleType p_type, UniqueID p_name) : type(p_type), name(p_name) {}
 
   HandleGLES(HandleType p_type, std::optional<UniqueID> p_name)
@@ -5,6 +5,7 @@
 #include "impeller/renderer/backend/gles/reactor_gles.h"
 
 #include <algorithm>
+#include <map>
 
 #include "flutter/fml/trace_event.h"
 #include "fml/logging.h"
@@ -51,6 +52,16 @@ const ProcTableGLES& ReactorGLES::GetProcTable() const {
 }
 
 std::optional<GLuint> ReactorGLES::GetGLHandle(const HandleGLES& handle) const {
+  // Fast path: once the reactor makes a handle live, its GL name is published
+  // to the slot shared by all copies of the handle and can be read without
+  // acquiring the handles lock.
+  if (handle.gl_name_) {
+    const GLuint name = handle.gl_name_->load();
+    if (name != GL_NONE) {
+      return name;
+    }
+  }
+
   ReaderLock handles_lock(handles_mutex_);
   if (auto found = handles_.find(handle); found != handles_.end()) {
     if (found->second.pending_collection) {
@@ -81,55 +92,73 @@ bool ReactorGLES::AddOperation(Operation operation) {
   return true;
 }
 
-static std::optional<GLuint> CreateGLHandle(const ProcTableGLES& gl,
-                                            HandleType type) {
-  GLuint handle = GL_NONE;
+static bool GenGLHandles(const ProcTableGLES& gl,
+                         HandleType type,
+                         GLsizei count,
+                         GLuint* handles) {
   switch (type) {
     case HandleType::kUnknown:
-      return std::nullopt;
+      return false;
     case HandleType::kTexture:
-      gl.GenTextures(1u, &handle);
-      return handle;
+      gl.GenTextures(count, handles);
+      return true;
     case HandleType::kBuffer:
-      gl.GenBuffers(1u, &handle);
-      return handle;
+      gl.GenBuffers(count, handles);
+      return true;
     case HandleType::kProgram:
-      return gl.CreateProgram();
+      // Programs have no multi-gen entrypoint.
+      for (GLsizei i = 0; i < count; i++) {
+        handles[i] = gl.CreateProgram();
+      }
+      return true;
     case HandleType::kRenderBuffer:
-      gl.GenRenderbuffers(1u, &handle);
-      return handle;
+      gl.GenRenderbuffers(count, handles);
+      return true;
     case HandleType::kFrameBuffer:
-      gl.GenFramebuffers(1u, &handle);
-      return handle;
+      gl.GenFramebuffers(count, handles);
+      return true;
   }
-  return std::nullopt;
+  return false;
 }
 
-static bool CollectGLHandle(const ProcTableGLES& gl,
+static bool DeleteGLHandles(const ProcTableGLES& gl,
                             HandleType type,
-                            GLuint handle) {
+                            GLsizei count,
+                            const GLuint* handles) {
   switch (type) {
     case HandleType::kUnknown:
       return false;
     case HandleType::kTexture:
-      gl.DeleteTextures(1u, &handle);
+      gl.DeleteTextures(count, handles);
       return true;
     case HandleType::kBuffer:
-      gl.DeleteBuffers(1u, &handle);
+      gl.DeleteBuffers(count, handles);
       return true;
     case HandleType::kProgram:
-      gl.DeleteProgram(handle);
+      // Programs have no multi-delete entrypoint.
+      for (GLsizei i = 0; i < count; i++) {
+        gl.DeleteProgram(handles[i]);
+      }
       return true;
     case HandleType::kRenderBuffer:
-      gl.DeleteRenderbuffers(1u, &handle);
+      gl.DeleteRenderbuffers(count, handles);
       return true;
     case HandleType::kFrameBuffer:
-      gl.DeleteFramebuffers(1u, &handle);
+      gl.DeleteFramebuffers(count, handles);
       return true;
   }
   return false;
 }
 
+static std::optional<GLuint> CreateGLHandle(const ProcTableGLES& gl,
+                                            HandleType type) {
+  GLuint handle = GL_NONE;
+  if (!GenGLHandles(gl, type, 1u, &handle)) {
+    return std::nullopt;
+  }
+  return handle;
+}
+
 HandleGLES ReactorGLES::CreateHandle(HandleType type) {
   if (type == HandleType::kUnknown) {
     return HandleGLES::DeadHandle();
@@ -138,10 +167,14 @@ HandleGLES ReactorGLES::CreateHandle(HandleType type) {
   if (new_handle.IsDead()) {
     return HandleGLES::DeadHandle();
   }
+  new_handle.gl_name_ = std::make_shared<std::atomic<GLuint>>(GL_NONE);
   WriterLock handles_lock(handles_mutex_);
   auto gl_handle = CanReactOnCurrentThread()
                        ? CreateGLHandle(GetProcTable(), type)
                        : std::nullopt;
+  if (gl_handle.has_value()) {
+    new_handle.gl_name_->store(gl_handle.value());
+  }
   handles_[new_handle] = LiveHandle{gl_handle};
   return new_handle;
 }
@@ -150,6 +183,11 @@ void ReactorGLES::CollectHandle(HandleGLES handle) {
   WriterLock handles_lock(handles_mutex_);
   if (auto found = handles_.find(handle); found != handles_.end()) {
     found->second.pending_collection = true;
+    // Unpublish the name so that lock-free lookups no longer resolve a
+    // handle that is about to be collected.
+    if (found->first.gl_name_) {
+      found->first.gl_name_->store(GL_NONE);
+    }
   }
 }
 
@@ -201,35 +239,59 @@ bool ReactorGLES::ConsolidateHandles() {
   const auto& gl = GetProcTable();
   WriterLock handles_lock(handles_mutex_);
   std::vector<HandleGLES> handles_to_delete;
-  for (auto& handle : handles_) {
+  // Group handle creation and collection by type so that the GL names can be
+  // generated and deleted with one multi-name call per type instead of one
+  // call per handle.
+  std::map<HandleType, std::vector<LiveHandles::iterator>> handles_to_create;
+  std::map<HandleType, std::vector<GLuint>> names_to_delete;
+  for (auto it = handles_.begin(); it != handles_.end(); it++) {
     // Collect dead handles.
-    if (handle.second.pending_collection) {
-      // This could be false if the handle was created and collected without
-      // use. We still need to get rid of map entry.
-      if (handle.second.name.has_value()) {
-        CollectGLHandle(gl, handle.first.type, handle.second.name.value());
+    if (it->second.pending_collection) {
+      // The name could be absent if the handle was created and collected
+      // without use. We still need to get rid of the map entry.
+      if (it->second.name.has_value()) {
+        names_to_delete[it->first.type].push_back(it->second.name.value());
       }
-      handles_to_delete.push_back(handle.first);
+      handles_to_delete.push_back(it->first);
       continue;
     }
-    // Create live handles.
-    if (!handle.second.name.has_value()) {
-      auto gl_handle = CreateGLHandle(gl, handle.first.type);
-      if (!gl_handle) {
-        VALIDATION_LOG << "Could not create GL handle.";
-        return false;
-      }
-      handle.second.name = gl_handle;
+    // Gather handles that need live names.
+    if (!it->second.name.has_value()) {
+      handles_to_create[it->first.type].push_back(it);
     }
-    // Set pending debug labels.
-    if (handle.second.pending_debug_label.has_value()) {
-      if (gl.SetDebugLabel(ToDebugResourceType(handle.first.type),
-                           handle.second.name.value(),
-                           handle.second.pending_debug_label.value())) {
-        handle.second.pending_debug_label = std::nullopt;
+  }
+  // Create live handles.
+  for (const auto& [type, creations] : handles_to_create) {
+    std::vector<GLuint> names(creations.size(), GL_NONE);
+    if (!GenGLHandles(gl, type, static_cast<GLsizei>(names.size()),
+                      names.data())) {
+      VALIDATION_LOG << "Could not create GL handles.";
+      return false;
+    }
+    for (size_t i = 0u; i < creations.size(); i++) {
+      creations[i]->second.name = names[i];
+      if (creations[i]->first.gl_name_) {
+        creations[i]->first.gl_name_->store(names[i]);
       }
     }
   }
+  // Set pending debug labels now that all live handles have names.
+  for (auto& handle : handles_) {
+    if (handle.second.pending_collection ||
+        !handle.second.pending_debug_label.has_value()) {
+      continue;
+    }
+    if (gl.SetDebugLabel(ToDebugResourceType(handle.first.type),
+                         handle.second.name.value(),
+                         handle.second.pending_debug_label.value())) {
+      handle.second.pending_debug_label = std::nullopt;
+    }
+  }
+  // Collect the names of the dead handles.
+  for (const auto& [type, names] : names_to_delete) {
+    DeleteGLHandles(gl, type, static_cast<GLsizei>(names.size()),
+                    names.data());
+  }
   for (const auto& handle_to_delete : handles_to_delete) {
     handles_.erase(handle_to_delete);
   }
@@ -250,6 +250,14 @@ struct RenderPassData {
 
   gl.Clear(clear_bits);
 
+  // Command lists tend to contain long runs of commands that share a pipeline
+  // (and therefore all of its fixed function state). Re-applying that state
+  // per command is one of the bigger CPU costs of the GLES backend, so the
+  // loop below only reconfigures it when the pipeline (or the stencil
+  // reference, which is set per command) actually changes.
+  const Pipeline<PipelineDescriptor>* last_pipeline = nullptr;
+  uint32_t last_stencil_reference = 0u;
+
   for (const auto& command : commands) {
     if (command.instance_count != 1u) {
       VALIDATION_LOG << "GLES backend does not support instanced rendering.";
@@ -272,37 +280,43 @@ struct RenderPassData {
 #endif  // IMPELLER_DEBUG
 
     const auto& pipeline = PipelineGLES::Cast(*command.pipeline);
+    const bool pipeline_changed = command.pipeline.get() != last_pipeline;
+
+    if (pipeline_changed) {
+      const auto* color_attachment =
+          pipeline.GetDescriptor().GetLegacyCompatibleColorAttachment();
+      if (!color_attachment) {
+        VALIDATION_LOG
+            << "Color attachment is too complicated for a legacy renderer.";
+        return false;
+      }
 
-    const auto* color_attachment =
-        pipeline.GetDescriptor().GetLegacyCompatibleColorAttachment();
-    if (!color_attachment) {
-      VALIDATION_LOG
-          << "Color attachment is too complicated for a legacy renderer.";
-      return false;
-    }
-
-    //--------------------------------------------------------------------------
-    /// Configure blending.
-    ///
-    ConfigureBlending(gl, color_attachment);
-
-    //--------------------------------------------------------------------------
-    /// Setup stencil.
-    ///
-    ConfigureStencil(gl, pipeline.GetDescriptor(), command.stencil_reference);
-
-    //--------------------------------------------------------------------------
-    /// Configure depth.
-    ///
-    if (auto depth =
-            pipeline.GetDescriptor().GetDepthStencilAttachmentDescriptor();
-        depth.has_value()) {
-      gl.Enable(GL_DEPTH_TEST);
-      gl.DepthFunc(ToCompareFunction(depth->depth_compare));
-      gl.DepthMask(depth->depth_write_enabled ? GL_TRUE : GL_FALSE);
-    } else {
-      gl.Disable(GL_DEPTH_TEST);
+      //------------------------------------------------------------------------
+      /// Configure blending.
+      ///
+      ConfigureBlending(gl, color_attachment);
+
+      //------------------------------------------------------------------------
+      /// Setup stencil.
+      ///
+      ConfigureStencil(gl, pipeline.GetDescriptor(), command.stencil_reference);
+
+      //------------------------------------------------------------------------
+      /// Configure depth.
+      ///
+      if (auto depth =
+              pipeline.GetDescriptor().GetDepthStencilAttachmentDescriptor();
+          depth.has_value()) {
+        gl.Enable(GL_DEPTH_TEST);
+        gl.DepthFunc(ToCompareFunction(depth->depth_compare));
+        gl.DepthMask(depth->depth_write_enabled ? GL_TRUE : GL_FALSE);
+      } else {
+        gl.Disable(GL_DEPTH_TEST);
+      }
+    } else if (command.stencil_reference != last_stencil_reference) {
+      ConfigureStencil(gl, pipeline.GetDescriptor(), command.stencil_reference);
     }
+    last_stencil_reference = command.stencil_reference;
 
     // Both the viewport and scissor are specified in framebuffer coordinates.
     // Impeller's framebuffer coordinate system is top left origin, but OpenGL's
@@ -344,32 +358,34 @@ struct RenderPassData {
       gl.Disable(GL_SCISSOR_TEST);
     }
 
-    //--------------------------------------------------------------------------
-    /// Setup culling.
-    ///
-    switch (pipeline.GetDescriptor().GetCullMode()) {
-      case CullMode::kNone:
-        gl.Disable(GL_CULL_FACE);
-        break;
-      case CullMode::kFrontFace:
-        gl.Enable(GL_CULL_FACE);
-        gl.CullFace(GL_FRONT);
-        break;
-      case CullMode::kBackFace:
-        gl.Enable(GL_CULL_FACE);
-        gl.CullFace(GL_BACK);
-        break;
-    }
-    //--------------------------------------------------------------------------
-    /// Setup winding order.
-    ///
-    switch (pipeline.GetDescriptor().GetWindingOrder()) {
-      case WindingOrder::kClockwise:
-        gl.FrontFace(GL_CW);
-        break;
-      case WindingOrder::kCounterClockwise:
-        gl.FrontFace(GL_CCW);
-        break;
+    if (pipeline_changed) {
+      //------------------------------------------------------------------------
+      /// Setup culling.
+      ///
+      switch (pipeline.GetDescriptor().GetCullMode()) {
+        case CullMode::kNone:
+          gl.Disable(GL_CULL_FACE);
+          break;
+        case CullMode::kFrontFace:
+          gl.Enable(GL_CULL_FACE);
+          gl.CullFace(GL_FRONT);
+          break;
+        case CullMode::kBackFace:
+          gl.Enable(GL_CULL_FACE);
+          gl.CullFace(GL_BACK);
+          break;
+      }
+      //------------------------------------------------------------------------
+      /// Setup winding order.
+      ///
+      switch (pipeline.GetDescriptor().GetWindingOrder()) {
+        case WindingOrder::kClockwise:
+          gl.FrontFace(GL_CW);
+          break;
+        case WindingOrder::kCounterClockwise:
+          gl.FrontFace(GL_CCW);
+          break;
+      }
     }
 
     if (command.index_type == IndexType::kUnknown) {
@@ -403,8 +419,18 @@ struct RenderPassData {
     //--------------------------------------------------------------------------
     /// Bind the pipeline program.
     ///
-    if (!pipeline.BindProgram()) {
-      return false;
+    if (pipeline_changed) {
+      if (last_pipeline != nullptr &&
+          !PipelineGLES::Cast(*last_pipeline).UnbindProgram()) {
+        return false;
+      }
+      if (!pipeline.BindProgram()) {
+        return false;
+      }
+      // Other programs may have rebound texture units since this one was last
+      // in use; reset the bookkeeping that skips redundant texture binds.
+      vertex_desc_gles->DidBindProgram();
+      last_pipeline = command.pipeline.get();
     }
 
     //--------------------------------------------------------------------------
@@ -467,13 +493,14 @@ struct RenderPassData {
     if (!vertex_desc_gles->UnbindVertexAttributes(gl)) {
       return false;
     }
+  }
 
-    //--------------------------------------------------------------------------
-    /// Unbind the program pipeline.
-    ///
-    if (!pipeline.UnbindProgram()) {
-      return false;
-    }
+  //----------------------------------------------------------------------------
+  /// Unbind the program pipeline.
+  ///
+  if (last_pipeline != nullptr &&
+      !PipelineGLES::Cast(*last_pipeline).UnbindProgram()) {
+    return false;
   }
 
   if (gl.DiscardFramebufferEXT.IsAvailable()) {
@@ -32,6 +32,7 @@ std::unique_ptr<Surface> SurfaceGLES::WrapFBO(
   color0_tex.usage = static_cast<TextureUsageMask>(TextureUsage::kRenderTarget);
   color0_tex.sample_count = SampleCount::kCount1;
   color0_tex.storage_mode = StorageMode::kDevicePrivate;
+  color0_tex.resource_class = ResourceClass::kOnscreenTarget;
 
   ColorAttachment color0;
   color0.texture = std::make_shared<TextureGLES>(
@@ -47,6 +48,7 @@ std::unique_ptr<Surface> SurfaceGLES::WrapFBO(
   stencil0_tex.usage =
       static_cast<TextureUsageMask>(TextureUsage::kRenderTarget);
   stencil0_tex.sample_count = SampleCount::kCount1;
+  stencil0_tex.resource_class = ResourceClass::kOnscreenTarget;
 
   StencilAttachment stencil0;
   stencil0.clear_stencil = 0;
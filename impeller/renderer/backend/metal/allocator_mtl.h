@@ -22,6 +22,7 @@ class AllocatorMTL final : public Allocator {
   friend class ContextMTL;
 
   id<MTLDevice> device_;
+  id<MTLHeap> transient_heap_ = nullptr;
   std::string allocator_label_;
   bool supports_memoryless_targets_ = false;
   bool supports_uma_ = false;
@@ -89,6 +89,26 @@ static bool SupportsLossyTextureCompression(id<MTLDevice> device) {
 #endif
 }
 
+// The number of bytes reserved for the transient texture heap. Enough for the
+// snapshot textures of a blur heavy 1080p frame; textures that do not fit
+// fall back to a device allocation.
+static const NSUInteger kTransientHeapBytes = 32u * 1024u * 1024u;
+
+static id<MTLHeap> CreateTransientHeap(id<MTLDevice> device) {
+  // Hazard tracking keeps heap placement as safe as a device allocation at
+  // the cost of some scheduling parallelism, which short lived snapshot
+  // textures never benefited from to begin with.
+  if (@available(macOS 10.15, iOS 13.0, tvOS 13.0, *)) {
+    auto heap_desc = [[MTLHeapDescriptor alloc] init];
+    heap_desc.type = MTLHeapTypeAutomatic;
+    heap_desc.storageMode = MTLStorageModePrivate;
+    heap_desc.hazardTrackingMode = MTLHazardTrackingModeTracked;
+    heap_desc.size = kTransientHeapBytes;
+    return [device newHeapWithDescriptor:heap_desc];
+  }
+  return nullptr;
+}
+
 AllocatorMTL::AllocatorMTL(id<MTLDevice> device, std::string label)
     : device_(device), allocator_label_(std::move(label)) {
   if (!device_) {
@@ -98,6 +118,7 @@ AllocatorMTL::AllocatorMTL(id<MTLDevice> device, std::string label)
   supports_memoryless_targets_ = DeviceSupportsDeviceTransientTargets(device_);
   supports_uma_ = DeviceHasUnifiedMemoryArchitecture(device_);
   max_texture_supported_ = DeviceMaxTextureSizeSupported(device_);
+  transient_heap_ = CreateTransientHeap(device_);
 
   is_valid_ = true;
 }
@@ -213,6 +234,21 @@ std::shared_ptr<Texture> AllocatorMTL::OnCreateTexture(
     }
   }
 
+  // Place short lived render target textures (snapshots taken by filter
+  // chains and similar intra-frame temporaries) in the transient heap, which
+  // turns each allocation into a placement within already reserved memory.
+  // Fall through to a device allocation when the heap is exhausted.
+  if (transient_heap_ != nullptr &&
+      desc.storage_mode == StorageMode::kDevicePrivate &&
+      desc.sample_count == SampleCount::kCount1 &&
+      (desc.usage &
+       static_cast<TextureUsageMask>(TextureUsage::kRenderTarget))) {
+    auto texture = [transient_heap_ newTextureWithDescriptor:mtl_texture_desc];
+    if (texture) {
+      return std::make_shared<TextureMTL>(desc, texture);
+    }
+  }
+
   auto texture = [device_ newTextureWithDescriptor:mtl_texture_desc];
   if (!texture) {
     return nullptr;
@@ -339,8 +339,8 @@ std::shared_ptr<GPUTracerMTL> ContextMTL::GetGPUTracer() const {
 }
 #endif  // IMPELLER_DEBUG
 
-const std::shared_ptr<fml::ConcurrentTaskRunner>
-ContextMTL::GetWorkerTaskRunner() const {
+std::shared_ptr<fml::ConcurrentTaskRunner> ContextMTL::GetWorkerTaskRunner()
+    const {
   return raster_message_loop_->GetTaskRunner();
 }
 
@@ -67,6 +67,7 @@ static std::optional<RenderTarget> WrapTextureWithRenderTarget(
                            static_cast<uint64_t>(TextureUsage::kShaderRead);
   resolve_tex_desc.sample_count = SampleCount::kCount1;
   resolve_tex_desc.storage_mode = StorageMode::kDevicePrivate;
+  resolve_tex_desc.resource_class = ResourceClass::kOnscreenTarget;
 
   if (resolve_tex_desc.format == PixelFormat::kUnknown) {
     VALIDATION_LOG << "Unknown drawable color format.";
@@ -95,6 +96,7 @@ static std::optional<RenderTarget> WrapTextureWithRenderTarget(
   msaa_tex_desc.format = resolve_tex->GetTextureDescriptor().format;
   msaa_tex_desc.size = resolve_tex->GetSize();
   msaa_tex_desc.usage = static_cast<uint64_t>(TextureUsage::kRenderTarget);
+  msaa_tex_desc.resource_class = ResourceClass::kOnscreenTarget;
 
   auto msaa_tex = allocator.CreateTexture(msaa_tex_desc);
   if (!msaa_tex) {
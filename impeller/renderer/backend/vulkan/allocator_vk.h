@@ -28,6 +28,7 @@ class AllocatorVK final : public Allocator {
 
   UniqueAllocatorVMA allocator_;
   UniquePoolVMA staging_buffer_pool_;
+  UniquePoolVMA transient_texture_pool_;
   std::weak_ptr<Context> context_;
   std::weak_ptr<DeviceHolder> device_holder_;
   ISize max_texture_size_;
@@ -62,6 +63,12 @@ class AllocatorVK final : public Allocator {
   // |Allocator|
   ISize GetMaxTextureSizeSupported() const override;
 
+  // |Allocator|
+  std::pair<uint64_t, uint64_t> GetAllocatedAndUsedMemory() const override;
+
+  // |Allocator|
+  void PerformIdleMaintenance() override;
+
   AllocatorVK(const AllocatorVK&) = delete;
 
   AllocatorVK& operator=(const AllocatorVK&) = delete;
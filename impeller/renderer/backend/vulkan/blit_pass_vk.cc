@@ -7,6 +7,7 @@
 #include "flutter/fml/logging.h"
 #include "flutter/fml/trace_event.h"
 #include "impeller/renderer/backend/vulkan/command_buffer_vk.h"
+#include "impeller/renderer/backend/vulkan/gpu_tracer_vk.h"
 
 namespace impeller {
 
@@ -45,12 +46,20 @@ bool BlitPassVK::EncodeCommands(
     return false;
   }
 
+  if (auto* probe = encoder->GetGPUProbe()) {
+    probe->RecordPassStart(encoder->GetCommandBuffer(), label_);
+  }
+
   for (auto& command : commands_) {
     if (!command->Encode(*encoder)) {
       return false;
     }
   }
 
+  if (auto* probe = encoder->GetGPUProbe()) {
+    probe->RecordPassEnd(encoder->GetCommandBuffer());
+  }
+
   return true;
 }
 
@@ -96,13 +105,13 @@ bool BlitPassVK::OnCopyTextureToBufferCommand(
 bool BlitPassVK::OnCopyBufferToTextureCommand(
     BufferView source,
     std::shared_ptr<Texture> destination,
-    IPoint destination_origin,
+    IRect destination_region,
     std::string label) {
   auto command = std::make_unique<BlitCopyBufferToTextureCommandVK>();
 
   command->source = std::move(source);
   command->destination = std::move(destination);
-  command->destination_origin = destination_origin;
+  command->destination_region = destination_region;
   command->label = std::move(label);
 
   commands_.push_back(std::move(command));
@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
 #include "impeller/base/validation.h"
 #include "impeller/renderer/backend/vulkan/blit_pass_vk.h"
 #include "impeller/renderer/backend/vulkan/command_encoder_vk.h"
@@ -45,6 +46,12 @@ bool CommandBufferVK::IsValid() const {
 }
 
 const std::shared_ptr<CommandEncoderVK>& CommandBufferVK::GetEncoder() {
+  // Commands encoded on this thread must be ordered after whatever is still
+  // being encoded on a worker: barrier generation depends on the texture
+  // layout bookkeeping being updated in submission order.
+  if (auto context = context_.lock()) {
+    ContextVK::Cast(*context).JoinPendingAsyncEncode();
+  }
   if (!encoder_) {
     encoder_ = encoder_factory_->Create();
   }
@@ -52,6 +59,9 @@ const std::shared_ptr<CommandEncoderVK>& CommandBufferVK::GetEncoder() {
 }
 
 bool CommandBufferVK::OnSubmitCommands(CompletionCallback callback) {
+  if (auto context = context_.lock()) {
+    ContextVK::Cast(*context).JoinPendingAsyncEncode();
+  }
   if (!encoder_) {
     encoder_ = encoder_factory_->Create();
   }
@@ -64,6 +74,41 @@ bool CommandBufferVK::OnSubmitCommands(CompletionCallback callback) {
   });
 }
 
+bool CommandBufferVK::SubmitCommandsAsync(
+    std::shared_ptr<RenderPass> render_pass) {
+  TRACE_EVENT0("impeller", "CommandBufferVK::SubmitCommandsAsync");
+  if (!IsValid() || !render_pass->IsValid()) {
+    return false;
+  }
+  auto context = context_.lock();
+  if (!context) {
+    return false;
+  }
+  if (encoder_) {
+    // Work has already been encoded into this command buffer on the calling
+    // thread; fall back to the synchronous path.
+    return CommandBuffer::SubmitCommandsAsync(std::move(render_pass));
+  }
+
+  auto self = shared_from_this();
+  ContextVK::Cast(*context).ScheduleAsyncEncode(
+      [self, render_pass = std::move(render_pass), context]() {
+        if (!render_pass->EncodeCommands()) {
+          VALIDATION_LOG << "Failed to encode render pass on worker.";
+          return;
+        }
+        if (!self->SubmitCommands(nullptr)) {
+          VALIDATION_LOG << "Failed to submit command buffer from worker.";
+          return;
+        }
+        // Send this worker's thread-local command pool off for reset so that
+        // collected command buffers don't accumulate; workers never reach the
+        // per-frame disposal that the raster thread performs at present time.
+        ContextVK::Cast(*context).GetCommandPoolRecycler()->Dispose();
+      });
+  return true;
+}
+
 void CommandBufferVK::OnWaitUntilScheduled() {}
 
 std::shared_ptr<RenderPass> CommandBufferVK::OnCreateRenderPass(
@@ -16,11 +16,10 @@ namespace impeller {
 
 class TrackedObjectsVK {
  public:
-  explicit TrackedObjectsVK(
-      const std::weak_ptr<const DeviceHolder>& device_holder,
-      const std::shared_ptr<CommandPoolVK>& pool,
-      std::unique_ptr<GPUProbe> probe)
-      : desc_pool_(device_holder), probe_(std::move(probe)) {
+  explicit TrackedObjectsVK(const std::weak_ptr<const ContextVK>& context,
+                            const std::shared_ptr<CommandPoolVK>& pool,
+                            std::unique_ptr<GPUProbe> probe)
+      : desc_pool_(context), probe_(std::move(probe)) {
     if (!pool) {
       return;
     }
@@ -123,8 +122,7 @@ std::shared_ptr<CommandEncoderVK> CommandEncoderFactoryVK::Create() {
   }
 
   auto tracked_objects = std::make_shared<TrackedObjectsVK>(
-      context_vk.GetDeviceHolder(), tls_pool,
-      context->GetGPUTracer()->CreateGPUProbe());
+      context_, tls_pool, context->GetGPUTracer()->CreateGPUProbe());
   auto queue = context_vk.GetGraphicsQueue();
 
   if (!tracked_objects || !tracked_objects->IsValid() || !queue) {
@@ -239,6 +237,13 @@ vk::CommandBuffer CommandEncoderVK::GetCommandBuffer() const {
   return {};
 }
 
+GPUProbe* CommandEncoderVK::GetGPUProbe() const {
+  if (tracked_objects_) {
+    return &tracked_objects_->GetGPUProbe();
+  }
+  return nullptr;
+}
+
 void CommandEncoderVK::Reset() {
   tracked_objects_.reset();
 
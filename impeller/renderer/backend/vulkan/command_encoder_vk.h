@@ -76,6 +76,10 @@ class CommandEncoderVK {
 
   vk::CommandBuffer GetCommandBuffer() const;
 
+  /// @brief The GPU probe tracing the execution of this encoder's command
+  ///        buffer, or nullptr if the encoder has been reset.
+  GPUProbe* GetGPUProbe() const;
+
   void PushDebugGroup(const char* label) const;
 
   void PopDebugGroup() const;
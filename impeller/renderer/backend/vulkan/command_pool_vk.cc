@@ -40,9 +40,8 @@ class BackgroundCommandPoolVK final {
     if (!recycler) {
       return;
     }
-    buffers_.clear();
 
-    recycler->Reclaim(std::move(pool_));
+    recycler->Reclaim(std::move(pool_), std::move(buffers_));
   }
 
  private:
@@ -55,6 +54,8 @@ class BackgroundCommandPoolVK final {
   // These are retained because the destructor of the C++ UniqueCommandBuffer
   // wrapper type will attempt to reset the cmd buffer, and doing so may be a
   // thread safety violation as this may happen on the fence waiter thread.
+  // Instead, they ride along with the pool through its reset and are handed
+  // out again in their initial state.
   std::vector<vk::UniqueCommandBuffer> buffers_;
   std::weak_ptr<CommandPoolRecyclerVK> recycler_;
 };
@@ -73,6 +74,13 @@ CommandPoolVK::~CommandPoolVK() {
     return;
   }
 
+  // Any buffers that were never handed out are in their initial state already
+  // and survive the pool reset just like the collected ones.
+  for (auto& buffer : unused_buffers_) {
+    collected_buffers_.push_back(std::move(buffer));
+  }
+  unused_buffers_.clear();
+
   auto reset_pool_when_dropped = BackgroundCommandPoolVK(
       std::move(pool_), std::move(collected_buffers_), recycler);
 
@@ -92,6 +100,13 @@ vk::UniqueCommandBuffer CommandPoolVK::CreateCommandBuffer() {
     return {};
   }
 
+  // Prefer a recycled buffer in its initial state over a fresh allocation.
+  if (!unused_buffers_.empty()) {
+    auto buffer = std::move(unused_buffers_.back());
+    unused_buffers_.pop_back();
+    return buffer;
+  }
+
   auto const device = context->GetDevice();
   vk::CommandBufferAllocateInfo info;
   info.setCommandPool(pool_.get());
@@ -121,6 +136,10 @@ void CommandPoolVK::Destroy() {
 
   // When the command pool is destroyed, all of its command buffers are freed.
   // Handles allocated from that pool are now invalid and must be discarded.
+  for (auto& buffer : unused_buffers_) {
+    buffer.release();
+  }
+  unused_buffers_.clear();
   for (auto& buffer : collected_buffers_) {
     buffer.release();
   }
@@ -158,13 +177,13 @@ std::shared_ptr<CommandPoolVK> CommandPoolRecyclerVK::Get() {
   }
 
   // Otherwise, create a new resource and return it.
-  auto pool = Create();
-  if (!pool) {
+  auto data = Create();
+  if (!data || !data->pool) {
     return nullptr;
   }
 
-  auto const resource =
-      std::make_shared<CommandPoolVK>(std::move(*pool), context_);
+  auto const resource = std::make_shared<CommandPoolVK>(
+      std::move(data->pool), std::move(data->buffers), context_);
   pool_map.emplace(hash, resource);
 
   {
@@ -176,10 +195,11 @@ std::shared_ptr<CommandPoolVK> CommandPoolRecyclerVK::Get() {
 }
 
 // TODO(matanlurey): Return a status_or<> instead of nullopt when we have one.
-std::optional<vk::UniqueCommandPool> CommandPoolRecyclerVK::Create() {
-  // If we can reuse a command pool, do so.
-  if (auto pool = Reuse()) {
-    return pool;
+std::optional<CommandPoolRecyclerVK::RecycledData>
+CommandPoolRecyclerVK::Create() {
+  // If we can reuse a command pool and its buffers, do so.
+  if (auto data = Reuse()) {
+    return data;
   }
 
   // Otherwise, create a new one.
@@ -196,10 +216,11 @@ std::optional<vk::UniqueCommandPool> CommandPoolRecyclerVK::Create() {
   if (result != vk::Result::eSuccess) {
     return std::nullopt;
   }
-  return std::move(pool);
+  return RecycledData{.pool = std::move(pool), .buffers = {}};
 }
 
-std::optional<vk::UniqueCommandPool> CommandPoolRecyclerVK::Reuse() {
+std::optional<CommandPoolRecyclerVK::RecycledData>
+CommandPoolRecyclerVK::Reuse() {
   // If there are no recycled pools, return nullopt.
   Lock recycled_lock(recycled_mutex_);
   if (recycled_.empty()) {
@@ -207,12 +228,14 @@ std::optional<vk::UniqueCommandPool> CommandPoolRecyclerVK::Reuse() {
   }
 
   // Otherwise, remove and return a recycled pool.
-  auto pool = std::move(recycled_.back());
+  auto data = std::move(recycled_.back());
   recycled_.pop_back();
-  return std::move(pool);
+  return std::move(data);
 }
 
-void CommandPoolRecyclerVK::Reclaim(vk::UniqueCommandPool&& pool) {
+void CommandPoolRecyclerVK::Reclaim(
+    vk::UniqueCommandPool&& pool,
+    std::vector<vk::UniqueCommandBuffer>&& buffers) {
   TRACE_EVENT0("impeller", "ReclaimCommandPool");
 
   // Reset the pool on a background thread.
@@ -223,9 +246,16 @@ void CommandPoolRecyclerVK::Reclaim(vk::UniqueCommandPool&& pool) {
   auto device = strong_context->GetDevice();
   device.resetCommandPool(pool.get());
 
+  // The reset returned these buffers to their initial state; they can be
+  // re-recorded instead of paying for fresh allocations next frame. Trim the
+  // excess so a pathological frame doesn't pin buffers forever.
+  if (buffers.size() > kRetainedCommandBufferLimit) {
+    buffers.resize(kRetainedCommandBufferLimit);
+  }
+
   // Move the pool to the recycled list.
   Lock recycled_lock(recycled_mutex_);
-  recycled_.push_back(std::move(pool));
+  recycled_.push_back({std::move(pool), std::move(buffers)});
 }
 
 CommandPoolRecyclerVK::~CommandPoolRecyclerVK() {
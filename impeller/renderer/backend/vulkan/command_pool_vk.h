@@ -7,6 +7,7 @@
 #include <memory>
 #include <optional>
 #include <utility>
+#include <vector>
 #include "fml/macros.h"
 #include "impeller/base/thread.h"
 #include "impeller/renderer/backend/vulkan/context_vk.h"
@@ -34,10 +35,14 @@ class CommandPoolVK final {
   /// @brief      Creates a resource that manages the life of a command pool.
   ///
   /// @param[in]  pool      The command pool to manage.
+  /// @param[in]  buffers   Zero or more command buffers in their initial state.
   /// @param[in]  recycler  The context that will be notified on destruction.
   explicit CommandPoolVK(vk::UniqueCommandPool pool,
+                         std::vector<vk::UniqueCommandBuffer>&& buffers,
                          std::weak_ptr<ContextVK>& context)
-      : pool_(std::move(pool)), context_(context) {}
+      : pool_(std::move(pool)),
+        unused_buffers_(std::move(buffers)),
+        context_(context) {}
 
   /// @brief      Creates and returns a new |vk::CommandBuffer|.
   ///
@@ -63,6 +68,10 @@ class CommandPoolVK final {
 
   Mutex pool_mutex_;
   vk::UniqueCommandPool pool_ IPLR_GUARDED_BY(pool_mutex_);
+  // Buffers in their initial state that can be handed out by
+  // |CreateCommandBuffer| without a fresh allocation.
+  std::vector<vk::UniqueCommandBuffer> unused_buffers_
+      IPLR_GUARDED_BY(pool_mutex_);
   std::weak_ptr<ContextVK>& context_;
 
   // Used to retain a reference on these until the pool is reset.
@@ -116,10 +125,31 @@ class CommandPoolRecyclerVK final
   /// @warning    Returns a |nullptr| if a pool could not be created.
   std::shared_ptr<CommandPoolVK> Get();
 
+  /// The maximum number of command buffers retained through a pool reset.
+  /// Anything beyond this is freed so a pathologically busy frame does not
+  /// pin its peak buffer count for the lifetime of the context.
+  static constexpr size_t kRetainedCommandBufferLimit = 64u;
+
+  /// @brief      A |vk::CommandPool| and the command buffers allocated from
+  ///             it, all returned to their initial state by a pool reset.
+  struct RecycledData {
+    vk::UniqueCommandPool pool;
+    std::vector<vk::UniqueCommandBuffer> buffers;
+  };
+
   /// @brief      Returns a command pool to be reset on a background thread.
   ///
-  /// @param[in]  pool The pool to recycler.
-  void Reclaim(vk::UniqueCommandPool&& pool);
+  ///             The command buffers allocated from the pool are retained
+  ///             across the reset so that the next frame can re-record into
+  ///             them instead of allocating fresh ones. The caller must
+  ///             guarantee that the GPU is done consuming them; in practice
+  ///             this holds because each buffer's |TrackedObjectsVK| keeps the
+  ///             pool alive until its frame fence signals.
+  ///
+  /// @param[in]  pool    The pool to recycle.
+  /// @param[in]  buffers The buffers allocated from the pool.
+  void Reclaim(vk::UniqueCommandPool&& pool,
+               std::vector<vk::UniqueCommandBuffer>&& buffers);
 
   /// @brief      Clears all recycled command pools to let them be reclaimed.
   void Dispose();
@@ -128,17 +158,17 @@ class CommandPoolRecyclerVK final
   std::weak_ptr<ContextVK> context_;
 
   Mutex recycled_mutex_;
-  std::vector<vk::UniqueCommandPool> recycled_ IPLR_GUARDED_BY(recycled_mutex_);
+  std::vector<RecycledData> recycled_ IPLR_GUARDED_BY(recycled_mutex_);
 
   /// @brief      Creates a new |vk::CommandPool|.
   ///
   /// @returns    Returns a |std::nullopt| if a pool could not be created.
-  std::optional<vk::UniqueCommandPool> Create();
+  std::optional<RecycledData> Create();
 
   /// @brief      Reuses a recycled |vk::CommandPool|, if available.
   ///
   /// @returns    Returns a |std::nullopt| if a pool was not available.
-  std::optional<vk::UniqueCommandPool> Reuse();
+  std::optional<RecycledData> Reuse();
 
   CommandPoolRecyclerVK(const CommandPoolRecyclerVK&) = delete;
 
@@ -112,5 +112,53 @@ TEST(CommandPoolRecyclerVKTest, ReclaimMakesCommandPoolAvailable) {
   context->Shutdown();
 }
 
+TEST(CommandPoolRecyclerVKTest, ReclaimRetainsCommandBuffersForReuse) {
+  auto const context = MockVulkanContextBuilder().Build();
+
+  {
+    // Fetch a pool, allocate a command buffer from it, and hand the buffer
+    // back as a frame would once its fence signals.
+    auto const recycler = context->GetCommandPoolRecycler();
+    auto pool = recycler->Get();
+    auto buffer = pool->CreateCommandBuffer();
+    ASSERT_TRUE(!!buffer);
+    pool->CollectCommandBuffer(std::move(buffer));
+
+    // This normally is called at the end of a frame.
+    recycler->Dispose();
+    pool.reset();
+  }
+
+  // Add something to the resource manager and have it notify us when it's
+  // destroyed. That should give us a non-flaky signal that the pool has been
+  // reclaimed as well.
+  auto waiter = fml::AutoResetWaitableEvent();
+  auto rattle = DeathRattle([&waiter]() { waiter.Signal(); });
+  {
+    UniqueResourceVKT<DeathRattle> resource(context->GetResourceManager(),
+                                            std::move(rattle));
+  }
+  waiter.Wait();
+
+  // On another thread, grab the recycled pool and ask for a command buffer.
+  std::thread thread([&]() {
+    auto const pool = context->GetCommandPoolRecycler()->Get();
+    ASSERT_NE(pool.get(), nullptr);
+    auto buffer = pool->CreateCommandBuffer();
+    EXPECT_TRUE(!!buffer);
+  });
+
+  thread.join();
+
+  // The second command buffer came from the retained set, so only the first
+  // one required an allocation.
+  auto const called = GetMockVulkanFunctions(context->GetDevice());
+  EXPECT_EQ(
+      std::count(called->begin(), called->end(), "vkAllocateCommandBuffers"),
+      1u);
+
+  context->Shutdown();
+}
+
 }  // namespace testing
 }  // namespace impeller
@@ -32,7 +32,7 @@ void ComputePassVK::OnSetLabel(const std::string& label) {
   label_ = label;
 }
 
-static bool UpdateBindingLayouts(const Bindings& bindings,
+static bool UpdateBindingLayouts(const std::vector<ComputeCommand>& commands,
                                  const vk::CommandBuffer& buffer) {
   BarrierVK barrier;
   barrier.cmd_buffer = buffer;
@@ -43,26 +43,26 @@ static bool UpdateBindingLayouts(const Bindings& bindings,
 
   barrier.new_layout = vk::ImageLayout::eShaderReadOnlyOptimal;
 
-  for (const auto& [_, data] : bindings.sampled_images) {
-    if (!TextureVK::Cast(*data.texture.resource).SetLayout(barrier)) {
-      return false;
-    }
-  }
-  return true;
-}
-
-static bool UpdateBindingLayouts(const ComputeCommand& command,
-                                 const vk::CommandBuffer& buffer) {
-  return UpdateBindingLayouts(command.bindings, buffer);
-}
-
-static bool UpdateBindingLayouts(const std::vector<ComputeCommand>& commands,
-                                 const vk::CommandBuffer& buffer) {
+  // Batch the transitions for all sampled images referenced by the pass into
+  // a single barrier command instead of one vkCmdPipelineBarrier per image.
+  std::vector<vk::ImageMemoryBarrier> image_barriers;
   for (const auto& command : commands) {
-    if (!UpdateBindingLayouts(command, buffer)) {
-      return false;
+    for (const auto& [_, data] : command.bindings.sampled_images) {
+      TextureVK::Cast(*data.texture.resource)
+          .BatchedSetLayout(barrier, image_barriers);
     }
   }
+  if (image_barriers.empty()) {
+    return true;
+  }
+
+  buffer.pipelineBarrier(barrier.src_stage,  // src stage
+                         barrier.dst_stage,  // dst stage
+                         {},                 // dependency flags
+                         nullptr,            // memory barriers
+                         nullptr,            // buffer barriers
+                         image_barriers      // image barriers
+  );
   return true;
 }
 
@@ -27,6 +27,7 @@
 #include "impeller/renderer/backend/vulkan/command_encoder_vk.h"
 #include "impeller/renderer/backend/vulkan/command_pool_vk.h"
 #include "impeller/renderer/backend/vulkan/debug_report_vk.h"
+#include "impeller/renderer/backend/vulkan/descriptor_pool_vk.h"
 #include "impeller/renderer/backend/vulkan/fence_waiter_vk.h"
 #include "impeller/renderer/backend/vulkan/gpu_tracer_vk.h"
 #include "impeller/renderer/backend/vulkan/resource_manager_vk.h"
@@ -405,6 +406,13 @@ void ContextVK::Setup(Settings settings) {
     return;
   }
 
+  auto descriptor_pool_recycler =
+      std::make_shared<DescriptorPoolRecyclerVK>(weak_from_this());
+  if (!descriptor_pool_recycler) {
+    VALIDATION_LOG << "Could not create descriptor pool recycler.";
+    return;
+  }
+
   //----------------------------------------------------------------------------
   /// Fetch the queues.
   ///
@@ -436,7 +444,9 @@ void ContextVK::Setup(Settings settings) {
   fence_waiter_ = std::move(fence_waiter);
   resource_manager_ = std::move(resource_manager);
   command_pool_recycler_ = std::move(command_pool_recycler);
+  descriptor_pool_recycler_ = std::move(descriptor_pool_recycler);
   device_name_ = std::string(physical_device_properties.deviceName);
+  prefer_low_latency_presentation_ = settings.prefer_low_latency_presentation;
   is_valid_ = true;
 
   // Create the GPU Tracer later because it depends on state from
@@ -503,7 +513,55 @@ ContextVK::GetConcurrentWorkerTaskRunner() const {
   return raster_message_loop_->GetTaskRunner();
 }
 
+std::shared_ptr<fml::ConcurrentTaskRunner> ContextVK::GetWorkerTaskRunner()
+    const {
+  return raster_message_loop_->GetTaskRunner();
+}
+
+void ContextVK::ScheduleAsyncEncode(fml::closure encode_task) const {
+  // Serialize encode tasks so that texture layout bookkeeping and queue
+  // submissions retain the order in which the tasks were scheduled.
+  JoinPendingAsyncEncode();
+  auto done = std::make_shared<fml::ManualResetWaitableEvent>();
+  {
+    Lock lock(async_encode_mutex_);
+    async_encode_done_ = done;
+  }
+  raster_message_loop_->GetTaskRunner()->PostTask(
+      [this, done, encode_task = std::move(encode_task)]() {
+        {
+          Lock lock(async_encode_mutex_);
+          async_encode_thread_ = std::this_thread::get_id();
+        }
+        encode_task();
+        {
+          Lock lock(async_encode_mutex_);
+          async_encode_thread_ = std::thread::id{};
+        }
+        done->Signal();
+      });
+}
+
+void ContextVK::JoinPendingAsyncEncode() const {
+  std::shared_ptr<fml::ManualResetWaitableEvent> pending;
+  {
+    Lock lock(async_encode_mutex_);
+    if (async_encode_thread_ == std::this_thread::get_id()) {
+      // Called from within the pending encode task itself.
+      return;
+    }
+    pending = std::move(async_encode_done_);
+  }
+  if (pending) {
+    pending->Wait();
+  }
+}
+
 void ContextVK::Shutdown() {
+  // Let any in-flight worker encode finish before tearing down the loop it
+  // runs on.
+  JoinPendingAsyncEncode();
+
   // There are multiple objects, for example |CommandPoolVK|, that in their
   // destructors make a strong reference to |ContextVK|. Resetting these shared
   // pointers ensures that cleanup happens in a correct order.
@@ -545,6 +603,11 @@ std::shared_ptr<CommandPoolRecyclerVK> ContextVK::GetCommandPoolRecycler()
   return command_pool_recycler_;
 }
 
+std::shared_ptr<DescriptorPoolRecyclerVK> ContextVK::GetDescriptorPoolRecycler()
+    const {
+  return descriptor_pool_recycler_;
+}
+
 std::unique_ptr<CommandEncoderFactoryVK>
 ContextVK::CreateGraphicsCommandEncoderFactory() const {
   return std::make_unique<CommandEncoderFactoryVK>(weak_from_this());
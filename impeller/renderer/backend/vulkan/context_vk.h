@@ -5,13 +5,17 @@
 #pragma once
 
 #include <memory>
+#include <thread>
 
+#include "flutter/fml/closure.h"
 #include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/mapping.h"
+#include "flutter/fml/synchronization/waitable_event.h"
 #include "flutter/fml/unique_fd.h"
 #include "fml/thread.h"
 #include "impeller/base/backend_cast.h"
+#include "impeller/base/thread.h"
 #include "impeller/core/formats.h"
 #include "impeller/renderer/backend/vulkan/command_pool_vk.h"
 #include "impeller/renderer/backend/vulkan/device_holder.h"
@@ -29,6 +33,7 @@ bool HasValidationLayers();
 class CommandEncoderFactoryVK;
 class CommandEncoderVK;
 class CommandPoolRecyclerVK;
+class DescriptorPoolRecyclerVK;
 class DebugReportVK;
 class FenceWaiterVK;
 class ResourceManagerVK;
@@ -44,6 +49,11 @@ class ContextVK final : public Context,
     std::vector<std::shared_ptr<fml::Mapping>> shader_libraries_data;
     fml::UniqueFD cache_directory;
     bool enable_validation = false;
+    // Prefer mailbox presentation with an extra swapchain image over FIFO
+    // when the surface supports it. Trades power draw for up to a frame less
+    // input latency. May be changed at runtime via
+    // |SetPreferLowLatencyPresentation|.
+    bool prefer_low_latency_presentation = false;
 
     Settings() = default;
 
@@ -92,6 +102,14 @@ class ContextVK final : public Context,
 
   bool GetSyncPresentation() const { return sync_presentation_; }
 
+  void SetPreferLowLatencyPresentation(bool value) {
+    prefer_low_latency_presentation_ = value;
+  }
+
+  bool GetPreferLowLatencyPresentation() const {
+    return prefer_low_latency_presentation_;
+  }
+
   void SetOffscreenFormat(PixelFormat pixel_format);
 
   template <typename T>
@@ -134,6 +152,24 @@ class ContextVK final : public Context,
   const std::shared_ptr<fml::ConcurrentTaskRunner>
   GetConcurrentWorkerTaskRunner() const;
 
+  // |Context|
+  std::shared_ptr<fml::ConcurrentTaskRunner> GetWorkerTaskRunner()
+      const override;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Schedule a command buffer encode task on a concurrent worker.
+  ///
+  ///             At most one task is in flight: scheduling joins the
+  ///             previously scheduled task first, so encodes — and therefore
+  ///             queue submissions and texture layout bookkeeping — happen in
+  ///             the same order as they would on the calling thread.
+  void ScheduleAsyncEncode(fml::closure encode_task) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Block until the pending asynchronous encode task (if any)
+  ///             has finished. A no-op when called from the task itself.
+  void JoinPendingAsyncEncode() const;
+
   /// @brief A single-threaded task runner that should only be used for
   ///        submitKHR.
   ///
@@ -158,6 +194,8 @@ class ContextVK final : public Context,
 
   std::shared_ptr<CommandPoolRecyclerVK> GetCommandPoolRecycler() const;
 
+  std::shared_ptr<DescriptorPoolRecyclerVK> GetDescriptorPoolRecycler() const;
+
   std::shared_ptr<GPUTracerVK> GetGPUTracer() const;
 
   void RecordFrameEndTime() const;
@@ -187,12 +225,19 @@ class ContextVK final : public Context,
   std::shared_ptr<FenceWaiterVK> fence_waiter_;
   std::shared_ptr<ResourceManagerVK> resource_manager_;
   std::shared_ptr<CommandPoolRecyclerVK> command_pool_recycler_;
+  std::shared_ptr<DescriptorPoolRecyclerVK> descriptor_pool_recycler_;
   std::string device_name_;
   std::shared_ptr<fml::ConcurrentMessageLoop> raster_message_loop_;
   std::unique_ptr<fml::Thread> queue_submit_thread_;
   std::shared_ptr<GPUTracerVK> gpu_tracer_;
+  mutable Mutex async_encode_mutex_;
+  mutable std::shared_ptr<fml::ManualResetWaitableEvent> async_encode_done_
+      IPLR_GUARDED_BY(async_encode_mutex_);
+  mutable std::thread::id async_encode_thread_
+      IPLR_GUARDED_BY(async_encode_mutex_);
 
   bool sync_presentation_ = false;
+  bool prefer_low_latency_presentation_ = false;
   const uint64_t hash_;
 
   bool is_valid_ = false;
@@ -4,42 +4,74 @@
 
 #include "impeller/renderer/backend/vulkan/descriptor_pool_vk.h"
 
+#include <utility>
+
 #include "flutter/fml/trace_event.h"
 #include "impeller/base/validation.h"
+#include "impeller/renderer/backend/vulkan/context_vk.h"
+#include "impeller/renderer/backend/vulkan/resource_manager_vk.h"
 
 namespace impeller {
 
-DescriptorPoolVK::DescriptorPoolVK(
-    const std::weak_ptr<const DeviceHolder>& device_holder)
-    : device_holder_(device_holder) {
-  FML_DCHECK(device_holder.lock());
-}
+// Holds the descriptor pool in a background thread, recycling it when done.
+class BackgroundDescriptorPoolVK final {
+ public:
+  BackgroundDescriptorPoolVK(BackgroundDescriptorPoolVK&&) = default;
 
-DescriptorPoolVK::~DescriptorPoolVK() = default;
+  explicit BackgroundDescriptorPoolVK(
+      DescriptorPoolAndCapacityVK&& pool,
+      std::weak_ptr<DescriptorPoolRecyclerVK> recycler)
+      : pool_(std::move(pool)), recycler_(std::move(recycler)) {}
 
-static vk::UniqueDescriptorPool CreatePool(const vk::Device& device,
-                                           uint32_t image_count,
-                                           uint32_t buffer_count) {
-  TRACE_EVENT0("impeller", "CreateDescriptorPool");
-  std::vector<vk::DescriptorPoolSize> pools = {};
-  if (image_count > 0) {
-    pools.emplace_back(vk::DescriptorPoolSize{
-        vk::DescriptorType::eCombinedImageSampler, image_count});
+  ~BackgroundDescriptorPoolVK() {
+    auto const recycler = recycler_.lock();
+
+    // Not only does this prevent recycling when the context is being
+    // destroyed, but it also prevents the destructor from effectively being
+    // called twice; once for the original BackgroundDescriptorPoolVK() and
+    // once for the moved BackgroundDescriptorPoolVK().
+    if (!recycler) {
+      return;
+    }
+
+    recycler->Reclaim(std::move(pool_));
   }
-  if (buffer_count > 0) {
-    pools.emplace_back(vk::DescriptorPoolSize{
-        vk::DescriptorType::eUniformBuffer, buffer_count});
-    pools.emplace_back(vk::DescriptorPoolSize{
-        vk::DescriptorType::eStorageBuffer, buffer_count});
+
+ private:
+  BackgroundDescriptorPoolVK(const BackgroundDescriptorPoolVK&) = delete;
+
+  BackgroundDescriptorPoolVK& operator=(const BackgroundDescriptorPoolVK&) =
+      delete;
+
+  DescriptorPoolAndCapacityVK pool_;
+  std::weak_ptr<DescriptorPoolRecyclerVK> recycler_;
+};
+
+DescriptorPoolVK::DescriptorPoolVK(std::weak_ptr<const ContextVK> context)
+    : context_(std::move(context)) {}
+
+DescriptorPoolVK::~DescriptorPoolVK() {
+  if (pools_.empty()) {
+    return;
   }
-  vk::DescriptorPoolCreateInfo pool_info;
-  pool_info.setMaxSets(image_count + buffer_count);
-  pool_info.setPoolSizes(pools);
-  auto [result, pool] = device.createDescriptorPoolUnique(pool_info);
-  if (result != vk::Result::eSuccess) {
-    VALIDATION_LOG << "Unable to create a descriptor pool";
+
+  auto const context = context_.lock();
+  if (!context) {
+    return;
+  }
+  auto const recycler = context->GetDescriptorPoolRecycler();
+  if (!recycler) {
+    return;
   }
-  return std::move(pool);
+
+  for (auto& pool : pools_) {
+    auto reset_pool_when_dropped =
+        BackgroundDescriptorPoolVK(std::move(pool), recycler);
+
+    UniqueResourceVKT<BackgroundDescriptorPoolVK> pool_resource(
+        context->GetResourceManager(), std::move(reset_pool_when_dropped));
+  }
+  pools_.clear();
 }
 
 fml::StatusOr<std::vector<vk::DescriptorSet>>
@@ -47,31 +79,119 @@ DescriptorPoolVK::AllocateDescriptorSets(
     uint32_t buffer_count,
     uint32_t sampler_count,
     const std::vector<vk::DescriptorSetLayout>& layouts) {
-  std::shared_ptr<const DeviceHolder> strong_device = device_holder_.lock();
-  if (!strong_device) {
+  auto const context = context_.lock();
+  if (!context) {
     return fml::Status(fml::StatusCode::kUnknown, "No device");
   }
+  auto const recycler = context->GetDescriptorPoolRecycler();
+  if (!recycler) {
+    return fml::Status(fml::StatusCode::kUnknown, "No recycler");
+  }
 
-  auto new_pool =
-      CreatePool(strong_device->GetDevice(), sampler_count, buffer_count);
-  if (!new_pool) {
+  auto pool = recycler->Get(sampler_count, buffer_count);
+  if (!pool.pool) {
     return fml::Status(fml::StatusCode::kUnknown,
                        "Failed to create descriptor pool");
   }
-  pool_ = std::move(new_pool);
 
   vk::DescriptorSetAllocateInfo set_info;
-  set_info.setDescriptorPool(pool_.get());
+  set_info.setDescriptorPool(pool.pool.get());
   set_info.setSetLayouts(layouts);
 
-  auto [result, sets] =
-      strong_device->GetDevice().allocateDescriptorSets(set_info);
+  auto [result, sets] = context->GetDevice().allocateDescriptorSets(set_info);
   if (result != vk::Result::eSuccess) {
     VALIDATION_LOG << "Could not allocate descriptor sets: "
                    << vk::to_string(result);
     return fml::Status(fml::StatusCode::kUnknown, "");
   }
+
+  // The sets allocated above live as long as the pool, so the pool must be
+  // kept around until this object is collected after the frame fence.
+  pools_.push_back(std::move(pool));
   return sets;
 }
 
+DescriptorPoolAndCapacityVK DescriptorPoolRecyclerVK::Get(
+    uint32_t image_capacity,
+    uint32_t buffer_capacity) {
+  // Recycle a pool with a matching capacity if it exists.
+  auto recycled = Reuse(image_capacity, buffer_capacity);
+  if (recycled.has_value()) {
+    return std::move(recycled.value());
+  }
+  return Create(image_capacity, buffer_capacity);
+}
+
+DescriptorPoolAndCapacityVK DescriptorPoolRecyclerVK::Create(
+    uint32_t image_capacity,
+    uint32_t buffer_capacity) {
+  auto strong_context = context_.lock();
+  if (!strong_context) {
+    VALIDATION_LOG << "Unable to create a descriptor pool due to dead context.";
+    return {};
+  }
+
+  TRACE_EVENT0("impeller", "CreateDescriptorPool");
+  std::vector<vk::DescriptorPoolSize> pools = {};
+  if (image_capacity > 0) {
+    pools.emplace_back(vk::DescriptorPoolSize{
+        vk::DescriptorType::eCombinedImageSampler, image_capacity});
+  }
+  if (buffer_capacity > 0) {
+    pools.emplace_back(vk::DescriptorPoolSize{
+        vk::DescriptorType::eUniformBuffer, buffer_capacity});
+    pools.emplace_back(vk::DescriptorPoolSize{
+        vk::DescriptorType::eStorageBuffer, buffer_capacity});
+  }
+  vk::DescriptorPoolCreateInfo pool_info;
+  pool_info.setMaxSets(image_capacity + buffer_capacity);
+  pool_info.setPoolSizes(pools);
+  auto [result, pool] =
+      strong_context->GetDevice().createDescriptorPoolUnique(pool_info);
+  if (result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Unable to create a descriptor pool";
+    return {};
+  }
+  return DescriptorPoolAndCapacityVK{
+      .pool = std::move(pool),
+      .image_capacity = image_capacity,
+      .buffer_capacity = buffer_capacity,
+  };
+}
+
+std::optional<DescriptorPoolAndCapacityVK> DescriptorPoolRecyclerVK::Reuse(
+    uint32_t image_capacity,
+    uint32_t buffer_capacity) {
+  Lock recycled_lock(recycled_mutex_);
+  // First fit; in steady state frames recur with the same layouts and so do
+  // their pool capacities.
+  for (auto it = recycled_.begin(); it != recycled_.end(); ++it) {
+    if (it->image_capacity >= image_capacity &&
+        it->buffer_capacity >= buffer_capacity) {
+      auto found = std::move(*it);
+      recycled_.erase(it);
+      return found;
+    }
+  }
+  return std::nullopt;
+}
+
+void DescriptorPoolRecyclerVK::Reclaim(DescriptorPoolAndCapacityVK&& pool) {
+  TRACE_EVENT0("impeller", "ReclaimDescriptorPool");
+
+  // Reset the pool on a background thread.
+  auto strong_context = context_.lock();
+  if (!strong_context) {
+    return;
+  }
+  auto device = strong_context->GetDevice();
+  device.resetDescriptorPool(pool.pool.get());
+
+  // Move the pool to the recycled list.
+  Lock recycled_lock(recycled_mutex_);
+  if (recycled_.size() < kMaxRecycledPools) {
+    recycled_.push_back(std::move(pool));
+  }
+}
+
 }  // namespace impeller
@@ -5,13 +5,30 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "fml/status_or.h"
-#include "impeller/renderer/backend/vulkan/device_holder.h"
+#include "impeller/base/thread.h"
+#include "impeller/renderer/backend/vulkan/vk.h"  // IWYU pragma: keep.
 
 namespace impeller {
 
+class ContextVK;
+class DescriptorPoolRecyclerVK;
+
+//------------------------------------------------------------------------------
+/// @brief      A |vk::DescriptorPool| paired with the capacity it was created
+///             with, so the recycler can match a reset pool against a new
+///             request.
+struct DescriptorPoolAndCapacityVK {
+  vk::UniqueDescriptorPool pool;
+  uint32_t image_capacity = 0u;
+  uint32_t buffer_capacity = 0u;
+};
+
 //------------------------------------------------------------------------------
 /// @brief      A short-lived fixed-sized descriptor pool. Descriptors
 ///             from this pool don't need to be freed individually. Instead, the
@@ -22,11 +39,14 @@ namespace impeller {
 ///             threads.
 ///
 ///             Encoders create pools as necessary as they have the same
-///             threading and lifecycle restrictions.
+///             threading and lifecycle restrictions. When the pool is
+///             collected (after the frame fence signals), its underlying
+///             |vk::DescriptorPool| objects are handed back to the
+///             |DescriptorPoolRecyclerVK| to be reset and reused instead of
+///             destroyed.
 class DescriptorPoolVK {
  public:
-  explicit DescriptorPoolVK(
-      const std::weak_ptr<const DeviceHolder>& device_holder);
+  explicit DescriptorPoolVK(std::weak_ptr<const ContextVK> context);
 
   ~DescriptorPoolVK();
 
@@ -36,12 +56,87 @@ class DescriptorPoolVK {
       const std::vector<vk::DescriptorSetLayout>& layouts);
 
  private:
-  std::weak_ptr<const DeviceHolder> device_holder_;
-  vk::UniqueDescriptorPool pool_ = {};
+  std::weak_ptr<const ContextVK> context_;
+  std::vector<DescriptorPoolAndCapacityVK> pools_;
 
   DescriptorPoolVK(const DescriptorPoolVK&) = delete;
 
   DescriptorPoolVK& operator=(const DescriptorPoolVK&) = delete;
 };
 
+//------------------------------------------------------------------------------
+/// @brief      Creates and manages the lifecycle of |vk::DescriptorPool|
+///             objects; or in other words, a pool for descriptor pools.
+///
+/// In steady state, frames recur with the same descriptor layouts and counts,
+/// so the pools that serviced the previous frames can service the next ones
+/// once their fences signal. Pools are reset wholesale and reused instead of
+/// being destroyed and recreated every frame.
+///
+/// A single instance should be created per |ContextVK|.
+///
+/// @note       This class is thread-safe.
+///
+/// @see        |CommandPoolRecyclerVK|
+class DescriptorPoolRecyclerVK final
+    : public std::enable_shared_from_this<DescriptorPoolRecyclerVK> {
+ public:
+  ~DescriptorPoolRecyclerVK() = default;
+
+  /// The maximum number of descriptor pools this recycler will hold onto.
+  /// Anything beyond this is destroyed so a pathologically layered frame does
+  /// not pin its peak descriptor count for the lifetime of the context.
+  static constexpr size_t kMaxRecycledPools = 32u;
+
+  /// @brief      Creates a recycler for the given |ContextVK|.
+  ///
+  /// @param[in]  context The context to create the recycler for.
+  explicit DescriptorPoolRecyclerVK(std::weak_ptr<ContextVK> context)
+      : context_(std::move(context)) {}
+
+  /// @brief      Gets a descriptor pool with at least the given capacities.
+  ///
+  ///             A recycled pool (already reset) is preferred; a new pool is
+  ///             created only when no recycled pool is large enough.
+  ///
+  /// @warning    Returns a default instance if a pool could not be created.
+  DescriptorPoolAndCapacityVK Get(uint32_t image_capacity,
+                                  uint32_t buffer_capacity);
+
+  /// @brief      Returns a descriptor pool to be reset and reused.
+  ///
+  ///             The caller must guarantee that the GPU is done consuming the
+  ///             descriptor sets allocated from the pool; in practice this
+  ///             holds because |DescriptorPoolVK| rides along with the frame's
+  ///             |TrackedObjectsVK| until its fence signals.
+  ///
+  /// @param[in]  pool  The pool (and its capacities) to recycle.
+  void Reclaim(DescriptorPoolAndCapacityVK&& pool);
+
+ private:
+  std::weak_ptr<ContextVK> context_;
+
+  Mutex recycled_mutex_;
+  std::vector<DescriptorPoolAndCapacityVK> recycled_
+      IPLR_GUARDED_BY(recycled_mutex_);
+
+  /// @brief      Creates a new |vk::DescriptorPool| with the given capacities.
+  ///
+  /// @returns    Returns a default instance if a pool could not be created.
+  DescriptorPoolAndCapacityVK Create(uint32_t image_capacity,
+                                     uint32_t buffer_capacity);
+
+  /// @brief      Reuses a recycled |vk::DescriptorPool| with at least the
+  ///             given capacities, if one is available.
+  ///
+  /// @returns    Returns a |std::nullopt| if no suitable pool was available.
+  std::optional<DescriptorPoolAndCapacityVK> Reuse(uint32_t image_capacity,
+                                                   uint32_t buffer_capacity);
+
+  DescriptorPoolRecyclerVK(const DescriptorPoolRecyclerVK&) = delete;
+
+  DescriptorPoolRecyclerVK& operator=(const DescriptorPoolRecyclerVK&) =
+      delete;
+};
+
 }  // namespace impeller
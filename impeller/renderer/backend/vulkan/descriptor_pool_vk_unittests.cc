@@ -0,0 +1,62 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/testing/testing.h"  // IWYU pragma: keep.
+#include "impeller/renderer/backend/vulkan/descriptor_pool_vk.h"
+#include "impeller/renderer/backend/vulkan/test/mock_vulkan.h"
+
+namespace impeller {
+namespace testing {
+
+TEST(DescriptorPoolRecyclerVKTest, ReclaimMakesDescriptorPoolAvailable) {
+  auto const context = MockVulkanContextBuilder().Build();
+  auto const recycler = context->GetDescriptorPoolRecycler();
+
+  {
+    // Fetch a pool (which will be created) and hand it back, as a frame
+    // whose fence signaled would.
+    auto pool = recycler->Get(/*image_capacity=*/16u, /*buffer_capacity=*/16u);
+    ASSERT_TRUE(!!pool.pool);
+    recycler->Reclaim(std::move(pool));
+  }
+
+  // An equal or smaller request must reuse the reclaimed pool instead of
+  // creating a new one.
+  auto const pool =
+      recycler->Get(/*image_capacity=*/8u, /*buffer_capacity=*/16u);
+  EXPECT_TRUE(!!pool.pool);
+
+  auto const called = GetMockVulkanFunctions(context->GetDevice());
+  EXPECT_EQ(
+      std::count(called->begin(), called->end(), "vkCreateDescriptorPool"), 1u);
+  EXPECT_EQ(std::count(called->begin(), called->end(), "vkResetDescriptorPool"),
+            1u);
+
+  context->Shutdown();
+}
+
+TEST(DescriptorPoolRecyclerVKTest, LargerRequestCreatesNewPool) {
+  auto const context = MockVulkanContextBuilder().Build();
+  auto const recycler = context->GetDescriptorPoolRecycler();
+
+  {
+    auto pool = recycler->Get(/*image_capacity=*/16u, /*buffer_capacity=*/16u);
+    ASSERT_TRUE(!!pool.pool);
+    recycler->Reclaim(std::move(pool));
+  }
+
+  // The reclaimed pool cannot service a larger request.
+  auto const pool =
+      recycler->Get(/*image_capacity=*/32u, /*buffer_capacity=*/16u);
+  EXPECT_TRUE(!!pool.pool);
+
+  auto const called = GetMockVulkanFunctions(context->GetDevice());
+  EXPECT_EQ(
+      std::count(called->begin(), called->end(), "vkCreateDescriptorPool"), 2u);
+
+  context->Shutdown();
+}
+
+}  // namespace testing
+}  // namespace impeller
@@ -61,6 +61,7 @@ void GPUTracerVK::MarkFrameEnd() {
 
   state.pending_buffers = 0;
   state.current_index = 0;
+  state.passes.clear();
   in_frame_ = false;
 }
 
@@ -134,6 +135,62 @@ void GPUTracerVK::RecordCmdBufferEnd(const vk::CommandBuffer& buffer,
   }
 }
 
+void GPUTracerVK::RecordPassStart(const vk::CommandBuffer& buffer,
+                                  GPUProbe& probe,
+                                  std::string_view label) {
+  if (!enabled_ || std::this_thread::get_id() != raster_thread_id_ ||
+      !in_frame_) {
+    return;
+  }
+  Lock lock(trace_state_mutex_);
+  GPUTraceState& state = trace_states_[current_state_];
+
+  // Pass timestamps are only useful if the cmd buffer initialized the query
+  // pool and recorded its own start timestamp.
+  if (!state.query_pool || !probe.index_.has_value() ||
+      state.current_index >= kPoolSize) {
+    return;
+  }
+
+  GPUPassRecord record;
+  record.label = label.empty() ? "UnlabeledPass" : std::string{label};
+  record.start_index = state.current_index;
+  record.end_index = record.start_index;
+
+  buffer.writeTimestamp(vk::PipelineStageFlagBits::eBottomOfPipe,
+                        state.query_pool.get(), state.current_index);
+  state.current_index += 1;
+
+  probe.pending_pass_ = state.passes.size();
+  state.passes.emplace_back(std::move(record));
+}
+
+void GPUTracerVK::RecordPassEnd(const vk::CommandBuffer& buffer,
+                                GPUProbe& probe) {
+  if (!enabled_ || std::this_thread::get_id() != raster_thread_id_ ||
+      !in_frame_) {
+    return;
+  }
+  Lock lock(trace_state_mutex_);
+  GPUTraceState& state = trace_states_[current_state_];
+
+  if (!probe.pending_pass_.has_value()) {
+    return;
+  }
+  auto pass_index = probe.pending_pass_.value();
+  probe.pending_pass_ = std::nullopt;
+
+  if (!state.query_pool || pass_index >= state.passes.size() ||
+      state.current_index >= kPoolSize) {
+    return;
+  }
+
+  buffer.writeTimestamp(vk::PipelineStageFlagBits::eBottomOfPipe,
+                        state.query_pool.get(), state.current_index);
+  state.passes[pass_index].end_index = state.current_index;
+  state.current_index += 1;
+}
+
 void GPUTracerVK::OnFenceComplete(size_t frame_index) {
   if (!enabled_) {
     return;
@@ -176,6 +233,22 @@ void GPUTracerVK::OnFenceComplete(size_t frame_index) {
     FML_TRACE_COUNTER("flutter", "GPUTracer",
                       reinterpret_cast<int64_t>(this),  // Trace Counter ID
                       "FrameTimeMS", gpu_ms);
+
+    // Attribute GPU time to the individual render and blit passes of the
+    // frame using their debug labels.
+    for (const auto& pass : state.passes) {
+      if (pass.end_index <= pass.start_index || pass.end_index >= bits.size()) {
+        continue;
+      }
+      auto pass_ms =
+          ((bits[pass.end_index] - bits[pass.start_index]) *
+           timestamp_period_) /
+          1000000;
+      TRACE_EVENT_INSTANT2("flutter", "GPUPassTime", "PassLabel",
+                           pass.label.c_str(), "GPUMilliseconds",
+                           std::to_string(pass_ms).c_str());
+    }
+    state.passes.clear();
   }
 }
 
@@ -209,4 +282,21 @@ void GPUProbe::RecordCmdBufferEnd(const vk::CommandBuffer& buffer) {
   tracer->RecordCmdBufferEnd(buffer, *this);
 }
 
+void GPUProbe::RecordPassStart(const vk::CommandBuffer& buffer,
+                               std::string_view label) {
+  auto tracer = tracer_.lock();
+  if (!tracer) {
+    return;
+  }
+  tracer->RecordPassStart(buffer, *this, label);
+}
+
+void GPUProbe::RecordPassEnd(const vk::CommandBuffer& buffer) {
+  auto tracer = tracer_.lock();
+  if (!tracer) {
+    return;
+  }
+  tracer->RecordPassEnd(buffer, *this);
+}
+
 }  // namespace impeller
@@ -3,7 +3,10 @@
 // found in the LICENSE file.
 
 #include <memory>
+#include <string>
+#include <string_view>
 #include <thread>
+#include <vector>
 
 #include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/device_holder.h"
@@ -55,11 +58,30 @@ class GPUTracerVK : public std::enable_shared_from_this<GPUTracerVK> {
   ///        time.
   void RecordCmdBufferEnd(const vk::CommandBuffer& buffer, GPUProbe& probe);
 
+  /// @brief Record a labeled timestamp query denoting the start of a render or
+  ///        blit pass.
+  void RecordPassStart(const vk::CommandBuffer& buffer,
+                       GPUProbe& probe,
+                       std::string_view label);
+
+  /// @brief Record a timestamp query denoting the end of the pass started by
+  ///        the last [RecordPassStart] on this probe.
+  void RecordPassEnd(const vk::CommandBuffer& buffer, GPUProbe& probe);
+
   const std::shared_ptr<DeviceHolder> device_holder_;
 
+  /// @brief A labeled pair of timestamp indices attributed to a single render
+  ///        or blit pass within the frame workload.
+  struct GPUPassRecord {
+    std::string label;
+    size_t start_index = 0;
+    size_t end_index = 0;
+  };
+
   struct GPUTraceState {
     size_t current_index = 0;
     size_t pending_buffers = 0;
+    std::vector<GPUPassRecord> passes;
     vk::UniqueQueryPool query_pool;
   };
 
@@ -103,11 +125,21 @@ class GPUProbe {
   ///        time.
   void RecordCmdBufferEnd(const vk::CommandBuffer& buffer);
 
+  /// @brief Record a labeled timestamp query denoting the start of a render or
+  ///        blit pass. The elapsed GPU time of the pass is reported with its
+  ///        label once the frame workload completes.
+  void RecordPassStart(const vk::CommandBuffer& buffer, std::string_view label);
+
+  /// @brief Record a timestamp query denoting the end of the pass started by
+  ///        the last [RecordPassStart].
+  void RecordPassEnd(const vk::CommandBuffer& buffer);
+
  private:
   friend class GPUTracerVK;
 
   std::weak_ptr<GPUTracerVK> tracer_;
   std::optional<size_t> index_ = std::nullopt;
+  std::optional<size_t> pending_pass_ = std::nullopt;
 };
 
 }  // namespace impeller
@@ -6,7 +6,10 @@
 
 #include "impeller/renderer/backend/vulkan/pipeline_cache_vk.h"
 
+#include <array>
+#include <cstring>
 #include <sstream>
+#include <vector>
 
 #include "flutter/fml/mapping.h"
 #include "impeller/base/validation.h"
@@ -16,19 +19,91 @@ namespace impeller {
 static constexpr const char* kPipelineCacheFileName =
     "flutter.impeller.vkcache";
 
+//------------------------------------------------------------------------------
+/// The metadata prepended to the driver supplied cache blob before it is
+/// persisted to disk. The driver embeds a similar header in the blob itself,
+/// but drivers have historically been unreliable about rejecting caches
+/// created by a different device or driver revision. Check ourselves before
+/// handing the data back to the driver.
+///
+struct PipelineCacheHeaderVK {
+  static constexpr uint32_t kExpectedMagic = 0x766B6366;  // 'vkcf'
+
+  uint32_t magic = kExpectedMagic;
+  uint32_t abi = sizeof(void*);
+  uint64_t data_size = 0u;
+  uint32_t vendor_id = 0u;
+  uint32_t device_id = 0u;
+  uint32_t driver_version = 0u;
+  std::array<uint8_t, VK_UUID_SIZE> uuid = {};
+
+  PipelineCacheHeaderVK() = default;
+
+  PipelineCacheHeaderVK(const vk::PhysicalDeviceProperties& props,
+                        uint64_t p_data_size)
+      : data_size(p_data_size),
+        vendor_id(props.vendorID),
+        device_id(props.deviceID),
+        driver_version(props.driverVersion) {
+    std::memcpy(uuid.data(), props.pipelineCacheUUID.data(), uuid.size());
+  }
+
+  bool IsCompatibleWith(const PipelineCacheHeaderVK& o) const {
+    return magic == o.magic &&                    //
+           abi == o.abi &&                        //
+           vendor_id == o.vendor_id &&            //
+           device_id == o.device_id &&            //
+           driver_version == o.driver_version &&  //
+           uuid == o.uuid;
+  }
+};
+
 static bool VerifyExistingCache(const fml::Mapping& mapping,
                                 const CapabilitiesVK& caps) {
+  if (mapping.GetSize() < sizeof(PipelineCacheHeaderVK)) {
+    return false;
+  }
+  PipelineCacheHeaderVK persisted;
+  std::memcpy(&persisted, mapping.GetMapping(), sizeof(persisted));
+  const PipelineCacheHeaderVK current(
+      caps.GetPhysicalDeviceProperties(),
+      mapping.GetSize() - sizeof(PipelineCacheHeaderVK));
+  if (!persisted.IsCompatibleWith(current)) {
+    FML_LOG(INFO) << "Existing pipeline cache was created by a different "
+                     "device or driver version. Starting with a fresh cache.";
+    return false;
+  }
+  if (persisted.data_size != current.data_size) {
+    FML_LOG(INFO) << "Existing pipeline cache was truncated. Starting with a "
+                     "fresh cache.";
+    return false;
+  }
   return true;
 }
 
 static std::shared_ptr<fml::Mapping> DecorateCacheWithMetadata(
-    std::shared_ptr<fml::Mapping> data) {
-  return data;
+    const vk::PhysicalDeviceProperties& props,
+    const std::shared_ptr<fml::Mapping>& data) {
+  const PipelineCacheHeaderVK header(props, data->GetSize());
+  auto buffer = std::make_shared<std::vector<uint8_t>>();
+  buffer->reserve(sizeof(header) + data->GetSize());
+  const auto* header_bytes = reinterpret_cast<const uint8_t*>(&header);
+  buffer->insert(buffer->end(), header_bytes, header_bytes + sizeof(header));
+  buffer->insert(buffer->end(), data->GetMapping(),
+                 data->GetMapping() + data->GetSize());
+  return std::make_shared<fml::NonOwnedMapping>(
+      buffer->data(), buffer->size(), [buffer](auto, auto) {});
 }
 
 static std::unique_ptr<fml::Mapping> RemoveMetadataFromCache(
     std::unique_ptr<fml::Mapping> data) {
-  return data;
+  // The caller has already verified that the mapping is at least as large as
+  // the header.
+  std::shared_ptr<fml::Mapping> shared_data = std::move(data);
+  return std::make_unique<fml::NonOwnedMapping>(
+      shared_data->GetMapping() + sizeof(PipelineCacheHeaderVK),
+      shared_data->GetSize() - sizeof(PipelineCacheHeaderVK),
+      [shared_data](auto, auto) {});
 }
 
 static std::unique_ptr<fml::Mapping> OpenCacheFile(
@@ -175,7 +250,8 @@ void PipelineCacheVK::PersistCacheToDisk() const {
     VALIDATION_LOG << "Could not copy pipeline cache data.";
     return;
   }
-  data = DecorateCacheWithMetadata(std::move(data));
+  data = DecorateCacheWithMetadata(
+      CapabilitiesVK::Cast(*caps_).GetPhysicalDeviceProperties(), data);
   if (!data) {
     VALIDATION_LOG
         << "Could not decorate pipeline cache with additional metadata.";
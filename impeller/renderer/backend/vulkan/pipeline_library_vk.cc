@@ -4,10 +4,12 @@
 
 #include "impeller/renderer/backend/vulkan/pipeline_library_vk.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <optional>
 #include <sstream>
+#include <utility>
 
 #include "flutter/fml/container.h"
 #include "flutter/fml/trace_event.h"
@@ -40,7 +42,24 @@ PipelineLibraryVK::PipelineLibraryVK(
   is_valid_ = true;
 }
 
-PipelineLibraryVK::~PipelineLibraryVK() = default;
+PipelineLibraryVK::~PipelineLibraryVK() {
+  // Persist whatever the driver compiled this session so the next launch
+  // starts with warm PSOs, even if the session ended before the periodic
+  // persist task had a chance to run. This is a no-op if the device has
+  // already been collected.
+  if (pso_cache_->IsValid()) {
+    pso_cache_->PersistCacheToDisk();
+  }
+
+  // Workers that outlive the library bail out without creating their pending
+  // pipelines; satisfy the promises here so waiters don't see a broken
+  // future.
+  Lock lock(pending_pipelines_mutex_);
+  for (auto& pending : pending_pipelines_) {
+    pending.promise->set_value(nullptr);
+  }
+  pending_pipelines_.clear();
+}
 
 // |PipelineLibrary|
 bool PipelineLibraryVK::IsValid() const {
@@ -311,11 +330,18 @@ std::unique_ptr<PipelineVK> PipelineLibraryVK::CreatePipeline(
     specialization_info.setPData(constants.data());
     specialization_info.setDataSize(sizeof(int32_t) * constants.size());
 
+    const vk::ShaderModule& module =
+        ShaderFunctionVK::Cast(entrypoint.second.get())->GetModule();
+    if (!module) {
+      VALIDATION_LOG << "Could not create shader module for pipeline: "
+                     << desc.GetLabel();
+      return nullptr;
+    }
+
     vk::PipelineShaderStageCreateInfo info;
     info.setStage(stage.value());
     info.setPName("main");
-    info.setModule(
-        ShaderFunctionVK::Cast(entrypoint.second.get())->GetModule());
+    info.setModule(module);
     info.setPSpecializationInfo(&specialization_info);
     shader_stages.push_back(info);
     entrypoint_count++;
@@ -532,10 +558,18 @@ std::unique_ptr<ComputePipelineVK> PipelineLibraryVK::CreateComputePipeline(
   specialization_info.dataSize = sizeof(uint32_t);
   specialization_info.pData = &workgroup_size_x;
 
+  const vk::ShaderModule& module =
+      ShaderFunctionVK::Cast(entrypoint.get())->GetModule();
+  if (!module) {
+    VALIDATION_LOG << "Could not create compute shader module for pipeline: "
+                   << desc.GetLabel();
+    return nullptr;
+  }
+
   vk::PipelineShaderStageCreateInfo info;
   info.setStage(vk::ShaderStageFlagBits::eCompute);
   info.setPName("main");
-  info.setModule(ShaderFunctionVK::Cast(entrypoint.get())->GetModule());
+  info.setModule(module);
   info.setPSpecializationInfo(&specialization_info);
   pipeline_info.setStage(info);
 
@@ -605,8 +639,21 @@ std::unique_ptr<ComputePipelineVK> PipelineLibraryVK::CreateComputePipeline(
 // |PipelineLibrary|
 PipelineFuture<PipelineDescriptor> PipelineLibraryVK::GetPipeline(
     PipelineDescriptor descriptor) {
+  // Callers on the plain interface are about to encode with the pipeline.
+  return GetPipeline(std::move(descriptor),
+                     PipelineCreationPriority::kFrameBlocking);
+}
+
+// |PipelineLibrary|
+PipelineFuture<PipelineDescriptor> PipelineLibraryVK::GetPipeline(
+    PipelineDescriptor descriptor,
+    PipelineCreationPriority priority) {
   Lock lock(pipelines_mutex_);
   if (auto found = pipelines_.find(descriptor); found != pipelines_.end()) {
+    // The pipeline may still be queued behind lower priority work; re-rank it
+    // in case a request the frame is now blocked on was first seen as
+    // speculative.
+    RaisePendingPriority(descriptor, priority);
     return found->second;
   }
 
@@ -622,28 +669,72 @@ PipelineFuture<PipelineDescriptor> PipelineLibraryVK::GetPipeline(
       PipelineFuture<PipelineDescriptor>{descriptor, promise->get_future()};
   pipelines_[descriptor] = pipeline_future;
 
-  auto weak_this = weak_from_this();
+  {
+    Lock queue_lock(pending_pipelines_mutex_);
+    pending_pipelines_.push_back(PendingPipeline{
+        .descriptor = std::move(descriptor),
+        .promise = std::move(promise),
+        .priority = priority,
+        .sequence = pending_pipeline_sequence_++,
+    });
+  }
 
-  worker_task_runner_->PostTask([descriptor, weak_this, promise]() {
+  // Each task drains whichever pending entry ranks highest when the worker
+  // gets to it, not necessarily the one posted with it.
+  auto weak_this = weak_from_this();
+  worker_task_runner_->PostTask([weak_this]() {
     auto thiz = weak_this.lock();
     if (!thiz) {
-      promise->set_value(nullptr);
       VALIDATION_LOG << "Pipeline library was collected before the pipeline "
                         "could be created.";
       return;
     }
+    PipelineLibraryVK::Cast(*thiz).CreateNextPendingPipeline();
+  });
 
-    auto pipeline = PipelineLibraryVK::Cast(*thiz).CreatePipeline(descriptor);
-    if (!pipeline) {
-      promise->set_value(nullptr);
-      VALIDATION_LOG << "Could not create pipeline: " << descriptor.GetLabel();
+  return pipeline_future;
+}
+
+void PipelineLibraryVK::CreateNextPendingPipeline() {
+  PendingPipeline pending;
+  {
+    Lock lock(pending_pipelines_mutex_);
+    if (pending_pipelines_.empty()) {
       return;
     }
+    auto next = std::min_element(
+        pending_pipelines_.begin(), pending_pipelines_.end(),
+        [](const PendingPipeline& lhs, const PendingPipeline& rhs) {
+          return std::make_pair(lhs.priority, lhs.sequence) <
+                 std::make_pair(rhs.priority, rhs.sequence);
+        });
+    pending = std::move(*next);
+    pending_pipelines_.erase(next);
+  }
 
-    promise->set_value(std::move(pipeline));
-  });
+  auto pipeline = CreatePipeline(pending.descriptor);
+  if (!pipeline) {
+    pending.promise->set_value(nullptr);
+    VALIDATION_LOG << "Could not create pipeline: "
+                   << pending.descriptor.GetLabel();
+    return;
+  }
 
-  return pipeline_future;
+  pending.promise->set_value(std::move(pipeline));
+}
+
+void PipelineLibraryVK::RaisePendingPriority(
+    const PipelineDescriptor& descriptor,
+    PipelineCreationPriority priority) {
+  Lock lock(pending_pipelines_mutex_);
+  for (auto& pending : pending_pipelines_) {
+    if (pending.descriptor.IsEqual(descriptor)) {
+      if (priority < pending.priority) {
+        pending.priority = priority;
+      }
+      return;
+    }
+  }
 }
 
 // |PipelineLibrary|
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <atomic>
+#include <vector>
 
 #include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
@@ -34,6 +35,20 @@ class PipelineLibraryVK final
  private:
   friend ContextVK;
 
+  //----------------------------------------------------------------------------
+  /// A pipeline whose creation has been requested but not yet picked up by a
+  /// worker. Workers pop the highest priority entry at the time they run, so
+  /// a frame-blocking request posted after a batch of speculative warm-up
+  /// work still compiles first.
+  struct PendingPipeline {
+    PipelineDescriptor descriptor;
+    std::shared_ptr<std::promise<std::shared_ptr<Pipeline<PipelineDescriptor>>>>
+        promise;
+    PipelineCreationPriority priority = PipelineCreationPriority::kSpeculative;
+    /// Preserves FIFO ordering within a priority tier.
+    uint64_t sequence = 0u;
+  };
+
   std::weak_ptr<DeviceHolder> device_holder_;
   std::shared_ptr<PipelineCacheVK> pso_cache_;
   std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner_;
@@ -42,6 +57,11 @@ class PipelineLibraryVK final
   Mutex compute_pipelines_mutex_;
   ComputePipelineMap compute_pipelines_
       IPLR_GUARDED_BY(compute_pipelines_mutex_);
+  Mutex pending_pipelines_mutex_;
+  std::vector<PendingPipeline> pending_pipelines_
+      IPLR_GUARDED_BY(pending_pipelines_mutex_);
+  uint64_t pending_pipeline_sequence_ IPLR_GUARDED_BY(
+      pending_pipelines_mutex_) = 0u;
   std::atomic_size_t frames_acquired_ = 0u;
   bool is_valid_ = false;
 
@@ -58,6 +78,11 @@ class PipelineLibraryVK final
   PipelineFuture<PipelineDescriptor> GetPipeline(
       PipelineDescriptor descriptor) override;
 
+  // |PipelineLibrary|
+  PipelineFuture<PipelineDescriptor> GetPipeline(
+      PipelineDescriptor descriptor,
+      PipelineCreationPriority priority) override;
+
   // |PipelineLibrary|
   PipelineFuture<ComputePipelineDescriptor> GetPipeline(
       ComputePipelineDescriptor descriptor) override;
@@ -68,6 +93,11 @@ class PipelineLibraryVK final
 
   std::unique_ptr<PipelineVK> CreatePipeline(const PipelineDescriptor& desc);
 
+  void CreateNextPendingPipeline();
+
+  void RaisePendingPriority(const PipelineDescriptor& descriptor,
+                            PipelineCreationPriority priority);
+
   std::unique_ptr<ComputePipelineVK> CreateComputePipeline(
       const ComputePipelineDescriptor& desc);
 
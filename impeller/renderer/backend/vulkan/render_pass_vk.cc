@@ -18,6 +18,7 @@
 #include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/device_buffer_vk.h"
 #include "impeller/renderer/backend/vulkan/formats_vk.h"
+#include "impeller/renderer/backend/vulkan/gpu_tracer_vk.h"
 #include "impeller/renderer/backend/vulkan/pipeline_vk.h"
 #include "impeller/renderer/backend/vulkan/shared_object_vk.h"
 #include "impeller/renderer/backend/vulkan/texture_vk.h"
@@ -94,11 +95,115 @@ static void SetTextureLayout(
   texture_vk.SetLayoutWithoutEncoding(attachment_desc.finalLayout);
 }
 
-SharedHandleVK<vk::RenderPass> RenderPassVK::CreateVKRenderPass(
+static bool AttachmentDescriptionsEqual(const vk::AttachmentDescription& a,
+                                        const vk::AttachmentDescription& b) {
+  return a.flags == b.flags && a.format == b.format && a.samples == b.samples &&
+         a.loadOp == b.loadOp && a.storeOp == b.storeOp &&
+         a.stencilLoadOp == b.stencilLoadOp &&
+         a.stencilStoreOp == b.stencilStoreOp &&
+         a.initialLayout == b.initialLayout && a.finalLayout == b.finalLayout;
+}
+
+// Whether cached pass objects can service a pass with the given attachment
+// configuration. Load/store ops and layouts do not affect render pass
+// compatibility per the spec, but they do change what the pass does, so an
+// exact match is required.
+static bool CanReuseRenderPassData(const RenderPassDataVK& cached,
+                                   const RenderPassDataVK& current) {
+  if (!cached.render_pass || !cached.framebuffer) {
+    return false;
+  }
+  if (cached.target_size != current.target_size ||
+      cached.attachment_views != current.attachment_views ||
+      cached.attachment_descriptions.size() !=
+          current.attachment_descriptions.size()) {
+    return false;
+  }
+  for (size_t i = 0u; i < cached.attachment_descriptions.size(); i++) {
+    if (!AttachmentDescriptionsEqual(cached.attachment_descriptions[i],
+                                     current.attachment_descriptions[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::shared_ptr<const RenderPassDataVK> RenderPassVK::ResolveRenderPassData(
     const ContextVK& context,
     const std::shared_ptr<CommandBufferVK>& command_buffer) const {
-  std::vector<vk::AttachmentDescription> attachments;
+  auto data = std::make_shared<RenderPassDataVK>();
+  data->target_size = render_target_.GetRenderTargetSize();
+
+  // The layout transitions performed by |SetTextureLayout| must be emitted
+  // for every pass, whether or not the pass objects end up being reused.
+  auto add_attachment =
+      [&](const Attachment& attachment,
+          const std::shared_ptr<Texture> Attachment::*texture_ptr) {
+        data->attachment_descriptions.emplace_back(
+            CreateAttachmentDescription(attachment, texture_ptr));
+        SetTextureLayout(attachment, data->attachment_descriptions.back(),
+                         command_buffer, texture_ptr);
+        data->attachment_views.emplace_back(
+            TextureVK::Cast(*(attachment.*texture_ptr)).GetImageView());
+      };
+
+  // This order must be consistent between the render pass and the
+  // framebuffer: color attachments (each followed by its resolve), then
+  // depth, then stencil.
+  for (const auto& [_, color] : render_target_.GetColorAttachments()) {
+    add_attachment(color, &Attachment::texture);
+    if (color.resolve_texture) {
+      add_attachment(color, &Attachment::resolve_texture);
+    }
+  }
+  if (auto depth = render_target_.GetDepthAttachment(); depth.has_value()) {
+    add_attachment(depth.value(), &Attachment::texture);
+  }
+  if (auto stencil = render_target_.GetStencilAttachment();
+      stencil.has_value()) {
+    add_attachment(stencil.value(), &Attachment::texture);
+  }
 
+  // The first color attachment hosts the cache since it is stable from frame
+  // to frame for both swapchain images (the MSAA texture is remembered on the
+  // swapchain image) and offscreen targets recycled by the render target
+  // cache.
+  const TextureVK* cache_host = nullptr;
+  const auto& color_attachments = render_target_.GetColorAttachments();
+  if (!color_attachments.empty() && color_attachments.begin()->second.texture) {
+    cache_host = &TextureVK::Cast(*color_attachments.begin()->second.texture);
+  }
+
+  if (cache_host != nullptr) {
+    if (auto cached = cache_host->GetCachedRenderPassData();
+        cached && CanReuseRenderPassData(*cached, *data)) {
+      return cached;
+    }
+  }
+
+  data->render_pass =
+      CreateVKRenderPass(context, data->attachment_descriptions);
+  if (!data->render_pass) {
+    VALIDATION_LOG << "Could not create renderpass.";
+    return nullptr;
+  }
+
+  data->framebuffer = CreateVKFramebuffer(context, *data);
+  if (!data->framebuffer) {
+    VALIDATION_LOG << "Could not create framebuffer.";
+    return nullptr;
+  }
+
+  if (cache_host != nullptr) {
+    cache_host->SetCachedRenderPassData(data);
+  }
+
+  return data;
+}
+
+SharedHandleVK<vk::RenderPass> RenderPassVK::CreateVKRenderPass(
+    const ContextVK& context,
+    const std::vector<vk::AttachmentDescription>& attachments) const {
   std::vector<vk::AttachmentReference> color_refs;
   std::vector<vk::AttachmentReference> resolve_refs;
   vk::AttachmentReference depth_stencil_ref = kUnusedAttachmentReference;
@@ -116,43 +221,29 @@ SharedHandleVK<vk::RenderPass> RenderPassVK::CreateVKRenderPass(
   resolve_refs.resize(render_target_.GetMaxColorAttacmentBindIndex() + 1u,
                       kUnusedAttachmentReference);
 
+  // Attachment indices mirror the order the descriptions were added in
+  // |ResolveRenderPassData|.
+  size_t attachment_index = 0u;
   for (const auto& [bind_point, color] : render_target_.GetColorAttachments()) {
     color_refs[bind_point] =
-        vk::AttachmentReference{static_cast<uint32_t>(attachments.size()),
+        vk::AttachmentReference{static_cast<uint32_t>(attachment_index++),
                                 vk::ImageLayout::eColorAttachmentOptimal};
-    attachments.emplace_back(
-        CreateAttachmentDescription(color, &Attachment::texture));
-    SetTextureLayout(color, attachments.back(), command_buffer,
-                     &Attachment::texture);
     if (color.resolve_texture) {
       resolve_refs[bind_point] = vk::AttachmentReference{
-          static_cast<uint32_t>(attachments.size()), vk::ImageLayout::eGeneral};
-      attachments.emplace_back(
-          CreateAttachmentDescription(color, &Attachment::resolve_texture));
-      SetTextureLayout(color, attachments.back(), command_buffer,
-                       &Attachment::resolve_texture);
+          static_cast<uint32_t>(attachment_index++), vk::ImageLayout::eGeneral};
     }
   }
 
-  if (auto depth = render_target_.GetDepthAttachment(); depth.has_value()) {
+  if (render_target_.GetDepthAttachment().has_value()) {
     depth_stencil_ref = vk::AttachmentReference{
-        static_cast<uint32_t>(attachments.size()),
+        static_cast<uint32_t>(attachment_index++),
         vk::ImageLayout::eDepthStencilAttachmentOptimal};
-    attachments.emplace_back(
-        CreateAttachmentDescription(depth.value(), &Attachment::texture));
-    SetTextureLayout(depth.value(), attachments.back(), command_buffer,
-                     &Attachment::texture);
   }
 
-  if (auto stencil = render_target_.GetStencilAttachment();
-      stencil.has_value()) {
+  if (render_target_.GetStencilAttachment().has_value()) {
     depth_stencil_ref = vk::AttachmentReference{
-        static_cast<uint32_t>(attachments.size()),
+        static_cast<uint32_t>(attachment_index++),
         vk::ImageLayout::eDepthStencilAttachmentOptimal};
-    attachments.emplace_back(
-        CreateAttachmentDescription(stencil.value(), &Attachment::texture));
-    SetTextureLayout(stencil.value(), attachments.back(), command_buffer,
-                     &Attachment::texture);
   }
 
   vk::SubpassDescription subpass_desc;
@@ -237,39 +328,19 @@ static std::vector<vk::ClearValue> GetVKClearValues(
 
 SharedHandleVK<vk::Framebuffer> RenderPassVK::CreateVKFramebuffer(
     const ContextVK& context,
-    const vk::RenderPass& pass) const {
+    const RenderPassDataVK& data) const {
   vk::FramebufferCreateInfo fb_info;
 
-  fb_info.renderPass = pass;
+  fb_info.renderPass = *data.render_pass;
 
-  const auto target_size = render_target_.GetRenderTargetSize();
-  fb_info.width = target_size.width;
-  fb_info.height = target_size.height;
+  fb_info.width = data.target_size.width;
+  fb_info.height = data.target_size.height;
 
   fb_info.layers = 1u;
 
-  std::vector<vk::ImageView> attachments;
-
-  // This bit must be consistent to ensure compatibility with the pass created
-  // earlier. Follow this order: Color attachments, then depth, then stencil.
-  for (const auto& [_, color] : render_target_.GetColorAttachments()) {
-    // The bind point doesn't matter here since that information is present in
-    // the render pass.
-    attachments.emplace_back(TextureVK::Cast(*color.texture).GetImageView());
-    if (color.resolve_texture) {
-      attachments.emplace_back(
-          TextureVK::Cast(*color.resolve_texture).GetImageView());
-    }
-  }
-  if (auto depth = render_target_.GetDepthAttachment(); depth.has_value()) {
-    attachments.emplace_back(TextureVK::Cast(*depth->texture).GetImageView());
-  }
-  if (auto stencil = render_target_.GetStencilAttachment();
-      stencil.has_value()) {
-    attachments.emplace_back(TextureVK::Cast(*stencil->texture).GetImageView());
-  }
-
-  fb_info.setAttachments(attachments);
+  // The bind points don't matter here since that information is present in
+  // the render pass.
+  fb_info.setAttachments(data.attachment_views);
 
   auto [result, framebuffer] =
       context.GetDevice().createFramebufferUnique(fb_info);
@@ -282,7 +353,17 @@ SharedHandleVK<vk::Framebuffer> RenderPassVK::CreateVKFramebuffer(
   return MakeSharedVK(std::move(framebuffer));
 }
 
-static bool UpdateBindingLayouts(const Bindings& bindings,
+static void UpdateBindingLayouts(
+    const Bindings& bindings,
+    const BarrierVK& barrier,
+    std::vector<vk::ImageMemoryBarrier>& image_barriers) {
+  for (const auto& [_, data] : bindings.sampled_images) {
+    TextureVK::Cast(*data.texture.resource)
+        .BatchedSetLayout(barrier, image_barriers);
+  }
+}
+
+static bool UpdateBindingLayouts(const std::vector<Command>& commands,
                                  const vk::CommandBuffer& buffer) {
   // All previous writes via a render or blit pass must be done before another
   // shader attempts to read the resource.
@@ -297,27 +378,27 @@ static bool UpdateBindingLayouts(const Bindings& bindings,
 
   barrier.new_layout = vk::ImageLayout::eShaderReadOnlyOptimal;
 
-  for (const auto& [_, data] : bindings.sampled_images) {
-    if (!TextureVK::Cast(*data.texture.resource).SetLayout(barrier)) {
-      return false;
-    }
-  }
-  return true;
-}
-
-static bool UpdateBindingLayouts(const Command& command,
-                                 const vk::CommandBuffer& buffer) {
-  return UpdateBindingLayouts(command.vertex_bindings, buffer) &&
-         UpdateBindingLayouts(command.fragment_bindings, buffer);
-}
-
-static bool UpdateBindingLayouts(const std::vector<Command>& commands,
-                                 const vk::CommandBuffer& buffer) {
+  // The transitions for all sampled images referenced by the pass are batched
+  // into a single barrier command. Tilers flush and stall on every
+  // vkCmdPipelineBarrier individually, so one barrier covering N images is
+  // substantially cheaper than N consecutive barriers. Images already in the
+  // read-only layout (tracked on the texture source) contribute nothing.
+  std::vector<vk::ImageMemoryBarrier> image_barriers;
   for (const auto& command : commands) {
-    if (!UpdateBindingLayouts(command, buffer)) {
-      return false;
-    }
+    UpdateBindingLayouts(command.vertex_bindings, barrier, image_barriers);
+    UpdateBindingLayouts(command.fragment_bindings, barrier, image_barriers);
   }
+  if (image_barriers.empty()) {
+    return true;
+  }
+
+  buffer.pipelineBarrier(barrier.src_stage,  // src stage
+                         barrier.dst_stage,  // dst stage
+                         {},                 // dependency flags
+                         nullptr,            // memory barriers
+                         nullptr,            // buffer barriers
+                         image_barriers      // image barriers
+  );
   return true;
 }
 
@@ -495,27 +576,21 @@ bool RenderPassVK::OnEncodeCommands(const Context& context) const {
 
   const auto& target_size = render_target_.GetRenderTargetSize();
 
-  auto render_pass = CreateVKRenderPass(vk_context, command_buffer);
-  if (!render_pass) {
-    VALIDATION_LOG << "Could not create renderpass.";
-    return false;
-  }
-
-  auto framebuffer = CreateVKFramebuffer(vk_context, *render_pass);
-  if (!framebuffer) {
-    VALIDATION_LOG << "Could not create framebuffer.";
+  auto pass_data = ResolveRenderPassData(vk_context, command_buffer);
+  if (!pass_data) {
     return false;
   }
 
-  if (!encoder->Track(framebuffer) || !encoder->Track(render_pass)) {
+  if (!encoder->Track(pass_data->framebuffer) ||
+      !encoder->Track(pass_data->render_pass)) {
     return false;
   }
 
   auto clear_values = GetVKClearValues(render_target_);
 
   vk::RenderPassBeginInfo pass_info;
-  pass_info.renderPass = *render_pass;
-  pass_info.framebuffer = *framebuffer;
+  pass_info.renderPass = *pass_data->render_pass;
+  pass_info.framebuffer = *pass_data->framebuffer;
   pass_info.renderArea.extent.width = static_cast<uint32_t>(target_size.width);
   pass_info.renderArea.extent.height =
       static_cast<uint32_t>(target_size.height);
@@ -528,6 +603,10 @@ bool RenderPassVK::OnEncodeCommands(const Context& context) const {
   }
   auto desc_sets = desc_sets_result.value();
 
+  if (auto* probe = encoder->GetGPUProbe()) {
+    probe->RecordPassStart(cmd_buffer, debug_label_);
+  }
+
   {
     TRACE_EVENT0("impeller", "EncodeRenderPassCommands");
     cmd_buffer.beginRenderPass(pass_info, vk::SubpassContents::eInline);
@@ -545,6 +624,10 @@ bool RenderPassVK::OnEncodeCommands(const Context& context) const {
     }
   }
 
+  if (auto* probe = encoder->GetGPUProbe()) {
+    probe->RecordPassEnd(cmd_buffer);
+  }
+
   return true;
 }
 
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "flutter/fml/macros.h"
 #include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/pass_bindings_cache.h"
@@ -15,6 +17,22 @@ namespace impeller {
 
 class CommandBufferVK;
 
+//------------------------------------------------------------------------------
+/// @brief      A |vk::RenderPass| and |vk::Framebuffer| pair along with the
+///             attachment configuration they were created against.
+///
+///             This data is cached on the render target's |TextureVK| (see
+///             |TextureVK::SetCachedRenderPassData|) and reused on subsequent
+///             frames whenever the attachment configuration matches, instead
+///             of re-creating the pass objects for every pass of every frame.
+struct RenderPassDataVK {
+  std::vector<vk::AttachmentDescription> attachment_descriptions;
+  std::vector<vk::ImageView> attachment_views;
+  ISize target_size;
+  SharedHandleVK<vk::RenderPass> render_pass;
+  SharedHandleVK<vk::Framebuffer> framebuffer;
+};
+
 class RenderPassVK final : public RenderPass {
  public:
   // |RenderPass|
@@ -41,13 +59,17 @@ class RenderPassVK final : public RenderPass {
   // |RenderPass|
   bool OnEncodeCommands(const Context& context) const override;
 
-  SharedHandleVK<vk::RenderPass> CreateVKRenderPass(
+  std::shared_ptr<const RenderPassDataVK> ResolveRenderPassData(
       const ContextVK& context,
       const std::shared_ptr<CommandBufferVK>& command_buffer) const;
 
+  SharedHandleVK<vk::RenderPass> CreateVKRenderPass(
+      const ContextVK& context,
+      const std::vector<vk::AttachmentDescription>& attachments) const;
+
   SharedHandleVK<vk::Framebuffer> CreateVKFramebuffer(
       const ContextVK& context,
-      const vk::RenderPass& pass) const;
+      const RenderPassDataVK& data) const;
 
   RenderPassVK(const RenderPassVK&) = delete;
 
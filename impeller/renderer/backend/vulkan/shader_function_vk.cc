@@ -4,6 +4,9 @@
 
 #include "impeller/renderer/backend/vulkan/shader_function_vk.h"
 
+#include "impeller/base/validation.h"
+#include "impeller/renderer/backend/vulkan/context_vk.h"
+
 namespace impeller {
 
 ShaderFunctionVK::ShaderFunctionVK(
@@ -11,9 +14,9 @@ ShaderFunctionVK::ShaderFunctionVK(
     UniqueID parent_library_id,
     std::string name,
     ShaderStage stage,
-    vk::UniqueShaderModule module)
+    std::shared_ptr<fml::Mapping> code)
     : ShaderFunction(parent_library_id, std::move(name), stage),
-      module_(std::move(module)),
+      code_(std::move(code)),
       device_holder_(device_holder) {}
 
 ShaderFunctionVK::~ShaderFunctionVK() {
@@ -26,6 +29,39 @@ ShaderFunctionVK::~ShaderFunctionVK() {
 }
 
 const vk::ShaderModule& ShaderFunctionVK::GetModule() const {
+  // Modules are created lazily so that registering an entire shader archive
+  // only pays for the (typically small) subset of shaders that pipelines
+  // actually reference. Pipelines are built concurrently on worker threads,
+  // so creation is guarded.
+  Lock lock(module_mutex_);
+  if (module_creation_attempted_) {
+    return module_.get();
+  }
+  module_creation_attempted_ = true;
+
+  auto device_holder = device_holder_.lock();
+  if (!device_holder || !code_) {
+    return module_.get();
+  }
+
+  vk::ShaderModuleCreateInfo shader_module_info;
+  shader_module_info.setPCode(
+      reinterpret_cast<const uint32_t*>(code_->GetMapping()));
+  shader_module_info.setCodeSize(code_->GetSize());
+
+  auto module =
+      device_holder->GetDevice().createShaderModuleUnique(shader_module_info);
+  if (module.result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Could not create shader module: "
+                   << vk::to_string(module.result);
+    return module_.get();
+  }
+
+  module_ = std::move(module.value);
+  ContextVK::SetDebugName(device_holder->GetDevice(), *module_,
+                          "Shader " + GetName());
+  // The borrowed SPIR-V is no longer needed once the module exists.
+  code_ = nullptr;
   return module_.get();
 }
 
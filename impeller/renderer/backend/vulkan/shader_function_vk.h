@@ -5,7 +5,9 @@
 #pragma once
 
 #include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
 #include "impeller/base/backend_cast.h"
+#include "impeller/base/thread.h"
 #include "impeller/renderer/backend/vulkan/device_holder.h"
 #include "impeller/renderer/backend/vulkan/shader_function_vk.h"
 #include "impeller/renderer/backend/vulkan/vk.h"
@@ -20,19 +22,27 @@ class ShaderFunctionVK final
   // |ShaderFunction|
   ~ShaderFunctionVK() override;
 
+  // Returns the shader module for this function, creating it from the
+  // borrowed SPIR-V mapping the first time a pipeline references the
+  // function. Returns a null module if the module could not be created.
   const vk::ShaderModule& GetModule() const;
 
  private:
   friend class ShaderLibraryVK;
 
-  vk::UniqueShaderModule module_;
+  // The SPIR-V for the function. For archived shaders, this is a view into
+  // the mmapped shader bundle. Released once the module has been created.
+  mutable std::shared_ptr<fml::Mapping> code_;
+  mutable Mutex module_mutex_;
+  mutable vk::UniqueShaderModule module_;
+  mutable bool module_creation_attempted_ = false;
   std::weak_ptr<DeviceHolder> device_holder_;
 
   ShaderFunctionVK(const std::weak_ptr<DeviceHolder>& device_holder,
                    UniqueID parent_library_id,
                    std::string name,
                    ShaderStage stage,
-                   vk::UniqueShaderModule module);
+                   std::shared_ptr<fml::Mapping> code);
 
   ShaderFunctionVK(const ShaderFunctionVK&) = delete;
 
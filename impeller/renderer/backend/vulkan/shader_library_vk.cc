@@ -143,39 +143,22 @@ bool ShaderLibraryVK::RegisterFunction(
     return false;
   }
 
-  vk::ShaderModuleCreateInfo shader_module_info;
-
-  shader_module_info.setPCode(
-      reinterpret_cast<const uint32_t*>(code->GetMapping()));
-  shader_module_info.setCodeSize(code->GetSize());
-
-  auto device_holder = device_holder_.lock();
-  if (!device_holder) {
-    return false;
-  }
-  FML_DCHECK(device_holder->GetDevice());
-  auto module =
-      device_holder->GetDevice().createShaderModuleUnique(shader_module_info);
-
-  if (module.result != vk::Result::eSuccess) {
-    VALIDATION_LOG << "Could not create shader module: "
-                   << vk::to_string(module.result);
+  if (device_holder_.expired()) {
     return false;
   }
 
   const auto key_name = VKShaderNameToShaderKeyName(name, stage);
 
-  vk::UniqueShaderModule shader_module = std::move(module.value);
-  ContextVK::SetDebugName(device_holder->GetDevice(), *shader_module,
-                          "Shader " + name);
-
+  // The function only borrows the mapped SPIR-V (for archived shaders, a
+  // view into the mmapped bundle) and creates its shader module lazily when
+  // a pipeline first references it.
   WriterLock lock(functions_mutex_);
   functions_[ShaderKey{key_name, stage}] = std::shared_ptr<ShaderFunctionVK>(
       new ShaderFunctionVK(device_holder_,
-                           library_id_,              //
-                           key_name,                 //
-                           stage,                    //
-                           std::move(shader_module)  //
+                           library_id_,  //
+                           key_name,     //
+                           stage,        //
+                           code          //
                            ));
 
   return true;
@@ -48,6 +48,11 @@ std::shared_ptr<CommandBuffer> SurfaceContextVK::CreateCommandBuffer() const {
   return parent_->CreateCommandBuffer();
 }
 
+std::shared_ptr<fml::ConcurrentTaskRunner>
+SurfaceContextVK::GetWorkerTaskRunner() const {
+  return parent_->GetWorkerTaskRunner();
+}
+
 const std::shared_ptr<const Capabilities>& SurfaceContextVK::GetCapabilities()
     const {
   return parent_->GetCapabilities();
@@ -88,6 +93,10 @@ std::unique_ptr<Surface> SurfaceContextVK::AcquireNextSurface() {
   return surface;
 }
 
+Matrix SurfaceContextVK::GetCurrentSurfaceTransformation() const {
+  return swapchain_ ? swapchain_->GetSurfaceTransformation() : Matrix{};
+}
+
 void SurfaceContextVK::SetSyncPresentation(bool value) {
   parent_->SetSyncPresentation(value);
 }
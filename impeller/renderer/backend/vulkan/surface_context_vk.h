@@ -7,6 +7,7 @@
 #include <memory>
 
 #include "impeller/base/backend_cast.h"
+#include "impeller/geometry/matrix.h"
 #include "impeller/renderer/backend/vulkan/vk.h"
 #include "impeller/renderer/context.h"
 
@@ -48,6 +49,10 @@ class SurfaceContextVK : public Context,
   // |Context|
   std::shared_ptr<CommandBuffer> CreateCommandBuffer() const override;
 
+  // |Context|
+  std::shared_ptr<fml::ConcurrentTaskRunner> GetWorkerTaskRunner()
+      const override;
+
   // |Context|
   const std::shared_ptr<const Capabilities>& GetCapabilities() const override;
 
@@ -61,6 +66,11 @@ class SurfaceContextVK : public Context,
 
   std::unique_ptr<Surface> AcquireNextSurface();
 
+  /// The transformation the renderer must bake into its output to account
+  /// for swapchain pre-rotation. Identity when there is no swapchain or the
+  /// surface matches the display's natural orientation.
+  Matrix GetCurrentSurfaceTransformation() const;
+
 #ifdef FML_OS_ANDROID
   vk::UniqueSurfaceKHR CreateAndroidSurface(ANativeWindow* window) const;
 #endif  // FML_OS_ANDROID
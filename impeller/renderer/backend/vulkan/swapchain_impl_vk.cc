@@ -121,6 +121,23 @@ static std::optional<vk::CompositeAlphaFlagBitsKHR> ChooseAlphaCompositionMode(
   return std::nullopt;
 }
 
+static vk::PresentModeKHR ChoosePresentMode(
+    const std::vector<vk::PresentModeKHR>& modes,
+    bool prefer_low_latency) {
+  // FIFO is the only mode the spec guarantees. It never tears and lets the
+  // display pipeline idle between vsync pulses, which makes it the low-power
+  // default. Mailbox keeps a single pending image and replaces it whenever a
+  // newer frame is ready, which shaves up to a frame of input-to-photon
+  // latency on high refresh rate displays at the cost of rendering frames
+  // that may never be shown.
+  if (prefer_low_latency &&
+      std::find(modes.begin(), modes.end(), vk::PresentModeKHR::eMailbox) !=
+          modes.end()) {
+    return vk::PresentModeKHR::eMailbox;
+  }
+  return vk::PresentModeKHR::eFifo;
+}
+
 static std::optional<vk::Queue> ChoosePresentQueue(
     const vk::PhysicalDevice& physical_device,
     const vk::Device& device,
@@ -140,17 +157,14 @@ static std::optional<vk::Queue> ChoosePresentQueue(
 std::shared_ptr<SwapchainImplVK> SwapchainImplVK::Create(
     const std::shared_ptr<Context>& context,
     vk::UniqueSurfaceKHR surface,
-    vk::SwapchainKHR old_swapchain,
-    vk::SurfaceTransformFlagBitsKHR last_transform) {
-  return std::shared_ptr<SwapchainImplVK>(new SwapchainImplVK(
-      context, std::move(surface), old_swapchain, last_transform));
+    vk::SwapchainKHR old_swapchain) {
+  return std::shared_ptr<SwapchainImplVK>(
+      new SwapchainImplVK(context, std::move(surface), old_swapchain));
 }
 
-SwapchainImplVK::SwapchainImplVK(
-    const std::shared_ptr<Context>& context,
-    vk::UniqueSurfaceKHR surface,
-    vk::SwapchainKHR old_swapchain,
-    vk::SurfaceTransformFlagBitsKHR last_transform) {
+SwapchainImplVK::SwapchainImplVK(const std::shared_ptr<Context>& context,
+                                 vk::UniqueSurfaceKHR surface,
+                                 vk::SwapchainKHR old_swapchain) {
   if (!context) {
     VALIDATION_LOG << "Cannot create a swapchain without a context.";
     return;
@@ -182,6 +196,17 @@ SwapchainImplVK::SwapchainImplVK(
   }
   vk_context.SetOffscreenFormat(ToPixelFormat(format.value().format));
 
+  auto [modes_result, present_modes] =
+      vk_context.GetPhysicalDevice().getSurfacePresentModesKHR(*surface);
+  if (modes_result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Could not get surface present modes: "
+                   << vk::to_string(modes_result);
+    return;
+  }
+
+  const auto present_mode = ChoosePresentMode(
+      present_modes, vk_context.GetPreferLowLatencyPresentation());
+
   const auto composite =
       ChooseAlphaCompositionMode(caps.supportedCompositeAlpha);
   if (!composite.has_value()) {
@@ -198,29 +223,62 @@ SwapchainImplVK::SwapchainImplVK(
     return;
   }
 
+  // Render pre-rotated when the surface is rotated relative to the display's
+  // natural orientation. Matching the surface's current transform tells the
+  // presentation engine that the content already is in display space, which
+  // lets the compositor scan the image out directly instead of adding a GPU
+  // pass to rotate it. Mirrored transforms are left to the compositor.
+  //
+  // https://developer.android.com/games/optimize/vulkan-prerotation
+  vk::SurfaceTransformFlagBitsKHR pre_transform = caps.currentTransform;
+  switch (pre_transform) {
+    case vk::SurfaceTransformFlagBitsKHR::eIdentity:
+    case vk::SurfaceTransformFlagBitsKHR::eRotate90:
+    case vk::SurfaceTransformFlagBitsKHR::eRotate180:
+    case vk::SurfaceTransformFlagBitsKHR::eRotate270:
+      break;
+    default:
+      pre_transform = vk::SurfaceTransformFlagBitsKHR::eIdentity;
+      break;
+  }
+
+  // With a rotating pre-transform, the image extent is specified in the
+  // display's natural orientation: the dimensions swap for quarter turns.
+  vk::Extent2D current_extent = caps.currentExtent;
+  if (pre_transform == vk::SurfaceTransformFlagBitsKHR::eRotate90 ||
+      pre_transform == vk::SurfaceTransformFlagBitsKHR::eRotate270) {
+    std::swap(current_extent.width, current_extent.height);
+  }
+
   vk::SwapchainCreateInfoKHR swapchain_info;
   swapchain_info.surface = *surface;
   swapchain_info.imageFormat = format.value().format;
   swapchain_info.imageColorSpace = format.value().colorSpace;
-  swapchain_info.presentMode = vk::PresentModeKHR::eFifo;
+  swapchain_info.presentMode = present_mode;
   swapchain_info.imageExtent = vk::Extent2D{
-      std::clamp(caps.currentExtent.width, caps.minImageExtent.width,
+      std::clamp(current_extent.width, caps.minImageExtent.width,
                  caps.maxImageExtent.width),
-      std::clamp(caps.currentExtent.height, caps.minImageExtent.height,
+      std::clamp(current_extent.height, caps.minImageExtent.height,
                  caps.maxImageExtent.height),
   };
-  swapchain_info.minImageCount = std::clamp(
-      caps.minImageCount + 1u,  // preferred image count
-      caps.minImageCount,       // min count cannot be zero
-      caps.maxImageCount == 0u ? caps.minImageCount + 1u
-                               : caps.maxImageCount  // max zero means no limit
-  );
+  // Mailbox presentation needs an extra image over FIFO so that one image can
+  // sit with the presentation engine while another waits to replace it and a
+  // third is being rendered.
+  const uint32_t preferred_image_count =
+      caps.minImageCount +
+      (present_mode == vk::PresentModeKHR::eMailbox ? 2u : 1u);
+  swapchain_info.minImageCount =
+      std::clamp(preferred_image_count,  // preferred image count
+                 caps.minImageCount,     // min count cannot be zero
+                 caps.maxImageCount == 0u
+                     ? preferred_image_count  // max zero means no limit
+                     : caps.maxImageCount);
   swapchain_info.imageArrayLayers = 1u;
   // Swapchain images are primarily used as color attachments (via resolve) or
   // blit targets.
   swapchain_info.imageUsage = vk::ImageUsageFlagBits::eColorAttachment |
                               vk::ImageUsageFlagBits::eTransferDst;
-  swapchain_info.preTransform = vk::SurfaceTransformFlagBitsKHR::eIdentity;
+  swapchain_info.preTransform = pre_transform;
   swapchain_info.compositeAlpha = composite.value();
   // If we set the clipped value to true, Vulkan expects we will never read back
   // from the buffer. This is analogous to [CAMetalLayer framebufferOnly] in
@@ -251,6 +309,7 @@ SwapchainImplVK::SwapchainImplVK(
       static_cast<decltype(texture_desc.usage)>(TextureUsage::kRenderTarget);
   texture_desc.storage_mode = StorageMode::kDevicePrivate;
   texture_desc.format = ToPixelFormat(swapchain_info.imageFormat);
+  texture_desc.resource_class = ResourceClass::kOnscreenTarget;
   texture_desc.size = ISize::MakeWH(swapchain_info.imageExtent.width,
                                     swapchain_info.imageExtent.height);
 
@@ -291,12 +350,16 @@ SwapchainImplVK::SwapchainImplVK(
   surface_ = std::move(surface);
   present_queue_ = present_queue.value();
   surface_format_ = swapchain_info.imageFormat;
+  present_mode_ = present_mode;
+  supported_present_modes_ = std::move(present_modes);
   swapchain_ = std::move(swapchain);
   images_ = std::move(swapchain_images);
   synchronizers_ = std::move(synchronizers);
   current_frame_ = synchronizers_.size() - 1u;
   is_valid_ = true;
-  transform_if_changed_discard_swapchain_ = last_transform;
+  transform_if_changed_discard_swapchain_ = caps.currentTransform;
+  pre_transform_ = pre_transform;
+  extent_ = swapchain_info.imageExtent;
 }
 
 SwapchainImplVK::~SwapchainImplVK() {
@@ -328,8 +391,25 @@ vk::Format SwapchainImplVK::GetSurfaceFormat() const {
   return surface_format_;
 }
 
-vk::SurfaceTransformFlagBitsKHR SwapchainImplVK::GetLastTransform() const {
-  return transform_if_changed_discard_swapchain_;
+Matrix SwapchainImplVK::GetSurfaceTransformation() const {
+  // These are the inverses of the transforms the presentation engine applies:
+  // content rendered with this transformation baked in shows upright after
+  // the engine rotates the pre-rotated image back into surface orientation.
+  const auto width = static_cast<Scalar>(extent_.width);
+  const auto height = static_cast<Scalar>(extent_.height);
+  switch (pre_transform_) {
+    case vk::SurfaceTransformFlagBitsKHR::eRotate90:
+      return Matrix::MakeTranslation({width, 0, 0}) *
+             Matrix::MakeRotationZ(Degrees{90});
+    case vk::SurfaceTransformFlagBitsKHR::eRotate180:
+      return Matrix::MakeTranslation({width, height, 0}) *
+             Matrix::MakeRotationZ(Degrees{180});
+    case vk::SurfaceTransformFlagBitsKHR::eRotate270:
+      return Matrix::MakeTranslation({0, height, 0}) *
+             Matrix::MakeRotationZ(Degrees{270});
+    default:
+      return {};
+  }
 }
 
 std::shared_ptr<Context> SwapchainImplVK::GetContext() const {
@@ -376,6 +456,18 @@ SwapchainImplVK::AcquireResult SwapchainImplVK::AcquireNextDrawable() {
     }
   }
 
+  //----------------------------------------------------------------------------
+  /// Poll to see if the presentation latency preference has changed. The
+  /// preference may be flipped at runtime (say, to drop back to FIFO on a
+  /// static screen to save power) and takes effect by recreating the
+  /// swapchain in the newly desired present mode.
+  ///
+  if (ChoosePresentMode(supported_present_modes_,
+                        context.GetPreferLowLatencyPresentation()) !=
+      present_mode_) {
+    return AcquireResult{true /* out of date */};
+  }
+
   //----------------------------------------------------------------------------
   /// Get the next image index.
   ///
@@ -464,36 +556,44 @@ bool SwapchainImplVK::Present(const std::shared_ptr<SwapchainImageVK>& image,
     }
   }
 
-  //----------------------------------------------------------------------------
-  /// Signal that the presentation semaphore is ready.
-  ///
-  {
-    vk::SubmitInfo submit_info;
-    vk::PipelineStageFlags wait_stage =
-        vk::PipelineStageFlagBits::eColorAttachmentOutput;
-    submit_info.setWaitDstStageMask(wait_stage);
-    submit_info.setWaitSemaphores(*sync->render_ready);
-    submit_info.setSignalSemaphores(*sync->present_ready);
-    submit_info.setCommandBuffers(vk_final_cmd_buffer);
-    auto result =
-        context.GetGraphicsQueue()->Submit(submit_info, *sync->acquire);
-    if (result != vk::Result::eSuccess) {
-      VALIDATION_LOG << "Could not wait on render semaphore: "
-                     << vk::to_string(result);
-      return false;
-    }
-  }
-
   context.GetGPUTracer()->MarkFrameEnd();
 
-  auto task = [&, index, current_frame = current_frame_] {
+  // The final submit and the present are both moved off the raster thread.
+  // vkQueueSubmit and vkQueuePresentKHR can each stall for milliseconds on
+  // mobile drivers and neither produces a result the raster thread needs to
+  // act upon. The queue is safe to access from the submit thread since
+  // |QueueVK| synchronizes access and the presentation engine only observes
+  // semaphores signaled by this very submission.
+  auto task = [&, vk_final_cmd_buffer, index, current_frame = current_frame_] {
     auto context_strong = context_.lock();
     if (!context_strong) {
       return;
     }
 
+    const auto& context = ContextVK::Cast(*context_strong);
     const auto& sync = synchronizers_[current_frame];
 
+    //----------------------------------------------------------------------------
+    /// Signal that the presentation semaphore is ready.
+    ///
+    {
+      vk::SubmitInfo submit_info;
+      vk::PipelineStageFlags wait_stage =
+          vk::PipelineStageFlagBits::eColorAttachmentOutput;
+      submit_info.setWaitDstStageMask(wait_stage);
+      submit_info.setWaitSemaphores(*sync->render_ready);
+      submit_info.setSignalSemaphores(*sync->present_ready);
+      submit_info.setCommandBuffers(vk_final_cmd_buffer);
+      auto result =
+          context.GetGraphicsQueue()->Submit(submit_info, *sync->acquire);
+      if (result != vk::Result::eSuccess) {
+        VALIDATION_LOG << "Could not wait on render semaphore: "
+                       << vk::to_string(result);
+        sync->present_latch->CountDown();
+        return;
+      }
+    }
+
     //----------------------------------------------------------------------------
     /// Present the image.
     ///
@@ -516,10 +616,9 @@ bool SwapchainImplVK::Present(const std::shared_ptr<SwapchainImageVK>& image,
         // complete successfully.
         [[fallthrough]];
       case vk::Result::eSuboptimalKHR:
-        // Even though we're handling rotation changes via polling, we
-        // still need to handle the case where the swapchain signals that
-        // it's suboptimal (i.e. every frame when we are rotated given we
-        // aren't doing Vulkan pre-rotation).
+        // Rotation changes are handled via polling in AcquireNextDrawable,
+        // so a suboptimal signal here only needs to keep the frame alive;
+        // the swapchain is recreated pre-rotated on the next acquire.
         [[fallthrough]];
       case vk::Result::eSuccess:
         return;
@@ -9,6 +9,7 @@
 #include <variant>
 
 #include "flutter/fml/macros.h"
+#include "impeller/geometry/matrix.h"
 #include "impeller/renderer/backend/vulkan/vk.h"
 #include "vulkan/vulkan_enums.hpp"
 
@@ -33,9 +34,7 @@ class SwapchainImplVK final
   static std::shared_ptr<SwapchainImplVK> Create(
       const std::shared_ptr<Context>& context,
       vk::UniqueSurfaceKHR surface,
-      vk::SwapchainKHR old_swapchain = VK_NULL_HANDLE,
-      vk::SurfaceTransformFlagBitsKHR last_transform =
-          vk::SurfaceTransformFlagBitsKHR::eIdentity);
+      vk::SwapchainKHR old_swapchain = VK_NULL_HANDLE);
 
   ~SwapchainImplVK();
 
@@ -55,7 +54,13 @@ class SwapchainImplVK final
 
   vk::Format GetSurfaceFormat() const;
 
-  vk::SurfaceTransformFlagBitsKHR GetLastTransform() const;
+  //----------------------------------------------------------------------------
+  /// @brief      The transformation the renderer must bake into its output so
+  ///             that the swapchain images it pre-rotated for the display's
+  ///             natural orientation show upright. Identity unless the
+  ///             swapchain was created with a rotating pre-transform.
+  ///
+  Matrix GetSurfaceTransformation() const;
 
   std::shared_ptr<Context> GetContext() const;
 
@@ -66,6 +71,8 @@ class SwapchainImplVK final
   vk::UniqueSurfaceKHR surface_;
   vk::Queue present_queue_ = {};
   vk::Format surface_format_ = vk::Format::eUndefined;
+  vk::PresentModeKHR present_mode_ = vk::PresentModeKHR::eFifo;
+  std::vector<vk::PresentModeKHR> supported_present_modes_;
   vk::UniqueSwapchainKHR swapchain_;
   std::vector<std::shared_ptr<SwapchainImageVK>> images_;
   std::vector<std::unique_ptr<FrameSynchronizer>> synchronizers_;
@@ -73,11 +80,13 @@ class SwapchainImplVK final
   bool is_valid_ = false;
   size_t current_transform_poll_count_ = 0u;
   vk::SurfaceTransformFlagBitsKHR transform_if_changed_discard_swapchain_;
+  vk::SurfaceTransformFlagBitsKHR pre_transform_ =
+      vk::SurfaceTransformFlagBitsKHR::eIdentity;
+  vk::Extent2D extent_ = {};
 
   SwapchainImplVK(const std::shared_ptr<Context>& context,
                   vk::UniqueSurfaceKHR surface,
-                  vk::SwapchainKHR old_swapchain,
-                  vk::SurfaceTransformFlagBitsKHR last_transform);
+                  vk::SwapchainKHR old_swapchain);
 
   bool Present(const std::shared_ptr<SwapchainImageVK>& image, uint32_t index);
 
@@ -49,10 +49,9 @@ std::unique_ptr<Surface> SwapchainVK::AcquireNextDrawable() {
   auto context = impl_->GetContext();
   auto [surface, old_swapchain] = impl_->DestroySwapchain();
 
-  auto new_impl = SwapchainImplVK::Create(context,                   //
-                                          std::move(surface),        //
-                                          *old_swapchain,            //
-                                          impl_->GetLastTransform()  //
+  auto new_impl = SwapchainImplVK::Create(context,             //
+                                          std::move(surface),  //
+                                          *old_swapchain       //
   );
   if (!new_impl || !new_impl->IsValid()) {
     VALIDATION_LOG << "Could not update swapchain.";
@@ -73,4 +72,8 @@ vk::Format SwapchainVK::GetSurfaceFormat() const {
   return IsValid() ? impl_->GetSurfaceFormat() : vk::Format::eUndefined;
 }
 
+Matrix SwapchainVK::GetSurfaceTransformation() const {
+  return IsValid() ? impl_->GetSurfaceTransformation() : Matrix{};
+}
+
 }  // namespace impeller
@@ -7,6 +7,7 @@
 #include <memory>
 
 #include "flutter/fml/macros.h"
+#include "impeller/geometry/matrix.h"
 #include "impeller/renderer/backend/vulkan/vk.h"
 #include "impeller/renderer/context.h"
 #include "impeller/renderer/surface.h"
@@ -35,6 +36,11 @@ class SwapchainVK {
 
   vk::Format GetSurfaceFormat() const;
 
+  /// The transformation the renderer must bake into its output to account
+  /// for the pre-rotation of the current swapchain. Identity when the
+  /// surface matches the display's natural orientation.
+  Matrix GetSurfaceTransformation() const;
+
  private:
   std::shared_ptr<SwapchainImplVK> impl_;
 
@@ -45,6 +45,34 @@ TEST(GPUTracerVK, CanTraceCmdBuffer) {
                         "vkGetQueryPoolResults") != called->end());
 }
 
+TEST(GPUTracerVK, RecordsPassTimestampsWithinFrameWorkload) {
+  auto const context = MockVulkanContextBuilder().Build();
+  auto tracer = context->GetGPUTracer();
+
+  ASSERT_TRUE(tracer->IsEnabled());
+  tracer->MarkFrameStart();
+
+  auto cmd_buffer = context->CreateCommandBuffer();
+  auto blit_pass = cmd_buffer->CreateBlitPass();
+  blit_pass->EncodeCommands(context->GetResourceAllocator());
+
+  auto latch = std::make_shared<fml::CountDownLatch>(1u);
+  if (!cmd_buffer->SubmitCommands(
+          [latch](CommandBuffer::Status status) { latch->CountDown(); })) {
+    GTEST_FAIL() << "Failed to submit cmd buffer";
+  }
+
+  tracer->MarkFrameEnd();
+  latch->Wait();
+
+  auto called = GetMockVulkanFunctions(context->GetDevice());
+  ASSERT_NE(called, nullptr);
+  // Two timestamps for the cmd buffer start/end and two more bracketing the
+  // blit pass.
+  ASSERT_EQ(std::count(called->begin(), called->end(), "vkCmdWriteTimestamp"),
+            4);
+}
+
 TEST(GPUTracerVK, DoesNotTraceOutsideOfFrameWorkload) {
   auto const context = MockVulkanContextBuilder().Build();
   auto tracer = context->GetGPUTracer();
@@ -230,6 +230,36 @@ VkResult vkCreatePipelineCache(VkDevice device,
   return VK_SUCCESS;
 }
 
+VkResult vkCreateDescriptorPool(VkDevice device,
+                                const VkDescriptorPoolCreateInfo* pCreateInfo,
+                                const VkAllocationCallbacks* pAllocator,
+                                VkDescriptorPool* pDescriptorPool) {
+  MockDevice* mock_device = reinterpret_cast<MockDevice*>(device);
+  mock_device->AddCalledFunction("vkCreateDescriptorPool");
+  *pDescriptorPool = reinterpret_cast<VkDescriptorPool>(0xc0dedeaf);
+  return VK_SUCCESS;
+}
+
+VkResult vkResetDescriptorPool(VkDevice device,
+                               VkDescriptorPool descriptorPool,
+                               VkDescriptorPoolResetFlags flags) {
+  MockDevice* mock_device = reinterpret_cast<MockDevice*>(device);
+  mock_device->AddCalledFunction("vkResetDescriptorPool");
+  return VK_SUCCESS;
+}
+
+VkResult vkAllocateDescriptorSets(
+    VkDevice device,
+    const VkDescriptorSetAllocateInfo* pAllocateInfo,
+    VkDescriptorSet* pDescriptorSets) {
+  MockDevice* mock_device = reinterpret_cast<MockDevice*>(device);
+  mock_device->AddCalledFunction("vkAllocateDescriptorSets");
+  for (uint32_t i = 0u; i < pAllocateInfo->descriptorSetCount; i++) {
+    pDescriptorSets[i] = reinterpret_cast<VkDescriptorSet>(0xcafeca5e + i);
+  }
+  return VK_SUCCESS;
+}
+
 VkResult vkCreateCommandPool(VkDevice device,
                              const VkCommandPoolCreateInfo* pCreateInfo,
                              const VkAllocationCallbacks* pAllocator,
@@ -407,6 +437,15 @@ void vkCmdBindPipeline(VkCommandBuffer commandBuffer,
   mock_command_buffer->called_functions_->push_back("vkCmdBindPipeline");
 }
 
+void vkCmdWriteTimestamp(VkCommandBuffer commandBuffer,
+                         VkPipelineStageFlagBits pipelineStage,
+                         VkQueryPool queryPool,
+                         uint32_t query) {
+  MockCommandBuffer* mock_command_buffer =
+      reinterpret_cast<MockCommandBuffer*>(commandBuffer);
+  mock_command_buffer->called_functions_->push_back("vkCmdWriteTimestamp");
+}
+
 void vkCmdSetStencilReference(VkCommandBuffer commandBuffer,
                               VkStencilFaceFlags faceMask,
                               uint32_t reference) {
@@ -563,6 +602,12 @@ PFN_vkVoidFunction GetMockVulkanProcAddress(VkInstance instance,
     return (PFN_vkVoidFunction)vkGetPhysicalDeviceMemoryProperties;
   } else if (strcmp("vkCreatePipelineCache", pName) == 0) {
     return (PFN_vkVoidFunction)vkCreatePipelineCache;
+  } else if (strcmp("vkCreateDescriptorPool", pName) == 0) {
+    return (PFN_vkVoidFunction)vkCreateDescriptorPool;
+  } else if (strcmp("vkResetDescriptorPool", pName) == 0) {
+    return (PFN_vkVoidFunction)vkResetDescriptorPool;
+  } else if (strcmp("vkAllocateDescriptorSets", pName) == 0) {
+    return (PFN_vkVoidFunction)vkAllocateDescriptorSets;
   } else if (strcmp("vkCreateCommandPool", pName) == 0) {
     return (PFN_vkVoidFunction)vkCreateCommandPool;
   } else if (strcmp("vkResetCommandPool", pName) == 0) {
@@ -611,6 +656,8 @@ PFN_vkVoidFunction GetMockVulkanProcAddress(VkInstance instance,
     return (PFN_vkVoidFunction)vkDestroyShaderModule;
   } else if (strcmp("vkDestroyPipelineCache", pName) == 0) {
     return (PFN_vkVoidFunction)vkDestroyPipelineCache;
+  } else if (strcmp("vkCmdWriteTimestamp", pName) == 0) {
+    return (PFN_vkVoidFunction)vkCmdWriteTimestamp;
   } else if (strcmp("vkCmdBindPipeline", pName) == 0) {
     return (PFN_vkVoidFunction)vkCmdBindPipeline;
   } else if (strcmp("vkCmdSetStencilReference", pName) == 0) {
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "flutter/fml/macros.h"
 #include "flutter/fml/status.h"
 #include "impeller/base/thread.h"
@@ -35,6 +37,15 @@ class TextureSourceVK {
   /// `barrier.new_layout`.
   fml::Status SetLayout(const BarrierVK& barrier) const;
 
+  /// Like `SetLayout`, but instead of encoding a pipeline barrier of its own,
+  /// appends the image barrier to `image_barriers` so the caller can batch
+  /// the transitions for several images into a single barrier command.
+  ///
+  /// Nothing is appended when the image is already in the requested layout.
+  void BatchedSetLayout(
+      const BarrierVK& barrier,
+      std::vector<vk::ImageMemoryBarrier>& image_barriers) const;
+
   /// Store the layout of the image.
   ///
   /// This just is bookkeeping on the CPU, to actually set the layout use
@@ -56,6 +67,10 @@ class TextureSourceVK {
   explicit TextureSourceVK(TextureDescriptor desc);
 
  private:
+  vk::ImageMemoryBarrier CreateImageMemoryBarrier(
+      const BarrierVK& barrier,
+      vk::ImageLayout old_layout) const;
+
   mutable RWMutex layout_mutex_;
   mutable vk::ImageLayout layout_ IPLR_GUARDED_BY(layout_mutex_) =
       vk::ImageLayout::eUndefined;
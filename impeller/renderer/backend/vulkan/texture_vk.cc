@@ -141,6 +141,14 @@ bool TextureVK::SetLayout(const BarrierVK& barrier) const {
   return source_ ? source_->SetLayout(barrier).ok() : false;
 }
 
+void TextureVK::BatchedSetLayout(
+    const BarrierVK& barrier,
+    std::vector<vk::ImageMemoryBarrier>& image_barriers) const {
+  if (source_) {
+    source_->BatchedSetLayout(barrier, image_barriers);
+  }
+}
+
 vk::ImageLayout TextureVK::SetLayoutWithoutEncoding(
     vk::ImageLayout layout) const {
   return source_ ? source_->SetLayoutWithoutEncoding(layout)
@@ -151,4 +159,16 @@ vk::ImageLayout TextureVK::GetLayout() const {
   return source_ ? source_->GetLayout() : vk::ImageLayout::eUndefined;
 }
 
+void TextureVK::SetCachedRenderPassData(
+    std::shared_ptr<const RenderPassDataVK> data) const {
+  Lock lock(render_pass_data_mutex_);
+  render_pass_data_ = std::move(data);
+}
+
+std::shared_ptr<const RenderPassDataVK> TextureVK::GetCachedRenderPassData()
+    const {
+  Lock lock(render_pass_data_mutex_);
+  return render_pass_data_;
+}
+
 }  // namespace impeller
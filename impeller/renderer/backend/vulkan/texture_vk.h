@@ -8,6 +8,7 @@
 
 #include "flutter/fml/macros.h"
 #include "impeller/base/backend_cast.h"
+#include "impeller/base/thread.h"
 #include "impeller/core/texture.h"
 #include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/device_buffer_vk.h"
@@ -17,6 +18,8 @@
 
 namespace impeller {
 
+struct RenderPassDataVK;
+
 class TextureVK final : public Texture, public BackendCast<TextureVK, Texture> {
  public:
   TextureVK(std::weak_ptr<Context> context,
@@ -31,15 +34,33 @@ class TextureVK final : public Texture, public BackendCast<TextureVK, Texture> {
 
   bool SetLayout(const BarrierVK& barrier) const;
 
+  void BatchedSetLayout(
+      const BarrierVK& barrier,
+      std::vector<vk::ImageMemoryBarrier>& image_barriers) const;
+
   vk::ImageLayout SetLayoutWithoutEncoding(vk::ImageLayout layout) const;
 
   vk::ImageLayout GetLayout() const;
 
   std::shared_ptr<const TextureSourceVK> GetTextureSource() const;
 
+  // Stores the render pass objects most recently used to render into this
+  // texture. Render target textures (swapchain MSAA attachments and offscreen
+  // targets recycled by the render target cache) see the same attachment
+  // configuration frame after frame, so caching the pass objects on the
+  // texture lets steady state frames skip re-creating identical
+  // vk::RenderPass and vk::Framebuffer objects. See |RenderPassDataVK|.
+  void SetCachedRenderPassData(
+      std::shared_ptr<const RenderPassDataVK> data) const;
+
+  std::shared_ptr<const RenderPassDataVK> GetCachedRenderPassData() const;
+
  private:
   std::weak_ptr<Context> context_;
   std::shared_ptr<TextureSourceVK> source_;
+  mutable Mutex render_pass_data_mutex_;
+  mutable std::shared_ptr<const RenderPassDataVK> render_pass_data_
+      IPLR_GUARDED_BY(render_pass_data_mutex_);
 
   // |Texture|
   void SetLabel(std::string_view label) override;
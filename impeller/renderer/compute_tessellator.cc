@@ -24,6 +24,7 @@ static std::shared_ptr<DeviceBuffer> CreateDeviceBuffer(
   DeviceBufferDescriptor desc;
   desc.storage_mode = storage_mode;
   desc.size = sizeof(T);
+  desc.resource_class = ResourceClass::kGeometryBuffer;
   auto buffer = context->GetResourceAllocator()->CreateBuffer(desc);
   buffer->SetLabel(label);
   return buffer;
@@ -16,4 +16,17 @@ bool Context::UpdateOffscreenLayerPixelFormat(PixelFormat format) {
   return false;
 }
 
+std::shared_ptr<fml::ConcurrentTaskRunner> Context::GetWorkerTaskRunner()
+    const {
+  return nullptr;
+}
+
+std::shared_ptr<StagingBelt> Context::GetStagingBelt() const {
+  std::scoped_lock lock(staging_belt_mutex_);
+  if (!staging_belt_) {
+    staging_belt_ = std::make_shared<StagingBelt>(GetResourceAllocator());
+  }
+  return staging_belt_;
+}
+
 }  // namespace impeller
@@ -5,15 +5,21 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "flutter/fml/macros.h"
 #include "impeller/core/capture.h"
 #include "impeller/core/formats.h"
 #include "impeller/core/host_buffer.h"
+#include "impeller/core/staging_belt.h"
 #include "impeller/renderer/capabilities.h"
 #include "impeller/renderer/pool.h"
 
+namespace fml {
+class ConcurrentTaskRunner;
+}  // namespace fml
+
 namespace impeller {
 
 class ShaderLibrary;
@@ -163,6 +169,15 @@ class Context {
   ///
   virtual std::shared_ptr<CommandBuffer> CreateCommandBuffer() const = 0;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Returns a task runner backed by a pool of concurrent
+  ///             background workers, or `nullptr` if the backend does not
+  ///             maintain one. Suitable for fanning out independent CPU-bound
+  ///             work such as glyph rasterization.
+  ///
+  virtual std::shared_ptr<fml::ConcurrentTaskRunner> GetWorkerTaskRunner()
+      const;
+
   //----------------------------------------------------------------------------
   /// @brief      Force all pending asynchronous work to finish. This is
   ///             achieved by deleting all owned concurrent message loops.
@@ -184,6 +199,11 @@ class Context {
   /// @brief Accessor for a pool of HostBuffers.
   Pool<HostBuffer>& GetHostBufferPool() const { return host_buffer_pool_; }
 
+  //----------------------------------------------------------------------------
+  /// @brief Accessor for the staging belt used by one-shot uploads such as
+  ///        image decodes. Lazily created on first use. Threadsafe.
+  std::shared_ptr<StagingBelt> GetStagingBelt() const;
+
   CaptureContext capture;
 
   /// Stores a task on the `ContextMTL` that is awaiting access for the GPU.
@@ -205,6 +225,9 @@ class Context {
  private:
   mutable Pool<HostBuffer> host_buffer_pool_ = Pool<HostBuffer>(1'000'000);
 
+  mutable std::mutex staging_belt_mutex_;
+  mutable std::shared_ptr<StagingBelt> staging_belt_;
+
   Context(const Context&) = delete;
 
   Context& operator=(const Context&) = delete;
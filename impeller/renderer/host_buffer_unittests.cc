@@ -75,5 +75,38 @@ TEST(HostBufferTest, CanEmplaceWithAlignment) {
   }
 }
 
+TEST(HostBufferTest, InternsIdenticalUniformBlocks) {
+  struct Uniform {
+    uint8_t pad[16];
+  };
+
+  auto buffer = HostBuffer::Create();
+
+  Uniform uniform = {};
+  uniform.pad[0] = 1;
+
+  auto view_1 = buffer->EmplaceUniform(uniform);
+  ASSERT_TRUE(view_1);
+  const auto length_after_first = buffer->GetLength();
+
+  // Identical contents map onto the previously emplaced block.
+  auto view_2 = buffer->EmplaceUniform(uniform);
+  ASSERT_TRUE(view_2);
+  ASSERT_EQ(view_1.range, view_2.range);
+  ASSERT_EQ(buffer->GetLength(), length_after_first);
+
+  // Different contents get their own block.
+  uniform.pad[0] = 2;
+  auto view_3 = buffer->EmplaceUniform(uniform);
+  ASSERT_TRUE(view_3);
+  ASSERT_FALSE(view_1.range == view_3.range);
+
+  // The table doesn't outlive a reset.
+  buffer->Reset();
+  auto view_4 = buffer->EmplaceUniform(uniform);
+  ASSERT_TRUE(view_4);
+  ASSERT_EQ(view_4.range.offset, 0u);
+}
+
 }  // namespace  testing
 }  // namespace impeller
@@ -0,0 +1,109 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/renderer/image_format_converter.h"
+
+#include <cstdint>
+#include <limits>
+
+#include "flutter/fml/trace_event.h"
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/image_format_convert.comp.h"
+#include "impeller/renderer/pipeline_library.h"
+
+namespace impeller {
+
+static size_t BytesPerConvertedPixel(
+    ImageFormatConverter::SourceFormat source_format) {
+  switch (source_format) {
+    case ImageFormatConverter::SourceFormat::kGray8:
+    case ImageFormatConverter::SourceFormat::kAlpha8:
+    case ImageFormatConverter::SourceFormat::kRGB888X:
+      return 4u;
+    case ImageFormatConverter::SourceFormat::kRGBAF32:
+      return 8u;
+  }
+  FML_UNREACHABLE();
+}
+
+std::shared_ptr<DeviceBuffer> ImageFormatConverter::Convert(
+    const std::shared_ptr<Context>& context,
+    const std::shared_ptr<DeviceBuffer>& source,
+    SourceFormat source_format,
+    size_t pixel_count) {
+  TRACE_EVENT0("impeller", "ImageFormatConvert");
+  using CS = ImageFormatConvertComputeShader;
+
+  if (!context || !source || pixel_count == 0u ||
+      pixel_count > std::numeric_limits<uint32_t>::max()) {
+    return nullptr;
+  }
+  // The shader reads the source as packed 32-bit words.
+  FML_DCHECK(source->GetDeviceBufferDescriptor().size % 4u == 0u);
+
+  DeviceBufferDescriptor desc;
+  desc.storage_mode = StorageMode::kDevicePrivate;
+  desc.size = pixel_count * BytesPerConvertedPixel(source_format);
+  desc.resource_class = ResourceClass::kImage;
+  auto output = context->GetResourceAllocator()->CreateBuffer(desc);
+  if (!output) {
+    return nullptr;
+  }
+  output->SetLabel("ImageFormatConvertOutput");
+
+  auto cmd_buffer = context->CreateCommandBuffer();
+  if (!cmd_buffer) {
+    return nullptr;
+  }
+  cmd_buffer->SetLabel("Image Format Convert Command Buffer");
+
+  auto pass = cmd_buffer->CreateComputePass();
+  if (!pass || !pass->IsValid()) {
+    return nullptr;
+  }
+  pass->SetLabel("Image Format Convert Compute Pass");
+
+  using ConvertPipelineBuilder = ComputePipelineBuilder<CS>;
+  auto pipeline_desc =
+      ConvertPipelineBuilder::MakeDefaultPipelineDescriptor(*context);
+  if (!pipeline_desc.has_value()) {
+    return nullptr;
+  }
+  auto compute_pipeline =
+      context->GetPipelineLibrary()->GetPipeline(pipeline_desc).Get();
+  if (!compute_pipeline) {
+    return nullptr;
+  }
+
+  pass->SetGridSize(ISize(pixel_count, 1));
+  pass->SetThreadGroupSize(ISize(pixel_count, 1));
+
+  ComputeCommand cmd;
+  DEBUG_COMMAND_INFO(cmd, "Convert Image Format");
+  cmd.pipeline = compute_pipeline;
+
+  CS::Config config{
+      .source_format = static_cast<uint32_t>(source_format),
+      .pixel_count = static_cast<uint32_t>(pixel_count),
+  };
+  CS::BindConfig(cmd, pass->GetTransientsBuffer().EmplaceUniform(config));
+  CS::BindInputData(cmd, source->AsBufferView());
+  CS::BindOutputData(cmd, output->AsBufferView());
+
+  if (!pass->AddCommand(std::move(cmd))) {
+    return nullptr;
+  }
+
+  if (!pass->EncodeCommands()) {
+    return nullptr;
+  }
+
+  if (!cmd_buffer->SubmitCommands()) {
+    return nullptr;
+  }
+
+  return output;
+}
+
+}  // namespace impeller
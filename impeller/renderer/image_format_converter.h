@@ -0,0 +1,69 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <memory>
+
+#include "flutter/fml/macros.h"
+#include "impeller/core/device_buffer.h"
+#include "impeller/renderer/context.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      A utility that expands raw decoded image bytes into a pixel
+///             format the GPU can sample, so that image decoders can upload
+///             their output as-is instead of swizzling large images on the
+///             CPU.
+///
+class ImageFormatConverter {
+ public:
+  /// The layout of the raw bytes in the source buffer. Keep in sync with the
+  /// constants in `image_format_convert.comp`.
+  enum class SourceFormat : uint32_t {
+    /// One byte of luminance per pixel; converts to opaque RGBA8888.
+    kGray8 = 0,
+    /// One byte of alpha per pixel; converts to RGBA8888 with zero color
+    /// channels.
+    kAlpha8 = 1,
+    /// Four bytes per pixel with an ignored fourth byte; converts to opaque
+    /// RGBA8888.
+    kRGB888X = 2,
+    /// Four 32-bit floats per pixel; converts to RGBA16F.
+    kRGBAF32 = 3,
+  };
+
+  //----------------------------------------------------------------------------
+  /// @brief      Converts the raw source pixels into a freshly allocated
+  ///             device private buffer holding the corresponding GPU
+  ///             compatible format.
+  ///
+  ///             The conversion is submitted to the context's queue before
+  ///             this method returns, so a subsequent blit from the returned
+  ///             buffer on the same queue observes the converted pixels.
+  ///
+  ///             The source buffer is read as packed 32-bit words; for the
+  ///             single byte source formats its length must be a multiple of
+  ///             four bytes.
+  ///
+  /// @param[in]  context        The context.
+  /// @param[in]  source         The buffer holding the tightly packed raw
+  ///                            source pixels.
+  /// @param[in]  source_format  The layout of the source pixels.
+  /// @param[in]  pixel_count    The number of pixels to convert.
+  ///
+  /// @return     The converted device private buffer, or nullptr if the
+  ///             conversion could not be submitted.
+  ///
+  static std::shared_ptr<DeviceBuffer> Convert(
+      const std::shared_ptr<Context>& context,
+      const std::shared_ptr<DeviceBuffer>& source,
+      SourceFormat source_format,
+      size_t pixel_count);
+
+  ImageFormatConverter() = delete;
+};
+
+}  // namespace impeller
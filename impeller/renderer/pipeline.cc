@@ -52,7 +52,8 @@ const T& Pipeline<T>::GetDescriptor() const {
 
 template <typename T>
 PipelineFuture<T> Pipeline<T>::CreateVariant(
-    std::function<void(T& desc)> descriptor_callback) const {
+    std::function<void(T& desc)> descriptor_callback,
+    PipelineCreationPriority priority) const {
   if (!descriptor_callback) {
     return {std::nullopt,
             RealizedFuture<std::shared_ptr<Pipeline<T>>>(nullptr)};
@@ -69,7 +70,7 @@ PipelineFuture<T> Pipeline<T>::CreateVariant(
     return {desc_, RealizedFuture<std::shared_ptr<Pipeline<T>>>(nullptr)};
   }
 
-  return library->GetPipeline(std::move(copied_desc));
+  return library->GetPipeline(std::move(copied_desc), priority);
 }
 
 template class Pipeline<PipelineDescriptor>;
@@ -20,6 +20,21 @@ class PipelineLibrary;
 template <typename PipelineDescriptor_>
 class Pipeline;
 
+//------------------------------------------------------------------------------
+/// @brief      The urgency with which a pipeline must be realized. Backends
+///             that compile pipelines on their own worker queues use this to
+///             order creation so that pipelines the current frame is blocked
+///             on aren't stuck behind speculative warm-up work.
+///
+enum class PipelineCreationPriority {
+  /// The current frame cannot be encoded until this pipeline is ready.
+  kFrameBlocking,
+  /// The pipeline is expected to be needed within the next few frames.
+  kLikelyNext,
+  /// The pipeline may never be needed and is being created opportunistically.
+  kSpeculative,
+};
+
 template <typename T>
 struct PipelineFuture {
   std::optional<T> descriptor;
@@ -61,7 +76,9 @@ class Pipeline {
   const T& GetDescriptor() const;
 
   PipelineFuture<T> CreateVariant(
-      std::function<void(T& desc)> descriptor_callback) const;
+      std::function<void(T& desc)> descriptor_callback,
+      PipelineCreationPriority priority =
+          PipelineCreationPriority::kFrameBlocking) const;
 
  protected:
   Pipeline(std::weak_ptr<PipelineLibrary> library, T desc);
@@ -32,4 +32,26 @@ PipelineFuture<ComputePipelineDescriptor> PipelineLibrary::GetPipeline(
   return {descriptor, promise->get_future()};
 }
 
+PipelineFuture<PipelineDescriptor> PipelineLibrary::GetPipeline(
+    PipelineDescriptor descriptor,
+    PipelineCreationPriority priority) {
+  // Backends without their own compilation queues cannot act on the priority.
+  return GetPipeline(std::move(descriptor));
+}
+
+PipelineFuture<ComputePipelineDescriptor> PipelineLibrary::GetPipeline(
+    ComputePipelineDescriptor descriptor,
+    PipelineCreationPriority priority) {
+  return GetPipeline(std::move(descriptor));
+}
+
+void PipelineLibrary::WarmUp(const std::vector<PipelineDescriptor>& descriptors,
+                             PipelineCreationPriority priority) {
+  for (const auto& descriptor : descriptors) {
+    // The futures are deliberately dropped; the pipelines land in the cache
+    // and will be picked up by whoever requests them at draw time.
+    GetPipeline(descriptor, priority);
+  }
+}
+
 }  // namespace impeller
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <optional>
+#include <vector>
 
 #include "compute_pipeline_descriptor.h"
 #include "flutter/fml/macros.h"
@@ -36,6 +37,28 @@ class PipelineLibrary : public std::enable_shared_from_this<PipelineLibrary> {
   PipelineFuture<ComputePipelineDescriptor> GetPipeline(
       std::optional<ComputePipelineDescriptor> descriptor);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Get (or begin creating) a pipeline with an explicit creation
+  ///             priority. The default implementation ignores the priority;
+  ///             backends that queue compilation work override it.
+  ///
+  virtual PipelineFuture<PipelineDescriptor> GetPipeline(
+      PipelineDescriptor descriptor,
+      PipelineCreationPriority priority);
+
+  virtual PipelineFuture<ComputePipelineDescriptor> GetPipeline(
+      ComputePipelineDescriptor descriptor,
+      PipelineCreationPriority priority);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Begin creating pipelines for all of the given descriptors at
+  ///             the given priority without waiting on any of them. Backends
+  ///             fan the descriptors out across their compilation workers.
+  ///
+  void WarmUp(const std::vector<PipelineDescriptor>& descriptors,
+              PipelineCreationPriority priority =
+                  PipelineCreationPriority::kSpeculative);
+
   virtual bool IsValid() const = 0;
 
   virtual PipelineFuture<PipelineDescriptor> GetPipeline(
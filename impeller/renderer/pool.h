@@ -5,8 +5,10 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 namespace impeller {
 
@@ -15,10 +17,15 @@ namespace impeller {
 template <typename T>
 class Pool {
  public:
+  /// @brief A callback that reports whether the GPU has finished consuming a
+  ///        recycled object, typically by checking a frame fence.
+  using ReuseFence = std::function<bool()>;
+
   explicit Pool(uint32_t limit_bytes) : limit_bytes_(limit_bytes) {}
 
   std::shared_ptr<T> Grab() {
     std::scoped_lock lock(mutex_);
+    ReclaimPendingLocked();
     if (pool_.empty()) {
       return T::Create();
     }
@@ -30,6 +37,33 @@ class Pool {
 
   void Recycle(std::shared_ptr<T> object) {
     std::scoped_lock lock(mutex_);
+    RecycleLocked(std::move(object));
+  }
+
+  /// @brief Recycle an object that the GPU may still be consuming. The object
+  ///        only becomes eligible for |Grab| once |reuse_fence| returns true.
+  ///        A null fence recycles the object immediately.
+  void Recycle(std::shared_ptr<T> object, ReuseFence reuse_fence) {
+    std::scoped_lock lock(mutex_);
+    if (!reuse_fence) {
+      RecycleLocked(std::move(object));
+      return;
+    }
+    pending_.push_back({std::move(object), std::move(reuse_fence)});
+  }
+
+  uint32_t GetSize() const {
+    std::scoped_lock lock(mutex_);
+    return size_;
+  }
+
+ private:
+  struct PendingObject {
+    std::shared_ptr<T> object;
+    ReuseFence reuse_fence;
+  };
+
+  void RecycleLocked(std::shared_ptr<T> object) {
     size_t object_size = object->GetSize();
     if (size_ + object_size <= limit_bytes_ &&
         object_size < (limit_bytes_ / 2)) {
@@ -39,13 +73,19 @@ class Pool {
     }
   }
 
-  uint32_t GetSize() const {
-    std::scoped_lock lock(mutex_);
-    return size_;
+  void ReclaimPendingLocked() {
+    for (auto it = pending_.begin(); it != pending_.end();) {
+      if (it->reuse_fence()) {
+        RecycleLocked(std::move(it->object));
+        it = pending_.erase(it);
+      } else {
+        ++it;
+      }
+    }
   }
 
- private:
   std::vector<std::shared_ptr<T>> pool_;
+  std::vector<PendingObject> pending_;
   const uint32_t limit_bytes_;
   uint32_t size_ = 0;
   // Note: This would perform better as a lockless ring buffer.
@@ -60,5 +60,27 @@ TEST(PoolTest, Overload) {
   EXPECT_EQ(pool.GetSize(), 1'000u);
 }
 
+TEST(PoolTest, FencedRecycle) {
+  Pool<Foobar> pool(1'000);
+  auto signaled = std::make_shared<bool>(false);
+
+  auto grabbed = pool.Grab();
+  grabbed->SetSize(123);
+  auto recycled = grabbed.get();
+  pool.Recycle(std::move(grabbed), [signaled] { return *signaled; });
+
+  // The fence has not signaled, so the object is not reusable yet and a fresh
+  // one is created instead.
+  EXPECT_EQ(pool.GetSize(), 0u);
+  auto fresh = pool.Grab();
+  EXPECT_NE(fresh.get(), recycled);
+
+  *signaled = true;
+  auto reused = pool.Grab();
+  EXPECT_EQ(reused.get(), recycled);
+  EXPECT_TRUE(reused->GetIsReset());
+  EXPECT_EQ(pool.GetSize(), 0u);
+}
+
 }  // namespace testing
 }  // namespace impeller
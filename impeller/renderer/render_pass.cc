@@ -43,12 +43,20 @@ void RenderPass::SetLabel(std::string label) {
   OnSetLabel(std::move(label));
 }
 
+void RenderPass::SetDefaultScissor(std::optional<IRect> scissor) {
+  default_scissor_ = scissor;
+}
+
 bool RenderPass::AddCommand(Command&& command) {
   if (!command.IsValid()) {
     VALIDATION_LOG << "Attempted to add an invalid command to the render pass.";
     return false;
   }
 
+  if (!command.scissor.has_value()) {
+    command.scissor = default_scissor_;
+  }
+
   if (command.scissor.has_value()) {
     auto target_rect = IRect::MakeSize(render_target_.GetRenderTargetSize());
     if (!target_rect.Contains(command.scissor.value())) {
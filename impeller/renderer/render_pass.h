@@ -49,6 +49,14 @@ class RenderPass {
   ///
   bool AddCommand(Command&& command);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Set a scissor rect that is applied to all subsequently added
+  ///             commands that don't set a scissor themselves. Used to apply
+  ///             analytic (stencil-free) rectangle clips. Pass `std::nullopt`
+  ///             to clear.
+  ///
+  void SetDefaultScissor(std::optional<IRect> scissor);
+
   //----------------------------------------------------------------------------
   /// @brief      Encode the recorded commands to the underlying command buffer.
   ///
@@ -79,6 +87,8 @@ class RenderPass {
   virtual bool OnEncodeCommands(const Context& context) const = 0;
 
  private:
+  std::optional<IRect> default_scissor_;
+
   RenderPass(const RenderPass&) = delete;
 
   RenderPass& operator=(const RenderPass&) = delete;
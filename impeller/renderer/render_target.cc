@@ -239,6 +239,7 @@ RenderTarget RenderTarget::CreateOffscreen(
   color_tex0.size = size;
   color_tex0.usage = static_cast<uint64_t>(TextureUsage::kRenderTarget) |
                      static_cast<uint64_t>(TextureUsage::kShaderRead);
+  color_tex0.resource_class = ResourceClass::kOffscreenTarget;
 
   ColorAttachment color0;
   color0.clear_color = color_attachment_config.clear_color;
@@ -285,6 +286,7 @@ RenderTarget RenderTarget::CreateOffscreenMSAA(
   color0_tex_desc.format = pixel_format;
   color0_tex_desc.size = size;
   color0_tex_desc.usage = static_cast<uint64_t>(TextureUsage::kRenderTarget);
+  color0_tex_desc.resource_class = ResourceClass::kOffscreenTarget;
 
   if (context.GetCapabilities()->SupportsImplicitResolvingMSAA()) {
     // See below ("SupportsImplicitResolvingMSAA") for more details.
@@ -310,6 +312,7 @@ RenderTarget RenderTarget::CreateOffscreenMSAA(
   color0_resolve_tex_desc.usage =
       static_cast<uint64_t>(TextureUsage::kRenderTarget) |
       static_cast<uint64_t>(TextureUsage::kShaderRead);
+  color0_resolve_tex_desc.resource_class = ResourceClass::kOffscreenTarget;
 
   auto color0_resolve_tex = allocator.CreateTexture(color0_resolve_tex_desc);
   if (!color0_resolve_tex) {
@@ -369,6 +372,7 @@ void RenderTarget::SetupStencilAttachment(
   stencil_tex0.size = size;
   stencil_tex0.usage =
       static_cast<TextureUsageMask>(TextureUsage::kRenderTarget);
+  stencil_tex0.resource_class = ResourceClass::kOffscreenTarget;
 
   StencilAttachment stencil0;
   stencil0.load_action = stencil_attachment_config.load_action;
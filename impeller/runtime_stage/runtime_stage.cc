@@ -5,12 +5,48 @@
 #include "impeller/runtime_stage/runtime_stage.h"
 
 #include <array>
+#include <map>
+#include <mutex>
 
 #include "impeller/base/validation.h"
 #include "impeller/runtime_stage/runtime_stage_flatbuffers.h"
 
 namespace impeller {
 
+namespace {
+
+// Payloads that already passed flatbuffer verification, keyed by the start of
+// their backing mapping. Entries hold weak references so the cache never
+// extends a payload's lifetime; a pointer match only counts when the weak
+// reference still resolves to a live mapping of the same size, which guards
+// against an address being reused by a different buffer.
+std::mutex verified_payloads_mutex;
+std::map<const uint8_t*, std::weak_ptr<const fml::Mapping>> verified_payloads;
+
+bool IsVerifiedRuntimeStage(const std::shared_ptr<fml::Mapping>& payload) {
+  std::scoped_lock lock(verified_payloads_mutex);
+  auto found = verified_payloads.find(payload->GetMapping());
+  if (found != verified_payloads.end()) {
+    auto cached = found->second.lock();
+    if (cached && cached->GetSize() == payload->GetSize()) {
+      return true;
+    }
+    verified_payloads.erase(found);
+  }
+  return false;
+}
+
+void MarkVerifiedRuntimeStage(const std::shared_ptr<fml::Mapping>& payload) {
+  std::scoped_lock lock(verified_payloads_mutex);
+  // Drop entries whose payloads have since gone away.
+  for (auto it = verified_payloads.begin(); it != verified_payloads.end();) {
+    it = it->second.expired() ? verified_payloads.erase(it) : std::next(it);
+  }
+  verified_payloads[payload->GetMapping()] = payload;
+}
+
+}  // namespace
+
 static RuntimeUniformType ToType(fb::UniformDataType type) {
   switch (type) {
     case fb::UniformDataType::kBoolean:
@@ -67,6 +103,19 @@ RuntimeStage::RuntimeStage(std::shared_ptr<fml::Mapping> payload)
   if (!fb::RuntimeStageBufferHasIdentifier(payload_->GetMapping())) {
     return;
   }
+  // Verification dominates the cost of re-creating a stage from a payload
+  // that was already seen (e.g., repeated FragmentProgram::initFromAsset
+  // calls against a pooled shader asset), so payloads that verified once are
+  // remembered by mapping identity.
+  if (!IsVerifiedRuntimeStage(payload_)) {
+    flatbuffers::Verifier verifier(payload_->GetMapping(),
+                                   payload_->GetSize());
+    if (!fb::VerifyRuntimeStageBuffer(verifier)) {
+      VALIDATION_LOG << "Runtime stage flatbuffer is invalid.";
+      return;
+    }
+    MarkVerifiedRuntimeStage(payload_);
+  }
   auto runtime_stage = fb::GetRuntimeStage(payload_->GetMapping());
   if (!runtime_stage) {
     return;
@@ -96,6 +145,15 @@ RuntimeStage::RuntimeStage(std::shared_ptr<fml::Mapping> payload)
       [payload = payload_](auto, auto) {}  //
   );
 
+  // FNV-1a over the shader code. The hash must be stable across sessions so
+  // that pipeline usage manifests written by one launch identify the same
+  // shader in the next.
+  code_hash_ = 0xcbf29ce484222325u;
+  for (size_t i = 0; i < code_mapping_->GetSize(); i++) {
+    code_hash_ ^= code_mapping_->GetMapping()[i];
+    code_hash_ *= 0x100000001b3u;
+  }
+
   sksl_mapping_ = std::make_shared<fml::NonOwnedMapping>(
       runtime_stage->sksl()->data(),       //
       runtime_stage->sksl()->size(),       //
@@ -121,6 +179,10 @@ const std::shared_ptr<fml::Mapping>& RuntimeStage::GetSkSLMapping() const {
   return sksl_mapping_;
 }
 
+uint64_t RuntimeStage::GetCodeHash() const {
+  return code_hash_;
+}
+
 const std::vector<RuntimeUniformDescription>& RuntimeStage::GetUniforms()
     const {
   return uniforms_;
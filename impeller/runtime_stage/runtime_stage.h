@@ -36,6 +36,11 @@ class RuntimeStage {
 
   const std::shared_ptr<fml::Mapping>& GetSkSLMapping() const;
 
+  /// A stable hash of the shader code, suitable for identifying this shader
+  /// across sessions (for example in a pipeline usage manifest). Zero for
+  /// invalid stages.
+  uint64_t GetCodeHash() const;
+
   bool IsDirty() const;
 
   void SetClean();
@@ -47,6 +52,7 @@ class RuntimeStage {
   std::shared_ptr<fml::Mapping> code_mapping_;
   std::shared_ptr<fml::Mapping> sksl_mapping_;
   std::vector<RuntimeUniformDescription> uniforms_;
+  uint64_t code_hash_ = 0;
   bool is_valid_ = false;
   bool is_dirty_ = true;
 
@@ -8,17 +8,21 @@
 #include <memory>
 #include <ostream>
 
+#include "impeller/base/validation.h"
 #include "impeller/core/device_buffer_descriptor.h"
 #include "impeller/core/formats.h"
+#include "impeller/core/platform.h"
 #include "impeller/core/sampler_descriptor.h"
 #include "impeller/core/vertex_buffer.h"
 #include "impeller/geometry/point.h"
 #include "impeller/geometry/vector.h"
 #include "impeller/renderer/sampler_library.h"
 #include "impeller/renderer/vertex_buffer_builder.h"
+#include "impeller/scene/importer/conversions.h"
 #include "impeller/scene/importer/scene_flatbuffers.h"
 #include "impeller/scene/shaders/skinned.vert.h"
 #include "impeller/scene/shaders/unskinned.vert.h"
+#include "impeller/scene/shaders/unskinned_instanced.vert.h"
 
 namespace impeller {
 namespace scene {
@@ -29,6 +33,27 @@ namespace scene {
 
 Geometry::~Geometry() = default;
 
+bool Geometry::SupportsInstancing() const {
+  return false;
+}
+
+void Geometry::BindInstancesToCommand(const SceneContext& scene_context,
+                                      HostBuffer& buffer,
+                                      const Matrix& camera_transform,
+                                      const std::vector<Matrix>& transforms,
+                                      Command& command) const {
+  VALIDATION_LOG << "Geometry does not support instancing.";
+}
+
+void Geometry::SetBoundingSphere(
+    std::optional<BoundingSphere> bounding_sphere) {
+  bounding_sphere_ = std::move(bounding_sphere);
+}
+
+const std::optional<BoundingSphere>& Geometry::GetBoundingSphere() const {
+  return bounding_sphere_;
+}
+
 std::shared_ptr<CuboidGeometry> Geometry::MakeCuboid(Vector3 size) {
   auto result = std::make_shared<CuboidGeometry>();
   result->SetSize(size);
@@ -64,6 +89,10 @@ std::shared_ptr<Geometry> Geometry::MakeFromFlatbuffer(
   const uint8_t* vertices_start;
   size_t vertices_bytes;
   bool is_skinned;
+  // Model space bounds of the vertex positions, for the culling sphere
+  // recorded below. Skinned vertices deform at runtime, so only unskinned
+  // meshes record bounds.
+  std::optional<BoundingSphere> bounding_sphere;
 
   switch (mesh.vertices_type()) {
     case fb::VertexBuffer::UnskinnedVertexBuffer: {
@@ -72,6 +101,17 @@ std::shared_ptr<Geometry> Geometry::MakeFromFlatbuffer(
       vertices_start = reinterpret_cast<const uint8_t*>(vertices->Get(0));
       vertices_bytes = vertices->size() * sizeof(fb::Vertex);
       is_skinned = false;
+      Vector3 min_position = importer::ToVector3(vertices->Get(0)->position());
+      Vector3 max_position = min_position;
+      for (const auto* vertex : *vertices) {
+        const Vector3 position = importer::ToVector3(vertex->position());
+        min_position = min_position.Min(position);
+        max_position = max_position.Max(position);
+      }
+      bounding_sphere = BoundingSphere{
+          .center = (min_position + max_position) / 2,
+          .radius = ((max_position - min_position) / 2).Length(),
+      };
       break;
     }
     case fb::VertexBuffer::SkinnedVertexBuffer: {
@@ -116,7 +156,9 @@ std::shared_ptr<Geometry> Geometry::MakeFromFlatbuffer(
       .vertex_count = mesh.indices()->count(),
       .index_type = index_type,
   };
-  return MakeVertexBuffer(std::move(vertex_buffer), is_skinned);
+  auto result = MakeVertexBuffer(std::move(vertex_buffer), is_skinned);
+  result->SetBoundingSphere(bounding_sphere);
+  return result;
 }
 
 void Geometry::SetJointsTexture(const std::shared_ptr<Texture>& texture) {}
@@ -173,6 +215,31 @@ void CuboidGeometry::BindToCommand(const SceneContext& scene_context,
   UnskinnedVertexShader::BindFrameInfo(command, buffer.EmplaceUniform(info));
 }
 
+// |Geometry|
+bool CuboidGeometry::SupportsInstancing() const {
+  return true;
+}
+
+// |Geometry|
+void CuboidGeometry::BindInstancesToCommand(
+    const SceneContext& scene_context,
+    HostBuffer& buffer,
+    const Matrix& camera_transform,
+    const std::vector<Matrix>& transforms,
+    Command& command) const {
+  command.BindVertices(
+      GetVertexBuffer(*scene_context.GetContext()->GetResourceAllocator()));
+
+  UnskinnedInstancedVertexShader::FrameInfo info;
+  info.camera_transform = camera_transform;
+  UnskinnedInstancedVertexShader::BindFrameInfo(command,
+                                                buffer.EmplaceUniform(info));
+  UnskinnedInstancedVertexShader::BindInstanceInfo(
+      command, buffer.Emplace(transforms.data(),
+                              transforms.size() * sizeof(Matrix),
+                              DefaultUniformAlignment()));
+}
+
 //------------------------------------------------------------------------------
 /// UnskinnedVertexBufferGeometry
 ///
@@ -211,6 +278,31 @@ void UnskinnedVertexBufferGeometry::BindToCommand(
   UnskinnedVertexShader::BindFrameInfo(command, buffer.EmplaceUniform(info));
 }
 
+// |Geometry|
+bool UnskinnedVertexBufferGeometry::SupportsInstancing() const {
+  return true;
+}
+
+// |Geometry|
+void UnskinnedVertexBufferGeometry::BindInstancesToCommand(
+    const SceneContext& scene_context,
+    HostBuffer& buffer,
+    const Matrix& camera_transform,
+    const std::vector<Matrix>& transforms,
+    Command& command) const {
+  command.BindVertices(
+      GetVertexBuffer(*scene_context.GetContext()->GetResourceAllocator()));
+
+  UnskinnedInstancedVertexShader::FrameInfo info;
+  info.camera_transform = camera_transform;
+  UnskinnedInstancedVertexShader::BindFrameInfo(command,
+                                                buffer.EmplaceUniform(info));
+  UnskinnedInstancedVertexShader::BindInstanceInfo(
+      command, buffer.Emplace(transforms.data(),
+                              transforms.size() * sizeof(Matrix),
+                              DefaultUniformAlignment()));
+}
+
 //------------------------------------------------------------------------------
 /// SkinnedVertexBufferGeometry
 ///
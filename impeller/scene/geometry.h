@@ -5,6 +5,8 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "impeller/core/allocator.h"
@@ -24,6 +26,14 @@ namespace scene {
 class CuboidGeometry;
 class UnskinnedVertexBufferGeometry;
 
+/// A conservative model space bounding sphere. The encoder culls draws whose
+/// bounds fall entirely outside the camera frustum; geometry without known
+/// bounds is never culled.
+struct BoundingSphere {
+  Vector3 center;
+  Scalar radius = 0;
+};
+
 class Geometry {
  public:
   virtual ~Geometry();
@@ -46,7 +56,27 @@ class Geometry {
                              const Matrix& transform,
                              Command& command) const = 0;
 
+  /// Whether this geometry can collapse repeated geometry/material pairs
+  /// into a single instanced draw. Requires SSBO support in the context.
+  virtual bool SupportsInstancing() const;
+
+  /// Binds the vertex information for an instanced draw with one model
+  /// transform per instance. Only valid when `SupportsInstancing()` returns
+  /// true.
+  virtual void BindInstancesToCommand(const SceneContext& scene_context,
+                                      HostBuffer& buffer,
+                                      const Matrix& camera_transform,
+                                      const std::vector<Matrix>& transforms,
+                                      Command& command) const;
+
   virtual void SetJointsTexture(const std::shared_ptr<Texture>& texture);
+
+  void SetBoundingSphere(std::optional<BoundingSphere> bounding_sphere);
+
+  const std::optional<BoundingSphere>& GetBoundingSphere() const;
+
+ private:
+  std::optional<BoundingSphere> bounding_sphere_;
 };
 
 class CuboidGeometry final : public Geometry {
@@ -69,6 +99,16 @@ class CuboidGeometry final : public Geometry {
                      const Matrix& transform,
                      Command& command) const override;
 
+  // |Geometry|
+  bool SupportsInstancing() const override;
+
+  // |Geometry|
+  void BindInstancesToCommand(const SceneContext& scene_context,
+                              HostBuffer& buffer,
+                              const Matrix& camera_transform,
+                              const std::vector<Matrix>& transforms,
+                              Command& command) const override;
+
  private:
   Vector3 size_;
 
@@ -97,6 +137,16 @@ class UnskinnedVertexBufferGeometry final : public Geometry {
                      const Matrix& transform,
                      Command& command) const override;
 
+  // |Geometry|
+  bool SupportsInstancing() const override;
+
+  // |Geometry|
+  void BindInstancesToCommand(const SceneContext& scene_context,
+                              HostBuffer& buffer,
+                              const Matrix& camera_transform,
+                              const std::vector<Matrix>& transforms,
+                              Command& command) const override;
+
  private:
   VertexBuffer vertex_buffer_;
 
@@ -352,7 +352,7 @@ bool Node::IsJoint() const {
 }
 
 bool Node::Render(SceneEncoder& encoder,
-                  Allocator& allocator,
+                  Context& context,
                   const Matrix& parent_transform) {
   std::optional<std::vector<MutationLog::Entry>> log = mutation_log_.Flush();
   if (log.has_value()) {
@@ -408,10 +408,10 @@ bool Node::Render(SceneEncoder& encoder,
 
   Matrix transform = parent_transform * local_transform_;
   mesh_.Render(encoder, transform,
-               skin_ ? skin_->GetJointsTexture(allocator) : nullptr);
+               skin_ ? skin_->GetJointsTexture(context) : nullptr);
 
   for (auto& child : children_) {
-    if (!child->Render(encoder, allocator, transform)) {
+    if (!child->Render(encoder, context, transform)) {
       return false;
     }
   }
@@ -99,7 +99,7 @@ class Node final {
   bool IsJoint() const;
 
   bool Render(SceneEncoder& encoder,
-              Allocator& allocator,
+              Context& context,
               const Matrix& parent_transform);
 
   void AddMutation(const MutationLog::Entry& entry);
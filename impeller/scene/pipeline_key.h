@@ -12,7 +12,10 @@ namespace scene {
 enum class GeometryType {
   kUnskinned = 0,
   kSkinned = 1,
-  kLastType = kSkinned,
+  // Unskinned geometry drawn once per unique geometry/material pair with
+  // per-instance transforms. Requires SSBO support.
+  kUnskinnedInstanced = 2,
+  kLastType = kUnskinnedInstanced,
 };
 enum class MaterialType {
   kUnlit = 0,
@@ -34,9 +34,7 @@ bool Scene::Render(const RenderTarget& render_target,
                    const Matrix& camera_transform) {
   // Collect the render commands from the scene.
   SceneEncoder encoder;
-  if (!root_.Render(encoder,
-                    *scene_context_->GetContext()->GetResourceAllocator(),
-                    Matrix())) {
+  if (!root_.Render(encoder, *scene_context_->GetContext(), Matrix())) {
     FML_LOG(ERROR) << "Failed to render frame.";
     return false;
   }
@@ -8,6 +8,7 @@
 #include "impeller/scene/shaders/skinned.vert.h"
 #include "impeller/scene/shaders/unlit.frag.h"
 #include "impeller/scene/shaders/unskinned.vert.h"
+#include "impeller/scene/shaders/unskinned_instanced.vert.h"
 
 namespace impeller {
 namespace scene {
@@ -45,6 +46,12 @@ SceneContext::SceneContext(std::shared_ptr<Context> context)
           *context_);
   pipelines_[{PipelineKey{GeometryType::kSkinned, MaterialType::kUnlit}}] =
       MakePipelineVariants<SkinnedVertexShader, UnlitFragmentShader>(*context_);
+  if (context_->GetCapabilities()->SupportsSSBO()) {
+    pipelines_[{PipelineKey{GeometryType::kUnskinnedInstanced,
+                            MaterialType::kUnlit}}] =
+        MakePipelineVariants<UnskinnedInstancedVertexShader,
+                             UnlitFragmentShader>(*context_);
+  }
 
   {
     impeller::TextureDescriptor texture_descriptor;
@@ -2,6 +2,10 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
 #include "flutter/fml/macros.h"
 
 #include "flutter/fml/logging.h"
@@ -13,6 +17,57 @@
 namespace impeller {
 namespace scene {
 
+namespace {
+/// The six planes of a camera frustum, for sphere rejection tests. Plane
+/// normals point into the frustum.
+struct Frustum {
+  explicit Frustum(const Matrix& camera_transform) {
+    const Matrix& m = camera_transform;
+    // The rows of the (column major) view-projection matrix.
+    Vector4 rows[4];
+    for (int i = 0; i < 4; i++) {
+      rows[i] = Vector4(m.e[0][i], m.e[1][i], m.e[2][i], m.e[3][i]);
+    }
+    planes[0] = rows[3] + rows[0];  // Left.
+    planes[1] = rows[3] - rows[0];  // Right.
+    planes[2] = rows[3] + rows[1];  // Bottom.
+    planes[3] = rows[3] - rows[1];  // Top.
+    planes[4] = rows[2];            // Near (clip space depth begins at zero).
+    planes[5] = rows[3] - rows[2];  // Far.
+  }
+
+  /// Whether a world space sphere lies entirely outside the frustum.
+  bool Culls(const Vector3& center, Scalar radius) const {
+    for (const Vector4& plane : planes) {
+      Vector3 normal(plane.x, plane.y, plane.z);
+      Scalar length = normal.Length();
+      if (length <= 0) {
+        continue;  // Degenerate plane; never culls.
+      }
+      Scalar distance = (normal.Dot(center) + plane.w) / length;
+      if (distance < -radius) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  Vector4 planes[6];
+};
+}  // namespace
+
+static bool ShouldCull(const Frustum& frustum,
+                       const SceneCommand& scene_command) {
+  const auto& bounds = scene_command.geometry->GetBoundingSphere();
+  if (!bounds.has_value()) {
+    return false;
+  }
+  Vector3 world_center = scene_command.transform * bounds->center;
+  Scalar world_radius =
+      bounds->radius * scene_command.transform.GetMaxBasisLength();
+  return frustum.Culls(world_center, world_radius);
+}
+
 SceneEncoder::SceneEncoder() = default;
 
 void SceneEncoder::Add(const SceneCommand& command) {
@@ -44,6 +99,31 @@ static void EncodeCommand(const SceneContext& scene_context,
   render_pass.AddCommand(std::move(cmd));
 }
 
+static void EncodeInstancedCommand(const SceneContext& scene_context,
+                                   const Matrix& view_transform,
+                                   RenderPass& render_pass,
+                                   const SceneCommand& scene_command,
+                                   const std::vector<Matrix>& transforms) {
+  auto& host_buffer = render_pass.GetTransientsBuffer();
+
+  Command cmd;
+  DEBUG_COMMAND_INFO(cmd, scene_command.label);
+  cmd.stencil_reference =
+      0;  // TODO(bdero): Configurable stencil ref per-command.
+  cmd.instance_count = transforms.size();
+
+  cmd.pipeline = scene_context.GetPipeline(
+      PipelineKey{GeometryType::kUnskinnedInstanced,
+                  scene_command.material->GetMaterialType()},
+      scene_command.material->GetContextOptions(render_pass));
+
+  scene_command.geometry->BindInstancesToCommand(
+      scene_context, host_buffer, view_transform, transforms, cmd);
+  scene_command.material->BindToCommand(scene_context, host_buffer, cmd);
+
+  render_pass.AddCommand(std::move(cmd));
+}
+
 std::shared_ptr<CommandBuffer> SceneEncoder::BuildSceneCommandBuffer(
     const SceneContext& scene_context,
     const Matrix& camera_transform,
@@ -90,8 +170,55 @@ std::shared_ptr<CommandBuffer> SceneEncoder::BuildSceneCommandBuffer(
     return nullptr;
   }
 
-  for (auto& command : commands_) {
-    EncodeCommand(scene_context, camera_transform, *render_pass, command);
+  // Drop commands whose bounds lie entirely outside the frustum, then sort
+  // the remainder by pipeline key to minimize state changes. The sort is
+  // stable so that draws sharing a key keep their submission order.
+  Frustum frustum(camera_transform);
+  std::vector<const SceneCommand*> ordered_commands;
+  ordered_commands.reserve(commands_.size());
+  for (const auto& command : commands_) {
+    if (!ShouldCull(frustum, command)) {
+      ordered_commands.push_back(&command);
+    }
+  }
+  std::stable_sort(ordered_commands.begin(), ordered_commands.end(),
+                   [](const SceneCommand* lhs, const SceneCommand* rhs) {
+                     return std::make_tuple(lhs->geometry->GetGeometryType(),
+                                            lhs->material->GetMaterialType(),
+                                            lhs->geometry, lhs->material) <
+                            std::make_tuple(rhs->geometry->GetGeometryType(),
+                                            rhs->material->GetMaterialType(),
+                                            rhs->geometry, rhs->material);
+                   });
+
+  const bool supports_instancing =
+      scene_context.GetContext()->GetCapabilities()->SupportsSSBO();
+  for (size_t i = 0; i < ordered_commands.size();) {
+    const SceneCommand& command = *ordered_commands[i];
+    // Collapse a run of commands sharing the same geometry and material into
+    // a single instanced draw.
+    size_t run_end = i + 1;
+    while (run_end < ordered_commands.size() &&
+           ordered_commands[run_end]->geometry == command.geometry &&
+           ordered_commands[run_end]->material == command.material) {
+      run_end++;
+    }
+    if (supports_instancing && run_end - i > 1 &&
+        command.geometry->SupportsInstancing()) {
+      std::vector<Matrix> transforms;
+      transforms.reserve(run_end - i);
+      for (size_t j = i; j < run_end; j++) {
+        transforms.push_back(ordered_commands[j]->transform);
+      }
+      EncodeInstancedCommand(scene_context, camera_transform, *render_pass,
+                             command, transforms);
+    } else {
+      for (size_t j = i; j < run_end; j++) {
+        EncodeCommand(scene_context, camera_transform, *render_pass,
+                      *ordered_commands[j]);
+      }
+    }
+    i = run_end;
   }
 
   if (!render_pass->EncodeCommands()) {
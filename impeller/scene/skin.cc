@@ -5,6 +5,7 @@
 #include "impeller/scene/skin.h"
 
 #include <cmath>
+#include <map>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -13,6 +14,14 @@
 #include "impeller/core/allocator.h"
 #include "impeller/scene/importer/conversions.h"
 
+#ifdef IMPELLER_ENABLE_COMPUTE
+#include "impeller/core/device_buffer_descriptor.h"
+#include "impeller/core/platform.h"
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/pipeline_library.h"
+#include "impeller/scene/shaders/skin.comp.h"
+#endif  // IMPELLER_ENABLE_COMPUTE
+
 namespace impeller {
 namespace scene {
 
@@ -62,13 +71,17 @@ Skin::Skin(Skin&&) = default;
 
 Skin& Skin::operator=(Skin&&) = default;
 
-std::shared_ptr<Texture> Skin::GetJointsTexture(Allocator& allocator) {
+static uint32_t JointsTextureDimensionSize(size_t joint_count) {
   // Each joint has a matrix. 1 matrix = 16 floats. 1 pixel = 4 floats.
   // Therefore, each joint needs 4 pixels.
-  auto required_pixels = joints_.size() * 4;
-  auto dimension_size = std::max(
+  auto required_pixels = joint_count * 4;
+  return std::max(
       2u,
       Allocation::NextPowerOfTwoSize(std::ceil(std::sqrt(required_pixels))));
+}
+
+std::shared_ptr<Texture> Skin::GetJointsTexture(Allocator& allocator) {
+  auto dimension_size = JointsTextureDimensionSize(joints_.size());
 
   impeller::TextureDescriptor texture_descriptor;
   texture_descriptor.storage_mode = impeller::StorageMode::kHostVisible;
@@ -119,5 +132,206 @@ std::shared_ptr<Texture> Skin::GetJointsTexture(Allocator& allocator) {
   return result;
 }
 
+std::shared_ptr<Texture> Skin::GetJointsTexture(Context& context) {
+#ifdef IMPELLER_ENABLE_COMPUTE
+  if (context.GetCapabilities()->SupportsCompute() &&
+      context.GetCapabilities()->SupportsBufferToTextureBlits()) {
+    auto result = ComputeJointsTexture(context);
+    if (result) {
+      return result;
+    }
+  }
+#endif  // IMPELLER_ENABLE_COMPUTE
+  return GetJointsTexture(*context.GetResourceAllocator());
+}
+
+#ifdef IMPELLER_ENABLE_COMPUTE
+
+bool Skin::EnsureComputeResources(Context& context) {
+  if (joints_texture_) {
+    return true;
+  }
+  if (compute_setup_failed_) {
+    return false;
+  }
+  compute_setup_failed_ = true;
+
+  auto& allocator = *context.GetResourceAllocator();
+
+  // Inverse bind matrices never change. Null joints get an identity matrix
+  // so that their palette entries resolve to identity, matching the CPU path.
+  std::vector<Matrix> inverse_bind(joints_.size());
+  for (size_t joint_i = 0; joint_i < joints_.size(); joint_i++) {
+    if (joints_[joint_i]) {
+      inverse_bind[joint_i] = inverse_bind_matrices_[joint_i];
+    }
+  }
+  inverse_bind_buffer_ = allocator.CreateBufferWithCopy(
+      reinterpret_cast<const uint8_t*>(inverse_bind.data()),
+      inverse_bind.size() * sizeof(Matrix));
+  if (!inverse_bind_buffer_) {
+    return false;
+  }
+  inverse_bind_buffer_->SetLabel("Skin inverse bind matrices");
+
+  const auto dimension_size = JointsTextureDimensionSize(joints_.size());
+
+  DeviceBufferDescriptor palette_desc;
+  palette_desc.storage_mode = StorageMode::kDevicePrivate;
+  palette_desc.size = dimension_size * dimension_size * 4 * sizeof(float);
+  palette_buffer_ = allocator.CreateBuffer(palette_desc);
+  if (!palette_buffer_) {
+    return false;
+  }
+  palette_buffer_->SetLabel("Skin joint palette");
+
+  impeller::TextureDescriptor texture_descriptor;
+  texture_descriptor.storage_mode = impeller::StorageMode::kDevicePrivate;
+  texture_descriptor.format = PixelFormat::kR32G32B32A32Float;
+  texture_descriptor.size = {dimension_size, dimension_size};
+  texture_descriptor.mip_count = 1u;
+
+  joints_texture_ = allocator.CreateTexture(texture_descriptor);
+  if (!joints_texture_) {
+    FML_LOG(ERROR) << "Could not create joint texture.";
+    return false;
+  }
+  joints_texture_->SetLabel("Joints Texture");
+
+  compute_setup_failed_ = false;
+  return true;
+}
+
+std::shared_ptr<Texture> Skin::ComputeJointsTexture(Context& context) {
+  if (joints_.empty() || !EnsureComputeResources(context)) {
+    return nullptr;
+  }
+
+  // Flatten the skeleton into bone chains. The chains are rebuilt every frame
+  // because mutations may reparent joints; this is a pointer walk with no
+  // matrix math.
+  std::vector<const Node*> bones;
+  std::vector<int32_t> bone_parents;
+  std::vector<int32_t> chain_starts(joints_.size(), -1);
+  std::map<const Node*, int32_t> bone_indices;
+  for (size_t joint_i = 0; joint_i < joints_.size(); joint_i++) {
+    const Node* node = joints_[joint_i].get();
+    if (!node || !node->IsJoint()) {
+      continue;
+    }
+    // Collect the not-yet-indexed portion of this joint's bone chain.
+    std::vector<const Node*> chain;
+    const Node* cursor = node;
+    while (cursor && cursor->IsJoint() &&
+           bone_indices.find(cursor) == bone_indices.end()) {
+      chain.push_back(cursor);
+      cursor = cursor->GetParent();
+    }
+    // Index the chain from the root-most bone down so that every bone's
+    // parent is indexed before the bone itself.
+    int32_t parent_index =
+        cursor && cursor->IsJoint() ? bone_indices[cursor] : -1;
+    for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+      auto index = static_cast<int32_t>(bones.size());
+      bone_indices[*it] = index;
+      bones.push_back(*it);
+      bone_parents.push_back(parent_index);
+      parent_index = index;
+    }
+    chain_starts[joint_i] = bone_indices[node];
+  }
+  if (bones.empty()) {
+    return nullptr;
+  }
+
+  std::vector<Matrix> bone_transforms;
+  bone_transforms.reserve(bones.size());
+  for (const Node* bone : bones) {
+    bone_transforms.push_back(bone->GetLocalTransform());
+  }
+
+  using CS = SkinComputeShader;
+
+  auto command_buffer = context.CreateCommandBuffer();
+  if (!command_buffer) {
+    return nullptr;
+  }
+  command_buffer->SetLabel("Skin Compute Command Buffer");
+
+  auto compute_pass = command_buffer->CreateComputePass();
+  if (!compute_pass || !compute_pass->IsValid()) {
+    return nullptr;
+  }
+  compute_pass->SetLabel("Skin Joints Compute Pass");
+
+  auto pipeline_desc =
+      ComputePipelineBuilder<CS>::MakeDefaultPipelineDescriptor(context);
+  if (!pipeline_desc.has_value()) {
+    return nullptr;
+  }
+  auto pipeline =
+      context.GetPipelineLibrary()->GetPipeline(pipeline_desc).Get();
+  if (!pipeline) {
+    return nullptr;
+  }
+
+  const size_t matrix_count = joints_texture_->GetSize().Area() / 4;
+  compute_pass->SetGridSize(ISize(matrix_count, 1));
+  compute_pass->SetThreadGroupSize(ISize(matrix_count, 1));
+
+  auto& host_buffer = compute_pass->GetTransientsBuffer();
+
+  ComputeCommand cmd;
+  DEBUG_COMMAND_INFO(cmd, "Skin Joints Palette");
+  cmd.pipeline = pipeline;
+
+  CS::Config config{
+      .joint_count = static_cast<uint32_t>(joints_.size()),
+      .matrix_count = static_cast<uint32_t>(matrix_count),
+  };
+  CS::BindConfig(cmd, host_buffer.EmplaceUniform(config));
+  CS::BindBoneTransforms(
+      cmd, host_buffer.Emplace(bone_transforms.data(),
+                               bone_transforms.size() * sizeof(Matrix),
+                               DefaultUniformAlignment()));
+  CS::BindBoneParents(
+      cmd, host_buffer.Emplace(bone_parents.data(),
+                               bone_parents.size() * sizeof(int32_t),
+                               DefaultUniformAlignment()));
+  CS::BindChainStarts(
+      cmd, host_buffer.Emplace(chain_starts.data(),
+                               chain_starts.size() * sizeof(int32_t),
+                               DefaultUniformAlignment()));
+  CS::BindInverseBindMatrices(cmd, inverse_bind_buffer_->AsBufferView());
+  CS::BindJointMatrices(cmd, palette_buffer_->AsBufferView());
+
+  if (!compute_pass->AddCommand(std::move(cmd))) {
+    return nullptr;
+  }
+  if (!compute_pass->EncodeCommands()) {
+    return nullptr;
+  }
+
+  auto blit_pass = command_buffer->CreateBlitPass();
+  if (!blit_pass || !blit_pass->IsValid()) {
+    return nullptr;
+  }
+  blit_pass->SetLabel("Skin Joints Blit Pass");
+  if (!blit_pass->AddCopy(palette_buffer_->AsBufferView(), joints_texture_)) {
+    return nullptr;
+  }
+  if (!blit_pass->EncodeCommands(context.GetResourceAllocator())) {
+    return nullptr;
+  }
+
+  if (!command_buffer->SubmitCommands()) {
+    return nullptr;
+  }
+
+  return joints_texture_;
+}
+
+#endif  // IMPELLER_ENABLE_COMPUTE
+
 }  // namespace scene
 }  // namespace impeller
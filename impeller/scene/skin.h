@@ -10,7 +10,9 @@
 #include "flutter/fml/macros.h"
 
 #include "impeller/core/allocator.h"
+#include "impeller/core/device_buffer.h"
 #include "impeller/core/texture.h"
+#include "impeller/renderer/context.h"
 #include "impeller/scene/importer/scene_flatbuffers.h"
 #include "impeller/scene/node.h"
 
@@ -29,9 +31,26 @@ class Skin final {
 
   std::shared_ptr<Texture> GetJointsTexture(Allocator& allocator);
 
+  /// Produces the joints texture with a compute pass when the context
+  /// supports it: the skeleton pose is uploaded as flattened bone buffers and
+  /// the joint matrix palette is generated on the GPU. Falls back to the CPU
+  /// path otherwise.
+  std::shared_ptr<Texture> GetJointsTexture(Context& context);
+
  private:
   Skin();
 
+#ifdef IMPELLER_ENABLE_COMPUTE
+  bool EnsureComputeResources(Context& context);
+
+  std::shared_ptr<Texture> ComputeJointsTexture(Context& context);
+
+  bool compute_setup_failed_ = false;
+  std::shared_ptr<DeviceBuffer> inverse_bind_buffer_;
+  std::shared_ptr<DeviceBuffer> palette_buffer_;
+  std::shared_ptr<Texture> joints_texture_;
+#endif  // IMPELLER_ENABLE_COMPUTE
+
   std::vector<std::shared_ptr<Node>> joints_;
   std::vector<Matrix> inverse_bind_matrices_;
 
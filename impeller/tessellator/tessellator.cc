@@ -4,6 +4,9 @@
 
 #include "impeller/tessellator/tessellator.h"
 
+#include <cmath>
+#include <cstring>
+
 #include "third_party/libtess2/Include/tesselator.h"
 
 namespace impeller {
@@ -45,6 +48,24 @@ Tessellator::Tessellator()
 
 Tessellator::~Tessellator() = default;
 
+// Tolerances are bucketed the same way Path::CreatePolyline buckets its
+// polyline scale, so a cache entry serves every tolerance that flattens to
+// the same polyline.
+static Scalar QuantizeTolerance(Scalar tolerance) {
+  if (tolerance <= 0 || !std::isfinite(tolerance)) {
+    return tolerance;
+  }
+  return std::exp2(std::ceil(std::log2(tolerance)));
+}
+
+// A map key that welds vertices with identical coordinate bit patterns.
+static uint64_t WeldKey(const Point& point) {
+  uint64_t key = 0u;
+  static_assert(sizeof(key) == sizeof(point));
+  std::memcpy(&key, &point, sizeof(point));
+  return key;
+}
+
 static int ToTessWindingRule(FillType fill_type) {
   switch (fill_type) {
     case FillType::kOdd:
@@ -68,6 +89,21 @@ Tessellator::Result Tessellator::Tessellate(const Path& path,
     return Result::kInputError;
   }
 
+  const CacheKey cache_key = {
+      .path_generation = path.GetGenerationID(),
+      .fill_type = path.GetFillType(),
+      .tolerance_bucket = QuantizeTolerance(tolerance),
+  };
+  if (auto found = cache_.find(cache_key); found != cache_.end()) {
+    const CacheEntry& entry = found->second;
+    if (!callback(entry.vertices.data(), entry.vertex_count,
+                  entry.has_index_buffer ? entry.indices.data() : nullptr,
+                  entry.has_index_buffer ? entry.indices.size() : 0u)) {
+      return Result::kInputError;
+    }
+    return Result::kSuccess;
+  }
+
   point_buffer_->clear();
   auto polyline =
       path.CreatePolyline(tolerance, std::move(point_buffer_),
@@ -96,11 +132,12 @@ Tessellator::Result Tessellator::Tessellate(const Path& path,
       fill_type == FillType::kNonZero) {
     std::vector<Point> points;
     std::vector<float> data;
+    std::vector<uint32_t> welded_indices;
+    std::unordered_map<uint64_t, uint32_t> welded_vertices;
 
     //----------------------------------------------------------------------------
     /// Feed contour information to the tessellator.
     ///
-    size_t total = 0u;
     static_assert(sizeof(Point) == 2 * sizeof(float));
     for (size_t contour_i = 0; contour_i < polyline.contours.size();
          contour_i++) {
@@ -138,15 +175,47 @@ Tessellator::Result Tessellator::Tessellate(const Path& path,
 
       int element_item_count = tessGetElementCount(tessellator) * kPolygonSize;
       auto elements = tessGetElements(tessellator);
-      total += element_item_count;
+      // Weld vertices shared between triangles (and between contours) so the
+      // caller can upload an indexed mesh instead of a triangle soup.
       for (int i = 0; i < element_item_count; i++) {
-        data.emplace_back(points[elements[i]].x);
-        data.emplace_back(points[elements[i]].y);
+        const Point& point = points[elements[i]];
+        auto [found, inserted] = welded_vertices.try_emplace(
+            WeldKey(point), static_cast<uint32_t>(data.size() / 2));
+        if (inserted) {
+          data.emplace_back(point.x);
+          data.emplace_back(point.y);
+        }
+        welded_indices.emplace_back(found->second);
       }
       points.clear();
     }
-    if (!callback(data.data(), total, nullptr, 0u)) {
-      return Result::kInputError;
+    size_t welded_vertex_count = data.size() / 2;
+    if (welded_vertex_count < USHRT_MAX) {
+      std::vector<uint16_t> indices(welded_indices.begin(),
+                                    welded_indices.end());
+      if (!callback(data.data(), welded_vertex_count, indices.data(),
+                    indices.size())) {
+        return Result::kInputError;
+      }
+      AddCacheEntry(cache_key, CacheEntry{.vertices = std::move(data),
+                                          .vertex_count = welded_vertex_count,
+                                          .indices = std::move(indices),
+                                          .has_index_buffer = true});
+    } else {
+      // Too many unique vertices for a 16 bit index buffer; expand back into
+      // a triangle soup.
+      std::vector<float> soup;
+      soup.reserve(welded_indices.size() * 2);
+      for (uint32_t index : welded_indices) {
+        soup.emplace_back(data[index * 2]);
+        soup.emplace_back(data[index * 2 + 1]);
+      }
+      if (!callback(soup.data(), welded_indices.size(), nullptr, 0u)) {
+        return Result::kInputError;
+      }
+      AddCacheEntry(cache_key,
+                    CacheEntry{.vertices = std::move(soup),
+                               .vertex_count = welded_indices.size()});
     }
   } else {
     //----------------------------------------------------------------------------
@@ -204,6 +273,13 @@ Tessellator::Result Tessellator::Tessellate(const Path& path,
                     element_item_count)) {
         return Result::kInputError;
       }
+      AddCacheEntry(
+          cache_key,
+          CacheEntry{.vertices = std::vector<float>(
+                         vertices, vertices + vertex_item_count * kVertexSize),
+                     .vertex_count = static_cast<size_t>(vertex_item_count),
+                     .indices = std::move(indices),
+                     .has_index_buffer = true});
     } else {
       std::vector<Point> points;
       std::vector<float> data;
@@ -225,12 +301,25 @@ Tessellator::Result Tessellator::Tessellate(const Path& path,
       if (!callback(data.data(), element_item_count, nullptr, 0u)) {
         return Result::kInputError;
       }
+      AddCacheEntry(
+          cache_key,
+          CacheEntry{.vertices = std::move(data),
+                     .vertex_count = static_cast<size_t>(element_item_count)});
     }
   }
 
   return Result::kSuccess;
 }
 
+void Tessellator::AddCacheEntry(const CacheKey& key, CacheEntry entry) {
+  if (cache_.size() >= kMaxCacheEntries) {
+    cache_.erase(cache_order_.front());
+    cache_order_.pop_front();
+  }
+  cache_order_.push_back(key);
+  cache_.emplace(key, std::move(entry));
+}
+
 std::pair<std::vector<Point>, std::vector<uint16_t>>
 Tessellator::TessellateConvex(const Path& path, Scalar tolerance) {
   std::vector<Point> output;
@@ -4,10 +4,14 @@
 
 #pragma once
 
+#include <cstdint>
+#include <deque>
 #include <functional>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
+#include "flutter/fml/hash_combine.h"
 #include "flutter/fml/macros.h"
 #include "impeller/geometry/path.h"
 #include "impeller/geometry/point.h"
@@ -62,6 +66,11 @@ class Tessellator {
   /// @brief      Generates filled triangles from the path. A callback is
   ///             invoked once for the entire tessellation.
   ///
+  ///             Results are memoized by the path's generation, its fill type,
+  ///             and a tolerance bucket, so repeatedly tessellating an
+  ///             unchanged path replays the cached triangles instead of
+  ///             re-running the tessellation.
+  ///
   /// @param[in]  path  The path to tessellate.
   /// @param[in]  tolerance  The tolerance value for conversion of the path to
   ///                        a polyline. This value is often derived from the
@@ -92,9 +101,48 @@ class Tessellator {
       Scalar tolerance);
 
  private:
+  /// The maximum number of memoized tessellation results. Once full, the
+  /// oldest entry is evicted.
+  static constexpr size_t kMaxCacheEntries = 128u;
+
+  struct CacheKey {
+    uint64_t path_generation = 0u;
+    FillType fill_type = FillType::kNonZero;
+    Scalar tolerance_bucket = 0.0f;
+
+    struct Hash {
+      std::size_t operator()(const CacheKey& key) const {
+        return fml::HashCombine(key.path_generation,
+                                static_cast<int>(key.fill_type),
+                                key.tolerance_bucket);
+      }
+    };
+
+    struct Equal {
+      bool operator()(const CacheKey& lhs, const CacheKey& rhs) const {
+        return lhs.path_generation == rhs.path_generation &&
+               lhs.fill_type == rhs.fill_type &&
+               lhs.tolerance_bucket == rhs.tolerance_bucket;
+      }
+    };
+  };
+
+  struct CacheEntry {
+    std::vector<float> vertices;
+    size_t vertex_count = 0u;
+    std::vector<uint16_t> indices;
+    bool has_index_buffer = false;
+  };
+
+  void AddCacheEntry(const CacheKey& key, CacheEntry entry);
+
   /// Used for polyline generation.
   std::unique_ptr<std::vector<Point>> point_buffer_;
   CTessellator c_tessellator_;
+  std::unordered_map<CacheKey, CacheEntry, CacheKey::Hash, CacheKey::Equal>
+      cache_;
+  /// Cache keys in insertion order, used for eviction.
+  std::deque<CacheKey> cache_order_;
 
   Tessellator(const Tessellator&) = delete;
 
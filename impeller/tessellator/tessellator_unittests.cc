@@ -11,6 +11,81 @@
 namespace impeller {
 namespace testing {
 
+TEST(TessellatorTest, RepeatedTessellationReplaysIdenticalResults) {
+  Tessellator t;
+  auto path = PathBuilder{}
+                  .MoveTo({0, 0})
+                  .LineTo({100, 0})
+                  .LineTo({100, 100})
+                  .LineTo({0, 100})
+                  .Close()
+                  .TakePath();
+
+  std::vector<float> first_vertices;
+  std::vector<uint16_t> first_indices;
+  auto record = [](std::vector<float>& out_vertices,
+                   std::vector<uint16_t>& out_indices) {
+    return [&out_vertices, &out_indices](
+               const float* vertices, size_t vertices_count,
+               const uint16_t* indices, size_t indices_count) {
+      out_vertices.assign(vertices, vertices + vertices_count * 2);
+      if (indices != nullptr) {
+        out_indices.assign(indices, indices + indices_count);
+      }
+      return true;
+    };
+  };
+
+  ASSERT_EQ(t.Tessellate(path, 1.0f, record(first_vertices, first_indices)),
+            Tessellator::Result::kSuccess);
+
+  // The second tessellation is served from the cache and must match.
+  std::vector<float> second_vertices;
+  std::vector<uint16_t> second_indices;
+  ASSERT_EQ(t.Tessellate(path, 1.0f, record(second_vertices, second_indices)),
+            Tessellator::Result::kSuccess);
+  ASSERT_EQ(first_vertices, second_vertices);
+  ASSERT_EQ(first_indices, second_indices);
+
+  // A failing callback on a cached entry is still an input error.
+  Tessellator::Result result = t.Tessellate(
+      path, 1.0f,
+      [](const float* vertices, size_t vertices_count, const uint16_t* indices,
+         size_t indices_count) { return false; });
+  ASSERT_EQ(result, Tessellator::Result::kInputError);
+}
+
+TEST(TessellatorTest, MultiContourTessellationEmitsWeldedIndexedMesh) {
+  Tessellator t;
+  PathBuilder builder;
+  // Exceed the multi-contour threshold so the per-contour fast path runs.
+  for (size_t i = 0; i < Tessellator::kMultiContourThreshold + 1; i++) {
+    auto offset = i * 20.0f;
+    builder.AddRect(Rect::MakeXYWH(offset, offset, 10, 10));
+  }
+  auto path = builder.TakePath(FillType::kNonZero);
+
+  size_t vertex_count = 0u;
+  size_t index_count = 0u;
+  bool has_indices = false;
+  Tessellator::Result result = t.Tessellate(
+      path, 1.0f,
+      [&vertex_count, &index_count, &has_indices](
+          const float* vertices, size_t vertices_count,
+          const uint16_t* indices, size_t indices_count) {
+        vertex_count = vertices_count;
+        index_count = indices_count;
+        has_indices = indices != nullptr;
+        return true;
+      });
+
+  ASSERT_EQ(result, Tessellator::Result::kSuccess);
+  ASSERT_TRUE(has_indices);
+  // Two triangles per rect, but only four unique vertices each.
+  ASSERT_EQ(index_count, (Tessellator::kMultiContourThreshold + 1) * 6);
+  ASSERT_EQ(vertex_count, (Tessellator::kMultiContourThreshold + 1) * 4);
+}
+
 TEST(TessellatorTest, TessellatorBuilderReturnsCorrectResultStatus) {
   // Zero points.
   {
@@ -4,13 +4,22 @@
 
 #include "impeller/typographer/backends/skia/typographer_context_skia.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
 #include <numeric>
+#include <thread>
 #include <utility>
 
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
 #include "flutter/fml/trace_event.h"
 #include "impeller/base/allocation.h"
 #include "impeller/core/allocator.h"
+#include "impeller/renderer/blit_pass.h"
+#include "impeller/renderer/command_buffer.h"
 #include "impeller/typographer/backends/skia/glyph_atlas_context_skia.h"
 #include "impeller/typographer/backends/skia/typeface_skia.h"
 #include "impeller/typographer/rectangle_packer.h"
@@ -75,16 +84,20 @@ static size_t PairsFitInAtlasOfSize(
   return 0;
 }
 
-static bool CanAppendToExistingAtlas(
+static bool AppendToExistingAtlas(
     const std::shared_ptr<GlyphAtlas>& atlas,
     const std::vector<FontGlyphPair>& extra_pairs,
     std::vector<Rect>& glyph_positions,
-    ISize atlas_size,
-    const std::shared_ptr<RectanglePacker>& rect_packer) {
+    std::vector<GlyphAtlasContext::Page>& pages,
+    ISize& atlas_size,
+    const ISize& max_texture_size,
+    size_t frame_count,
+    std::vector<IRect>& evicted_regions) {
   TRACE_EVENT0("impeller", __FUNCTION__);
-  if (!rect_packer || atlas_size.IsEmpty()) {
+  if (pages.empty() || atlas_size.IsEmpty()) {
     return false;
   }
+  const auto page_height = pages.front().height;
 
   // We assume that all existing glyphs will fit. After all, they fit before.
   // The glyph_positions only contains the values for the additional glyphs
@@ -97,17 +110,65 @@ static bool CanAppendToExistingAtlas(
     const auto glyph_size =
         ISize::Ceil(pair.glyph.bounds.size * pair.scaled_font.scale);
     IPoint16 location_in_atlas;
-    if (!rect_packer->addRect(glyph_size.width + kPadding,   //
-                              glyph_size.height + kPadding,  //
-                              &location_in_atlas             //
-                              )) {
-      return false;
+    GlyphAtlasContext::Page* target_page = nullptr;
+    while (!target_page) {
+      for (auto& page : pages) {
+        if (page.packer->addRect(glyph_size.width + kPadding,   //
+                                 glyph_size.height + kPadding,  //
+                                 &location_in_atlas             //
+                                 )) {
+          target_page = &page;
+          break;
+        }
+      }
+      if (target_page) {
+        break;
+      }
+
+      // No page has room. Grow the atlas downwards by adding a page if the
+      // maximum texture size allows it. The positions of previously placed
+      // glyphs remain valid.
+      if (atlas_size.height + page_height <= max_texture_size.height) {
+        GlyphAtlasContext::Page page;
+        page.packer = std::shared_ptr<RectanglePacker>(
+            RectanglePacker::Factory(atlas_size.width, page_height));
+        page.y_offset = atlas_size.height;
+        page.height = page_height;
+        page.last_used_frame = frame_count;
+        pages.push_back(std::move(page));
+        atlas_size.height += page_height;
+        continue;
+      }
+
+      // The atlas is at its maximum size. Evict the least recently used page
+      // that was not needed this frame and reuse its area. Marking the page
+      // as used guarantees forward progress even when nothing can be placed
+      // in it.
+      GlyphAtlasContext::Page* lru_page = nullptr;
+      for (auto& page : pages) {
+        if (page.last_used_frame >= frame_count) {
+          continue;
+        }
+        if (!lru_page || page.last_used_frame < lru_page->last_used_frame) {
+          lru_page = &page;
+        }
+      }
+      if (!lru_page) {
+        return false;
+      }
+      lru_page->packer->reset();
+      lru_page->last_used_frame = frame_count;
+      evicted_regions.push_back(IRect::MakeXYWH(0, lru_page->y_offset,
+                                                atlas_size.width,
+                                                lru_page->height));
     }
-    glyph_positions.emplace_back(Rect::MakeXYWH(location_in_atlas.x(),  //
-                                                location_in_atlas.y(),  //
-                                                glyph_size.width,       //
-                                                glyph_size.height       //
-                                                ));
+    target_page->last_used_frame = frame_count;
+    glyph_positions.emplace_back(
+        Rect::MakeXYWH(location_in_atlas.x(),                          //
+                       target_page->y_offset + location_in_atlas.y(),  //
+                       glyph_size.width,                               //
+                       glyph_size.height                               //
+                       ));
   }
 
   return true;
@@ -124,9 +185,9 @@ static ISize OptimumAtlasSizeForFontGlyphPairs(
 
   TRACE_EVENT0("impeller", __FUNCTION__);
 
-  ISize current_size = type == GlyphAtlas::Type::kAlphaBitmap
-                           ? ISize(kMinAlphaBitmapSize, kMinAlphaBitmapSize)
-                           : ISize(kMinAtlasSize, kMinAtlasSize);
+  ISize current_size = type == GlyphAtlas::Type::kColorBitmap
+                           ? ISize(kMinAtlasSize, kMinAtlasSize)
+                           : ISize(kMinAlphaBitmapSize, kMinAlphaBitmapSize);
   size_t total_pairs = pairs.size() + 1;
   do {
     auto rect_packer = std::shared_ptr<RectanglePacker>(
@@ -135,7 +196,13 @@ static ISize OptimumAtlasSizeForFontGlyphPairs(
     auto remaining_pairs = PairsFitInAtlasOfSize(pairs, current_size,
                                                  glyph_positions, rect_packer);
     if (remaining_pairs == 0) {
-      atlas_context->UpdateRectPacker(rect_packer);
+      // The rebuilt atlas starts out as a single page covering the entire
+      // texture.
+      GlyphAtlasContext::Page page;
+      page.packer = std::move(rect_packer);
+      page.height = current_size.height;
+      page.last_used_frame = atlas_context->GetFrameCount();
+      atlas_context->UpdatePages({std::move(page)});
       return current_size;
     } else if (remaining_pairs < std::ceil(total_pairs / 2)) {
       current_size = ISize::MakeWH(
@@ -152,6 +219,18 @@ static ISize OptimumAtlasSizeForFontGlyphPairs(
   return ISize{0, 0};
 }
 
+static void TouchPageForPosition(std::vector<GlyphAtlasContext::Page>& pages,
+                                 const Rect& position,
+                                 size_t frame_count) {
+  for (auto& page : pages) {
+    if (position.origin.y >= page.y_offset &&
+        position.origin.y < page.y_offset + page.height) {
+      page.last_used_frame = frame_count;
+      return;
+    }
+  }
+}
+
 static void DrawGlyph(SkCanvas* canvas,
                       const ScaledFont& scaled_font,
                       const Glyph& glyph,
@@ -185,41 +264,195 @@ static void DrawGlyph(SkCanvas* canvas,
   );
 }
 
-static bool UpdateAtlasBitmap(const GlyphAtlas& atlas,
-                              const std::shared_ptr<SkBitmap>& bitmap,
-                              const std::vector<FontGlyphPair>& new_pairs) {
+//------------------------------------------------------------------------------
+/// A single glyph to rasterize along with its location in the atlas.
+///
+struct GlyphDraw {
+  ScaledFont scaled_font;
+  Glyph glyph;
+  Rect location;
+};
+
+static void DrawGlyphDraws(SkCanvas* canvas,
+                           const std::vector<GlyphDraw>& draws,
+                           size_t start,
+                           size_t stride,
+                           bool has_color) {
+  for (size_t i = start; i < draws.size(); i += stride) {
+    const GlyphDraw& draw = draws[i];
+    canvas->save();
+    canvas->resetMatrix();
+    // Packed locations are separated by kPadding pixels, so clipping each
+    // draw to its slightly outset location keeps concurrent writes to the
+    // shared pixels disjoint.
+    canvas->clipRect(SkRect::MakeLTRB(
+        draw.location.GetLeft() - 1, draw.location.GetTop() - 1,
+        draw.location.GetRight() + 1, draw.location.GetBottom() + 1));
+    DrawGlyph(canvas, draw.scaled_font, draw.glyph, draw.location, has_color);
+    canvas->restore();
+  }
+}
+
+//------------------------------------------------------------------------------
+/// Convert the A8 coverage in `location` to an 8-bit signed distance field in
+/// place. The field is 0.5 at the glyph boundary and reaches 1.0 and 0.0 at
+/// kGlyphSdfSpread pixels inside and outside of it respectively. The field is
+/// only computed within the glyph's own atlas location, so its outward reach
+/// is truncated at the edges of the glyph bounds.
+///
+static void ConvertGlyphRegionToSignedDistanceField(
+    const std::shared_ptr<SkBitmap>& bitmap,
+    const Rect& location) {
+  constexpr int32_t spread = kGlyphSdfSpread;
+  const int32_t left =
+      std::max<int32_t>(0, static_cast<int32_t>(location.GetLeft()));
+  const int32_t top =
+      std::max<int32_t>(0, static_cast<int32_t>(location.GetTop()));
+  const int32_t right = std::min<int32_t>(
+      bitmap->width(), static_cast<int32_t>(location.GetRight()));
+  const int32_t bottom = std::min<int32_t>(
+      bitmap->height(), static_cast<int32_t>(location.GetBottom()));
+  const int32_t width = right - left;
+  const int32_t height = bottom - top;
+  if (width <= 0 || height <= 0) {
+    return;
+  }
+
+  // Snapshot the coverage so that distances are measured against the original
+  // rasterization while the region is being overwritten.
+  std::vector<uint8_t> coverage(width * height);
+  for (int32_t y = 0; y < height; y++) {
+    std::memcpy(&coverage[y * width], bitmap->getAddr8(left, top + y), width);
+  }
+  auto is_inside = [&coverage, width](int32_t x, int32_t y) {
+    return coverage[y * width + x] >= 0x80;
+  };
+
+  for (int32_t y = 0; y < height; y++) {
+    uint8_t* row = bitmap->getAddr8(left, top + y);
+    for (int32_t x = 0; x < width; x++) {
+      const bool inside = is_inside(x, y);
+      // Brute force search for the nearest pixel on the other side of the
+      // boundary. The window is tiny (2 * spread + 1 squared) and the regions
+      // are glyph sized, so this is cheap enough and trivially parallel.
+      Scalar distance = spread;
+      const int32_t min_dy = std::max(-spread, -y);
+      const int32_t max_dy = std::min(spread, height - 1 - y);
+      for (int32_t dy = min_dy; dy <= max_dy; dy++) {
+        const int32_t min_dx = std::max(-spread, -x);
+        const int32_t max_dx = std::min(spread, width - 1 - x);
+        for (int32_t dx = min_dx; dx <= max_dx; dx++) {
+          if (is_inside(x + dx, y + dy) == inside) {
+            continue;
+          }
+          distance = std::min(
+              distance, std::sqrt(static_cast<Scalar>(dx * dx + dy * dy)));
+        }
+      }
+      const Scalar signed_distance = inside ? distance : -distance;
+      const Scalar value =
+          std::clamp(0.5f + signed_distance / (2.0f * spread), 0.0f, 1.0f);
+      row[x] = static_cast<uint8_t>(std::round(value * 255.0f));
+    }
+  }
+}
+
+// Below this count, the latch and task overhead outweighs fanning the
+// rasterization out to the workers.
+static constexpr size_t kMinGlyphsForParallelRasterization = 8u;
+
+static bool RasterizeGlyphDraws(
+    const std::shared_ptr<SkBitmap>& bitmap,
+    const std::vector<GlyphDraw>& draws,
+    GlyphAtlas::Type type,
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& worker_task_runner) {
   TRACE_EVENT0("impeller", __FUNCTION__);
   FML_DCHECK(bitmap != nullptr);
 
-  auto surface = SkSurfaces::WrapPixels(bitmap->pixmap());
-  if (!surface) {
-    return false;
+  const bool has_color = type == GlyphAtlas::Type::kColorBitmap;
+  const bool is_sdf = type == GlyphAtlas::Type::kSignedDistanceField;
+
+  if (!worker_task_runner ||
+      draws.size() < kMinGlyphsForParallelRasterization) {
+    auto surface = SkSurfaces::WrapPixels(bitmap->pixmap());
+    if (!surface) {
+      return false;
+    }
+    auto canvas = surface->getCanvas();
+    if (!canvas) {
+      return false;
+    }
+    DrawGlyphDraws(canvas, draws, 0u, 1u, has_color);
+    if (is_sdf) {
+      for (const GlyphDraw& draw : draws) {
+        ConvertGlyphRegionToSignedDistanceField(bitmap, draw.location);
+      }
+    }
+    return true;
   }
-  auto canvas = surface->getCanvas();
-  if (!canvas) {
-    return false;
+
+  // Each worker wraps the shared pixels in a surface of its own and renders
+  // every stride-th glyph. Since every draw is clipped to its own location in
+  // the atlas, the workers never write to the same pixels. The same holds for
+  // the distance field conversion, which only touches a glyph's own location.
+  const size_t task_count = std::min(
+      draws.size(),
+      static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency())));
+  std::atomic_bool success = true;
+  fml::CountDownLatch latch(task_count);
+  for (size_t task_index = 0; task_index < task_count; task_index++) {
+    worker_task_runner->PostTask([&, task_index] {
+      auto surface = SkSurfaces::WrapPixels(bitmap->pixmap());
+      if (surface && surface->getCanvas()) {
+        DrawGlyphDraws(surface->getCanvas(), draws, task_index, task_count,
+                       has_color);
+        if (is_sdf) {
+          for (size_t i = task_index; i < draws.size(); i += task_count) {
+            ConvertGlyphRegionToSignedDistanceField(bitmap, draws[i].location);
+          }
+        }
+      } else {
+        success = false;
+      }
+      latch.CountDown();
+    });
   }
+  latch.Wait();
+  return success;
+}
 
-  bool has_color = atlas.GetType() == GlyphAtlas::Type::kColorBitmap;
+static bool UpdateAtlasBitmap(
+    const GlyphAtlas& atlas,
+    const std::shared_ptr<SkBitmap>& bitmap,
+    const std::vector<FontGlyphPair>& new_pairs,
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& worker_task_runner) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  FML_DCHECK(bitmap != nullptr);
 
+  std::vector<GlyphDraw> draws;
+  draws.reserve(new_pairs.size());
   for (const FontGlyphPair& pair : new_pairs) {
     auto pos = atlas.FindFontGlyphBounds(pair);
     if (!pos.has_value()) {
       continue;
     }
-    DrawGlyph(canvas, pair.scaled_font, pair.glyph, pos.value(), has_color);
+    draws.push_back(GlyphDraw{pair.scaled_font, pair.glyph, pos.value()});
   }
-  return true;
+  return RasterizeGlyphDraws(bitmap, draws, atlas.GetType(),
+                             worker_task_runner);
 }
 
-static std::shared_ptr<SkBitmap> CreateAtlasBitmap(const GlyphAtlas& atlas,
-                                                   const ISize& atlas_size) {
+static std::shared_ptr<SkBitmap> CreateAtlasBitmap(
+    const GlyphAtlas& atlas,
+    const ISize& atlas_size,
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& worker_task_runner) {
   TRACE_EVENT0("impeller", __FUNCTION__);
   auto bitmap = std::make_shared<SkBitmap>();
   SkImageInfo image_info;
 
   switch (atlas.GetType()) {
     case GlyphAtlas::Type::kAlphaBitmap:
+    case GlyphAtlas::Type::kSignedDistanceField:
       image_info = SkImageInfo::MakeA8(atlas_size.width, atlas_size.height);
       break;
     case GlyphAtlas::Type::kColorBitmap:
@@ -232,25 +465,111 @@ static std::shared_ptr<SkBitmap> CreateAtlasBitmap(const GlyphAtlas& atlas,
     return nullptr;
   }
 
-  auto surface = SkSurfaces::WrapPixels(bitmap->pixmap());
-  if (!surface) {
+  std::vector<GlyphDraw> draws;
+  draws.reserve(atlas.GetGlyphCount());
+  atlas.IterateGlyphs([&draws](const ScaledFont& scaled_font,
+                               const Glyph& glyph,
+                               const Rect& location) -> bool {
+    draws.push_back(GlyphDraw{scaled_font, glyph, location});
+    return true;
+  });
+
+  if (!RasterizeGlyphDraws(bitmap, draws, atlas.GetType(),
+                           worker_task_runner)) {
     return nullptr;
   }
-  auto canvas = surface->getCanvas();
-  if (!canvas) {
+
+  return bitmap;
+}
+
+static void ClearAtlasBitmapRegion(const std::shared_ptr<SkBitmap>& bitmap,
+                                   const IRect& region) {
+  FML_DCHECK(bitmap != nullptr);
+  // Evicted regions are always full-width strips, so their rows are
+  // contiguous in memory.
+  FML_DCHECK(region.origin.x == 0 &&
+             region.size.width == static_cast<int64_t>(bitmap->width()));
+  ::memset(bitmap->getAddr(0, region.origin.y), 0,
+           bitmap->rowBytes() * region.size.height);
+}
+
+static std::shared_ptr<SkBitmap> GrowAtlasBitmap(
+    const std::shared_ptr<SkBitmap>& old_bitmap,
+    const ISize& new_size) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  FML_DCHECK(old_bitmap != nullptr);
+
+  auto bitmap = std::make_shared<SkBitmap>();
+  auto image_info = old_bitmap->info().makeWH(new_size.width, new_size.height);
+  if (!bitmap->tryAllocPixels(image_info)) {
+    return nullptr;
+  }
+  if (!bitmap->writePixels(old_bitmap->pixmap(), 0, 0)) {
     return nullptr;
   }
+  return bitmap;
+}
 
-  bool has_color = atlas.GetType() == GlyphAtlas::Type::kColorBitmap;
+static IRect ComputeUpdatedRegion(const std::vector<Rect>& glyph_positions,
+                                  const std::vector<IRect>& evicted_regions,
+                                  const ISize& atlas_size) {
+  FML_DCHECK(!glyph_positions.empty());
+  Rect region = glyph_positions[0];
+  for (size_t i = 1; i < glyph_positions.size(); i++) {
+    region = region.Union(glyph_positions[i]);
+  }
+  auto bounds = IRect::MakeLTRB(
+      std::floor(region.GetLeft()), std::floor(region.GetTop()),
+      std::ceil(region.GetRight()), std::ceil(region.GetBottom()));
+  for (const IRect& evicted : evicted_regions) {
+    bounds = bounds.Union(evicted);
+  }
+  return bounds.Intersection(IRect::MakeSize(atlas_size))
+      .value_or(IRect::MakeSize(atlas_size));
+}
+
+static bool UpdateGlyphTextureAtlasRegion(
+    Context& context,
+    const std::shared_ptr<SkBitmap>& bitmap,
+    const std::shared_ptr<Texture>& texture,
+    const IRect& region) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  FML_DCHECK(bitmap != nullptr);
 
-  atlas.IterateGlyphs([canvas, has_color](const ScaledFont& scaled_font,
-                                          const Glyph& glyph,
-                                          const Rect& location) -> bool {
-    DrawGlyph(canvas, scaled_font, glyph, location, has_color);
+  if (region.size.IsEmpty()) {
     return true;
-  });
+  }
 
-  return bitmap;
+  // The staging buffer contains only the rows of the updated region, packed
+  // with no per-row padding.
+  const auto bytes_per_pixel = bitmap->bytesPerPixel();
+  const auto bytes_per_region_row = region.size.width * bytes_per_pixel;
+  std::vector<uint8_t> region_pixels;
+  region_pixels.reserve(region.size.Area() * bytes_per_pixel);
+  for (auto y = region.origin.y; y < region.origin.y + region.size.height;
+       y++) {
+    const auto* row = reinterpret_cast<const uint8_t*>(
+        bitmap->getAddr(region.origin.x, y));
+    region_pixels.insert(region_pixels.end(), row, row + bytes_per_region_row);
+  }
+
+  auto buffer = context.GetResourceAllocator()->CreateBufferWithCopy(
+      region_pixels.data(), region_pixels.size());
+  if (!buffer) {
+    return false;
+  }
+
+  auto cmd_buffer = context.CreateCommandBuffer();
+  if (!cmd_buffer) {
+    return false;
+  }
+  auto blit_pass = cmd_buffer->CreateBlitPass();
+  if (!blit_pass ||
+      !blit_pass->AddCopy(buffer->AsBufferView(), texture, region)) {
+    return false;
+  }
+  return blit_pass->EncodeCommands(context.GetResourceAllocator()) &&
+         cmd_buffer->SubmitCommands();
 }
 
 static bool UpdateGlyphTextureAtlas(std::shared_ptr<SkBitmap> bitmap,
@@ -286,6 +605,7 @@ static std::shared_ptr<Texture> UploadGlyphTextureAtlas(
   texture_descriptor.storage_mode = StorageMode::kHostVisible;
   texture_descriptor.format = format;
   texture_descriptor.size = atlas_size;
+  texture_descriptor.resource_class = ResourceClass::kGlyphAtlas;
 
   if (pixmap.rowBytes() * pixmap.height() !=
       texture_descriptor.GetByteSizeOfBaseMipLevel()) {
@@ -326,9 +646,14 @@ std::shared_ptr<GlyphAtlas> TypographerContextSkia::CreateGlyphAtlas(
     return last_atlas;
   }
 
+  atlas_context->AdvanceFrameCount();
+  const size_t frame_count = atlas_context->GetFrameCount();
+  std::vector<GlyphAtlasContext::Page> pages = atlas_context->GetPages();
+
   // ---------------------------------------------------------------------------
   // Step 1: Determine if the atlas type and font glyph pairs are compatible
-  //         with the current atlas and reuse if possible.
+  //         with the current atlas and reuse if possible. Pages holding glyphs
+  //         that are needed this frame are kept alive for LRU eviction.
   // ---------------------------------------------------------------------------
   std::vector<FontGlyphPair> new_glyphs;
   for (const auto& font_value : font_glyph_map) {
@@ -337,7 +662,10 @@ std::shared_ptr<GlyphAtlas> TypographerContextSkia::CreateGlyphAtlas(
         last_atlas->GetFontGlyphAtlas(scaled_font.font, scaled_font.scale);
     if (font_glyph_atlas) {
       for (const Glyph& glyph : font_value.second) {
-        if (!font_glyph_atlas->FindGlyphBounds(glyph)) {
+        auto position = font_glyph_atlas->FindGlyphBounds(glyph);
+        if (position.has_value()) {
+          TouchPageForPosition(pages, position.value(), frame_count);
+        } else {
           new_glyphs.emplace_back(scaled_font, glyph);
         }
       }
@@ -348,6 +676,7 @@ std::shared_ptr<GlyphAtlas> TypographerContextSkia::CreateGlyphAtlas(
     }
   }
   if (last_atlas->GetType() == type && new_glyphs.size() == 0) {
+    atlas_context->UpdatePages(std::move(pages));
     return last_atlas;
   }
 
@@ -357,34 +686,77 @@ std::shared_ptr<GlyphAtlas> TypographerContextSkia::CreateGlyphAtlas(
   //         the type is identical.
   // ---------------------------------------------------------------------------
   std::vector<Rect> glyph_positions;
+  std::vector<IRect> evicted_regions;
+  ISize appended_atlas_size = atlas_context->GetAtlasSize();
   if (last_atlas->GetType() == type &&
-      CanAppendToExistingAtlas(last_atlas, new_glyphs, glyph_positions,
-                               atlas_context->GetAtlasSize(),
-                               atlas_context->GetRectPacker())) {
-    // The old bitmap will be reused and only the additional glyphs will be
-    // added.
+      AppendToExistingAtlas(
+          last_atlas, new_glyphs, glyph_positions, pages, appended_atlas_size,
+          context.GetResourceAllocator()->GetMaxTextureSizeSupported(),
+          frame_count, evicted_regions)) {
+    // The old bitmap will be reused; only evicted pages are cleared and only
+    // the additional glyphs are rendered.
+    const bool did_grow = appended_atlas_size != atlas_context->GetAtlasSize();
+    atlas_context->UpdatePages(std::move(pages));
 
     // ---------------------------------------------------------------------------
-    // Step 3a: Record the positions in the glyph atlas of the newly added
-    //          glyphs.
+    // Step 3a: If the packing area grew, move the old bitmap into a taller
+    //          allocation; previously rendered glyphs keep their positions and
+    //          do not need to be redrawn. Then clear any evicted pages and
+    //          drop their glyphs from the atlas.
     // ---------------------------------------------------------------------------
-    for (size_t i = 0, count = glyph_positions.size(); i < count; i++) {
-      last_atlas->AddTypefaceGlyphPosition(new_glyphs[i], glyph_positions[i]);
+    auto bitmap = atlas_context_skia.GetBitmap();
+    if (did_grow) {
+      bitmap = GrowAtlasBitmap(bitmap, appended_atlas_size);
+      if (!bitmap) {
+        return nullptr;
+      }
+      atlas_context_skia.UpdateBitmap(bitmap);
+    }
+    for (const IRect& region : evicted_regions) {
+      last_atlas->RemoveTypefaceGlyphPositionsInRegion(
+          Rect::MakeXYWH(region.origin.x, region.origin.y,  //
+                         region.size.width, region.size.height));
+      ClearAtlasBitmapRegion(bitmap, region);
     }
 
     // ---------------------------------------------------------------------------
-    // Step 4a: Draw new font-glyph pairs into the existing bitmap.
+    // Step 4a: Record the positions in the glyph atlas of the newly added
+    //          glyphs and draw them into the bitmap.
     // ---------------------------------------------------------------------------
-    auto bitmap = atlas_context_skia.GetBitmap();
-    if (!UpdateAtlasBitmap(*last_atlas, bitmap, new_glyphs)) {
+    for (size_t i = 0, count = glyph_positions.size(); i < count; i++) {
+      last_atlas->AddTypefaceGlyphPosition(new_glyphs[i], glyph_positions[i]);
+    }
+    if (!UpdateAtlasBitmap(*last_atlas, bitmap, new_glyphs,
+                           context.GetWorkerTaskRunner())) {
       return nullptr;
     }
 
     // ---------------------------------------------------------------------------
-    // Step 5a: Update the existing texture with the updated bitmap.
+    // Step 5a: Update the existing texture with the updated bitmap. A grown
+    //          atlas needs a new texture. Otherwise, only the region covering
+    //          the new glyphs and evicted pages is uploaded when the backend
+    //          supports copying buffer regions into textures.
     // ---------------------------------------------------------------------------
-    if (!UpdateGlyphTextureAtlas(bitmap, last_atlas->GetTexture())) {
-      return nullptr;
+    if (did_grow) {
+      auto texture = UploadGlyphTextureAtlas(
+          context.GetResourceAllocator(), bitmap, appended_atlas_size,
+          last_atlas->GetTexture()->GetTextureDescriptor().format);
+      if (!texture) {
+        return nullptr;
+      }
+      last_atlas->SetTexture(std::move(texture));
+      atlas_context->UpdateGlyphAtlas(last_atlas, appended_atlas_size);
+    } else if (context.GetCapabilities()->SupportsBufferToTextureBlits()) {
+      if (!UpdateGlyphTextureAtlasRegion(
+              context, bitmap, last_atlas->GetTexture(),
+              ComputeUpdatedRegion(glyph_positions, evicted_regions,
+                                   appended_atlas_size))) {
+        return nullptr;
+      }
+    } else {
+      if (!UpdateGlyphTextureAtlas(bitmap, last_atlas->GetTexture())) {
+        return nullptr;
+      }
     }
     return last_atlas;
   }
@@ -440,7 +812,8 @@ std::shared_ptr<GlyphAtlas> TypographerContextSkia::CreateGlyphAtlas(
   // ---------------------------------------------------------------------------
   // Step 6b: Draw font-glyph pairs in the correct spot in the atlas.
   // ---------------------------------------------------------------------------
-  auto bitmap = CreateAtlasBitmap(*glyph_atlas, atlas_size);
+  auto bitmap = CreateAtlasBitmap(*glyph_atlas, atlas_size,
+                                  context.GetWorkerTaskRunner());
   if (!bitmap) {
     return nullptr;
   }
@@ -452,6 +825,7 @@ std::shared_ptr<GlyphAtlas> TypographerContextSkia::CreateGlyphAtlas(
   PixelFormat format;
   switch (type) {
     case GlyphAtlas::Type::kAlphaBitmap:
+    case GlyphAtlas::Type::kSignedDistanceField:
       format = PixelFormat::kA8UNormInt;
       break;
     case GlyphAtlas::Type::kColorBitmap:
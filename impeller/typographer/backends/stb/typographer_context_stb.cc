@@ -178,7 +178,13 @@ static ISize OptimumAtlasSizeForFontGlyphPairs(
     auto remaining_pairs = PairsFitInAtlasOfSize(pairs, current_size,
                                                  glyph_positions, rect_packer);
     if (remaining_pairs == 0) {
-      atlas_context->UpdateRectPacker(rect_packer);
+      // The rebuilt atlas starts out as a single page covering the entire
+      // texture.
+      GlyphAtlasContext::Page page;
+      page.packer = std::move(rect_packer);
+      page.height = current_size.height;
+      page.last_used_frame = atlas_context->GetFrameCount();
+      atlas_context->UpdatePages({std::move(page)});
       return current_size;
     } else if (remaining_pairs < std::ceil(total_pairs / 2)) {
       current_size = ISize::MakeWH(
@@ -348,6 +354,7 @@ static std::shared_ptr<Texture> UploadGlyphTextureAtlas(
   texture_descriptor.storage_mode = StorageMode::kHostVisible;
   texture_descriptor.format = format;
   texture_descriptor.size = atlas_size;
+  texture_descriptor.resource_class = ResourceClass::kGlyphAtlas;
 
   if (bitmap->GetRowBytes() * bitmap->GetHeight() !=
       texture_descriptor.GetByteSizeOfBaseMipLevel()) {
@@ -517,6 +524,9 @@ std::shared_ptr<GlyphAtlas> TypographerContextSTB::CreateGlyphAtlas(
   PixelFormat format;
   switch (type) {
     case GlyphAtlas::Type::kAlphaBitmap:
+    // The STB backend does not generate distance fields. SDF atlases are
+    // uploaded as plain coverage, which renders as slightly thinned glyphs.
+    case GlyphAtlas::Type::kSignedDistanceField:
       format = PixelFormat::kA8UNormInt;
       break;
     case GlyphAtlas::Type::kColorBitmap:
@@ -24,7 +24,15 @@ const ISize& GlyphAtlasContext::GetAtlasSize() const {
 }
 
 std::shared_ptr<RectanglePacker> GlyphAtlasContext::GetRectPacker() const {
-  return rect_packer_;
+  if (pages_.empty()) {
+    return nullptr;
+  }
+  return pages_.front().packer;
+}
+
+const std::vector<GlyphAtlasContext::Page>& GlyphAtlasContext::GetPages()
+    const {
+  return pages_;
 }
 
 void GlyphAtlasContext::UpdateGlyphAtlas(std::shared_ptr<GlyphAtlas> atlas,
@@ -33,9 +41,16 @@ void GlyphAtlasContext::UpdateGlyphAtlas(std::shared_ptr<GlyphAtlas> atlas,
   atlas_size_ = size;
 }
 
-void GlyphAtlasContext::UpdateRectPacker(
-    std::shared_ptr<RectanglePacker> rect_packer) {
-  rect_packer_ = std::move(rect_packer);
+void GlyphAtlasContext::UpdatePages(std::vector<Page> pages) {
+  pages_ = std::move(pages);
+}
+
+size_t GlyphAtlasContext::GetFrameCount() const {
+  return frame_count_;
+}
+
+void GlyphAtlasContext::AdvanceFrameCount() {
+  frame_count_++;
 }
 
 GlyphAtlas::GlyphAtlas(Type type) : type_(type) {}
@@ -63,6 +78,27 @@ void GlyphAtlas::AddTypefaceGlyphPosition(const FontGlyphPair& pair,
   font_atlas_map_[pair.scaled_font].positions_[pair.glyph] = rect;
 }
 
+size_t GlyphAtlas::RemoveTypefaceGlyphPositionsInRegion(const Rect& region) {
+  size_t removed = 0u;
+  for (auto it = font_atlas_map_.begin(); it != font_atlas_map_.end();) {
+    auto& positions = it->second.positions_;
+    for (auto position = positions.begin(); position != positions.end();) {
+      if (position->second.IntersectsWithRect(region)) {
+        position = positions.erase(position);
+        removed++;
+      } else {
+        ++position;
+      }
+    }
+    if (positions.empty()) {
+      it = font_atlas_map_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return removed;
+}
+
 std::optional<Rect> GlyphAtlas::FindFontGlyphBounds(
     const FontGlyphPair& pair) const {
   const auto& found = font_atlas_map_.find(pair.scaled_font);
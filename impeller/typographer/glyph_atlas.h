@@ -8,6 +8,7 @@
 #include <memory>
 #include <optional>
 #include <unordered_map>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "impeller/core/texture.h"
@@ -20,6 +21,15 @@ namespace impeller {
 
 class FontGlyphAtlas;
 
+//------------------------------------------------------------------------------
+/// @brief      The distance, in atlas pixels, over which a signed distance
+///             field glyph transitions from fully inside to fully outside the
+///             glyph boundary. Shared between field generation in the
+///             typographer backends and the smoothing computation of the SDF
+///             text shader.
+///
+constexpr int32_t kGlyphSdfSpread = 4;
+
 //------------------------------------------------------------------------------
 /// @brief      A texture containing the bitmap representation of glyphs in
 ///             different fonts along with the ability to query the location of
@@ -41,6 +51,14 @@ class GlyphAtlas {
     /// colors.
     ///
     kColorBitmap,
+
+    //--------------------------------------------------------------------------
+    /// The glyphs are represented as an 8-bit signed distance field of their
+    /// boundary. A single entry can be sampled over a wide range of scales
+    /// without re-rasterization, which keeps the atlas stable while text
+    /// animates its scale.
+    ///
+    kSignedDistanceField,
   };
 
   //----------------------------------------------------------------------------
@@ -82,6 +100,17 @@ class GlyphAtlas {
   ///
   void AddTypefaceGlyphPosition(const FontGlyphPair& pair, Rect rect);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Remove the locations of all font-glyph pairs whose rectangles
+  ///             intersect the given region of the atlas. Used when evicting a
+  ///             page of the atlas for reuse.
+  ///
+  /// @param[in]  region  The region of the atlas to evict.
+  ///
+  /// @return     The number of glyphs removed.
+  ///
+  size_t RemoveTypefaceGlyphPositionsInRegion(const Rect& region);
+
   //----------------------------------------------------------------------------
   /// @brief      Get the number of unique font-glyph pairs in this atlas.
   ///
@@ -143,6 +172,16 @@ class GlyphAtlas {
 ///
 class GlyphAtlasContext {
  public:
+  //----------------------------------------------------------------------------
+  /// @brief      A horizontal strip of the atlas texture with its own packing
+  ///             state and least-recently-used tracking.
+  struct Page {
+    std::shared_ptr<RectanglePacker> packer;
+    int64_t y_offset = 0;
+    int64_t height = 0;
+    size_t last_used_frame = 0;
+  };
+
   virtual ~GlyphAtlasContext();
 
   //----------------------------------------------------------------------------
@@ -154,14 +193,25 @@ class GlyphAtlasContext {
   const ISize& GetAtlasSize() const;
 
   //----------------------------------------------------------------------------
-  /// @brief      Retrieve the previous (if any) rect packer.
+  /// @brief      Retrieve the rect packer of the first page, if any.
   std::shared_ptr<RectanglePacker> GetRectPacker() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Retrieve the pages of the current glyph atlas.
+  const std::vector<Page>& GetPages() const;
+
   //----------------------------------------------------------------------------
   /// @brief      Update the context with a newly constructed glyph atlas.
   void UpdateGlyphAtlas(std::shared_ptr<GlyphAtlas> atlas, ISize size);
 
-  void UpdateRectPacker(std::shared_ptr<RectanglePacker> rect_packer);
+  void UpdatePages(std::vector<Page> pages);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The number of times an atlas has been requested from this
+  ///             context. Used for least-recently-used page tracking.
+  size_t GetFrameCount() const;
+
+  void AdvanceFrameCount();
 
  protected:
   GlyphAtlasContext();
@@ -169,7 +219,8 @@ class GlyphAtlasContext {
  private:
   std::shared_ptr<GlyphAtlas> atlas_;
   ISize atlas_size_;
-  std::shared_ptr<RectanglePacker> rect_packer_;
+  std::vector<Page> pages_;
+  size_t frame_count_ = 0;
 
   GlyphAtlasContext(const GlyphAtlasContext&) = delete;
 
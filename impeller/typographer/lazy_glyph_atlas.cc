@@ -4,6 +4,7 @@
 
 #include "impeller/typographer/lazy_glyph_atlas.h"
 
+#include "flutter/fml/trace_event.h"
 #include "impeller/base/validation.h"
 #include "impeller/typographer/typographer_context.h"
 
@@ -11,6 +12,20 @@
 
 namespace impeller {
 
+namespace {
+
+// The usage history epochs rotate after this many frames. A glyph that goes
+// unused for two full epochs is no longer pre-warmed.
+constexpr size_t kUsageHistoryFrames = 64u;
+
+void MergeGlyphMap(const FontGlyphMap& source, FontGlyphMap& target) {
+  for (const auto& [scaled_font, glyphs] : source) {
+    target[scaled_font].insert(glyphs.begin(), glyphs.end());
+  }
+}
+
+}  // namespace
+
 LazyGlyphAtlas::LazyGlyphAtlas(
     std::shared_ptr<TypographerContext> typographer_context)
     : typographer_context_(std::move(typographer_context)),
@@ -19,23 +34,77 @@ LazyGlyphAtlas::LazyGlyphAtlas(
                          : nullptr),
       color_context_(typographer_context_
                          ? typographer_context_->CreateGlyphAtlasContext()
-                         : nullptr) {}
+                         : nullptr),
+      sdf_context_(typographer_context_
+                       ? typographer_context_->CreateGlyphAtlasContext()
+                       : nullptr) {}
 
 LazyGlyphAtlas::~LazyGlyphAtlas() = default;
 
 void LazyGlyphAtlas::AddTextFrame(const TextFrame& frame, Scalar scale) {
+  AddTextFrame(frame, scale, frame.GetAtlasType());
+}
+
+void LazyGlyphAtlas::AddTextFrame(const TextFrame& frame,
+                                  Scalar scale,
+                                  GlyphAtlas::Type type) {
   FML_DCHECK(atlas_map_.empty());
-  if (frame.GetAtlasType() == GlyphAtlas::Type::kAlphaBitmap) {
-    frame.CollectUniqueFontGlyphPairs(alpha_glyph_map_, scale);
-  } else {
-    frame.CollectUniqueFontGlyphPairs(color_glyph_map_, scale);
+  switch (type) {
+    case GlyphAtlas::Type::kAlphaBitmap:
+      frame.CollectUniqueFontGlyphPairs(alpha_glyph_map_, scale);
+      break;
+    case GlyphAtlas::Type::kColorBitmap:
+      frame.CollectUniqueFontGlyphPairs(color_glyph_map_, scale);
+      break;
+    case GlyphAtlas::Type::kSignedDistanceField:
+      frame.CollectUniqueFontGlyphPairs(sdf_glyph_map_, scale);
+      break;
   }
+  frame.CollectUniqueFontGlyphPairs(usage_histories_[type].current, scale);
 }
 
 void LazyGlyphAtlas::ResetTextFrames() {
   alpha_glyph_map_.clear();
   color_glyph_map_.clear();
+  sdf_glyph_map_.clear();
   atlas_map_.clear();
+  if (++resets_since_epoch_rotation_ >= kUsageHistoryFrames) {
+    resets_since_epoch_rotation_ = 0u;
+    for (auto& [type, history] : usage_histories_) {
+      history.previous = std::move(history.current);
+      history.current.clear();
+    }
+  }
+}
+
+void LazyGlyphAtlas::PreWarmAtlases(Context& context) {
+  TRACE_EVENT0("impeller", "LazyGlyphAtlas::PreWarmAtlases");
+  if (!typographer_context_ || !typographer_context_->IsValid()) {
+    return;
+  }
+  for (const auto& [type, history] : usage_histories_) {
+    if (history.current.empty() && history.previous.empty()) {
+      continue;
+    }
+    std::shared_ptr<GlyphAtlasContext> atlas_context;
+    switch (type) {
+      case GlyphAtlas::Type::kAlphaBitmap:
+        atlas_context = alpha_context_;
+        break;
+      case GlyphAtlas::Type::kColorBitmap:
+        atlas_context = color_context_;
+        break;
+      case GlyphAtlas::Type::kSignedDistanceField:
+        atlas_context = sdf_context_;
+        break;
+    }
+    FontGlyphMap warm_glyphs = history.previous;
+    MergeGlyphMap(history.current, warm_glyphs);
+    // Appends only the glyphs that are not already present in the atlas and
+    // returns immediately when there is nothing new to rasterize.
+    typographer_context_->CreateGlyphAtlas(context, type, atlas_context,
+                                           warm_glyphs);
+  }
 }
 
 std::shared_ptr<GlyphAtlas> LazyGlyphAtlas::CreateOrGetGlyphAtlas(
@@ -59,12 +128,24 @@ std::shared_ptr<GlyphAtlas> LazyGlyphAtlas::CreateOrGetGlyphAtlas(
     return nullptr;
   }
 
-  auto& glyph_map = type == GlyphAtlas::Type::kAlphaBitmap ? alpha_glyph_map_
-                                                           : color_glyph_map_;
-  auto atlas_context =
-      type == GlyphAtlas::Type::kAlphaBitmap ? alpha_context_ : color_context_;
-  auto atlas = typographer_context_->CreateGlyphAtlas(context, type,
-                                                      atlas_context, glyph_map);
+  const FontGlyphMap* glyph_map = nullptr;
+  std::shared_ptr<GlyphAtlasContext> atlas_context;
+  switch (type) {
+    case GlyphAtlas::Type::kAlphaBitmap:
+      glyph_map = &alpha_glyph_map_;
+      atlas_context = alpha_context_;
+      break;
+    case GlyphAtlas::Type::kColorBitmap:
+      glyph_map = &color_glyph_map_;
+      atlas_context = color_context_;
+      break;
+    case GlyphAtlas::Type::kSignedDistanceField:
+      glyph_map = &sdf_glyph_map_;
+      atlas_context = sdf_context_;
+      break;
+  }
+  auto atlas = typographer_context_->CreateGlyphAtlas(
+      context, type, atlas_context, *glyph_map);
   if (!atlas || !atlas->IsValid()) {
     VALIDATION_LOG << "Could not create valid atlas.";
     return nullptr;
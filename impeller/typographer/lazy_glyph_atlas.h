@@ -23,21 +23,47 @@ class LazyGlyphAtlas {
 
   void AddTextFrame(const TextFrame& frame, Scalar scale);
 
+  void AddTextFrame(const TextFrame& frame,
+                    Scalar scale,
+                    GlyphAtlas::Type type);
+
   void ResetTextFrames();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Rasterize glyphs that were used in recent frames but are not
+  ///             yet present in the atlases. Intended to be called off the
+  ///             frame's critical path (when no frame is being produced) so
+  ///             that typing bursts and atlas rebuilds hit a warm atlas.
+  ///
+  void PreWarmAtlases(Context& context);
+
   std::shared_ptr<GlyphAtlas> CreateOrGetGlyphAtlas(
       Context& context,
       GlyphAtlas::Type type) const;
 
  private:
+  //----------------------------------------------------------------------------
+  /// Glyphs used in recent frames, retained so atlases can be warmed between
+  /// frames. The epochs rotate periodically so that glyphs that fall out of
+  /// use age out of the history.
+  ///
+  struct GlyphUsageHistory {
+    FontGlyphMap current;
+    FontGlyphMap previous;
+  };
+
   std::shared_ptr<TypographerContext> typographer_context_;
 
   FontGlyphMap alpha_glyph_map_;
   FontGlyphMap color_glyph_map_;
+  FontGlyphMap sdf_glyph_map_;
   std::shared_ptr<GlyphAtlasContext> alpha_context_;
   std::shared_ptr<GlyphAtlasContext> color_context_;
+  std::shared_ptr<GlyphAtlasContext> sdf_context_;
   mutable std::unordered_map<GlyphAtlas::Type, std::shared_ptr<GlyphAtlas>>
       atlas_map_;
+  std::unordered_map<GlyphAtlas::Type, GlyphUsageHistory> usage_histories_;
+  size_t resets_since_epoch_rotation_ = 0;
 
   LazyGlyphAtlas(const LazyGlyphAtlas&) = delete;
 
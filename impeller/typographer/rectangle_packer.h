@@ -54,6 +54,24 @@ class RectanglePacker {
   ///
   virtual void reset() = 0;
 
+  //----------------------------------------------------------------------------
+  /// @brief     Grow the packing area downwards, keeping all previously added
+  ///            rectangles in place.
+  ///
+  /// @param[in]  new_height  The new height of the packing area. Must be
+  ///                         greater than the current height.
+  ///
+  /// @return    Return true on success; false if the new height is not an
+  ///            increase over the current height.
+  ///
+  bool growToHeight(int new_height) {
+    if (new_height <= height_) {
+      return false;
+    }
+    height_ = new_height;
+    return true;
+  }
+
  protected:
   RectanglePacker(int width, int height) : width_(width), height_(height) {
     FML_DCHECK(width >= 0);
@@ -65,7 +83,7 @@ class RectanglePacker {
 
  private:
   const int width_;
-  const int height_;
+  int height_;
 };
 
 }  // namespace impeller
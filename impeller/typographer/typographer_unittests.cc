@@ -86,6 +86,39 @@ TEST_P(TypographerTest, CanCreateGlyphAtlas) {
                   .has_value());
 }
 
+TEST_P(TypographerTest, CanCreateSignedDistanceFieldGlyphAtlas) {
+  auto context = TypographerContextSkia::Make();
+  auto atlas_context = context->CreateGlyphAtlasContext();
+  ASSERT_TRUE(context && context->IsValid());
+  SkFont sk_font;
+  auto blob = SkTextBlob::MakeFromString("hello", sk_font);
+  ASSERT_TRUE(blob);
+  auto atlas = CreateGlyphAtlas(
+      *GetContext(), context.get(), GlyphAtlas::Type::kSignedDistanceField,
+      1.0f, atlas_context, *MakeTextFrameFromTextBlobSkia(blob));
+  ASSERT_NE(atlas, nullptr);
+  ASSERT_NE(atlas->GetTexture(), nullptr);
+  ASSERT_EQ(atlas->GetType(), GlyphAtlas::Type::kSignedDistanceField);
+  ASSERT_EQ(atlas->GetTexture()->GetTextureDescriptor().format,
+            PixelFormat::kA8UNormInt);
+  ASSERT_EQ(atlas->GetGlyphCount(), 4llu);
+
+  std::optional<impeller::ScaledFont> first_scaled_font;
+  std::optional<impeller::Glyph> first_glyph;
+  atlas->IterateGlyphs([&](const ScaledFont& scaled_font, const Glyph& glyph,
+                           const Rect& rect) -> bool {
+    first_scaled_font = scaled_font;
+    first_glyph = glyph;
+    return false;
+  });
+
+  ASSERT_TRUE(first_scaled_font.has_value());
+  ASSERT_TRUE(atlas
+                  ->FindFontGlyphBounds(
+                      {first_scaled_font.value(), first_glyph.value()})
+                  .has_value());
+}
+
 TEST_P(TypographerTest, LazyAtlasTracksColor) {
 #if FML_OS_MACOSX
   auto mapping = flutter::testing::OpenFixtureAsSkData("Apple Color Emoji.ttc");
@@ -334,6 +367,52 @@ TEST_P(TypographerTest, RectanglePackerAddsNonoverlapingRectangles) {
   ASSERT_EQ(packer->percentFull(), 0);
 }
 
+TEST_P(TypographerTest, RectanglePackerGrowsDownward) {
+  auto packer = RectanglePacker::Factory(100, 40);
+  ASSERT_NE(packer, nullptr);
+
+  IPoint16 output = {-1, -1};  // Fill with sentinel values
+  ASSERT_TRUE(packer->addRect(100, 40, &output));
+  // The packer is now full.
+  ASSERT_FALSE(packer->addRect(1, 1, &output));
+
+  // Growing must strictly increase the height.
+  ASSERT_FALSE(packer->growToHeight(40));
+  ASSERT_FALSE(packer->growToHeight(20));
+  ASSERT_TRUE(packer->growToHeight(80));
+
+  // The next rectangle lands in the newly added area, below the rectangle
+  // placed before the growth.
+  ASSERT_TRUE(packer->addRect(100, 40, &output));
+  ASSERT_EQ(output.y(), 40);
+  ASSERT_TRUE(flutter::testing::NumberNear(packer->percentFull(), 1.0));
+}
+
+TEST_P(TypographerTest, GlyphAtlasEvictsGlyphPositionsInRegion) {
+  SkFont sk_font;
+  auto frame =
+      MakeTextFrameFromTextBlobSkia(SkTextBlob::MakeFromString("ab", sk_font));
+  ScaledFont scaled_font{frame->GetRuns()[0].GetFont(), 1.0f};
+
+  Glyph glyph_a(1, Glyph::Type::kPath, Rect::MakeXYWH(0, 0, 10, 10));
+  Glyph glyph_b(2, Glyph::Type::kPath, Rect::MakeXYWH(0, 0, 10, 10));
+
+  GlyphAtlas atlas(GlyphAtlas::Type::kAlphaBitmap);
+  atlas.AddTypefaceGlyphPosition({scaled_font, glyph_a},
+                                 Rect::MakeXYWH(0, 0, 10, 10));
+  atlas.AddTypefaceGlyphPosition({scaled_font, glyph_b},
+                                 Rect::MakeXYWH(0, 40, 10, 10));
+  ASSERT_EQ(atlas.GetGlyphCount(), 2u);
+
+  // Evicting the strip holding the second glyph removes only that glyph.
+  ASSERT_EQ(atlas.RemoveTypefaceGlyphPositionsInRegion(
+                Rect::MakeXYWH(0, 32, 64, 32)),
+            1u);
+  ASSERT_EQ(atlas.GetGlyphCount(), 1u);
+  ASSERT_TRUE(atlas.FindFontGlyphBounds({scaled_font, glyph_a}).has_value());
+  ASSERT_FALSE(atlas.FindFontGlyphBounds({scaled_font, glyph_b}).has_value());
+}
+
 }  // namespace testing
 }  // namespace impeller
 
@@ -65,6 +65,13 @@ class _StoredMessage {
 
   final Zone _zone;
 
+  /// The time at which the message was buffered, in microseconds on the
+  /// [DateTime] clock.
+  ///
+  /// Used to report how long messages wait in the buffer before being
+  /// delivered. See [_Channel.pop].
+  final int _timestampMicros = DateTime.now().microsecondsSinceEpoch;
+
   void invoke(ByteData? dataArg) {
     _invoke1(_callback, _zone, dataArg);
   }
@@ -122,6 +129,21 @@ class _Channel {
   /// itself an opportunity to check if a listener is set).
   bool _draining = false;
 
+  /// The total number of messages pushed on this channel, whether they were
+  /// delivered directly, buffered, or eventually discarded.
+  int _pushedCount = 0;
+
+  /// The number of messages discarded because the channel overflowed, or
+  /// because the capacity was reduced below the number of stored messages.
+  int _discardedCount = 0;
+
+  /// The longest time a delivered message spent waiting in the buffer, in
+  /// microseconds.
+  ///
+  /// Messages delivered directly to a listener without buffering do not
+  /// contribute to this value.
+  int _maxBufferedTimeMicros = 0;
+
   /// Adds a message to the channel.
   ///
   /// If the channel overflows, earlier messages are discarded, in a
@@ -130,6 +152,7 @@ class _Channel {
   /// on overflow. It is the responsibility of the caller to show the
   /// warning message.
   bool push(_StoredMessage message) {
+    _pushedCount += 1;
     if (!_draining && _channelCallbackRecord != null) {
       assert(_queue.isEmpty);
       _channelCallbackRecord!.invoke(message.data, message.invoke);
@@ -146,7 +169,15 @@ class _Channel {
   /// Returns the first message in the channel and removes it.
   ///
   /// Throws when empty.
-  _StoredMessage pop() => _queue.removeFirst();
+  _StoredMessage pop() {
+    final _StoredMessage message = _queue.removeFirst();
+    final int buffered =
+        DateTime.now().microsecondsSinceEpoch - message._timestampMicros;
+    if (buffered > _maxBufferedTimeMicros) {
+      _maxBufferedTimeMicros = buffered;
+    }
+    return message;
+  }
 
   /// Removes messages until [length] reaches `lengthLimit`.
   ///
@@ -161,6 +192,7 @@ class _Channel {
     while (_queue.length > lengthLimit) {
       final _StoredMessage message = _queue.removeFirst();
       message.invoke(null); // send empty reply to the plugin side
+      _discardedCount += 1;
       result = true;
     }
     return result;
@@ -590,6 +622,31 @@ class ChannelBuffers {
       return true;
     }());
   }
+
+  /// Returns statistics for every channel that has carried a message.
+  ///
+  /// The returned map is keyed by channel name. Each entry reports the
+  /// channel's capacity, current queue length, whether a listener is set, the
+  /// total number of messages pushed, the number discarded due to overflow,
+  /// and the longest time a delivered message spent in the buffer (in
+  /// microseconds).
+  ///
+  /// This is exposed through the `ext.ui.channelBuffers.stats` service
+  /// protocol extension so that lossy or slow-to-drain channels can be
+  /// diagnosed and resized instead of silently dropping messages.
+  Map<String, Object?> _collectStats() {
+    return <String, Object?>{
+      for (final MapEntry<String, _Channel> entry in _channels.entries)
+        entry.key: <String, Object?>{
+          'capacity': entry.value.capacity,
+          'length': entry.value.length,
+          'hasListener': entry.value._channelCallbackRecord != null,
+          'pushedCount': entry.value._pushedCount,
+          'discardedCount': entry.value._discardedCount,
+          'maxBufferedTimeMicros': entry.value._maxBufferedTimeMicros,
+        },
+    };
+  }
 }
 
 /// [ChannelBuffers] that allow the storage of messages between the
@@ -104,6 +104,12 @@ abstract class _EngineLayerWrapper implements EngineLayer {
     }());
   }
 
+  @override
+  void setRasterCachePinned(bool pinned) {
+    assert(_nativeLayer != null, 'Object disposed');
+    _nativeLayer!.setRasterCachePinned(pinned);
+  }
+
   // Children of this layer.
   //
   // Null if this layer has no children. This field is populated only in debug
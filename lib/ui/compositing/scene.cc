@@ -28,23 +28,27 @@ void Scene::create(Dart_Handle scene_handle,
                    std::shared_ptr<flutter::Layer> rootLayer,
                    uint32_t rasterizerTracingThreshold,
                    bool checkerboardRasterCacheImages,
-                   bool checkerboardOffscreenLayers) {
+                   bool checkerboardOffscreenLayers,
+                   bool hasPlatformViews) {
   auto scene = fml::MakeRefCounted<Scene>(
       std::move(rootLayer), rasterizerTracingThreshold,
-      checkerboardRasterCacheImages, checkerboardOffscreenLayers);
+      checkerboardRasterCacheImages, checkerboardOffscreenLayers,
+      hasPlatformViews);
   scene->AssociateWithDartWrapper(scene_handle);
 }
 
 Scene::Scene(std::shared_ptr<flutter::Layer> rootLayer,
              uint32_t rasterizerTracingThreshold,
              bool checkerboardRasterCacheImages,
-             bool checkerboardOffscreenLayers) {
+             bool checkerboardOffscreenLayers,
+             bool hasPlatformViews) {
   layer_tree_config_.root_layer = std::move(rootLayer);
   layer_tree_config_.rasterizer_tracing_threshold = rasterizerTracingThreshold;
   layer_tree_config_.checkerboard_raster_cache_images =
       checkerboardRasterCacheImages;
   layer_tree_config_.checkerboard_offscreen_layers =
       checkerboardOffscreenLayers;
+  layer_tree_config_.has_platform_views = hasPlatformViews;
 }
 
 Scene::~Scene() {}
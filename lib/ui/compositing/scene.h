@@ -23,7 +23,8 @@ class Scene : public RefCountedDartWrappable<Scene> {
                      std::shared_ptr<flutter::Layer> rootLayer,
                      uint32_t rasterizerTracingThreshold,
                      bool checkerboardRasterCacheImages,
-                     bool checkerboardOffscreenLayers);
+                     bool checkerboardOffscreenLayers,
+                     bool hasPlatformViews);
 
   std::unique_ptr<flutter::LayerTree> takeLayerTree(uint64_t width,
                                                     uint64_t height);
@@ -42,7 +43,8 @@ class Scene : public RefCountedDartWrappable<Scene> {
   Scene(std::shared_ptr<flutter::Layer> rootLayer,
         uint32_t rasterizerTracingThreshold,
         bool checkerboardRasterCacheImages,
-        bool checkerboardOffscreenLayers);
+        bool checkerboardOffscreenLayers,
+        bool hasPlatformViews);
 
   // Returns true if `dispose()` has not been called.
   bool valid();
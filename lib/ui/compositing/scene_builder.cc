@@ -33,10 +33,11 @@ namespace flutter {
 
 IMPLEMENT_WRAPPERTYPEINFO(ui, SceneBuilder);
 
-SceneBuilder::SceneBuilder() {
+SceneBuilder::SceneBuilder()
+    : layer_arena_(std::make_shared<LayerArena>()) {
   // Add a ContainerLayer as the root layer, so that AddLayer operations are
   // always valid.
-  PushLayer(std::make_shared<flutter::ContainerLayer>());
+  PushLayer(LayerArena::Make<flutter::ContainerLayer>(layer_arena_));
 }
 
 SceneBuilder::~SceneBuilder() = default;
@@ -45,7 +46,8 @@ void SceneBuilder::pushTransform(Dart_Handle layer_handle,
                                  tonic::Float64List& matrix4,
                                  const fml::RefPtr<EngineLayer>& oldLayer) {
   SkM44 sk_matrix = ToSkM44(matrix4);
-  auto layer = std::make_shared<flutter::TransformLayer>(sk_matrix);
+  auto layer =
+      LayerArena::Make<flutter::TransformLayer>(layer_arena_, sk_matrix);
   PushLayer(layer);
   // matrix4 has to be released before we can return another Dart object
   matrix4.Release();
@@ -61,7 +63,8 @@ void SceneBuilder::pushOffset(Dart_Handle layer_handle,
                               double dy,
                               const fml::RefPtr<EngineLayer>& oldLayer) {
   SkMatrix sk_matrix = SkMatrix::Translate(SafeNarrow(dx), SafeNarrow(dy));
-  auto layer = std::make_shared<flutter::TransformLayer>(sk_matrix);
+  auto layer =
+      LayerArena::Make<flutter::TransformLayer>(layer_arena_, sk_matrix);
   PushLayer(layer);
   EngineLayer::MakeRetained(layer_handle, layer);
 
@@ -80,8 +83,8 @@ void SceneBuilder::pushClipRect(Dart_Handle layer_handle,
   SkRect clipRect = SkRect::MakeLTRB(SafeNarrow(left), SafeNarrow(top),
                                      SafeNarrow(right), SafeNarrow(bottom));
   flutter::Clip clip_behavior = static_cast<flutter::Clip>(clipBehavior);
-  auto layer =
-      std::make_shared<flutter::ClipRectLayer>(clipRect, clip_behavior);
+  auto layer = LayerArena::Make<flutter::ClipRectLayer>(layer_arena_, clipRect,
+                                                         clip_behavior);
   PushLayer(layer);
   EngineLayer::MakeRetained(layer_handle, layer);
 
@@ -95,8 +98,8 @@ void SceneBuilder::pushClipRRect(Dart_Handle layer_handle,
                                  int clipBehavior,
                                  const fml::RefPtr<EngineLayer>& oldLayer) {
   flutter::Clip clip_behavior = static_cast<flutter::Clip>(clipBehavior);
-  auto layer =
-      std::make_shared<flutter::ClipRRectLayer>(rrect.sk_rrect, clip_behavior);
+  auto layer = LayerArena::Make<flutter::ClipRRectLayer>(
+      layer_arena_, rrect.sk_rrect, clip_behavior);
   PushLayer(layer);
   EngineLayer::MakeRetained(layer_handle, layer);
 
@@ -111,8 +114,8 @@ void SceneBuilder::pushClipPath(Dart_Handle layer_handle,
                                 const fml::RefPtr<EngineLayer>& oldLayer) {
   flutter::Clip clip_behavior = static_cast<flutter::Clip>(clipBehavior);
   FML_DCHECK(clip_behavior != flutter::Clip::none);
-  auto layer =
-      std::make_shared<flutter::ClipPathLayer>(path->path(), clip_behavior);
+  auto layer = LayerArena::Make<flutter::ClipPathLayer>(
+      layer_arena_, path->path(), clip_behavior);
   PushLayer(layer);
   EngineLayer::MakeRetained(layer_handle, layer);
 
@@ -126,8 +129,8 @@ void SceneBuilder::pushOpacity(Dart_Handle layer_handle,
                                double dx,
                                double dy,
                                const fml::RefPtr<EngineLayer>& oldLayer) {
-  auto layer = std::make_shared<flutter::OpacityLayer>(
-      alpha, SkPoint::Make(SafeNarrow(dx), SafeNarrow(dy)));
+  auto layer = LayerArena::Make<flutter::OpacityLayer>(
+      layer_arena_, alpha, SkPoint::Make(SafeNarrow(dx), SafeNarrow(dy)));
   PushLayer(layer);
   EngineLayer::MakeRetained(layer_handle, layer);
 
@@ -139,8 +142,8 @@ void SceneBuilder::pushOpacity(Dart_Handle layer_handle,
 void SceneBuilder::pushColorFilter(Dart_Handle layer_handle,
                                    const ColorFilter* color_filter,
                                    const fml::RefPtr<EngineLayer>& oldLayer) {
-  auto layer =
-      std::make_shared<flutter::ColorFilterLayer>(color_filter->filter());
+  auto layer = LayerArena::Make<flutter::ColorFilterLayer>(
+      layer_arena_, color_filter->filter());
   PushLayer(layer);
   EngineLayer::MakeRetained(layer_handle, layer);
 
@@ -154,8 +157,9 @@ void SceneBuilder::pushImageFilter(Dart_Handle layer_handle,
                                    double dx,
                                    double dy,
                                    const fml::RefPtr<EngineLayer>& oldLayer) {
-  auto layer = std::make_shared<flutter::ImageFilterLayer>(
-      image_filter->filter(), SkPoint::Make(SafeNarrow(dx), SafeNarrow(dy)));
+  auto layer = LayerArena::Make<flutter::ImageFilterLayer>(
+      layer_arena_, image_filter->filter(),
+      SkPoint::Make(SafeNarrow(dx), SafeNarrow(dy)));
   PushLayer(layer);
   EngineLayer::MakeRetained(layer_handle, layer);
 
@@ -169,8 +173,8 @@ void SceneBuilder::pushBackdropFilter(
     ImageFilter* filter,
     int blendMode,
     const fml::RefPtr<EngineLayer>& oldLayer) {
-  auto layer = std::make_shared<flutter::BackdropFilterLayer>(
-      filter->filter(), static_cast<DlBlendMode>(blendMode));
+  auto layer = LayerArena::Make<flutter::BackdropFilterLayer>(
+      layer_arena_, filter->filter(), static_cast<DlBlendMode>(blendMode));
   PushLayer(layer);
   EngineLayer::MakeRetained(layer_handle, layer);
 
@@ -192,8 +196,9 @@ void SceneBuilder::pushShaderMask(Dart_Handle layer_handle,
       SkRect::MakeLTRB(SafeNarrow(maskRectLeft), SafeNarrow(maskRectTop),
                        SafeNarrow(maskRectRight), SafeNarrow(maskRectBottom));
   auto sampling = ImageFilter::SamplingFromIndex(filterQualityIndex);
-  auto layer = std::make_shared<flutter::ShaderMaskLayer>(
-      shader->shader(sampling), rect, static_cast<DlBlendMode>(blendMode));
+  auto layer = LayerArena::Make<flutter::ShaderMaskLayer>(
+      layer_arena_, shader->shader(sampling), rect,
+      static_cast<DlBlendMode>(blendMode));
   PushLayer(layer);
   EngineLayer::MakeRetained(layer_handle, layer);
 
@@ -222,9 +227,9 @@ void SceneBuilder::addPicture(double dx,
   // Explicitly check for display_list, since the picture object might have
   // been disposed but not collected yet, but the display list is null.
   if (picture->display_list()) {
-    auto layer = std::make_unique<flutter::DisplayListLayer>(
-        SkPoint::Make(SafeNarrow(dx), SafeNarrow(dy)), picture->display_list(),
-        !!(hints & 1), !!(hints & 2));
+    auto layer = LayerArena::Make<flutter::DisplayListLayer>(
+        layer_arena_, SkPoint::Make(SafeNarrow(dx), SafeNarrow(dy)),
+        picture->display_list(), !!(hints & 1), !!(hints & 2));
     AddLayer(std::move(layer));
   }
 }
@@ -237,8 +242,8 @@ void SceneBuilder::addTexture(double dx,
                               bool freeze,
                               int filterQualityIndex) {
   auto sampling = ImageFilter::SamplingFromIndex(filterQualityIndex);
-  auto layer = std::make_unique<flutter::TextureLayer>(
-      SkPoint::Make(SafeNarrow(dx), SafeNarrow(dy)),
+  auto layer = LayerArena::Make<flutter::TextureLayer>(
+      layer_arena_, SkPoint::Make(SafeNarrow(dx), SafeNarrow(dy)),
       SkSize::Make(SafeNarrow(width), SafeNarrow(height)), textureId, freeze,
       sampling);
   AddLayer(std::move(layer));
@@ -249,9 +254,10 @@ void SceneBuilder::addPlatformView(double dx,
                                    double width,
                                    double height,
                                    int64_t viewId) {
-  auto layer = std::make_unique<flutter::PlatformViewLayer>(
-      SkPoint::Make(SafeNarrow(dx), SafeNarrow(dy)),
+  auto layer = LayerArena::Make<flutter::PlatformViewLayer>(
+      layer_arena_, SkPoint::Make(SafeNarrow(dx), SafeNarrow(dy)),
       SkSize::Make(SafeNarrow(width), SafeNarrow(height)), viewId);
+  has_platform_views_ = true;
   AddLayer(std::move(layer));
 }
 
@@ -262,8 +268,8 @@ void SceneBuilder::addPerformanceOverlay(uint64_t enabledOptions,
                                          double bottom) {
   SkRect rect = SkRect::MakeLTRB(SafeNarrow(left), SafeNarrow(top),
                                  SafeNarrow(right), SafeNarrow(bottom));
-  auto layer =
-      std::make_unique<flutter::PerformanceOverlayLayer>(enabledOptions);
+  auto layer = LayerArena::Make<flutter::PerformanceOverlayLayer>(
+      layer_arena_, enabledOptions);
   layer->set_paint_bounds(rect);
   AddLayer(std::move(layer));
 }
@@ -283,9 +289,10 @@ void SceneBuilder::setCheckerboardOffscreenLayers(bool checkerboard) {
 void SceneBuilder::build(Dart_Handle scene_handle) {
   FML_DCHECK(layer_stack_.size() >= 1);
 
-  Scene::create(
-      scene_handle, std::move(layer_stack_[0]), rasterizer_tracing_threshold_,
-      checkerboard_raster_cache_images_, checkerboard_offscreen_layers_);
+  Scene::create(scene_handle, std::move(layer_stack_[0]),
+                rasterizer_tracing_threshold_,
+                checkerboard_raster_cache_images_,
+                checkerboard_offscreen_layers_, has_platform_views_);
   layer_stack_.clear();
   ClearDartWrapper();  // may delete this object.
 }
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "flutter/flow/layers/container_layer.h"
+#include "flutter/flow/layers/layer_arena.h"
 #include "flutter/lib/ui/compositing/scene.h"
 #include "flutter/lib/ui/dart_wrapper.h"
 #include "flutter/lib/ui/painting/color_filter.h"
@@ -134,10 +135,12 @@ class SceneBuilder : public RefCountedDartWrappable<SceneBuilder> {
   void PushLayer(std::shared_ptr<ContainerLayer> layer);
   void PopLayer();
 
+  std::shared_ptr<LayerArena> layer_arena_;
   std::vector<std::shared_ptr<ContainerLayer>> layer_stack_;
   int rasterizer_tracing_threshold_ = 0;
   bool checkerboard_raster_cache_images_ = false;
   bool checkerboard_offscreen_layers_ = false;
+  bool has_platform_views_ = false;
 
   FML_DISALLOW_COPY_AND_ASSIGN(SceneBuilder);
 };
@@ -180,7 +180,9 @@ typedef CanvasPath Path;
   V(ColorFilter, initMode, 3)                          \
   V(ColorFilter, initSrgbToLinearGamma, 1)             \
   V(EngineLayer, dispose, 1)                           \
+  V(EngineLayer, setRasterCachePinned, 2)              \
   V(FragmentProgram, initFromAsset, 2)                 \
+  V(FragmentProgram, precompile, 2)                    \
   V(ReusableFragmentShader, Dispose, 1)                \
   V(ReusableFragmentShader, SetImageSampler, 3)        \
   V(ReusableFragmentShader, ValidateSamplers, 1)       \
@@ -210,6 +212,7 @@ typedef CanvasPath Path;
   V(ImmutableBuffer, length, 1)                        \
   V(ParagraphBuilder, addPlaceholder, 6)               \
   V(ParagraphBuilder, addText, 2)                      \
+  V(ParagraphBuilder, addUtf16Text, 2)                 \
   V(ParagraphBuilder, build, 2)                        \
   V(ParagraphBuilder, pop, 1)                          \
   V(ParagraphBuilder, pushStyle, 16)                   \
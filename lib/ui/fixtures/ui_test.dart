@@ -247,6 +247,22 @@ void createPath() {
 @pragma('vm:external-name', 'ValidatePath')
 external void _validatePath(Path path);
 
+@pragma('vm:entry-point')
+void createEqualPaths() {
+  final Path path1 = Path()..lineTo(10, 10);
+  final Path path2 = Path()..lineTo(10, 10);
+  _validatePaths(path1, path2);
+  // Arbitrarily hold references to the paths to make sure they do not get
+  // garbage collected.
+  Future<void>.delayed(const Duration(days: 100)).then((_) {
+    path1.lineTo(100, 100);
+    path2.lineTo(100, 100);
+  });
+}
+
+@pragma('vm:external-name', 'ValidatePaths')
+external void _validatePaths(Path path1, Path path2);
+
 @pragma('vm:entry-point')
 void frameCallback(Object? image, int durationMilliseconds, String decodeError) {
   validateFrameCallback(image, durationMilliseconds, decodeError);
@@ -73,6 +73,16 @@ Future<developer.ServiceExtensionResponse> _reinitializeShader(
   }));
 }
 
+Future<developer.ServiceExtensionResponse> _getChannelBufferStats(
+  String method,
+  Map<String, String> parameters,
+) async {
+  return developer.ServiceExtensionResponse.result(json.encode(<String, Object>{
+    'type': 'Success',
+    'channels': channelBuffers._collectStats(),
+  }));
+}
+
 Future<developer.ServiceExtensionResponse> _getImpellerEnabled(
   String method,
   Map<String, String> parameters,
@@ -2544,6 +2544,18 @@ abstract class EngineLayer {
   /// This can't be a leaf call because the native function calls Dart API
   /// (Dart_SetNativeInstanceField).
   void dispose();
+
+  /// Whether the engine keeps the raster cache images produced for this
+  /// layer's subtree alive while the subtree is not being drawn.
+  ///
+  /// Pinning is an optimization for known-expensive subtrees that
+  /// repeatedly leave and re-enter the scene, such as a navigation shell:
+  /// without it their cached images are evicted on the first frame that
+  /// does not draw them and must be rasterized again on return. Pinned
+  /// images still count against the raster cache memory budget, so pin
+  /// sparingly. The pin is released by calling this method with false or
+  /// by disposing the layer and letting the engine clear its caches.
+  void setRasterCachePinned(bool pinned);
 }
 
 base class _NativeEngineLayer extends NativeFieldWrapperClass1 implements EngineLayer {
@@ -2554,6 +2566,10 @@ base class _NativeEngineLayer extends NativeFieldWrapperClass1 implements Engine
   @override
   @Native<Void Function(Pointer<Void>)>(symbol: 'EngineLayer::dispose')
   external void dispose();
+
+  @override
+  @Native<Void Function(Pointer<Void>, Bool)>(symbol: 'EngineLayer::setRasterCachePinned')
+  external void setRasterCachePinned(bool pinned);
 }
 
 /// A complex, one-dimensional subset of a plane.
@@ -4511,6 +4527,24 @@ base class FragmentProgram extends NativeFieldWrapperClass1 {
   @Native<Handle Function(Pointer<Void>, Handle)>(symbol: 'FragmentProgram::initFromAsset')
   external String _initFromAsset(String assetKey);
 
+  /// Precompiles this program's pipeline state on a background thread so
+  /// that the first [Paint] using one of its shaders does not pause rendering
+  /// while the shader compiles.
+  ///
+  /// Returns a future that completes when precompilation has finished.
+  /// Awaiting it before starting a shader-driven animation guarantees the
+  /// transition does not hitch on shader compilation. Calling this method is
+  /// an optimization; shaders that are not precompiled are compiled on first
+  /// use instead.
+  Future<void> precompile() {
+    return _futurize((_Callback<void> callback) {
+      return _precompile(callback);
+    });
+  }
+
+  @Native<Handle Function(Pointer<Void>, Handle)>(symbol: 'FragmentProgram::precompile')
+  external String? _precompile(_Callback<void> callback);
+
   /// Returns a fresh instance of [FragmentShader].
   FragmentShader fragmentShader() => FragmentShader._(this, debugName: _debugName);
 }
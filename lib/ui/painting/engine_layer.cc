@@ -26,4 +26,10 @@ void EngineLayer::dispose() {
   ClearDartWrapper();
 }
 
+void EngineLayer::setRasterCachePinned(bool pinned) {
+  if (layer_) {
+    layer_->set_raster_cache_pinned(pinned);
+  }
+}
+
 }  // namespace flutter
@@ -26,6 +26,11 @@ class EngineLayer : public RefCountedDartWrappable<EngineLayer> {
 
   void dispose();
 
+  // Marks the retained layer so that raster cache entries produced for its
+  // subtree are exempt from sweep eviction; see
+  // |Layer::set_raster_cache_pinned|.
+  void setRasterCachePinned(bool pinned);
+
   std::shared_ptr<flutter::ContainerLayer> Layer() const { return layer_; }
 
  private:
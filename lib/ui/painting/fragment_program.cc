@@ -2,30 +2,61 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <cstring>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 
 #include "display_list/effects/dl_runtime_effect.h"
 #include "flutter/lib/ui/painting/fragment_program.h"
 
 #include "flutter/assets/asset_manager.h"
+#include "flutter/fml/make_copyable.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/impeller/runtime_stage/runtime_stage.h"
 #include "flutter/lib/ui/dart_wrapper.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "flutter/lib/ui/window/platform_configuration.h"
+#if IMPELLER_SUPPORTS_RENDERING
+#include "flutter/impeller/entity/contents/runtime_effect_contents.h"
+#endif  // IMPELLER_SUPPORTS_RENDERING
 
 #include "third_party/skia/include/core/SkString.h"
 #include "third_party/tonic/converter/dart_converter.h"
 #include "third_party/tonic/dart_args.h"
 #include "third_party/tonic/dart_binding_macros.h"
 #include "third_party/tonic/dart_library_natives.h"
+#include "third_party/tonic/dart_persistent_value.h"
+#include "third_party/tonic/logging/dart_invoke.h"
 #include "third_party/tonic/typed_data/typed_list.h"
 
 namespace flutter {
 
 IMPLEMENT_WRAPPERTYPEINFO(ui, FragmentProgram);
 
+namespace {
+
+// Shader payloads and compiled Skia effects pooled by asset name, so that
+// re-initializing a fragment program for the same shader (common with
+// shader-based transitions that are created and discarded many times per
+// session) reuses the backing mapping and skips the flatbuffer verification
+// and effect compilation. The pooled bytes are compared against the freshly
+// resolved asset on every lookup, so a hot reload that replaces the asset's
+// contents rebuilds the entry instead of serving stale code.
+struct PooledFragmentProgram {
+  std::shared_ptr<fml::Mapping> payload;
+  // Only the Skia effect is pooled. SkRuntimeEffect is immutable and not
+  // bound to a context; an Impeller runtime stage tracks per-context
+  // registration state and is rebuilt from the pooled payload instead.
+  sk_sp<DlRuntimeEffect> skia_effect;
+};
+
+std::mutex fragment_program_pool_mutex;
+std::map<std::string, PooledFragmentProgram> fragment_program_pool;
+
+}  // namespace
+
 std::string FragmentProgram::initFromAsset(const std::string& asset_name) {
   FML_TRACE_EVENT("flutter", "FragmentProgram::initFromAsset", "asset",
                   asset_name);
@@ -38,8 +69,28 @@ std::string FragmentProgram::initFromAsset(const std::string& asset_name) {
     return std::string("Asset '") + asset_name + std::string("' not found");
   }
 
-  auto runtime_stage = impeller::RuntimeStage(std::move(data));
+  std::shared_ptr<fml::Mapping> payload;
+  {
+    std::scoped_lock lock(fragment_program_pool_mutex);
+    PooledFragmentProgram& pooled = fragment_program_pool[asset_name];
+    if (pooled.payload != nullptr &&
+        pooled.payload->GetSize() == data->GetSize() &&
+        memcmp(pooled.payload->GetMapping(), data->GetMapping(),
+               data->GetSize()) == 0) {
+      payload = pooled.payload;
+    } else {
+      pooled = {};
+      pooled.payload = std::move(data);
+      payload = pooled.payload;
+    }
+  }
+
+  auto runtime_stage = impeller::RuntimeStage(payload);
   if (!runtime_stage.IsValid()) {
+    {
+      std::scoped_lock lock(fragment_program_pool_mutex);
+      fragment_program_pool.erase(asset_name);
+    }
     return std::string("Asset '") + asset_name +
            std::string("' does not contain valid shader data.");
   }
@@ -59,18 +110,37 @@ std::string FragmentProgram::initFromAsset(const std::string& asset_name) {
     runtime_effect_ = DlRuntimeEffect::MakeImpeller(
         std::make_unique<impeller::RuntimeStage>(std::move(runtime_stage)));
   } else {
-    const auto& code_mapping = runtime_stage.GetSkSLMapping();
-    auto code_size = code_mapping->GetSize();
-    const char* sksl =
-        reinterpret_cast<const char*>(code_mapping->GetMapping());
-    // SkString makes a copy.
-    SkRuntimeEffect::Result result =
-        SkRuntimeEffect::MakeForShader(SkString(sksl, code_size));
-    if (result.effect == nullptr) {
-      return std::string("Invalid SkSL:\n") + sksl +
-             std::string("\nSkSL Error:\n") + result.errorText.c_str();
+    sk_sp<DlRuntimeEffect> pooled_effect;
+    {
+      std::scoped_lock lock(fragment_program_pool_mutex);
+      auto found = fragment_program_pool.find(asset_name);
+      if (found != fragment_program_pool.end() &&
+          found->second.payload == payload) {
+        pooled_effect = found->second.skia_effect;
+      }
+    }
+    if (pooled_effect != nullptr) {
+      runtime_effect_ = std::move(pooled_effect);
+    } else {
+      const auto& code_mapping = runtime_stage.GetSkSLMapping();
+      auto code_size = code_mapping->GetSize();
+      const char* sksl =
+          reinterpret_cast<const char*>(code_mapping->GetMapping());
+      // SkString makes a copy.
+      SkRuntimeEffect::Result result =
+          SkRuntimeEffect::MakeForShader(SkString(sksl, code_size));
+      if (result.effect == nullptr) {
+        return std::string("Invalid SkSL:\n") + sksl +
+               std::string("\nSkSL Error:\n") + result.errorText.c_str();
+      }
+      runtime_effect_ = DlRuntimeEffect::MakeSkia(result.effect);
+      std::scoped_lock lock(fragment_program_pool_mutex);
+      auto found = fragment_program_pool.find(asset_name);
+      if (found != fragment_program_pool.end() &&
+          found->second.payload == payload) {
+        found->second.skia_effect = runtime_effect_;
+      }
     }
-    runtime_effect_ = DlRuntimeEffect::MakeSkia(result.effect);
   }
 
   Dart_Handle ths = Dart_HandleFromWeakPersistent(dart_wrapper());
@@ -95,6 +165,65 @@ std::string FragmentProgram::initFromAsset(const std::string& asset_name) {
   return "";
 }
 
+Dart_Handle FragmentProgram::precompile(Dart_Handle callback_handle) {
+  if (!Dart_IsClosure(callback_handle)) {
+    return tonic::ToDart("Callback must be a function");
+  }
+
+#if IMPELLER_SUPPORTS_RENDERING
+  std::shared_ptr<impeller::RuntimeStage> runtime_stage =
+      runtime_effect_ ? runtime_effect_->runtime_stage() : nullptr;
+  if (runtime_stage != nullptr) {
+    auto* dart_state = UIDartState::Current();
+    const auto& task_runners = dart_state->GetTaskRunners();
+
+    auto* callback_ptr =
+        new tonic::DartPersistentValue(dart_state, callback_handle);
+    auto ui_task = fml::MakeCopyable([callback_ptr]() mutable {
+      std::unique_ptr<tonic::DartPersistentValue> callback(callback_ptr);
+      auto dart_state = callback->dart_state().lock();
+      if (!dart_state) {
+        // The root isolate could have died in the meantime.
+        return;
+      }
+      tonic::DartState::Scope scope(dart_state);
+      tonic::DartInvoke(callback->Get(), {Dart_TypeVoid()});
+    });
+
+    // The Impeller context must be fetched on the IO thread; the compile
+    // itself blocks and runs on a concurrent worker. Compilation failures
+    // are reported through validation logs and surface again (with the
+    // same logs) if the shader is drawn anyway, so the callback completes
+    // regardless.
+    auto ui_task_runner = task_runners.GetUITaskRunner();
+    task_runners.GetIOTaskRunner()->PostTask(
+        [io_manager = dart_state->GetIOManager(),
+         concurrent_runner = dart_state->GetConcurrentTaskRunner(),
+         runtime_stage = std::move(runtime_stage),
+         ui_task_runner = std::move(ui_task_runner), ui_task]() {
+          auto context =
+              io_manager ? io_manager->GetImpellerContext() : nullptr;
+          concurrent_runner->PostTask([context = std::move(context),
+                                       runtime_stage = std::move(runtime_stage),
+                                       ui_task_runner =
+                                           std::move(ui_task_runner),
+                                       ui_task]() {
+            TRACE_EVENT0("flutter", "FragmentProgram::precompile");
+            impeller::RuntimeEffectContents::PrecompilePipeline(context,
+                                                                runtime_stage);
+            ui_task_runner->PostTask(ui_task);
+          });
+        });
+    return Dart_Null();
+  }
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
+  // Skia runtime effects were already compiled by initFromAsset and the
+  // backend specializes them cheaply at draw time; there is nothing to warm.
+  tonic::DartInvoke(callback_handle, {Dart_TypeVoid()});
+  return Dart_Null();
+}
+
 std::shared_ptr<DlColorSource> FragmentProgram::MakeDlColorSource(
     std::shared_ptr<std::vector<uint8_t>> float_uniforms,
     const std::vector<std::shared_ptr<DlColorSource>>& children) {
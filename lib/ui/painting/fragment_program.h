@@ -30,6 +30,12 @@ class FragmentProgram : public RefCountedDartWrappable<FragmentProgram> {
 
   std::string initFromAsset(const std::string& asset_name);
 
+  /// Warms the shader's pipeline state on a background thread so a later
+  /// draw does not pay compilation costs, invoking `callback_handle` on the
+  /// UI thread when done. Only the Impeller backend compiles ahead of time;
+  /// on other backends the callback is invoked immediately.
+  Dart_Handle precompile(Dart_Handle callback_handle);
+
   fml::RefPtr<FragmentShader> shader(Dart_Handle shader,
                                      Dart_Handle uniforms_handle,
                                      Dart_Handle samplers);
@@ -21,10 +21,11 @@ std::unique_ptr<ImageDecoder> ImageDecoder::Make(
 #if IMPELLER_SUPPORTS_RENDERING
   if (settings.enable_impeller) {
     return std::make_unique<ImageDecoderImpeller>(
-        runners,                            //
-        std::move(concurrent_task_runner),  //
-        std::move(io_manager),              //
-        settings.enable_wide_gamut,         //
+        runners,                                //
+        std::move(concurrent_task_runner),      //
+        std::move(io_manager),                  //
+        settings.enable_wide_gamut,             //
+        settings.decode_mipmap_max_dimension,   //
         gpu_disabled_switch);
   }
 #endif  // IMPELLER_SUPPORTS_RENDERING
@@ -4,12 +4,15 @@
 
 #include "flutter/lib/ui/painting/image_decoder_impeller.h"
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 
 #include "flutter/fml/closure.h"
 #include "flutter/fml/make_copyable.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/impeller/core/allocator.h"
+#include "flutter/impeller/core/staging_belt.h"
 #include "flutter/impeller/core/texture.h"
 #include "flutter/impeller/display_list/dl_image_impeller.h"
 #include "flutter/impeller/renderer/command_buffer.h"
@@ -30,6 +33,10 @@
 #include "third_party/skia/include/core/SkSamplingOptions.h"
 #include "third_party/skia/include/core/SkSize.h"
 
+#ifdef IMPELLER_ENABLE_COMPUTE
+#include "flutter/impeller/renderer/image_format_converter.h"
+#endif  // IMPELLER_ENABLE_COMPUTE
+
 namespace flutter {
 
 class MallocDeviceBuffer : public impeller::DeviceBuffer {
@@ -117,9 +124,11 @@ ImageDecoderImpeller::ImageDecoderImpeller(
     std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_task_runner,
     const fml::WeakPtr<IOManager>& io_manager,
     bool supports_wide_gamut,
+    uint32_t decode_mipmap_max_dimension,
     const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch)
     : ImageDecoder(runners, std::move(concurrent_task_runner), io_manager),
       supports_wide_gamut_(supports_wide_gamut),
+      decode_mipmap_max_dimension_(decode_mipmap_max_dimension),
       gpu_disabled_switch_(gpu_disabled_switch) {
   std::promise<std::shared_ptr<impeller::Context>> context_promise;
   context_ = context_promise.get_future();
@@ -134,6 +143,10 @@ ImageDecoderImpeller::~ImageDecoderImpeller() = default;
 
 static SkColorType ChooseCompatibleColorType(SkColorType type) {
   switch (type) {
+    // Formats the GPU can sample directly pass through without conversion.
+    case kBGRA_8888_SkColorType:
+    case kRGBA_F16_SkColorType:
+      return type;
     case kRGBA_F32_SkColorType:
       return kRGBA_F16_SkColorType;
     default:
@@ -145,12 +158,158 @@ static SkAlphaType ChooseCompatibleAlphaType(SkAlphaType type) {
   return type;
 }
 
+#ifdef IMPELLER_ENABLE_COMPUTE
+/// Maps a source color type to the corresponding compute conversion, or
+/// `std::nullopt` for color types the conversion shader does not handle. The
+/// shader output format must match `ChooseCompatibleColorType` for the same
+/// source.
+static std::optional<impeller::ImageFormatConverter::SourceFormat>
+ToGPUConversionFormat(SkColorType type) {
+  switch (type) {
+    case kGray_8_SkColorType:
+      return impeller::ImageFormatConverter::SourceFormat::kGray8;
+    case kAlpha_8_SkColorType:
+      return impeller::ImageFormatConverter::SourceFormat::kAlpha8;
+    case kRGB_888x_SkColorType:
+      return impeller::ImageFormatConverter::SourceFormat::kRGB888X;
+    case kRGBA_F32_SkColorType:
+      return impeller::ImageFormatConverter::SourceFormat::kRGBAF32;
+    default:
+      return std::nullopt;
+  }
+}
+#endif  // IMPELLER_ENABLE_COMPUTE
+
+/// The maximum number of bytes of full resolution image data held in memory
+/// at once while decoding a strip at a time.
+static constexpr size_t kDecodeStripBudgetBytes = 16u * 1024u * 1024u;
+
+/// Decodes a compressed image a strip of rows at a time, downscaling each
+/// strip into the target allocation as it is produced. This bounds the
+/// transient decode memory by `kDecodeStripBudgetBytes` regardless of the
+/// source image size, whereas a whole-image decode of a very large image can
+/// transiently require hundreds of megabytes before the resize.
+///
+/// Returns `std::nullopt` if the image or codec isn't suitable for strip
+/// decoding, in which case the caller should fall back to a whole-image
+/// decode.
+static std::optional<DecompressResult> TryStripDecompress(
+    ImageDescriptor* descriptor,
+    const SkImageInfo& decode_info,
+    SkISize target_size,
+    const std::shared_ptr<impeller::Allocator>& allocator,
+    const std::shared_ptr<impeller::StagingBelt>& staging_belt) {
+  if (!descriptor->supports_scanline_decoding() ||
+      decode_info.width() < target_size.width() ||
+      decode_info.height() < target_size.height() ||
+      target_size.isEmpty()) {
+    // Strip decoding is only worthwhile when downscaling; upscales hold no
+    // more than the decoded image, which the whole-image path already
+    // allocates.
+    return std::nullopt;
+  }
+
+  // Each strip spans the full decode width, so size strips such that the
+  // source rows backing one strip of target rows stay within the budget.
+  const int decode_height = decode_info.height();
+  const int target_height = target_size.height();
+  const size_t decode_row_bytes = decode_info.minRowBytes();
+  const double source_rows_per_target_row =
+      static_cast<double>(decode_height) / target_height;
+  const int target_rows_per_strip = std::clamp(
+      static_cast<int>(kDecodeStripBudgetBytes /
+                       (decode_row_bytes * source_rows_per_target_row)),
+      1, target_height);
+  if (target_rows_per_strip >= target_height) {
+    // The whole decode fits within the budget; a single-pass decode is
+    // cheaper.
+    return std::nullopt;
+  }
+
+  if (!descriptor->start_scanline_decode(decode_info)) {
+    return std::nullopt;
+  }
+
+  TRACE_EVENT0("impeller", "StripDecodeScale");
+
+  const auto scaled_image_info = decode_info.makeDimensions(target_size);
+  auto scaled_bitmap = std::make_shared<SkBitmap>();
+  auto scaled_allocator =
+      std::make_shared<ImpellerAllocator>(allocator, staging_belt);
+  scaled_bitmap->setInfo(scaled_image_info);
+  if (!scaled_bitmap->tryAllocPixels(scaled_allocator.get())) {
+    std::string decode_error(
+        "Could not allocate scaled bitmap for image decompression.");
+    FML_DLOG(ERROR) << decode_error;
+    return DecompressResult{.decode_error = decode_error};
+  }
+
+  // The strip bitmap is plain heap memory; it never reaches the GPU and is
+  // freed as soon as decoding completes.
+  const int max_source_rows_per_strip =
+      static_cast<int>((static_cast<int64_t>(target_rows_per_strip) *
+                            decode_height +
+                        target_height - 1) /
+                       target_height) +
+      1;
+  SkBitmap strip_bitmap;
+  if (!strip_bitmap.tryAllocPixels(
+          decode_info.makeWH(decode_info.width(), max_source_rows_per_strip))) {
+    std::string decode_error("Could not allocate image decode strip.");
+    FML_DLOG(ERROR) << decode_error;
+    return DecompressResult{.decode_error = decode_error};
+  }
+
+  for (int target_y = 0; target_y < target_height;
+       target_y += target_rows_per_strip) {
+    const int strip_target_rows =
+        std::min(target_rows_per_strip, target_height - target_y);
+    const int source_y0 = static_cast<int>(
+        static_cast<int64_t>(target_y) * decode_height / target_height);
+    const int source_y1 = static_cast<int>(
+        static_cast<int64_t>(target_y + strip_target_rows) * decode_height /
+        target_height);
+    const int source_rows = source_y1 - source_y0;
+    FML_DCHECK(source_rows <= max_source_rows_per_strip);
+
+    if (descriptor->get_scanlines(strip_bitmap.getPixels(), source_rows,
+                                  strip_bitmap.rowBytes()) != source_rows) {
+      std::string decode_error("Could not decompress image strip.");
+      FML_DLOG(ERROR) << decode_error;
+      return DecompressResult{.decode_error = decode_error};
+    }
+
+    const SkPixmap source_strip(
+        decode_info.makeWH(decode_info.width(), source_rows),
+        strip_bitmap.getPixels(), strip_bitmap.rowBytes());
+    const SkPixmap target_strip(
+        scaled_image_info.makeWH(target_size.width(), strip_target_rows),
+        scaled_bitmap->getAddr(0, target_y), scaled_bitmap->rowBytes());
+    if (!source_strip.scalePixels(
+            target_strip,
+            SkSamplingOptions(SkFilterMode::kLinear, SkMipmapMode::kNone))) {
+      FML_LOG(ERROR) << "Could not scale decoded strip data.";
+    }
+  }
+  scaled_bitmap->setImmutable();
+
+  auto buffer = scaled_allocator->GetDeviceBuffer();
+  if (!buffer) {
+    return DecompressResult{.decode_error = "Unable to get device buffer"};
+  }
+  return DecompressResult{.device_buffer = buffer,
+                          .sk_bitmap = scaled_bitmap,
+                          .image_info = scaled_bitmap->info()};
+}
+
 DecompressResult ImageDecoderImpeller::DecompressTexture(
     ImageDescriptor* descriptor,
     SkISize target_size,
     impeller::ISize max_texture_size,
     bool supports_wide_gamut,
-    const std::shared_ptr<impeller::Allocator>& allocator) {
+    const std::shared_ptr<impeller::Allocator>& allocator,
+    const std::shared_ptr<impeller::StagingBelt>& staging_belt,
+    bool allow_gpu_conversion) {
   TRACE_EVENT0("impeller", __FUNCTION__);
   if (!descriptor) {
     std::string decode_error("Invalid descriptor (should never happen)");
@@ -208,9 +367,20 @@ DecompressResult ImageDecoderImpeller::DecompressTexture(
     return DecompressResult{.decode_error = decode_error};
   }
 
+  if (descriptor->is_compressed() && image_info.dimensions() != target_size) {
+    // Giant images can be decoded a strip at a time directly into the target
+    // allocation, bounding peak decode memory regardless of the source size.
+    auto strip_result = TryStripDecompress(descriptor, image_info, target_size,
+                                           allocator, staging_belt);
+    if (strip_result.has_value()) {
+      return strip_result.value();
+    }
+  }
+
   auto bitmap = std::make_shared<SkBitmap>();
   bitmap->setInfo(image_info);
-  auto bitmap_allocator = std::make_shared<ImpellerAllocator>(allocator);
+  auto bitmap_allocator =
+      std::make_shared<ImpellerAllocator>(allocator, staging_belt);
 
   if (descriptor->is_compressed()) {
     if (!bitmap->tryAllocPixels(bitmap_allocator.get())) {
@@ -232,6 +402,37 @@ DecompressResult ImageDecoderImpeller::DecompressTexture(
         base_image_info, descriptor->row_bytes(), descriptor->data());
     temp_bitmap->setPixelRef(pixel_ref, 0, 0);
 
+#ifdef IMPELLER_ENABLE_COMPUTE
+    const bool raw_bytes_usable =
+        allow_gpu_conversion && !is_wide_gamut &&
+        base_image_info.dimensions() == target_size &&
+        descriptor->row_bytes() == base_image_info.minRowBytes() &&
+        // The conversion shader reads the source as packed 32-bit words.
+        base_image_info.computeMinByteSize() % 4 == 0;
+    if (raw_bytes_usable &&
+        ToGPUConversionFormat(base_image_info.colorType()).has_value()) {
+      // Stage the raw bytes as-is; the upload converts them on the GPU
+      // instead of swizzling (potentially tens of megabytes) here.
+      bitmap->setInfo(base_image_info);
+      if (!bitmap->tryAllocPixels(bitmap_allocator.get())) {
+        std::string decode_error(
+            "Could not allocate intermediate for pixel conversion.");
+        FML_DLOG(ERROR) << decode_error;
+        return DecompressResult{.decode_error = decode_error};
+      }
+      temp_bitmap->readPixels(bitmap->pixmap());
+      bitmap->setImmutable();
+      auto buffer = bitmap_allocator->GetDeviceBuffer();
+      if (!buffer) {
+        return DecompressResult{.decode_error = "Unable to get device buffer"};
+      }
+      return DecompressResult{.device_buffer = buffer,
+                              .sk_bitmap = bitmap,
+                              .image_info = image_info,
+                              .raw_color_type = base_image_info.colorType()};
+    }
+#endif  // IMPELLER_ENABLE_COMPUTE
+
     if (!bitmap->tryAllocPixels(bitmap_allocator.get())) {
       std::string decode_error(
           "Could not allocate intermediate for pixel conversion.");
@@ -260,7 +461,8 @@ DecompressResult ImageDecoderImpeller::DecompressTexture(
   const auto scaled_image_info = image_info.makeDimensions(target_size);
 
   auto scaled_bitmap = std::make_shared<SkBitmap>();
-  auto scaled_allocator = std::make_shared<ImpellerAllocator>(allocator);
+  auto scaled_allocator =
+      std::make_shared<ImpellerAllocator>(allocator, staging_belt);
   scaled_bitmap->setInfo(scaled_image_info);
   if (!scaled_bitmap->tryAllocPixels(scaled_allocator.get())) {
     std::string decode_error(
@@ -288,7 +490,8 @@ DecompressResult ImageDecoderImpeller::DecompressTexture(
 static std::pair<sk_sp<DlImage>, std::string> UnsafeUploadTextureToPrivate(
     const std::shared_ptr<impeller::Context>& context,
     const std::shared_ptr<impeller::DeviceBuffer>& buffer,
-    const SkImageInfo& image_info) {
+    const SkImageInfo& image_info,
+    bool create_mips) {
   const auto pixel_format =
       impeller::skia_conversions::ToPixelFormat(image_info.colorType());
   if (!pixel_format) {
@@ -302,8 +505,10 @@ static std::pair<sk_sp<DlImage>, std::string> UnsafeUploadTextureToPrivate(
   texture_descriptor.storage_mode = impeller::StorageMode::kDevicePrivate;
   texture_descriptor.format = pixel_format.value();
   texture_descriptor.size = {image_info.width(), image_info.height()};
-  texture_descriptor.mip_count = texture_descriptor.size.MipCount();
+  texture_descriptor.mip_count =
+      create_mips ? texture_descriptor.size.MipCount() : 1;
   texture_descriptor.compression_type = impeller::CompressionType::kLossy;
+  texture_descriptor.resource_class = impeller::ResourceClass::kImage;
 
   auto dest_texture =
       context->GetResourceAllocator()->CreateTexture(texture_descriptor);
@@ -334,7 +539,7 @@ static std::pair<sk_sp<DlImage>, std::string> UnsafeUploadTextureToPrivate(
   }
   blit_pass->SetLabel("Mipmap Blit Pass");
   blit_pass->AddCopy(buffer->AsBufferView(), dest_texture);
-  if (texture_descriptor.size.MipCount() > 1) {
+  if (texture_descriptor.mip_count > 1) {
     blit_pass->GenerateMipmap(dest_texture);
   }
 
@@ -349,13 +554,70 @@ static std::pair<sk_sp<DlImage>, std::string> UnsafeUploadTextureToPrivate(
       impeller::DlImageImpeller::Make(std::move(dest_texture)), std::string());
 }
 
+/// Converts raw decoded bytes into `image_info`'s pixel format on the CPU.
+/// Used when raw bytes were staged for the GPU conversion pass but the pass
+/// cannot run after all (for example, the GPU became disabled).
+static std::shared_ptr<SkBitmap> ConvertRawBitmapOnCPU(
+    const std::shared_ptr<SkBitmap>& raw_bitmap,
+    const SkImageInfo& image_info) {
+  auto converted = std::make_shared<SkBitmap>();
+  if (!converted->tryAllocPixels(image_info)) {
+    return nullptr;
+  }
+  if (!raw_bitmap->readPixels(converted->pixmap())) {
+    return nullptr;
+  }
+  converted->setImmutable();
+  return converted;
+}
+
+/// Converts the raw decoded bytes in `buffer` into `image_info`'s pixel
+/// format, preferring the compute conversion pass and falling back to a CPU
+/// conversion staged into a fresh host buffer. Returns nullptr on failure.
+static std::shared_ptr<impeller::DeviceBuffer> ConvertBufferFormat(
+    const std::shared_ptr<impeller::Context>& context,
+    const std::shared_ptr<impeller::DeviceBuffer>& buffer,
+    const std::shared_ptr<SkBitmap>& raw_bitmap,
+    SkColorType raw_color_type,
+    const SkImageInfo& image_info) {
+#ifdef IMPELLER_ENABLE_COMPUTE
+  if (context->GetCapabilities()->SupportsCompute()) {
+    auto source_format = ToGPUConversionFormat(raw_color_type);
+    if (source_format.has_value()) {
+      const size_t pixel_count =
+          static_cast<size_t>(image_info.width()) * image_info.height();
+      auto converted = impeller::ImageFormatConverter::Convert(
+          context, buffer, source_format.value(), pixel_count);
+      if (converted) {
+        return converted;
+      }
+    }
+  }
+#endif  // IMPELLER_ENABLE_COMPUTE
+  auto converted_bitmap = ConvertRawBitmapOnCPU(raw_bitmap, image_info);
+  if (!converted_bitmap) {
+    return nullptr;
+  }
+  auto converted_allocator =
+      std::make_shared<ImpellerAllocator>(context->GetResourceAllocator());
+  SkBitmap staged;
+  staged.setInfo(image_info);
+  if (!staged.tryAllocPixels(converted_allocator.get()) ||
+      !converted_bitmap->readPixels(staged.pixmap())) {
+    return nullptr;
+  }
+  return converted_allocator->GetDeviceBuffer();
+}
+
 std::pair<sk_sp<DlImage>, std::string>
 ImageDecoderImpeller::UploadTextureToPrivate(
     const std::shared_ptr<impeller::Context>& context,
     const std::shared_ptr<impeller::DeviceBuffer>& buffer,
     const SkImageInfo& image_info,
     const std::shared_ptr<SkBitmap>& bitmap,
-    const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch) {
+    const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch,
+    bool create_mips,
+    std::optional<SkColorType> raw_color_type) {
   TRACE_EVENT0("impeller", __FUNCTION__);
   if (!context) {
     return std::make_pair(nullptr, "No Impeller context is available");
@@ -367,13 +629,37 @@ ImageDecoderImpeller::UploadTextureToPrivate(
   std::pair<sk_sp<DlImage>, std::string> result;
   gpu_disabled_switch->Execute(
       fml::SyncSwitch::Handlers()
-          .SetIfFalse([&result, context, buffer, image_info] {
-            result = UnsafeUploadTextureToPrivate(context, buffer, image_info);
+          .SetIfFalse([&result, context, buffer, image_info, bitmap,
+                       raw_color_type, create_mips] {
+            auto upload_buffer = buffer;
+            if (raw_color_type.has_value()) {
+              upload_buffer = ConvertBufferFormat(
+                  context, buffer, bitmap, raw_color_type.value(), image_info);
+              if (!upload_buffer) {
+                result = std::make_pair(
+                    nullptr, "Could not convert image pixel format.");
+                return;
+              }
+            }
+            result = UnsafeUploadTextureToPrivate(context, upload_buffer,
+                                                  image_info, create_mips);
           })
-          .SetIfTrue([&result, context, bitmap, gpu_disabled_switch] {
+          .SetIfTrue([&result, context, bitmap, image_info, raw_color_type,
+                      gpu_disabled_switch] {
+            auto upload_bitmap = bitmap;
+            if (raw_color_type.has_value()) {
+              // The conversion pass cannot run; convert on the CPU instead.
+              upload_bitmap = ConvertRawBitmapOnCPU(bitmap, image_info);
+              if (!upload_bitmap) {
+                result = std::make_pair(nullptr,
+                                        "Could not convert image pixels.");
+                return;
+              }
+            }
             // create_mips is false because we already know the GPU is disabled.
             result =
-                UploadTextureToStorage(context, bitmap, gpu_disabled_switch,
+                UploadTextureToStorage(context, upload_bitmap,
+                                       gpu_disabled_switch,
                                        impeller::StorageMode::kHostVisible,
                                        /*create_mips=*/false);
           }));
@@ -410,6 +696,7 @@ ImageDecoderImpeller::UploadTextureToStorage(
   texture_descriptor.size = {image_info.width(), image_info.height()};
   texture_descriptor.mip_count =
       create_mips ? texture_descriptor.size.MipCount() : 1;
+  texture_descriptor.resource_class = impeller::ResourceClass::kImage;
 
   auto texture =
       context->GetResourceAllocator()->CreateTexture(texture_descriptor);
@@ -501,7 +788,8 @@ void ImageDecoderImpeller::Decode(fml::RefPtr<ImageDescriptor> descriptor,
        target_size = SkISize::Make(target_width, target_height),  //
        io_runner = runners_.GetIOTaskRunner(),                    //
        result,
-       supports_wide_gamut = supports_wide_gamut_,  //
+       supports_wide_gamut = supports_wide_gamut_,                  //
+       decode_mipmap_max_dimension = decode_mipmap_max_dimension_,  //
        gpu_disabled_switch = gpu_disabled_switch_]() {
         if (!context) {
           result(nullptr, "No Impeller context is available");
@@ -510,15 +798,35 @@ void ImageDecoderImpeller::Decode(fml::RefPtr<ImageDescriptor> descriptor,
         auto max_size_supported =
             context->GetResourceAllocator()->GetMaxTextureSizeSupported();
 
+        // Unsupported pixel formats may upload as-is and convert on the GPU,
+        // but only when the device private upload path below is guaranteed to
+        // run the conversion pass.
+        bool allow_gpu_conversion = false;
+#ifdef IMPELLER_ENABLE_COMPUTE
+        allow_gpu_conversion =
+            !kShouldUseMallocDeviceBuffer &&
+            context->GetCapabilities()->SupportsCompute() &&
+            context->GetCapabilities()->SupportsBufferToTextureBlits();
+#endif  // IMPELLER_ENABLE_COMPUTE
         // Always decompress on the concurrent runner.
         auto bitmap_result = DecompressTexture(
             raw_descriptor, target_size, max_size_supported,
-            supports_wide_gamut, context->GetResourceAllocator());
+            supports_wide_gamut, context->GetResourceAllocator(),
+            context->GetStagingBelt(), allow_gpu_conversion);
         if (!bitmap_result.device_buffer) {
           result(nullptr, bitmap_result.decode_error);
           return;
         }
+        // Generating the mip chain as part of the upload avoids a first-draw
+        // hitch, but images above the configured dimension limit skip it.
+        const bool create_mips =
+            decode_mipmap_max_dimension == 0 ||
+            (static_cast<uint32_t>(bitmap_result.image_info.width()) <=
+                 decode_mipmap_max_dimension &&
+             static_cast<uint32_t>(bitmap_result.image_info.height()) <=
+                 decode_mipmap_max_dimension);
         auto upload_texture_and_invoke_result = [result, context, bitmap_result,
+                                                 create_mips,
                                                  gpu_disabled_switch]() {
           sk_sp<DlImage> image;
           std::string decode_error;
@@ -526,13 +834,13 @@ void ImageDecoderImpeller::Decode(fml::RefPtr<ImageDescriptor> descriptor,
               context->GetCapabilities()->SupportsBufferToTextureBlits()) {
             std::tie(image, decode_error) = UploadTextureToPrivate(
                 context, bitmap_result.device_buffer, bitmap_result.image_info,
-                bitmap_result.sk_bitmap, gpu_disabled_switch);
+                bitmap_result.sk_bitmap, gpu_disabled_switch, create_mips,
+                bitmap_result.raw_color_type);
             result(image, decode_error);
           } else {
             std::tie(image, decode_error) = UploadTextureToStorage(
                 context, bitmap_result.sk_bitmap, gpu_disabled_switch,
-                impeller::StorageMode::kDevicePrivate,
-                /*create_mips=*/true);
+                impeller::StorageMode::kDevicePrivate, create_mips);
             result(image, decode_error);
           }
         };
@@ -542,12 +850,16 @@ void ImageDecoderImpeller::Decode(fml::RefPtr<ImageDescriptor> descriptor,
         // forced serialization we can end up overloading the GPU and/or
         // competing with raster workloads.
         io_runner->PostTask(upload_texture_and_invoke_result);
-      });
+      },
+      // The user is typically watching a placeholder while this runs.
+      fml::TaskPriority::kUserVisible);
 }
 
 ImpellerAllocator::ImpellerAllocator(
-    std::shared_ptr<impeller::Allocator> allocator)
-    : allocator_(std::move(allocator)) {}
+    std::shared_ptr<impeller::Allocator> allocator,
+    std::shared_ptr<impeller::StagingBelt> staging_belt)
+    : allocator_(std::move(allocator)),
+      staging_belt_(std::move(staging_belt)) {}
 
 std::shared_ptr<impeller::DeviceBuffer> ImpellerAllocator::GetDeviceBuffer()
     const {
@@ -566,10 +878,19 @@ bool ImpellerAllocator::allocPixelRef(SkBitmap* bitmap) {
   descriptor.size = ((bitmap->height() - 1) * bitmap->rowBytes()) +
                     (bitmap->width() * bitmap->bytesPerPixel());
 
-  std::shared_ptr<impeller::DeviceBuffer> device_buffer =
-      kShouldUseMallocDeviceBuffer
-          ? std::make_shared<MallocDeviceBuffer>(descriptor)
-          : allocator_->CreateBuffer(descriptor);
+  std::shared_ptr<impeller::DeviceBuffer> device_buffer;
+  if (kShouldUseMallocDeviceBuffer) {
+    device_buffer = std::make_shared<MallocDeviceBuffer>(descriptor);
+  } else if (staging_belt_) {
+    // Recycled persistently mapped staging memory; avoids a fresh device
+    // allocation (and map) per decoded image.
+    device_buffer = staging_belt_->Acquire(descriptor.size);
+  } else {
+    device_buffer = allocator_->CreateBuffer(descriptor);
+  }
+  if (!device_buffer) {
+    return false;
+  }
 
   struct ImpellerPixelRef final : public SkPixelRef {
     ImpellerPixelRef(int w, int h, void* s, size_t r)
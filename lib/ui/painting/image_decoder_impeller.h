@@ -6,6 +6,7 @@
 #define FLUTTER_LIB_UI_PAINTING_IMAGE_DECODER_IMPELLER_H_
 
 #include <future>
+#include <optional>
 
 #include "flutter/fml/macros.h"
 #include "flutter/lib/ui/painting/image_decoder.h"
@@ -17,13 +18,16 @@ namespace impeller {
 class Context;
 class Allocator;
 class DeviceBuffer;
+class StagingBelt;
 }  // namespace impeller
 
 namespace flutter {
 
 class ImpellerAllocator : public SkBitmap::Allocator {
  public:
-  explicit ImpellerAllocator(std::shared_ptr<impeller::Allocator> allocator);
+  explicit ImpellerAllocator(
+      std::shared_ptr<impeller::Allocator> allocator,
+      std::shared_ptr<impeller::StagingBelt> staging_belt = nullptr);
 
   ~ImpellerAllocator() = default;
 
@@ -34,6 +38,7 @@ class ImpellerAllocator : public SkBitmap::Allocator {
 
  private:
   std::shared_ptr<impeller::Allocator> allocator_;
+  std::shared_ptr<impeller::StagingBelt> staging_belt_;
   std::shared_ptr<impeller::DeviceBuffer> buffer_;
 };
 
@@ -41,6 +46,11 @@ struct DecompressResult {
   std::shared_ptr<impeller::DeviceBuffer> device_buffer;
   std::shared_ptr<SkBitmap> sk_bitmap;
   SkImageInfo image_info;
+  // When set, `device_buffer` and `sk_bitmap` hold raw decoded bytes in this
+  // color type rather than in `image_info.colorType()`. The upload stage
+  // converts them to `image_info`'s format on the GPU, or on the CPU when the
+  // GPU conversion pass cannot run.
+  std::optional<SkColorType> raw_color_type;
   std::string decode_error;
 };
 
@@ -51,6 +61,7 @@ class ImageDecoderImpeller final : public ImageDecoder {
       std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_task_runner,
       const fml::WeakPtr<IOManager>& io_manager,
       bool supports_wide_gamut,
+      uint32_t decode_mipmap_max_dimension,
       const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch);
 
   ~ImageDecoderImpeller() override;
@@ -61,12 +72,23 @@ class ImageDecoderImpeller final : public ImageDecoder {
               uint32_t target_height,
               const ImageResult& result) override;
 
+  /// The optional staging belt, when provided, services the intermediate
+  /// decode buffers so that each image does not pay for a fresh staging
+  /// allocation.
+  ///
+  /// When `allow_gpu_conversion` is true, uncompressed images in pixel
+  /// formats the GPU cannot sample directly may skip the CPU conversion and
+  /// return raw bytes tagged with `DecompressResult::raw_color_type`; the
+  /// caller must only pass true when the upload takes the device private
+  /// path and the context supports compute.
   static DecompressResult DecompressTexture(
       ImageDescriptor* descriptor,
       SkISize target_size,
       impeller::ISize max_texture_size,
       bool supports_wide_gamut,
-      const std::shared_ptr<impeller::Allocator>& allocator);
+      const std::shared_ptr<impeller::Allocator>& allocator,
+      const std::shared_ptr<impeller::StagingBelt>& staging_belt = nullptr,
+      bool allow_gpu_conversion = false);
 
   /// @brief Create a device private texture from the provided host buffer.
   ///        This method is only suported on the metal backend.
@@ -75,13 +97,20 @@ class ImageDecoderImpeller final : public ImageDecoder {
   /// @param image_info Format information about the particular image.
   /// @param bitmap      A bitmap containg the image to be uploaded.
   /// @param gpu_disabled_switch Whether the GPU is available command encoding.
+  /// @param create_mips Whether mipmaps should be generated for the given
+  /// image.
+  /// @param raw_color_type When set, the buffer and bitmap hold raw bytes in
+  /// this color type and the upload converts them to `image_info`'s format.
+  /// See `DecompressResult::raw_color_type`.
   /// @return           A DlImage.
   static std::pair<sk_sp<DlImage>, std::string> UploadTextureToPrivate(
       const std::shared_ptr<impeller::Context>& context,
       const std::shared_ptr<impeller::DeviceBuffer>& buffer,
       const SkImageInfo& image_info,
       const std::shared_ptr<SkBitmap>& bitmap,
-      const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch);
+      const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch,
+      bool create_mips = true,
+      std::optional<SkColorType> raw_color_type = std::nullopt);
 
   /// @brief Create a host visible texture from the provided bitmap.
   /// @param context     The Impeller graphics context.
@@ -102,6 +131,10 @@ class ImageDecoderImpeller final : public ImageDecoder {
   using FutureContext = std::shared_future<std::shared_ptr<impeller::Context>>;
   FutureContext context_;
   const bool supports_wide_gamut_;
+  // The largest image dimension for which mips are generated during the
+  // decode-time upload, or 0 for no limit. See
+  // `Settings::decode_mipmap_max_dimension`.
+  const uint32_t decode_mipmap_max_dimension_;
   std::shared_ptr<fml::SyncSwitch> gpu_disabled_switch_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(ImageDecoderImpeller);
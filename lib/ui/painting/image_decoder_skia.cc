@@ -325,7 +325,9 @@ void ImageDecoderSkia::Decode(fml::RefPtr<ImageDescriptor> descriptor_ref_ptr,
           // Finally, all done.
           result(std::move(uploaded), std::move(flow));
         }));
-      }));
+      }),
+      // The user is typically watching a placeholder while this runs.
+      fml::TaskPriority::kUserVisible);
 }
 
 }  // namespace flutter
@@ -397,6 +397,49 @@ TEST_F(ImageDecoderFixtureTest, ImpellerPixelConversion32F) {
 #endif  // IMPELLER_SUPPORTS_RENDERING
 }
 
+TEST_F(ImageDecoderFixtureTest, ImpellerRawBytesStagedForGPUConversion) {
+  auto info = SkImageInfo::Make(10, 10, SkColorType::kGray_8_SkColorType,
+                                SkAlphaType::kOpaque_SkAlphaType);
+  SkBitmap bitmap;
+  bitmap.allocPixels(info, 10);
+  auto data = SkData::MakeWithoutCopy(bitmap.getPixels(), 10 * 10);
+  auto image = SkImages::RasterFromBitmap(bitmap);
+  ASSERT_TRUE(image != nullptr);
+  ASSERT_EQ(SkISize::Make(10, 10), image->dimensions());
+
+  auto descriptor = fml::MakeRefCounted<ImageDescriptor>(
+      std::move(data), image->imageInfo(), 10);
+
+#if IMPELLER_SUPPORTS_RENDERING
+#ifdef IMPELLER_ENABLE_COMPUTE
+  std::shared_ptr<impeller::Allocator> allocator =
+      std::make_shared<impeller::TestImpellerAllocator>();
+  std::optional<DecompressResult> staged =
+      ImageDecoderImpeller::DecompressTexture(
+          descriptor.get(), SkISize::Make(10, 10), {100, 100},
+          /*supports_wide_gamut=*/false, allocator,
+          /*staging_belt=*/nullptr,
+          /*allow_gpu_conversion=*/true);
+  ASSERT_TRUE(staged.has_value());
+  // The raw bytes upload as-is and convert during the upload instead.
+  ASSERT_TRUE(staged->raw_color_type.has_value());
+  ASSERT_EQ(staged->raw_color_type.value(), kGray_8_SkColorType);
+  ASSERT_EQ(staged->image_info.colorType(), kRGBA_8888_SkColorType);
+  ASSERT_EQ(staged->sk_bitmap->colorType(), kGray_8_SkColorType);
+
+  // Without permission to convert on the GPU, the decode converts the
+  // pixels as before.
+  std::optional<DecompressResult> converted =
+      ImageDecoderImpeller::DecompressTexture(
+          descriptor.get(), SkISize::Make(10, 10), {100, 100},
+          /*supports_wide_gamut=*/false, allocator);
+  ASSERT_TRUE(converted.has_value());
+  ASSERT_FALSE(converted->raw_color_type.has_value());
+  ASSERT_EQ(converted->sk_bitmap->colorType(), kRGBA_8888_SkColorType);
+#endif  // IMPELLER_ENABLE_COMPUTE
+#endif  // IMPELLER_SUPPORTS_RENDERING
+}
+
 TEST_F(ImageDecoderFixtureTest, ImpellerWideGamutDisplayP3Opaque) {
   auto data = flutter::testing::OpenFixtureAsSkData("DisplayP3Logo.jpg");
   auto image = SkImages::DeferredFromEncodedData(data);
@@ -476,6 +519,68 @@ TEST_F(ImageDecoderFixtureTest, ImpellerNonWideGamut) {
 #endif  // IMPELLER_SUPPORTS_RENDERING
 }
 
+TEST_F(ImageDecoderFixtureTest, ScanlineDecodingMatchesWholeImageDecode) {
+  auto data = flutter::testing::OpenFixtureAsSkData("DashInNooglerHat.jpg");
+
+  ImageGeneratorRegistry registry;
+  std::shared_ptr<ImageGenerator> generator =
+      registry.CreateCompatibleGenerator(data);
+  ASSERT_TRUE(generator);
+  ASSERT_TRUE(generator->SupportsScanlineDecoding());
+
+  const auto info = generator->GetInfo().makeColorType(kRGBA_8888_SkColorType);
+  SkBitmap whole_bitmap;
+  whole_bitmap.allocPixels(info);
+  ASSERT_TRUE(generator->GetPixels(info, whole_bitmap.getPixels(),
+                                   whole_bitmap.rowBytes()));
+
+  SkBitmap scanline_bitmap;
+  scanline_bitmap.allocPixels(info);
+  ASSERT_TRUE(generator->StartScanlineDecode(info));
+  // Decode in uneven strips to exercise strip boundaries.
+  for (int row = 0; row < info.height();) {
+    const int count = std::min(77, info.height() - row);
+    ASSERT_EQ(generator->GetScanlines(scanline_bitmap.getAddr(0, row), count,
+                                      scanline_bitmap.rowBytes()),
+              count);
+    row += count;
+  }
+
+  ASSERT_EQ(memcmp(whole_bitmap.getPixels(), scanline_bitmap.getPixels(),
+                   whole_bitmap.computeByteSize()),
+            0);
+
+  // Images with a non-default EXIF orientation would need the whole image
+  // buffered for reorientation, and so cannot be decoded in strips.
+  auto exif_data = flutter::testing::OpenFixtureAsSkData("Horizontal.jpg");
+  std::shared_ptr<ImageGenerator> exif_generator =
+      registry.CreateCompatibleGenerator(exif_data);
+  ASSERT_TRUE(exif_generator);
+  EXPECT_FALSE(exif_generator->SupportsScanlineDecoding());
+}
+
+TEST_F(ImageDecoderFixtureTest, PngsSupportSubsampledDecoding) {
+  auto data = flutter::testing::OpenFixtureAsSkData("Horizontal.png");
+
+  ImageGeneratorRegistry registry;
+  std::shared_ptr<ImageGenerator> generator =
+      registry.CreateCompatibleGenerator(data);
+  ASSERT_TRUE(generator);
+
+  // PNGs have no native scaled decode, but the codec can subsample so that a
+  // quarter-scale decode skips most of the full resolution pixels.
+  const auto info = generator->GetInfo();
+  const SkISize scaled_size = generator->GetScaledDimensions(0.25f);
+  EXPECT_EQ(scaled_size.width(), info.width() / 4);
+  EXPECT_EQ(scaled_size.height(), info.height() / 4);
+
+  const auto scaled_info = info.makeDimensions(scaled_size);
+  SkBitmap bitmap;
+  bitmap.allocPixels(scaled_info);
+  EXPECT_TRUE(generator->GetPixels(scaled_info, bitmap.getPixels(),
+                                   bitmap.rowBytes()));
+}
+
 TEST_F(ImageDecoderFixtureTest, ExifDataIsRespectedOnDecode) {
   auto loop = fml::ConcurrentMessageLoop::Create();
   TaskRunners runners(GetCurrentTestName(),         // label
@@ -110,6 +110,25 @@ class ImageDescriptor : public RefCountedDartWrappable<ImageDescriptor> {
   ///         orientation tag, if applicable.
   bool get_pixels(const SkPixmap& pixmap) const;
 
+  /// @brief  Whether this image may be decoded a run of rows at a time
+  ///         instead of all at once via `get_pixels`.
+  /// @see    `ImageGenerator::SupportsScanlineDecoding`
+  bool supports_scanline_decoding() const {
+    return generator_ && generator_->SupportsScanlineDecoding();
+  }
+
+  /// @brief  Prepares to decode rows of this image from top to bottom.
+  /// @see    `ImageGenerator::StartScanlineDecode`
+  bool start_scanline_decode(const SkImageInfo& info) {
+    return generator_ && generator_->StartScanlineDecode(info);
+  }
+
+  /// @brief  Decodes the next `count` rows of this image into `pixels`.
+  /// @see    `ImageGenerator::GetScanlines`
+  int get_scanlines(void* pixels, int count, size_t row_bytes) {
+    return generator_ ? generator_->GetScanlines(pixels, count, row_bytes) : 0;
+  }
+
   void dispose() {
     buffer_.reset();
     generator_.reset();
@@ -4,6 +4,8 @@
 
 #include "flutter/lib/ui/painting/image_generator.h"
 
+#include <algorithm>
+#include <cmath>
 #include <utility>
 
 #include "flutter/fml/logging.h"
@@ -16,6 +18,18 @@ namespace flutter {
 
 ImageGenerator::~ImageGenerator() = default;
 
+bool ImageGenerator::SupportsScanlineDecoding() const {
+  return false;
+}
+
+bool ImageGenerator::StartScanlineDecode(const SkImageInfo& info) {
+  return false;
+}
+
+int ImageGenerator::GetScanlines(void* pixels, int count, size_t row_bytes) {
+  return 0;
+}
+
 sk_sp<SkImage> ImageGenerator::GetImage() {
   SkImageInfo info = GetInfo();
 
@@ -97,14 +111,14 @@ static SkImageInfo getInfoIncludingExif(SkCodec* codec) {
 
 BuiltinSkiaCodecImageGenerator::BuiltinSkiaCodecImageGenerator(
     std::unique_ptr<SkCodec> codec)
-    : codec_(std::move(codec)) {
-  image_info_ = getInfoIncludingExif(codec_.get());
+    : codec_(SkAndroidCodec::MakeFromCodec(std::move(codec))) {
+  image_info_ = getInfoIncludingExif(codec_->codec());
 }
 
 BuiltinSkiaCodecImageGenerator::BuiltinSkiaCodecImageGenerator(
     sk_sp<SkData> buffer)
-    : codec_(SkCodec::MakeFromData(std::move(buffer)).release()) {
-  image_info_ = getInfoIncludingExif(codec_.get());
+    : codec_(SkAndroidCodec::MakeFromData(std::move(buffer))) {
+  image_info_ = getInfoIncludingExif(codec_->codec());
 }
 
 const SkImageInfo& BuiltinSkiaCodecImageGenerator::GetInfo() {
@@ -112,18 +126,18 @@ const SkImageInfo& BuiltinSkiaCodecImageGenerator::GetInfo() {
 }
 
 unsigned int BuiltinSkiaCodecImageGenerator::GetFrameCount() const {
-  return codec_->getFrameCount();
+  return codec_->codec()->getFrameCount();
 }
 
 unsigned int BuiltinSkiaCodecImageGenerator::GetPlayCount() const {
-  auto repetition_count = codec_->getRepetitionCount();
+  auto repetition_count = codec_->codec()->getRepetitionCount();
   return repetition_count < 0 ? kInfinitePlayCount : repetition_count + 1;
 }
 
 const ImageGenerator::FrameInfo BuiltinSkiaCodecImageGenerator::GetFrameInfo(
     unsigned int frame_index) {
   SkCodec::FrameInfo info = {};
-  codec_->getFrameInfo(frame_index, &info);
+  codec_->codec()->getFrameInfo(frame_index, &info);
   return {
       .required_frame = info.fRequiredFrame == SkCodec::kNoFrame
                             ? std::nullopt
@@ -134,8 +148,16 @@ const ImageGenerator::FrameInfo BuiltinSkiaCodecImageGenerator::GetFrameInfo(
 
 SkISize BuiltinSkiaCodecImageGenerator::GetScaledDimensions(
     float desired_scale) {
-  SkISize size = codec_->getScaledDimensions(desired_scale);
-  if (SkEncodedOriginSwapsWidthHeight(codec_->getOrigin())) {
+  const SkISize native_size = codec_->codec()->dimensions();
+  SkISize size = SkISize::Make(
+      std::max(1, static_cast<int>(std::round(native_size.width() *  //
+                                              desired_scale))),
+      std::max(1, static_cast<int>(std::round(native_size.height() *  //
+                                              desired_scale))));
+  // Clamp to the nearest dimensions the codec can produce directly, whether
+  // through native scaling (e.g. JPEG DCT scaling) or subsampling.
+  codec_->computeSampleSize(&size);
+  if (SkEncodedOriginSwapsWidthHeight(codec_->codec()->getOrigin())) {
     std::swap(size.fWidth, size.fHeight);
   }
   return size;
@@ -147,12 +169,12 @@ bool BuiltinSkiaCodecImageGenerator::GetPixels(
     size_t row_bytes,
     unsigned int frame_index,
     std::optional<unsigned int> prior_frame) {
-  SkCodec::Options options;
+  SkAndroidCodec::AndroidOptions options;
   options.fFrameIndex = frame_index;
   if (prior_frame.has_value()) {
     options.fPriorFrame = prior_frame.value();
   }
-  SkEncodedOrigin origin = codec_->getOrigin();
+  SkEncodedOrigin origin = codec_->codec()->getOrigin();
 
   SkPixmap output_pixmap(info, pixels, row_bytes);
   SkPixmap temp_pixmap;
@@ -176,7 +198,25 @@ bool BuiltinSkiaCodecImageGenerator::GetPixels(
     temp_pixmap = temp_bitmap.pixmap();
   }
 
-  SkCodec::Result result = codec_->getPixels(temp_pixmap, &options);
+  SkCodec::Result result;
+  if (temp_pixmap.dimensions() == codec_->codec()->dimensions()) {
+    result = codec_->codec()->getPixels(temp_pixmap, &options);
+  } else {
+    // A scaled decode. Have the codec produce the nearest dimensions it
+    // supports through native scaling (e.g. JPEG DCT scaling) or subsampling
+    // so that only a fraction of the full resolution pixels are decoded.
+    SkISize sampled_size = temp_pixmap.dimensions();
+    options.fSampleSize = codec_->computeSampleSize(&sampled_size);
+    if (sampled_size != temp_pixmap.dimensions()) {
+      FML_DLOG(WARNING) << "codec does not support decoding at "
+                        << temp_pixmap.width() << "x" << temp_pixmap.height()
+                        << ".";
+      return false;
+    }
+    result = codec_->getAndroidPixels(temp_pixmap.info(),
+                                      temp_pixmap.writable_addr(),
+                                      temp_pixmap.rowBytes(), &options);
+  }
   if (result != SkCodec::kSuccess) {
     FML_DLOG(WARNING) << "codec could not get pixels. "
                       << SkCodec::ResultToString(result);
@@ -188,6 +228,37 @@ bool BuiltinSkiaCodecImageGenerator::GetPixels(
   return SkPixmapUtils::Orient(output_pixmap, temp_pixmap, origin);
 }
 
+bool BuiltinSkiaCodecImageGenerator::SupportsScanlineDecoding() const {
+  // Reoriented output would require buffering the entire image, which defeats
+  // the purpose of scanline decoding, and animated images must be decoded
+  // through the frame-aware `GetPixels`.
+  return codec_->codec()->getOrigin() == kTopLeft_SkEncodedOrigin &&
+         codec_->codec()->getFrameCount() == 1;
+}
+
+bool BuiltinSkiaCodecImageGenerator::StartScanlineDecode(
+    const SkImageInfo& info) {
+  if (!SupportsScanlineDecoding()) {
+    return false;
+  }
+  SkCodec::Result result = codec_->codec()->startScanlineDecode(info);
+  if (result != SkCodec::kSuccess) {
+    FML_DLOG(WARNING) << "codec could not start scanline decode. "
+                      << SkCodec::ResultToString(result);
+    return false;
+  }
+  // Bottom-up codecs (e.g. some BMPs) return rows out of order; reject them
+  // so that the caller falls back to a whole-image decode.
+  return codec_->codec()->getScanlineOrder() ==
+         SkCodec::kTopDown_SkScanlineOrder;
+}
+
+int BuiltinSkiaCodecImageGenerator::GetScanlines(void* pixels,
+                                                 int count,
+                                                 size_t row_bytes) {
+  return codec_->codec()->getScanlines(pixels, count, row_bytes);
+}
+
 std::unique_ptr<ImageGenerator> BuiltinSkiaCodecImageGenerator::MakeFromData(
     sk_sp<SkData> data) {
   auto codec = SkCodec::MakeFromData(std::move(data));
@@ -7,6 +7,7 @@
 
 #include <optional>
 #include "flutter/fml/macros.h"
+#include "third_party/skia/include/android/SkAndroidCodec.h"
 #include "third_party/skia/include/codec/SkCodec.h"
 #include "third_party/skia/include/codec/SkCodecAnimation.h"
 #include "third_party/skia/include/core/SkData.h"
@@ -135,6 +136,40 @@ class ImageGenerator {
       unsigned int frame_index = 0,
       std::optional<unsigned int> prior_frame = std::nullopt) = 0;
 
+  /// @brief   Whether the image may be decoded a run of rows at a time via
+  ///          `StartScanlineDecode` and `GetScanlines`. Scanline decoding
+  ///          allows very large images to be decoded and downsampled without
+  ///          ever materializing the full resolution image in memory.
+  /// @return  True if scanline decoding may be attempted. The default
+  ///          implementation returns false, and `GetPixels` must be used
+  ///          instead.
+  /// @see     `StartScanlineDecode`
+  virtual bool SupportsScanlineDecoding() const;
+
+  /// @brief      Prepare to decode rows of the first frame of the image, from
+  ///             top to bottom.
+  /// @param[in]  info  The desired size and color info of the decoded rows.
+  ///                   The implementation of `GetScaledDimensions` determines
+  ///                   which sizes are supported by the image decoder.
+  /// @return     True if scanline decoding was successfully started. On
+  ///             failure the caller must fall back to `GetPixels`.
+  /// @see        `GetScanlines`
+  virtual bool StartScanlineDecode(const SkImageInfo& info);
+
+  /// @brief      Decode the next `count` rows of the image into `pixels`.
+  ///             `StartScanlineDecode` must have been called successfully
+  ///             first, and rows are always returned in top-down order.
+  /// @param[in]  pixels     The location where the decoded rows should be
+  ///                        written.
+  /// @param[in]  count      The number of rows to decode.
+  /// @param[in]  row_bytes  The total number of bytes that should make up a
+  ///                        single row of decoded image data.
+  /// @return     The number of rows successfully decoded. A short count
+  ///             indicates a truncated image; the remaining rows are filled
+  ///             with a best-effort value.
+  /// @see        `StartScanlineDecode`
+  virtual int GetScanlines(void* pixels, int count, size_t row_bytes);
+
   /// @brief   Creates an `SkImage` based on the current `ImageInfo` of this
   ///          `ImageGenerator`.
   /// @return  A new `SkImage` containing the decoded image data.
@@ -212,11 +247,23 @@ class BuiltinSkiaCodecImageGenerator : public ImageGenerator {
       unsigned int frame_index = 0,
       std::optional<unsigned int> prior_frame = std::nullopt) override;
 
+  // |ImageGenerator|
+  bool SupportsScanlineDecoding() const override;
+
+  // |ImageGenerator|
+  bool StartScanlineDecode(const SkImageInfo& info) override;
+
+  // |ImageGenerator|
+  int GetScanlines(void* pixels, int count, size_t row_bytes) override;
+
   static std::unique_ptr<ImageGenerator> MakeFromData(sk_sp<SkData> data);
 
  private:
   FML_DISALLOW_COPY_ASSIGN_AND_MOVE(BuiltinSkiaCodecImageGenerator);
-  std::unique_ptr<SkCodec> codec_;
+  // The codec is wrapped in an `SkAndroidCodec` so that scaled decodes can
+  // use native codec scaling (e.g. JPEG DCT scaling) or subsampling instead
+  // of decoding at full resolution and resizing.
+  std::unique_ptr<SkAndroidCodec> codec_;
   SkImageInfo image_info_;
 };
 
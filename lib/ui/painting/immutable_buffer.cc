@@ -108,8 +108,7 @@ Dart_Handle ImmutableBuffer::initFromAsset(Dart_Handle raw_buffer_handle,
         size_t buffer_size = 0;
         if (mapping != nullptr) {
           buffer_size = mapping->GetSize();
-          const void* bytes = static_cast<const void*>(mapping->GetMapping());
-          sk_data = MakeSkDataWithCopy(bytes, buffer_size);
+          sk_data = MakeSkDataFromMapping(std::move(mapping));
         }
         ui_task_runner->PostTask(
             [sk_data = std::move(sk_data), ui_task = ui_task, buffer_size]() {
@@ -178,8 +177,7 @@ Dart_Handle ImmutableBuffer::initFromFile(Dart_Handle raw_buffer_handle,
         size_t buffer_size = 0;
         if (mapping->IsValid()) {
           buffer_size = mapping->GetSize();
-          const void* bytes = static_cast<const void*>(mapping->GetMapping());
-          sk_data = MakeSkDataWithCopy(bytes, buffer_size);
+          sk_data = MakeSkDataFromMapping(std::move(mapping));
         }
         ui_task_runner->PostTask(
             [sk_data = std::move(sk_data), ui_task = ui_task, buffer_size]() {
@@ -189,6 +187,26 @@ Dart_Handle ImmutableBuffer::initFromFile(Dart_Handle raw_buffer_handle,
   return Dart_Null();
 }
 
+// Wraps a mapping (typically a read-only file mapping handed out by the asset
+// bundle) in an SkData without copying. The mapping is retained until the last
+// reference to the data is dropped, so large assets are served straight from
+// the page cache instead of being double-buffered on the heap.
+sk_sp<SkData> ImmutableBuffer::MakeSkDataFromMapping(
+    std::unique_ptr<fml::Mapping> mapping) {
+  FML_DCHECK(mapping);
+  if (mapping->GetSize() == 0) {
+    return SkData::MakeEmpty();
+  }
+
+  const void* bytes = static_cast<const void*>(mapping->GetMapping());
+  const size_t length = mapping->GetSize();
+  SkData::ReleaseProc proc = [](const void* ptr, void* context) {
+    delete reinterpret_cast<fml::Mapping*>(context);
+  };
+
+  return SkData::MakeWithProc(bytes, length, proc, mapping.release());
+}
+
 #if FML_OS_ANDROID
 
 // Compressed image buffers are allocated on the UI thread but are deleted on a
@@ -21,6 +21,10 @@
 
 namespace flutter {
 
+// The maximum number of bytes a single staged lookahead frame may occupy.
+// Animations with larger frames are only decoded on demand.
+static constexpr size_t kLookaheadMemoryBudgetBytes = 32u * 1024u * 1024u;
+
 MultiFrameCodec::MultiFrameCodec(std::shared_ptr<ImageGenerator> generator)
     : state_(new State(std::move(generator))) {}
 
@@ -182,6 +186,39 @@ MultiFrameCodec::State::GetNextFrameImage(
                         std::string());
 }
 
+void MultiFrameCodec::State::DecodeLookaheadFrame(
+    fml::WeakPtr<GrDirectContext> resourceContext,
+    const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
+    const std::shared_ptr<impeller::Context>& impeller_context,
+    fml::RefPtr<flutter::SkiaUnrefQueue> unref_queue) {
+  if (frameCount_ <= 1 || lookahead_frame_.has_value()) {
+    return;
+  }
+  // At most one frame is staged ahead, and only for animations whose frames
+  // fit the lookahead memory budget.
+  const size_t frame_byte_size = generator_->GetInfo()
+                                     .makeColorType(kN32_SkColorType)
+                                     .computeMinByteSize();
+  if (frame_byte_size > kLookaheadMemoryBudgetBytes) {
+    return;
+  }
+  sk_sp<DlImage> image;
+  std::string decode_error;
+  std::tie(image, decode_error) =
+      GetNextFrameImage(std::move(resourceContext), gpu_disable_sync_switch,
+                        impeller_context, std::move(unref_queue));
+  if (!image) {
+    // Decode again on demand so the error is reported through the callback.
+    return;
+  }
+  lookahead_frame_ = LookaheadFrame{
+      .frame_index = nextFrameIndex_,
+      .image = std::move(image),
+      .duration =
+          static_cast<int>(generator_->GetFrameInfo(nextFrameIndex_).duration),
+  };
+}
+
 void MultiFrameCodec::State::GetNextFrameAndInvokeCallback(
     std::unique_ptr<DartPersistentValue> callback,
     const fml::RefPtr<fml::TaskRunner>& ui_task_runner,
@@ -194,15 +231,25 @@ void MultiFrameCodec::State::GetNextFrameAndInvokeCallback(
   int duration = 0;
   sk_sp<DlImage> dlImage;
   std::string decode_error;
-  std::tie(dlImage, decode_error) =
-      GetNextFrameImage(std::move(resourceContext), gpu_disable_sync_switch,
-                        impeller_context, std::move(unref_queue));
+  if (lookahead_frame_.has_value() &&
+      lookahead_frame_->frame_index == nextFrameIndex_) {
+    dlImage = std::move(lookahead_frame_->image);
+    duration = lookahead_frame_->duration;
+    lookahead_frame_.reset();
+  } else {
+    lookahead_frame_.reset();
+    std::tie(dlImage, decode_error) =
+        GetNextFrameImage(resourceContext, gpu_disable_sync_switch,
+                          impeller_context, unref_queue);
+    if (dlImage) {
+      ImageGenerator::FrameInfo frameInfo =
+          generator_->GetFrameInfo(nextFrameIndex_);
+      duration = frameInfo.duration;
+    }
+  }
   if (dlImage) {
     image = CanvasImage::Create();
     image->set_image(dlImage);
-    ImageGenerator::FrameInfo frameInfo =
-        generator_->GetFrameInfo(nextFrameIndex_);
-    duration = frameInfo.duration;
   }
   nextFrameIndex_ = (nextFrameIndex_ + 1) % frameCount_;
 
@@ -214,6 +261,11 @@ void MultiFrameCodec::State::GetNextFrameAndInvokeCallback(
         InvokeNextFrameCallback(image, duration, decode_error,
                                 std::move(callback), trace_id);
       }));
+
+  // With the callback on its way to the UI thread, decode the frame that will
+  // most likely be requested next while the IO thread is otherwise idle.
+  DecodeLookaheadFrame(std::move(resourceContext), gpu_disable_sync_switch,
+                       impeller_context, std::move(unref_queue));
 }
 
 Dart_Handle MultiFrameCodec::getNextFrame(Dart_Handle callback_handle) {
@@ -61,6 +61,15 @@ class MultiFrameCodec : public Codec {
     // method was kRestoreBGColor.
     std::optional<SkIRect> restoreBGColorRect_;
 
+    // A single frame decoded ahead of the next request, so that steadily
+    // playing animations don't wait on decode when the frame is due.
+    struct LookaheadFrame {
+      int frame_index;
+      sk_sp<DlImage> image;
+      int duration;
+    };
+    std::optional<LookaheadFrame> lookahead_frame_;
+
     std::pair<sk_sp<DlImage>, std::string> GetNextFrameImage(
         fml::WeakPtr<GrDirectContext> resourceContext,
         const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
@@ -75,6 +84,12 @@ class MultiFrameCodec : public Codec {
         const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
         size_t trace_id,
         const std::shared_ptr<impeller::Context>& impeller_context);
+
+    void DecodeLookaheadFrame(
+        fml::WeakPtr<GrDirectContext> resourceContext,
+        const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
+        const std::shared_ptr<impeller::Context>& impeller_context,
+        fml::RefPtr<flutter::SkiaUnrefQueue> unref_queue);
   };
 
   // Shared across the UI and IO task runners.
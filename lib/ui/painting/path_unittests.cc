@@ -65,6 +65,65 @@ TEST_F(ShellTest, PathVolatilityOldPathsBecomeNonVolatile) {
   DestroyShell(std::move(shell), task_runners);
 }
 
+TEST_F(ShellTest, PathVolatilityEqualPathsAreInternedWhenAgedOut) {
+  auto message_latch = std::make_shared<fml::AutoResetWaitableEvent>();
+
+  auto native_validate_paths = [message_latch](Dart_NativeArguments args) {
+    auto get_path = [](Dart_NativeArguments args, int index) {
+      auto handle = Dart_GetNativeArgument(args, index);
+      intptr_t peer = 0;
+      Dart_Handle result = Dart_GetNativeInstanceField(
+          handle, tonic::DartWrappable::kPeerIndex, &peer);
+      EXPECT_FALSE(Dart_IsError(result));
+      return reinterpret_cast<CanvasPath*>(peer);
+    };
+    CanvasPath* path1 = get_path(args, 0);
+    CanvasPath* path2 = get_path(args, 1);
+    EXPECT_TRUE(path1);
+    EXPECT_TRUE(path2);
+    EXPECT_NE(path1->path().getGenerationID(),
+              path2->path().getGenerationID());
+    std::shared_ptr<VolatilePathTracker> tracker =
+        UIDartState::Current()->GetVolatilePathTracker();
+    EXPECT_TRUE(tracker);
+
+    for (int i = 0; i < VolatilePathTracker::kFramesOfVolatility; i++) {
+      tracker->OnFrame();
+    }
+    EXPECT_FALSE(path1->path().isVolatile());
+    EXPECT_FALSE(path2->path().isVolatile());
+    // Both paths now share the same interned backing data.
+    EXPECT_EQ(path1->path().getGenerationID(),
+              path2->path().getGenerationID());
+    message_latch->Signal();
+  };
+
+  Settings settings = CreateSettingsForFixture();
+  TaskRunners task_runners("test",                  // label
+                           GetCurrentTaskRunner(),  // platform
+                           CreateNewThread(),       // raster
+                           CreateNewThread(),       // ui
+                           CreateNewThread()        // io
+  );
+
+  AddNativeCallback("ValidatePaths",
+                    CREATE_NATIVE_ENTRY(native_validate_paths));
+
+  std::unique_ptr<Shell> shell = CreateShell(settings, task_runners);
+
+  ASSERT_TRUE(shell->IsSetup());
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  configuration.SetEntrypoint("createEqualPaths");
+
+  shell->RunEngine(std::move(configuration), [](auto result) {
+    ASSERT_EQ(result, Engine::RunStatus::Success);
+  });
+
+  message_latch->Wait();
+
+  DestroyShell(std::move(shell), task_runners);
+}
+
 TEST_F(ShellTest, PathVolatilityGCRemovesPathFromTracker) {
   static_assert(VolatilePathTracker::kFramesOfVolatility > 1);
   auto message_latch = std::make_shared<fml::AutoResetWaitableEvent>();
@@ -4,10 +4,14 @@
 
 #include "flutter/lib/ui/painting/picture.h"
 
+#include <deque>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 #include "flutter/fml/make_copyable.h"
+#include "flutter/fml/task_runner.h"
 #include "flutter/lib/ui/painting/canvas.h"
 #include "flutter/lib/ui/painting/display_list_deferred_image_gpu_skia.h"
 #include "flutter/lib/ui/ui_dart_state.h"
@@ -23,6 +27,85 @@
 #include "third_party/tonic/logging/dart_invoke.h"
 
 namespace flutter {
+namespace {
+
+// Serializes toImage rasterization jobs per raster task runner.
+//
+// Posting a burst of snapshot jobs directly to the raster thread queues them
+// back to back, where they compete with frame production and jank scrolling.
+// This queue keeps at most one snapshot task in flight per raster thread and
+// chains to the next job from the back of the raster queue, so any pending
+// frame work runs between successive snapshots.
+class SnapshotWorkQueue {
+ public:
+  static SnapshotWorkQueue* GetInstance() {
+    static SnapshotWorkQueue* queue = new SnapshotWorkQueue();
+    return queue;
+  }
+
+  void Enqueue(const fml::RefPtr<fml::TaskRunner>& raster_task_runner,
+               fml::closure job) {
+    bool post_drain = false;
+    {
+      std::scoped_lock lock(mutex_);
+      PerRunnerQueue& queue = queues_[raster_task_runner.get()];
+      queue.runner = raster_task_runner;
+      queue.jobs.push_back(std::move(job));
+      if (!queue.draining) {
+        queue.draining = true;
+        post_drain = true;
+      }
+    }
+    if (post_drain) {
+      raster_task_runner->PostTask(
+          [this, runner_key = raster_task_runner.get()]() {
+            Drain(runner_key);
+          });
+    }
+  }
+
+ private:
+  struct PerRunnerQueue {
+    // Keeps the runner (and therefore the key) alive while jobs are pending.
+    fml::RefPtr<fml::TaskRunner> runner;
+    std::deque<fml::closure> jobs;
+    bool draining = false;
+  };
+
+  SnapshotWorkQueue() = default;
+
+  void Drain(fml::TaskRunner* runner_key) {
+    fml::closure job;
+    {
+      std::scoped_lock lock(mutex_);
+      auto it = queues_.find(runner_key);
+      FML_DCHECK(it != queues_.end());
+      job = std::move(it->second.jobs.front());
+      it->second.jobs.pop_front();
+    }
+
+    job();
+
+    fml::RefPtr<fml::TaskRunner> next_runner;
+    {
+      std::scoped_lock lock(mutex_);
+      auto it = queues_.find(runner_key);
+      if (it->second.jobs.empty()) {
+        queues_.erase(it);
+      } else {
+        next_runner = it->second.runner;
+      }
+    }
+    if (next_runner) {
+      next_runner->PostTask([this, runner_key]() { Drain(runner_key); });
+    }
+  }
+
+  std::mutex mutex_;
+  std::map<fml::TaskRunner*, PerRunnerQueue> queues_;
+};
+
+}  // namespace
 
 IMPLEMENT_WRAPPERTYPEINFO(ui, Picture);
 
@@ -195,8 +278,10 @@ Dart_Handle Picture::DoRasterizeToImage(const sk_sp<DisplayList>& display_list,
         image_callback.reset();
       });
 
-  // Kick things off on the raster rask runner.
-  fml::TaskRunner::RunNowOrPostTask(
+  // Queue the job for the raster task runner. The queue admits one snapshot
+  // task at a time so frame work retains priority over bursts of toImage
+  // requests.
+  SnapshotWorkQueue::GetInstance()->Enqueue(
       raster_task_runner,
       fml::MakeCopyable([ui_task_runner, snapshot_delegate, display_list, width,
                          height, ui_task,
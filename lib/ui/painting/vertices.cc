@@ -5,12 +5,113 @@
 #include "flutter/lib/ui/painting/vertices.h"
 
 #include <algorithm>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <string_view>
 
+#include "flutter/fml/hash_combine.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "third_party/tonic/dart_binding_macros.h"
 #include "third_party/tonic/dart_library_natives.h"
 
 namespace flutter {
+namespace {
+
+size_t HashBytes(size_t seed, const void* data, size_t length) {
+  if (data == nullptr) {
+    return fml::HashCombine(seed, size_t{0});
+  }
+  return fml::HashCombine(
+      seed, std::hash<std::string_view>{}(
+                std::string_view(static_cast<const char*>(data), length)));
+}
+
+bool BytesMatch(const void* cached, const void* data, size_t length) {
+  if ((cached == nullptr) != (data == nullptr)) {
+    return false;
+  }
+  return cached == nullptr || ::memcmp(cached, data, length) == 0;
+}
+
+// A small cache of recently built DlVertices objects.
+//
+// Charting and particle workloads rebuild their vertex sets every frame even
+// though most frames carry identical data. Sharing one immutable DlVertices
+// across those frames skips the per-init allocation and copy, and keeps the
+// object identity stable so downstream consumers see an unchanged mesh.
+class VerticesCache {
+ public:
+  static constexpr size_t kMaxEntries = 8;
+  static constexpr size_t kMaxRetainedBytes = 1024 * 1024;
+
+  static VerticesCache* GetInstance() {
+    static VerticesCache* cache = new VerticesCache();
+    return cache;
+  }
+
+  std::shared_ptr<DlVertices> Find(size_t hash,
+                                   DlVertexMode mode,
+                                   const float* positions,
+                                   int position_count,
+                                   const float* texture_coordinates,
+                                   const int32_t* colors,
+                                   const uint16_t* indices,
+                                   int index_count) {
+    std::scoped_lock lock(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end(); it++) {
+      if (it->hash != hash) {
+        continue;
+      }
+      const DlVertices* cached = it->vertices.get();
+      const int vertex_count = position_count / 2;
+      if (cached->mode() != mode || cached->vertex_count() != vertex_count ||
+          cached->index_count() != index_count ||
+          !BytesMatch(cached->vertices(), positions,
+                      position_count * sizeof(float)) ||
+          !BytesMatch(cached->texture_coordinates(), texture_coordinates,
+                      position_count * sizeof(float)) ||
+          !BytesMatch(cached->colors(), colors,
+                      vertex_count * sizeof(int32_t)) ||
+          !BytesMatch(cached->indices(), indices,
+                      index_count * sizeof(uint16_t))) {
+        continue;
+      }
+      entries_.splice(entries_.begin(), entries_, it);
+      return it->vertices;
+    }
+    return nullptr;
+  }
+
+  void Insert(size_t hash, const std::shared_ptr<DlVertices>& vertices) {
+    const size_t size = vertices->size();
+    if (size > kMaxRetainedBytes) {
+      return;
+    }
+    std::scoped_lock lock(mutex_);
+    retained_bytes_ += size;
+    entries_.push_front({hash, vertices});
+    while (entries_.size() > kMaxEntries ||
+           retained_bytes_ > kMaxRetainedBytes) {
+      retained_bytes_ -= entries_.back().vertices->size();
+      entries_.pop_back();
+    }
+  }
+
+ private:
+  struct Entry {
+    size_t hash;
+    std::shared_ptr<DlVertices> vertices;
+  };
+
+  VerticesCache() = default;
+
+  std::mutex mutex_;
+  std::list<Entry> entries_;
+  size_t retained_bytes_ = 0;
+};
+
+}  // namespace
 
 IMPLEMENT_WRAPPERTYPEINFO(ui, Vertices);
 
@@ -35,6 +136,34 @@ bool Vertices::init(Dart_Handle vertices_handle,
     return false;
   }
 
+  const int index_count =
+      indices.data() ? static_cast<int>(indices.num_elements()) : 0;
+  const uint16_t* index_data = index_count > 0 ? indices.data() : nullptr;
+
+  size_t hash = fml::HashCombine(static_cast<uint32_t>(vertex_mode),
+                                 positions.num_elements(), index_count);
+  hash = HashBytes(hash, positions.data(),
+                   positions.num_elements() * sizeof(float));
+  hash = HashBytes(hash, texture_coordinates.data(),
+                   texture_coordinates.num_elements() * sizeof(float));
+  hash = HashBytes(hash, colors.data(),
+                   colors.num_elements() * sizeof(int32_t));
+  hash = HashBytes(hash, index_data, index_count * sizeof(uint16_t));
+
+  if (auto cached = VerticesCache::GetInstance()->Find(
+          hash, vertex_mode, positions.data(), positions.num_elements(),
+          texture_coordinates.data(), colors.data(), index_data, index_count)) {
+    positions.Release();
+    texture_coordinates.Release();
+    colors.Release();
+    indices.Release();
+
+    auto vertices = fml::MakeRefCounted<Vertices>();
+    vertices->vertices_ = std::move(cached);
+    vertices->AssociateWithDartWrapper(vertices_handle);
+    return true;
+  }
+
   DlVertices::Builder::Flags flags;
   if (texture_coordinates.data()) {
     flags = flags | DlVertices::Builder::kHasTextureCoordinates;
@@ -73,8 +202,11 @@ bool Vertices::init(Dart_Handle vertices_handle,
   colors.Release();
   indices.Release();
 
+  auto built = builder.build();
+  VerticesCache::GetInstance()->Insert(hash, built);
+
   auto vertices = fml::MakeRefCounted<Vertices>();
-  vertices->vertices_ = builder.build();
+  vertices->vertices_ = std::move(built);
   vertices->AssociateWithDartWrapper(vertices_handle);
 
   return true;
@@ -4,10 +4,45 @@
 
 #include "flutter/lib/ui/semantics/semantics_node.h"
 
+#include <cmath>
 #include <cstring>
 
 namespace flutter {
 
+namespace {
+
+bool SameScalar(double lhs, double rhs) {
+  return (std::isnan(lhs) && std::isnan(rhs)) || lhs == rhs;
+}
+
+bool SameAttributes(const StringAttributes& lhs, const StringAttributes& rhs) {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < lhs.size(); i++) {
+    const StringAttributePtr& left = lhs[i];
+    const StringAttributePtr& right = rhs[i];
+    if (!left || !right) {
+      if (left != right) {
+        return false;
+      }
+      continue;
+    }
+    if (left->start != right->start || left->end != right->end ||
+        left->type != right->type) {
+      return false;
+    }
+    if (left->type == StringAttributeType::kLocale &&
+        static_cast<const LocaleStringAttribute&>(*left).locale !=
+            static_cast<const LocaleStringAttribute&>(*right).locale) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
 constexpr int32_t kMinPlatformViewId = -1;
 
 SemanticsNode::SemanticsNode() = default;
@@ -28,4 +63,37 @@ bool SemanticsNode::IsPlatformViewNode() const {
   return platformViewId > kMinPlatformViewId;
 }
 
+bool operator==(const SemanticsNode& lhs, const SemanticsNode& rhs) {
+  return lhs.id == rhs.id && lhs.flags == rhs.flags &&
+         lhs.actions == rhs.actions &&
+         lhs.maxValueLength == rhs.maxValueLength &&
+         lhs.currentValueLength == rhs.currentValueLength &&
+         lhs.textSelectionBase == rhs.textSelectionBase &&
+         lhs.textSelectionExtent == rhs.textSelectionExtent &&
+         lhs.platformViewId == rhs.platformViewId &&
+         lhs.scrollChildren == rhs.scrollChildren &&
+         lhs.scrollIndex == rhs.scrollIndex &&
+         SameScalar(lhs.scrollPosition, rhs.scrollPosition) &&
+         SameScalar(lhs.scrollExtentMax, rhs.scrollExtentMax) &&
+         SameScalar(lhs.scrollExtentMin, rhs.scrollExtentMin) &&
+         lhs.elevation == rhs.elevation && lhs.thickness == rhs.thickness &&
+         lhs.label == rhs.label &&
+         SameAttributes(lhs.labelAttributes, rhs.labelAttributes) &&
+         lhs.hint == rhs.hint &&
+         SameAttributes(lhs.hintAttributes, rhs.hintAttributes) &&
+         lhs.value == rhs.value &&
+         SameAttributes(lhs.valueAttributes, rhs.valueAttributes) &&
+         lhs.increasedValue == rhs.increasedValue &&
+         SameAttributes(lhs.increasedValueAttributes,
+                        rhs.increasedValueAttributes) &&
+         lhs.decreasedValue == rhs.decreasedValue &&
+         SameAttributes(lhs.decreasedValueAttributes,
+                        rhs.decreasedValueAttributes) &&
+         lhs.tooltip == rhs.tooltip && lhs.textDirection == rhs.textDirection &&
+         lhs.rect == rhs.rect && lhs.transform == rhs.transform &&
+         lhs.childrenInTraversalOrder == rhs.childrenInTraversalOrder &&
+         lhs.childrenInHitTestOrder == rhs.childrenInHitTestOrder &&
+         lhs.customAccessibilityActions == rhs.customAccessibilityActions;
+}
+
 }  // namespace flutter
@@ -143,6 +143,14 @@ struct SemanticsNode {
   std::vector<int32_t> customAccessibilityActions;
 };
 
+// Structural equality over all node data. NaN-valued scroll fields compare
+// equal to each other so that untouched defaults do not read as changes.
+bool operator==(const SemanticsNode& lhs, const SemanticsNode& rhs);
+
+inline bool operator!=(const SemanticsNode& lhs, const SemanticsNode& rhs) {
+  return !(lhs == rhs);
+}
+
 // Contains semantic nodes that need to be updated.
 //
 // The keys in the map are stable node IDd, and the values contain
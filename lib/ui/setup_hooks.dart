@@ -25,5 +25,12 @@ void _setupHooks() {
       'ext.ui.window.impellerEnabled',
       _getImpellerEnabled,
     );
+
+    // In debug and profile mode, allow tools to inspect platform channel
+    // buffer statistics.
+    developer.registerExtension(
+      'ext.ui.channelBuffers.stats',
+      _getChannelBufferStats,
+    );
   }
 }
@@ -3312,6 +3312,16 @@ abstract class ParagraphBuilder {
   /// The text will be styled according to the current stack of text styles.
   void addText(String text);
 
+  /// Adds the given UTF-16 code units to the paragraph.
+  ///
+  /// The code units are read directly out of the typed data view without
+  /// first copying them into an intermediate [String], which makes this
+  /// variant cheaper than [addText] when the code units are already available
+  /// as a [Uint16List]. The list must contain well-formed UTF-16.
+  ///
+  /// The text will be styled according to the current stack of text styles.
+  void addUtf16Text(Uint16List text);
+
   /// Adds an inline placeholder space to the paragraph.
   ///
   /// The paragraph will contain a rectangular space with no text of the dimensions
@@ -3543,6 +3553,17 @@ base class _NativeParagraphBuilder extends NativeFieldWrapperClass1 implements P
   @Native<Handle Function(Pointer<Void>, Handle)>(symbol: 'ParagraphBuilder::addText')
   external String? _addText(String text);
 
+  @override
+  void addUtf16Text(Uint16List text) {
+    final String? error = _addUtf16Text(text);
+    if (error != null) {
+      throw ArgumentError(error);
+    }
+  }
+
+  @Native<Handle Function(Pointer<Void>, Handle)>(symbol: 'ParagraphBuilder::addUtf16Text')
+  external String? _addUtf16Text(Uint16List text);
+
   @override
   void addPlaceholder(double width, double height, PlaceholderAlignment alignment, {
     double scale = 1.0,
@@ -6,18 +6,21 @@
 
 #include <mutex>
 
+#include "flutter/fml/make_copyable.h"
 #include "flutter/lib/ui/text/asset_manager_font_provider.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "flutter/lib/ui/window/platform_configuration.h"
 #include "flutter/runtime/test_font_data.h"
 #include "rapidjson/document.h"
 #include "rapidjson/rapidjson.h"
+#include "third_party/skia/include/core/SkData.h"
 #include "third_party/skia/include/core/SkFontMgr.h"
 #include "third_party/skia/include/core/SkGraphics.h"
 #include "third_party/skia/include/core/SkStream.h"
 #include "third_party/skia/include/core/SkTypeface.h"
 #include "third_party/tonic/dart_args.h"
 #include "third_party/tonic/dart_library_natives.h"
+#include "third_party/tonic/dart_persistent_value.h"
 #include "third_party/tonic/logging/dart_invoke.h"
 #include "third_party/tonic/typed_data/typed_list.h"
 #include "txt/asset_font_manager.h"
@@ -151,26 +154,61 @@ void FontCollection::LoadFontFromList(Dart_Handle font_data_handle,
                                       const std::string& family_name) {
   tonic::Uint8List font_data(font_data_handle);
   UIDartState::ThrowIfUIOperationsProhibited();
-  FontCollection& font_collection = UIDartState::Current()
-                                        ->platform_configuration()
-                                        ->client()
-                                        ->GetFontCollection();
-
-  std::unique_ptr<SkStreamAsset> font_stream = std::make_unique<SkMemoryStream>(
-      font_data.data(), font_data.num_elements(), true);
-  sk_sp<SkTypeface> typeface =
-      SkTypeface::MakeFromStream(std::move(font_stream));
-  txt::TypefaceFontAssetProvider& font_provider =
-      font_collection.dynamic_font_manager_->font_provider();
-  if (family_name.empty()) {
-    font_provider.RegisterTypeface(typeface);
-  } else {
-    font_provider.RegisterTypeface(typeface, family_name);
-  }
-  font_collection.collection_->ClearFontFamilyCache();
 
+  auto* dart_state = UIDartState::Current();
+  auto ui_task_runner = dart_state->GetTaskRunners().GetUITaskRunner();
+  auto* callback_ptr = new tonic::DartPersistentValue(dart_state, callback);
+
+  // Copy the font data so that the Dart typed data can be released before the
+  // parse happens on a background worker.
+  sk_sp<SkData> typeface_data =
+      SkData::MakeWithCopy(font_data.data(), font_data.num_elements());
   font_data.Release();
-  tonic::DartInvoke(callback, {tonic::ToDart(0)});
+
+  auto ui_task = fml::MakeCopyable(
+      [callback_ptr, family_name](const sk_sp<SkTypeface>& typeface) mutable {
+        std::unique_ptr<tonic::DartPersistentValue> font_callback(callback_ptr);
+
+        auto dart_state = font_callback->dart_state().lock();
+        if (!dart_state) {
+          return;
+        }
+        tonic::DartState::Scope scope(dart_state);
+
+        FontCollection& font_collection = UIDartState::Current()
+                                              ->platform_configuration()
+                                              ->client()
+                                              ->GetFontCollection();
+        txt::TypefaceFontAssetProvider& font_provider =
+            font_collection.dynamic_font_manager_->font_provider();
+        if (family_name.empty()) {
+          font_provider.RegisterTypeface(typeface);
+        } else {
+          font_provider.RegisterTypeface(typeface, family_name);
+        }
+        font_collection.collection_->ClearFontFamilyCache();
+
+        tonic::DartInvoke(font_callback->Get(), {tonic::ToDart(0)});
+      });
+
+  // Parsing the typeface scans the tables of the entire font file and is by
+  // far the expensive part of registration, so it runs on the concurrent
+  // workers. Registration mutates the dynamic font provider that paragraph
+  // building reads, so it hops back to the UI thread along with the
+  // completion callback.
+  // Text cannot be laid out until the typeface is registered, so this rides
+  // the frame-critical lane of the worker pool.
+  dart_state->GetConcurrentTaskRunner()->PostTask(
+      [typeface_data = std::move(typeface_data),
+       ui_task_runner = std::move(ui_task_runner), ui_task] {
+        sk_sp<SkTypeface> typeface =
+            SkTypeface::MakeFromStream(SkMemoryStream::Make(typeface_data));
+        ui_task_runner->PostTask(
+            [typeface = std::move(typeface), ui_task = ui_task]() {
+              ui_task(typeface);
+            });
+      },
+      fml::TaskPriority::kFrameCritical);
 }
 
 }  // namespace flutter
@@ -59,7 +59,17 @@ bool Paragraph::didExceedMaxLines() {
 }
 
 void Paragraph::layout(double width) {
+  // The layout constraints that are not baked into the paragraph when it is
+  // built reduce to the width: max lines and the ellipsis are fixed in the
+  // paragraph style. Frameworks commonly issue storms of identical layout
+  // calls during window resizes, so skip the line breaker entirely when an
+  // already laid out paragraph is laid out again at the same width.
+  if (m_did_layout && width == m_layout_width) {
+    return;
+  }
   m_paragraph->Layout(width);
+  m_did_layout = true;
+  m_layout_width = width;
 }
 
 void Paragraph::paint(Canvas* canvas, double x, double y) {
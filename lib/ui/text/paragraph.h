@@ -56,6 +56,8 @@ class Paragraph : public RefCountedDartWrappable<Paragraph> {
 
  private:
   std::unique_ptr<txt::Paragraph> m_paragraph;
+  double m_layout_width = -1;
+  bool m_did_layout = false;
 
   explicit Paragraph(std::unique_ptr<txt::Paragraph> paragraph);
 };
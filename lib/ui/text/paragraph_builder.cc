@@ -153,7 +153,15 @@ void ParagraphBuilder::Create(Dart_Handle wrapper,
                               const std::u16string& ellipsis,
                               const std::string& locale,
                               bool applyRoundingHack) {
-  UIDartState::ThrowIfUIOperationsProhibited();
+  // Paragraphs may be built and laid out on background isolates, as long as
+  // the isolate has access to the engine's font collection.
+  if (!UIDartState::Current()->IsRootIsolate() &&
+      !UIDartState::Current()->GetFontCollection()) {
+    Dart_EnterScope();
+    Dart_ThrowException(tonic::ToDart(
+        "ParagraphBuilder is only available on isolates that are attached to "
+        "an engine."));
+  }
   auto res = fml::MakeRefCounted<ParagraphBuilder>(
       encoded_handle, strutData, fontFamily, strutFontFamilies, fontSize,
       height, ellipsis, locale, applyRoundingHack);
@@ -295,14 +303,24 @@ ParagraphBuilder::ParagraphBuilder(
   }
   style.apply_rounding_hack = applyRoundingHack;
 
-  FontCollection& font_collection = UIDartState::Current()
-                                        ->platform_configuration()
-                                        ->client()
-                                        ->GetFontCollection();
+  UIDartState* dart_state = UIDartState::Current();
+  std::shared_ptr<FontCollection> font_collection =
+      dart_state->GetFontCollection();
+  std::shared_ptr<txt::FontCollection> txt_font_collection;
+  if (font_collection) {
+    txt_font_collection = font_collection->GetFontCollection();
+  } else {
+    // Root isolates created without the engine's font collection in their
+    // context (e.g. in tests) fall back to the platform configuration.
+    txt_font_collection = dart_state->platform_configuration()
+                              ->client()
+                              ->GetFontCollection()
+                              .GetFontCollection();
+  }
 
-  auto impeller_enabled = UIDartState::Current()->IsImpellerEnabled();
+  auto impeller_enabled = dart_state->IsImpellerEnabled();
   m_paragraphBuilder = txt::ParagraphBuilder::CreateSkiaBuilder(
-      style, font_collection.GetFontCollection(), impeller_enabled);
+      style, std::move(txt_font_collection), impeller_enabled);
 }
 
 ParagraphBuilder::~ParagraphBuilder() = default;
@@ -519,6 +537,27 @@ Dart_Handle ParagraphBuilder::addText(const std::u16string& text) {
   return Dart_Null();
 }
 
+Dart_Handle ParagraphBuilder::addUtf16Text(const tonic::Uint16List& text) {
+  if (text.num_elements() == 0) {
+    return Dart_Null();
+  }
+
+  // The typed data is acquired for the duration of this call, so the code
+  // units can be validated and consumed in place without copying them out of
+  // the Dart heap.
+  const UChar* text_ptr = reinterpret_cast<const UChar*>(text.data());
+  UErrorCode error_code = U_ZERO_ERROR;
+  u_strToUTF8(nullptr, 0, nullptr, text_ptr, text.num_elements(), &error_code);
+  if (error_code != U_BUFFER_OVERFLOW_ERROR) {
+    return tonic::ToDart("string is not well-formed UTF-16");
+  }
+
+  m_paragraphBuilder->AddText(reinterpret_cast<const char16_t*>(text.data()),
+                              text.num_elements());
+
+  return Dart_Null();
+}
+
 void ParagraphBuilder::addPlaceholder(double width,
                                       double height,
                                       unsigned alignment,
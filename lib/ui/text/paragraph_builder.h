@@ -55,6 +55,11 @@ class ParagraphBuilder : public RefCountedDartWrappable<ParagraphBuilder> {
 
   Dart_Handle addText(const std::u16string& text);
 
+  // Adds UTF-16 text supplied as a typed data view. The view is acquired for
+  // the duration of the call, so the code units are consumed in place rather
+  // than being copied out of the Dart heap first.
+  Dart_Handle addUtf16Text(const tonic::Uint16List& text);
+
   // Pushes the information required to leave an open space, where Flutter may
   // draw a custom placeholder into.
   //
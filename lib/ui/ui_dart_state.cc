@@ -152,6 +152,10 @@ UIDartState::GetConcurrentTaskRunner() const {
   return context_.concurrent_task_runner;
 }
 
+const std::shared_ptr<FontCollection>& UIDartState::GetFontCollection() const {
+  return context_.font_collection;
+}
+
 void UIDartState::ScheduleMicrotask(Dart_Handle closure) {
   if (tonic::CheckAndHandleError(closure) || !Dart_IsClosure(closure)) {
     return;
@@ -27,6 +27,7 @@
 #include "third_party/tonic/dart_state.h"
 
 namespace flutter {
+class FontCollection;
 class FontSelector;
 class ImageGeneratorRegistry;
 class PlatformConfiguration;
@@ -99,6 +100,11 @@ class UIDartState : public tonic::DartState {
 
     /// Whether Impeller is enabled or not.
     bool enable_impeller = false;
+
+    /// The font collection shared by every isolate attached to the engine.
+    /// This allows background isolates to build and lay out paragraphs off
+    /// the UI thread.
+    std::shared_ptr<FontCollection> font_collection;
   };
 
   Dart_Port main_port() const { return main_port_; }
@@ -134,6 +140,11 @@ class UIDartState : public tonic::DartState {
 
   std::shared_ptr<fml::ConcurrentTaskRunner> GetConcurrentTaskRunner() const;
 
+  // The font collection for the engine this isolate is attached to, or
+  // nullptr for isolates that are not attached to an engine (e.g. the
+  // service isolate).
+  const std::shared_ptr<FontCollection>& GetFontCollection() const;
+
   fml::TaskRunnerAffineWeakPtr<SnapshotDelegate> GetSnapshotDelegate() const;
 
   fml::WeakPtr<ImageDecoder> GetImageDecoder() const;
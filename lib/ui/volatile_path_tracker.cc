@@ -39,6 +39,7 @@ void VolatilePathTracker::OnFrame() {
                                 path->frame_count++;
                                 if (path->frame_count >= kFramesOfVolatility) {
                                   path->path.setIsVolatile(false);
+                                  path->path = Intern(path->path);
                                   path->tracking_volatility = false;
                                   return true;
                                 }
@@ -47,4 +48,22 @@ void VolatilePathTracker::OnFrame() {
                paths_.end());
 }
 
+SkPath VolatilePathTracker::Intern(const SkPath& path) {
+  FML_DCHECK(ui_task_runner_->RunsTasksOnCurrentThread());
+  for (auto it = interned_paths_.begin(); it != interned_paths_.end(); it++) {
+    // Quick rejects before the full structural comparison.
+    if (it->countVerbs() != path.countVerbs() ||
+        it->countPoints() != path.countPoints() || *it != path) {
+      continue;
+    }
+    interned_paths_.splice(interned_paths_.begin(), interned_paths_, it);
+    return *it;
+  }
+  interned_paths_.push_front(path);
+  if (interned_paths_.size() > kMaxInternedPaths) {
+    interned_paths_.pop_back();
+  }
+  return path;
+}
+
 }  // namespace flutter
@@ -6,6 +6,7 @@
 #define FLUTTER_LIB_VOLATILE_PATH_TRACKER_H_
 
 #include <deque>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -47,6 +48,10 @@ class VolatilePathTracker {
 
   static constexpr int kFramesOfVolatility = 2;
 
+  /// The maximum number of devolatilized paths retained for structural
+  /// interning.
+  static constexpr size_t kMaxInternedPaths = 32;
+
   // Starts tracking a path.
   // Must be called from the UI task runner.
   //
@@ -65,8 +70,22 @@ class VolatilePathTracker {
   bool enabled() const { return enabled_; }
 
  private:
+  // Returns a path that shares its backing data with a previously
+  // devolatilized, structurally identical path, or |path| itself on a miss.
+  //
+  // The framework recreates equal paths constantly (the same icon path is
+  // typically rebuilt for every element that draws it). Sharing the backing
+  // data gives all of those copies the same generation id, so renderer caches
+  // keyed on it (cached triangulations and mask blurs) hit instead of
+  // re-tessellating each copy.
+  //
+  // Must be called from the UI task runner.
+  SkPath Intern(const SkPath& path);
+
   fml::RefPtr<fml::TaskRunner> ui_task_runner_;
   std::vector<std::weak_ptr<TrackedPath>> paths_;
+  // Recently devolatilized paths, most recently used first.
+  std::list<SkPath> interned_paths_;
   bool enabled_ = true;
 
   friend class testing::ShellTest;
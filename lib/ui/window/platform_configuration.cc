@@ -27,6 +27,24 @@ Dart_Handle ToByteData(const fml::Mapping& buffer) {
   return tonic::DartByteData::Create(buffer.GetMapping(), buffer.GetSize());
 }
 
+void FreeFinalizer(void* isolate_callback_data, void* peer) {
+  free(peer);
+}
+
+// Hands the buffer backing |mapping| to the Dart heap as external typed data
+// instead of copying it. Small payloads are still copied since an external
+// typed data object costs more GC bookkeeping than it saves.
+Dart_Handle ToByteData(fml::MallocMapping mapping) {
+  if (mapping.GetSize() < tonic::DartByteData::kExternalSizeThreshold) {
+    return tonic::DartByteData::Create(mapping.GetMapping(),
+                                       mapping.GetSize());
+  }
+  const size_t size = mapping.GetSize();
+  uint8_t* data = mapping.Release();
+  return Dart_NewExternalTypedDataWithFinalizer(
+      Dart_TypedData_kByteData, data, size, data, size, FreeFinalizer);
+}
+
 }  // namespace
 
 PlatformConfigurationClient::~PlatformConfigurationClient() {}
@@ -299,7 +317,7 @@ void PlatformConfiguration::DispatchPlatformMessage(
   }
   tonic::DartState::Scope scope(dart_state);
   Dart_Handle data_handle =
-      (message->hasData()) ? ToByteData(message->data()) : Dart_Null();
+      (message->hasData()) ? ToByteData(message->releaseData()) : Dart_Null();
   if (Dart_IsError(data_handle)) {
     FML_DLOG(WARNING)
         << "Dropping platform message because of a Dart error on channel: "
@@ -350,7 +368,7 @@ void PlatformConfiguration::DispatchSemanticsAction(int32_t node_id,
   tonic::DartState::Scope scope(dart_state);
 
   Dart_Handle args_handle =
-      (args.GetSize() <= 0) ? Dart_Null() : ToByteData(args);
+      (args.GetSize() <= 0) ? Dart_Null() : ToByteData(std::move(args));
 
   if (Dart_IsError(args_handle)) {
     return;
@@ -9,6 +9,8 @@
 //  * All comments except this one are removed.
 //  * _invokeX is replaced with engine.invokeX (X=1,2)
 //  * _printDebug is replaced with print in an assert.
+//  * _collectStats carries a lint ignore since the web engine does not
+//    register the VM service extension that reads it.
 
 part of ui;
 
@@ -35,6 +37,8 @@ class _StoredMessage {
 
   final Zone _zone;
 
+  final int _timestampMicros = DateTime.now().microsecondsSinceEpoch;
+
   void invoke(ByteData? dataArg) {
     engine.invoke1(_callback, _zone, dataArg);
   }
@@ -59,7 +63,14 @@ class _Channel {
 
   bool _draining = false;
 
+  int _pushedCount = 0;
+
+  int _discardedCount = 0;
+
+  int _maxBufferedTimeMicros = 0;
+
   bool push(_StoredMessage message) {
+    _pushedCount += 1;
     if (!_draining && _channelCallbackRecord != null) {
       assert(_queue.isEmpty);
       _channelCallbackRecord!.invoke(message.data, message.invoke);
@@ -73,13 +84,22 @@ class _Channel {
     return result;
   }
 
-  _StoredMessage pop() => _queue.removeFirst();
+  _StoredMessage pop() {
+    final _StoredMessage message = _queue.removeFirst();
+    final int buffered =
+        DateTime.now().microsecondsSinceEpoch - message._timestampMicros;
+    if (buffered > _maxBufferedTimeMicros) {
+      _maxBufferedTimeMicros = buffered;
+    }
+    return message;
+  }
 
   bool _dropOverflowMessages(int lengthLimit) {
     bool result = false;
     while (_queue.length > lengthLimit) {
       final _StoredMessage message = _queue.removeFirst();
       message.invoke(null); // send empty reply to the plugin side
+      _discardedCount += 1;
       result = true;
     }
     return result;
@@ -258,6 +278,21 @@ class ChannelBuffers {
     }());
   }
 
+  // ignore: unused_element
+  Map<String, Object?> _collectStats() {
+    return <String, Object?>{
+      for (final MapEntry<String, _Channel> entry in _channels.entries)
+        entry.key: <String, Object?>{
+          'capacity': entry.value.capacity,
+          'length': entry.value.length,
+          'hasListener': entry.value._channelCallbackRecord != null,
+          'pushedCount': entry.value._pushedCount,
+          'discardedCount': entry.value._discardedCount,
+          'maxBufferedTimeMicros': entry.value._maxBufferedTimeMicros,
+        },
+    };
+  }
+
   void sendChannelUpdate(String name, {required bool listening}) {}
 }
 
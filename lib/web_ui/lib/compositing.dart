@@ -124,4 +124,7 @@ abstract class SceneBuilder {
 
 class EngineLayer {
   void dispose() {}
+
+  /// The web engine has no raster cache; pinning is a no-op.
+  void setRasterCachePinned(bool pinned) {}
 }
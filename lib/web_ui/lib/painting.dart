@@ -861,6 +861,14 @@ abstract class FragmentProgram {
   }
 
   FragmentShader fragmentShader();
+
+  /// Precompiles this program's pipeline state so that the first [Paint]
+  /// using one of its shaders does not pause rendering while the shader
+  /// compiles.
+  ///
+  /// On the web, shaders are compiled when the program is created, so this
+  /// completes immediately.
+  Future<void> precompile() => Future<void>.value();
 }
 
 abstract class FragmentShader implements Shader {
@@ -894,6 +894,13 @@ class CkParagraphBuilder implements ui.ParagraphBuilder {
     _paragraphBuilder.addText(text);
   }
 
+  @override
+  void addUtf16Text(Uint16List text) {
+    // The web engine has no zero-copy path into the paragraph builder, so the
+    // code units are converted to a string up front.
+    addText(String.fromCharCodes(text));
+  }
+
   @override
   CkParagraph build() {
     final SkParagraph builtParagraph = _buildSkParagraph();
@@ -5,6 +5,7 @@
 import 'dart:convert';
 import 'dart:ffi';
 import 'dart:js_interop';
+import 'dart:typed_data';
 
 import 'package:ui/src/engine.dart';
 import 'package:ui/src/engine/skwasm/skwasm_impl.dart';
@@ -613,6 +614,13 @@ class SkwasmParagraphBuilder extends SkwasmObjectWrapper<RawParagraphBuilder> im
     skString16Free(stringHandle);
   }
 
+  @override
+  void addUtf16Text(Uint16List text) {
+    // The web engine has no zero-copy path into the paragraph builder, so the
+    // code units are converted to a string up front.
+    addText(String.fromCharCodes(text));
+  }
+
   static final DomV8BreakIterator _v8BreakIterator = createV8BreakIterator();
   static final DomSegmenter _graphemeSegmenter = createIntlSegmenter(granularity: 'grapheme');
   static final DomSegmenter _wordSegmenter = createIntlSegmenter(granularity: 'word');
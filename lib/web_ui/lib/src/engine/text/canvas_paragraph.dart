@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+import 'dart:typed_data';
+
 import 'package:ui/ui.dart' as ui;
 
 import '../dom.dart';
@@ -664,6 +666,13 @@ class CanvasParagraphBuilder implements ui.ParagraphBuilder {
     _spans.add(ParagraphSpan(style: style, start: start, end: end));
   }
 
+  @override
+  void addUtf16Text(Uint16List text) {
+    // The web engine has no zero-copy path into the paragraph builder, so the
+    // code units are converted to a string up front.
+    addText(String.fromCharCodes(text));
+  }
+
   void _updateCanDrawOnCanvas(EngineTextStyle style) {
     if (!_canDrawOnCanvas) {
       return;
@@ -716,6 +716,7 @@ abstract class ParagraphBuilder {
   void pushStyle(TextStyle style);
   void pop();
   void addText(String text);
+  void addUtf16Text(Uint16List text);
   Paragraph build();
   int get placeholderCount;
   List<double> get placeholderScales;
@@ -207,7 +207,8 @@ std::weak_ptr<DartIsolate> DartIsolate::CreateRootIsolate(
               context.advisory_script_entrypoint,  // advisory entrypoint
               nullptr,                             // child isolate preparer
               isolate_create_callback,             // isolate create callback
-              isolate_shutdown_callback            // isolate shutdown callback
+              isolate_shutdown_callback,           // isolate shutdown callback
+              context.font_collection              // font collection
               )));
 
   auto isolate_data = std::make_unique<std::shared_ptr<DartIsolate>>(
@@ -800,10 +801,18 @@ Dart_Isolate DartIsolate::DartCreateAndStartServiceIsolate(
     return nullptr;
   }
 
+  // A negative port keeps the HTTP server from starting automatically (see
+  // |DartServiceIsolate::Startup|); it can be started later on demand through
+  // the service protocol.
+  const intptr_t server_port = settings.defer_vm_service_server
+                                   ? -1
+                                   : static_cast<intptr_t>(
+                                         settings.vm_service_port);
+
   tonic::DartState::Scope scope(service_isolate);
   if (!DartServiceIsolate::Startup(
           settings.vm_service_host,            // server IP address
-          settings.vm_service_port,            // server VM service port
+          server_port,                         // server VM service port
           tonic::DartState::HandleLibraryTag,  // embedder library tag handler
           false,  //  disable websocket origin check
           settings.disable_service_auth_codes,  // disable VM service auth codes
@@ -890,7 +899,8 @@ Dart_Isolate DartIsolate::DartIsolateGroupCreateCallback(
               advisory_script_entrypoint,
               parent_group_data.GetChildIsolatePreparer(),
               parent_group_data.GetIsolateCreateCallback(),
-              parent_group_data.GetIsolateShutdownCallback())));
+              parent_group_data.GetIsolateShutdownCallback(),
+              parent_group_data.GetFontCollection())));
 
   TaskRunners null_task_runners(advisory_script_uri,
                                 /* platform= */ nullptr,
@@ -901,6 +911,7 @@ Dart_Isolate DartIsolate::DartIsolateGroupCreateCallback(
   UIDartState::Context context(null_task_runners);
   context.advisory_script_uri = advisory_script_uri;
   context.advisory_script_entrypoint = advisory_script_entrypoint;
+  context.font_collection = (*isolate_group_data)->GetFontCollection();
   auto isolate_data = std::make_unique<std::shared_ptr<DartIsolate>>(
       std::shared_ptr<DartIsolate>(
           new DartIsolate((*isolate_group_data)->GetSettings(),  // settings
@@ -954,6 +965,7 @@ bool DartIsolate::DartIsolateInitializeCallback(void** child_callback_data,
   context.advisory_script_uri = (*isolate_group_data)->GetAdvisoryScriptURI();
   context.advisory_script_entrypoint =
       (*isolate_group_data)->GetAdvisoryScriptEntrypoint();
+  context.font_collection = (*isolate_group_data)->GetFontCollection();
   auto embedder_isolate = std::make_unique<std::shared_ptr<DartIsolate>>(
       std::shared_ptr<DartIsolate>(
           new DartIsolate((*isolate_group_data)->GetSettings(),  // settings
@@ -18,6 +18,7 @@ namespace flutter {
 
 class DartIsolate;
 class DartSnapshot;
+class FontCollection;
 class PlatformMessageHandler;
 
 using ChildIsolatePreparer = std::function<bool(DartIsolate*)>;
@@ -36,7 +37,8 @@ class DartIsolateGroupData : public PlatformMessageHandlerStorage {
                        std::string advisory_script_entrypoint,
                        const ChildIsolatePreparer& child_isolate_preparer,
                        const fml::closure& isolate_create_callback,
-                       const fml::closure& isolate_shutdown_callback);
+                       const fml::closure& isolate_shutdown_callback,
+                       std::shared_ptr<FontCollection> font_collection);
 
   ~DartIsolateGroupData();
 
@@ -54,6 +56,12 @@ class DartIsolateGroupData : public PlatformMessageHandlerStorage {
 
   const fml::closure& GetIsolateShutdownCallback() const;
 
+  // The font collection of the engine whose root isolate created this group,
+  // or nullptr for groups that are not attached to an engine. Isolates
+  // spawned into the group inherit this so they can build and lay out
+  // paragraphs off the UI thread.
+  const std::shared_ptr<FontCollection>& GetFontCollection() const;
+
   void SetChildIsolatePreparer(const ChildIsolatePreparer& value);
 
   // |PlatformMessageHandlerStorage|
@@ -74,6 +82,7 @@ class DartIsolateGroupData : public PlatformMessageHandlerStorage {
   ChildIsolatePreparer child_isolate_preparer_;
   const fml::closure isolate_create_callback_;
   const fml::closure isolate_shutdown_callback_;
+  const std::shared_ptr<FontCollection> font_collection_;
   std::map<int64_t, std::weak_ptr<PlatformMessageHandler>>
       platform_message_handlers_;
   mutable std::mutex platform_message_handlers_mutex_;
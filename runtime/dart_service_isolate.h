@@ -43,7 +43,11 @@ class DartServiceIsolate {
   ///             created (but not running) when this call is made.
   ///
   /// @param[in]  server_ip                     The service protocol IP address.
-  /// @param[in]  server_port                   The service protocol port.
+  /// @param[in]  server_port                   The service protocol port. A
+  ///                                           negative port keeps the HTTP
+  ///                                           server from starting until it
+  ///                                           is requested through the
+  ///                                           service protocol.
   /// @param[in]  embedder_tag_handler          The library tag handler.
   /// @param[in]  disable_origin_check          If websocket origin checks must
   ///                                           be enabled.
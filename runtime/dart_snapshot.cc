@@ -264,6 +264,26 @@ bool DartSnapshot::IsDontNeedSafe() const {
   return true;
 }
 
+static void PrefetchMapping(const fml::Mapping* mapping) {
+  if (!mapping || mapping->GetMapping() == nullptr) {
+    return;
+  }
+  // Touch one byte per page. The volatile reads cannot be elided, and each
+  // one forces the kernel to fault the page in if it is not already resident.
+  static constexpr size_t kPageSize = 4096;
+  const volatile uint8_t* data = mapping->GetMapping();
+  const size_t size = mapping->GetSize();
+  for (size_t offset = 0u; offset < size; offset += kPageSize) {
+    [[maybe_unused]] uint8_t byte = data[offset];
+  }
+}
+
+void DartSnapshot::PrefetchMappings() const {
+  TRACE_EVENT0("flutter", "DartSnapshot::PrefetchMappings");
+  PrefetchMapping(data_.get());
+  PrefetchMapping(instructions_.get());
+}
+
 bool DartSnapshot::IsNullSafetyEnabled(const fml::Mapping* kernel) const {
   return ::Dart_DetectNullSafety(
       nullptr,           // script_uri (unsupported by Flutter)
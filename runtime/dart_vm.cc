@@ -290,7 +290,11 @@ DartVM::DartVM(const std::shared_ptr<const DartVMData>& vm_data,
               std::thread::hardware_concurrency()))),
       skia_concurrent_executor_(
           [runner = concurrent_message_loop_->GetTaskRunner()](
-              const fml::closure& work) { runner->PostTask(work); }),
+              const fml::closure& work) {
+            // Skia background work (e.g. path mask generation) must not
+            // starve user-visible image decodes sharing the pool.
+            runner->PostTask(work, fml::TaskPriority::kBackground);
+          }),
       vm_data_(vm_data),
       isolate_name_server_(std::move(isolate_name_server)),
       service_protocol_(std::make_shared<ServiceProtocol>()) {
@@ -91,6 +91,15 @@ DartVMRef DartVMRef::Create(const Settings& settings,
   gVMIsolateNameServer = isolate_name_server;
   gVM = vm;
 
+  // Warm the isolate snapshot on a background worker so that the first root
+  // isolate launch does not spend its time demand-paging the snapshot one
+  // fault at a time. This is most visible in add-to-app flows where a fresh
+  // engine is spun up while the user waits for a screen transition.
+  if (auto snapshot = vm->GetVMData()->GetIsolateSnapshot()) {
+    vm->GetConcurrentWorkerTaskRunner()->PostTask(
+        [snapshot = std::move(snapshot)]() { snapshot->PrefetchMappings(); });
+  }
+
   if (settings.leak_vm) {
     gVMLeak = new std::shared_ptr<DartVM>(vm);
   }
@@ -4,7 +4,10 @@
 
 #include "flutter/runtime/runtime_controller.h"
 
+#include <string>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "flutter/common/constants.h"
 #include "flutter/common/settings.h"
@@ -64,6 +67,7 @@ std::unique_ptr<RuntimeController> RuntimeController::Spawn(
       std::move(advisory_script_uri), std::move(advisory_script_entrypoint),
       context_.volatile_path_tracker, context_.concurrent_task_runner,
       context_.enable_impeller};
+  spawned_context.font_collection = context_.font_collection;
   auto result =
       std::make_unique<RuntimeController>(p_client,                      //
                                           vm_,                           //
@@ -203,6 +207,11 @@ bool RuntimeController::SetInitialLifecycleState(const std::string& data) {
 
 bool RuntimeController::SetSemanticsEnabled(bool enabled) {
   platform_data_.semantics_enabled = enabled;
+  if (!enabled) {
+    // The client discards its semantics tree when semantics are turned off;
+    // forget what was delivered so re-enabling resends every node.
+    last_delivered_semantics_nodes_.clear();
+  }
 
   if (auto* platform_configuration = GetPlatformConfigurationIfAvailable()) {
     platform_configuration->UpdateSemanticsEnabled(
@@ -265,6 +274,11 @@ bool RuntimeController::NotifyIdle(fml::TimeDelta deadline) {
     return false;
   }
 
+  // The duration of this event is the time the VM actually spent on idle
+  // work; comparing it against the granted deadline shows whether GC pauses
+  // are landing in idle slack or spilling into frame workloads.
+  TRACE_EVENT1("flutter", "RuntimeController::NotifyIdle", "deadline_us",
+               std::to_string(deadline.ToMicroseconds()));
   Dart_NotifyIdle(deadline.ToMicroseconds());
 
   // Idle notifications being in isolate scope are part of the contract.
@@ -356,8 +370,59 @@ void RuntimeController::Render(int64_t view_id, Scene* scene) {
 // |PlatformConfigurationClient|
 void RuntimeController::UpdateSemantics(SemanticsUpdate* update) {
   if (platform_data_.semantics_enabled) {
-    client_.UpdateSemantics(update->takeNodes(), update->takeActions());
+    client_.UpdateSemantics(FilterUnchangedSemanticsNodes(update->takeNodes()),
+                            update->takeActions());
+  }
+}
+
+SemanticsNodeUpdates RuntimeController::FilterUnchangedSemanticsNodes(
+    SemanticsNodeUpdates nodes) {
+  // Merge the update into the mirror, dropping nodes identical to what was
+  // already delivered.
+  for (auto it = nodes.begin(); it != nodes.end();) {
+    auto delivered = last_delivered_semantics_nodes_.find(it->first);
+    if (delivered != last_delivered_semantics_nodes_.end() &&
+        delivered->second == it->second) {
+      it = nodes.erase(it);
+      continue;
+    }
+    last_delivered_semantics_nodes_[it->first] = it->second;
+    it++;
+  }
+
+  // Clients prune nodes that are no longer reachable from the root. Prune the
+  // mirror the same way so that a node that is removed and later re-added
+  // with identical data is delivered again rather than dropped.
+  constexpr int32_t kRootSemanticsNodeId = 0;
+  std::unordered_set<int32_t> reachable;
+  std::vector<int32_t> worklist;
+  if (last_delivered_semantics_nodes_.count(kRootSemanticsNodeId) > 0) {
+    reachable.insert(kRootSemanticsNodeId);
+    worklist.push_back(kRootSemanticsNodeId);
   }
+  while (!worklist.empty()) {
+    int32_t id = worklist.back();
+    worklist.pop_back();
+    auto found = last_delivered_semantics_nodes_.find(id);
+    if (found == last_delivered_semantics_nodes_.end()) {
+      continue;
+    }
+    for (int32_t child : found->second.childrenInTraversalOrder) {
+      if (reachable.insert(child).second) {
+        worklist.push_back(child);
+      }
+    }
+  }
+  for (auto it = last_delivered_semantics_nodes_.begin();
+       it != last_delivered_semantics_nodes_.end();) {
+    if (reachable.count(it->first) == 0) {
+      it = last_delivered_semantics_nodes_.erase(it);
+    } else {
+      it++;
+    }
+  }
+
+  return nodes;
 }
 
 // |PlatformConfigurationClient|
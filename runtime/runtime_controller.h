@@ -646,11 +646,27 @@ class RuntimeController : public PlatformConfigurationClient {
   std::shared_ptr<const fml::Mapping> persistent_isolate_data_;
   UIDartState::Context context_;
   bool has_flushed_runtime_state_ = false;
+  // A mirror of the semantics tree as last delivered to the client, used to
+  // drop resent-but-unchanged nodes from updates.
+  SemanticsNodeUpdates last_delivered_semantics_nodes_;
 
   PlatformConfiguration* GetPlatformConfigurationIfAvailable();
 
   bool FlushRuntimeStateToIsolate();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Removes nodes whose data is identical to what was already
+  ///             delivered to the client. The framework dirties whole subtrees
+  ///             for inherited property changes, so updates often carry
+  ///             thousands of nodes that have not actually changed.
+  ///
+  /// @param[in]  nodes  The nodes from the current semantics update.
+  ///
+  /// @return     The update with unchanged nodes removed.
+  ///
+  SemanticsNodeUpdates FilterUnchangedSemanticsNodes(
+      SemanticsNodeUpdates nodes);
+
   // |PlatformConfigurationClient|
   std::string DefaultRouteName() override;
 
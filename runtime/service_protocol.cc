@@ -6,12 +6,15 @@
 
 #include "flutter/runtime/service_protocol.h"
 
+#include <atomic>
 #include <cstring>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
-#include <vector>
 
+#include "flutter/fml/closure.h"
 #include "flutter/fml/posix_wrappers.h"
 #include "flutter/fml/synchronization/waitable_event.h"
 #include "rapidjson/stringbuffer.h"
@@ -37,6 +40,16 @@ const std::string_view ServiceProtocol::kGetSkSLsExtensionName =
 const std::string_view
     ServiceProtocol::kEstimateRasterCacheMemoryExtensionName =
         "_flutter.estimateRasterCacheMemory";
+const std::string_view ServiceProtocol::kGetMemoryUsageExtensionName =
+    "_flutter.getMemoryUsage";
+const std::string_view ServiceProtocol::kGetAllocationMetricsExtensionName =
+    "_flutter.getAllocationMetrics";
+const std::string_view ServiceProtocol::kGetRasterCacheEntriesExtensionName =
+    "_flutter.getRasterCacheEntries";
+const std::string_view ServiceProtocol::kGetDrawStatsExtensionName =
+    "_flutter.getDrawStats";
+const std::string_view ServiceProtocol::kGetInputLatencyExtensionName =
+    "_flutter.getInputLatency";
 const std::string_view
     ServiceProtocol::kRenderFrameWithRasterStatsExtensionName =
         "_flutter.renderFrameWithRasterStats";
@@ -61,10 +74,15 @@ ServiceProtocol::ServiceProtocol()
           kGetDisplayRefreshRateExtensionName,
           kGetSkSLsExtensionName,
           kEstimateRasterCacheMemoryExtensionName,
+          kGetMemoryUsageExtensionName,
+          kGetAllocationMetricsExtensionName,
+          kGetRasterCacheEntriesExtensionName,
+          kGetDrawStatsExtensionName,
+          kGetInputLatencyExtensionName,
           kRenderFrameWithRasterStatsExtensionName,
           kReloadAssetFonts,
       }),
-      handlers_mutex_(fml::SharedMutex::Create()) {}
+      handlers_(std::make_shared<HandlerRegistry>()) {}
 
 ServiceProtocol::~ServiceProtocol() {
   ToggleHooks(false);
@@ -72,23 +90,46 @@ ServiceProtocol::~ServiceProtocol() {
 
 void ServiceProtocol::AddHandler(Handler* handler,
                                  const Handler::Description& description) {
-  fml::UniqueLock lock(*handlers_mutex_);
-  handlers_.emplace(handler, description);
+  std::scoped_lock lock(handlers_write_mutex_);
+  auto updated =
+      std::make_shared<HandlerRegistry>(*std::atomic_load(&handlers_));
+  (*updated)[handler] = description;
+  std::atomic_store(&handlers_,
+                    std::shared_ptr<const HandlerRegistry>(std::move(updated)));
 }
 
 void ServiceProtocol::RemoveHandler(Handler* handler) {
-  fml::UniqueLock lock(*handlers_mutex_);
-  handlers_.erase(handler);
+  {
+    std::scoped_lock lock(handlers_write_mutex_);
+    auto updated =
+        std::make_shared<HandlerRegistry>(*std::atomic_load(&handlers_));
+    updated->erase(handler);
+    std::atomic_store(
+        &handlers_,
+        std::shared_ptr<const HandlerRegistry>(std::move(updated)));
+  }
+  // Wait out the grace period: a dispatch that loaded an older snapshot may
+  // still be calling into the handler. New dispatches can no longer see it,
+  // and dispatches are bounded (they block only on a hop to the handler's
+  // task runner), so this terminates quickly. This mirrors the exclusive
+  // lock acquisition the previous reader-writer lock performed here.
+  while (active_dispatches_.load(std::memory_order_acquire) > 0u) {
+    std::this_thread::yield();
+  }
 }
 
 void ServiceProtocol::SetHandlerDescription(
     Handler* handler,
     const Handler::Description& description) {
-  fml::SharedLock lock(*handlers_mutex_);
-  auto it = handlers_.find(handler);
-  if (it != handlers_.end()) {
-    it->second.Store(description);
+  std::scoped_lock lock(handlers_write_mutex_);
+  auto current = std::atomic_load(&handlers_);
+  if (current->count(handler) == 0) {
+    return;
   }
+  auto updated = std::make_shared<HandlerRegistry>(*current);
+  (*updated)[handler] = description;
+  std::atomic_store(&handlers_,
+                    std::shared_ptr<const HandlerRegistry>(std::move(updated)));
 }
 
 void ServiceProtocol::ToggleHooks(bool set) {
@@ -195,9 +236,18 @@ bool ServiceProtocol::HandleMessage(std::string_view method,
     return HandleListViewsMethod(response);
   }
 
-  fml::SharedLock lock(*handlers_mutex_);
-
-  if (handlers_.empty()) {
+  // A wait-free load of the current registry snapshot. The dispatch (which
+  // blocks on a hop to the handler's task runner) no longer holds any lock
+  // that an engine lifecycle operation could contend on; RemoveHandler
+  // instead waits for the active dispatch count to settle before its caller
+  // may destroy the handler.
+  active_dispatches_.fetch_add(1u, std::memory_order_acq_rel);
+  fml::ScopedCleanupClosure decrement_active_dispatches([this]() {
+    active_dispatches_.fetch_sub(1u, std::memory_order_acq_rel);
+  });
+  auto handlers = std::atomic_load(&handlers_);
+
+  if (handlers->empty()) {
     WriteServerErrorResponse(response,
                              "There are no running service protocol handlers.");
     return false;
@@ -208,8 +258,8 @@ bool ServiceProtocol::HandleMessage(std::string_view method,
   if (view_id_param_found != params.end()) {
     auto* handler = reinterpret_cast<Handler*>(std::stoull(
         view_id_param_found->second.data() + kViewIdPrefx.size(), nullptr, 16));
-    auto handler_found = handlers_.find(handler);
-    if (handler_found != handlers_.end()) {
+    auto handler_found = handlers->find(handler);
+    if (handler_found != handlers->end()) {
       return HandleMessageOnHandler(handler, method, params, response);
     }
   }
@@ -220,7 +270,7 @@ bool ServiceProtocol::HandleMessage(std::string_view method,
   if (method == kScreenshotExtensionName ||
       method == kScreenshotSkpExtensionName ||
       method == kFlushUIThreadTasksExtensionName) {
-    return HandleMessageOnHandler(handlers_.begin()->first, method, params,
+    return HandleMessageOnHandler(handlers->begin()->first, method, params,
                                   response);
   }
 
@@ -266,13 +316,7 @@ void ServiceProtocol::Handler::Description::Write(
 
 bool ServiceProtocol::HandleListViewsMethod(
     rapidjson::Document* response) const {
-  fml::SharedLock lock(*handlers_mutex_);
-  std::vector<std::pair<intptr_t, Handler::Description>> descriptions;
-  descriptions.reserve(handlers_.size());
-  for (const auto& handler : handlers_) {
-    descriptions.emplace_back(reinterpret_cast<intptr_t>(handler.first),
-                              handler.second.Load());
-  }
+  auto handlers = std::atomic_load(&handlers_);
 
   auto& allocator = response->GetAllocator();
 
@@ -281,10 +325,9 @@ bool ServiceProtocol::HandleListViewsMethod(
   response->AddMember("type", "FlutterViewList", allocator);
 
   rapidjson::Value viewsList(rapidjson::Type::kArrayType);
-  for (const auto& description : descriptions) {
+  for (const auto& [handler, description] : *handlers) {
     rapidjson::Value view(rapidjson::Type::kObjectType);
-    description.second.Write(reinterpret_cast<Handler*>(description.first),
-                             view, allocator);
+    description.Write(handler, view, allocator);
     viewsList.PushBack(view, allocator);
   }
 
@@ -5,15 +5,16 @@
 #ifndef FLUTTER_RUNTIME_SERVICE_PROTOCOL_H_
 #define FLUTTER_RUNTIME_SERVICE_PROTOCOL_H_
 
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <string_view>
 
 #include "flutter/fml/compiler_specific.h"
 #include "flutter/fml/macros.h"
-#include "flutter/fml/synchronization/atomic_object.h"
-#include "flutter/fml/synchronization/shared_mutex.h"
 #include "flutter/fml/task_runner.h"
 #include "rapidjson/document.h"
 
@@ -29,6 +30,11 @@ class ServiceProtocol {
   static const std::string_view kGetDisplayRefreshRateExtensionName;
   static const std::string_view kGetSkSLsExtensionName;
   static const std::string_view kEstimateRasterCacheMemoryExtensionName;
+  static const std::string_view kGetMemoryUsageExtensionName;
+  static const std::string_view kGetAllocationMetricsExtensionName;
+  static const std::string_view kGetRasterCacheEntriesExtensionName;
+  static const std::string_view kGetDrawStatsExtensionName;
+  static const std::string_view kGetInputLatencyExtensionName;
   static const std::string_view kRenderFrameWithRasterStatsExtensionName;
   static const std::string_view kReloadAssetFonts;
 
@@ -76,9 +82,21 @@ class ServiceProtocol {
                              const Handler::Description& description);
 
  private:
+  using HandlerRegistry = std::map<Handler*, Handler::Description>;
+
   const std::set<std::string_view> endpoints_;
-  std::unique_ptr<fml::SharedMutex> handlers_mutex_;
-  std::map<Handler*, fml::AtomicObject<Handler::Description>> handlers_;
+  // The registry is an immutable snapshot published with an atomic store.
+  // Writers (engine lifecycle operations) clone-and-swap under this mutex;
+  // readers (service protocol message dispatch) load the snapshot without
+  // taking any lock, so diagnostics polling never contends with isolate
+  // registration.
+  std::mutex handlers_write_mutex_;
+  std::shared_ptr<const HandlerRegistry> handlers_;
+  // The number of message dispatches currently using a registry snapshot.
+  // RemoveHandler waits for this to reach zero after unpublishing a handler
+  // since older snapshots still reference the raw handler pointer. Mutable
+  // because message dispatch is const.
+  mutable std::atomic<size_t> active_dispatches_{0};
 
   [[nodiscard]] static bool HandleMessage(const char* method,
                                           const char** param_keys,
@@ -4,10 +4,14 @@
 
 #include "flutter/shell/common/animator.h"
 
+#include <algorithm>
+
 #include "flutter/common/constants.h"
 #include "flutter/flow/frame_timings.h"
+#include "flutter/fml/make_copyable.h"
 #include "flutter/fml/time/time_point.h"
 #include "flutter/fml/trace_event.h"
+#include "flutter/shell/common/replay_log.h"
 #include "third_party/dart/runtime/include/dart_tools_api.h"
 
 namespace flutter {
@@ -20,11 +24,23 @@ namespace {
 constexpr fml::TimeDelta kNotifyIdleTaskWaitTime =
     fml::TimeDelta::FromMilliseconds(51);
 
+// The number of consecutive on-time builds required before the begin-frame
+// offset is trusted, and the window over which the worst recent build
+// duration is taken as the prediction.
+constexpr size_t kBuildDurationHistorySize = 12;
+
+// Safety margin subtracted from the predicted slack so that scheduling
+// jitter and a moderately slower-than-predicted build do not push the
+// build past the raster deadline.
+constexpr fml::TimeDelta kBeginFrameOffsetMargin =
+    fml::TimeDelta::FromMilliseconds(2);
+
 }  // namespace
 
 Animator::Animator(Delegate& delegate,
                    const TaskRunners& task_runners,
-                   std::unique_ptr<VsyncWaiter> waiter)
+                   std::unique_ptr<VsyncWaiter> waiter,
+                   bool enable_latency_compensation)
     : delegate_(delegate),
       task_runners_(task_runners),
       waiter_(std::move(waiter)),
@@ -41,6 +57,7 @@ Animator::Animator(Delegate& delegate,
               : 2)),
 #endif  // SHELL_ENABLE_METAL
       pending_frame_semaphore_(1),
+      latency_compensation_enabled_(enable_latency_compensation),
       weak_factory_(this) {
 }
 
@@ -58,6 +75,13 @@ void Animator::EnqueueTraceFlowId(uint64_t trace_flow_id) {
       });
 }
 
+void Animator::NotifyInputEvent(fml::TimePoint event_timestamp) {
+  if (!oldest_pending_input_timestamp_.has_value() ||
+      event_timestamp < oldest_pending_input_timestamp_.value()) {
+    oldest_pending_input_timestamp_ = event_timestamp;
+  }
+}
+
 void Animator::BeginFrame(
     std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder) {
   // Both frame_timings_recorder_ and layer_trees_tasks_ must be empty if not
@@ -71,6 +95,18 @@ void Animator::BeginFrame(
   frame_timings_recorder_ = std::move(frame_timings_recorder);
   frame_timings_recorder_->RecordBuildStart(fml::TimePoint::Now());
 
+  if (oldest_pending_input_timestamp_.has_value()) {
+    frame_timings_recorder_->SetOldestInputTimestamp(
+        oldest_pending_input_timestamp_.value());
+    oldest_pending_input_timestamp_.reset();
+  }
+
+  if (ReplayLog::Instance().enabled()) {
+    ReplayLog::Instance().RecordVsync(
+        frame_timings_recorder_->GetVsyncStartTime(),
+        frame_timings_recorder_->GetVsyncTargetTime());
+  }
+
   size_t flow_id_count = trace_flow_ids_.size();
   std::unique_ptr<uint64_t[]> flow_ids =
       std::make_unique<uint64_t[]>(flow_id_count);
@@ -124,6 +160,10 @@ void Animator::EndFrame() {
     // The build is completed in OnAnimatorBeginFrame.
     frame_timings_recorder_->RecordBuildEnd(fml::TimePoint::Now());
 
+    if (latency_compensation_enabled_) {
+      UpdateBeginFrameOffset(*frame_timings_recorder_);
+    }
+
     delegate_.OnAnimatorUpdateLatestFrameTargetTime(
         frame_timings_recorder_->GetVsyncTargetTime());
 
@@ -176,6 +216,70 @@ void Animator::EndFrame() {
   FML_DCHECK(frame_timings_recorder_ == nullptr);
 }
 
+void Animator::BeginFrameWithOffset(
+    std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder) {
+  const fml::TimeDelta offset = begin_frame_offset_;
+  if (offset <= fml::TimeDelta::Zero()) {
+    BeginFrame(std::move(frame_timings_recorder));
+    EndFrame();
+    return;
+  }
+  // The vsync callback may itself have been delivered late; only wait out
+  // whatever portion of the offset remains.
+  const fml::TimePoint start_time =
+      frame_timings_recorder->GetVsyncStartTime() + offset;
+  const fml::TimeDelta delay = start_time - fml::TimePoint::Now();
+  if (delay <= fml::TimeDelta::Zero()) {
+    BeginFrame(std::move(frame_timings_recorder));
+    EndFrame();
+    return;
+  }
+  TRACE_EVENT0("flutter", "Animator::BeginFrameWithOffset");
+  task_runners_.GetUITaskRunner()->PostDelayedTask(
+      fml::MakeCopyable([self = weak_factory_.GetWeakPtr(),
+                         frame_timings_recorder =
+                             std::move(frame_timings_recorder)]() mutable {
+        if (!self) {
+          return;
+        }
+        self->BeginFrame(std::move(frame_timings_recorder));
+        self->EndFrame();
+      }),
+      delay);
+}
+
+void Animator::UpdateBeginFrameOffset(const FrameTimingsRecorder& recorder) {
+  const fml::TimePoint vsync_target = recorder.GetVsyncTargetTime();
+  if (recorder.GetBuildEndTime() > vsync_target) {
+    // The build overran the raster deadline; fall back to starting at
+    // vsync until a full window of on-time builds rebuilds confidence.
+    begin_frame_offset_ = fml::TimeDelta::Zero();
+    recent_build_durations_.clear();
+    return;
+  }
+  recent_build_durations_.push_back(recorder.GetBuildEndTime() -
+                                    recorder.GetBuildStartTime());
+  if (recent_build_durations_.size() < kBuildDurationHistorySize) {
+    return;
+  }
+  if (recent_build_durations_.size() > kBuildDurationHistorySize) {
+    recent_build_durations_.pop_front();
+  }
+  fml::TimeDelta worst_build;
+  for (const fml::TimeDelta& duration : recent_build_durations_) {
+    worst_build = std::max(worst_build, duration);
+  }
+  const fml::TimeDelta interval = vsync_target - recorder.GetVsyncStartTime();
+  fml::TimeDelta offset = interval - worst_build - kBeginFrameOffsetMargin;
+  // Never defer past three quarters of the interval; a single slow build
+  // after a long streak of fast ones should degrade to a late frame, not
+  // to a lost one.
+  const fml::TimeDelta max_offset =
+      fml::TimeDelta::FromMicroseconds(interval.ToMicroseconds() * 3 / 4);
+  offset = std::clamp(offset, fml::TimeDelta::Zero(), max_offset);
+  begin_frame_offset_ = offset;
+}
+
 void Animator::Render(int64_t view_id,
                       std::unique_ptr<flutter::LayerTree> layer_tree,
                       float device_pixel_ratio) {
@@ -187,10 +291,40 @@ void Animator::Render(int64_t view_id,
                                 "Animator::Render", /*flow_id_count=*/0,
                                 /*flow_ids=*/nullptr);
 
+  auto pacing = view_pacing_.find(view_id);
+  if (pacing != view_pacing_.end()) {
+    const fml::TimePoint frame_target_time =
+        frame_timings_recorder_->GetVsyncTargetTime();
+    const fml::TimeDelta interval = pacing->second.present_interval;
+    // Allow presenting up to a quarter interval early so that a vsync that
+    // is nearly in phase with the view's display does not slip the view by
+    // a whole extra stream frame.
+    const fml::TimeDelta slack =
+        fml::TimeDelta::FromMicroseconds(interval.ToMicroseconds() / 4);
+    if (frame_target_time + slack < pacing->second.next_present_time) {
+      // The view's display will not present again before its interval
+      // elapses. Drop this tree; the rasterizer keeps showing the last
+      // submitted tree for views absent from a frame.
+      return;
+    }
+    pacing->second.next_present_time = frame_target_time + interval;
+  }
+
   layer_trees_tasks_.push_back(std::make_unique<LayerTreeTask>(
       view_id, std::move(layer_tree), device_pixel_ratio));
 }
 
+void Animator::SetViewRefreshRate(int64_t view_id, double refresh_rate) {
+  if (refresh_rate <= 0) {
+    view_pacing_.erase(view_id);
+    return;
+  }
+  // Keep any existing next_present_time so that a rate change takes effect
+  // from the view's current phase instead of forcing an immediate present.
+  view_pacing_[view_id].present_interval =
+      fml::TimeDelta::FromSecondsF(1.0 / refresh_rate);
+}
+
 const std::weak_ptr<VsyncWaiter> Animator::GetVsyncWaiter() const {
   std::weak_ptr<VsyncWaiter> weak = waiter_;
   return weak;
@@ -259,8 +393,7 @@ void Animator::AwaitVSync() {
           if (self->CanReuseLastLayerTrees()) {
             self->DrawLastLayerTrees(std::move(frame_timings_recorder));
           } else {
-            self->BeginFrame(std::move(frame_timings_recorder));
-            self->EndFrame();
+            self->BeginFrameWithOffset(std::move(frame_timings_recorder));
           }
         }
       });
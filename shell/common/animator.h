@@ -6,6 +6,8 @@
 #define FLUTTER_SHELL_COMMON_ANIMATOR_H_
 
 #include <deque>
+#include <optional>
+#include <unordered_map>
 
 #include "flutter/common/task_runners.h"
 #include "flutter/flow/frame_timings.h"
@@ -47,7 +49,8 @@ class Animator final {
 
   Animator(Delegate& delegate,
            const TaskRunners& task_runners,
-           std::unique_ptr<VsyncWaiter> waiter);
+           std::unique_ptr<VsyncWaiter> waiter,
+           bool enable_latency_compensation = false);
 
   ~Animator();
 
@@ -65,6 +68,20 @@ class Animator final {
               std::unique_ptr<flutter::LayerTree> layer_tree,
               float device_pixel_ratio);
 
+  //--------------------------------------------------------------------------
+  /// @brief    Informs the animator of the refresh rate of the display a view
+  ///           is presented on. When several views share the vsync stream
+  ///           driving this animator, a view on a slower display is only
+  ///           rendered on the vsyncs that line up with its own present
+  ///           interval instead of at the full stream rate, so the fastest
+  ///           view no longer drags the others into lockstep. Pass
+  ///           `kUnknownDisplayRefreshRate` to render the view on every
+  ///           frame again.
+  ///
+  ///           Must be called on the UI task runner.
+  ///
+  void SetViewRefreshRate(int64_t view_id, double refresh_rate);
+
   const std::weak_ptr<VsyncWaiter> GetVsyncWaiter() const;
 
   //--------------------------------------------------------------------------
@@ -90,6 +107,17 @@ class Animator final {
   // rendering.
   void EnqueueTraceFlowId(uint64_t trace_flow_id);
 
+  //--------------------------------------------------------------------------
+  /// @brief    Notes the platform timestamp of an input event so the next
+  ///           frame built can be attributed to it. The oldest pending
+  ///           timestamp is stamped onto that frame's timings recorder,
+  ///           from which input-to-present latency is derived at raster
+  ///           end.
+  ///
+  ///           Must be called on the UI task runner.
+  ///
+  void NotifyInputEvent(fml::TimePoint event_timestamp);
+
  private:
   // Animator's work during a vsync is split into two methods, BeginFrame and
   // EndFrame. The two methods should be called synchronously back-to-back to
@@ -99,6 +127,18 @@ class Animator final {
   void BeginFrame(std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder);
   void EndFrame();
 
+  // Runs BeginFrame and EndFrame, delayed past vsync by the current
+  // adaptive offset when latency compensation is enabled. Starting frame
+  // production later makes the build sample fresher input, as long as it
+  // still completes before the raster deadline.
+  void BeginFrameWithOffset(
+      std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder);
+
+  // Re-derives the begin-frame offset from the build duration of the
+  // frame that just ended. A build that overran the vsync target resets
+  // the offset to zero until enough on-time frames rebuild confidence.
+  void UpdateBeginFrameOffset(const FrameTimingsRecorder& recorder);
+
   bool CanReuseLastLayerTrees();
 
   void DrawLastLayerTrees(
@@ -125,6 +165,24 @@ class Animator final {
   std::deque<uint64_t> trace_flow_ids_;
   bool has_rendered_ = false;
 
+  // The platform timestamp of the oldest input event dispatched since the
+  // last frame was built; consumed by the next BeginFrame. UI thread only.
+  std::optional<fml::TimePoint> oldest_pending_input_timestamp_;
+
+  // Per-view frame pacing, keyed by view ID; UI thread only. A view whose
+  // display refreshes slower than the vsync stream driving this animator is
+  // only rendered once its own present interval has elapsed.
+  struct ViewPacing {
+    fml::TimeDelta present_interval;
+    fml::TimePoint next_present_time;
+  };
+  std::unordered_map<int64_t, ViewPacing> view_pacing_;
+
+  // Latency compensation state; UI thread only.
+  const bool latency_compensation_enabled_;
+  fml::TimeDelta begin_frame_offset_;
+  std::deque<fml::TimeDelta> recent_build_durations_;
+
   fml::WeakPtrFactory<Animator> weak_factory_;
 
   friend class testing::ShellTest;
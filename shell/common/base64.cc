@@ -4,10 +4,19 @@
 
 #include "flutter/shell/common/base64.h"
 
+#include "flutter/fml/build_config.h"
 #include "flutter/fml/logging.h"
 
 #include <cstdint>
 
+#if defined(FML_ARCH_CPU_ARM64) && defined(__ARM_NEON)
+#define BASE64_USE_NEON 1
+#include <arm_neon.h>
+#elif defined(FML_ARCH_CPU_X86_FAMILY) && defined(__SSSE3__)
+#define BASE64_USE_SSSE3 1
+#include <tmmintrin.h>
+#endif
+
 #define DecodePad -2
 #define EncodePad 64
 
@@ -23,6 +32,105 @@ static const signed char kDecodeData[] = {
     -1, -1, -1,        -1, -1, -1, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
     36, 37, 38,        39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51};
 
+#if defined(BASE64_USE_NEON)
+// Encodes 48 source bytes into 64 base64 characters per iteration. The 64
+// entry alphabet fits exactly into four NEON q-registers, so the 6-bit
+// indices can be translated with a single vqtbl4q lookup each. Returns the
+// number of source bytes consumed, always a multiple of 48.
+static size_t EncodeChunksVectorized(const unsigned char* src,
+                                     size_t length,
+                                     unsigned char* dst) {
+  uint8x16x4_t alphabet;
+  alphabet.val[0] = vld1q_u8(reinterpret_cast<const uint8_t*>(kDefaultEncode));
+  alphabet.val[1] =
+      vld1q_u8(reinterpret_cast<const uint8_t*>(kDefaultEncode) + 16);
+  alphabet.val[2] =
+      vld1q_u8(reinterpret_cast<const uint8_t*>(kDefaultEncode) + 32);
+  alphabet.val[3] =
+      vld1q_u8(reinterpret_cast<const uint8_t*>(kDefaultEncode) + 48);
+
+  size_t consumed = 0;
+  while (length - consumed >= 48) {
+    // Deinterleave so that val[0..2] hold the first, second and third byte
+    // of each 3-byte group.
+    uint8x16x3_t in = vld3q_u8(src + consumed);
+    uint8x16_t a = in.val[0];
+    uint8x16_t b = in.val[1];
+    uint8x16_t c = in.val[2];
+
+    uint8x16x4_t out;
+    out.val[0] = vshrq_n_u8(a, 2);
+    out.val[1] = vorrq_u8(vshlq_n_u8(vandq_u8(a, vdupq_n_u8(0x03)), 4),
+                          vshrq_n_u8(b, 4));
+    out.val[2] = vorrq_u8(vshlq_n_u8(vandq_u8(b, vdupq_n_u8(0x0F)), 2),
+                          vshrq_n_u8(c, 6));
+    out.val[3] = vandq_u8(c, vdupq_n_u8(0x3F));
+
+    out.val[0] = vqtbl4q_u8(alphabet, out.val[0]);
+    out.val[1] = vqtbl4q_u8(alphabet, out.val[1]);
+    out.val[2] = vqtbl4q_u8(alphabet, out.val[2]);
+    out.val[3] = vqtbl4q_u8(alphabet, out.val[3]);
+
+    vst4q_u8(dst, out);
+    dst += 64;
+    consumed += 48;
+  }
+  return consumed;
+}
+#elif defined(BASE64_USE_SSSE3)
+// Encodes 12 source bytes into 16 base64 characters per iteration using
+// Wojciech Mula's SSSE3 algorithm: a byte shuffle places each 3-byte group
+// in its own 32-bit lane, multiply-by-shift instructions split out the four
+// 6-bit indices, and the indices are translated by adding a per-range
+// alphabet offset selected with pshufb. Each iteration loads 16 bytes but
+// consumes only 12, so the loop stops while a full register load stays in
+// bounds; the scalar loop finishes the tail. Returns the number of source
+// bytes consumed, always a multiple of 12.
+static size_t EncodeChunksVectorized(const unsigned char* src,
+                                     size_t length,
+                                     unsigned char* dst) {
+  // clang-format off
+  const __m128i shuffle = _mm_set_epi8(10, 11, 9, 10,
+                                       7, 8, 6, 7,
+                                       4, 5, 3, 4,
+                                       1, 2, 0, 1);
+  const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52,
+                                        '0' - 52, '0' - 52, '0' - 52,
+                                        '0' - 52, '0' - 52, '0' - 52,
+                                        '0' - 52, '0' - 52, '+' - 62,
+                                        '/' - 63, 'A', 0, 0);
+  // clang-format on
+
+  size_t consumed = 0;
+  while (length - consumed >= 16) {
+    __m128i in = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(src + consumed));
+    in = _mm_shuffle_epi8(in, shuffle);
+
+    // Extract the high [aaaaaa|bb] and low [bbbb|cccc] index pairs of each
+    // group into the odd and even bytes of the 16-bit lanes.
+    const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(t1, t3);
+
+    // Reduce each 6-bit index to the offset-table slot for its alphabet
+    // range, then add the selected offset to the index itself.
+    __m128i slots = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    slots = _mm_or_si128(slots, _mm_and_si128(less, _mm_set1_epi8(13)));
+    const __m128i encoded =
+        _mm_add_epi8(_mm_shuffle_epi8(offsets, slots), indices);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), encoded);
+    dst += 16;
+    consumed += 12;
+  }
+  return consumed;
+}
+#endif
+
 namespace flutter {
 
 Base64::Error Base64::Decode(const void* srcv,
@@ -123,6 +231,16 @@ size_t Base64::Encode(const void* srcv, size_t length, void* dstv) {
   const char* encode = kDefaultEncode;
   size_t remainder = length % 3;
   char unsigned const* const end = &src[length - remainder];
+#if defined(BASE64_USE_NEON) || defined(BASE64_USE_SSSE3)
+  {
+    // Bulk-encode as much as possible with SIMD; the scalar loop below
+    // finishes whatever tail the vectorized path leaves behind.
+    const size_t consumed =
+        EncodeChunksVectorized(src, length - remainder, dst);
+    src += consumed;
+    dst += consumed / 3 * 4;
+  }
+#endif
   while (src < end) {
     unsigned a = *src++;
     unsigned b = *src++;
@@ -59,6 +59,30 @@ TEST(Base64, EncodeBytes) {
        "Hy8/T19vf4+fr7/P3+/w==");
 }
 
+TEST(Base64, EncodeDecodeRoundTripAtEveryLength) {
+  // Exercises the vectorized bulk encoder and its handoff to the scalar
+  // tail at every alignment, including lengths below the SIMD block size.
+  for (size_t length = 0; length <= 150; length++) {
+    std::vector<uint8_t> input(length);
+    for (size_t i = 0; i < length; i++) {
+      input[i] = static_cast<uint8_t>(i * 7 + length);
+    }
+    std::string encoded(Base64::EncodedSize(length), '\0');
+    size_t encoded_len = Base64::Encode(input.data(), length, encoded.data());
+    ASSERT_EQ(encoded_len, encoded.size()) << length;
+
+    std::vector<char> decoded(length + 4);
+    size_t decoded_len = 0;
+    auto err = Base64::Decode(encoded.c_str(), encoded_len, decoded.data(),
+                              &decoded_len);
+    ASSERT_EQ(err, Base64::Error::kNone) << length;
+    ASSERT_EQ(decoded_len, length);
+    for (size_t i = 0; i < length; i++) {
+      ASSERT_EQ(static_cast<uint8_t>(decoded[i]), input[i]) << length << i;
+    }
+  }
+}
+
 TEST(Base64, DecodeStringsSuccess) {
   auto test = [](const std::string& input, const std::string& output) {
     char buffer[256];
@@ -22,6 +22,16 @@ double DisplayManager::GetMainDisplayRefreshRate() const {
   }
 }
 
+double DisplayManager::GetDisplayRefreshRate(DisplayId display_id) const {
+  std::scoped_lock lock(displays_mutex_);
+  for (const auto& display : displays_) {
+    if (display->GetDisplayId() == display_id) {
+      return display->GetRefreshRate();
+    }
+  }
+  return kUnknownDisplayRefreshRate;
+}
+
 void DisplayManager::HandleDisplayUpdates(
     std::vector<std::unique_ptr<Display>> displays) {
   FML_DCHECK(!displays.empty());
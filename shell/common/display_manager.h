@@ -27,6 +27,10 @@ class DisplayManager {
   /// `kUnknownDisplayRefreshRate`.
   double GetMainDisplayRefreshRate() const;
 
+  /// Returns the refresh rate of the display with the given `DisplayId`, or
+  /// `kUnknownDisplayRefreshRate` if no such display is registered.
+  double GetDisplayRefreshRate(DisplayId display_id) const;
+
   /// Handles the display updates.
   void HandleDisplayUpdates(std::vector<std::unique_ptr<Display>> displays);
 
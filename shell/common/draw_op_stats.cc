@@ -0,0 +1,300 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/draw_op_stats.h"
+
+#include <algorithm>
+
+#include "flutter/flow/layers/container_layer.h"
+#include "flutter/flow/layers/display_list_layer.h"
+
+namespace flutter {
+
+const char* DrawOpStats::GetOpKindName(OpKind kind) {
+  switch (kind) {
+    case OpKind::kSave:
+      return "save";
+    case OpKind::kSaveLayer:
+      return "saveLayer";
+    case OpKind::kDrawColor:
+      return "drawColor";
+    case OpKind::kDrawPaint:
+      return "drawPaint";
+    case OpKind::kDrawLine:
+      return "drawLine";
+    case OpKind::kDrawRect:
+      return "drawRect";
+    case OpKind::kDrawOval:
+      return "drawOval";
+    case OpKind::kDrawCircle:
+      return "drawCircle";
+    case OpKind::kDrawRRect:
+      return "drawRRect";
+    case OpKind::kDrawDRRect:
+      return "drawDRRect";
+    case OpKind::kDrawPath:
+      return "drawPath";
+    case OpKind::kDrawArc:
+      return "drawArc";
+    case OpKind::kDrawPoints:
+      return "drawPoints";
+    case OpKind::kDrawVertices:
+      return "drawVertices";
+    case OpKind::kDrawImage:
+      return "drawImage";
+    case OpKind::kDrawImageRect:
+      return "drawImageRect";
+    case OpKind::kDrawImageNine:
+      return "drawImageNine";
+    case OpKind::kDrawAtlas:
+      return "drawAtlas";
+    case OpKind::kDrawDisplayList:
+      return "drawDisplayList";
+    case OpKind::kDrawTextBlob:
+      return "drawTextBlob";
+    case OpKind::kDrawTextFrame:
+      return "drawTextFrame";
+    case OpKind::kDrawShadow:
+      return "drawShadow";
+  }
+  return "unknown";
+}
+
+void DrawOpStats::Collect(const LayerTree& layer_tree) {
+  CollectLayer(layer_tree.root_layer());
+}
+
+void DrawOpStats::Collect(const DisplayList& display_list) {
+  stats_.total_op_count += display_list.op_count(true);
+  stats_.total_bytes += display_list.bytes(true);
+  display_list.Dispatch(*this);
+}
+
+void DrawOpStats::CollectLayer(const Layer* layer) {
+  if (layer == nullptr) {
+    return;
+  }
+  if (const DisplayListLayer* dl_layer = layer->as_display_list_layer()) {
+    if (dl_layer->display_list()) {
+      Collect(*dl_layer->display_list());
+    }
+  }
+  if (const ContainerLayer* container = layer->as_container_layer()) {
+    for (const auto& child : container->layers()) {
+      CollectLayer(child.get());
+    }
+  }
+}
+
+void DrawOpStats::CountOp(OpKind kind) {
+  stats_.op_counts[static_cast<size_t>(kind)]++;
+}
+
+void DrawOpStats::CountDraw(OpKind kind, bool will_draw) {
+  CountOp(kind);
+  if (!will_draw) {
+    stats_.transparent_op_count++;
+  }
+}
+
+void DrawOpStats::setColor(DlColor color) {
+  will_draw_ = !color.isTransparent();
+}
+
+void DrawOpStats::setColorSource(const DlColorSource* source) {
+  if (!source) {
+    return;
+  }
+  const DlColorColorSource* color_source = source->asColor();
+  if (color_source && color_source->color().isTransparent()) {
+    will_draw_ = false;
+    return;
+  }
+  will_draw_ = true;
+}
+
+void DrawOpStats::save() {
+  CountOp(OpKind::kSave);
+  save_stack_.push_back(false);
+}
+
+void DrawOpStats::saveLayer(const SkRect* bounds,
+                            const SaveLayerOptions options,
+                            const DlImageFilter* backdrop) {
+  CountOp(OpKind::kSaveLayer);
+  save_layer_depth_++;
+  size_t bucket = std::min<size_t>(save_layer_depth_ - 1,
+                                   kSaveLayerDepthBuckets - 1);
+  stats_.save_layer_depth_histogram[bucket]++;
+  save_stack_.push_back(true);
+}
+
+void DrawOpStats::restore() {
+  if (save_stack_.empty()) {
+    return;
+  }
+  if (save_stack_.back()) {
+    save_layer_depth_--;
+  }
+  save_stack_.pop_back();
+}
+
+void DrawOpStats::drawColor(DlColor color, DlBlendMode mode) {
+  CountDraw(OpKind::kDrawColor, !color.isTransparent());
+}
+
+void DrawOpStats::drawPaint() {
+  CountDraw(OpKind::kDrawPaint, will_draw_);
+}
+
+void DrawOpStats::drawLine(const SkPoint& p0, const SkPoint& p1) {
+  CountDraw(OpKind::kDrawLine, will_draw_);
+}
+
+void DrawOpStats::drawRect(const SkRect& rect) {
+  CountDraw(OpKind::kDrawRect, will_draw_);
+}
+
+void DrawOpStats::drawOval(const SkRect& bounds) {
+  CountDraw(OpKind::kDrawOval, will_draw_);
+}
+
+void DrawOpStats::drawCircle(const SkPoint& center, SkScalar radius) {
+  CountDraw(OpKind::kDrawCircle, will_draw_);
+}
+
+void DrawOpStats::drawRRect(const SkRRect& rrect) {
+  CountDraw(OpKind::kDrawRRect, will_draw_);
+}
+
+void DrawOpStats::drawDRRect(const SkRRect& outer, const SkRRect& inner) {
+  CountDraw(OpKind::kDrawDRRect, will_draw_);
+}
+
+void DrawOpStats::drawPath(const SkPath& path) {
+  CountDraw(OpKind::kDrawPath, will_draw_);
+}
+
+void DrawOpStats::drawArc(const SkRect& oval_bounds,
+                          SkScalar start_degrees,
+                          SkScalar sweep_degrees,
+                          bool use_center) {
+  CountDraw(OpKind::kDrawArc, will_draw_);
+}
+
+void DrawOpStats::drawPoints(PointMode mode,
+                             uint32_t count,
+                             const SkPoint points[]) {
+  CountDraw(OpKind::kDrawPoints, will_draw_);
+}
+
+void DrawOpStats::drawVertices(const DlVertices* vertices, DlBlendMode mode) {
+  CountDraw(OpKind::kDrawVertices, will_draw_);
+}
+
+// Like DlOpSpy, image ops are assumed to draw non-transparent pixels;
+// examining the image contents would be too slow for a per-frame tally.
+void DrawOpStats::drawImage(const sk_sp<DlImage> image,
+                            const SkPoint point,
+                            DlImageSampling sampling,
+                            bool render_with_attributes) {
+  CountDraw(OpKind::kDrawImage, true);
+}
+
+void DrawOpStats::drawImageRect(const sk_sp<DlImage> image,
+                                const SkRect& src,
+                                const SkRect& dst,
+                                DlImageSampling sampling,
+                                bool render_with_attributes,
+                                SrcRectConstraint constraint) {
+  CountDraw(OpKind::kDrawImageRect, true);
+}
+
+void DrawOpStats::drawImageNine(const sk_sp<DlImage> image,
+                                const SkIRect& center,
+                                const SkRect& dst,
+                                DlFilterMode filter,
+                                bool render_with_attributes) {
+  CountDraw(OpKind::kDrawImageNine, true);
+}
+
+void DrawOpStats::drawAtlas(const sk_sp<DlImage> atlas,
+                            const SkRSXform xform[],
+                            const SkRect tex[],
+                            const DlColor colors[],
+                            int count,
+                            DlBlendMode mode,
+                            DlImageSampling sampling,
+                            const SkRect* cull_rect,
+                            bool render_with_attributes) {
+  CountDraw(OpKind::kDrawAtlas, true);
+}
+
+void DrawOpStats::drawDisplayList(const sk_sp<DisplayList> display_list,
+                                  SkScalar opacity) {
+  CountOp(OpKind::kDrawDisplayList);
+  // The nested ops were already counted towards total_op_count and
+  // total_bytes by the enclosing Collect call; only the per-op tallies and
+  // depth tracking need the nested dispatch.
+  display_list->Dispatch(*this);
+}
+
+void DrawOpStats::drawTextBlob(const sk_sp<SkTextBlob> blob,
+                               SkScalar x,
+                               SkScalar y) {
+  CountDraw(OpKind::kDrawTextBlob, will_draw_);
+}
+
+void DrawOpStats::drawTextFrame(
+    const std::shared_ptr<impeller::TextFrame>& text_frame,
+    SkScalar x,
+    SkScalar y) {
+  CountDraw(OpKind::kDrawTextFrame, will_draw_);
+}
+
+void DrawOpStats::drawShadow(const SkPath& path,
+                             const DlColor color,
+                             const SkScalar elevation,
+                             bool transparent_occluder,
+                             SkScalar dpr) {
+  CountDraw(OpKind::kDrawShadow, !color.isTransparent());
+}
+
+void DrawStatsAggregator::Clear() {
+  frames_ = {};
+  next_frame_ = 0;
+  frame_count_ = 0;
+}
+
+void DrawStatsAggregator::AddFrame(const DrawOpStats::FrameStats& stats) {
+  frames_[next_frame_] = stats;
+  next_frame_ = (next_frame_ + 1) % kWindowFrames;
+  frame_count_ = std::min(frame_count_ + 1, kWindowFrames);
+}
+
+DrawStatsAggregator::Summary DrawStatsAggregator::Summarize() const {
+  Summary summary;
+  summary.frame_count = frame_count_;
+  for (size_t i = 0; i < frame_count_; i++) {
+    const DrawOpStats::FrameStats& frame = frames_[i];
+    for (size_t op = 0; op < DrawOpStats::kOpKindCount; op++) {
+      summary.op_counts[op] += frame.op_counts[op];
+    }
+    summary.transparent_op_count += frame.transparent_op_count;
+    for (size_t bucket = 0; bucket < DrawOpStats::kSaveLayerDepthBuckets;
+         bucket++) {
+      summary.save_layer_depth_histogram[bucket] +=
+          frame.save_layer_depth_histogram[bucket];
+    }
+    summary.total_op_count += frame.total_op_count;
+    summary.total_bytes += frame.total_bytes;
+    uint32_t save_layers = frame.op_counts[static_cast<size_t>(
+        DrawOpStats::OpKind::kSaveLayer)];
+    summary.max_save_layers_in_frame =
+        std::max(summary.max_save_layers_in_frame, save_layers);
+  }
+  return summary;
+}
+
+}  // namespace flutter
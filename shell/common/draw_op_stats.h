@@ -0,0 +1,241 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_DRAW_OP_STATS_H_
+#define FLUTTER_SHELL_COMMON_DRAW_OP_STATS_H_
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "flutter/display_list/dl_op_receiver.h"
+#include "flutter/display_list/utils/dl_receiver_utils.h"
+#include "flutter/flow/layers/layer_tree.h"
+#include "flutter/fml/macros.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// Receives the drawing commands of a frame's display lists and tallies
+/// per-op-type counts, a saveLayer nesting depth histogram, and the number
+/// of ops issued while the current paint is fully transparent (the same
+/// transparency tracking as |DlOpSpy|). One instance covers one frame: feed
+/// it every layer tree rendered by the frame via |Collect| and read
+/// |frame_stats| afterwards.
+///
+/// Clip and transform ops are not tallied; they are cheap relative to the
+/// drawing and layer ops that fleet telemetry watches.
+///
+class DrawOpStats final : public virtual DlOpReceiver,
+                          private IgnoreAttributeDispatchHelper,
+                          private IgnoreClipDispatchHelper,
+                          private IgnoreTransformDispatchHelper {
+ public:
+  enum class OpKind {
+    kSave,
+    kSaveLayer,
+    kDrawColor,
+    kDrawPaint,
+    kDrawLine,
+    kDrawRect,
+    kDrawOval,
+    kDrawCircle,
+    kDrawRRect,
+    kDrawDRRect,
+    kDrawPath,
+    kDrawArc,
+    kDrawPoints,
+    kDrawVertices,
+    kDrawImage,
+    kDrawImageRect,
+    kDrawImageNine,
+    kDrawAtlas,
+    kDrawDisplayList,
+    kDrawTextBlob,
+    kDrawTextFrame,
+    kDrawShadow,
+  };
+
+  static constexpr size_t kOpKindCount =
+      static_cast<size_t>(OpKind::kDrawShadow) + 1;
+
+  // saveLayer depth buckets 1 through 7; the last bucket collects every
+  // deeper nesting.
+  static constexpr size_t kSaveLayerDepthBuckets = 8;
+
+  struct FrameStats {
+    std::array<uint32_t, kOpKindCount> op_counts = {};
+
+    /// Ops issued while the current paint could not modify the destination
+    /// (DlOpSpy-style transparency tracking); wasted work candidates.
+    uint32_t transparent_op_count = 0;
+
+    /// save_layer_depth_histogram[i] counts saveLayers entered at nesting
+    /// depth i + 1 (counting only enclosing saveLayers, not plain saves).
+    std::array<uint32_t, kSaveLayerDepthBuckets> save_layer_depth_histogram =
+        {};
+
+    /// Total ops and bytes of the collected display lists, including
+    /// nested lists.
+    uint32_t total_op_count = 0;
+    uint64_t total_bytes = 0;
+  };
+
+  DrawOpStats() = default;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The stable name used for |kind| in service protocol
+  ///             responses; matches the |DlOpReceiver| method name.
+  ///
+  static const char* GetOpKindName(OpKind kind);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Tallies every display list reachable from the layer tree.
+  ///
+  void Collect(const LayerTree& layer_tree);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Tallies one display list, including nested lists.
+  ///
+  void Collect(const DisplayList& display_list);
+
+  const FrameStats& frame_stats() const { return stats_; }
+
+ private:
+  void CollectLayer(const Layer* layer);
+
+  void CountOp(OpKind kind);
+
+  // Counts a drawing op, attributing it to the transparent tally when the
+  // current paint cannot modify the destination.
+  void CountDraw(OpKind kind, bool will_draw);
+
+  void setColor(DlColor color) override;
+  void setColorSource(const DlColorSource* source) override;
+  void save() override;
+  void saveLayer(const SkRect* bounds,
+                 const SaveLayerOptions options,
+                 const DlImageFilter* backdrop) override;
+  void restore() override;
+  void drawColor(DlColor color, DlBlendMode mode) override;
+  void drawPaint() override;
+  void drawLine(const SkPoint& p0, const SkPoint& p1) override;
+  void drawRect(const SkRect& rect) override;
+  void drawOval(const SkRect& bounds) override;
+  void drawCircle(const SkPoint& center, SkScalar radius) override;
+  void drawRRect(const SkRRect& rrect) override;
+  void drawDRRect(const SkRRect& outer, const SkRRect& inner) override;
+  void drawPath(const SkPath& path) override;
+  void drawArc(const SkRect& oval_bounds,
+               SkScalar start_degrees,
+               SkScalar sweep_degrees,
+               bool use_center) override;
+  void drawPoints(PointMode mode,
+                  uint32_t count,
+                  const SkPoint points[]) override;
+  void drawVertices(const DlVertices* vertices, DlBlendMode mode) override;
+  void drawImage(const sk_sp<DlImage> image,
+                 const SkPoint point,
+                 DlImageSampling sampling,
+                 bool render_with_attributes) override;
+  void drawImageRect(
+      const sk_sp<DlImage> image,
+      const SkRect& src,
+      const SkRect& dst,
+      DlImageSampling sampling,
+      bool render_with_attributes,
+      SrcRectConstraint constraint = SrcRectConstraint::kFast) override;
+  void drawImageNine(const sk_sp<DlImage> image,
+                     const SkIRect& center,
+                     const SkRect& dst,
+                     DlFilterMode filter,
+                     bool render_with_attributes) override;
+  void drawAtlas(const sk_sp<DlImage> atlas,
+                 const SkRSXform xform[],
+                 const SkRect tex[],
+                 const DlColor colors[],
+                 int count,
+                 DlBlendMode mode,
+                 DlImageSampling sampling,
+                 const SkRect* cull_rect,
+                 bool render_with_attributes) override;
+  void drawDisplayList(const sk_sp<DisplayList> display_list,
+                       SkScalar opacity = SK_Scalar1) override;
+  void drawTextBlob(const sk_sp<SkTextBlob> blob,
+                    SkScalar x,
+                    SkScalar y) override;
+  void drawTextFrame(const std::shared_ptr<impeller::TextFrame>& text_frame,
+                     SkScalar x,
+                     SkScalar y) override;
+  void drawShadow(const SkPath& path,
+                  const DlColor color,
+                  const SkScalar elevation,
+                  bool transparent_occluder,
+                  SkScalar dpr) override;
+
+  FrameStats stats_;
+  bool will_draw_ = true;
+
+  // Entries record whether the matching save was a saveLayer so restore()
+  // can maintain the saveLayer nesting depth.
+  std::vector<bool> save_stack_;
+  uint32_t save_layer_depth_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DrawOpStats);
+};
+
+//------------------------------------------------------------------------------
+/// A rolling window of per-frame |DrawOpStats::FrameStats|, owned by the
+/// |Rasterizer| and fed from |Rasterizer::DoDraw| when enabled. The window
+/// summary backs the _flutter.getDrawStats service protocol extension so
+/// fleet telemetry can watch op mix shifts (e.g. a release doubling its
+/// saveLayers) without pulling traces.
+///
+/// Collection is opt-in and off by default; all access happens on the
+/// raster task runner.
+///
+class DrawStatsAggregator {
+ public:
+  static constexpr size_t kWindowFrames = 120;
+
+  struct Summary {
+    size_t frame_count = 0;
+    std::array<uint64_t, DrawOpStats::kOpKindCount> op_counts = {};
+    uint64_t transparent_op_count = 0;
+    std::array<uint64_t, DrawOpStats::kSaveLayerDepthBuckets>
+        save_layer_depth_histogram = {};
+    uint64_t total_op_count = 0;
+    uint64_t total_bytes = 0;
+    /// The largest single-frame saveLayer count in the window.
+    uint32_t max_save_layers_in_frame = 0;
+  };
+
+  DrawStatsAggregator() = default;
+
+  void SetEnabled(bool enabled) { enabled_ = enabled; }
+
+  bool enabled() const { return enabled_; }
+
+  void Clear();
+
+  void AddFrame(const DrawOpStats::FrameStats& stats);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Sums the retained frames, oldest frames dropping out once
+  ///             the window holds |kWindowFrames| entries.
+  ///
+  Summary Summarize() const;
+
+ private:
+  bool enabled_ = false;
+  std::array<DrawOpStats::FrameStats, kWindowFrames> frames_;
+  size_t next_frame_ = 0;
+  size_t frame_count_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DrawStatsAggregator);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_DRAW_OP_STATS_H_
@@ -0,0 +1,129 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/draw_op_stats.h"
+
+#include "flutter/display_list/display_list.h"
+#include "flutter/display_list/dl_builder.h"
+#include "flutter/testing/testing.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+uint32_t CountOf(const DrawOpStats::FrameStats& stats,
+                 DrawOpStats::OpKind kind) {
+  return stats.op_counts[static_cast<size_t>(kind)];
+}
+
+}  // namespace
+
+TEST(DrawOpStats, CountsOpsPerType) {
+  DisplayListBuilder builder;
+  DlPaint paint;
+  builder.DrawRect(SkRect::MakeWH(10, 10), paint);
+  builder.DrawRect(SkRect::MakeWH(20, 20), paint);
+  builder.DrawLine(SkPoint::Make(0, 0), SkPoint::Make(10, 10), paint);
+  builder.DrawCircle(SkPoint::Make(5, 5), 5, paint);
+  sk_sp<DisplayList> dl = builder.Build();
+
+  DrawOpStats stats;
+  stats.Collect(*dl);
+
+  const DrawOpStats::FrameStats& frame = stats.frame_stats();
+  EXPECT_EQ(CountOf(frame, DrawOpStats::OpKind::kDrawRect), 2u);
+  EXPECT_EQ(CountOf(frame, DrawOpStats::OpKind::kDrawLine), 1u);
+  EXPECT_EQ(CountOf(frame, DrawOpStats::OpKind::kDrawCircle), 1u);
+  EXPECT_EQ(CountOf(frame, DrawOpStats::OpKind::kDrawOval), 0u);
+  EXPECT_EQ(frame.total_op_count, dl->op_count(true));
+  EXPECT_EQ(frame.total_bytes, dl->bytes(true));
+}
+
+TEST(DrawOpStats, SaveLayerDepthHistogramTracksNesting) {
+  DisplayListBuilder builder;
+  DlPaint paint;
+  builder.SaveLayer(nullptr, &paint);
+  builder.DrawRect(SkRect::MakeWH(10, 10), paint);
+  builder.SaveLayer(nullptr, &paint);
+  builder.DrawRect(SkRect::MakeWH(5, 5), paint);
+  builder.Restore();
+  builder.Restore();
+  // A plain save does not contribute to the saveLayer depth.
+  builder.Save();
+  builder.SaveLayer(nullptr, &paint);
+  builder.DrawRect(SkRect::MakeWH(2, 2), paint);
+  builder.Restore();
+  builder.Restore();
+  sk_sp<DisplayList> dl = builder.Build();
+
+  DrawOpStats stats;
+  stats.Collect(*dl);
+
+  const DrawOpStats::FrameStats& frame = stats.frame_stats();
+  EXPECT_EQ(CountOf(frame, DrawOpStats::OpKind::kSaveLayer), 3u);
+  EXPECT_EQ(frame.save_layer_depth_histogram[0], 2u);
+  EXPECT_EQ(frame.save_layer_depth_histogram[1], 1u);
+  EXPECT_EQ(frame.save_layer_depth_histogram[2], 0u);
+}
+
+TEST(DrawOpStats, CountsTransparentOps) {
+  DisplayListBuilder builder;
+  // The builder culls transparent srcOver draws outright; a transparent
+  // kSrc draw survives culling but still cannot add visible content, which
+  // is exactly what the transparent-op tally is meant to flag.
+  DlPaint transparent_paint(DlColor::kTransparent());
+  transparent_paint.setBlendMode(DlBlendMode::kSrc);
+  builder.DrawRect(SkRect::MakeWH(10, 10), transparent_paint);
+  builder.DrawRect(SkRect::MakeWH(10, 10), DlPaint(DlColor::kBlack()));
+  sk_sp<DisplayList> dl = builder.Build();
+
+  DrawOpStats stats;
+  stats.Collect(*dl);
+
+  const DrawOpStats::FrameStats& frame = stats.frame_stats();
+  EXPECT_EQ(CountOf(frame, DrawOpStats::OpKind::kDrawRect), 2u);
+  EXPECT_EQ(frame.transparent_op_count, 1u);
+}
+
+TEST(DrawStatsAggregator, SummarizesRollingWindow) {
+  DrawStatsAggregator aggregator;
+  aggregator.SetEnabled(true);
+
+  DrawOpStats::FrameStats frame;
+  frame.op_counts[static_cast<size_t>(DrawOpStats::OpKind::kSaveLayer)] = 2;
+  frame.total_op_count = 10;
+  aggregator.AddFrame(frame);
+
+  frame.op_counts[static_cast<size_t>(DrawOpStats::OpKind::kSaveLayer)] = 5;
+  aggregator.AddFrame(frame);
+
+  DrawStatsAggregator::Summary summary = aggregator.Summarize();
+  EXPECT_EQ(summary.frame_count, 2u);
+  EXPECT_EQ(summary.op_counts[static_cast<size_t>(
+                DrawOpStats::OpKind::kSaveLayer)],
+            7u);
+  EXPECT_EQ(summary.total_op_count, 20u);
+  EXPECT_EQ(summary.max_save_layers_in_frame, 5u);
+
+  aggregator.Clear();
+  EXPECT_EQ(aggregator.Summarize().frame_count, 0u);
+}
+
+TEST(DrawStatsAggregator, WindowDropsOldestFrames) {
+  DrawStatsAggregator aggregator;
+
+  DrawOpStats::FrameStats frame;
+  frame.total_op_count = 1;
+  for (size_t i = 0; i < DrawStatsAggregator::kWindowFrames + 30; i++) {
+    aggregator.AddFrame(frame);
+  }
+
+  DrawStatsAggregator::Summary summary = aggregator.Summarize();
+  EXPECT_EQ(summary.frame_count, DrawStatsAggregator::kWindowFrames);
+  EXPECT_EQ(summary.total_op_count, DrawStatsAggregator::kWindowFrames);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -17,6 +17,7 @@
 #include "flutter/lib/ui/text/font_collection.h"
 #include "flutter/shell/common/animator.h"
 #include "flutter/shell/common/platform_view.h"
+#include "flutter/shell/common/replay_log.h"
 #include "flutter/shell/common/shell.h"
 #include "rapidjson/document.h"
 #include "third_party/dart/runtime/include/dart_tools_api.h"
@@ -31,9 +32,17 @@ static constexpr char kSettingsChannel[] = "flutter/settings";
 static constexpr char kIsolateChannel[] = "flutter/isolate";
 
 namespace {
+
+// The idle window granted to the VM when the application is backgrounded. No
+// frames are forthcoming in that state, so the VM is free to run collections
+// that would otherwise pause an animation frame.
+constexpr fml::TimeDelta kBackgroundedNotifyIdleDuration =
+    fml::TimeDelta::FromMilliseconds(500);
+
 fml::MallocMapping MakeMapping(const std::string& str) {
   return fml::MallocMapping::Copy(str.c_str(), str.length());
 }
+
 }  // namespace
 
 Engine::Engine(
@@ -85,6 +94,20 @@ Engine::Engine(Delegate& delegate,
              std::make_shared<FontCollection>(),
              nullptr,
              gpu_disabled_switch) {
+  UIDartState::Context ui_dart_state_context{
+      task_runners_,                           // task runners
+      std::move(snapshot_delegate),            // snapshot delegate
+      std::move(io_manager),                   // io manager
+      std::move(unref_queue),                  // Skia unref queue
+      image_decoder_->GetWeakPtr(),            // image decoder
+      image_generator_registry_.GetWeakPtr(),  // image generator registry
+      settings_.advisory_script_uri,           // advisory script uri
+      settings_.advisory_script_entrypoint,    // advisory script entrypoint
+      std::move(volatile_path_tracker),        // volatile path tracker
+      vm.GetConcurrentWorkerTaskRunner(),      // concurrent task runner
+      settings_.enable_impeller,               // enable impeller
+  };
+  ui_dart_state_context.font_collection = font_collection_;
   runtime_controller_ = std::make_unique<RuntimeController>(
       *this,                                 // runtime delegate
       &vm,                                   // VM
@@ -94,19 +117,7 @@ Engine::Engine(Delegate& delegate,
       settings_.isolate_create_callback,     // isolate create callback
       settings_.isolate_shutdown_callback,   // isolate shutdown callback
       settings_.persistent_isolate_data,     // persistent isolate data
-      UIDartState::Context{
-          task_runners_,                           // task runners
-          std::move(snapshot_delegate),            // snapshot delegate
-          std::move(io_manager),                   // io manager
-          std::move(unref_queue),                  // Skia unref queue
-          image_decoder_->GetWeakPtr(),            // image decoder
-          image_generator_registry_.GetWeakPtr(),  // image generator registry
-          settings_.advisory_script_uri,           // advisory script uri
-          settings_.advisory_script_entrypoint,    // advisory script entrypoint
-          std::move(volatile_path_tracker),        // volatile path tracker
-          vm.GetConcurrentWorkerTaskRunner(),      // concurrent task runner
-          settings_.enable_impeller,               // enable impeller
-      });
+      std::move(ui_dart_state_context));
 }
 
 std::unique_ptr<Engine> Engine::Spawn(
@@ -306,8 +317,15 @@ void Engine::SetViewportMetrics(int64_t view_id,
   ScheduleFrame();
 }
 
+void Engine::SetViewRefreshRate(int64_t view_id, double refresh_rate) {
+  animator_->SetViewRefreshRate(view_id, refresh_rate);
+}
+
 void Engine::DispatchPlatformMessage(std::unique_ptr<PlatformMessage> message) {
   std::string channel = message->channel();
+  if (ReplayLog::Instance().enabled()) {
+    ReplayLog::Instance().RecordPlatformMessage(channel);
+  }
   if (channel == kLifecycleChannel) {
     if (HandleLifecyclePlatformMessage(message.get())) {
       return;
@@ -345,6 +363,12 @@ bool Engine::HandleLifecyclePlatformMessage(PlatformMessage* message) {
   if (state == "AppLifecycleState.resumed" ||
       state == "AppLifecycleState.inactive") {
     ScheduleFrame();
+  } else if (state == "AppLifecycleState.paused") {
+    // Give the VM a generous idle window while the application is
+    // backgrounded. Old generation collections that run now will not show up
+    // as pauses attributed to a frame once the application is resumed.
+    NotifyIdle(fml::TimeDelta::FromMicroseconds(Dart_TimelineGetMicros()) +
+               kBackgroundedNotifyIdleDuration);
   }
   runtime_controller_->SetInitialLifecycleState(state);
   // Always forward these messages to the framework by returning false.
@@ -430,6 +454,21 @@ void Engine::DispatchPointerDataPacket(
                              /*flow_id_count=*/1,
                              /*flow_ids=*/&trace_flow_id);
   TRACE_FLOW_STEP("flutter", "PointerEvent", trace_flow_id);
+
+  // Stamp the animator with the oldest event timestamp in the packet so the
+  // next frame built can report input-to-present latency.
+  int64_t oldest_micros = 0;
+  for (size_t i = 0; i < packet->GetLength(); i++) {
+    const int64_t time_stamp = packet->GetPointerData(i).time_stamp;
+    if (time_stamp > 0 && (oldest_micros == 0 || time_stamp < oldest_micros)) {
+      oldest_micros = time_stamp;
+    }
+  }
+  if (oldest_micros > 0) {
+    animator_->NotifyInputEvent(fml::TimePoint::FromEpochDelta(
+        fml::TimeDelta::FromMicroseconds(oldest_micros)));
+  }
+
   pointer_data_dispatcher_->DispatchPacket(std::move(packet), trace_flow_id);
 }
 
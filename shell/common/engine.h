@@ -744,6 +744,17 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
   ///
   void SetViewportMetrics(int64_t view_id, const ViewportMetrics& metrics);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Updates the refresh rate of the display a view is presented
+  ///             on. The animator uses this for per-view frame pacing when
+  ///             multiple views run off one vsync stream.
+  ///
+  /// @param[in]  view_id       The ID of the view.
+  /// @param[in]  refresh_rate  The display's refresh rate in frames per
+  ///                           second, or `kUnknownDisplayRefreshRate`.
+  ///
+  void SetViewRefreshRate(int64_t view_id, double refresh_rate);
+
   //----------------------------------------------------------------------------
   /// @brief      Updates the display metrics for the currently running Flutter
   ///             application.
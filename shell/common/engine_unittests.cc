@@ -382,6 +382,38 @@ TEST_F(EngineTest, DispatchPlatformMessageUnknown) {
   });
 }
 
+TEST_F(EngineTest, PausedLifecycleMessageNotifiesIdle) {
+  PostUITaskSync([this] {
+    MockRuntimeDelegate client;
+    auto mock_runtime_controller =
+        std::make_unique<MockRuntimeController>(client, task_runners_);
+    EXPECT_CALL(*mock_runtime_controller, IsRootIsolateRunning())
+        .WillRepeatedly(::testing::Return(false));
+    EXPECT_CALL(*mock_runtime_controller, NotifyIdle(::testing::_))
+        .WillOnce(::testing::Return(true));
+    auto engine = std::make_unique<Engine>(
+        /*delegate=*/delegate_,
+        /*dispatcher_maker=*/dispatcher_maker_,
+        /*image_decoder_task_runner=*/image_decoder_task_runner_,
+        /*task_runners=*/task_runners_,
+        /*settings=*/settings_,
+        /*animator=*/std::move(animator_),
+        /*io_manager=*/io_manager_,
+        /*font_collection=*/std::make_shared<FontCollection>(),
+        /*runtime_controller=*/std::move(mock_runtime_controller),
+        /*gpu_disabled_switch=*/std::make_shared<fml::SyncSwitch>());
+
+    fml::RefPtr<PlatformMessageResponse> response =
+        fml::MakeRefCounted<MockResponse>();
+    const std::string state = "AppLifecycleState.paused";
+    std::unique_ptr<PlatformMessage> message =
+        std::make_unique<PlatformMessage>(
+            "flutter/lifecycle",
+            fml::MallocMapping::Copy(state.c_str(), state.length()), response);
+    engine->DispatchPlatformMessage(std::move(message));
+  });
+}
+
 TEST_F(EngineTest, DispatchPlatformMessageInitialRoute) {
   PostUITaskSync([this] {
     MockRuntimeDelegate client;
@@ -0,0 +1,99 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/frame_pacing_governor.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+FramePacingGovernor::FramePacingGovernor() = default;
+
+FramePacingGovernor::~FramePacingGovernor() = default;
+
+void FramePacingGovernor::RecordFrame(fml::TimeDelta frame_interval,
+                                      fml::TimeDelta frame_duration) {
+  if (frame_interval <= fml::TimeDelta::Zero()) {
+    return;
+  }
+
+  std::scoped_lock lock(mutex_);
+  durations_.push_back(frame_duration);
+  while (durations_.size() > kWindowSize) {
+    durations_.pop_front();
+  }
+
+  auto budget = [&frame_interval](uint32_t divisor) {
+    return fml::TimeDelta::FromNanoseconds(static_cast<int64_t>(
+        frame_interval.ToNanoseconds() * divisor * kBudgetHeadroomFraction));
+  };
+
+  auto predicted = PredictFrameDuration();
+  uint32_t needed = 1;
+  while (needed < kMaxCadenceDivisor && predicted > budget(needed)) {
+    needed++;
+  }
+
+  if (needed > cadence_divisor_) {
+    // A miss is predicted at the current cadence. Drop to the stable lower
+    // rate immediately; the very next vsync decision uses it.
+    TRACE_EVENT_INSTANT0("flutter", "FramePacingCadenceLowered");
+    cadence_divisor_ = needed;
+    vsyncs_until_frame_ = 0;
+    frames_fitting_faster_cadence_ = 0;
+    return;
+  }
+
+  if (cadence_divisor_ > 1) {
+    // Only raise the cadence after a sustained run of frames that fit the
+    // faster budget with headroom. A single fast frame must not flap the
+    // rate back up just to miss again.
+    if (frame_duration <= budget(cadence_divisor_ - 1)) {
+      frames_fitting_faster_cadence_++;
+      if (frames_fitting_faster_cadence_ >= kPromotionFrames) {
+        TRACE_EVENT_INSTANT0("flutter", "FramePacingCadenceRaised");
+        cadence_divisor_--;
+        vsyncs_until_frame_ = 0;
+        frames_fitting_faster_cadence_ = 0;
+      }
+    } else {
+      frames_fitting_faster_cadence_ = 0;
+    }
+  }
+}
+
+bool FramePacingGovernor::ShouldProduceFrame() {
+  std::scoped_lock lock(mutex_);
+  if (cadence_divisor_ <= 1) {
+    return true;
+  }
+  if (vsyncs_until_frame_ > 0) {
+    vsyncs_until_frame_--;
+    return false;
+  }
+  vsyncs_until_frame_ = cadence_divisor_ - 1;
+  return true;
+}
+
+uint32_t FramePacingGovernor::GetCadenceDivisor() const {
+  std::scoped_lock lock(mutex_);
+  return cadence_divisor_;
+}
+
+fml::TimeDelta FramePacingGovernor::PredictFrameDuration() const {
+  // The 90th percentile of the window: insensitive to a single outlier in
+  // either direction but still representative of a sustained slowdown.
+  std::vector<fml::TimeDelta> sorted(durations_.begin(), durations_.end());
+  size_t index = sorted.size() * 9 / 10;
+  if (index >= sorted.size()) {
+    index = sorted.size() - 1;
+  }
+  std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+  return sorted[index];
+}
+
+}  // namespace flutter
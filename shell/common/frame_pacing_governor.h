@@ -0,0 +1,101 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_FRAME_PACING_GOVERNOR_H_
+#define FLUTTER_SHELL_COMMON_FRAME_PACING_GOVERNOR_H_
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_delta.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      Chooses a stable frame cadence from rolling frame durations.
+///
+///             When frames take longer than a vsync interval, letting every
+///             frame race its own deadline produces oscillating frame times
+///             (120/90/120 on thermal throttling) that look worse to users
+///             than a stable lower rate. The governor tracks a rolling window
+///             of measured frame durations and, when the typical duration is
+///             predicted to miss the deadline, switches the engine to the
+///             nearest submultiple of the display rate that the durations fit
+///             (every second vsync for 120 -> 60, and so on).
+///
+///             Lowering the cadence is immediate once a miss is predicted.
+///             Raising it back requires a sustained run of frames that fit
+///             the faster budget with headroom, so that a cadence change is
+///             never flapped by a single fast or slow frame.
+///
+///             Frames are recorded on the raster task runner and cadence
+///             decisions are made on the platform-specific vsync callback
+///             thread; the governor is internally synchronized.
+class FramePacingGovernor {
+ public:
+  /// The number of recent frames considered when predicting the duration of
+  /// the next frame.
+  static constexpr size_t kWindowSize = 20;
+
+  /// The number of consecutive frames that must fit the next faster cadence
+  /// with headroom before the cadence is raised.
+  static constexpr size_t kPromotionFrames = 60;
+
+  /// The deepest cadence division applied. One quarter of the display rate
+  /// is the slowest stable rate worth holding; beyond that the app is better
+  /// served by racing deadlines than by a 30Hz-on-120Hz crawl.
+  static constexpr uint32_t kMaxCadenceDivisor = 4;
+
+  FramePacingGovernor();
+
+  ~FramePacingGovernor();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Records a completed frame. Called on the raster task runner
+  ///             after each rasterized frame.
+  ///
+  /// @param[in]  frame_interval  The display's vsync interval.
+  /// @param[in]  frame_duration  Vsync start to raster finish for the frame.
+  ///
+  void RecordFrame(fml::TimeDelta frame_interval,
+                   fml::TimeDelta frame_duration);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Decides whether the vsync that just fired should produce a
+  ///             frame. Returns false when the vsync should be skipped so
+  ///             that frames land on a stable submultiple of the display
+  ///             rate. Always returns true at full cadence.
+  ///
+  bool ShouldProduceFrame();
+
+  //----------------------------------------------------------------------------
+  /// @brief      The currently selected cadence divisor: one when every
+  ///             vsync produces a frame, two when every second vsync does,
+  ///             and so on.
+  ///
+  uint32_t GetCadenceDivisor() const;
+
+ private:
+  // A frame counts as fitting a budget if it leaves this much of the budget
+  // unused, so cadence changes in either direction have hysteresis.
+  static constexpr double kBudgetHeadroomFraction = 0.9;
+
+  mutable std::mutex mutex_;
+  std::deque<fml::TimeDelta> durations_;
+  uint32_t cadence_divisor_ = 1;
+  uint32_t vsyncs_until_frame_ = 0;
+  size_t frames_fitting_faster_cadence_ = 0;
+
+  // Returns a high percentile of the rolling window as the predicted
+  // duration of the next frame.
+  fml::TimeDelta PredictFrameDuration() const;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(FramePacingGovernor);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_FRAME_PACING_GOVERNOR_H_
@@ -0,0 +1,93 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/frame_pacing_governor.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+constexpr fml::TimeDelta kInterval120Hz =
+    fml::TimeDelta::FromMicroseconds(8333);
+
+void RecordFrames(FramePacingGovernor& governor,
+                  size_t count,
+                  fml::TimeDelta duration) {
+  for (size_t i = 0; i < count; i++) {
+    governor.RecordFrame(kInterval120Hz, duration);
+  }
+}
+
+}  // namespace
+
+TEST(FramePacingGovernorTest, StaysAtFullCadenceWhenFramesFit) {
+  FramePacingGovernor governor;
+  RecordFrames(governor, FramePacingGovernor::kWindowSize,
+               fml::TimeDelta::FromMilliseconds(5));
+  EXPECT_EQ(governor.GetCadenceDivisor(), 1u);
+  EXPECT_TRUE(governor.ShouldProduceFrame());
+  EXPECT_TRUE(governor.ShouldProduceFrame());
+}
+
+TEST(FramePacingGovernorTest, LowersCadenceWhenMissPredicted) {
+  FramePacingGovernor governor;
+  // Sustained ~11ms frames cannot hold 120Hz but fit 60Hz comfortably.
+  RecordFrames(governor, FramePacingGovernor::kWindowSize,
+               fml::TimeDelta::FromMilliseconds(11));
+  EXPECT_EQ(governor.GetCadenceDivisor(), 2u);
+
+  // Frames land on every second vsync.
+  EXPECT_TRUE(governor.ShouldProduceFrame());
+  EXPECT_FALSE(governor.ShouldProduceFrame());
+  EXPECT_TRUE(governor.ShouldProduceFrame());
+  EXPECT_FALSE(governor.ShouldProduceFrame());
+}
+
+TEST(FramePacingGovernorTest, SingleOutlierDoesNotLowerCadence) {
+  FramePacingGovernor governor;
+  RecordFrames(governor, FramePacingGovernor::kWindowSize - 1,
+               fml::TimeDelta::FromMilliseconds(5));
+  governor.RecordFrame(kInterval120Hz, fml::TimeDelta::FromMilliseconds(30));
+  EXPECT_EQ(governor.GetCadenceDivisor(), 1u);
+}
+
+TEST(FramePacingGovernorTest, SingleFastFrameDoesNotRaiseCadence) {
+  FramePacingGovernor governor;
+  RecordFrames(governor, FramePacingGovernor::kWindowSize,
+               fml::TimeDelta::FromMilliseconds(11));
+  ASSERT_EQ(governor.GetCadenceDivisor(), 2u);
+
+  // One fast frame amid continued slow ones must not flap the rate back up.
+  governor.RecordFrame(kInterval120Hz, fml::TimeDelta::FromMilliseconds(5));
+  EXPECT_EQ(governor.GetCadenceDivisor(), 2u);
+  RecordFrames(governor, 5, fml::TimeDelta::FromMilliseconds(11));
+  EXPECT_EQ(governor.GetCadenceDivisor(), 2u);
+}
+
+TEST(FramePacingGovernorTest, RaisesCadenceAfterSustainedHeadroom) {
+  FramePacingGovernor governor;
+  RecordFrames(governor, FramePacingGovernor::kWindowSize,
+               fml::TimeDelta::FromMilliseconds(11));
+  ASSERT_EQ(governor.GetCadenceDivisor(), 2u);
+
+  RecordFrames(governor, FramePacingGovernor::kPromotionFrames,
+               fml::TimeDelta::FromMilliseconds(5));
+  EXPECT_EQ(governor.GetCadenceDivisor(), 1u);
+  EXPECT_TRUE(governor.ShouldProduceFrame());
+  EXPECT_TRUE(governor.ShouldProduceFrame());
+}
+
+TEST(FramePacingGovernorTest, CadenceDoesNotExceedMaximumDivisor) {
+  FramePacingGovernor governor;
+  RecordFrames(governor, FramePacingGovernor::kWindowSize,
+               fml::TimeDelta::FromMilliseconds(200));
+  EXPECT_EQ(governor.GetCadenceDivisor(),
+            FramePacingGovernor::kMaxCadenceDivisor);
+}
+
+}  // namespace testing
+}  // namespace flutter
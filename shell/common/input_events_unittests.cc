@@ -74,7 +74,14 @@ static void TestSimulatedInputEvents(
   auto nativeOnPointerDataPacket = [&events_consumed_at_frame,
                                     &will_draw_new_frame, &events_consumed,
                                     &frame_drawn](Dart_NativeArguments args) {
-    events_consumed += 1;
+    // A single callback may report multiple events as
+    // `SmoothPointerDataDispatcher` coalesces packets received during one
+    // frame into a single packet.
+    Dart_Handle exception = nullptr;
+    events_consumed +=
+        tonic::DartConverter<std::vector<int64_t>>::FromArguments(args, 0,
+                                                                  exception)
+            .size();
     if (will_draw_new_frame) {
       frame_drawn += 1;
       will_draw_new_frame = false;
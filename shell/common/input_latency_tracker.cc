@@ -0,0 +1,65 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/input_latency_tracker.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace flutter {
+
+namespace {
+
+int64_t PercentileOf(const std::vector<int64_t>& sorted, double percentile) {
+  if (sorted.empty()) {
+    return 0;
+  }
+  size_t index = static_cast<size_t>(percentile * (sorted.size() - 1));
+  return sorted[index];
+}
+
+}  // namespace
+
+void InputLatencyTracker::AddSample(fml::TimeDelta latency) {
+  // Clock skew between the platform's event timestamps and the frame clock
+  // can produce nonsense negatives; drop them rather than skew percentiles.
+  if (latency < fml::TimeDelta::Zero()) {
+    return;
+  }
+  samples_micros_[next_sample_] = latency.ToMicroseconds();
+  next_sample_ = (next_sample_ + 1) % kMaxSamples;
+  if (sample_count_ < kMaxSamples) {
+    sample_count_++;
+  }
+}
+
+void InputLatencyTracker::Clear() {
+  next_sample_ = 0;
+  sample_count_ = 0;
+}
+
+InputLatencyTracker::Summary InputLatencyTracker::Summarize() const {
+  Summary summary;
+  summary.sample_count = sample_count_;
+  if (sample_count_ == 0) {
+    return summary;
+  }
+
+  std::vector<int64_t> sorted(samples_micros_.begin(),
+                              samples_micros_.begin() + sample_count_);
+  std::sort(sorted.begin(), sorted.end());
+
+  int64_t total = 0;
+  for (int64_t sample : sorted) {
+    total += sample;
+  }
+  summary.average_micros = total / static_cast<int64_t>(sample_count_);
+  summary.p50_micros = PercentileOf(sorted, 0.50);
+  summary.p90_micros = PercentileOf(sorted, 0.90);
+  summary.p99_micros = PercentileOf(sorted, 0.99);
+  summary.max_micros = sorted.back();
+  return summary;
+}
+
+}  // namespace flutter
@@ -0,0 +1,63 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_INPUT_LATENCY_TRACKER_H_
+#define FLUTTER_SHELL_COMMON_INPUT_LATENCY_TRACKER_H_
+
+#include <array>
+#include <cstdint>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_delta.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      A rolling window of input-to-present latency samples. One
+///             instance lives on the |Rasterizer| and is fed from
+///             |Rasterizer::DoDraw| whenever a rasterized frame carries an
+///             input timestamp on its timings recorder. The percentile
+///             summary backs the _flutter.getInputLatency service protocol
+///             extension so scrolling-latency SLOs can be measured in the
+///             field instead of with a camera rig.
+///
+///             All access happens on the raster task runner.
+///
+class InputLatencyTracker {
+ public:
+  static constexpr size_t kMaxSamples = 512;
+
+  struct Summary {
+    size_t sample_count = 0;
+    int64_t average_micros = 0;
+    int64_t p50_micros = 0;
+    int64_t p90_micros = 0;
+    int64_t p99_micros = 0;
+    int64_t max_micros = 0;
+  };
+
+  InputLatencyTracker() = default;
+
+  void AddSample(fml::TimeDelta latency);
+
+  void Clear();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Computes percentiles over the retained samples, oldest
+  ///             samples dropping out once the window holds |kMaxSamples|
+  ///             entries.
+  ///
+  Summary Summarize() const;
+
+ private:
+  std::array<int64_t, kMaxSamples> samples_micros_;
+  size_t next_sample_ = 0;
+  size_t sample_count_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(InputLatencyTracker);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_INPUT_LATENCY_TRACKER_H_
@@ -0,0 +1,63 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/input_latency_tracker.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(InputLatencyTrackerTest, EmptyTrackerSummarizesToZeros) {
+  InputLatencyTracker tracker;
+  const auto summary = tracker.Summarize();
+  EXPECT_EQ(summary.sample_count, 0u);
+  EXPECT_EQ(summary.average_micros, 0);
+  EXPECT_EQ(summary.p50_micros, 0);
+  EXPECT_EQ(summary.p99_micros, 0);
+  EXPECT_EQ(summary.max_micros, 0);
+}
+
+TEST(InputLatencyTrackerTest, ComputesPercentilesOverSamples) {
+  InputLatencyTracker tracker;
+  // 1ms through 100ms in 1ms steps.
+  for (int64_t i = 1; i <= 100; i++) {
+    tracker.AddSample(fml::TimeDelta::FromMilliseconds(i));
+  }
+
+  const auto summary = tracker.Summarize();
+  EXPECT_EQ(summary.sample_count, 100u);
+  EXPECT_EQ(summary.average_micros, 50500);
+  EXPECT_EQ(summary.p50_micros, 50000);
+  EXPECT_EQ(summary.p90_micros, 90000);
+  EXPECT_EQ(summary.p99_micros, 99000);
+  EXPECT_EQ(summary.max_micros, 100000);
+}
+
+TEST(InputLatencyTrackerTest, DropsNegativeSamples) {
+  InputLatencyTracker tracker;
+  tracker.AddSample(fml::TimeDelta::FromMilliseconds(-5));
+  EXPECT_EQ(tracker.Summarize().sample_count, 0u);
+}
+
+TEST(InputLatencyTrackerTest, WindowDropsOldestSamples) {
+  InputLatencyTracker tracker;
+  for (size_t i = 0; i < InputLatencyTracker::kMaxSamples + 10; i++) {
+    tracker.AddSample(fml::TimeDelta::FromMicroseconds(i));
+  }
+  const auto summary = tracker.Summarize();
+  EXPECT_EQ(summary.sample_count, InputLatencyTracker::kMaxSamples);
+  EXPECT_EQ(summary.max_micros,
+            static_cast<int64_t>(InputLatencyTracker::kMaxSamples) + 9);
+}
+
+TEST(InputLatencyTrackerTest, ClearEmptiesTheWindow) {
+  InputLatencyTracker tracker;
+  tracker.AddSample(fml::TimeDelta::FromMilliseconds(8));
+  tracker.Clear();
+  EXPECT_EQ(tracker.Summarize().sample_count, 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -0,0 +1,116 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/memory_dashboard.h"
+
+#include <algorithm>
+
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+MemoryDashboard::MemoryDashboard() = default;
+
+MemoryDashboard::~MemoryDashboard() = default;
+
+size_t MemoryDashboard::RegisterSubsystem(
+    std::string name,
+    MemoryTrimStage trim_stage,
+    fml::RefPtr<fml::TaskRunner> task_runner,
+    Meter meter,
+    TrimCallback trim) {
+  std::scoped_lock lock(mutex_);
+  size_t handle = next_handle_++;
+  subsystems_[handle] = {std::move(name), trim_stage, std::move(task_runner),
+                         std::move(meter), std::move(trim)};
+  return handle;
+}
+
+void MemoryDashboard::UnregisterSubsystem(size_t handle) {
+  std::scoped_lock lock(mutex_);
+  subsystems_.erase(handle);
+}
+
+MemoryTrimStage MemoryDashboard::NotifyMemoryPressure() {
+  TRACE_EVENT0("flutter", "MemoryDashboard::NotifyMemoryPressure");
+
+  struct PendingTrim {
+    fml::RefPtr<fml::TaskRunner> task_runner;
+    TrimCallback trim;
+  };
+
+  MemoryTrimStage stage = MemoryTrimStage::kCaches;
+  std::vector<PendingTrim> pending;
+  {
+    std::scoped_lock lock(mutex_);
+    auto now = fml::TimePoint::Now();
+    if (last_pressure_time_.has_value() &&
+        now - last_pressure_time_.value() < kEscalationWindow) {
+      stage = static_cast<MemoryTrimStage>(std::min<uint32_t>(
+          static_cast<uint32_t>(last_stage_) + 1u,
+          static_cast<uint32_t>(MemoryTrimStage::kGPUPools)));
+    }
+    last_pressure_time_ = now;
+    last_stage_ = stage;
+
+    // Collect eligible subsystems cheapest stage first so that, within a
+    // task runner, inexpensive caches are dropped before atlases and pools.
+    for (uint32_t current = 0; current <= static_cast<uint32_t>(stage);
+         current++) {
+      for (const auto& [handle, subsystem] : subsystems_) {
+        if (static_cast<uint32_t>(subsystem.trim_stage) == current) {
+          pending.push_back({subsystem.task_runner, subsystem.trim});
+        }
+      }
+    }
+  }
+
+  for (auto& trim : pending) {
+    trim.task_runner->PostTask(
+        [callback = std::move(trim.trim), stage]() { callback(stage); });
+  }
+
+  return stage;
+}
+
+std::vector<MemoryDashboard::SubsystemMetrics> MemoryDashboard::GetMetrics()
+    const {
+  // Meters are invoked outside the lock so a meter that takes its own locks
+  // cannot deadlock against concurrent registration.
+  struct PendingMeter {
+    std::string name;
+    MemoryTrimStage trim_stage;
+    Meter meter;
+  };
+  std::vector<PendingMeter> meters;
+  {
+    std::scoped_lock lock(mutex_);
+    meters.reserve(subsystems_.size());
+    for (const auto& [handle, subsystem] : subsystems_) {
+      meters.push_back({subsystem.name, subsystem.trim_stage,
+                        subsystem.meter});
+    }
+  }
+
+  std::vector<SubsystemMetrics> metrics;
+  metrics.reserve(meters.size());
+  for (const auto& meter : meters) {
+    metrics.push_back({meter.name, meter.trim_stage, meter.meter()});
+  }
+  return metrics;
+}
+
+const char* MemoryDashboard::StageName(MemoryTrimStage stage) {
+  switch (stage) {
+    case MemoryTrimStage::kCaches:
+      return "caches";
+    case MemoryTrimStage::kAtlases:
+      return "atlases";
+    case MemoryTrimStage::kGPUPools:
+      return "gpuPools";
+  }
+  return "unknown";
+}
+
+}  // namespace flutter
@@ -0,0 +1,155 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_MEMORY_DASHBOARD_H_
+#define FLUTTER_SHELL_COMMON_MEMORY_DASHBOARD_H_
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/task_runner.h"
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// The stage at which a subsystem is asked to release memory under pressure.
+/// Lower stages are cheap to rebuild and are trimmed first; higher stages are
+/// only reached when pressure persists.
+enum class MemoryTrimStage : uint32_t {
+  /// CPU-side caches that are rebuilt incrementally over the following
+  /// frames, such as the raster cache.
+  kCaches = 0,
+  /// Font and glyph atlases. Dropping these forces visible text to be
+  /// re-rastered on the next frame.
+  kAtlases = 1,
+  /// GPU resource pools and allocator slack. Reallocating these is the most
+  /// expensive to recover from.
+  kGPUPools = 2,
+};
+
+//------------------------------------------------------------------------------
+/// @brief      A registry of the engine's memory consumers with a coordinated
+///             trim policy.
+///
+///             Each subsystem registers a meter that reports its current byte
+///             usage and a trim callback along with the stage at which it is
+///             willing to release memory. Low memory warnings are translated
+///             into staged trims: the first warning only drops cheap caches,
+///             and warnings arriving while pressure persists escalate to
+///             atlases and finally GPU pools. This replaces purging
+///             everything on the first signal, which traded one memory spike
+///             for several janky frames while every cache refilled at once.
+///
+///             Registration, pressure notifications, and metric queries are
+///             internally synchronized. Trim callbacks are posted to the task
+///             runner supplied at registration. Meters are invoked
+///             synchronously by |GetMetrics| and must be safe to call on the
+///             thread that queries metrics; the shell queries them on the
+///             raster task runner.
+class MemoryDashboard {
+ public:
+  /// A point-in-time byte measurement for one registered subsystem.
+  struct SubsystemMetrics {
+    std::string name;
+    MemoryTrimStage trim_stage;
+    size_t bytes = 0;
+  };
+
+  /// Reports the subsystem's current memory usage in bytes.
+  using Meter = std::function<size_t()>;
+
+  /// Asks the subsystem to release memory. The stage that triggered the trim
+  /// is passed so subsystems registered at a low stage can trim harder when
+  /// pressure has escalated.
+  using TrimCallback = std::function<void(MemoryTrimStage stage)>;
+
+  MemoryDashboard();
+
+  ~MemoryDashboard();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Registers a memory consumer with the dashboard.
+  ///
+  /// @param[in]  name         The subsystem name reported over the service
+  ///                          protocol.
+  /// @param[in]  trim_stage   The earliest stage at which the subsystem is
+  ///                          asked to trim.
+  /// @param[in]  task_runner  The task runner the trim callback is posted to.
+  /// @param[in]  meter        Reports current usage in bytes.
+  /// @param[in]  trim         Releases memory when invoked.
+  ///
+  /// @return     A handle that can be passed to |UnregisterSubsystem|.
+  ///
+  size_t RegisterSubsystem(std::string name,
+                           MemoryTrimStage trim_stage,
+                           fml::RefPtr<fml::TaskRunner> task_runner,
+                           Meter meter,
+                           TrimCallback trim);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Removes a previously registered subsystem. Trims that were
+  ///             already posted to the subsystem's task runner may still run.
+  ///
+  void UnregisterSubsystem(size_t handle);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Responds to a low memory warning by posting trims to every
+  ///             subsystem whose stage is at or below the current pressure
+  ///             stage, cheapest stage first.
+  ///
+  ///             The first warning trims at |MemoryTrimStage::kCaches|. Each
+  ///             warning arriving within the escalation window of the
+  ///             previous one raises the stage by one, up to
+  ///             |MemoryTrimStage::kGPUPools|. Once the window elapses
+  ///             without a warning, the stage resets to the cheapest.
+  ///
+  /// @return     The stage the trims were issued at.
+  ///
+  MemoryTrimStage NotifyMemoryPressure();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Invokes every registered meter and returns the measurements.
+  ///             Must be called on a thread the meters are safe on; the shell
+  ///             uses the raster task runner.
+  ///
+  std::vector<SubsystemMetrics> GetMetrics() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The service protocol name for a trim stage.
+  ///
+  static const char* StageName(MemoryTrimStage stage);
+
+ private:
+  struct Subsystem {
+    std::string name;
+    MemoryTrimStage trim_stage;
+    fml::RefPtr<fml::TaskRunner> task_runner;
+    Meter meter;
+    TrimCallback trim;
+  };
+
+  // Warnings spaced further apart than this are treated as separate pressure
+  // episodes and start over at the cheapest trim stage.
+  static constexpr fml::TimeDelta kEscalationWindow =
+      fml::TimeDelta::FromSeconds(10);
+
+  mutable std::mutex mutex_;
+  std::map<size_t, Subsystem> subsystems_;
+  size_t next_handle_ = 1;
+  std::optional<fml::TimePoint> last_pressure_time_;
+  MemoryTrimStage last_stage_ = MemoryTrimStage::kCaches;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(MemoryDashboard);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_MEMORY_DASHBOARD_H_
@@ -0,0 +1,103 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/memory_dashboard.h"
+
+#include <mutex>
+#include <vector>
+
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/fml/thread.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(MemoryDashboardTest, ReportsRegisteredMeters) {
+  MemoryDashboard dashboard;
+  dashboard.RegisterSubsystem(
+      "caches", MemoryTrimStage::kCaches, nullptr,
+      []() -> size_t { return 100u; }, [](MemoryTrimStage stage) {});
+  dashboard.RegisterSubsystem(
+      "pools", MemoryTrimStage::kGPUPools, nullptr,
+      []() -> size_t { return 25u; }, [](MemoryTrimStage stage) {});
+
+  auto metrics = dashboard.GetMetrics();
+  ASSERT_EQ(metrics.size(), 2u);
+  EXPECT_EQ(metrics[0].name, "caches");
+  EXPECT_EQ(metrics[0].trim_stage, MemoryTrimStage::kCaches);
+  EXPECT_EQ(metrics[0].bytes, 100u);
+  EXPECT_EQ(metrics[1].name, "pools");
+  EXPECT_EQ(metrics[1].trim_stage, MemoryTrimStage::kGPUPools);
+  EXPECT_EQ(metrics[1].bytes, 25u);
+}
+
+TEST(MemoryDashboardTest, UnregisteredSubsystemIsNotReported) {
+  MemoryDashboard dashboard;
+  auto handle = dashboard.RegisterSubsystem(
+      "caches", MemoryTrimStage::kCaches, nullptr,
+      []() -> size_t { return 100u; }, [](MemoryTrimStage stage) {});
+  ASSERT_EQ(dashboard.GetMetrics().size(), 1u);
+  dashboard.UnregisterSubsystem(handle);
+  EXPECT_TRUE(dashboard.GetMetrics().empty());
+}
+
+TEST(MemoryDashboardTest, RepeatedPressureEscalatesStages) {
+  fml::Thread thread("dashboard_trims");
+  auto task_runner = thread.GetTaskRunner();
+
+  MemoryDashboard dashboard;
+  std::mutex mutex;
+  std::vector<std::string> trims;
+  auto register_subsystem = [&](const std::string& name,
+                                MemoryTrimStage stage) {
+    dashboard.RegisterSubsystem(
+        name, stage, task_runner, []() -> size_t { return 0u; },
+        [&trims, &mutex, name](MemoryTrimStage stage) {
+          std::scoped_lock lock(mutex);
+          trims.push_back(name);
+        });
+  };
+  register_subsystem("caches", MemoryTrimStage::kCaches);
+  register_subsystem("atlases", MemoryTrimStage::kAtlases);
+  register_subsystem("pools", MemoryTrimStage::kGPUPools);
+
+  auto drain = [&] {
+    fml::AutoResetWaitableEvent latch;
+    task_runner->PostTask([&latch] { latch.Signal(); });
+    latch.Wait();
+  };
+
+  // The first warning only trims the cheap caches.
+  EXPECT_EQ(dashboard.NotifyMemoryPressure(), MemoryTrimStage::kCaches);
+  drain();
+  {
+    std::scoped_lock lock(mutex);
+    EXPECT_EQ(trims, std::vector<std::string>({"caches"}));
+    trims.clear();
+  }
+
+  // A warning within the escalation window adds the atlases.
+  EXPECT_EQ(dashboard.NotifyMemoryPressure(), MemoryTrimStage::kAtlases);
+  drain();
+  {
+    std::scoped_lock lock(mutex);
+    EXPECT_EQ(trims, std::vector<std::string>({"caches", "atlases"}));
+    trims.clear();
+  }
+
+  // Sustained pressure reaches the GPU pools and stays there.
+  EXPECT_EQ(dashboard.NotifyMemoryPressure(), MemoryTrimStage::kGPUPools);
+  EXPECT_EQ(dashboard.NotifyMemoryPressure(), MemoryTrimStage::kGPUPools);
+  drain();
+  {
+    std::scoped_lock lock(mutex);
+    EXPECT_EQ(trims, std::vector<std::string>(
+                         {"caches", "atlases", "pools",  //
+                          "caches", "atlases", "pools"}));
+  }
+}
+
+}  // namespace testing
+}  // namespace flutter
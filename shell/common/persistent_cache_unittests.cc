@@ -199,5 +199,73 @@ TEST_F(PersistentCacheTest, PurgeAllowsFutureSkSLCache) {
   DestroyShell(std::move(shell));
 }
 
+TEST_F(PersistentCacheTest, LoadsSkSLsFromPackFile) {
+  // Avoid polluting unit tests output by hiding INFO level logging.
+  fml::LogSettings warning_only = {fml::kLogWarning};
+  fml::ScopedSetLogSettings scoped_set_log_settings(warning_only);
+
+  fml::ScopedTemporaryDirectory base_dir;
+  ASSERT_TRUE(base_dir.fd().is_valid());
+  PersistentCache::SetCacheDirectoryPath(base_dir.path());
+  PersistentCache::ResetCacheForProcess();
+  PersistentCache::SetAssetManager(nullptr);
+
+  auto sksl_dir = fml::CreateDirectory(
+      base_dir.fd(),
+      {"flutter_engine", GetFlutterEngineVersion(), "skia", GetSkiaVersion(),
+       PersistentCache::kSkSLSubdirName},
+      fml::FilePermission::kReadWrite);
+  ASSERT_TRUE(sksl_dir.is_valid());
+
+  // Write two SkSL cache entries as individual files.
+  sk_sp<SkData> key_a = SkData::MakeWithCopy("A", 1);
+  sk_sp<SkData> key_b = SkData::MakeWithCopy("B", 1);
+  sk_sp<SkData> value_x = SkData::MakeWithCopy("x", 1);
+  sk_sp<SkData> value_y = SkData::MakeWithCopy("y", 1);
+  std::string name_a = PersistentCache::SkKeyToFilePath(*key_a);
+  std::string name_b = PersistentCache::SkKeyToFilePath(*key_b);
+  auto object_a = PersistentCache::BuildCacheObject(*key_a, *value_x);
+  auto object_b = PersistentCache::BuildCacheObject(*key_b, *value_y);
+  ASSERT_TRUE(fml::WriteAtomically(sksl_dir, name_a.c_str(), *object_a));
+  ASSERT_TRUE(fml::WriteAtomically(sksl_dir, name_b.c_str(), *object_b));
+
+  auto check_shaders = []() {
+    auto shaders = PersistentCache::GetCacheForProcess()->LoadSkSLs();
+    ASSERT_EQ(shaders.size(), 2u);
+    if (shaders[0].key->bytes()[0] == 'B') {
+      std::swap(shaders[0], shaders[1]);
+    }
+    CheckTextSkData(shaders[0].key, "A");
+    CheckTextSkData(shaders[0].value, "x");
+    CheckTextSkData(shaders[1].key, "B");
+    CheckTextSkData(shaders[1].value, "y");
+  };
+
+  // The first load scans the individual files and consolidates them into a
+  // single pack file.
+  check_shaders();
+  auto cache_dir = fml::CreateDirectory(
+      base_dir.fd(),
+      {"flutter_engine", GetFlutterEngineVersion(), "skia", GetSkiaVersion()},
+      fml::FilePermission::kReadWrite);
+  ASSERT_TRUE(
+      fml::OpenFileReadOnly(cache_dir, PersistentCache::kSkSLPackFileName)
+          .is_valid());
+
+  // Overwrite the individual files; subsequent loads are served entirely
+  // from the pack file.
+  fml::DataMapping garbage(std::string("garbage"));
+  ASSERT_TRUE(fml::WriteAtomically(sksl_dir, name_a.c_str(), garbage));
+  ASSERT_TRUE(fml::WriteAtomically(sksl_dir, name_b.c_str(), garbage));
+  check_shaders();
+
+  // Removing an entry makes the pack stale, falling back to per-file loads.
+  ASSERT_TRUE(fml::UnlinkFile(sksl_dir, name_b.c_str()));
+  ASSERT_EQ(PersistentCache::GetCacheForProcess()->LoadSkSLs().size(), 0u);
+
+  // Cleanup
+  fml::RemoveFilesInDirectory(base_dir.fd());
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -5,15 +5,14 @@
 #ifndef FLUTTER_SHELL_COMMON_PIPELINE_H_
 #define FLUTTER_SHELL_COMMON_PIPELINE_H_
 
-#include <deque>
+#include <atomic>
 #include <memory>
-#include <mutex>
+#include <vector>
 
 #include "flutter/flow/frame_timings.h"
 #include "flutter/flow/layers/layer_tree.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/ref_counted.h"
-#include "flutter/fml/synchronization/semaphore.h"
 #include "flutter/fml/trace_event.h"
 
 namespace flutter {
@@ -58,6 +57,11 @@ size_t GetNextPipelineTraceID();
 ///
 /// The primary use of this class is as the frame pipeline used in Flutter's
 /// animator/rasterizer.
+///
+/// Internally the pipeline is a single-producer/single-consumer ring with
+/// storage allocated once at construction and atomic head/tail indices, so
+/// the per-frame handoff between the UI and raster threads involves no
+/// mutexes, semaphores, or heap allocations.
 template <class R>
 class Pipeline {
  public:
@@ -127,11 +131,11 @@ class Pipeline {
   };
 
   explicit Pipeline(uint32_t depth)
-      : empty_(depth), available_(0), inflight_(0) {}
+      : depth_(depth), slots_(depth), inflight_(0) {}
 
   ~Pipeline() = default;
 
-  bool IsValid() const { return empty_.IsValid() && available_.IsValid(); }
+  bool IsValid() const { return depth_ > 0; }
 
   /// Creates a `ProducerContinuation` that a producer can use to add a
   /// resource to the queue.
@@ -139,7 +143,7 @@ class Pipeline {
   /// If the queue is already at its maximum depth, the `ProducerContinuation`
   /// is returned with success = false.
   ProducerContinuation Produce() {
-    if (!empty_.TryWait()) {
+    if (!TryReserve()) {
       return {};
     }
     ++inflight_;
@@ -160,7 +164,7 @@ class Pipeline {
   /// Prefer using |Produce|. ProducerContinuation returned by this method
   /// doesn't guarantee that the frame will be rendered.
   ProducerContinuation ProduceIfEmpty() {
-    if (!empty_.TryWait()) {
+    if (!TryReserve()) {
       return {};
     }
     ++inflight_;
@@ -183,24 +187,20 @@ class Pipeline {
       return PipelineConsumeResult::NoneAvailable;
     }
 
-    if (!available_.TryWait()) {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire)) {
       return PipelineConsumeResult::NoneAvailable;
     }
 
-    ResourcePtr resource;
-    size_t trace_id = 0;
-    size_t items_count = 0;
-
-    {
-      std::scoped_lock lock(queue_mutex_);
-      std::tie(resource, trace_id) = std::move(queue_.front());
-      queue_.pop_front();
-      items_count = queue_.size();
-    }
+    Slot& slot = slots_[head % depth_];
+    ResourcePtr resource = std::move(slot.resource);
+    size_t trace_id = slot.trace_id;
+    head_.store(head + 1, std::memory_order_release);
+    const size_t items_count = tail_.load(std::memory_order_acquire) - head - 1;
 
     consumer(std::move(resource));
 
-    empty_.Signal();
+    ReleaseReservation();
     --inflight_;
 
     TRACE_FLOW_END("flutter", "PipelineItem", trace_id);
@@ -211,42 +211,62 @@ class Pipeline {
   }
 
  private:
-  fml::Semaphore empty_;
-  fml::Semaphore available_;
+  struct Slot {
+    ResourcePtr resource;
+    size_t trace_id = 0;
+  };
+
+  const size_t depth_;
+  std::vector<Slot> slots_;
   std::atomic<int> inflight_;
-  std::mutex queue_mutex_;
-  std::deque<std::pair<ResourcePtr, size_t>> queue_;
+  /// Number of slots claimed by outstanding continuations plus committed
+  /// items; bounds the pipeline at |depth_|.
+  std::atomic<size_t> reserved_{0};
+  /// Index of the next slot to consume. Only advanced by the consumer.
+  std::atomic<size_t> head_{0};
+  /// Index of the next slot to commit. Only advanced by the producer.
+  std::atomic<size_t> tail_{0};
+
+  bool TryReserve() {
+    size_t current = reserved_.load(std::memory_order_relaxed);
+    do {
+      if (current >= depth_) {
+        return false;
+      }
+    } while (!reserved_.compare_exchange_weak(current, current + 1,
+                                              std::memory_order_acquire));
+    return true;
+  }
 
-  /// Commits a produced resource to the queue and signals the consumer that a
-  /// resource is available.
-  PipelineProduceResult ProducerCommit(ResourcePtr resource, size_t trace_id) {
-    bool is_first_item = false;
-    {
-      std::scoped_lock lock(queue_mutex_);
-      is_first_item = queue_.empty();
-      queue_.emplace_back(std::move(resource), trace_id);
-    }
+  void ReleaseReservation() {
+    reserved_.fetch_sub(1, std::memory_order_release);
+  }
 
-    // Ensure the queue mutex is not held as that would be a pessimization.
-    available_.Signal();
+  /// Commits a produced resource to the ring and publishes it to the
+  /// consumer by advancing the tail index.
+  PipelineProduceResult ProducerCommit(ResourcePtr resource, size_t trace_id) {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    const bool is_first_item = tail == head_.load(std::memory_order_acquire);
+    Slot& slot = slots_[tail % depth_];
+    slot.resource = std::move(resource);
+    slot.trace_id = trace_id;
+    tail_.store(tail + 1, std::memory_order_release);
     return {.success = true, .is_first_item = is_first_item};
   }
 
   PipelineProduceResult ProducerCommitIfEmpty(ResourcePtr resource,
                                               size_t trace_id) {
-    {
-      std::scoped_lock lock(queue_mutex_);
-      if (!queue_.empty()) {
-        // Bail if the queue is not empty, opens up spaces to produce other
-        // frames.
-        empty_.Signal();
-        return {.success = false, .is_first_item = false};
-      }
-      queue_.emplace_back(std::move(resource), trace_id);
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail != head_.load(std::memory_order_acquire)) {
+      // Bail if the queue is not empty, opens up spaces to produce other
+      // frames.
+      ReleaseReservation();
+      return {.success = false, .is_first_item = false};
     }
-
-    // Ensure the queue mutex is not held as that would be a pessimization.
-    available_.Signal();
+    Slot& slot = slots_[tail % depth_];
+    slot.resource = std::move(resource);
+    slot.trace_id = trace_id;
+    tail_.store(tail + 1, std::memory_order_release);
     return {.success = true, .is_first_item = true};
   }
 
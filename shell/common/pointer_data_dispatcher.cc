@@ -5,6 +5,7 @@
 #include "flutter/shell/common/pointer_data_dispatcher.h"
 
 #include "flutter/fml/trace_event.h"
+#include "flutter/shell/common/replay_log.h"
 
 namespace flutter {
 
@@ -22,6 +23,9 @@ void DefaultPointerDataDispatcher::DispatchPacket(
                              "DefaultPointerDataDispatcher::DispatchPacket",
                              /*flow_id_count=*/1, &trace_flow_id);
   TRACE_FLOW_STEP("flutter", "PointerEvent", trace_flow_id);
+  if (ReplayLog::Instance().enabled()) {
+    ReplayLog::Instance().RecordPointerPacket(packet->data());
+  }
   delegate_.DoDispatchPacket(std::move(packet), trace_flow_id);
 }
 
@@ -34,13 +38,18 @@ void SmoothPointerDataDispatcher::DispatchPacket(
   TRACE_FLOW_STEP("flutter", "PointerEvent", trace_flow_id);
 
   if (is_pointer_data_in_progress_) {
-    if (pending_packet_ != nullptr) {
-      DispatchPendingPacket();
+    // Coalesce the packet into the packed pending buffer so that everything
+    // received during this frame crosses into Dart as a single packet at the
+    // next vsync. The flow of an earlier coalesced packet is folded into the
+    // one tracked by the latest trace flow id.
+    if (!pending_buffer_.empty()) {
+      TRACE_FLOW_END("flutter", "PointerEvent", pending_trace_flow_id_);
     }
-    pending_packet_ = std::move(packet);
+    const std::vector<uint8_t>& data = packet->data();
+    pending_buffer_.insert(pending_buffer_.end(), data.begin(), data.end());
     pending_trace_flow_id_ = trace_flow_id;
   } else {
-    FML_DCHECK(pending_packet_ == nullptr);
+    FML_DCHECK(pending_buffer_.empty());
     DefaultPointerDataDispatcher::DispatchPacket(std::move(packet),
                                                  trace_flow_id);
   }
@@ -53,7 +62,7 @@ void SmoothPointerDataDispatcher::ScheduleSecondaryVsyncCallback() {
       reinterpret_cast<uintptr_t>(this),
       [dispatcher = weak_factory_.GetWeakPtr()]() {
         if (dispatcher && dispatcher->is_pointer_data_in_progress_) {
-          if (dispatcher->pending_packet_ != nullptr) {
+          if (!dispatcher->pending_buffer_.empty()) {
             dispatcher->DispatchPendingPacket();
           } else {
             dispatcher->is_pointer_data_in_progress_ = false;
@@ -63,12 +72,15 @@ void SmoothPointerDataDispatcher::ScheduleSecondaryVsyncCallback() {
 }
 
 void SmoothPointerDataDispatcher::DispatchPendingPacket() {
-  FML_DCHECK(pending_packet_ != nullptr);
+  FML_DCHECK(!pending_buffer_.empty());
   FML_DCHECK(is_pointer_data_in_progress_);
-  DefaultPointerDataDispatcher::DispatchPacket(std::move(pending_packet_),
-                                               pending_trace_flow_id_);
-  pending_packet_ = nullptr;
-  pending_trace_flow_id_ = -1;
+  auto packet = std::make_unique<PointerDataPacket>(pending_buffer_.data(),
+                                                    pending_buffer_.size());
+  pending_buffer_.clear();
+  uint64_t trace_flow_id = pending_trace_flow_id_;
+  pending_trace_flow_id_ = 0;
+  DefaultPointerDataDispatcher::DispatchPacket(std::move(packet),
+                                               trace_flow_id);
   ScheduleSecondaryVsyncCallback();
 }
 
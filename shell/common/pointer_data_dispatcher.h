@@ -100,9 +100,9 @@ class DefaultPointerDataDispatcher : public PointerDataDispatcher {
 };
 
 //------------------------------------------------------------------------------
-/// A dispatcher that may temporarily store and defer the last received
-/// PointerDataPacket if multiple packets are received in one VSYNC. The
-/// deferred packet will be sent in the next vsync in order to smooth out the
+/// A dispatcher that may temporarily store and coalesce PointerDataPackets if
+/// multiple packets are received in one VSYNC. The coalesced packets will be
+/// sent as a single packed packet in the next vsync in order to smooth out the
 /// events. This filters out irregular input events delivery to provide a smooth
 /// scroll on iPhone X/Xs.
 ///
@@ -111,8 +111,8 @@ class DefaultPointerDataDispatcher : public PointerDataDispatcher {
 /// When `DispatchPacket` is called while a previous pointer data dispatch is
 /// still in progress (its frame isn't finished yet), it means that an input
 /// event is delivered to us too fast. That potentially means a later event will
-/// be too late which could cause the missing of a frame. Hence we'll cache it
-/// in `pending_packet_` for the next frame to smooth it out.
+/// be too late which could cause the missing of a frame. Hence we'll append it
+/// to the packed `pending_buffer_` for the next frame to smooth it out.
 ///
 /// If the input event is sent to us regularly at the same rate of VSYNC (say
 /// at 60Hz), this would be identical to `DefaultPointerDataDispatcher` where
@@ -126,10 +126,12 @@ class DefaultPointerDataDispatcher : public PointerDataDispatcher {
 /// one frame, this would guarantee that we'll miss at most 1 frame. Without
 /// this, we could miss half of the frames.
 ///
-/// If the input event is delivered at a higher rate than that of VSYNC, this
-/// would at most add a latency of one event delivery. For example, if the
-/// input event is delivered at 120Hz (this is only true for iPad pro, not even
-/// iPhone X), this may delay the handling of an input event by 8ms.
+/// If the input event is delivered at a higher rate than that of VSYNC, all
+/// packets received during one frame are delivered together at the next vsync
+/// through a single `Window::DispatchPointerDataPacket` crossing, no matter
+/// how many there are. For example, a 240Hz stylus costs one Dart entry per
+/// frame instead of one per event, and an event is delayed by no more than
+/// one frame.
 ///
 /// The assumption of this solution is that the sampling itself is still
 /// regular. Only the event delivery is allowed to be irregular. So far this
@@ -151,11 +153,13 @@ class SmoothPointerDataDispatcher : public DefaultPointerDataDispatcher {
   void DispatchPendingPacket();
   void ScheduleSecondaryVsyncCallback();
 
-  // If non-null, this will be a pending pointer data packet for the next frame
-  // to consume. This is used to smooth out the irregular drag events delivery.
-  // See also `DispatchPointerDataPacket` and input_events_unittests.cc.
-  std::unique_ptr<PointerDataPacket> pending_packet_;
-  int pending_trace_flow_id_ = -1;
+  // If non-empty, this holds the packed pointer data of every packet received
+  // while a dispatch was in progress, for the next frame to consume in a
+  // single packet. This is used to smooth out the irregular drag events
+  // delivery and to keep the Dart entry overhead constant per frame. See also
+  // `DispatchPacket` and input_events_unittests.cc.
+  std::vector<uint8_t> pending_buffer_;
+  uint64_t pending_trace_flow_id_ = 0;
   bool is_pointer_data_in_progress_ = false;
 
   // WeakPtrFactory must be the last member.
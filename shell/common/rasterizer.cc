@@ -14,15 +14,21 @@
 #include "flutter/flow/layers/offscreen_surface.h"
 #include "flutter/fml/time/time_delta.h"
 #include "flutter/fml/time/time_point.h"
+#include "flutter/fml/trace_event_interned.h"
+#if IMPELLER_SUPPORTS_RENDERING
+#include "impeller/core/resource_watermarks.h"  // nogncheck
+#endif  // IMPELLER_SUPPORTS_RENDERING
 #include "flutter/shell/common/base64.h"
 #include "flutter/shell/common/serialization_callbacks.h"
 #include "fml/make_copyable.h"
+#include "third_party/skia/include/core/SkColor.h"
 #include "third_party/skia/include/core/SkColorSpace.h"
 #include "third_party/skia/include/core/SkData.h"
 #include "third_party/skia/include/core/SkImage.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
 #include "third_party/skia/include/core/SkMatrix.h"
 #include "third_party/skia/include/core/SkPictureRecorder.h"
+#include "third_party/skia/include/core/SkPixmap.h"
 #include "third_party/skia/include/core/SkRect.h"
 #include "third_party/skia/include/core/SkSerialProcs.h"
 #include "third_party/skia/include/core/SkSize.h"
@@ -40,6 +46,19 @@ namespace flutter {
 // used within this interval.
 static constexpr std::chrono::milliseconds kSkiaCleanupExpiration(15000);
 
+// The maximum number of bytes the GPU resource cache limit may be lowered by
+// in a single frame while walking toward a smaller target. Spreading the
+// eviction across frames avoids a long synchronous purge on the raster
+// thread when a display change shrinks the computed limit.
+static constexpr size_t kResourceCacheEvictionBudgetPerFrame = 4 * 1024 * 1024;
+
+// How long a ScreenshotType::LastFrameImage request keeps asynchronous
+// readbacks of the onscreen surface flowing. Long enough that periodic
+// screenshot consumers never fall back to re-rendering, short enough that
+// the readback bandwidth stops being paid soon after they go away.
+static constexpr fml::TimeDelta kLastFrameReadbackWindow =
+    fml::TimeDelta::FromSeconds(5);
+
 Rasterizer::Rasterizer(Delegate& delegate,
                        MakeGpuImageBehavior gpu_image_behavior)
     : is_torn_down_(false),
@@ -72,6 +91,16 @@ void Rasterizer::SetImpellerContext(
 void Rasterizer::Setup(std::unique_ptr<Surface> surface) {
   surface_ = std::move(surface);
 
+  if (delegate_.GetSettings().enable_parallel_preroll) {
+    compositor_context_->SetParallelPrerollTaskRunner(
+        delegate_.GetConcurrentWorkerTaskRunner());
+  }
+
+  if (delegate_.GetSettings().enable_async_raster_cache) {
+    compositor_context_->raster_cache().SetAsyncWorkerTaskRunner(
+        delegate_.GetConcurrentWorkerTaskRunner());
+  }
+
   if (max_cache_bytes_.has_value()) {
     SetResourceCacheMaxBytes(max_cache_bytes_.value(),
                              user_override_resource_cache_bytes_);
@@ -121,6 +150,11 @@ void Rasterizer::Teardown() {
     surface_.reset();
   }
 
+  // Drop the slot for onscreen readbacks; an in-flight completion keeps
+  // its own reference and expires harmlessly. This also keeps a surface
+  // recreated later from serving a screenshot of the old surface.
+  last_frame_readback_.reset();
+
   view_records_.clear();
 
   if (raster_thread_merger_.get() != nullptr &&
@@ -176,6 +210,52 @@ void Rasterizer::NotifyLowMemoryWarning() const {
   context->performDeferredCleanup(std::chrono::milliseconds(0));
 }
 
+size_t Rasterizer::GetResourceCacheBytes() const {
+  if (!surface_) {
+    return 0u;
+  }
+  auto context = surface_->GetContext();
+  if (!context) {
+    return 0u;
+  }
+  size_t bytes = 0u;
+  context->getResourceCacheUsage(nullptr, &bytes);
+  return bytes;
+}
+
+void Rasterizer::PreWarmGlyphAtlases() const {
+#if IMPELLER_SUPPORTS_RENDERING
+  // Only warm an already live rendering context; the fallback in
+  // GetAiksContext would spin up a throwaway context whose caches nothing
+  // else observes.
+  if (!surface_) {
+    return;
+  }
+  auto aiks_context = surface_->GetAiksContext();
+  if (!aiks_context) {
+    return;
+  }
+  aiks_context->GetContentContext().GetLazyGlyphAtlas()->PreWarmAtlases(
+      *aiks_context->GetContext());
+#endif  // IMPELLER_SUPPORTS_RENDERING
+}
+
+void Rasterizer::PerformIdleMemoryMaintenance() const {
+#if IMPELLER_SUPPORTS_RENDERING
+  // Only service an already live rendering context; the fallback in
+  // GetAiksContext would spin up a throwaway context with nothing to
+  // maintain.
+  if (!surface_) {
+    return;
+  }
+  auto aiks_context = surface_->GetAiksContext();
+  if (!aiks_context) {
+    return;
+  }
+  aiks_context->GetContext()->GetResourceAllocator()->PerformIdleMaintenance();
+#endif  // IMPELLER_SUPPORTS_RENDERING
+}
+
 void Rasterizer::CollectView(int64_t view_id) {
   view_records_.erase(view_id);
 }
@@ -276,12 +356,25 @@ DrawStatus Rasterizer::Draw(const std::shared_ptr<FramePipeline>& pipeline) {
   // between successive tries.
   switch (consume_result) {
     case PipelineConsumeResult::MoreAvailable: {
-      delegate_.GetTaskRunners().GetRasterTaskRunner()->PostTask(
-          [weak_this = weak_factory_.GetWeakPtr(), pipeline]() {
-            if (weak_this) {
-              weak_this->Draw(pipeline);
-            }
-          });
+      if (delegate_.GetSettings().enable_pipelined_raster &&
+          !should_resubmit_frame && draw_ahead_depth_ < kMaxDrawAheadFrames) {
+        // The next item was typically produced by the UI thread while this
+        // frame's present blocked the raster thread. Consuming it in the
+        // same task starts its raster work immediately instead of paying
+        // a task runner round trip behind other queued raster work.
+        // Resubmitted frames still go through the task runner so that the
+        // thread merger can service them on the appropriate thread.
+        draw_ahead_depth_++;
+        Draw(pipeline);
+        draw_ahead_depth_--;
+      } else {
+        delegate_.GetTaskRunners().GetRasterTaskRunner()->PostTask(
+            [weak_this = weak_factory_.GetWeakPtr(), pipeline]() {
+              if (weak_this) {
+                weak_this->Draw(pipeline);
+              }
+            });
+      }
       break;
     }
     default:
@@ -432,6 +525,9 @@ Rasterizer::DoDrawResult Rasterizer::DoDraw(
   TRACE_EVENT_WITH_FRAME_NUMBER(frame_timings_recorder, "flutter",
                                 "Rasterizer::DoDraw", /*flow_id_count=*/0,
                                 /*flow_ids=*/nullptr);
+  // Allocation-free record for always-on field diagnostics; the regular
+  // trace event above is elided when the timeline is disabled.
+  FML_TRACE_DURATION_INTERNED("flutter", "Rasterizer::DoDraw");
   FML_DCHECK(delegate_.GetTaskRunners()
                  .GetRasterTaskRunner()
                  ->RunsTasksOnCurrentThread());
@@ -447,14 +543,50 @@ Rasterizer::DoDrawResult Rasterizer::DoDraw(
   PersistentCache* persistent_cache = PersistentCache::GetCacheForProcess();
   persistent_cache->ResetStoredNewShaders();
 
+  if (draw_stats_.enabled()) {
+    DrawOpStats frame_stats;
+    for (const std::unique_ptr<LayerTreeTask>& task : tasks) {
+      frame_stats.Collect(*task->layer_tree);
+    }
+    draw_stats_.AddFrame(frame_stats.frame_stats());
+  }
+
   DoDrawResult result =
       DrawToSurfaces(*frame_timings_recorder, std::move(tasks));
 
+#if IMPELLER_SUPPORTS_RENDERING
+  {
+    // Emit per-class GPU memory counters once per rasterized frame so
+    // timeline captures can correlate memory growth with frame timings.
+    using impeller::ResourceClass;
+    using impeller::ResourceWatermarks;
+    static constexpr int64_t kResourceWatermarksTraceID = 2024;
+    const auto live_bytes = [](ResourceClass resource_class) {
+      return ResourceWatermarks::GetWatermark(resource_class).live_bytes;
+    };
+    FML_TRACE_COUNTER(
+        "impeller",                  //
+        "ResourceWatermarks",        // series name
+        kResourceWatermarksTraceID,  // series ID
+        "OnscreenTargetBytes", live_bytes(ResourceClass::kOnscreenTarget),
+        "OffscreenTargetBytes", live_bytes(ResourceClass::kOffscreenTarget),
+        "GlyphAtlasBytes", live_bytes(ResourceClass::kGlyphAtlas),
+        "ImageBytes", live_bytes(ResourceClass::kImage),
+        "GeometryBufferBytes", live_bytes(ResourceClass::kGeometryBuffer));
+  }
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
   FML_DCHECK(result.status != DoDrawStatus::kEnqueuePipeline);
   if (result.status == DoDrawStatus::kGpuUnavailable) {
     return DoDrawResult{DoDrawStatus::kGpuUnavailable};
   }
 
+  if (auto input_timestamp = frame_timings_recorder->GetOldestInputTimestamp();
+      input_timestamp.has_value()) {
+    input_latency_.AddSample(frame_timings_recorder->GetRasterEndTime() -
+                             input_timestamp.value());
+  }
+
   if (persistent_cache->IsDumpingSkp() &&
       persistent_cache->StoredNewShaders()) {
     auto screenshot =
@@ -592,7 +724,22 @@ std::unique_ptr<FrameItem> Rasterizer::DrawToSurfacesUnsafe(
     return nullptr;
   }
 
-  if (external_view_embedder_) {
+  // Frames without platform views skip external view embedder bookkeeping
+  // entirely: no embedder frame, no overlay surface management and no thread
+  // merge checks. The embedder still sees one trailing frame after the last
+  // platform view disappears (and every frame while the threads are merged)
+  // so that it can tear down overlays and wind down the merge normally.
+  // GetUsedThisFrame() stays false on skipped frames, which also skips the
+  // EndFrame cleanup in the caller.
+  const bool frame_has_platform_views =
+      tasks.front()->layer_tree->has_platform_views();
+  use_external_view_embedder_ =
+      external_view_embedder_ &&
+      (frame_has_platform_views || previous_frame_had_platform_views_ ||
+       (raster_thread_merger_ && raster_thread_merger_->IsMerged()));
+  previous_frame_had_platform_views_ = frame_has_platform_views;
+
+  if (use_external_view_embedder_) {
     FML_DCHECK(!external_view_embedder_->GetUsedThisFrame());
     external_view_embedder_->SetUsedThisFrame(true);
     external_view_embedder_->BeginFrame(
@@ -616,6 +763,20 @@ std::unique_ptr<FrameItem> Rasterizer::DrawToSurfacesUnsafe(
 
   frame_timings_recorder.RecordRasterStart(fml::TimePoint::Now());
 
+  // When several views share the frame, raster historically cheap views
+  // first. If the frame overruns its deadline, only the slow views slip to
+  // the next vsync rather than every view queued behind them. The sort is
+  // stable so views with no history keep their submission order.
+  if (tasks.size() > 1u) {
+    std::stable_sort(
+        tasks.begin(), tasks.end(),
+        [this](const std::unique_ptr<LayerTreeTask>& a,
+               const std::unique_ptr<LayerTreeTask>& b) {
+          return EnsureViewRecord(a->view_id).last_raster_duration <
+                 EnsureViewRecord(b->view_id).last_raster_duration;
+        });
+  }
+
   // Second traverse: draw all layer trees.
   std::vector<std::unique_ptr<LayerTreeTask>> resubmitted_tasks;
   for (std::unique_ptr<LayerTreeTask>& task : tasks) {
@@ -623,11 +784,15 @@ std::unique_ptr<FrameItem> Rasterizer::DrawToSurfacesUnsafe(
     std::unique_ptr<LayerTree> layer_tree = std::move(task->layer_tree);
     float device_pixel_ratio = task->device_pixel_ratio;
 
-    DrawSurfaceStatus status = DrawToSurfaceUnsafe(
-        view_id, *layer_tree, device_pixel_ratio, presentation_time);
+    const fml::TimePoint view_raster_start = fml::TimePoint::Now();
+    DrawSurfaceStatus status =
+        DrawToSurfaceUnsafe(frame_timings_recorder, view_id, *layer_tree,
+                            device_pixel_ratio, presentation_time);
     FML_DCHECK(status != DrawSurfaceStatus::kDiscarded);
 
     auto& view_record = EnsureViewRecord(task->view_id);
+    view_record.last_raster_duration =
+        fml::TimePoint::Now() - view_raster_start;
     view_record.last_draw_status = status;
     if (status == DrawSurfaceStatus::kSuccess) {
       view_record.last_successful_task = std::make_unique<LayerTreeTask>(
@@ -640,8 +805,22 @@ std::unique_ptr<FrameItem> Rasterizer::DrawToSurfacesUnsafe(
   // TODO(dkwingsmt): Pass in raster cache(s) for all views.
   // See https://github.com/flutter/flutter/issues/135530, item 4.
   frame_timings_recorder.RecordRasterEnd(&compositor_context_->raster_cache());
+  // Feed the measured raster time back into the raster cache so that its
+  // admission budget adapts to how this frame fared against the budget.
+  compositor_context_->raster_cache().UpdateAdmissionBudget(
+      frame_timings_recorder.GetRasterEndTime() -
+          frame_timings_recorder.GetRasterStartTime(),
+      delegate_.GetFrameBudget());
   FireNextFrameCallbackIfPresent();
 
+  // Walk the GPU resource cache limit toward a pending smaller target so
+  // that the purge cost is spread across frames.
+  StepResourceCacheLimit();
+
+  // Release the GPU state of external textures that have not been painted
+  // recently so that off-screen textures do not hold memory indefinitely.
+  compositor_context_->texture_registry()->TrimInactiveTextures();
+
   if (surface_->GetContext()) {
     surface_->GetContext()->performDeferredCleanup(kSkiaCleanupExpiration);
   }
@@ -658,16 +837,22 @@ std::unique_ptr<FrameItem> Rasterizer::DrawToSurfacesUnsafe(
 
 /// \see Rasterizer::DrawToSurfaces
 DrawSurfaceStatus Rasterizer::DrawToSurfaceUnsafe(
+    FrameTimingsRecorder& frame_timings_recorder,
     int64_t view_id,
     flutter::LayerTree& layer_tree,
     float device_pixel_ratio,
     std::optional<fml::TimePoint> presentation_time) {
   FML_DCHECK(surface_);
 
+  // Null when this frame skips external view embedder bookkeeping; see
+  // DrawToSurfacesUnsafe.
+  ExternalViewEmbedder* view_embedder =
+      use_external_view_embedder_ ? external_view_embedder_.get() : nullptr;
+
   DlCanvas* embedder_root_canvas = nullptr;
-  if (external_view_embedder_) {
+  if (view_embedder) {
     // TODO(dkwingsmt): Add view ID here.
-    embedder_root_canvas = external_view_embedder_->GetRootCanvas();
+    embedder_root_canvas = view_embedder->GetRootCanvas();
   }
 
   // On Android, the external view embedder deletes surfaces in `BeginFrame`.
@@ -688,10 +873,10 @@ DrawSurfaceStatus Rasterizer::DrawToSurfaceUnsafe(
   auto root_surface_canvas =
       embedder_root_canvas ? embedder_root_canvas : frame->Canvas();
   auto compositor_frame = compositor_context_->AcquireFrame(
-      surface_->GetContext(),         // skia GrContext
-      root_surface_canvas,            // root surface canvas
-      external_view_embedder_.get(),  // external view embedder
-      root_surface_transformation,    // root surface transformation
+      surface_->GetContext(),       // skia GrContext
+      root_surface_canvas,          // root surface canvas
+      view_embedder,                // external view embedder
+      root_surface_transformation,  // root surface transformation
       true,                           // instrumentation enabled
       frame->framebuffer_info()
           .supports_readback,           // surface supports pixel reads
@@ -711,7 +896,7 @@ DrawSurfaceStatus Rasterizer::DrawToSurfaceUnsafe(
       // surface and also partial repaint with platform view present is
       // something that still need to be figured out.
       bool force_full_repaint =
-          external_view_embedder_ &&
+          view_embedder &&
           (!raster_thread_merger_ || raster_thread_merger_->IsMerged());
 
       damage = std::make_unique<FrameDamage>();
@@ -732,9 +917,10 @@ DrawSurfaceStatus Rasterizer::DrawToSurfaceUnsafe(
     }
 
     RasterStatus frame_status =
-        compositor_frame->Raster(layer_tree,           // layer tree
-                                 ignore_raster_cache,  // ignore raster cache
-                                 damage.get()          // frame damage
+        compositor_frame->Raster(layer_tree,              // layer tree
+                                 ignore_raster_cache,     // ignore raster cache
+                                 damage.get(),            // frame damage
+                                 &frame_timings_recorder  // frame timings
         );
     if (frame_status == RasterStatus::kSkipAndRetry) {
       return DrawSurfaceStatus::kRetry;
@@ -749,18 +935,30 @@ DrawSurfaceStatus Rasterizer::DrawToSurfaceUnsafe(
 
     frame->set_submit_info(submit_info);
 
-    if (external_view_embedder_ &&
-        (!raster_thread_merger_ || raster_thread_merger_->IsMerged())) {
-      FML_DCHECK(!frame->IsSubmitted());
-      external_view_embedder_->SubmitFrame(
-          surface_->GetContext(), surface_->GetAiksContext(), std::move(frame));
-    } else {
-      frame->Submit();
+    if (!embedder_root_canvas) {
+      // If a ScreenshotType::LastFrameImage screenshot was requested
+      // recently, read the onscreen content back asynchronously while it
+      // is still complete and owned by this frame.
+      MaybeReadBackLastFrame(*frame, layer_tree.frame_size());
+    }
+
+    {
+      ScopedFrameTimingsSpan span(&frame_timings_recorder, "SurfacePresent");
+      if (view_embedder &&
+          (!raster_thread_merger_ || raster_thread_merger_->IsMerged())) {
+        FML_DCHECK(!frame->IsSubmitted());
+        view_embedder->SubmitFrame(surface_->GetContext(),
+                                   surface_->GetAiksContext(),
+                                   std::move(frame));
+      } else {
+        frame->Submit();
+      }
     }
 
     // Do not update raster cache metrics for kResubmit because that status
     // indicates that the frame was not actually painted.
     if (frame_status != RasterStatus::kResubmit) {
+      ScopedFrameTimingsSpan span(&frame_timings_recorder, "RasterCacheSweep");
       compositor_context_->raster_cache().EndFrame();
     }
 
@@ -775,11 +973,73 @@ DrawSurfaceStatus Rasterizer::DrawToSurfaceUnsafe(
   return DrawSurfaceStatus::kFailed;
 }
 
+void Rasterizer::MaybeReadBackLastFrame(SurfaceFrame& frame,
+                                        const SkISize& frame_size) {
+  if (fml::TimePoint::Now() > last_frame_readback_wanted_until_) {
+    return;
+  }
+  sk_sp<SkSurface> onscreen_surface = frame.SkiaSurface();
+  if (!onscreen_surface) {
+    return;
+  }
+  if (!last_frame_readback_) {
+    last_frame_readback_ = std::make_shared<LastFrameReadback>();
+  }
+
+  struct ReadbackContext {
+    std::shared_ptr<LastFrameReadback> readback;
+    SkISize frame_size;
+  };
+  auto* readback_context =
+      new ReadbackContext{last_frame_readback_, frame_size};
+
+  const auto image_info = SkImageInfo::MakeN32Premul(
+      frame_size.width(), frame_size.height(), SkColorSpace::MakeSRGB());
+  onscreen_surface->asyncRescaleAndReadPixels(
+      image_info, SkIRect::MakeSize(frame_size),
+      SkSurface::RescaleGamma::kSrc, SkSurface::RescaleMode::kNearest,
+      [](SkSurface::ReadPixelsContext raw_context,
+         std::unique_ptr<const SkSurface::AsyncReadResult> result) {
+        std::unique_ptr<ReadbackContext> context(
+            static_cast<ReadbackContext*>(raw_context));
+        if (!result || result->count() != 1) {
+          // The readback failed; keep whatever completed previously.
+          return;
+        }
+        const SkISize& size = context->frame_size;
+        size_t tight_row_bytes = size.width() * 4;
+        sk_sp<SkData> data;
+        if (result->rowBytes(0) == tight_row_bytes) {
+          // Hand the mapped readback buffer to the SkData instead of
+          // copying it; the buffer stays mapped until the data is freed.
+          const void* pixels = result->data(0);
+          data = SkData::MakeWithProc(
+              pixels, tight_row_bytes * size.height(),
+              [](const void* ptr, void* owned) {
+                delete static_cast<const SkSurface::AsyncReadResult*>(owned);
+              },
+              const_cast<void*>(static_cast<const void*>(result.release())));
+        } else {
+          // The rows were padded by the transfer buffer; repack tightly.
+          data = SkData::MakeUninitialized(tight_row_bytes * size.height());
+          auto* dst = static_cast<uint8_t*>(data->writable_data());
+          const auto* src = static_cast<const uint8_t*>(result->data(0));
+          for (int y = 0; y < size.height(); y++) {
+            memcpy(dst + y * tight_row_bytes, src + y * result->rowBytes(0),
+                   tight_row_bytes);
+          }
+        }
+        context->readback->data = std::move(data);
+        context->readback->frame_size = size;
+      },
+      readback_context);
+}
+
 Rasterizer::ViewRecord& Rasterizer::EnsureViewRecord(int64_t view_id) {
   return view_records_[view_id];
 }
 
-static sk_sp<SkData> ScreenshotLayerTreeAsPicture(
+static sk_sp<SkPicture> RecordLayerTreeToPicture(
     flutter::LayerTree* tree,
     flutter::CompositorContext& compositor_context) {
   FML_DCHECK(tree != nullptr);
@@ -798,6 +1058,14 @@ static sk_sp<SkData> ScreenshotLayerTreeAsPicture(
                                                false, true, nullptr, nullptr);
   frame->Raster(*tree, true, nullptr);
 
+  return recorder.finishRecordingAsPicture();
+}
+
+sk_sp<SkData> Rasterizer::SerializePicture(const sk_sp<SkPicture>& picture) {
+  if (!picture) {
+    return nullptr;
+  }
+
 #if defined(OS_FUCHSIA)
   SkSerialProcs procs = {0};
   procs.fImageProc = SerializeImageWithoutData;
@@ -810,7 +1078,55 @@ static sk_sp<SkData> ScreenshotLayerTreeAsPicture(
   };
 #endif
 
-  return recorder.finishRecordingAsPicture()->serialize(&procs);
+  return picture->serialize(&procs);
+}
+
+sk_sp<SkData> Rasterizer::RasterizePictureToImage(
+    const sk_sp<SkPicture>& picture,
+    bool compressed) {
+  if (!picture) {
+    return nullptr;
+  }
+
+  const SkRect cull_rect = picture->cullRect();
+  const auto image_info =
+      SkImageInfo::MakeN32Premul(SkScalarCeilToInt(cull_rect.width()),
+                                 SkScalarCeilToInt(cull_rect.height()),
+                                 SkColorSpace::MakeSRGB());
+  auto surface = SkSurfaces::Raster(image_info);
+  if (!surface) {
+    FML_LOG(ERROR) << "Screenshot: unable to create raster surface";
+    return nullptr;
+  }
+
+  surface->getCanvas()->clear(SK_ColorTRANSPARENT);
+  surface->getCanvas()->drawPicture(picture);
+
+  auto snapshot = surface->makeImageSnapshot();
+  if (!snapshot) {
+    FML_LOG(ERROR) << "Screenshot: unable to make image screenshot";
+    return nullptr;
+  }
+
+  if (compressed) {
+    return SkPngEncoder::Encode(nullptr, snapshot.get(), {});
+  }
+
+  SkPixmap pixmap;
+  if (!snapshot->peekPixels(&pixmap)) {
+    FML_LOG(ERROR) << "Screenshot: unable to obtain bitmap pixels";
+    return nullptr;
+  }
+  return SkData::MakeWithCopy(pixmap.addr32(), pixmap.computeByteSize());
+}
+
+sk_sp<SkPicture> Rasterizer::RecordLastLayerTreePicture() {
+  auto* layer_tree = GetLastLayerTree(kFlutterImplicitViewId);
+  if (layer_tree == nullptr) {
+    FML_LOG(ERROR) << "Last layer tree was null when recording.";
+    return nullptr;
+  }
+  return RecordLayerTreeToPicture(layer_tree, *compositor_context_);
 }
 
 sk_sp<SkData> Rasterizer::ScreenshotLayerTreeAsImage(
@@ -885,7 +1201,8 @@ Rasterizer::Screenshot Rasterizer::ScreenshotLastLayerTree(
   switch (type) {
     case ScreenshotType::SkiaPicture:
       format = "ScreenshotType::SkiaPicture";
-      data = ScreenshotLayerTreeAsPicture(layer_tree, *compositor_context_);
+      data = SerializePicture(
+          RecordLayerTreeToPicture(layer_tree, *compositor_context_));
       break;
     case ScreenshotType::UncompressedImage:
       format = "ScreenshotType::UncompressedImage";
@@ -903,6 +1220,28 @@ Rasterizer::Screenshot Rasterizer::ScreenshotLastLayerTree(
       data = surface_data.data;
       break;
     }
+    case ScreenshotType::LastFrameImage: {
+      format = "ScreenshotType::LastFrameImage";
+      // Keep asynchronous readbacks of the onscreen surface flowing for a
+      // while; this screenshot returns the most recent completed one.
+      last_frame_readback_wanted_until_ =
+          fml::TimePoint::Now() + kLastFrameReadbackWindow;
+      if (surface_context) {
+        // Harvest readbacks whose GPU work finished since the last flush;
+        // without this a static screen would never deliver its callback.
+        surface_context->checkAsyncWorkCompletion();
+      }
+      if (last_frame_readback_ && last_frame_readback_->data &&
+          last_frame_readback_->frame_size == layer_tree->frame_size()) {
+        data = last_frame_readback_->data;
+      } else {
+        // No readback has completed yet (first request, or the frame size
+        // changed); fall back to re-rendering the last layer tree.
+        data = ScreenshotLayerTreeAsImage(layer_tree, *compositor_context_,
+                                          surface_context, false);
+      }
+      break;
+    }
   }
 
   if (data == nullptr) {
@@ -929,6 +1268,14 @@ void Rasterizer::SetExternalViewEmbedder(
   external_view_embedder_ = view_embedder;
 }
 
+void Rasterizer::SetSharedRasterCache(
+    std::shared_ptr<RasterCache> raster_cache) {
+  FML_DCHECK(delegate_.GetTaskRunners()
+                 .GetRasterTaskRunner()
+                 ->RunsTasksOnCurrentThread());
+  compositor_context_->SetRasterCache(std::move(raster_cache));
+}
+
 void Rasterizer::SetSnapshotSurfaceProducer(
     std::unique_ptr<SnapshotSurfaceProducer> producer) {
   snapshot_surface_producer_ = std::move(producer);
@@ -957,8 +1304,29 @@ void Rasterizer::SetResourceCacheMaxBytes(size_t max_bytes, bool from_user) {
     return;
   }
 
+  // Shrinking the context's limit purges GPU resources synchronously. For
+  // automatic updates (e.g. a display change on a fold/unfold device) the
+  // purge is spread across frames instead: record the new target here and
+  // let |StepResourceCacheLimit| walk the context down with a per-frame
+  // eviction budget. Explicit user requests and the very first limit are
+  // still applied immediately.
+  const bool incremental_shrink = !from_user && max_cache_bytes_.has_value() &&
+                                  max_bytes < max_cache_bytes_.value();
+
   max_cache_bytes_ = max_bytes;
-  if (!surface_) {
+
+  // Idle raster cache surfaces should only ever hold a small slice of
+  // the overall resource budget computed by the
+  // ResourceCacheLimitCalculator.
+  if (compositor_context_) {
+    compositor_context_->raster_cache().surface_pool().SetBudget(max_bytes /
+                                                                 8);
+    // External textures that are registered but not recently painted may
+    // likewise keep at most a small slice of the overall budget resident.
+    compositor_context_->texture_registry()->SetResidencyBudget(max_bytes / 8);
+  }
+
+  if (!surface_ || incremental_shrink) {
     return;
   }
 
@@ -973,6 +1341,24 @@ void Rasterizer::SetResourceCacheMaxBytes(size_t max_bytes, bool from_user) {
   }
 }
 
+void Rasterizer::StepResourceCacheLimit() {
+  if (!max_cache_bytes_.has_value() || !surface_) {
+    return;
+  }
+  GrDirectContext* context = surface_->GetContext();
+  if (!context) {
+    return;
+  }
+  const size_t target = max_cache_bytes_.value();
+  const size_t current = context->getResourceCacheLimit();
+  if (current <= target) {
+    return;
+  }
+  const size_t step =
+      std::min(current - target, kResourceCacheEvictionBudgetPerFrame);
+  context->setResourceCacheLimit(current - step);
+}
+
 std::optional<size_t> Rasterizer::GetResourceCacheMaxBytes() const {
   if (!surface_) {
     return std::nullopt;
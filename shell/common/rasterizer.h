@@ -31,11 +31,14 @@
 #include "impeller/typographer/backends/skia/typographer_context_skia.h"  // nogncheck
 #endif  // IMPELLER_SUPPORTS_RENDERING
 #include "flutter/lib/ui/snapshot_delegate.h"
+#include "flutter/shell/common/draw_op_stats.h"
+#include "flutter/shell/common/input_latency_tracker.h"
 #include "flutter/shell/common/pipeline.h"
 #include "flutter/shell/common/snapshot_controller.h"
 #include "flutter/shell/common/snapshot_surface_producer.h"
 #include "third_party/skia/include/core/SkData.h"
 #include "third_party/skia/include/core/SkImage.h"
+#include "third_party/skia/include/core/SkPicture.h"
 #include "third_party/skia/include/core/SkRect.h"
 #include "third_party/skia/include/core/SkRefCnt.h"
 #include "third_party/skia/include/gpu/GrDirectContext.h"
@@ -169,6 +172,11 @@ class Rasterizer final : public SnapshotDelegate,
 
     virtual const Settings& GetSettings() const = 0;
 
+    /// The concurrent worker pool shared with the Dart VM, used for the
+    /// parallel preroll mode when `Settings::enable_parallel_preroll` is set.
+    virtual const std::shared_ptr<fml::ConcurrentTaskRunner>
+    GetConcurrentWorkerTaskRunner() const = 0;
+
     virtual bool ShouldDiscardLayerTree(int64_t view_id,
                                         const flutter::LayerTree& tree) = 0;
   };
@@ -248,6 +256,33 @@ class Rasterizer final : public SnapshotDelegate,
   ///
   void NotifyLowMemoryWarning() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The bytes currently held by the graphics context's resource
+  ///             cache, or zero if there is no onscreen surface or context.
+  ///             Reported on the shell's memory dashboard. May only be called
+  ///             on the raster task runner.
+  ///
+  size_t GetResourceCacheBytes() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Rasterizes glyphs that were used in recent frames but are
+  ///             not yet present in the Impeller glyph atlases. Called off
+  ///             the frame's critical path, when the animator reports that no
+  ///             frame is being produced, so that typing bursts and atlas
+  ///             rebuilds hit a warm atlas. A no-op for the Skia backend.
+  ///
+  void PreWarmGlyphAtlases() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Performs allocator housekeeping while the animator reports
+  ///             that no frame is being produced. Currently this samples the
+  ///             Impeller allocator's device memory statistics so that
+  ///             memory reserved but made unusable by fragmentation is
+  ///             visible in traces over long sessions. A no-op for the Skia
+  ///             backend.
+  ///
+  void PerformIdleMemoryMaintenance() const;
+
   //----------------------------------------------------------------------------
   /// @brief      Gets a weak pointer to the rasterizer. The rasterizer may only
   ///             be accessed on the raster task runner.
@@ -373,6 +408,20 @@ class Rasterizer final : public SnapshotDelegate,
     /// is determined from the surface. This is the only way to read wide gamut
     /// color data, but isn't supported everywhere.
     SurfaceData,
+
+    //--------------------------------------------------------------------------
+    /// Returns the most recent completed asynchronous readback of the
+    /// onscreen surface as uncompressed `kN32_SkColorType` pixels, instead
+    /// of re-rendering the last layer tree into an offscreen surface and
+    /// reading it back synchronously. Requesting a screenshot of this type
+    /// keeps readbacks flowing for a few seconds, so repeated requests
+    /// (e.g. from accessibility tooling) cost the raster thread only the
+    /// per-frame readback instead of a full re-render plus a pipeline
+    /// stall. The returned pixels may be up to one frame stale, and the
+    /// first request falls back to re-rendering since no readback has
+    /// completed yet.
+    ///
+    LastFrameImage,
   };
 
   //----------------------------------------------------------------------------
@@ -444,6 +493,44 @@ class Rasterizer final : public SnapshotDelegate,
   ///
   Screenshot ScreenshotLastLayerTree(ScreenshotType type, bool base64_encode);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Records the last layer tree into a picture without
+  ///             rasterizing or serializing it. Must be called on the raster
+  ///             task runner. This is the cheap half of a screenshot: the
+  ///             returned picture is an immutable copy of the frame contents
+  ///             that may be rasterized with `RasterizePictureToImage` or
+  ///             serialized with `SerializePicture` on any thread, keeping the
+  ///             expensive work off the raster thread.
+  ///
+  /// @return     The recorded picture, or null if no layer tree has been
+  ///             rendered by this rasterizer.
+  ///
+  sk_sp<SkPicture> RecordLastLayerTreePicture();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Rasterizes a recorded picture into pixels in software and
+  ///             optionally compresses them to PNG. Safe to call on any
+  ///             thread. GPU-resident content referenced by the picture (for
+  ///             example, external textures) may be absent from the result.
+  ///
+  /// @param[in]  picture     The picture to rasterize.
+  /// @param[in]  compressed  Whether the pixels must be PNG compressed.
+  ///
+  /// @return     The pixel (or PNG) data, or null on failure.
+  ///
+  static sk_sp<SkData> RasterizePictureToImage(const sk_sp<SkPicture>& picture,
+                                               bool compressed);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Serializes a recorded picture to the SKP format used by the
+  ///             screenshot service protocol. Safe to call on any thread.
+  ///
+  /// @param[in]  picture  The picture to serialize.
+  ///
+  /// @return     The serialized picture data, or null on failure.
+  ///
+  static sk_sp<SkData> SerializePicture(const sk_sp<SkPicture>& picture);
+
   //----------------------------------------------------------------------------
   /// @brief      Sets a callback that will be executed when the next layer tree
   ///             in rendered to the on-screen surface. This is used by
@@ -481,6 +568,22 @@ class Rasterizer final : public SnapshotDelegate,
   void SetSnapshotSurfaceProducer(
       std::unique_ptr<SnapshotSurfaceProducer> producer);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Makes this rasterizer share the given raster cache instead
+  ///             of its own. Used when this rasterizer belongs to a shell
+  ///             spawned into an engine group so that the group pools cached
+  ///             pictures and layers under one GPU budget. All shells in a
+  ///             group run on the same raster thread, which makes the shared
+  ///             cache safe to use without locking.
+  ///
+  /// @attention  Must be called on the raster task runner before this
+  ///             rasterizer draws its first frame.
+  ///
+  /// @param[in]  raster_cache  The cache to adopt, typically obtained from
+  ///                           the spawning rasterizer's compositor context.
+  ///
+  void SetSharedRasterCache(std::shared_ptr<RasterCache> raster_cache);
+
   //----------------------------------------------------------------------------
   /// @brief      Returns a pointer to the compositor context used by this
   ///             rasterizer. This pointer will never be `nullptr`.
@@ -491,6 +594,20 @@ class Rasterizer final : public SnapshotDelegate,
     return compositor_context_.get();
   }
 
+  //----------------------------------------------------------------------------
+  /// @brief      Returns the per-frame draw op statistics aggregator fed by
+  ///             |DoDraw| when enabled. Must only be accessed on the raster
+  ///             task runner.
+  ///
+  DrawStatsAggregator& draw_stats_aggregator() { return draw_stats_; }
+
+  //----------------------------------------------------------------------------
+  /// @brief      Returns the input-to-present latency tracker fed by |DoDraw|
+  ///             for frames that carry an input timestamp. Must only be
+  ///             accessed on the raster task runner.
+  ///
+  InputLatencyTracker& input_latency_tracker() { return input_latency_; }
+
   //----------------------------------------------------------------------------
   /// @brief      Returns the raster thread merger used by this rasterizer.
   ///             This may be `nullptr`.
@@ -510,6 +627,11 @@ class Rasterizer final : public SnapshotDelegate,
   ///             torn down via `Rasterizer::Teardown`. This call must be made
   ///             again with new limits after surface re-acquisition.
   ///
+  /// @attention  Automatic (non-user) requests that shrink an existing limit
+  ///             take effect incrementally: the context's limit is walked
+  ///             down with a per-frame eviction budget over subsequent frames
+  ///             so that the purge does not stall the raster thread.
+  ///
   /// @attention  This cache does not describe the entirety of GPU resources
   ///             that may be cached. The `RasterCache` also holds very large
   ///             GPU resources.
@@ -610,6 +732,9 @@ class Rasterizer final : public SnapshotDelegate,
   struct ViewRecord {
     std::unique_ptr<LayerTreeTask> last_successful_task;
     std::optional<DrawSurfaceStatus> last_draw_status;
+    // How long the last raster of this view took; used to order view raster
+    // work within a frame so that quick views are not starved by slow ones.
+    fml::TimeDelta last_raster_duration;
   };
 
   // |SnapshotDelegate|
@@ -696,9 +821,10 @@ class Rasterizer final : public SnapshotDelegate,
   // Draws the layer tree to the specified view, assuming we have access to the
   // GPU.
   //
-  // This method is not affiliated with the frame timing recorder, but must be
-  // included between the RasterStart and RasterEnd.
+  // This method runs between the recorder's RasterStart and RasterEnd and
+  // reports its sub-phases (preroll, paint, present) as timing spans.
   DrawSurfaceStatus DrawToSurfaceUnsafe(
+      FrameTimingsRecorder& frame_timings_recorder,
       int64_t view_id,
       flutter::LayerTree& layer_tree,
       float device_pixel_ratio,
@@ -706,11 +832,29 @@ class Rasterizer final : public SnapshotDelegate,
 
   ViewRecord& EnsureViewRecord(int64_t view_id);
 
+  // Issues an asynchronous readback of the onscreen surface content for
+  // |ScreenshotType::LastFrameImage| screenshots. Called right before the
+  // frame is submitted, while its content is complete. Does nothing
+  // unless such a screenshot was requested recently.
+  void MaybeReadBackLastFrame(SurfaceFrame& frame, const SkISize& frame_size);
+
   void FireNextFrameCallbackIfPresent();
 
+  // Lowers the GPU resource cache limit toward a pending smaller target set
+  // by |SetResourceCacheMaxBytes|, evicting at most a fixed byte budget per
+  // call. Called once per frame on the raster thread so that a shrink
+  // requested by a display change purges incrementally instead of in one
+  // synchronous hitch.
+  void StepResourceCacheLimit();
+
   static bool ShouldResubmitFrame(const DoDrawResult& result);
   static DrawStatus ToDrawStatus(DoDrawStatus status);
 
+  // Bounds how many additional pipeline items |Draw| may consume
+  // synchronously before yielding the raster event loop when
+  // |Settings::enable_pipelined_raster| is enabled.
+  static constexpr int kMaxDrawAheadFrames = 1;
+
   bool is_torn_down_;
   Delegate& delegate_;
   MakeGpuImageBehavior gpu_image_behavior_;
@@ -724,7 +868,32 @@ class Rasterizer final : public SnapshotDelegate,
   std::optional<size_t> max_cache_bytes_;
   fml::RefPtr<fml::RasterThreadMerger> raster_thread_merger_;
   std::shared_ptr<ExternalViewEmbedder> external_view_embedder_;
+  // Whether the frame currently being drawn routes through the external view
+  // embedder. Recomputed per frame in DrawToSurfacesUnsafe; false for frames
+  // without platform views, which skip embedder bookkeeping entirely.
+  bool use_external_view_embedder_ = false;
+  // Whether the previously drawn frame contained platform views. Used to
+  // give the embedder one trailing bookkeeping frame after the last platform
+  // view disappears so that it can tear down its overlays. Conservatively
+  // true so the first frame gets full bookkeeping.
+  bool previous_frame_had_platform_views_ = true;
   std::unique_ptr<SnapshotController> snapshot_controller_;
+  int draw_ahead_depth_ = 0;
+  // Raster thread only; fed by DoDraw when enabled.
+  DrawStatsAggregator draw_stats_;
+  // Raster thread only; fed by DoDraw for frames attributed to input.
+  InputLatencyTracker input_latency_;
+
+  // The destination slot for asynchronous readbacks of the onscreen
+  // surface. Shared with the in-flight readback callback so that a
+  // completion arriving during teardown has a place to land; only ever
+  // touched on the raster thread.
+  struct LastFrameReadback {
+    sk_sp<SkData> data;
+    SkISize frame_size = SkISize::MakeEmpty();
+  };
+  std::shared_ptr<LastFrameReadback> last_frame_readback_;
+  fml::TimePoint last_frame_readback_wanted_until_;
 
   // WeakPtrFactory must be the last member.
   fml::TaskRunnerAffineWeakPtrFactory<Rasterizer> weak_factory_;
@@ -62,6 +62,10 @@ class MockDelegate : public Rasterizer::Delegate {
               (),
               (const, override));
   MOCK_METHOD(const Settings&, GetSettings, (), (const, override));
+  MOCK_METHOD(const std::shared_ptr<fml::ConcurrentTaskRunner>,
+              GetConcurrentWorkerTaskRunner,
+              (),
+              (const, override));
   MOCK_METHOD(bool,
               ShouldDiscardLayerTree,
               (int64_t, const flutter::LayerTree&),
@@ -243,6 +247,82 @@ TEST(RasterizerTest,
   latch.Wait();
 }
 
+TEST(RasterizerTest,
+     drawWithExternalViewEmbedderSkipsEmbedderForFramesWithoutPlatformViews) {
+  std::string test_name =
+      ::testing::UnitTest::GetInstance()->current_test_info()->name();
+  ThreadHost thread_host("io.flutter.test." + test_name + ".",
+                         ThreadHost::Type::Platform | ThreadHost::Type::RASTER |
+                             ThreadHost::Type::IO | ThreadHost::Type::UI);
+  TaskRunners task_runners("test", thread_host.platform_thread->GetTaskRunner(),
+                           thread_host.raster_thread->GetTaskRunner(),
+                           thread_host.ui_thread->GetTaskRunner(),
+                           thread_host.io_thread->GetTaskRunner());
+  NiceMock<MockDelegate> delegate;
+  Settings settings;
+  ON_CALL(delegate, GetSettings()).WillByDefault(ReturnRef(settings));
+  EXPECT_CALL(delegate, GetTaskRunners())
+      .WillRepeatedly(ReturnRef(task_runners));
+  EXPECT_CALL(delegate, OnFrameRasterized(_)).Times(2);
+  auto rasterizer = std::make_unique<Rasterizer>(delegate);
+  auto surface = std::make_unique<NiceMock<MockSurface>>();
+
+  std::shared_ptr<NiceMock<MockExternalViewEmbedder>> external_view_embedder =
+      std::make_shared<NiceMock<MockExternalViewEmbedder>>();
+  rasterizer->SetExternalViewEmbedder(external_view_embedder);
+
+  SurfaceFrame::FramebufferInfo framebuffer_info;
+  framebuffer_info.supports_readback = true;
+
+  auto surface_frame_1 = std::make_unique<SurfaceFrame>(
+      /*surface=*/nullptr, framebuffer_info,
+      /*submit_callback=*/[](const SurfaceFrame&, DlCanvas*) { return true; },
+      /*frame_size=*/SkISize::Make(800, 600));
+  auto surface_frame_2 = std::make_unique<SurfaceFrame>(
+      /*surface=*/nullptr, framebuffer_info,
+      /*submit_callback=*/[](const SurfaceFrame&, DlCanvas*) { return true; },
+      /*frame_size=*/SkISize::Make(800, 600));
+  EXPECT_CALL(*surface, AllowsDrawingWhenGpuDisabled())
+      .WillRepeatedly(Return(true));
+  EXPECT_CALL(*surface, AcquireFrame(SkISize()))
+      .WillOnce(Return(ByMove(std::move(surface_frame_1))))
+      .WillOnce(Return(ByMove(std::move(surface_frame_2))));
+  EXPECT_CALL(*surface, MakeRenderContextCurrent())
+      .WillOnce(Return(ByMove(std::make_unique<GLContextDefaultResult>(true))))
+      .WillOnce(Return(ByMove(std::make_unique<GLContextDefaultResult>(true))));
+
+  // The first frame still gets full embedder bookkeeping because the
+  // rasterizer conservatively assumes the previous frame had platform views
+  // and gives the embedder a trailing frame to tear down overlays. The
+  // second frame without platform views skips the embedder entirely.
+  EXPECT_CALL(*external_view_embedder, BeginFrame).Times(1);
+  EXPECT_CALL(*external_view_embedder, SubmitFrame).Times(1);
+  EXPECT_CALL(*external_view_embedder, EndFrame).Times(1);
+
+  rasterizer->Setup(std::move(surface));
+  fml::AutoResetWaitableEvent latch;
+  thread_host.raster_thread->GetTaskRunner()->PostTask([&] {
+    ON_CALL(delegate, ShouldDiscardLayerTree).WillByDefault(Return(false));
+    for (int i = 0; i < 2; i++) {
+      auto pipeline = std::make_shared<FramePipeline>(/*depth=*/10);
+      LayerTree::Config config;
+      config.has_platform_views = false;
+      auto layer_tree =
+          std::make_unique<LayerTree>(config, /*frame_size=*/SkISize());
+      auto layer_tree_item = std::make_unique<FrameItem>(
+          SingleLayerTreeList(kImplicitViewId, std::move(layer_tree),
+                              kDevicePixelRatio),
+          CreateFinishedBuildRecorder());
+      PipelineProduceResult result =
+          pipeline->Produce().Complete(std::move(layer_tree_item));
+      EXPECT_TRUE(result.success);
+      rasterizer->Draw(pipeline);
+    }
+    latch.Signal();
+  });
+  latch.Wait();
+}
+
 TEST(
     RasterizerTest,
     drawWithExternalViewEmbedderAndThreadMergerNotMergedExternalViewEmbedderSubmitFrameNotCalled) {
@@ -677,6 +757,73 @@ TEST(RasterizerTest,
   latch.Wait();
 }
 
+TEST(RasterizerTest, drawWithPipelinedRasterConsumesNextItemWithoutYielding) {
+  std::string test_name =
+      ::testing::UnitTest::GetInstance()->current_test_info()->name();
+  ThreadHost thread_host("io.flutter.test." + test_name + ".",
+                         ThreadHost::Type::Platform | ThreadHost::Type::RASTER |
+                             ThreadHost::Type::IO | ThreadHost::Type::UI);
+  TaskRunners task_runners("test", thread_host.platform_thread->GetTaskRunner(),
+                           thread_host.raster_thread->GetTaskRunner(),
+                           thread_host.ui_thread->GetTaskRunner(),
+                           thread_host.io_thread->GetTaskRunner());
+  NiceMock<MockDelegate> delegate;
+  Settings settings;
+  settings.enable_pipelined_raster = true;
+  ON_CALL(delegate, GetSettings()).WillByDefault(ReturnRef(settings));
+  EXPECT_CALL(delegate, GetTaskRunners())
+      .WillRepeatedly(ReturnRef(task_runners));
+  EXPECT_CALL(delegate, OnFrameRasterized(_)).Times(2);
+
+  auto rasterizer = std::make_unique<Rasterizer>(delegate);
+  auto surface = std::make_unique<NiceMock<MockSurface>>();
+
+  SurfaceFrame::FramebufferInfo framebuffer_info;
+  framebuffer_info.supports_readback = true;
+
+  int frames_submitted = 0;
+  EXPECT_CALL(*surface, AllowsDrawingWhenGpuDisabled())
+      .WillRepeatedly(Return(true));
+  EXPECT_CALL(*surface, AcquireFrame(SkISize()))
+      .Times(2)
+      .WillRepeatedly([&](const SkISize& size) {
+        return std::make_unique<SurfaceFrame>(
+            /*surface=*/nullptr, framebuffer_info,
+            /*submit_callback=*/
+            [&frames_submitted](const SurfaceFrame&, DlCanvas*) {
+              frames_submitted++;
+              return true;
+            },
+            /*frame_size=*/SkISize::Make(800, 600));
+      });
+  EXPECT_CALL(*surface, MakeRenderContextCurrent())
+      .WillOnce(Return(ByMove(std::make_unique<GLContextDefaultResult>(true))));
+
+  rasterizer->Setup(std::move(surface));
+  fml::AutoResetWaitableEvent latch;
+  thread_host.raster_thread->GetTaskRunner()->PostTask([&] {
+    auto pipeline = std::make_shared<FramePipeline>(/*depth=*/10);
+    for (int i = 0; i < 2; i++) {
+      auto layer_tree = std::make_unique<LayerTree>(
+          /*config=*/LayerTree::Config(), /*frame_size=*/SkISize());
+      auto layer_tree_item = std::make_unique<FrameItem>(
+          SingleLayerTreeList(kImplicitViewId, std::move(layer_tree),
+                              kDevicePixelRatio),
+          CreateFinishedBuildRecorder());
+      PipelineProduceResult result =
+          pipeline->Produce().Complete(std::move(layer_tree_item));
+      EXPECT_TRUE(result.success);
+    }
+    ON_CALL(delegate, ShouldDiscardLayerTree).WillByDefault(Return(false));
+    rasterizer->Draw(pipeline);
+    // Both items must have been consumed synchronously within the single
+    // Draw call; the second frame did not wait for another raster task.
+    EXPECT_EQ(frames_submitted, 2);
+    latch.Signal();
+  });
+  latch.Wait();
+}
+
 TEST(
     RasterizerTest,
     drawWithGpuDisabledAndSurfaceAllowsDrawingWhenGpuDisabledDoesAcquireFrame) {
@@ -1062,6 +1209,51 @@ TEST(RasterizerTest, TeardownFreesResourceCache) {
   EXPECT_EQ(context->getResourceCachePurgeableBytes(), 0ul);
 }
 
+TEST(RasterizerTest, ResourceCacheLimitShrinksIncrementally) {
+  std::string test_name =
+      ::testing::UnitTest::GetInstance()->current_test_info()->name();
+  ThreadHost thread_host("io.flutter.test." + test_name + ".",
+                         ThreadHost::Type::Platform | ThreadHost::Type::RASTER |
+                             ThreadHost::Type::IO | ThreadHost::Type::UI);
+  TaskRunners task_runners("test", thread_host.platform_thread->GetTaskRunner(),
+                           thread_host.raster_thread->GetTaskRunner(),
+                           thread_host.ui_thread->GetTaskRunner(),
+                           thread_host.io_thread->GetTaskRunner());
+
+  NiceMock<MockDelegate> delegate;
+  Settings settings;
+  ON_CALL(delegate, GetSettings()).WillByDefault(ReturnRef(settings));
+  EXPECT_CALL(delegate, GetTaskRunners())
+      .WillRepeatedly(ReturnRef(task_runners));
+
+  auto rasterizer = std::make_unique<Rasterizer>(delegate);
+  auto surface = std::make_unique<NiceMock<MockSurface>>();
+  auto context = GrDirectContext::MakeMock(nullptr);
+  context->setResourceCacheLimit(0);
+
+  EXPECT_CALL(*surface, MakeRenderContextCurrent())
+      .WillRepeatedly([]() -> std::unique_ptr<GLContextResult> {
+        return std::make_unique<GLContextDefaultResult>(true);
+      });
+  EXPECT_CALL(*surface, GetContext()).WillRepeatedly(Return(context.get()));
+
+  rasterizer->Setup(std::move(surface));
+
+  // The first automatic limit applies immediately.
+  rasterizer->SetResourceCacheMaxBytes(10000000, false);
+  EXPECT_EQ(context->getResourceCacheLimit(), 10000000ul);
+
+  // A subsequent automatic shrink is deferred: the context keeps its current
+  // limit and is walked down toward the target across frames instead of
+  // purging synchronously.
+  rasterizer->SetResourceCacheMaxBytes(1000000, false);
+  EXPECT_EQ(context->getResourceCacheLimit(), 10000000ul);
+
+  // An explicit user request still applies immediately.
+  rasterizer->SetResourceCacheMaxBytes(500000, true);
+  EXPECT_EQ(context->getResourceCacheLimit(), 500000ul);
+}
+
 TEST(RasterizerTest, TeardownNoSurface) {
   std::string test_name =
       ::testing::UnitTest::GetInstance()->current_test_info()->name();
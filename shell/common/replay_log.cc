@@ -0,0 +1,71 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/replay_log.h"
+
+namespace flutter {
+
+ReplayLog& ReplayLog::Instance() {
+  static ReplayLog* log = new ReplayLog();
+  return *log;
+}
+
+void ReplayLog::SetEnabled(bool enabled) {
+  enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void ReplayLog::SetCapacity(size_t capacity) {
+  std::scoped_lock lock(mutex_);
+  capacity_ = capacity;
+  while (events_.size() > capacity_) {
+    events_.pop_front();
+  }
+}
+
+void ReplayLog::RecordVsync(fml::TimePoint frame_start,
+                            fml::TimePoint frame_target) {
+  Event event;
+  event.type = EventType::kVsync;
+  event.timestamp_nanos = fml::TimePoint::Now().ToEpochDelta().ToNanoseconds();
+  event.frame_start_nanos = frame_start.ToEpochDelta().ToNanoseconds();
+  event.frame_target_nanos = frame_target.ToEpochDelta().ToNanoseconds();
+  Append(std::move(event));
+}
+
+void ReplayLog::RecordPointerPacket(const std::vector<uint8_t>& data) {
+  Event event;
+  event.type = EventType::kPointerPacket;
+  event.timestamp_nanos = fml::TimePoint::Now().ToEpochDelta().ToNanoseconds();
+  event.data = data;
+  Append(std::move(event));
+}
+
+void ReplayLog::RecordPlatformMessage(const std::string& channel) {
+  Event event;
+  event.type = EventType::kPlatformMessage;
+  event.timestamp_nanos = fml::TimePoint::Now().ToEpochDelta().ToNanoseconds();
+  event.channel = channel;
+  Append(std::move(event));
+}
+
+void ReplayLog::Append(Event event) {
+  std::scoped_lock lock(mutex_);
+  if (capacity_ == 0) {
+    return;
+  }
+  while (events_.size() >= capacity_) {
+    events_.pop_front();
+  }
+  events_.push_back(std::move(event));
+}
+
+std::vector<ReplayLog::Event> ReplayLog::TakeEvents() {
+  std::scoped_lock lock(mutex_);
+  std::vector<Event> events(std::make_move_iterator(events_.begin()),
+                            std::make_move_iterator(events_.end()));
+  events_.clear();
+  return events;
+}
+
+}  // namespace flutter
@@ -0,0 +1,110 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_REPLAY_LOG_H_
+#define FLUTTER_SHELL_COMMON_REPLAY_LOG_H_
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      A ring buffer of the external inputs that drive a session:
+///             vsync timestamps, pointer data packets, and the order in which
+///             platform messages arrived. These inputs determine the task
+///             interleaving on the UI thread, so a log captured during a
+///             janky session can be replayed deterministically: the vsync
+///             events feed a |VsyncWaiterReplay| and the pointer packets can
+///             be re-dispatched through
+///             |PlatformView::DispatchPointerDataPacket| in recorded order.
+///
+///             Recording is process-global and disabled by default; when
+///             disabled each hook costs a single relaxed atomic load. The
+///             recording hooks run on the UI thread, but the log may be
+///             enabled and drained from any thread.
+///
+class ReplayLog {
+ public:
+  enum class EventType {
+    kVsync,
+    kPointerPacket,
+    kPlatformMessage,
+  };
+
+  struct Event {
+    EventType type = EventType::kVsync;
+
+    /// The time the event was recorded, in nanoseconds since the epoch.
+    int64_t timestamp_nanos = 0;
+
+    /// For |kVsync| events: the frame start and target times, in
+    /// nanoseconds since the epoch.
+    int64_t frame_start_nanos = 0;
+    int64_t frame_target_nanos = 0;
+
+    /// For |kPointerPacket| events: the packed pointer data bytes.
+    std::vector<uint8_t> data;
+
+    /// For |kPlatformMessage| events: the message channel.
+    std::string channel;
+  };
+
+  //----------------------------------------------------------------------------
+  /// @brief      The process-global replay log.
+  ///
+  static ReplayLog& Instance();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Enables or disables recording. Disabling does not clear
+  ///             events that were already recorded.
+  ///
+  void SetEnabled(bool enabled);
+
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  //----------------------------------------------------------------------------
+  /// @brief      Sets the maximum number of retained events. When the buffer
+  ///             is full the oldest event is dropped for each new one.
+  ///
+  void SetCapacity(size_t capacity);
+
+  void RecordVsync(fml::TimePoint frame_start, fml::TimePoint frame_target);
+
+  void RecordPointerPacket(const std::vector<uint8_t>& data);
+
+  void RecordPlatformMessage(const std::string& channel);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Returns the recorded events, oldest first, and clears the
+  ///             log.
+  ///
+  std::vector<Event> TakeEvents();
+
+ private:
+  static constexpr size_t kDefaultCapacity = 4096;
+
+  ReplayLog() = default;
+
+  void Append(Event event);
+
+  std::atomic<bool> enabled_ = false;
+
+  mutable std::mutex mutex_;
+  size_t capacity_ = kDefaultCapacity;
+  std::deque<Event> events_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ReplayLog);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_REPLAY_LOG_H_
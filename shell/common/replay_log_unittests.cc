@@ -0,0 +1,88 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/replay_log.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+// The replay log is process-global; leave it disabled and empty for other
+// tests in this binary.
+void ResetLog() {
+  ReplayLog::Instance().SetEnabled(false);
+  ReplayLog::Instance().TakeEvents();
+}
+
+}  // namespace
+
+TEST(ReplayLogTest, DisabledByDefault) {
+  ResetLog();
+  EXPECT_FALSE(ReplayLog::Instance().enabled());
+}
+
+TEST(ReplayLogTest, RecordsEventsInOrder) {
+  ResetLog();
+  auto& log = ReplayLog::Instance();
+  log.SetEnabled(true);
+
+  log.RecordVsync(fml::TimePoint::FromEpochDelta(
+                      fml::TimeDelta::FromNanoseconds(1000)),
+                  fml::TimePoint::FromEpochDelta(
+                      fml::TimeDelta::FromNanoseconds(17000)));
+  log.RecordPointerPacket({1, 2, 3});
+  log.RecordPlatformMessage("flutter/lifecycle");
+
+  auto events = log.TakeEvents();
+  ASSERT_EQ(events.size(), 3u);
+
+  EXPECT_EQ(events[0].type, ReplayLog::EventType::kVsync);
+  EXPECT_EQ(events[0].frame_start_nanos, 1000);
+  EXPECT_EQ(events[0].frame_target_nanos, 17000);
+
+  EXPECT_EQ(events[1].type, ReplayLog::EventType::kPointerPacket);
+  EXPECT_EQ(events[1].data, (std::vector<uint8_t>{1, 2, 3}));
+
+  EXPECT_EQ(events[2].type, ReplayLog::EventType::kPlatformMessage);
+  EXPECT_EQ(events[2].channel, "flutter/lifecycle");
+
+  ResetLog();
+}
+
+TEST(ReplayLogTest, TakeEventsDrainsTheLog) {
+  ResetLog();
+  auto& log = ReplayLog::Instance();
+  log.SetEnabled(true);
+
+  log.RecordPlatformMessage("flutter/settings");
+  EXPECT_EQ(log.TakeEvents().size(), 1u);
+  EXPECT_TRUE(log.TakeEvents().empty());
+
+  ResetLog();
+}
+
+TEST(ReplayLogTest, RingBufferDropsOldestEvents) {
+  ResetLog();
+  auto& log = ReplayLog::Instance();
+  log.SetEnabled(true);
+  log.SetCapacity(2);
+
+  log.RecordPlatformMessage("a");
+  log.RecordPlatformMessage("b");
+  log.RecordPlatformMessage("c");
+
+  auto events = log.TakeEvents();
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(events[0].channel, "b");
+  EXPECT_EQ(events[1].channel, "c");
+
+  log.SetCapacity(4096);
+  ResetLog();
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -7,6 +7,7 @@
 #include <sstream>
 #include <utility>
 
+#include "flutter/assets/asset_pack_bundle.h"
 #include "flutter/assets/directory_asset_bundle.h"
 #include "flutter/common/graphics/persistent_cache.h"
 #include "flutter/fml/file.h"
@@ -15,20 +16,33 @@
 
 namespace flutter {
 
+// Serves assets from the given directory, consulting a pack file in the
+// directory (if present and valid) before the loose files next to it.
+static void PushAssetBundlesForDirectory(AssetManager& asset_manager,
+                                         fml::UniqueFD directory) {
+  if (auto pack = fml::FileMapping::CreateReadOnly(
+          directory, AssetPackBundle::kPackFileName)) {
+    // PushBack drops the resolver if the pack did not parse.
+    asset_manager.PushBack(
+        std::make_unique<AssetPackBundle>(std::move(pack), true));
+  }
+  asset_manager.PushBack(
+      std::make_unique<DirectoryAssetBundle>(std::move(directory), true));
+}
+
 RunConfiguration RunConfiguration::InferFromSettings(
     const Settings& settings,
     const fml::RefPtr<fml::TaskRunner>& io_worker) {
   auto asset_manager = std::make_shared<AssetManager>();
 
   if (fml::UniqueFD::traits_type::IsValid(settings.assets_dir)) {
-    asset_manager->PushBack(std::make_unique<DirectoryAssetBundle>(
-        fml::Duplicate(settings.assets_dir), true));
+    PushAssetBundlesForDirectory(*asset_manager,
+                                 fml::Duplicate(settings.assets_dir));
   }
 
-  asset_manager->PushBack(std::make_unique<DirectoryAssetBundle>(
-      fml::OpenDirectory(settings.assets_path.c_str(), false,
-                         fml::FilePermission::kRead),
-      true));
+  PushAssetBundlesForDirectory(
+      *asset_manager, fml::OpenDirectory(settings.assets_path.c_str(), false,
+                                         fml::FilePermission::kRead));
 
   return {IsolateConfiguration::InferFromSettings(settings, asset_manager,
                                                   io_worker),
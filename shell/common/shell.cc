@@ -5,6 +5,7 @@
 #define RAPIDJSON_HAS_STDSTRING 1
 #include "flutter/shell/common/shell.h"
 
+#include <future>
 #include <memory>
 #include <sstream>
 #include <utility>
@@ -13,6 +14,7 @@
 #include "flutter/assets/directory_asset_bundle.h"
 #include "flutter/common/constants.h"
 #include "flutter/common/graphics/persistent_cache.h"
+#include "flutter/fml/allocation_metrics.h"
 #include "flutter/fml/base32.h"
 #include "flutter/fml/file.h"
 #include "flutter/fml/icu_util.h"
@@ -21,7 +23,11 @@
 #include "flutter/fml/make_copyable.h"
 #include "flutter/fml/message_loop.h"
 #include "flutter/fml/paths.h"
+#include "flutter/fml/synchronization/contention_watchdog.h"
 #include "flutter/fml/trace_event.h"
+#if IMPELLER_SUPPORTS_RENDERING
+#include "impeller/core/resource_watermarks.h"  // nogncheck
+#endif  // IMPELLER_SUPPORTS_RENDERING
 #include "flutter/runtime/dart_vm.h"
 #include "flutter/shell/common/base64.h"
 #include "flutter/shell/common/engine.h"
@@ -121,6 +127,10 @@ void PerformInitializationTasks(Settings& settings) {
       fml::tracing::TraceSetAllowlist(settings.trace_allowlist);
     }
 
+    if (settings.enable_lock_contention_watchdog) {
+      fml::ContentionWatchdog::SetEnabled(true);
+    }
+
     if (!settings.skia_deterministic_rendering_on_cpu) {
       SkGraphics::Init();
     } else {
@@ -149,8 +159,15 @@ Shell::InferVmInitDataFromSettings(Settings& settings) {
   // Always use the `vm_snapshot` and `isolate_snapshot` provided by the
   // settings to launch the VM.  If the VM is already running, the snapshot
   // arguments are ignored.
-  auto vm_snapshot = DartSnapshot::VMSnapshotFromSettings(settings);
+  //
+  // Resolving a snapshot can open libraries and map files from disk. The two
+  // snapshots are independent, so resolve them concurrently and make the
+  // launcher thread wait only for the slower of the two instead of their sum.
+  auto vm_snapshot_future = std::async(std::launch::async, [&settings]() {
+    return DartSnapshot::VMSnapshotFromSettings(settings);
+  });
   auto isolate_snapshot = DartSnapshot::IsolateSnapshotFromSettings(settings);
+  auto vm_snapshot = vm_snapshot_future.get();
   auto vm = DartVMRef::Create(settings, vm_snapshot, isolate_snapshot);
 
   // If the settings did not specify an `isolate_snapshot`, fall back to the
@@ -205,6 +222,8 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
     const Shell::CreateCallback<Rasterizer>& on_create_rasterizer,
     const Shell::EngineCreateCallback& on_create_engine,
     bool is_gpu_disabled) {
+  TRACE_EVENT0("flutter", "Shell::CreateShellOnPlatformThread");
+
   if (!task_runners.IsValid()) {
     FML_LOG(ERROR) << "Task runners to run the shell were invalid.";
     return nullptr;
@@ -224,38 +243,19 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
     return nullptr;
   }
 
-  // Create the rasterizer on the raster thread.
-  std::promise<std::unique_ptr<Rasterizer>> rasterizer_promise;
-  auto rasterizer_future = rasterizer_promise.get_future();
-  std::promise<fml::TaskRunnerAffineWeakPtr<SnapshotDelegate>>
-      snapshot_delegate_promise;
-  auto snapshot_delegate_future = snapshot_delegate_promise.get_future();
-  fml::TaskRunner::RunNowOrPostTask(
-      task_runners.GetRasterTaskRunner(),
-      [&rasterizer_promise,  //
-       &snapshot_delegate_promise,
-       on_create_rasterizer,                                   //
-       shell = shell.get(),                                    //
-       impeller_context = platform_view->GetImpellerContext()  //
-  ]() {
-        TRACE_EVENT0("flutter", "ShellSetupGPUSubsystem");
-        std::unique_ptr<Rasterizer> rasterizer(on_create_rasterizer(*shell));
-        rasterizer->SetImpellerContext(impeller_context);
-        snapshot_delegate_promise.set_value(rasterizer->GetSnapshotDelegate());
-        rasterizer_promise.set_value(std::move(rasterizer));
-      });
+  // The async trace spans below cover each startup stage from the moment it
+  // is dispatched to its target thread, so the timeline shows both the
+  // handoff latency and the stage work itself, and makes the startup
+  // critical path visible.
+  const auto startup_trace_id = reinterpret_cast<uint64_t>(shell.get());
 
-  // Ask the platform view for the vsync waiter. This will be used by the engine
-  // to create the animator.
-  auto vsync_waiter = platform_view->CreateVSyncWaiter();
-  if (!vsync_waiter) {
-    return nullptr;
-  }
-
-  // Create the IO manager on the IO thread. The IO manager must be initialized
-  // first because it has state that the other subsystems depend on. It must
-  // first be booted and the necessary references obtained to initialize the
-  // other subsystems.
+  // Kick off the stages that do not need any more platform thread work
+  // first, so the IO and raster threads boot their subsystems while this
+  // thread keeps interrogating the platform view.
+  //
+  // Create the IO manager on the IO thread. The IO manager has state that
+  // both the raster and UI subsystems depend on, so it is dispatched ahead
+  // of the others.
   std::promise<std::shared_ptr<ShellIOManager>> io_manager_promise;
   auto io_manager_future = io_manager_promise.get_future();
   std::promise<fml::WeakPtr<ShellIOManager>> weak_io_manager_promise;
@@ -267,15 +267,18 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
   // The platform_view will be stored into shell's platform_view_ in
   // shell->Setup(std::move(platform_view), ...) at the end.
   PlatformView* platform_view_ptr = platform_view.get();
+  TRACE_EVENT_ASYNC_BEGIN0("flutter", "ShellSetupIOSubsystem",
+                           startup_trace_id);
   fml::TaskRunner::RunNowOrPostTask(
       io_task_runner,
-      [&io_manager_promise,                                               //
-       &weak_io_manager_promise,                                          //
-       &parent_io_manager,                                                //
-       &unref_queue_promise,                                              //
-       platform_view_ptr,                                                 //
-       io_task_runner,                                                    //
-       is_backgrounded_sync_switch = shell->GetIsGpuDisabledSyncSwitch()  //
+      [&io_manager_promise,                                                //
+       &weak_io_manager_promise,                                           //
+       &parent_io_manager,                                                 //
+       &unref_queue_promise,                                               //
+       platform_view_ptr,                                                  //
+       io_task_runner,                                                     //
+       is_backgrounded_sync_switch = shell->GetIsGpuDisabledSyncSwitch(),  //
+       startup_trace_id                                                    //
   ]() {
         TRACE_EVENT0("flutter", "ShellSetupIOSubsystem");
         std::shared_ptr<ShellIOManager> io_manager;
@@ -292,8 +295,43 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
         weak_io_manager_promise.set_value(io_manager->GetWeakPtr());
         unref_queue_promise.set_value(io_manager->GetSkiaUnrefQueue());
         io_manager_promise.set_value(io_manager);
+        TRACE_EVENT_ASYNC_END0("flutter", "ShellSetupIOSubsystem",
+                               startup_trace_id);
       });
 
+  // Create the rasterizer on the raster thread.
+  std::promise<std::unique_ptr<Rasterizer>> rasterizer_promise;
+  auto rasterizer_future = rasterizer_promise.get_future();
+  std::promise<fml::TaskRunnerAffineWeakPtr<SnapshotDelegate>>
+      snapshot_delegate_promise;
+  auto snapshot_delegate_future = snapshot_delegate_promise.get_future();
+  TRACE_EVENT_ASYNC_BEGIN0("flutter", "ShellSetupGPUSubsystem",
+                           startup_trace_id);
+  fml::TaskRunner::RunNowOrPostTask(
+      task_runners.GetRasterTaskRunner(),
+      [&rasterizer_promise,  //
+       &snapshot_delegate_promise,
+       on_create_rasterizer,                                    //
+       shell = shell.get(),                                     //
+       impeller_context = platform_view->GetImpellerContext(),  //
+       startup_trace_id                                         //
+  ]() {
+        TRACE_EVENT0("flutter", "ShellSetupGPUSubsystem");
+        std::unique_ptr<Rasterizer> rasterizer(on_create_rasterizer(*shell));
+        rasterizer->SetImpellerContext(impeller_context);
+        snapshot_delegate_promise.set_value(rasterizer->GetSnapshotDelegate());
+        rasterizer_promise.set_value(std::move(rasterizer));
+        TRACE_EVENT_ASYNC_END0("flutter", "ShellSetupGPUSubsystem",
+                               startup_trace_id);
+      });
+
+  // Ask the platform view for the vsync waiter. This will be used by the engine
+  // to create the animator.
+  auto vsync_waiter = platform_view->CreateVSyncWaiter();
+  if (!vsync_waiter) {
+    return nullptr;
+  }
+
   // Send dispatcher_maker to the engine constructor because shell won't have
   // platform_view set until Shell::Setup is called later.
   auto dispatcher_maker = platform_view->GetDispatcherMaker();
@@ -301,6 +339,8 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
   // Create the engine on the UI thread.
   std::promise<std::unique_ptr<Engine>> engine_promise;
   auto engine_future = engine_promise.get_future();
+  TRACE_EVENT_ASYNC_BEGIN0("flutter", "ShellSetupUISubsystem",
+                           startup_trace_id);
   fml::TaskRunner::RunNowOrPostTask(
       shell->GetTaskRunners().GetUITaskRunner(),
       fml::MakeCopyable([&engine_promise,                                 //
@@ -312,35 +352,65 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
                          &weak_io_manager_future,                         //
                          &snapshot_delegate_future,                       //
                          &unref_queue_future,                             //
-                         &on_create_engine]() mutable {
+                         &on_create_engine,                               //
+                         startup_trace_id]() mutable {
         TRACE_EVENT0("flutter", "ShellSetupUISubsystem");
         const auto& task_runners = shell->GetTaskRunners();
 
         // The animator is owned by the UI thread but it gets its vsync pulses
         // from the platform.
-        auto animator = std::make_unique<Animator>(*shell, task_runners,
-                                                   std::move(vsync_waiter));
+        auto animator = std::make_unique<Animator>(
+            *shell, task_runners, std::move(vsync_waiter),
+            shell->GetSettings().enable_latency_compensation);
+
+        // This is the only point where the UI stage consumes state produced
+        // by the IO and raster stages. Trace the join separately so time
+        // spent waiting on the other threads is distinguishable from time
+        // spent doing UI subsystem work.
+        fml::WeakPtr<ShellIOManager> weak_io_manager;
+        fml::RefPtr<SkiaUnrefQueue> unref_queue;
+        fml::TaskRunnerAffineWeakPtr<SnapshotDelegate> snapshot_delegate;
+        {
+          TRACE_EVENT0("flutter", "ShellSetupUISubsystemJoin");
+          weak_io_manager = weak_io_manager_future.get();
+          unref_queue = unref_queue_future.get();
+          snapshot_delegate = snapshot_delegate_future.get();
+        }
 
         engine_promise.set_value(
-            on_create_engine(*shell,                          //
-                             dispatcher_maker,                //
-                             *shell->GetDartVM(),             //
-                             std::move(isolate_snapshot),     //
-                             task_runners,                    //
-                             platform_data,                   //
-                             shell->GetSettings(),            //
-                             std::move(animator),             //
-                             weak_io_manager_future.get(),    //
-                             unref_queue_future.get(),        //
-                             snapshot_delegate_future.get(),  //
+            on_create_engine(*shell,                       //
+                             dispatcher_maker,             //
+                             *shell->GetDartVM(),          //
+                             std::move(isolate_snapshot),  //
+                             task_runners,                 //
+                             platform_data,                //
+                             shell->GetSettings(),         //
+                             std::move(animator),          //
+                             std::move(weak_io_manager),   //
+                             std::move(unref_queue),       //
+                             std::move(snapshot_delegate),
                              shell->volatile_path_tracker_,
                              shell->is_gpu_disabled_sync_switch_));
+        TRACE_EVENT_ASYNC_END0("flutter", "ShellSetupUISubsystem",
+                               startup_trace_id);
       }));
 
+  // This join on the platform thread is where all three stages converge;
+  // the async spans above show which of them gates shell creation.
+  std::unique_ptr<Engine> engine;
+  std::unique_ptr<Rasterizer> rasterizer;
+  std::shared_ptr<ShellIOManager> io_manager;
+  {
+    TRACE_EVENT0("flutter", "ShellSetupJoin");
+    engine = engine_future.get();
+    rasterizer = rasterizer_future.get();
+    io_manager = io_manager_future.get();
+  }
+
   if (!shell->Setup(std::move(platform_view),  //
-                    engine_future.get(),       //
-                    rasterizer_future.get(),   //
-                    io_manager_future.get())   //
+                    std::move(engine),         //
+                    std::move(rasterizer),     //
+                    std::move(io_manager))     //
   ) {
     return nullptr;
   }
@@ -367,6 +437,11 @@ std::unique_ptr<Shell> Shell::CreateWithSnapshot(
 
   TRACE_EVENT0("flutter", "Shell::CreateWithSnapshot");
 
+  // The VM serving this shell is initialized (or an existing one leased) by
+  // this point; capture the timestamp here and backfill the phase once the
+  // shell that holds the tracker exists.
+  auto vm_init_time = fml::TimePoint::Now();
+
   const bool callbacks_valid =
       on_create_platform_view && on_create_rasterizer && on_create_engine;
   if (!task_runners.IsValid() || !callbacks_valid) {
@@ -406,6 +481,10 @@ std::unique_ptr<Shell> Shell::CreateWithSnapshot(
         latch.Signal();
       }));
   latch.Wait();
+  if (shell) {
+    shell->startup_phase_tracker_->RecordAt(StartupPhase::kVMInit,
+                                            vm_init_time);
+  }
   return shell;
 }
 
@@ -433,6 +512,10 @@ Shell::Shell(DartVMRef vm,
   FML_DCHECK(task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
 
   display_manager_ = std::make_unique<DisplayManager>();
+  memory_dashboard_ = std::make_unique<MemoryDashboard>();
+  frame_pacing_governor_ = std::make_shared<FramePacingGovernor>();
+  startup_phase_tracker_ = std::make_shared<StartupPhaseTracker>();
+  startup_phase_tracker_->Record(StartupPhase::kEngineCreate);
   resource_cache_limit_calculator->AddResourceCacheLimitItem(
       weak_factory_.GetWeakPtr());
 
@@ -447,14 +530,28 @@ Shell::Shell(DartVMRef vm,
 
   // Install service protocol handlers.
 
-  service_protocol_handlers_[ServiceProtocol::kScreenshotExtensionName] = {
-      task_runners_.GetRasterTaskRunner(),
-      std::bind(&Shell::OnServiceProtocolScreenshot, this,
-                std::placeholders::_1, std::placeholders::_2)};
-  service_protocol_handlers_[ServiceProtocol::kScreenshotSkpExtensionName] = {
-      task_runners_.GetRasterTaskRunner(),
-      std::bind(&Shell::OnServiceProtocolScreenshotSKP, this,
-                std::placeholders::_1, std::placeholders::_2)};
+  if (settings_.enable_async_service_protocol) {
+    // The asynchronous variants only record the last layer tree on the raster
+    // thread and do the heavy rasterization and serialization work on the IO
+    // thread. See Settings::enable_async_service_protocol.
+    service_protocol_handlers_[ServiceProtocol::kScreenshotExtensionName] = {
+        task_runners_.GetIOTaskRunner(),
+        std::bind(&Shell::OnServiceProtocolScreenshotAsync, this,
+                  std::placeholders::_1, std::placeholders::_2)};
+    service_protocol_handlers_[ServiceProtocol::kScreenshotSkpExtensionName] = {
+        task_runners_.GetIOTaskRunner(),
+        std::bind(&Shell::OnServiceProtocolScreenshotSKPAsync, this,
+                  std::placeholders::_1, std::placeholders::_2)};
+  } else {
+    service_protocol_handlers_[ServiceProtocol::kScreenshotExtensionName] = {
+        task_runners_.GetRasterTaskRunner(),
+        std::bind(&Shell::OnServiceProtocolScreenshot, this,
+                  std::placeholders::_1, std::placeholders::_2)};
+    service_protocol_handlers_[ServiceProtocol::kScreenshotSkpExtensionName] = {
+        task_runners_.GetRasterTaskRunner(),
+        std::bind(&Shell::OnServiceProtocolScreenshotSKP, this,
+                  std::placeholders::_1, std::placeholders::_2)};
+  }
   service_protocol_handlers_[ServiceProtocol::kRunInViewExtensionName] = {
       task_runners_.GetUITaskRunner(),
       std::bind(&Shell::OnServiceProtocolRunInView, this, std::placeholders::_1,
@@ -483,6 +580,33 @@ Shell::Shell(DartVMRef vm,
           task_runners_.GetRasterTaskRunner(),
           std::bind(&Shell::OnServiceProtocolEstimateRasterCacheMemory, this,
                     std::placeholders::_1, std::placeholders::_2)};
+  // Runs on the raster task runner so the registered meters can read the
+  // raster caches and graphics context without synchronization.
+  service_protocol_handlers_[ServiceProtocol::kGetMemoryUsageExtensionName] = {
+      task_runners_.GetRasterTaskRunner(),
+      std::bind(&Shell::OnServiceProtocolGetMemoryUsage, this,
+                std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_
+      [ServiceProtocol::kGetRasterCacheEntriesExtensionName] = {
+          task_runners_.GetRasterTaskRunner(),
+          std::bind(&Shell::OnServiceProtocolGetRasterCacheEntries, this,
+                    std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_[ServiceProtocol::kGetDrawStatsExtensionName] = {
+      task_runners_.GetRasterTaskRunner(),
+      std::bind(&Shell::OnServiceProtocolGetDrawStats, this,
+                std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_[ServiceProtocol::kGetInputLatencyExtensionName] =
+      {task_runners_.GetRasterTaskRunner(),
+       std::bind(&Shell::OnServiceProtocolGetInputLatency, this,
+                 std::placeholders::_1, std::placeholders::_2)};
+  // The allocation counters are global and internally synchronized, so the
+  // handler can run on any runner; the platform runner keeps it off the
+  // frame-producing threads.
+  service_protocol_handlers_
+      [ServiceProtocol::kGetAllocationMetricsExtensionName] = {
+          task_runners_.GetPlatformTaskRunner(),
+          std::bind(&Shell::OnServiceProtocolGetAllocationMetrics, this,
+                    std::placeholders::_1, std::placeholders::_2)};
   service_protocol_handlers_
       [ServiceProtocol::kRenderFrameWithRasterStatsExtensionName] = {
           task_runners_.GetRasterTaskRunner(),
@@ -586,6 +710,21 @@ std::unique_ptr<Shell> Shell::Spawn(
             /*gpu_disabled_switch=*/is_gpu_disabled_sync_switch);
       },
       is_gpu_disabled);
+  if (settings_.enable_shared_engine_group_caches) {
+    // All shells spawned from this one run on the same raster thread, so the
+    // group can pool cached pictures and layers under one GPU budget instead
+    // of duplicating them per engine. This is posted before the spawned shell
+    // can produce its first frame, so the adoption happens before any draw.
+    fml::TaskRunner::RunNowOrPostTask(
+        task_runners_.GetRasterTaskRunner(),
+        [parent = rasterizer_->GetWeakPtr(),
+         spawn = result->rasterizer_->GetWeakPtr()] {
+          if (parent && spawn) {
+            spawn->SetSharedRasterCache(
+                parent->compositor_context()->shared_raster_cache());
+          }
+        });
+  }
   result->RunEngine(std::move(run_configuration));
   return result;
 }
@@ -600,18 +739,42 @@ void Shell::NotifyLowMemoryWarning() const {
   // running.
   ::Dart_NotifyLowMemory();
 
-  task_runners_.GetRasterTaskRunner()->PostTask(
-      [rasterizer = rasterizer_->GetWeakPtr(), trace_id = trace_id]() {
-        if (rasterizer) {
-          rasterizer->NotifyLowMemoryWarning();
-        }
-        TRACE_EVENT_ASYNC_END0("flutter", "Shell::NotifyLowMemoryWarning",
-                               trace_id);
-      });
+  // Trim the engine-side subsystems in stages instead of purging everything
+  // at once: the first warning only drops cheap caches, and warnings
+  // arriving while pressure persists escalate to atlases and GPU pools. The
+  // trims are posted to the task runners the subsystems registered with.
+  memory_dashboard_->NotifyMemoryPressure();
+
+  // The trims above were posted to the raster task runner before this task,
+  // so the trace event closes after they have run.
+  task_runners_.GetRasterTaskRunner()->PostTask([trace_id = trace_id]() {
+    TRACE_EVENT_ASYNC_END0("flutter", "Shell::NotifyLowMemoryWarning",
+                           trace_id);
+  });
   // The IO Manager uses resource cache limits of 0, so it is not necessary
   // to purge them.
 }
 
+MemoryDashboard* Shell::GetMemoryDashboard() const {
+  return memory_dashboard_.get();
+}
+
+StartupPhaseTracker* Shell::GetStartupPhaseTracker() const {
+  return startup_phase_tracker_.get();
+}
+
+void Shell::GetFrameTimingsHistory(
+    std::vector<StopwatchWindowSummary>& raster_windows,
+    std::vector<StopwatchWindowSummary>& ui_windows) const {
+  FML_DCHECK(is_set_up_);
+  // Only the lock-free window summaries are read here, which is safe from
+  // any thread while the shell (and therefore the rasterizer) is alive.
+  CompositorContext* compositor_context = rasterizer_->compositor_context();
+  raster_windows =
+      compositor_context->raster_time().history().GetWindowSummaries();
+  ui_windows = compositor_context->ui_time().history().GetWindowSummaries();
+}
+
 void Shell::RunEngine(RunConfiguration run_configuration) {
   RunEngine(std::move(run_configuration), nullptr);
 }
@@ -634,7 +797,8 @@ void Shell::RunEngine(
       task_runners_.GetUITaskRunner(),
       fml::MakeCopyable(
           [run_configuration = std::move(run_configuration),
-           weak_engine = weak_engine_, result]() mutable {
+           weak_engine = weak_engine_,
+           startup_phase_tracker = startup_phase_tracker_, result]() mutable {
             if (!weak_engine) {
               FML_LOG(ERROR)
                   << "Could not launch engine with configuration - no engine.";
@@ -644,6 +808,8 @@ void Shell::RunEngine(
             auto run_result = weak_engine->Run(std::move(run_configuration));
             if (run_result == flutter::Engine::RunStatus::Failure) {
               FML_LOG(ERROR) << "Could not launch engine with configuration.";
+            } else {
+              startup_phase_tracker->Record(StartupPhase::kIsolateLaunch);
             }
 
             result(run_result);
@@ -723,6 +889,54 @@ bool Shell::Setup(std::unique_ptr<PlatformView> platform_view,
   weak_platform_view_ = platform_view_->GetWeakPtr();
 
   engine_->AddView(kFlutterImplicitViewId, ViewportMetrics{});
+
+  // Register the engine's memory consumers with the dashboard so that low
+  // memory warnings trim in stages and the getMemoryUsage service protocol
+  // extension can report per-subsystem usage. All three meters are raster
+  // thread affine and are queried by the handler on the raster task runner.
+  auto raster_task_runner = task_runners_.GetRasterTaskRunner();
+  memory_dashboard_->RegisterSubsystem(
+      "rasterCache", MemoryTrimStage::kCaches, raster_task_runner,
+      [rasterizer = weak_rasterizer_]() -> size_t {
+        if (!rasterizer) {
+          return 0u;
+        }
+        const auto& cache = rasterizer->compositor_context()->raster_cache();
+        return cache.EstimateLayerCacheByteSize() +
+               cache.EstimatePictureCacheByteSize();
+      },
+      [rasterizer = weak_rasterizer_](MemoryTrimStage stage) {
+        if (rasterizer) {
+          rasterizer->compositor_context()->raster_cache().Clear();
+        }
+      });
+  memory_dashboard_->RegisterSubsystem(
+      "fontCache", MemoryTrimStage::kAtlases, raster_task_runner,
+      []() -> size_t { return SkGraphics::GetFontCacheUsed(); },
+      [](MemoryTrimStage stage) { SkGraphics::PurgeFontCache(); });
+  memory_dashboard_->RegisterSubsystem(
+      "graphicsContext", MemoryTrimStage::kGPUPools, raster_task_runner,
+      [rasterizer = weak_rasterizer_]() -> size_t {
+        return rasterizer ? rasterizer->GetResourceCacheBytes() : 0u;
+      },
+      [rasterizer = weak_rasterizer_](MemoryTrimStage stage) {
+        if (rasterizer) {
+          rasterizer->NotifyLowMemoryWarning();
+        }
+      });
+
+  // Hand the pacing governor to the vsync waiter; the animator owns the
+  // waiter on the UI thread, so attach it there.
+  fml::TaskRunner::RunNowOrPostTask(
+      task_runners_.GetUITaskRunner(),
+      [engine = weak_engine_, governor = frame_pacing_governor_] {
+        if (engine) {
+          if (auto vsync_waiter = engine->GetVsyncWaiter().lock()) {
+            vsync_waiter->SetPacingGovernor(governor);
+          }
+        }
+      });
+
   // Setup the time-consuming default font manager right after engine created.
   if (!settings_.prefetched_default_font_manager) {
     fml::TaskRunner::RunNowOrPostTask(task_runners_.GetUITaskRunner(),
@@ -981,16 +1195,34 @@ void Shell::OnPlatformViewSetViewportMetrics(int64_t view_id,
       metrics.physical_width * metrics.physical_height * 12 * 4;
   size_t resource_cache_max_bytes =
       resource_cache_limit_calculator_->GetResourceCacheMaxBytes();
-  task_runners_.GetRasterTaskRunner()->PostTask(
-      [rasterizer = rasterizer_->GetWeakPtr(), resource_cache_max_bytes] {
-        if (rasterizer) {
-          rasterizer->SetResourceCacheMaxBytes(resource_cache_max_bytes, false);
-        }
-      });
+  // Display changes (e.g. a fold/unfold) can recompute the limit several
+  // times in quick succession. Raising the limit is cheap and always
+  // propagated, but only propagate shrinks that exceed 1/8th of the previous
+  // limit so that small oscillations do not purge GPU resources.
+  bool shrink_within_hysteresis =
+      last_resource_cache_max_bytes_.has_value() &&
+      resource_cache_max_bytes < last_resource_cache_max_bytes_.value() &&
+      last_resource_cache_max_bytes_.value() - resource_cache_max_bytes <
+          last_resource_cache_max_bytes_.value() / 8;
+  if (!shrink_within_hysteresis) {
+    last_resource_cache_max_bytes_ = resource_cache_max_bytes;
+    task_runners_.GetRasterTaskRunner()->PostTask(
+        [rasterizer = rasterizer_->GetWeakPtr(), resource_cache_max_bytes] {
+          if (rasterizer) {
+            rasterizer->SetResourceCacheMaxBytes(resource_cache_max_bytes,
+                                                 false);
+          }
+        });
+  }
 
+  // Views on a slower display than the vsync stream are paced down to their
+  // own display's rate by the animator.
+  double view_refresh_rate =
+      display_manager_->GetDisplayRefreshRate(metrics.display_id);
   task_runners_.GetUITaskRunner()->PostTask(
-      [engine = engine_->GetWeakPtr(), view_id, metrics]() {
+      [engine = engine_->GetWeakPtr(), view_id, metrics, view_refresh_rate]() {
         if (engine) {
+          engine->SetViewRefreshRate(view_id, view_refresh_rate);
           engine->SetViewportMetrics(view_id, metrics);
         }
       });
@@ -1188,6 +1420,8 @@ void Shell::OnAnimatorBeginFrame(fml::TimePoint frame_target_time,
     std::scoped_lock time_recorder_lock(time_recorder_mutex_);
     latest_frame_target_time_.emplace(frame_target_time);
   }
+  // A no-op after the first frame; see |StartupPhaseTracker|.
+  startup_phase_tracker_->Record(StartupPhase::kFirstFrameScheduled);
   if (engine_) {
     engine_->BeginFrame(frame_target_time, frame_number);
   }
@@ -1202,6 +1436,22 @@ void Shell::OnAnimatorNotifyIdle(fml::TimeDelta deadline) {
     engine_->NotifyIdle(deadline);
     volatile_path_tracker_->OnFrame();
   }
+
+  if (!rasterizer_) {
+    return;
+  }
+
+  // The animator only reports idle when no frame is being produced, which
+  // makes this a good time for the rasterizer to warm the glyph atlases with
+  // glyphs that recent frames used and to let the GPU allocator perform
+  // housekeeping. Both return immediately when there is nothing to do.
+  task_runners_.GetRasterTaskRunner()->PostTask(
+      [rasterizer = rasterizer_->GetWeakPtr()]() {
+        if (rasterizer) {
+          rasterizer->PreWarmGlyphAtlases();
+          rasterizer->PerformIdleMemoryMaintenance();
+        }
+      });
 }
 
 void Shell::OnAnimatorUpdateLatestFrameTargetTime(
@@ -1523,6 +1773,25 @@ void Shell::OnFrameRasterized(const FrameTiming& timing) {
     settings_.frame_rasterized_callback(timing);
   }
 
+  // No-ops after the first frame; see |StartupPhaseTracker|. The wall time
+  // phase is recorded after the surface present call returns, so it marks
+  // the frame reaching the display path rather than just raster work ending.
+  startup_phase_tracker_->RecordAt(StartupPhase::kFirstRaster,
+                                   timing.Get(FrameTiming::kRasterStart));
+  startup_phase_tracker_->RecordAt(
+      StartupPhase::kFirstPresent,
+      timing.Get(FrameTiming::kRasterFinishWallTime));
+
+  // Feed the pacing governor the measured duration so it can hold a stable
+  // lower cadence when frames start missing their deadlines.
+  double refresh_rate = display_manager_->GetMainDisplayRefreshRate();
+  if (refresh_rate > 0) {
+    frame_pacing_governor_->RecordFrame(
+        fml::TimeDelta::FromSecondsF(1.0 / refresh_rate),
+        timing.Get(FrameTiming::kRasterFinish) -
+            timing.Get(FrameTiming::kVsyncStart));
+  }
+
   if (!needs_report_timings_) {
     return;
   }
@@ -1716,6 +1985,97 @@ bool Shell::OnServiceProtocolScreenshotSKP(
   return false;
 }
 
+// Elapsed time below which the asynchronous screenshot handlers reuse the
+// previously captured response instead of capturing the layer tree again.
+// Fleet monitoring tools tend to poll these methods; recapturing on every
+// poll would keep the raster and IO threads needlessly busy.
+static constexpr fml::TimeDelta kAsyncScreenshotMinInterval =
+    fml::TimeDelta::FromMilliseconds(500);
+
+static sk_sp<SkData> ScreenshotDataToBase64(const sk_sp<SkData>& data) {
+  if (!data) {
+    return nullptr;
+  }
+  size_t b64_size = Base64::EncodedSize(data->size());
+  auto b64_data = SkData::MakeUninitialized(b64_size);
+  Base64::Encode(data->data(), data->size(), b64_data->writable_data());
+  return b64_data;
+}
+
+sk_sp<SkPicture> Shell::RecordLastLayerTreePicture() {
+  sk_sp<SkPicture> picture;
+  fml::AutoResetWaitableEvent latch;
+  fml::TaskRunner::RunNowOrPostTask(
+      task_runners_.GetRasterTaskRunner(), [this, &picture, &latch]() {
+        if (rasterizer_) {
+          picture = rasterizer_->RecordLastLayerTreePicture();
+        }
+        latch.Signal();
+      });
+  latch.Wait();
+  return picture;
+}
+
+// Service protocol handler
+bool Shell::OnServiceProtocolScreenshotAsync(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetIOTaskRunner()->RunsTasksOnCurrentThread());
+  const auto now = fml::TimePoint::Now();
+  if (!async_screenshot_cache_.data ||
+      now - async_screenshot_cache_.capture_time >=
+          kAsyncScreenshotMinInterval) {
+    auto data = Rasterizer::RasterizePictureToImage(
+        RecordLastLayerTreePicture(), /*compressed=*/true);
+    async_screenshot_cache_ = {now, ScreenshotDataToBase64(data)};
+  }
+  if (async_screenshot_cache_.data) {
+    response->SetObject();
+    auto& allocator = response->GetAllocator();
+    response->AddMember("type", "Screenshot", allocator);
+    rapidjson::Value image;
+    image.SetString(
+        static_cast<const char*>(async_screenshot_cache_.data->data()),
+        async_screenshot_cache_.data->size(), allocator);
+    response->AddMember("screenshot", image, allocator);
+    return true;
+  }
+  ServiceProtocolFailureError(response, "Could not capture image screenshot.");
+  return false;
+}
+
+// Service protocol handler
+bool Shell::OnServiceProtocolScreenshotSKPAsync(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetIOTaskRunner()->RunsTasksOnCurrentThread());
+  if (settings_.enable_impeller) {
+    ServiceProtocolFailureError(
+        response, "Cannot capture SKP screenshot with Impeller enabled.");
+    return false;
+  }
+  const auto now = fml::TimePoint::Now();
+  if (!async_screenshot_skp_cache_.data ||
+      now - async_screenshot_skp_cache_.capture_time >=
+          kAsyncScreenshotMinInterval) {
+    auto data = Rasterizer::SerializePicture(RecordLastLayerTreePicture());
+    async_screenshot_skp_cache_ = {now, ScreenshotDataToBase64(data)};
+  }
+  if (async_screenshot_skp_cache_.data) {
+    response->SetObject();
+    auto& allocator = response->GetAllocator();
+    response->AddMember("type", "ScreenshotSkp", allocator);
+    rapidjson::Value skp;
+    skp.SetString(
+        static_cast<const char*>(async_screenshot_skp_cache_.data->data()),
+        async_screenshot_skp_cache_.data->size(), allocator);
+    response->AddMember("skp", skp, allocator);
+    return true;
+  }
+  ServiceProtocolFailureError(response, "Could not capture SKP screenshot.");
+  return false;
+}
+
 // Service protocol handler
 bool Shell::OnServiceProtocolRunInView(
     const ServiceProtocol::Handler::ServiceProtocolMap& params,
@@ -1881,6 +2241,219 @@ bool Shell::OnServiceProtocolEstimateRasterCacheMemory(
   return true;
 }
 
+// Service protocol handler
+bool Shell::OnServiceProtocolGetRasterCacheEntries(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+  const auto& raster_cache = rasterizer_->compositor_context()->raster_cache();
+  auto& allocator = response->GetAllocator();
+  response->SetObject();
+  response->AddMember("type", "RasterCacheEntries", allocator);
+  response->AddMember<uint64_t>("frameNumber", raster_cache.frame_number(),
+                                allocator);
+
+  rapidjson::Value entries(rapidjson::kArrayType);
+  for (const auto& info : raster_cache.GetEntryInfos()) {
+    rapidjson::Value entry(rapidjson::kObjectType);
+    entry.AddMember<uint64_t>("uniqueId", info.unique_id, allocator);
+    const char* type_name = "layer";
+    switch (info.type) {
+      case RasterCacheKeyType::kLayer:
+        type_name = "layer";
+        break;
+      case RasterCacheKeyType::kLayerChildren:
+        type_name = "layerChildren";
+        break;
+      case RasterCacheKeyType::kDisplayList:
+        type_name = "displayList";
+        break;
+    }
+    entry.AddMember("entryType", rapidjson::Value(type_name, allocator),
+                    allocator);
+    entry.AddMember<uint64_t>("bytes", info.bytes, allocator);
+    entry.AddMember<uint64_t>("accessCount", info.access_count, allocator);
+    entry.AddMember<uint64_t>("lastUsedFrame", info.last_used_frame,
+                              allocator);
+    entry.AddMember("pinned", info.pinned, allocator);
+    entry.AddMember("hasImage", info.has_image, allocator);
+    entries.PushBack(entry, allocator);
+  }
+  response->AddMember("entries", entries, allocator);
+
+  auto add_metrics = [&allocator](rapidjson::Document* response,
+                                  const char* name,
+                                  const RasterCacheMetrics& metrics) {
+    rapidjson::Value value(rapidjson::kObjectType);
+    value.AddMember<uint64_t>("createdCount", metrics.created_count,
+                              allocator);
+    value.AddMember<uint64_t>("createdBytes", metrics.created_bytes,
+                              allocator);
+    value.AddMember<uint64_t>("evictionCount", metrics.eviction_count,
+                              allocator);
+    value.AddMember<uint64_t>("evictionBytes", metrics.eviction_bytes,
+                              allocator);
+    value.AddMember<uint64_t>("inUseCount", metrics.in_use_count, allocator);
+    value.AddMember<uint64_t>("inUseBytes", metrics.in_use_bytes, allocator);
+    response->AddMember(rapidjson::Value(name, allocator), value, allocator);
+  };
+  add_metrics(response, "layerMetrics", raster_cache.layer_metrics());
+  add_metrics(response, "pictureMetrics", raster_cache.picture_metrics());
+  return true;
+}
+
+// Service protocol handler
+bool Shell::OnServiceProtocolGetDrawStats(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+  DrawStatsAggregator& aggregator = rasterizer_->draw_stats_aggregator();
+  auto enable = params.find("enable");
+  if (enable != params.end()) {
+    aggregator.SetEnabled(enable->second == "true");
+  }
+  auto reset = params.find("reset");
+  if (reset != params.end() && reset->second == "true") {
+    aggregator.Clear();
+  }
+
+  const DrawStatsAggregator::Summary summary = aggregator.Summarize();
+  auto& allocator = response->GetAllocator();
+  response->SetObject();
+  response->AddMember("type", "DrawStats", allocator);
+  response->AddMember("enabled", aggregator.enabled(), allocator);
+  response->AddMember<uint64_t>("frameCount", summary.frame_count, allocator);
+  response->AddMember<uint64_t>("totalOpCount", summary.total_op_count,
+                                allocator);
+  response->AddMember<uint64_t>("totalBytes", summary.total_bytes, allocator);
+  response->AddMember<uint64_t>("transparentOpCount",
+                                summary.transparent_op_count, allocator);
+  response->AddMember<uint64_t>("maxSaveLayersInFrame",
+                                summary.max_save_layers_in_frame, allocator);
+
+  rapidjson::Value op_counts(rapidjson::kObjectType);
+  for (size_t i = 0; i < DrawOpStats::kOpKindCount; i++) {
+    const char* name =
+        DrawOpStats::GetOpKindName(static_cast<DrawOpStats::OpKind>(i));
+    op_counts.AddMember(rapidjson::Value(name, allocator),
+                        rapidjson::Value(summary.op_counts[i]), allocator);
+  }
+  response->AddMember("opCounts", op_counts, allocator);
+
+  rapidjson::Value histogram(rapidjson::kArrayType);
+  for (uint64_t bucket : summary.save_layer_depth_histogram) {
+    histogram.PushBack(rapidjson::Value(bucket), allocator);
+  }
+  response->AddMember("saveLayerDepthHistogram", histogram, allocator);
+  return true;
+}
+
+// Service protocol handler
+bool Shell::OnServiceProtocolGetInputLatency(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+  InputLatencyTracker& tracker = rasterizer_->input_latency_tracker();
+  auto reset = params.find("reset");
+  if (reset != params.end() && reset->second == "true") {
+    tracker.Clear();
+  }
+
+  const InputLatencyTracker::Summary summary = tracker.Summarize();
+  auto& allocator = response->GetAllocator();
+  response->SetObject();
+  response->AddMember("type", "InputLatency", allocator);
+  response->AddMember<uint64_t>("sampleCount", summary.sample_count,
+                                allocator);
+  response->AddMember<int64_t>("averageMicros", summary.average_micros,
+                               allocator);
+  response->AddMember<int64_t>("p50Micros", summary.p50_micros, allocator);
+  response->AddMember<int64_t>("p90Micros", summary.p90_micros, allocator);
+  response->AddMember<int64_t>("p99Micros", summary.p99_micros, allocator);
+  response->AddMember<int64_t>("maxMicros", summary.max_micros, allocator);
+  return true;
+}
+
+// Service protocol handler
+bool Shell::OnServiceProtocolGetAllocationMetrics(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
+  auto enable = params.find("enable");
+  if (enable != params.end()) {
+    fml::AllocationMetrics::SetEnabled(enable->second == "true");
+  }
+  auto reset = params.find("reset");
+  if (reset != params.end() && reset->second == "true") {
+    fml::AllocationMetrics::Reset();
+  }
+  auto& allocator = response->GetAllocator();
+  response->SetObject();
+  response->AddMember("type", "AllocationMetrics", allocator);
+  response->AddMember("enabled", fml::AllocationMetrics::IsEnabled(),
+                      allocator);
+  rapidjson::Value tags(rapidjson::kArrayType);
+  for (const auto& metrics : fml::AllocationMetrics::GetMetrics()) {
+    rapidjson::Value tag(rapidjson::kObjectType);
+    tag.AddMember("tag", rapidjson::Value(metrics.tag.c_str(), allocator),
+                  allocator);
+    tag.AddMember<uint64_t>("bytes", metrics.bytes, allocator);
+    tag.AddMember<uint64_t>("count", metrics.count, allocator);
+    tags.PushBack(tag, allocator);
+  }
+  response->AddMember("tags", tags, allocator);
+  return true;
+}
+
+// Service protocol handler
+bool Shell::OnServiceProtocolGetMemoryUsage(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+  auto& allocator = response->GetAllocator();
+  response->SetObject();
+  response->AddMember("type", "MemoryUsage", allocator);
+  rapidjson::Value subsystems(rapidjson::kArrayType);
+  uint64_t total_bytes = 0;
+  for (const auto& metrics : memory_dashboard_->GetMetrics()) {
+    rapidjson::Value subsystem(rapidjson::kObjectType);
+    subsystem.AddMember(
+        "name", rapidjson::Value(metrics.name.c_str(), allocator), allocator);
+    subsystem.AddMember(
+        "trimStage",
+        rapidjson::Value(MemoryDashboard::StageName(metrics.trim_stage),
+                         allocator),
+        allocator);
+    subsystem.AddMember<uint64_t>("bytes", metrics.bytes, allocator);
+    subsystems.PushBack(subsystem, allocator);
+    total_bytes += metrics.bytes;
+  }
+  response->AddMember("subsystems", subsystems, allocator);
+  response->AddMember<uint64_t>("totalBytes", total_bytes, allocator);
+#if IMPELLER_SUPPORTS_RENDERING
+  if (params.count("resetPeaks") != 0 && params.at("resetPeaks") == "true") {
+    impeller::ResourceWatermarks::ResetPeaks();
+  }
+  rapidjson::Value resource_classes(rapidjson::kArrayType);
+  for (size_t i = 0; i < impeller::kResourceClassCount; i++) {
+    const auto resource_class = static_cast<impeller::ResourceClass>(i);
+    const auto watermark =
+        impeller::ResourceWatermarks::GetWatermark(resource_class);
+    rapidjson::Value entry(rapidjson::kObjectType);
+    entry.AddMember(
+        "name",
+        rapidjson::Value(impeller::ResourceClassToString(resource_class),
+                         allocator),
+        allocator);
+    entry.AddMember<int64_t>("liveBytes", watermark.live_bytes, allocator);
+    entry.AddMember<int64_t>("peakBytes", watermark.peak_bytes, allocator);
+    resource_classes.PushBack(entry, allocator);
+  }
+  response->AddMember("impellerResourceClasses", resource_classes, allocator);
+#endif  // IMPELLER_SUPPORTS_RENDERING
+  return true;
+}
+
 // Service protocol handler
 bool Shell::OnServiceProtocolSetAssetBundlePath(
     const ServiceProtocol::Handler::ServiceProtocolMap& params,
@@ -14,6 +14,7 @@
 #include "flutter/common/graphics/texture.h"
 #include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
+#include "flutter/flow/stopwatch.h"
 #include "flutter/flow/surface.h"
 #include "flutter/fml/closure.h"
 #include "flutter/fml/macros.h"
@@ -36,10 +37,13 @@
 #include "flutter/shell/common/animator.h"
 #include "flutter/shell/common/display_manager.h"
 #include "flutter/shell/common/engine.h"
+#include "flutter/shell/common/frame_pacing_governor.h"
+#include "flutter/shell/common/memory_dashboard.h"
 #include "flutter/shell/common/platform_view.h"
 #include "flutter/shell/common/rasterizer.h"
 #include "flutter/shell/common/resource_cache_limit_calculator.h"
 #include "flutter/shell/common/shell_io_manager.h"
+#include "flutter/shell/common/startup_phase_tracker.h"
 
 namespace flutter {
 
@@ -274,18 +278,44 @@ class Shell final : public PlatformView::Delegate,
   ///
   fml::WeakPtr<ShellIOManager> GetIOManager();
 
-  // Embedders should call this under low memory conditions to free up
-  // internal caches used.
-  //
-  // This method posts a task to the raster threads to signal the Rasterizer to
-  // free resources.
-
   //----------------------------------------------------------------------------
   /// @brief      Used by embedders to notify that there is a low memory
-  ///             warning. The shell will attempt to purge caches. Current, only
-  ///             the rasterizer cache is purged.
+  ///             warning. The Dart VM is notified directly; the engine-side
+  ///             subsystems registered on the memory dashboard are trimmed in
+  ///             stages, with repeated warnings escalating from cheap caches
+  ///             to atlases and finally GPU pools. See |MemoryDashboard|.
   void NotifyLowMemoryWarning() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The dashboard on which the engine's memory consumers are
+  ///             registered. Valid for the lifetime of the shell.
+  MemoryDashboard* GetMemoryDashboard() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Used by embedders to read the timestamps of this shell's
+  ///             startup milestones without parsing the trace; see
+  ///             |StartupPhaseTracker|. Valid for the lifetime of the shell
+  ///             and safe to call from any thread.
+  StartupPhaseTracker* GetStartupPhaseTracker() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Used by embedders to export aggregated raster and UI frame
+  ///             time percentiles without attaching a trace.
+  ///
+  ///             The summaries cover up to the last five minutes of frame
+  ///             times in one-second windows; see |StopwatchHistory|. The
+  ///             underlying aggregation is lock-free, so this may be called
+  ///             from any thread on a shell that is set up.
+  ///
+  /// @param[out] raster_windows  Per-window raster thread percentiles,
+  ///                             oldest first.
+  /// @param[out] ui_windows      Per-window UI thread percentiles, oldest
+  ///                             first.
+  ///
+  void GetFrameTimingsHistory(
+      std::vector<StopwatchWindowSummary>& raster_windows,
+      std::vector<StopwatchWindowSummary>& ui_windows) const;
+
   //----------------------------------------------------------------------------
   /// @brief      Used by embedders to check if all shell subcomponents are
   ///             initialized. It is the embedder's responsibility to make this
@@ -435,8 +465,9 @@ class Shell final : public PlatformView::Delegate,
 
   const std::weak_ptr<VsyncWaiter> GetVsyncWaiter() const;
 
+  // |Rasterizer::Delegate|
   const std::shared_ptr<fml::ConcurrentTaskRunner>
-  GetConcurrentWorkerTaskRunner() const;
+  GetConcurrentWorkerTaskRunner() const override;
 
   // Infer the VM ref and the isolate snapshot based on the settings.
   //
@@ -468,6 +499,10 @@ class Shell final : public PlatformView::Delegate,
   std::shared_ptr<ResourceCacheLimitCalculator>
       resource_cache_limit_calculator_;
   size_t resource_cache_limit_;
+  // The last resource cache limit sent to the rasterizer. Used to apply
+  // hysteresis to display-driven recalculations; see
+  // |OnPlatformViewSetViewportMetrics|.
+  std::optional<size_t> last_resource_cache_max_bytes_;
   const Settings settings_;
   DartVMRef vm_;
   mutable std::mutex time_recorder_mutex_;
@@ -476,6 +511,17 @@ class Shell final : public PlatformView::Delegate,
   std::unique_ptr<Engine> engine_;               // on UI task runner
   std::unique_ptr<Rasterizer> rasterizer_;       // on raster task runner
   std::shared_ptr<ShellIOManager> io_manager_;   // on IO task runner
+  // Byte meters and staged trim callbacks for the engine's memory consumers;
+  // driven by |NotifyLowMemoryWarning| and the getMemoryUsage service
+  // protocol extension.
+  std::unique_ptr<MemoryDashboard> memory_dashboard_;
+  // Fed with measured frame durations in |OnFrameRasterized| and consulted
+  // by the vsync waiter to hold a stable lower cadence instead of
+  // oscillating when frames miss deadlines. Shared with the waiter.
+  std::shared_ptr<FramePacingGovernor> frame_pacing_governor_;
+  // Timestamps of the shell's startup milestones; shared with the task
+  // closures that observe the firsts. See |StartupPhaseTracker|.
+  std::shared_ptr<StartupPhaseTracker> startup_phase_tracker_;
   std::shared_ptr<fml::SyncSwitch> is_gpu_disabled_sync_switch_;
   std::shared_ptr<VolatilePathTracker> volatile_path_tracker_;
   std::shared_ptr<PlatformMessageHandler> platform_message_handler_;
@@ -739,6 +785,27 @@ class Shell final : public PlatformView::Delegate,
       const ServiceProtocol::Handler::ServiceProtocolMap& params,
       rapidjson::Document* response);
 
+  // Service protocol handler
+  //
+  // Variant of `OnServiceProtocolScreenshot` that runs on the IO task runner.
+  // Only a recording of the last layer tree is captured on the raster thread;
+  // rasterization and compression happen on the IO thread, rate limited so
+  // that polling diagnostics tools do not stall frame production. Registered
+  // instead of the synchronous variant when
+  // `Settings::enable_async_service_protocol` is set.
+  bool OnServiceProtocolScreenshotAsync(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
+  // Service protocol handler
+  //
+  // Variant of `OnServiceProtocolScreenshotSKP` that serializes a recording
+  // of the last layer tree on the IO task runner. See
+  // `OnServiceProtocolScreenshotAsync`.
+  bool OnServiceProtocolScreenshotSKPAsync(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
   // Service protocol handler
   bool OnServiceProtocolRunInView(
       const ServiceProtocol::Handler::ServiceProtocolMap& params,
@@ -772,6 +839,54 @@ class Shell final : public PlatformView::Delegate,
       const ServiceProtocol::Handler::ServiceProtocolMap& params,
       rapidjson::Document* response);
 
+  // Service protocol handler
+  //
+  // Reports the byte usage of every subsystem registered on the memory
+  // dashboard along with the stage at which it is trimmed under memory
+  // pressure.
+  bool OnServiceProtocolGetMemoryUsage(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
+  // Service protocol handler
+  //
+  // Lists every raster cache entry (identity, size, access count, last-used
+  // frame, pinned state) along with the per-frame creation and eviction
+  // counters, so cache churn can be diagnosed entry by entry.
+  bool OnServiceProtocolGetRasterCacheEntries(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
+  // Service protocol handler
+  //
+  // Summarizes the rolling window of per-frame draw op statistics gathered
+  // by the rasterizer's |DrawStatsAggregator|: counts per op type, the
+  // saveLayer depth histogram, and transparent-op tallies. The optional
+  // "enable" parameter ("true" or "false") toggles collection and
+  // "reset=true" clears the window.
+  bool OnServiceProtocolGetDrawStats(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
+  // Service protocol handler
+  //
+  // Reports input-to-present latency percentiles from the rasterizer's
+  // |InputLatencyTracker| over its rolling sample window. "reset=true"
+  // clears the window.
+  bool OnServiceProtocolGetInputLatency(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
+  // Service protocol handler
+  //
+  // Reports the per-tag allocation counters collected by
+  // |fml::AllocationMetrics|. The optional "enable" parameter ("true" or
+  // "false") toggles collection, and "reset=true" zeroes the counters, so
+  // per-frame churn can be measured by enabling, sampling twice and diffing.
+  bool OnServiceProtocolGetAllocationMetrics(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
   // Service protocol handler
   //
   // Renders a frame and responds with various statistics pertaining to the
@@ -789,6 +904,22 @@ class Shell final : public PlatformView::Delegate,
       const ServiceProtocol::Handler::ServiceProtocolMap& params,
       rapidjson::Document* response);
 
+  // Records the last layer tree into a picture on the raster thread and waits
+  // for the result. Called by the asynchronous screenshot service protocol
+  // handlers from the IO thread; the wait only covers the cheap recording,
+  // not rasterization or serialization.
+  sk_sp<SkPicture> RecordLastLayerTreePicture();
+
+  // The previously captured response of an asynchronous screenshot service
+  // protocol handler, reused for requests arriving faster than the rate
+  // limiter interval. Only accessed on the IO task runner.
+  struct AsyncScreenshotCache {
+    fml::TimePoint capture_time;
+    sk_sp<SkData> data;
+  };
+  AsyncScreenshotCache async_screenshot_cache_;
+  AsyncScreenshotCache async_screenshot_skp_cache_;
+
   // Send a system font change notification.
   void SendFontChangeNotification();
 
@@ -0,0 +1,191 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <atomic>
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/display_list/dl_builder.h"
+#include "flutter/flow/layers/display_list_layer.h"
+#include "flutter/flow/layers/platform_view_layer.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/shell/common/shell_test.h"
+#include "flutter/shell/common/shell_test_external_view_embedder.h"
+#include "flutter/shell/common/shell_test_platform_view.h"
+
+namespace flutter::testing {
+
+namespace {
+
+// Accumulates per-phase durations from |FrameTiming| reports so the scenario
+// benchmarks can surface average UI, raster, and present times alongside the
+// wall time that google/benchmark measures.
+struct PhaseAccumulator {
+  std::atomic<int64_t> ui_micros = 0;
+  std::atomic<int64_t> raster_micros = 0;
+  std::atomic<int64_t> present_micros = 0;
+  std::atomic<int64_t> frame_count = 0;
+
+  void Add(const FrameTiming& timing) {
+    ui_micros += (timing.Get(FrameTiming::kBuildFinish) -
+                  timing.Get(FrameTiming::kBuildStart))
+                     .ToMicroseconds();
+    raster_micros += (timing.Get(FrameTiming::kRasterFinish) -
+                      timing.Get(FrameTiming::kRasterStart))
+                         .ToMicroseconds();
+    present_micros += (timing.Get(FrameTiming::kRasterFinishWallTime) -
+                       timing.Get(FrameTiming::kRasterFinish))
+                          .ToMicroseconds();
+    frame_count++;
+  }
+};
+
+sk_sp<DisplayList> MakeScenarioDisplayList(int op_count) {
+  DisplayListBuilder builder(SkRect::MakeWH(1000, 1000));
+  for (int i = 0; i < op_count; i++) {
+    const SkScalar x = (i % 25) * 40.0f;
+    const SkScalar y = ((i / 25) % 25) * 40.0f;
+    builder.DrawRect(SkRect::MakeXYWH(x, y, 32, 32), DlPaint(DlColor::kRed()));
+  }
+  return builder.Build();
+}
+
+LayerTreeBuilder MakeScenarioTreeBuilder(int layer_count,
+                                         int ops_per_layer,
+                                         int platform_view_count) {
+  // Build the display list once; each frame shares it so the benchmark
+  // measures the pipeline rather than display list construction.
+  auto display_list = MakeScenarioDisplayList(ops_per_layer);
+  return [layer_count, platform_view_count,
+          display_list](const std::shared_ptr<ContainerLayer>& root) {
+    for (int i = 0; i < layer_count; i++) {
+      root->Add(std::make_shared<DisplayListLayer>(
+          SkPoint::Make(i % 10, i % 10), display_list, false, false));
+    }
+    for (int i = 0; i < platform_view_count; i++) {
+      root->Add(std::make_shared<PlatformViewLayer>(
+          SkPoint::Make(i * 10, i * 10), SkSize::Make(50, 50), i + 1));
+    }
+  };
+}
+
+}  // namespace
+
+// Drives the full Animator -> Pipeline -> Rasterizer path with scripted frame
+// content so pre-merge runs catch jank regressions that unit benchmarks on
+// isolated components miss. Each benchmark iteration produces one frame and
+// waits for it to be rasterized; phase times come from the engine's own
+// |FrameTiming| reports.
+class ShellScenarioBenchmarks : public ShellTest, public benchmark::Fixture {
+ public:
+  ShellScenarioBenchmarks() : ShellTest() {}
+
+  void SetUp(const ::benchmark::State& state) {}
+
+  void TearDown(const ::benchmark::State& state) {}
+
+  void RunFrameScenario(benchmark::State& st,
+                        int layer_count,
+                        int ops_per_layer,
+                        int platform_view_count) {
+    PhaseAccumulator accumulator;
+    fml::AutoResetWaitableEvent frame_rasterized;
+
+    Settings settings = CreateSettingsForFixture();
+    settings.frame_rasterized_callback =
+        [&accumulator, &frame_rasterized](const FrameTiming& timing) {
+          accumulator.Add(timing);
+          frame_rasterized.Signal();
+        };
+
+    std::shared_ptr<ShellTestExternalViewEmbedder> external_view_embedder;
+    Shell::CreateCallback<PlatformView> platform_view_create_callback;
+    if (platform_view_count > 0) {
+      external_view_embedder = std::make_shared<ShellTestExternalViewEmbedder>(
+          [](bool, fml::RefPtr<fml::RasterThreadMerger>) {},
+          PostPrerollResult::kSuccess, false);
+      platform_view_create_callback = ShellTestPlatformViewBuilder({
+          .shell_test_external_view_embedder = external_view_embedder,
+      });
+    }
+
+    std::unique_ptr<Shell> shell = CreateShell({
+        .settings = settings,
+        .platform_view_create_callback = platform_view_create_callback,
+    });
+    FML_CHECK(shell);
+
+    auto configuration = RunConfiguration::InferFromSettings(settings);
+    configuration.SetEntrypoint("emptyMain");
+    RunEngine(shell.get(), std::move(configuration));
+    PlatformViewNotifyCreated(shell.get());
+
+    LayerTreeBuilder builder = MakeScenarioTreeBuilder(
+        layer_count, ops_per_layer, platform_view_count);
+
+    while (st.KeepRunning()) {
+      PumpOneFrame(shell.get(),
+                   ViewContent::ImplicitView(1000, 1000, builder));
+      frame_rasterized.Wait();
+    }
+
+    const int64_t frame_count = accumulator.frame_count;
+    if (frame_count > 0) {
+      st.counters["AvgUIMicros"] =
+          static_cast<double>(accumulator.ui_micros) / frame_count;
+      st.counters["AvgRasterMicros"] =
+          static_cast<double>(accumulator.raster_micros) / frame_count;
+      st.counters["AvgPresentMicros"] =
+          static_cast<double>(accumulator.present_micros) / frame_count;
+    }
+
+    PlatformViewNotifyDestroyed(shell.get());
+    DestroyShell(std::move(shell));
+  }
+
+ private:
+  void TestBody() override {}
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ShellScenarioBenchmarks);
+};
+
+BENCHMARK_DEFINE_F(ShellScenarioBenchmarks, FramePipelineBaseline)
+(benchmark::State& st) {
+  RunFrameScenario(st, /*layer_count=*/1, /*ops_per_layer=*/8,
+                   /*platform_view_count=*/0);
+}
+
+BENCHMARK_DEFINE_F(ShellScenarioBenchmarks, FramePipelineModerateTree)
+(benchmark::State& st) {
+  RunFrameScenario(st, /*layer_count=*/16, /*ops_per_layer=*/64,
+                   /*platform_view_count=*/0);
+}
+
+BENCHMARK_DEFINE_F(ShellScenarioBenchmarks, FramePipelineHeavyTree)
+(benchmark::State& st) {
+  RunFrameScenario(st, /*layer_count=*/64, /*ops_per_layer=*/256,
+                   /*platform_view_count=*/0);
+}
+
+BENCHMARK_DEFINE_F(ShellScenarioBenchmarks, FramePipelinePlatformViews)
+(benchmark::State& st) {
+  RunFrameScenario(st, /*layer_count=*/16, /*ops_per_layer=*/64,
+                   /*platform_view_count=*/4);
+}
+
+// 1000 frames per scenario keeps run time bounded while giving enough
+// samples for the phase averages to be stable run over run.
+BENCHMARK_REGISTER_F(ShellScenarioBenchmarks, FramePipelineBaseline)
+    ->Iterations(1000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(ShellScenarioBenchmarks, FramePipelineModerateTree)
+    ->Iterations(1000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(ShellScenarioBenchmarks, FramePipelineHeavyTree)
+    ->Iterations(1000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(ShellScenarioBenchmarks, FramePipelinePlatformViews)
+    ->Iterations(1000)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace flutter::testing
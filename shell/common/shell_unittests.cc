@@ -18,6 +18,7 @@
 #include <EGL/egl.h>
 #endif  // SHELL_ENABLE_GL
 
+#include "assets/asset_pack_bundle.h"
 #include "assets/directory_asset_bundle.h"
 #include "common/graphics/persistent_cache.h"
 #include "flutter/flow/layers/backdrop_filter_layer.h"
@@ -2207,6 +2208,64 @@ TEST_F(ShellTest, Screenshot) {
   DestroyShell(std::move(shell));
 }
 
+TEST_F(ShellTest, ScreenshotLastFrameImage) {
+  auto settings = CreateSettingsForFixture();
+  fml::AutoResetWaitableEvent firstFrameLatch;
+  settings.frame_rasterized_callback =
+      [&firstFrameLatch](const FrameTiming& t) { firstFrameLatch.Signal(); };
+
+  std::unique_ptr<Shell> shell = CreateShell(settings);
+
+  // Create the surface needed by rasterizer
+  PlatformViewNotifyCreated(shell.get());
+
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  configuration.SetEntrypoint("emptyMain");
+
+  RunEngine(shell.get(), std::move(configuration));
+
+  LayerTreeBuilder builder = [&](const std::shared_ptr<ContainerLayer>& root) {
+    auto display_list_layer = std::make_shared<DisplayListLayer>(
+        SkPoint::Make(10, 10), MakeSizedDisplayList(80, 80), false, false);
+    root->Add(display_list_layer);
+  };
+
+  auto take_screenshot = [&shell]() {
+    std::promise<Rasterizer::Screenshot> screenshot_promise;
+    auto screenshot_future = screenshot_promise.get_future();
+    fml::TaskRunner::RunNowOrPostTask(
+        shell->GetTaskRunners().GetRasterTaskRunner(),
+        [&screenshot_promise, &shell]() {
+          auto rasterizer = shell->GetRasterizer();
+          screenshot_promise.set_value(rasterizer->ScreenshotLastLayerTree(
+              Rasterizer::ScreenshotType::LastFrameImage, false));
+        });
+    return screenshot_future.get();
+  };
+
+  PumpOneFrame(shell.get(), ViewContent::ImplicitView(100, 100, builder));
+  firstFrameLatch.Wait();
+
+  // The first request has no completed readback yet and falls back to
+  // re-rendering the last layer tree.
+  auto first = take_screenshot();
+  ASSERT_NE(first.data, nullptr);
+  EXPECT_EQ(first.frame_size, SkISize::Make(100, 100));
+  EXPECT_EQ(first.data->size(), 100u * 100u * 4u);
+
+  // The first request armed readbacks; the next presented frame issues
+  // one, and the following request can serve it.
+  PumpOneFrame(shell.get(), ViewContent::ImplicitView(100, 100, builder));
+  firstFrameLatch.Wait();
+
+  auto second = take_screenshot();
+  ASSERT_NE(second.data, nullptr);
+  EXPECT_EQ(second.frame_size, SkISize::Make(100, 100));
+  EXPECT_EQ(second.data->size(), 100u * 100u * 4u);
+
+  DestroyShell(std::move(shell));
+}
+
 TEST_F(ShellTest, CanConvertToAndFromMappings) {
   const size_t buffer_size = 2 << 20;
 
@@ -2483,6 +2542,47 @@ TEST_F(ShellTest, RasterizerScreenshot) {
   DestroyShell(std::move(shell), task_runners);
 }
 
+TEST_F(ShellTest, AsyncServiceProtocolScreenshot) {
+  Settings settings = CreateSettingsForFixture();
+  settings.enable_async_service_protocol = true;
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  auto task_runner = CreateNewThread();
+  TaskRunners task_runners("test", task_runner, task_runner, task_runner,
+                           task_runner);
+  std::unique_ptr<Shell> shell = CreateShell(settings, task_runners);
+
+  ASSERT_TRUE(ValidateShell(shell.get()));
+  PlatformViewNotifyCreated(shell.get());
+
+  RunEngine(shell.get(), std::move(configuration));
+
+  PumpOneFrame(shell.get());
+
+  ServiceProtocol::Handler::ServiceProtocolMap empty_params;
+  rapidjson::Document document;
+  OnServiceProtocol(shell.get(), ServiceProtocolEnum::kScreenshotAsync,
+                    shell->GetTaskRunners().GetIOTaskRunner(), empty_params,
+                    &document);
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  document.Accept(writer);
+  EXPECT_THAT(buffer.GetString(),
+              ::testing::HasSubstr("\"type\":\"Screenshot\""));
+
+  // A second request within the rate limiter interval is served from the
+  // cached capture and yields the same response.
+  rapidjson::Document second_document;
+  OnServiceProtocol(shell.get(), ServiceProtocolEnum::kScreenshotAsync,
+                    shell->GetTaskRunners().GetIOTaskRunner(), empty_params,
+                    &second_document);
+  rapidjson::StringBuffer second_buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> second_writer(second_buffer);
+  second_document.Accept(second_writer);
+  EXPECT_STREQ(second_buffer.GetString(), buffer.GetString());
+
+  DestroyShell(std::move(shell), task_runners);
+}
+
 TEST_F(ShellTest, RasterizerMakeRasterSnapshot) {
   Settings settings = CreateSettingsForFixture();
   auto configuration = RunConfiguration::InferFromSettings(settings);
@@ -3192,6 +3292,81 @@ TEST_F(ShellTest, AssetManagerMulti) {
   }
 }
 
+TEST_F(ShellTest, AssetPackBundleRoundTrip) {
+  std::string small_content = "pack_small";
+  std::string large_content;
+  for (int i = 0; i < 1000; i++) {
+    large_content += "0123456789";
+  }
+  fml::DataMapping small_mapping(small_content);
+  fml::DataMapping large_mapping(large_content);
+
+  // A small block size forces the large asset across many blocks.
+  auto pack = AssetPackBundle::BuildPack(
+      {{"dir/small", &small_mapping}, {"dir/large", &large_mapping}}, 64);
+  ASSERT_TRUE(pack);
+
+  AssetManager asset_manager;
+  ASSERT_TRUE(asset_manager.PushBack(
+      std::make_unique<AssetPackBundle>(std::move(pack), false)));
+
+  auto mapping = asset_manager.GetAsMapping("dir/large");
+  ASSERT_TRUE(mapping != nullptr);
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(mapping->GetMapping()),
+                        mapping->GetSize()),
+            large_content);
+
+  auto mappings = asset_manager.GetAsMappings("small", "dir");
+  ASSERT_EQ(mappings.size(), 1u);
+  EXPECT_EQ(
+      std::string(reinterpret_cast<const char*>(mappings[0]->GetMapping()),
+                  mappings[0]->GetSize()),
+      small_content);
+}
+
+TEST_F(ShellTest, AssetPackBundleRejectsCorruptPacks) {
+  std::string name = "asset";
+  std::string content = "pack_content";
+  fml::DataMapping content_mapping(content);
+  auto pack = AssetPackBundle::BuildPack({{name, &content_mapping}});
+  ASSERT_TRUE(pack);
+  std::vector<uint8_t> bytes(pack->GetMapping(),
+                             pack->GetMapping() + pack->GetSize());
+
+  // Truncated packs must fail to parse.
+  std::vector<uint8_t> truncated(bytes.begin(),
+                                 bytes.begin() + bytes.size() / 2);
+  AssetManager truncated_manager;
+  EXPECT_FALSE(truncated_manager.PushBack(std::make_unique<AssetPackBundle>(
+      std::make_unique<fml::DataMapping>(std::move(truncated)), false)));
+
+  // So must packs with a corrupt block offset table. The single entry's
+  // table starts right after the directory; make its first offset point
+  // past the end of the file.
+  std::vector<uint8_t> bad_table = bytes;
+  size_t table_offset = sizeof(AssetPackBundle::PackHeader) +
+                        sizeof(uint32_t) + 2 * sizeof(uint64_t) + name.size();
+  uint64_t bogus_offset = bytes.size() + 1;
+  memcpy(bad_table.data() + table_offset, &bogus_offset,
+         sizeof(bogus_offset));
+  AssetManager bad_table_manager;
+  EXPECT_FALSE(bad_table_manager.PushBack(std::make_unique<AssetPackBundle>(
+      std::make_unique<fml::DataMapping>(std::move(bad_table)), false)));
+
+  // A pack whose deflate stream is corrupt parses (the directory and block
+  // table are intact), but the asset must present as an empty mapping
+  // rather than a sized mapping with a null data pointer.
+  std::vector<uint8_t> bad_data = bytes;
+  bad_data.back() ^= 0xff;
+  AssetManager bad_data_manager;
+  ASSERT_TRUE(bad_data_manager.PushBack(std::make_unique<AssetPackBundle>(
+      std::make_unique<fml::DataMapping>(std::move(bad_data)), false)));
+  auto mapping = bad_data_manager.GetAsMapping(name);
+  ASSERT_TRUE(mapping != nullptr);
+  EXPECT_EQ(mapping->GetSize(), 0u);
+  EXPECT_EQ(mapping->GetMapping(), nullptr);
+}
+
 #if defined(OS_FUCHSIA)
 TEST_F(ShellTest, AssetManagerMultiSubdir) {
   std::string subdir_path = "subdir";
@@ -3357,6 +3532,60 @@ TEST_F(ShellTest, Spawn) {
   ASSERT_FALSE(DartVMRef::IsInstanceRunning());
 }
 
+TEST_F(ShellTest, SpawnWithSharedEngineGroupCachesSharesRasterCache) {
+  auto settings = CreateSettingsForFixture();
+  settings.enable_shared_engine_group_caches = true;
+  auto shell = CreateShell(settings);
+  ASSERT_TRUE(ValidateShell(shell.get()));
+
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  ASSERT_TRUE(configuration.IsValid());
+  configuration.SetEntrypoint("emptyMain");
+
+  auto second_configuration = RunConfiguration::InferFromSettings(settings);
+  ASSERT_TRUE(second_configuration.IsValid());
+  second_configuration.SetEntrypoint("emptyMain");
+
+  RunEngine(shell.get(), std::move(configuration));
+  ASSERT_TRUE(DartVMRef::IsInstanceRunning());
+
+  PostSync(
+      shell->GetTaskRunners().GetPlatformTaskRunner(),
+      [&shell, &second_configuration]() {
+        MockPlatformViewDelegate platform_view_delegate;
+        auto spawn = shell->Spawn(
+            std::move(second_configuration), "",
+            [&platform_view_delegate](Shell& shell) {
+              auto result = std::make_unique<MockPlatformView>(
+                  platform_view_delegate, shell.GetTaskRunners());
+              ON_CALL(*result, CreateRenderingSurface())
+                  .WillByDefault(::testing::Invoke(
+                      [] { return std::make_unique<MockSurface>(); }));
+              return result;
+            },
+            [](Shell& shell) { return std::make_unique<Rasterizer>(shell); });
+        ASSERT_NE(nullptr, spawn.get());
+        ASSERT_TRUE(ValidateShell(spawn.get()));
+
+        PostSync(shell->GetTaskRunners().GetRasterTaskRunner(),
+                 [&shell, &spawn] {
+                   // Both shells in the group rasterize through one raster
+                   // cache.
+                   ASSERT_EQ(&shell->GetRasterizer()
+                                  ->compositor_context()
+                                  ->raster_cache(),
+                             &spawn->GetRasterizer()
+                                  ->compositor_context()
+                                  ->raster_cache());
+                 });
+
+        DestroyShell(std::move(spawn));
+      });
+
+  DestroyShell(std::move(shell));
+  ASSERT_FALSE(DartVMRef::IsInstanceRunning());
+}
+
 TEST_F(ShellTest, SpawnWithDartEntrypointArgs) {
   auto settings = CreateSettingsForFixture();
   auto shell = CreateShell(settings);
@@ -0,0 +1,89 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/startup_phase_tracker.h"
+
+#include <string>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+StartupPhaseTracker::StartupPhaseTracker() = default;
+
+StartupPhaseTracker::~StartupPhaseTracker() = default;
+
+void StartupPhaseTracker::Record(StartupPhase phase) {
+  RecordAt(phase, fml::TimePoint::Now());
+}
+
+void StartupPhaseTracker::RecordAt(StartupPhase phase, fml::TimePoint time) {
+  const size_t index = static_cast<size_t>(phase);
+  FML_DCHECK(index < kPhaseCount);
+  int64_t nanos = time.ToEpochDelta().ToNanoseconds();
+  if (nanos == 0) {
+    // Zero is the "not recorded" sentinel; a genuine zero timestamp cannot
+    // occur on a monotonic clock that started before the engine did.
+    return;
+  }
+  int64_t expected = 0;
+  if (!phase_times_[index].compare_exchange_strong(
+          expected, nanos, std::memory_order_relaxed)) {
+    // First write wins; later calls on the per-frame paths are no-ops.
+    return;
+  }
+  if (phase == StartupPhase::kFirstPresent) {
+    EmitTraceRecord();
+  }
+}
+
+std::optional<fml::TimePoint> StartupPhaseTracker::GetPhaseTime(
+    StartupPhase phase) const {
+  const size_t index = static_cast<size_t>(phase);
+  FML_DCHECK(index < kPhaseCount);
+  int64_t nanos = phase_times_[index].load(std::memory_order_relaxed);
+  if (nanos == 0) {
+    return std::nullopt;
+  }
+  return fml::TimePoint::FromEpochDelta(fml::TimeDelta::FromNanoseconds(nanos));
+}
+
+const char* StartupPhaseTracker::GetPhaseName(StartupPhase phase) {
+  switch (phase) {
+    case StartupPhase::kEngineCreate:
+      return "EngineCreate";
+    case StartupPhase::kVMInit:
+      return "VMInit";
+    case StartupPhase::kIsolateLaunch:
+      return "IsolateLaunch";
+    case StartupPhase::kFirstFrameScheduled:
+      return "FirstFrameScheduled";
+    case StartupPhase::kFirstRaster:
+      return "FirstRaster";
+    case StartupPhase::kFirstPresent:
+      return "FirstPresent";
+  }
+  return "Unknown";
+}
+
+void StartupPhaseTracker::EmitTraceRecord() const {
+  // A single instant event carrying every phase timestamp, so tooling reads
+  // the startup breakdown from one record instead of matching scattered
+  // event names. Phases not reached are reported as zero. The timeline
+  // copies the argument string before this returns.
+  std::string phases;
+  for (size_t i = 0; i < kPhaseCount; i++) {
+    if (!phases.empty()) {
+      phases += ";";
+    }
+    phases += GetPhaseName(static_cast<StartupPhase>(i));
+    phases += "=";
+    phases += std::to_string(phase_times_[i].load(std::memory_order_relaxed));
+  }
+  TRACE_EVENT_INSTANT1("flutter", "ShellStartupPhases", "phases",
+                       phases.c_str());
+}
+
+}  // namespace flutter
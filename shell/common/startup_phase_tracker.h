@@ -0,0 +1,103 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_STARTUP_PHASE_TRACKER_H_
+#define FLUTTER_SHELL_COMMON_STARTUP_PHASE_TRACKER_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace flutter {
+
+/// The milestones a shell passes on its way from creation to the first frame
+/// reaching the display. Phases are recorded as absolute timestamps, not as an
+/// ordered pipeline: the Dart VM is created before the shell that ends up
+/// using it, and shells leasing a running VM record a VM timestamp from a
+/// previous launch.
+enum class StartupPhase : size_t {
+  /// The shell object was constructed on the platform thread.
+  kEngineCreate = 0,
+  /// The Dart VM serving this shell finished initializing.
+  kVMInit,
+  /// The root isolate was configured and started running Dart code.
+  kIsolateLaunch,
+  /// The first vsync-aligned frame began building on the UI thread.
+  kFirstFrameScheduled,
+  /// Rasterization of the first frame started on the raster thread.
+  kFirstRaster,
+  /// The first frame finished rasterizing and was handed to the surface for
+  /// presentation.
+  kFirstPresent,
+};
+
+//------------------------------------------------------------------------------
+/// @brief      Records the timestamps of a shell's startup phases.
+///
+///             Each phase is a single atomic nanosecond timestamp with
+///             first-write-wins semantics, so recording is cheap enough to
+///             leave in the per-frame paths that detect the firsts and is
+///             always on; cold-start regression harnesses read the phases
+///             through the embedder API instead of reconstructing them from
+///             trace-string matching. Timestamps share the clock of
+///             |fml::TimePoint::Now| (and therefore of
+///             `FlutterEngineGetCurrentTime`), so deltas between phases and
+///             against embedder-side timestamps are meaningful.
+///
+///             Once the terminal phase (first present) is recorded, the
+///             full set of phases is emitted as one instant trace event so
+///             a single record carries the whole startup breakdown.
+///
+///             All methods are safe to call from any thread.
+class StartupPhaseTracker {
+ public:
+  /// The number of phases in |StartupPhase|.
+  static constexpr size_t kPhaseCount = 6;
+
+  StartupPhaseTracker();
+
+  ~StartupPhaseTracker();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Records the current time for the phase. Subsequent calls
+  ///             for an already recorded phase are ignored.
+  ///
+  void Record(StartupPhase phase);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Records an explicit timestamp for the phase, for milestones
+  ///             whose time is captured before the tracker exists or by a
+  ///             frame timing recorder. Subsequent calls for an already
+  ///             recorded phase are ignored.
+  ///
+  void RecordAt(StartupPhase phase, fml::TimePoint time);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The recorded timestamp of the phase, or std::nullopt if the
+  ///             phase has not been reached.
+  ///
+  std::optional<fml::TimePoint> GetPhaseTime(StartupPhase phase) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      A stable name for the phase, used as the trace record key.
+  ///
+  static const char* GetPhaseName(StartupPhase phase);
+
+ private:
+  // One nanosecond timestamp per phase; zero means the phase has not been
+  // recorded. Written at most once via compare-and-swap.
+  std::array<std::atomic<int64_t>, kPhaseCount> phase_times_ = {};
+
+  void EmitTraceRecord() const;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(StartupPhaseTracker);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_STARTUP_PHASE_TRACKER_H_
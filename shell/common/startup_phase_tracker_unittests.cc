@@ -0,0 +1,75 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/startup_phase_tracker.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(StartupPhaseTrackerTest, PhasesStartUnrecorded) {
+  StartupPhaseTracker tracker;
+  for (size_t i = 0; i < StartupPhaseTracker::kPhaseCount; i++) {
+    EXPECT_FALSE(
+        tracker.GetPhaseTime(static_cast<StartupPhase>(i)).has_value());
+  }
+}
+
+TEST(StartupPhaseTrackerTest, RecordsCurrentTime) {
+  StartupPhaseTracker tracker;
+  auto before = fml::TimePoint::Now();
+  tracker.Record(StartupPhase::kEngineCreate);
+  auto after = fml::TimePoint::Now();
+
+  auto time = tracker.GetPhaseTime(StartupPhase::kEngineCreate);
+  ASSERT_TRUE(time.has_value());
+  EXPECT_GE(time.value(), before);
+  EXPECT_LE(time.value(), after);
+}
+
+TEST(StartupPhaseTrackerTest, FirstWriteWins) {
+  StartupPhaseTracker tracker;
+  auto first = fml::TimePoint::FromEpochDelta(fml::TimeDelta::FromSeconds(1));
+  auto second = fml::TimePoint::FromEpochDelta(fml::TimeDelta::FromSeconds(2));
+
+  tracker.RecordAt(StartupPhase::kFirstRaster, first);
+  // Per-frame paths keep calling Record for the firsts; only the first call
+  // may stick.
+  tracker.RecordAt(StartupPhase::kFirstRaster, second);
+  tracker.Record(StartupPhase::kFirstRaster);
+
+  auto time = tracker.GetPhaseTime(StartupPhase::kFirstRaster);
+  ASSERT_TRUE(time.has_value());
+  EXPECT_EQ(time.value(), first);
+}
+
+TEST(StartupPhaseTrackerTest, PhasesAreIndependent) {
+  StartupPhaseTracker tracker;
+  tracker.Record(StartupPhase::kIsolateLaunch);
+  EXPECT_TRUE(tracker.GetPhaseTime(StartupPhase::kIsolateLaunch).has_value());
+  EXPECT_FALSE(tracker.GetPhaseTime(StartupPhase::kVMInit).has_value());
+  EXPECT_FALSE(tracker.GetPhaseTime(StartupPhase::kFirstPresent).has_value());
+}
+
+TEST(StartupPhaseTrackerTest, PhaseNamesAreStable) {
+  // The names are the keys of the startup trace record and are matched by
+  // external tooling; renames are breaking changes.
+  EXPECT_STREQ(StartupPhaseTracker::GetPhaseName(StartupPhase::kEngineCreate),
+               "EngineCreate");
+  EXPECT_STREQ(StartupPhaseTracker::GetPhaseName(StartupPhase::kVMInit),
+               "VMInit");
+  EXPECT_STREQ(StartupPhaseTracker::GetPhaseName(StartupPhase::kIsolateLaunch),
+               "IsolateLaunch");
+  EXPECT_STREQ(
+      StartupPhaseTracker::GetPhaseName(StartupPhase::kFirstFrameScheduled),
+      "FirstFrameScheduled");
+  EXPECT_STREQ(StartupPhaseTracker::GetPhaseName(StartupPhase::kFirstRaster),
+               "FirstRaster");
+  EXPECT_STREQ(StartupPhaseTracker::GetPhaseName(StartupPhase::kFirstPresent),
+               "FirstPresent");
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -302,6 +302,10 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line) {
   settings.enable_service_port_fallback =
       command_line.HasOption(FlagForSwitch(Switch::EnableServicePortFallback));
 
+  // Defer starting the VM service HTTP server until requested.
+  settings.defer_vm_service_server =
+      command_line.HasOption(FlagForSwitch(Switch::DeferVMServiceServer));
+
   // Checked mode overrides.
   settings.disable_dart_asserts =
       command_line.HasOption(FlagForSwitch(Switch::DisableDartAsserts));
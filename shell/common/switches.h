@@ -154,6 +154,11 @@ DEF_SWITCH(EnableServicePortFallback,
            "enable-service-port-fallback",
            "Allow the VM service to fallback to automatic port selection if"
            " binding to a specified port fails.")
+DEF_SWITCH(DeferVMServiceServer,
+           "defer-vm-service-server",
+           "Keep the VM service HTTP server from starting until it is "
+           "requested through the service protocol. The service isolate still "
+           "loads so diagnostics can be attached on demand.")
 DEF_SWITCH(StartPaused,
            "start-paused",
            "Start the application paused in the Dart debugger.")
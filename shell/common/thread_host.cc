@@ -56,6 +56,22 @@ void ThreadHost::ThreadHostConfig::SetProfilerConfig(
   profiler_config = config;
 }
 
+void ThreadHost::ThreadHostConfig::ApplyDefaultAffinityPolicy() {
+  auto apply = [this](Type type, std::optional<ThreadConfig>& config,
+                      fml::CpuAffinity affinity) {
+    if (!isThreadNeeded(type)) {
+      return;
+    }
+    if (!config.has_value()) {
+      config = ThreadConfig(MakeThreadName(type, name_prefix));
+    }
+    config->affinity = affinity;
+  };
+  apply(Type::UI, ui_config, fml::CpuAffinity::kPerformance);
+  apply(Type::RASTER, raster_config, fml::CpuAffinity::kPerformance);
+  apply(Type::IO, io_config, fml::CpuAffinity::kEfficiency);
+}
+
 std::unique_ptr<fml::Thread> ThreadHost::CreateThread(
     Type type,
     std::optional<ThreadConfig> thread_config,
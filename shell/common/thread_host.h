@@ -66,6 +66,12 @@ struct ThreadHost {
     /// Specified the ProfilerThread  Config, meanwhile set the mask.
     void SetProfilerConfig(const ThreadConfig&);
 
+    /// Applies the default thread affinity policy to the per-type configs:
+    /// performance cores for the UI and raster threads, efficiency cores for
+    /// the IO thread. Existing configs keep their name and priority; configs
+    /// that were not set are created with default names.
+    void ApplyDefaultAffinityPolicy();
+
     uint64_t type_mask;
 
     std::string name_prefix = "";
@@ -84,6 +84,12 @@ void VsyncWaiter::ScheduleSecondaryCallback(uintptr_t id,
   AwaitVSyncForSecondaryCallback();
 }
 
+void VsyncWaiter::SetPacingGovernor(
+    std::shared_ptr<FramePacingGovernor> governor) {
+  std::scoped_lock lock(callback_mutex_);
+  pacing_governor_ = std::move(governor);
+}
+
 void VsyncWaiter::FireCallback(fml::TimePoint frame_start_time,
                                fml::TimePoint frame_target_time,
                                bool pause_secondary_tasks) {
@@ -91,17 +97,27 @@ void VsyncWaiter::FireCallback(fml::TimePoint frame_start_time,
 
   Callback callback;
   std::vector<fml::closure> secondary_callbacks;
+  bool frame_deferred = false;
 
   {
     std::scoped_lock lock(callback_mutex_);
-    callback = std::move(callback_);
+    if (callback_ && pacing_governor_ &&
+        !pacing_governor_->ShouldProduceFrame()) {
+      // The governor is holding frames to a stable submultiple of the
+      // display rate. Leave the callback armed for a later vsync; only the
+      // secondary callbacks run on this one.
+      TRACE_EVENT_INSTANT0("flutter", "VsyncDeferredForPacing");
+      frame_deferred = true;
+    } else {
+      callback = std::move(callback_);
+    }
     for (auto& pair : secondary_callbacks_) {
       secondary_callbacks.push_back(std::move(pair.second));
     }
     secondary_callbacks_.clear();
   }
 
-  if (!callback && secondary_callbacks.empty()) {
+  if (!callback && !frame_deferred && secondary_callbacks.empty()) {
     // This means that the vsync waiter implementation fired a callback for a
     // request we did not make. This is a paranoid check but we still want to
     // make sure we catch misbehaving vsync implementations.
@@ -150,6 +166,12 @@ void VsyncWaiter::FireCallback(fml::TimePoint frame_start_time,
   for (auto& secondary_callback : secondary_callbacks) {
     task_runners_.GetUITaskRunner()->PostTask(secondary_callback);
   }
+
+  if (frame_deferred) {
+    // Re-arm so the held frame request fires on an upcoming vsync that the
+    // governor's cadence selects.
+    AwaitVSync();
+  }
 }
 
 void VsyncWaiter::PauseDartMicroTasks() {
@@ -13,6 +13,7 @@
 #include "flutter/common/task_runners.h"
 #include "flutter/flow/frame_timings.h"
 #include "flutter/fml/time/time_point.h"
+#include "flutter/shell/common/frame_pacing_governor.h"
 
 namespace flutter {
 
@@ -35,6 +36,12 @@ class VsyncWaiter : public std::enable_shared_from_this<VsyncWaiter> {
   /// |Animator::ScheduleMaybeClearTraceFlowIds|.
   void ScheduleSecondaryCallback(uintptr_t id, const fml::closure& callback);
 
+  /// Sets the governor consulted on each vsync. When the governor elects to
+  /// hold the frame for a stable lower cadence, the vsync is skipped and the
+  /// waiter re-arms for the next one; secondary callbacks still run. May be
+  /// unset, in which case every vsync produces a frame.
+  void SetPacingGovernor(std::shared_ptr<FramePacingGovernor> governor);
+
  protected:
   // On some backends, the |FireCallback| needs to be made from a static C
   // method.
@@ -78,6 +85,7 @@ class VsyncWaiter : public std::enable_shared_from_this<VsyncWaiter> {
   std::mutex callback_mutex_;
   Callback callback_;
   std::unordered_map<uintptr_t, fml::closure> secondary_callbacks_;
+  std::shared_ptr<FramePacingGovernor> pacing_governor_;
 
   void PauseDartMicroTasks();
   static void ResumeDartMicroTasks(fml::TaskQueueId ui_task_queue_id);
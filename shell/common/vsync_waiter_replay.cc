@@ -0,0 +1,82 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/vsync_waiter_replay.h"
+
+#include <memory>
+
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+namespace {
+
+constexpr fml::TimeDelta kDefaultInterval =
+    fml::TimeDelta::FromSecondsF(1.0 / 60.0);
+
+}  // namespace
+
+VsyncWaiterReplay::VsyncWaiterReplay(
+    const TaskRunners& task_runners,
+    const std::vector<ReplayLog::Event>& events)
+    : VsyncWaiter(task_runners), last_interval_(kDefaultInterval) {
+  int64_t first_start_nanos = 0;
+  for (const ReplayLog::Event& event : events) {
+    if (event.type != ReplayLog::EventType::kVsync) {
+      continue;
+    }
+    if (recorded_.empty()) {
+      first_start_nanos = event.frame_start_nanos;
+    }
+    RecordedVsync vsync;
+    vsync.start_offset = fml::TimeDelta::FromNanoseconds(
+        event.frame_start_nanos - first_start_nanos);
+    vsync.interval = fml::TimeDelta::FromNanoseconds(
+        event.frame_target_nanos - event.frame_start_nanos);
+    if (vsync.interval <= fml::TimeDelta::Zero()) {
+      vsync.interval = kDefaultInterval;
+    }
+    recorded_.push_back(vsync);
+  }
+}
+
+VsyncWaiterReplay::~VsyncWaiterReplay() = default;
+
+// |VsyncWaiter|
+void VsyncWaiterReplay::AwaitVSync() {
+  if (!replay_started_) {
+    replay_phase_ = fml::TimePoint::Now();
+    replay_started_ = true;
+  }
+
+  fml::TimePoint frame_start_time;
+  if (next_index_ < recorded_.size()) {
+    const RecordedVsync& vsync = recorded_[next_index_++];
+    frame_start_time = replay_phase_ + vsync.start_offset;
+    last_interval_ = vsync.interval;
+  } else {
+    // The log ran out; keep ticking at the last recorded interval.
+    frame_start_time = last_frame_start_ + last_interval_;
+  }
+  last_frame_start_ = frame_start_time;
+  fml::TimePoint frame_target_time = frame_start_time + last_interval_;
+
+  TRACE_EVENT2_INT("flutter", "ReplayVsync", "frame_start_time",
+                   frame_start_time.ToEpochDelta().ToMicroseconds(),
+                   "frame_target_time",
+                   frame_target_time.ToEpochDelta().ToMicroseconds());
+
+  std::weak_ptr<VsyncWaiterReplay> weak_this =
+      std::static_pointer_cast<VsyncWaiterReplay>(shared_from_this());
+
+  task_runners_.GetUITaskRunner()->PostTaskForTime(
+      [frame_start_time, frame_target_time, weak_this]() {
+        if (auto vsync_waiter = weak_this.lock()) {
+          vsync_waiter->FireCallback(frame_start_time, frame_target_time);
+        }
+      },
+      frame_start_time);
+}
+
+}  // namespace flutter
@@ -0,0 +1,59 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_VSYNC_WAITER_REPLAY_H_
+#define FLUTTER_SHELL_COMMON_VSYNC_WAITER_REPLAY_H_
+
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_point.h"
+#include "flutter/shell/common/replay_log.h"
+#include "flutter/shell/common/vsync_waiter.h"
+
+namespace flutter {
+
+/// A |VsyncWaiter| that replays the vsync cadence captured in a |ReplayLog|.
+///
+/// The recorded frame start times are rebased so the first one lands at the
+/// moment the first vsync is awaited; the deltas between consecutive vsyncs
+/// — including any irregularity that provoked the original jank — are
+/// preserved exactly. Once the recorded timestamps are exhausted the waiter
+/// keeps firing at the last recorded interval so the isolate does not stall.
+///
+/// Replaying the captured pointer packets and platform messages in their
+/// recorded order alongside this waiter reproduces the original UI-thread
+/// task interleaving.
+class VsyncWaiterReplay final : public VsyncWaiter {
+ public:
+  /// Non-vsync events in |events| are ignored.
+  VsyncWaiterReplay(const TaskRunners& task_runners,
+                    const std::vector<ReplayLog::Event>& events);
+
+  ~VsyncWaiterReplay() override;
+
+ private:
+  struct RecordedVsync {
+    // Offset of the frame start from the first recorded frame start.
+    fml::TimeDelta start_offset;
+    // Duration from frame start to frame target.
+    fml::TimeDelta interval;
+  };
+
+  // |VsyncWaiter|
+  void AwaitVSync() override;
+
+  std::vector<RecordedVsync> recorded_;
+  size_t next_index_ = 0;
+  fml::TimePoint replay_phase_;
+  bool replay_started_ = false;
+  fml::TimePoint last_frame_start_;
+  fml::TimeDelta last_interval_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(VsyncWaiterReplay);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_VSYNC_WAITER_REPLAY_H_
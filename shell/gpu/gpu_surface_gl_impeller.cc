@@ -4,6 +4,7 @@
 
 #include "flutter/shell/gpu/gpu_surface_gl_impeller.h"
 
+#include "flutter/common/graphics/persistent_cache.h"
 #include "flutter/fml/make_copyable.h"
 #include "impeller/display_list/dl_dispatcher.h"
 #include "impeller/renderer/backend/gles/surface_gles.h"
@@ -29,8 +30,18 @@ GPUSurfaceGLImpeller::GPUSurfaceGLImpeller(
     return;
   }
 
+  // When the embedder supplied a persistent cache directory, use it for the
+  // pipeline usage manifest so the variants used by previous sessions are
+  // pre-created before the first frame.
+  std::optional<std::string> pipeline_usage_directory;
+  auto cache_directory = PersistentCache::GetCacheDirectoryPath();
+  if (!cache_directory.empty()) {
+    pipeline_usage_directory = std::move(cache_directory);
+  }
+
   auto aiks_context = std::make_shared<impeller::AiksContext>(
-      context, impeller::TypographerContextSkia::Make());
+      context, impeller::TypographerContextSkia::Make(),
+      std::move(pipeline_usage_directory));
 
   if (!aiks_context->IsValid()) {
     return;
@@ -117,12 +128,22 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceGLImpeller::AcquireFrame(
             SkIRect::MakeWH(cull_rect.width, cull_rect.height));
         auto picture = impeller_dispatcher.EndRecordingAsPicture();
 
+        // When the embedder supports partial repaint, restrict rendering to
+        // the buffer damage so that only the changed region is re-encoded.
+        std::optional<impeller::IRect> damage;
+        if (surface_frame.submit_info().buffer_damage.has_value()) {
+          auto buffer_damage = surface_frame.submit_info().buffer_damage;
+          damage = impeller::IRect::MakeXYWH(
+              buffer_damage->x(), buffer_damage->y(), buffer_damage->width(),
+              buffer_damage->height());
+        }
+
         return renderer->Render(
             std::move(surface),
             fml::MakeCopyable(
-                [aiks_context, picture = std::move(picture)](
+                [aiks_context, picture = std::move(picture), damage](
                     impeller::RenderTarget& render_target) -> bool {
-                  return aiks_context->Render(picture, render_target);
+                  return aiks_context->Render(picture, render_target, damage);
                 }));
       });
 
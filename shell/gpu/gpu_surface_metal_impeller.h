@@ -6,10 +6,14 @@
 #define FLUTTER_SHELL_GPU_GPU_SURFACE_METAL_IMPELLER_H_
 
 #include <Metal/Metal.h>
+#include <QuartzCore/CAMetalLayer.h>
+
+#include <mutex>
 
 #include "flutter/flow/surface.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/platform/darwin/scoped_nsobject.h"
+#include "flutter/fml/thread.h"
 #include "flutter/impeller/aiks/aiks_context.h"
 #include "flutter/impeller/renderer/backend/metal/context_mtl.h"
 #include "flutter/impeller/renderer/renderer.h"
@@ -48,6 +52,24 @@ class IMPELLER_CA_METAL_LAYER_AVAILABLE GPUSurfaceMetalImpeller
   // Accumulated damage for each framebuffer; Key is address of underlying
   // MTLTexture for each drawable
   std::map<uintptr_t, SkIRect> damage_;
+  // Drawable-ahead state. After a present from the raster thread, the next
+  // drawable is acquired on this helper thread so the raster thread does not
+  // block in nextDrawable at the start of the following frame. Created lazily
+  // on the first prefetch.
+  std::unique_ptr<fml::Thread> drawable_prefetch_thread_;
+  std::mutex prefetched_drawable_mutex_;
+  fml::scoped_nsprotocol<id<CAMetalDrawable>> prefetched_drawable_;
+  uintptr_t prefetched_layer_ = 0;
+
+  // Returns the prefetched drawable if it was acquired from the given layer
+  // at its current drawable size, or nil. A stale drawable (the layer was
+  // resized or replaced) is released back to the layer's pool.
+  fml::scoped_nsprotocol<id<CAMetalDrawable>> TakePrefetchedDrawable(
+      CAMetalLayer* layer);
+
+  // Kicks off acquisition of the layer's next drawable on the prefetch
+  // thread. Called immediately after a successful present.
+  void PrefetchNextDrawable(CAMetalLayer* layer);
 
   // |Surface|
   std::unique_ptr<SurfaceFrame> AcquireFrame(
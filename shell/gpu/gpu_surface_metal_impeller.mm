@@ -47,7 +47,51 @@ GPUSurfaceMetalImpeller::GPUSurfaceMetalImpeller(GPUSurfaceMetalDelegate* delega
   }
 }
 
-GPUSurfaceMetalImpeller::~GPUSurfaceMetalImpeller() = default;
+GPUSurfaceMetalImpeller::~GPUSurfaceMetalImpeller() {
+  // Join the prefetch thread before the rest of the members are torn down as
+  // an in-flight prefetch task references them.
+  drawable_prefetch_thread_.reset();
+}
+
+fml::scoped_nsprotocol<id<CAMetalDrawable>> GPUSurfaceMetalImpeller::TakePrefetchedDrawable(
+    CAMetalLayer* layer) {
+  std::scoped_lock lock(prefetched_drawable_mutex_);
+  fml::scoped_nsprotocol<id<CAMetalDrawable>> drawable(prefetched_drawable_.release());
+  uintptr_t prefetched_layer = prefetched_layer_;
+  prefetched_layer_ = 0;
+  if (!drawable) {
+    return drawable;
+  }
+  if (prefetched_layer != reinterpret_cast<uintptr_t>(layer) ||
+      drawable.get().texture.width != static_cast<NSUInteger>(layer.drawableSize.width) ||
+      drawable.get().texture.height != static_cast<NSUInteger>(layer.drawableSize.height)) {
+    // The layer was replaced or resized since the prefetch. Dropping the
+    // reference returns the drawable to the layer's pool unpresented.
+    drawable.reset();
+  }
+  return drawable;
+}
+
+void GPUSurfaceMetalImpeller::PrefetchNextDrawable(CAMetalLayer* layer) {
+  if (!drawable_prefetch_thread_) {
+    drawable_prefetch_thread_ = std::make_unique<fml::Thread>("io.flutter.drawable.prefetch");
+  }
+  // Balanced by the release at the end of the prefetch task.
+  [layer retain];
+  drawable_prefetch_thread_->GetTaskRunner()->PostTask([this, layer]() {
+    id<CAMetalDrawable> drawable = nil;
+    {
+      TRACE_EVENT0("impeller", "PrefetchNextDrawable");
+      drawable = [[layer nextDrawable] retain];
+    }
+    {
+      std::scoped_lock lock(prefetched_drawable_mutex_);
+      prefetched_drawable_.reset(drawable);
+      prefetched_layer_ = drawable != nil ? reinterpret_cast<uintptr_t>(layer) : 0;
+    }
+    [layer release];
+  });
+}
 
 // |Surface|
 bool GPUSurfaceMetalImpeller::IsValid() {
@@ -97,8 +141,14 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalImpeller::AcquireFrameFromCAMetalLa
 
   auto* mtl_layer = (CAMetalLayer*)layer;
 
-  auto drawable = impeller::SurfaceMTL::GetMetalDrawableAndValidate(
-      impeller_renderer_->GetContext(), mtl_layer);
+  // Prefer the drawable that was acquired on the prefetch thread right after
+  // the previous present; falling back to a blocking acquisition if there is
+  // none (first frame, resize or a dropped frame).
+  id<CAMetalDrawable> drawable = [TakePrefetchedDrawable(mtl_layer).release() autorelease];
+  if (!drawable) {
+    drawable = impeller::SurfaceMTL::GetMetalDrawableAndValidate(impeller_renderer_->GetContext(),
+                                                                 mtl_layer);
+  }
   if (!drawable) {
     return nullptr;
   }
@@ -112,6 +162,7 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalImpeller::AcquireFrameFromCAMetalLa
                          renderer = impeller_renderer_,  //
                          aiks_context = aiks_context_,   //
                          drawable,                       //
+                         mtl_layer,                      //
                          last_texture                    //
   ](SurfaceFrame& surface_frame, DlCanvas* canvas) mutable -> bool {
         if (!aiks_context) {
@@ -149,22 +200,32 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalImpeller::AcquireFrameFromCAMetalLa
         auto surface = impeller::SurfaceMTL::MakeFromMetalLayerDrawable(
             impeller_renderer_->GetContext(), drawable, clip_rect);
 
+        bool render_result = false;
         if (clip_rect && (clip_rect->size.width == 0 || clip_rect->size.height == 0)) {
-          return surface->Present();
+          render_result = surface->Present();
+        } else {
+          impeller::IRect cull_rect = surface->coverage();
+          SkIRect sk_cull_rect = SkIRect::MakeWH(cull_rect.size.width, cull_rect.size.height);
+          impeller::DlDispatcher impeller_dispatcher(cull_rect);
+          display_list->Dispatch(impeller_dispatcher, sk_cull_rect);
+          auto picture = impeller_dispatcher.EndRecordingAsPicture();
+
+          render_result = renderer->Render(
+              std::move(surface),
+              fml::MakeCopyable([aiks_context, picture = std::move(picture)](
+                                    impeller::RenderTarget& render_target) -> bool {
+                return aiks_context->Render(picture, render_target);
+              }));
         }
 
-        impeller::IRect cull_rect = surface->coverage();
-        SkIRect sk_cull_rect = SkIRect::MakeWH(cull_rect.size.width, cull_rect.size.height);
-        impeller::DlDispatcher impeller_dispatcher(cull_rect);
-        display_list->Dispatch(impeller_dispatcher, sk_cull_rect);
-        auto picture = impeller_dispatcher.EndRecordingAsPicture();
-
-        return renderer->Render(
-            std::move(surface),
-            fml::MakeCopyable([aiks_context, picture = std::move(picture)](
-                                  impeller::RenderTarget& render_target) -> bool {
-              return aiks_context->Render(picture, render_target);
-            }));
+        // Start acquiring the next drawable while this one's present is still
+        // in flight. Frames presented within a CoreAnimation transaction (the
+        // platform and raster threads are merged) acquire in-transaction, so
+        // no prefetch is scheduled for them.
+        if (render_result && ![[NSThread currentThread] isMainThread]) {
+          PrefetchNextDrawable(mtl_layer);
+        }
+        return render_result;
       });
 
   SurfaceFrame::FramebufferInfo framebuffer_info;
@@ -4,6 +4,7 @@
 
 #include "flutter/shell/gpu/gpu_surface_vulkan_impeller.h"
 
+#include "flutter/common/graphics/persistent_cache.h"
 #include "flutter/fml/make_copyable.h"
 #include "impeller/display_list/dl_dispatcher.h"
 #include "impeller/renderer/backend/vulkan/surface_context_vk.h"
@@ -24,8 +25,18 @@ GPUSurfaceVulkanImpeller::GPUSurfaceVulkanImpeller(
     return;
   }
 
+  // When the embedder supplied a persistent cache directory, use it for the
+  // pipeline usage manifest so the variants used by previous sessions are
+  // pre-created before the first frame.
+  std::optional<std::string> pipeline_usage_directory;
+  auto cache_directory = PersistentCache::GetCacheDirectoryPath();
+  if (!cache_directory.empty()) {
+    pipeline_usage_directory = std::move(cache_directory);
+  }
+
   auto aiks_context = std::make_shared<impeller::AiksContext>(
-      context, impeller::TypographerContextSkia::Make());
+      context, impeller::TypographerContextSkia::Make(),
+      std::move(pipeline_usage_directory));
   if (!aiks_context->IsValid()) {
     return;
   }
@@ -65,6 +76,13 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceVulkanImpeller::AcquireFrame(
     return nullptr;
   }
 
+  // The display list is recorded in swapchain image coordinates, which can
+  // have swapped dimensions relative to |size| when the swapchain is
+  // pre-rotated. Use the actual render target size so recording does not
+  // cull against the wrong bounds.
+  const auto render_target_size =
+      surface->GetTargetRenderPassDescriptor().GetRenderTargetSize();
+
   SurfaceFrame::SubmitCallback submit_callback =
       fml::MakeCopyable([renderer = impeller_renderer_,  //
                          aiks_context = aiks_context_,   //
@@ -89,12 +107,22 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceVulkanImpeller::AcquireFrame(
             SkIRect::MakeWH(cull_rect.width, cull_rect.height));
         auto picture = impeller_dispatcher.EndRecordingAsPicture();
 
+        // When the embedder supports partial repaint, restrict rendering to
+        // the buffer damage so that only the changed region is re-encoded.
+        std::optional<impeller::IRect> damage;
+        if (surface_frame.submit_info().buffer_damage.has_value()) {
+          auto buffer_damage = surface_frame.submit_info().buffer_damage;
+          damage = impeller::IRect::MakeXYWH(
+              buffer_damage->x(), buffer_damage->y(), buffer_damage->width(),
+              buffer_damage->height());
+        }
+
         return renderer->Render(
             std::move(surface),
             fml::MakeCopyable(
-                [aiks_context, picture = std::move(picture)](
+                [aiks_context, picture = std::move(picture), damage](
                     impeller::RenderTarget& render_target) -> bool {
-                  return aiks_context->Render(picture, render_target);
+                  return aiks_context->Render(picture, render_target, damage);
                 }));
       });
 
@@ -102,17 +130,23 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceVulkanImpeller::AcquireFrame(
       nullptr,                          // surface
       SurfaceFrame::FramebufferInfo{},  // framebuffer info
       submit_callback,                  // submit callback
-      size,                             // frame size
-      nullptr,                          // context result
-      true                              // display list fallback
+      SkISize::Make(render_target_size.width,
+                    render_target_size.height),  // frame size
+      nullptr,                                   // context result
+      true                                       // display list fallback
   );
 }
 
 // |Surface|
 SkMatrix GPUSurfaceVulkanImpeller::GetRootTransformation() const {
-  // This backend does not currently support root surface transformations. Just
-  // return identity.
-  return {};
+  const auto& context_vk = impeller::SurfaceContextVK::Cast(*impeller_context_);
+  const impeller::Matrix transformation =
+      context_vk.GetCurrentSurfaceTransformation();
+  // impeller::Matrix is column major.
+  return SkMatrix::MakeAll(
+      transformation.m[0], transformation.m[4], transformation.m[12],  //
+      transformation.m[1], transformation.m[5], transformation.m[13],  //
+      transformation.m[3], transformation.m[7], transformation.m[15]);
 }
 
 // |Surface|
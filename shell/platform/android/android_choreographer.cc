@@ -20,6 +20,42 @@ typedef void (*AChoreographer_postFrameCallback_FPN)(
 static AChoreographer_getInstance_FPN AChoreographer_getInstance;
 static AChoreographer_postFrameCallback_FPN AChoreographer_postFrameCallback;
 
+// Only available on API 33+
+typedef void AChoreographerFrameCallbackData;
+typedef void (*AChoreographer_vsyncCallback)(
+    const AChoreographerFrameCallbackData* callback_data,
+    void* data);
+typedef void (*AChoreographer_postVsyncCallback_FPN)(
+    AChoreographer* choreographer,
+    AChoreographer_vsyncCallback callback,
+    void* data);
+typedef int64_t (*AChoreographerFrameCallbackData_getFrameTimeNanos_FPN)(
+    const AChoreographerFrameCallbackData* callback_data);
+typedef size_t (
+    *AChoreographerFrameCallbackData_getPreferredFrameTimelineIndex_FPN)(
+    const AChoreographerFrameCallbackData* callback_data);
+typedef int64_t (
+    *AChoreographerFrameCallbackData_getFrameTimelineDeadlineNanos_FPN)(
+    const AChoreographerFrameCallbackData* callback_data,
+    size_t index);
+static AChoreographer_postVsyncCallback_FPN AChoreographer_postVsyncCallback;
+static AChoreographerFrameCallbackData_getFrameTimeNanos_FPN
+    AChoreographerFrameCallbackData_getFrameTimeNanos;
+static AChoreographerFrameCallbackData_getPreferredFrameTimelineIndex_FPN
+    AChoreographerFrameCallbackData_getPreferredFrameTimelineIndex;
+static AChoreographerFrameCallbackData_getFrameTimelineDeadlineNanos_FPN
+    AChoreographerFrameCallbackData_getFrameTimelineDeadlineNanos;
+
+// Only available on API 30+
+typedef void (*AChoreographer_refreshRateCallback)(int64_t vsyncPeriodNanos,
+                                                   void* data);
+typedef void (*AChoreographer_registerRefreshRateCallback_FPN)(
+    AChoreographer* choreographer,
+    AChoreographer_refreshRateCallback callback,
+    void* data);
+static AChoreographer_registerRefreshRateCallback_FPN
+    AChoreographer_registerRefreshRateCallback;
+
 namespace flutter {
 
 bool AndroidChoreographer::ShouldUseNDKChoreographer() {
@@ -58,4 +94,97 @@ void AndroidChoreographer::PostFrameCallback(OnFrameCallback callback,
   AChoreographer_postFrameCallback(choreographer, callback, data);
 }
 
+bool AndroidChoreographer::ShouldUseVsyncCallback() {
+  static std::optional<bool> use_vsync_callback;
+  if (use_vsync_callback) {
+    return use_vsync_callback.value();
+  }
+  if (!ShouldUseNDKChoreographer()) {
+    use_vsync_callback = false;
+    return false;
+  }
+  auto libandroid = fml::NativeLibrary::Create("libandroid.so");
+  FML_DCHECK(libandroid);
+  auto post_vsync_callback_fn =
+      libandroid->ResolveFunction<AChoreographer_postVsyncCallback_FPN>(
+          "AChoreographer_postVsyncCallback");
+  auto get_frame_time_fn = libandroid->ResolveFunction<
+      AChoreographerFrameCallbackData_getFrameTimeNanos_FPN>(
+      "AChoreographerFrameCallbackData_getFrameTimeNanos");
+  auto get_preferred_index_fn = libandroid->ResolveFunction<
+      AChoreographerFrameCallbackData_getPreferredFrameTimelineIndex_FPN>(
+      "AChoreographerFrameCallbackData_getPreferredFrameTimelineIndex");
+  auto get_deadline_fn = libandroid->ResolveFunction<
+      AChoreographerFrameCallbackData_getFrameTimelineDeadlineNanos_FPN>(
+      "AChoreographerFrameCallbackData_getFrameTimelineDeadlineNanos");
+  if (post_vsync_callback_fn && get_frame_time_fn && get_preferred_index_fn &&
+      get_deadline_fn) {
+    AChoreographer_postVsyncCallback = post_vsync_callback_fn.value();
+    AChoreographerFrameCallbackData_getFrameTimeNanos =
+        get_frame_time_fn.value();
+    AChoreographerFrameCallbackData_getPreferredFrameTimelineIndex =
+        get_preferred_index_fn.value();
+    AChoreographerFrameCallbackData_getFrameTimelineDeadlineNanos =
+        get_deadline_fn.value();
+    use_vsync_callback = true;
+  } else {
+    use_vsync_callback = false;
+  }
+  return use_vsync_callback.value();
+}
+
+namespace {
+
+struct PendingVsyncCallback {
+  AndroidChoreographer::OnVsyncWithDeadlineCallback callback;
+  void* data;
+};
+
+void OnVsyncCallbackData(const AChoreographerFrameCallbackData* callback_data,
+                         void* data) {
+  auto* pending = static_cast<PendingVsyncCallback*>(data);
+  int64_t frame_time_nanos =
+      AChoreographerFrameCallbackData_getFrameTimeNanos(callback_data);
+  size_t preferred_index =
+      AChoreographerFrameCallbackData_getPreferredFrameTimelineIndex(
+          callback_data);
+  int64_t deadline_nanos =
+      AChoreographerFrameCallbackData_getFrameTimelineDeadlineNanos(
+          callback_data, preferred_index);
+  pending->callback(frame_time_nanos, deadline_nanos, pending->data);
+  delete pending;
+}
+
+}  // namespace
+
+void AndroidChoreographer::PostVsyncCallback(
+    OnVsyncWithDeadlineCallback callback,
+    void* data) {
+  AChoreographer* choreographer = AChoreographer_getInstance();
+  auto* pending = new PendingVsyncCallback{callback, data};
+  AChoreographer_postVsyncCallback(choreographer, &OnVsyncCallbackData,
+                                   pending);
+}
+
+bool AndroidChoreographer::RegisterRefreshRateCallback(
+    OnRefreshRateCallback callback,
+    void* data) {
+  if (!ShouldUseNDKChoreographer()) {
+    return false;
+  }
+  auto libandroid = fml::NativeLibrary::Create("libandroid.so");
+  FML_DCHECK(libandroid);
+  auto register_refresh_rate_callback_fn = libandroid->ResolveFunction<
+      AChoreographer_registerRefreshRateCallback_FPN>(
+      "AChoreographer_registerRefreshRateCallback");
+  if (!register_refresh_rate_callback_fn) {
+    return false;
+  }
+  AChoreographer_registerRefreshRateCallback =
+      register_refresh_rate_callback_fn.value();
+  AChoreographer_registerRefreshRateCallback(AChoreographer_getInstance(),
+                                             callback, data);
+  return true;
+}
+
 }  // namespace flutter
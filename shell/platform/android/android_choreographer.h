@@ -19,9 +19,31 @@ namespace flutter {
 class AndroidChoreographer {
  public:
   typedef void (*OnFrameCallback)(int64_t frame_time_nanos, void* data);
+  typedef void (*OnVsyncWithDeadlineCallback)(int64_t frame_time_nanos,
+                                              int64_t frame_deadline_nanos,
+                                              void* data);
+  typedef void (*OnRefreshRateCallback)(int64_t vsync_period_nanos, void* data);
   static bool ShouldUseNDKChoreographer();
   static void PostFrameCallback(OnFrameCallback callback, void* data);
 
+  //----------------------------------------------------------------------------
+  /// Whether the choreographer can report the compositor frame deadline along
+  /// with the vsync timestamp. Only available on API 33+.
+  ///
+  static bool ShouldUseVsyncCallback();
+
+  /// Like `PostFrameCallback` but also delivers the deadline of the preferred
+  /// frame timeline. Only valid when `ShouldUseVsyncCallback` returns true.
+  static void PostVsyncCallback(OnVsyncWithDeadlineCallback callback,
+                                void* data);
+
+  /// Registers a callback fired whenever the display refresh rate changes.
+  /// Must be called on a thread with a looper. Returns false when the NDK
+  /// entrypoint is unavailable (API < 30). The callback stays registered for
+  /// the lifetime of the process.
+  static bool RegisterRefreshRateCallback(OnRefreshRateCallback callback,
+                                          void* data);
+
   FML_DISALLOW_COPY_AND_ASSIGN(AndroidChoreographer);
 };
 
@@ -8,6 +8,8 @@
 #include <sys/system_properties.h>
 
 #include <array>
+#include <cstdlib>
+#include <cstring>
 #include <list>
 
 #include "flutter/fml/trace_event.h"
@@ -60,25 +62,123 @@ void LogLastEGLError() {
 
 class AndroidEGLSurfaceDamage {
  public:
-  void init(EGLDisplay display, EGLContext context) {}
+  // Partial repaint was previously disabled after discussion in
+  // https://github.com/flutter/flutter/issues/123353. It is restored
+  // here as a buffer-age-aware scissored redraw: InitialDamage accounts
+  // for the frames the aged back buffer missed, so a swap chain that
+  // hands back stale buffers no longer produces artifacts. Devices
+  // running releases older than Android 10 keep the full repaint path
+  // since drivers there misreport buffer age.
+  void init(EGLDisplay display, EGLContext context) {
+    if (GetAPILevel() < kMinimumAPILevelForPartialRepaint) {
+      return;
+    }
+    partial_redraw_supported_ =
+        HasExtension(display, "EGL_KHR_partial_update") &&
+        HasExtension(display, "EGL_KHR_swap_buffers_with_damage") &&
+        HasExtension(display, "EGL_EXT_buffer_age");
+    if (partial_redraw_supported_) {
+      set_damage_region_ = reinterpret_cast<PFNEGLSETDAMAGEREGIONKHRPROC>(
+          eglGetProcAddress("eglSetDamageRegionKHR"));
+      swap_buffers_with_damage_ =
+          reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(
+              eglGetProcAddress("eglSwapBuffersWithDamageKHR"));
+      partial_redraw_supported_ =
+          set_damage_region_ != nullptr && swap_buffers_with_damage_ != nullptr;
+    }
+  }
 
   void SetDamageRegion(EGLDisplay display,
                        EGLSurface surface,
-                       const std::optional<SkIRect>& region) {}
+                       const std::optional<SkIRect>& region) {
+    if (partial_redraw_supported_ && region) {
+      auto rects = RectToInts(display, surface, *region);
+      set_damage_region_(display, surface, rects.data(), 1);
+    }
+  }
 
-  /// This was disabled after discussion in
-  /// https://github.com/flutter/flutter/issues/123353
-  bool SupportsPartialRepaint() const { return false; }
+  bool SupportsPartialRepaint() const { return partial_redraw_supported_; }
 
   std::optional<SkIRect> InitialDamage(EGLDisplay display, EGLSurface surface) {
-    return std::nullopt;
+    if (!partial_redraw_supported_) {
+      return std::nullopt;
+    }
+
+    EGLint age;
+    if (eglQuerySurface(display, surface, EGL_BUFFER_AGE_EXT, &age) !=
+        EGL_TRUE) {
+      return std::nullopt;
+    }
+
+    if (age == 0) {
+      // The buffer contents are undefined; a full repaint is required.
+      return std::nullopt;
+    }
+
+    // The buffer contains the frame from |age| frames ago, so the
+    // existing damage is the union of the damage from the frames in
+    // between.
+    --age;
+    if (static_cast<size_t>(age) > damage_history_.size()) {
+      return std::nullopt;
+    }
+
+    SkIRect existing_damage = SkIRect::MakeEmpty();
+    for (auto i = damage_history_.rbegin();
+         i != damage_history_.rend() && age > 0; ++i, --age) {
+      existing_damage.join(*i);
+    }
+    return existing_damage;
   }
 
   bool SwapBuffersWithDamage(EGLDisplay display,
                              EGLSurface surface,
                              const std::optional<SkIRect>& damage) {
+    if (partial_redraw_supported_ && damage) {
+      damage_history_.push_back(*damage);
+      if (damage_history_.size() > kMaxHistorySize) {
+        damage_history_.pop_front();
+      }
+      auto rects = RectToInts(display, surface, *damage);
+      return swap_buffers_with_damage_(display, surface, rects.data(), 1);
+    }
     return eglSwapBuffers(display, surface);
   }
+
+ private:
+  static constexpr int kMinimumAPILevelForPartialRepaint = 29;
+
+  // Only a handful of buffers are ever in flight; damage older than the
+  // history depth forces a full repaint.
+  static constexpr size_t kMaxHistorySize = 10;
+
+  static int GetAPILevel() {
+    char value[PROP_VALUE_MAX];
+    if (__system_property_get("ro.build.version.sdk", value) == 0) {
+      return -1;
+    }
+    return atoi(value);
+  }
+
+  static bool HasExtension(EGLDisplay display, const char* extension) {
+    const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+    return extensions != nullptr && strstr(extensions, extension) != nullptr;
+  }
+
+  // EGL damage rects are specified with a bottom-left origin.
+  static std::array<EGLint, 4> RectToInts(EGLDisplay display,
+                                          EGLSurface surface,
+                                          const SkIRect& rect) {
+    EGLint height = 0;
+    eglQuerySurface(display, surface, EGL_HEIGHT, &height);
+    return std::array<EGLint, 4>{rect.left(), height - rect.bottom(),
+                                 rect.width(), rect.height()};
+  }
+
+  bool partial_redraw_supported_ = false;
+  PFNEGLSETDAMAGEREGIONKHRPROC set_damage_region_ = nullptr;
+  PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC swap_buffers_with_damage_ = nullptr;
+  std::list<SkIRect> damage_history_;
 };
 
 AndroidEGLSurface::AndroidEGLSurface(EGLSurface surface,
@@ -107,6 +107,10 @@ AndroidShellHolder::AndroidShellHolder(
           flutter::ThreadHost::Type::IO, thread_label),
       fml::Thread::ThreadPriority::kNormal);
 
+  if (settings.enable_thread_affinity_policy) {
+    host_config.ApplyDefaultAffinityPolicy();
+  }
+
   thread_host_ = std::make_shared<ThreadHost>(host_config);
 
   fml::WeakPtr<PlatformViewAndroid> weak_platform_view;
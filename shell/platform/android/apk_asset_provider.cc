@@ -7,7 +7,10 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
 #include <utility>
 
 #include "flutter/fml/logging.h"
@@ -48,6 +51,40 @@ class APKAssetProviderImpl : public APKAssetProviderInternal {
 
   std::unique_ptr<fml::Mapping> GetAsMapping(
       const std::string& asset_name) const override {
+    {
+      std::lock_guard lock(prefetched_mappings_mutex_);
+      auto found = prefetched_mappings_.find(asset_name);
+      if (found != prefetched_mappings_.end()) {
+        auto mapping = std::move(found->second);
+        prefetched_mappings_.erase(found);
+        return mapping;
+      }
+    }
+    return OpenMapping(asset_name);
+  };
+
+  void PrefetchAsMapping(const std::string& asset_name) override {
+    auto mapping = OpenMapping(asset_name);
+    if (!mapping) {
+      return;
+    }
+    // Force the read (and, for compressed entries, the decompression) to
+    // happen here on the worker instead of on the first GetMapping call.
+    mapping->GetMapping();
+    std::lock_guard lock(prefetched_mappings_mutex_);
+    prefetched_mappings_[asset_name] = std::move(mapping);
+  }
+
+ private:
+  fml::jni::ScopedJavaGlobalRef<jobject> java_asset_manager_;
+  AAssetManager* asset_manager_;
+  const std::string directory_;
+  mutable std::mutex prefetched_mappings_mutex_;
+  mutable std::unordered_map<std::string, std::unique_ptr<fml::Mapping>>
+      prefetched_mappings_;
+
+  std::unique_ptr<fml::Mapping> OpenMapping(
+      const std::string& asset_name) const {
     std::stringstream ss;
     ss << directory_.c_str() << "/" << asset_name;
     AAsset* asset = AAssetManager_open(asset_manager_, ss.str().c_str(),
@@ -57,12 +94,7 @@ class APKAssetProviderImpl : public APKAssetProviderInternal {
     }
 
     return std::make_unique<APKAssetMapping>(asset);
-  };
-
- private:
-  fml::jni::ScopedJavaGlobalRef<jobject> java_asset_manager_;
-  AAssetManager* asset_manager_;
-  const std::string directory_;
+  }
 
   FML_DISALLOW_COPY_AND_ASSIGN(APKAssetProviderImpl);
 };
@@ -103,4 +135,41 @@ std::unique_ptr<APKAssetProvider> APKAssetProvider::Clone() const {
   return std::make_unique<APKAssetProvider>(impl_);
 }
 
+// Two workers are enough to keep APK I/O saturated without contending with
+// the shell setup threads that run concurrently with the prefetch.
+static constexpr size_t kMaxPrefetchWorkers = 2u;
+
+void APKAssetProvider::PrefetchAsMappings(
+    std::vector<std::string> asset_names) {
+  if (asset_names.empty()) {
+    return;
+  }
+
+  struct PrefetchState {
+    std::shared_ptr<APKAssetProviderInternal> impl;
+    std::vector<std::string> asset_names;
+    std::atomic<size_t> next_asset = 0;
+  };
+  auto state = std::make_shared<PrefetchState>();
+  state->impl = impl_;
+  state->asset_names = std::move(asset_names);
+
+  const size_t worker_count =
+      std::min(kMaxPrefetchWorkers, state->asset_names.size());
+  for (size_t i = 0; i < worker_count; i++) {
+    // Named threads owned (and joined) by the provider rather than detached
+    // workers: they show up in traces and cannot outlive the APK mapping
+    // they read from.
+    auto thread = std::make_unique<fml::Thread>("io.apk.prefetch");
+    thread->GetTaskRunner()->PostTask([state]() {
+      size_t index;
+      while ((index = state->next_asset.fetch_add(1)) <
+             state->asset_names.size()) {
+        state->impl->PrefetchAsMapping(state->asset_names[index]);
+      }
+    });
+    prefetch_threads_.push_back(std::move(thread));
+  }
+}
+
 }  // namespace flutter
@@ -8,9 +8,14 @@
 #include <android/asset_manager_jni.h>
 #include <jni.h>
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "flutter/assets/asset_resolver.h"
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/fml/platform/android/scoped_java_ref.h"
+#include "flutter/fml/thread.h"
 
 namespace flutter {
 
@@ -19,6 +24,10 @@ class APKAssetProviderInternal {
   virtual std::unique_ptr<fml::Mapping> GetAsMapping(
       const std::string& asset_name) const = 0;
 
+  // Reads the named asset ahead of its first use so a later GetAsMapping
+  // call can be served without touching the APK. No-op by default.
+  virtual void PrefetchAsMapping(const std::string& asset_name) {}
+
  protected:
   virtual ~APKAssetProviderInternal() = default;
 };
@@ -37,6 +46,12 @@ class APKAssetProvider final : public AssetResolver {
   // this provider.
   std::unique_ptr<APKAssetProvider> Clone() const;
 
+  // Fans the reads of the named assets out onto a small set of background
+  // workers so the I/O overlaps with shell and VM startup instead of being
+  // paid serially on first use. Assets that do not exist are skipped. The
+  // workers are owned by this provider and joined when it is destroyed.
+  void PrefetchAsMappings(std::vector<std::string> asset_names);
+
   // Obtain a raw pointer to the APKAssetProviderInternal.
   //
   // This method is intended for use in tests. Callers must not
@@ -46,6 +61,11 @@ class APKAssetProvider final : public AssetResolver {
  private:
   std::shared_ptr<APKAssetProviderInternal> impl_;
 
+  // Workers started by |PrefetchAsMappings|. fml::Thread joins on
+  // destruction, so the prefetch can never outlive the provider (or the
+  // APK mapping it reads from).
+  std::vector<std::unique_ptr<fml::Thread>> prefetch_threads_;
+
   // |flutter::AssetResolver|
   bool IsValid() const override;
 
@@ -1,4 +1,6 @@
 #include "flutter/shell/platform/android/apk_asset_provider.h"
+
+#include "flutter/fml/synchronization/count_down_latch.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -10,6 +12,11 @@ class MockAPKAssetProviderImpl : public APKAssetProviderInternal {
               GetAsMapping,
               (const std::string& asset_name),
               (const, override));
+
+  MOCK_METHOD(void,
+              PrefetchAsMapping,
+              (const std::string& asset_name),
+              (override));
 };
 
 TEST(APKAssetProvider, Clone) {
@@ -22,5 +29,18 @@ TEST(APKAssetProvider, Clone) {
   ASSERT_NE(first_provider->GetImpl(), second_provider->GetImpl());
   ASSERT_EQ(first_provider->GetImpl(), third_provider->GetImpl());
 }
+
+TEST(APKAssetProvider, PrefetchReachesEveryRequestedAsset) {
+  auto impl = std::make_shared<MockAPKAssetProviderImpl>();
+  auto provider = std::make_unique<APKAssetProvider>(impl);
+
+  fml::CountDownLatch latch(3u);
+  EXPECT_CALL(*impl, PrefetchAsMapping(::testing::_))
+      .Times(3)
+      .WillRepeatedly([&latch](const std::string&) { latch.CountDown(); });
+
+  provider->PrefetchAsMappings({"a", "b", "c"});
+  latch.Wait();
+}
 }  // namespace testing
 }  // namespace flutter
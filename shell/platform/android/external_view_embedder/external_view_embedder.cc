@@ -140,13 +140,21 @@ void AndroidExternalViewEmbedder::SubmitFrame(
   // Manually trigger the DlAutoCanvasRestore before we submit the frame
   save.Restore();
 
+  // If a platform view covers the entire frame and no Flutter content is
+  // drawn above any platform view, the background surface is completely
+  // hidden. Skip its submission so the fullscreen platform view (e.g. video
+  // playback) can be scanned out directly without an extra GPU composition
+  // layer being rastered beneath it every frame.
+  const bool background_occluded =
+      overlay_layers.empty() && BackgroundOccludedByPlatformView();
+
   // Submit the background canvas frame before switching the GL context to
   // the overlay surfaces.
   //
   // Skip a frame if the embedding is switching surfaces, and indicate in
   // `PostPrerollAction` that this frame must be resubmitted.
   auto should_submit_current_frame = previous_frame_view_count_ > 0;
-  if (should_submit_current_frame) {
+  if (should_submit_current_frame && !background_occluded) {
     frame->Submit();
   }
 
@@ -242,6 +250,33 @@ bool AndroidExternalViewEmbedder::FrameHasPlatformLayers() {
   return !composition_order_.empty();
 }
 
+bool AndroidExternalViewEmbedder::BackgroundOccludedByPlatformView() const {
+  const SkRect frame_rect = SkRect::Make(frame_size_);
+  for (int64_t view_id : composition_order_) {
+    if (!GetViewRect(view_id).contains(frame_rect)) {
+      continue;
+    }
+    // Transforms are already reflected in the bounding rect; a clip may
+    // shrink the visible region below it and reduced opacity lets the
+    // background show through, so either disqualifies the view.
+    const MutatorsStack& mutators = view_params_.at(view_id).mutatorsStack();
+    bool opaque = true;
+    for (auto mutator = mutators.Begin(); mutator != mutators.End();
+         ++mutator) {
+      if ((*mutator)->IsClipType() ||
+          ((*mutator)->GetType() == MutatorType::kOpacity &&
+           (*mutator)->GetAlpha() != 255)) {
+        opaque = false;
+        break;
+      }
+    }
+    if (opaque) {
+      return true;
+    }
+  }
+  return false;
+}
+
 // |ExternalViewEmbedder|
 DlCanvas* AndroidExternalViewEmbedder::GetRootCanvas() {
   // On Android, the root surface is created from the on-screen render target.
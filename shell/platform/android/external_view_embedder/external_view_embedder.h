@@ -134,6 +134,13 @@ class AndroidExternalViewEmbedder final : public ExternalViewEmbedder {
   // Whether the layer tree in the current frame has platform layers.
   bool FrameHasPlatformLayers();
 
+  // Whether a platform view in the current frame covers the entire frame
+  // without clip or opacity mutators, fully occluding the background
+  // surface. Such a frame needs no background submission: the platform view
+  // can be scanned out directly beneath the (unchanged) overlays-free
+  // Flutter layers.
+  bool BackgroundOccludedByPlatformView() const;
+
   // Creates a Surface when needed or recycles an existing one.
   // Finally, draws the picture on the frame's canvas.
   std::unique_ptr<SurfaceFrame> CreateSurfaceIfNeeded(GrDirectContext* context,
@@ -559,6 +559,98 @@ TEST(AndroidExternalViewEmbedder, OverlayCoverTwoPlatformViews) {
   embedder->EndFrame(/*should_resubmit_frame=*/false, raster_thread_merger);
 }
 
+TEST(AndroidExternalViewEmbedder, SubmitFrameFullscreenPlatformView) {
+  auto jni_mock = std::make_shared<JNIMock>();
+  auto android_context =
+      std::make_shared<AndroidContext>(AndroidRenderingAPI::kSoftware);
+  auto surface_factory = std::make_shared<TestAndroidSurfaceFactory>(
+      []() { return nullptr; });
+  auto embedder = std::make_unique<AndroidExternalViewEmbedder>(
+      *android_context, jni_mock, surface_factory, GetTaskRunnersForFixture());
+  auto raster_thread_merger = GetThreadMergerFromPlatformThread();
+  auto frame_size = SkISize::Make(1000, 1000);
+  SurfaceFrame::FramebufferInfo framebuffer_info;
+
+  auto make_surface_frame = [&framebuffer_info](bool* did_submit_frame) {
+    return std::make_unique<SurfaceFrame>(
+        SkSurfaces::Null(1000, 1000), framebuffer_info,
+        [did_submit_frame](const SurfaceFrame& surface_frame,
+                           DlCanvas* canvas) {
+          *did_submit_frame = true;
+          return true;
+        },
+        /*frame_size=*/SkISize::Make(800, 600));
+  };
+
+  MutatorsStack stack;
+  SkMatrix matrix = SkMatrix::I();
+
+  // ------------------ First frame ------------------ //
+  // A surface switch drops the first frame regardless of occlusion.
+  {
+    EXPECT_CALL(*jni_mock, FlutterViewBeginFrame());
+    embedder->BeginFrame(frame_size, nullptr, 1, raster_thread_merger);
+
+    embedder->PrerollCompositeEmbeddedView(
+        0, std::make_unique<EmbeddedViewParams>(
+               matrix, SkSize::Make(1000, 1000), stack));
+
+    EXPECT_CALL(*jni_mock, FlutterViewOnDisplayPlatformView(
+                               0, 0, 0, 1000, 1000, 1000, 1000, stack));
+    auto did_submit_frame = false;
+    embedder->SubmitFrame(nullptr, nullptr,
+                          make_surface_frame(&did_submit_frame));
+    EXPECT_FALSE(did_submit_frame);
+
+    EXPECT_CALL(*jni_mock, FlutterViewEndFrame());
+    embedder->EndFrame(/*should_resubmit_frame=*/false, raster_thread_merger);
+  }
+
+  // ------------------ Second frame ------------------ //
+  // The opaque platform view covers the frame and nothing is drawn above
+  // it, so the fully occluded background frame is not submitted.
+  {
+    EXPECT_CALL(*jni_mock, FlutterViewBeginFrame());
+    embedder->BeginFrame(frame_size, nullptr, 1, raster_thread_merger);
+
+    embedder->PrerollCompositeEmbeddedView(
+        0, std::make_unique<EmbeddedViewParams>(
+               matrix, SkSize::Make(1000, 1000), stack));
+
+    EXPECT_CALL(*jni_mock, FlutterViewOnDisplayPlatformView(
+                               0, 0, 0, 1000, 1000, 1000, 1000, stack));
+    auto did_submit_frame = false;
+    embedder->SubmitFrame(nullptr, nullptr,
+                          make_surface_frame(&did_submit_frame));
+    EXPECT_FALSE(did_submit_frame);
+
+    EXPECT_CALL(*jni_mock, FlutterViewEndFrame());
+    embedder->EndFrame(/*should_resubmit_frame=*/false, raster_thread_merger);
+  }
+
+  // ------------------ Third frame ------------------ //
+  // A platform view that doesn't cover the frame leaves the background
+  // visible, so its frame is submitted.
+  {
+    EXPECT_CALL(*jni_mock, FlutterViewBeginFrame());
+    embedder->BeginFrame(frame_size, nullptr, 1, raster_thread_merger);
+
+    embedder->PrerollCompositeEmbeddedView(
+        0, std::make_unique<EmbeddedViewParams>(matrix, SkSize::Make(100, 100),
+                                                stack));
+
+    EXPECT_CALL(*jni_mock, FlutterViewOnDisplayPlatformView(0, 0, 0, 100, 100,
+                                                            100, 100, stack));
+    auto did_submit_frame = false;
+    embedder->SubmitFrame(nullptr, nullptr,
+                          make_surface_frame(&did_submit_frame));
+    EXPECT_TRUE(did_submit_frame);
+
+    EXPECT_CALL(*jni_mock, FlutterViewEndFrame());
+    embedder->EndFrame(/*should_resubmit_frame=*/false, raster_thread_merger);
+  }
+}
+
 TEST(AndroidExternalViewEmbedder, SubmitFrameOverlayComposition) {
   auto jni_mock = std::make_shared<JNIMock>();
   auto android_context =
@@ -18,7 +18,13 @@ ImageExternalTextureVK::ImageExternalTextureVK(
     : ImageExternalTexture(id, image_texture_entry, jni_facade),
       impeller_context_(impeller_context) {}
 
-ImageExternalTextureVK::~ImageExternalTextureVK() {}
+// An ImageReader cycles through a small pool of buffers; a cache larger than
+// this means the producer was reconfigured and the old imports are stale.
+static constexpr size_t kMaxCachedImages = 8u;
+
+ImageExternalTextureVK::~ImageExternalTextureVK() {
+  ClearImageCache();
+}
 
 void ImageExternalTextureVK::Attach(PaintContext& context) {
   if (state_ == AttachmentState::kUninitialized) {
@@ -27,7 +33,16 @@ void ImageExternalTextureVK::Attach(PaintContext& context) {
   }
 }
 
-void ImageExternalTextureVK::Detach() {}
+void ImageExternalTextureVK::Detach() {
+  ClearImageCache();
+}
+
+void ImageExternalTextureVK::ClearImageCache() {
+  for (const auto& [hardware_buffer, _] : image_cache_) {
+    NDKHelpers::AHardwareBuffer_release(hardware_buffer);
+  }
+  image_cache_.clear();
+}
 
 void ImageExternalTextureVK::ProcessFrame(PaintContext& context,
                                           const SkRect& bounds) {
@@ -44,23 +59,49 @@ void ImageExternalTextureVK::ProcessFrame(PaintContext& context,
   flutter::NDKHelpers::AHardwareBuffer_describe(latest_hardware_buffer,
                                                 &hb_desc);
 
-  impeller::TextureDescriptor desc;
-  desc.storage_mode = impeller::StorageMode::kDevicePrivate;
-  desc.size = {static_cast<int>(bounds.width()),
-               static_cast<int>(bounds.height())};
-  // TODO(johnmccutchan): Use hb_desc to compute the correct format at runtime.
-  desc.format = impeller::PixelFormat::kR8G8B8A8UNormInt;
-  desc.mip_count = 1;
+  auto found = image_cache_.find(latest_hardware_buffer);
+  if (found != image_cache_.end() &&
+      found->second.desc.width == hb_desc.width &&
+      found->second.desc.height == hb_desc.height &&
+      found->second.desc.format == hb_desc.format) {
+    // The buffer has come around before; the imported image is still valid
+    // and only the contents have changed.
+    dl_image_ = found->second.image;
+  } else {
+    if (found != image_cache_.end()) {
+      // Same handle, different buffer: the old one was released and its
+      // address reused after a producer reconfiguration.
+      NDKHelpers::AHardwareBuffer_release(found->first);
+      image_cache_.erase(found);
+    } else if (image_cache_.size() >= kMaxCachedImages) {
+      ClearImageCache();
+    }
+
+    impeller::TextureDescriptor desc;
+    desc.storage_mode = impeller::StorageMode::kDevicePrivate;
+    desc.size = {static_cast<int>(bounds.width()),
+                 static_cast<int>(bounds.height())};
+    // TODO(johnmccutchan): Use hb_desc to compute the correct format at
+    // runtime.
+    desc.format = impeller::PixelFormat::kR8G8B8A8UNormInt;
+    desc.mip_count = 1;
 
-  auto texture_source =
-      std::make_shared<impeller::AndroidHardwareBufferTextureSourceVK>(
-          desc, impeller_context_->GetDevice(), latest_hardware_buffer,
-          hb_desc);
+    auto texture_source =
+        std::make_shared<impeller::AndroidHardwareBufferTextureSourceVK>(
+            desc, impeller_context_->GetDevice(), latest_hardware_buffer,
+            hb_desc);
 
-  auto texture =
-      std::make_shared<impeller::TextureVK>(impeller_context_, texture_source);
+    auto texture = std::make_shared<impeller::TextureVK>(impeller_context_,
+                                                         texture_source);
 
-  dl_image_ = impeller::DlImageImpeller::Make(texture);
+    dl_image_ = impeller::DlImageImpeller::Make(texture);
+
+    // The Vulkan import already keeps the buffer memory alive; this
+    // reference only pins the handle so the cache key cannot be recycled
+    // out from under us.
+    NDKHelpers::AHardwareBuffer_acquire(latest_hardware_buffer);
+    image_cache_[latest_hardware_buffer] = CachedImage{hb_desc, dl_image_};
+  }
   CloseHardwareBuffer(hardware_buffer);
   // IMPORTANT: We only close the old image after texture stops referencing
   // it.
@@ -7,6 +7,8 @@
 
 #include "flutter/shell/platform/android/image_external_texture.h"
 
+#include <unordered_map>
+
 #include "flutter/impeller/renderer/backend/vulkan/android_hardware_buffer_texture_source_vk.h"
 #include "flutter/impeller/renderer/backend/vulkan/context_vk.h"
 #include "flutter/impeller/renderer/backend/vulkan/vk.h"
@@ -30,9 +32,22 @@ class ImageExternalTextureVK : public ImageExternalTexture {
   void ProcessFrame(PaintContext& context, const SkRect& bounds) override;
   void Detach() override;
 
+  void ClearImageCache();
+
   const std::shared_ptr<impeller::ContextVK> impeller_context_;
 
   fml::jni::ScopedJavaGlobalRef<jobject> android_image_;
+
+  struct CachedImage {
+    AHardwareBuffer_Desc desc = {};
+    sk_sp<flutter::DlImage> image;
+  };
+
+  // Past imports keyed by buffer handle. An ImageReader cycles through a
+  // small pool of stable hardware buffers, so after the first lap every
+  // frame is served from here without re-running the Vulkan image import.
+  // Each key holds a reference on its buffer to keep the handle unique.
+  std::unordered_map<AHardwareBuffer*, CachedImage> image_cache_;
 };
 
 }  // namespace flutter
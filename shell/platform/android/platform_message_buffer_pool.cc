@@ -0,0 +1,86 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/android/platform_message_buffer_pool.h"
+
+#include <cstring>
+#include <utility>
+
+namespace flutter {
+
+// Carries a pooled buffer through the engine and hands it back to the cache
+// when the consumer (typically the Dart typed data finalizer) is done with
+// it. Destruction may happen on any thread.
+class PlatformMessageBufferPool::PooledMapping : public fml::Mapping {
+ public:
+  PooledMapping(std::shared_ptr<CachedBuffers> cached_buffers,
+                Buffer buffer,
+                size_t size)
+      : cached_buffers_(std::move(cached_buffers)),
+        buffer_(std::move(buffer)),
+        size_(size) {}
+
+  ~PooledMapping() override {
+    if (buffer_.capacity > kMaxPooledPayloadBytes) {
+      return;
+    }
+    std::lock_guard lock(cached_buffers_->mutex);
+    if (cached_buffers_->buffers.size() < kMaxCachedBuffers) {
+      cached_buffers_->buffers.push_back(std::move(buffer_));
+    }
+  }
+
+  // |fml::Mapping|
+  size_t GetSize() const override { return size_; }
+
+  // |fml::Mapping|
+  const uint8_t* GetMapping() const override { return buffer_.data.get(); }
+
+  // |fml::Mapping|
+  bool IsDontNeedSafe() const override { return false; }
+
+ private:
+  std::shared_ptr<CachedBuffers> cached_buffers_;
+  Buffer buffer_;
+  size_t size_;
+};
+
+PlatformMessageBufferPool::PlatformMessageBufferPool()
+    : cached_buffers_(std::make_shared<CachedBuffers>()) {}
+
+PlatformMessageBufferPool::~PlatformMessageBufferPool() = default;
+
+std::unique_ptr<fml::Mapping> PlatformMessageBufferPool::Copy(
+    const uint8_t* data,
+    size_t size) {
+  if (size < kMinPooledPayloadBytes) {
+    return std::make_unique<fml::MallocMapping>(
+        fml::MallocMapping::Copy(data, size));
+  }
+
+  Buffer buffer;
+  {
+    std::lock_guard lock(cached_buffers_->mutex);
+    auto& buffers = cached_buffers_->buffers;
+    for (auto it = buffers.begin(); it != buffers.end(); ++it) {
+      if (it->capacity >= size) {
+        buffer = std::move(*it);
+        buffers.erase(it);
+        break;
+      }
+    }
+  }
+
+  if (buffer.data == nullptr) {
+    buffer.data = std::make_unique<uint8_t[]>(size);
+    buffer.capacity = size;
+  }
+
+  std::memcpy(buffer.data.get(), data, size);
+
+  return std::make_unique<PooledMapping>(cached_buffers_, std::move(buffer),
+                                         size);
+}
+
+}  // namespace flutter
@@ -0,0 +1,73 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef SHELL_PLATFORM_ANDROID_PLATFORM_MESSAGE_BUFFER_POOL_H_
+#define SHELL_PLATFORM_ANDROID_PLATFORM_MESSAGE_BUFFER_POOL_H_
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "flutter/fml/mapping.h"
+
+namespace flutter {
+
+// Recycles the destination buffers used when platform message payloads are
+// copied out of Java direct ByteBuffers. The copy itself is mandated by the
+// messenger contract (the Java caller keeps ownership of its buffer), but
+// plugin channels that stream large payloads - camera frames, audio chunks -
+// would otherwise also pay a malloc plus the attendant soft page faults for
+// every single message. Reusing a small set of warm buffers makes the copy
+// the only per-message cost.
+//
+// Payloads below |kMinPooledPayloadBytes| are copied into plain malloc backed
+// mappings since the pool bookkeeping would cost more than the allocation it
+// saves.
+class PlatformMessageBufferPool {
+ public:
+  // Payloads smaller than this are not worth pooling.
+  static constexpr size_t kMinPooledPayloadBytes = 64u * 1024u;
+
+  // Buffers that grew beyond this are freed instead of being cached so that
+  // one outsized message cannot pin memory for the rest of the session.
+  static constexpr size_t kMaxPooledPayloadBytes = 8u * 1024u * 1024u;
+
+  PlatformMessageBufferPool();
+
+  ~PlatformMessageBufferPool();
+
+  // Copies |size| bytes starting at |data| into a mapping. Large payloads
+  // draw their backing buffer from the pool and return it when the mapping
+  // is destroyed; the mapping may safely outlive the pool. Callable from any
+  // thread.
+  std::unique_ptr<fml::Mapping> Copy(const uint8_t* data, size_t size);
+
+ private:
+  struct Buffer {
+    std::unique_ptr<uint8_t[]> data;
+    size_t capacity = 0;
+  };
+
+  // Shared with the pooled mappings so buffers recycled after the pool is
+  // torn down are freed instead of dangling.
+  struct CachedBuffers {
+    std::mutex mutex;
+    std::vector<Buffer> buffers;
+  };
+
+  class PooledMapping;
+
+  static constexpr size_t kMaxCachedBuffers = 2u;
+
+  std::shared_ptr<CachedBuffers> cached_buffers_;
+
+  PlatformMessageBufferPool(const PlatformMessageBufferPool&) = delete;
+
+  PlatformMessageBufferPool& operator=(const PlatformMessageBufferPool&) =
+      delete;
+};
+
+}  // namespace flutter
+
+#endif  // SHELL_PLATFORM_ANDROID_PLATFORM_MESSAGE_BUFFER_POOL_H_
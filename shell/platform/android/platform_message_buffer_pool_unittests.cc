@@ -0,0 +1,72 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/android/platform_message_buffer_pool.h"
+
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+static std::vector<uint8_t> MakePayload(size_t size) {
+  std::vector<uint8_t> payload(size);
+  std::iota(payload.begin(), payload.end(), 0);
+  return payload;
+}
+
+TEST(PlatformMessageBufferPool, CopiesSmallPayloads) {
+  PlatformMessageBufferPool pool;
+  auto payload =
+      MakePayload(PlatformMessageBufferPool::kMinPooledPayloadBytes / 2);
+  auto mapping = pool.Copy(payload.data(), payload.size());
+  ASSERT_EQ(mapping->GetSize(), payload.size());
+  EXPECT_EQ(memcmp(mapping->GetMapping(), payload.data(), payload.size()), 0);
+  EXPECT_NE(mapping->GetMapping(), payload.data());
+}
+
+TEST(PlatformMessageBufferPool, ReusesBuffersForLargePayloads) {
+  PlatformMessageBufferPool pool;
+  auto payload =
+      MakePayload(PlatformMessageBufferPool::kMinPooledPayloadBytes);
+  auto mapping = pool.Copy(payload.data(), payload.size());
+  const uint8_t* first_buffer = mapping->GetMapping();
+  mapping.reset();
+  mapping = pool.Copy(payload.data(), payload.size());
+  EXPECT_EQ(mapping->GetMapping(), first_buffer);
+  EXPECT_EQ(memcmp(mapping->GetMapping(), payload.data(), payload.size()), 0);
+}
+
+TEST(PlatformMessageBufferPool, GrowsWhenCachedBuffersAreTooSmall) {
+  PlatformMessageBufferPool pool;
+  auto small_payload =
+      MakePayload(PlatformMessageBufferPool::kMinPooledPayloadBytes);
+  pool.Copy(small_payload.data(), small_payload.size()).reset();
+
+  auto large_payload =
+      MakePayload(PlatformMessageBufferPool::kMinPooledPayloadBytes * 2);
+  auto mapping = pool.Copy(large_payload.data(), large_payload.size());
+  ASSERT_EQ(mapping->GetSize(), large_payload.size());
+  EXPECT_EQ(
+      memcmp(mapping->GetMapping(), large_payload.data(), large_payload.size()),
+      0);
+}
+
+TEST(PlatformMessageBufferPool, MappingMayOutliveThePool) {
+  auto payload =
+      MakePayload(PlatformMessageBufferPool::kMinPooledPayloadBytes);
+  std::unique_ptr<fml::Mapping> mapping;
+  {
+    PlatformMessageBufferPool pool;
+    mapping = pool.Copy(payload.data(), payload.size());
+  }
+  EXPECT_EQ(memcmp(mapping->GetMapping(), payload.data(), payload.size()), 0);
+  mapping.reset();
+}
+
+}  // namespace testing
+}  // namespace flutter
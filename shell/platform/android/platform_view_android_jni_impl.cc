@@ -33,6 +33,7 @@
 #include "flutter/shell/platform/android/flutter_main.h"
 #include "flutter/shell/platform/android/image_external_texture_gl.h"
 #include "flutter/shell/platform/android/jni/platform_view_android_jni.h"
+#include "flutter/shell/platform/android/platform_message_buffer_pool.h"
 #include "flutter/shell/platform/android/platform_view_android.h"
 #include "flutter/shell/platform/android/surface_texture_external_texture_gl.h"
 
@@ -277,6 +278,16 @@ static void RunBundleAndSnapshotFromLibrary(JNIEnv* env,
       jAssetManager,                                  // asset manager
       fml::jni::JavaStringToString(env, jBundlePath)  // apk asset dir
   );
+
+  // Overlap the cold start asset reads with engine launch and VM startup
+  // instead of paying for them serially on first use. These are the assets
+  // every run loads before the first frame; names that do not exist in this
+  // build mode (e.g. kernel_blob.bin on AOT builds) are skipped.
+  apk_asset_provider->PrefetchAsMappings({
+      "kernel_blob.bin",
+      "AssetManifest.bin",
+      "FontManifest.json",
+  });
   auto entrypoint = fml::jni::JavaStringToString(env, jEntrypoint);
   auto libraryUrl = fml::jni::JavaStringToString(env, jLibraryUrl);
   auto entrypoint_args = fml::jni::StringListToVector(env, jEntrypointArgs);
@@ -535,8 +546,14 @@ static void InvokePlatformMessageResponseCallback(JNIEnv* env,
   uint8_t* response_data =
       static_cast<uint8_t*>(env->GetDirectBufferAddress(message));
   FML_DCHECK(response_data != nullptr);
-  auto mapping = std::make_unique<fml::MallocMapping>(
-      fml::MallocMapping::Copy(response_data, response_data + position));
+  // The messenger contract leaves ownership of the buffer with the Java
+  // caller, so the copy must happen before this call returns. Pool the copy
+  // destinations so plugin channels streaming large responses do not also
+  // pay an allocation per message. Deliberately leaked: pooled mappings may
+  // be finalized during shutdown.
+  static auto* response_buffer_pool = new PlatformMessageBufferPool();
+  auto mapping =
+      response_buffer_pool->Copy(response_data, static_cast<size_t>(position));
   ANDROID_SHELL_HOLDER->GetPlatformMessageHandler()
       ->InvokePlatformMessageResponseCallback(responseId, std::move(mapping));
 }
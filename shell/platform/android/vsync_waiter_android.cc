@@ -34,7 +34,21 @@ void VsyncWaiterAndroid::AwaitVSync() {
     auto* weak_this = new std::weak_ptr<VsyncWaiter>(shared_from_this());
     fml::TaskRunner::RunNowOrPostTask(
         task_runners_.GetUITaskRunner(), [weak_this]() {
-          AndroidChoreographer::PostFrameCallback(&OnVsyncFromNDK, weak_this);
+          // Keep the cached refresh rate current when the display switches
+          // rates without a Java-side surface reconfiguration, as dynamic
+          // refresh rate displays do. Registered once per process, on the UI
+          // thread since the callback needs a looper.
+          static const bool refresh_rate_callback_registered =
+              AndroidChoreographer::RegisterRefreshRateCallback(
+                  &OnRefreshRateUpdatedFromNDK, nullptr);
+          (void)refresh_rate_callback_registered;
+          if (AndroidChoreographer::ShouldUseVsyncCallback()) {
+            AndroidChoreographer::PostVsyncCallback(
+                &OnVsyncFromNDKWithDeadline, weak_this);
+          } else {
+            AndroidChoreographer::PostFrameCallback(&OnVsyncFromNDK,
+                                                    weak_this);
+          }
         });
   } else {
     // TODO(99798): Remove it when we drop support for API level < 29.
@@ -70,6 +84,39 @@ void VsyncWaiterAndroid::OnVsyncFromNDK(int64_t frame_nanos, void* data) {
   ConsumePendingCallback(weak_this, frame_time, target_time);
 }
 
+// static
+void VsyncWaiterAndroid::OnVsyncFromNDKWithDeadline(int64_t frame_nanos,
+                                                    int64_t deadline_nanos,
+                                                    void* data) {
+  auto frame_time = fml::TimePoint::FromEpochDelta(
+      fml::TimeDelta::FromNanoseconds(frame_nanos));
+  auto now = fml::TimePoint::Now();
+  if (frame_time > now) {
+    frame_time = now;
+  }
+  // The compositor deadline of the preferred frame timeline replaces the
+  // refresh period heuristic: on dynamic refresh rate displays it reflects
+  // when this frame must actually be submitted.
+  auto target_time = fml::TimePoint::FromEpochDelta(
+      fml::TimeDelta::FromNanoseconds(deadline_nanos));
+
+  TRACE_EVENT2_INT("flutter", "PlatformVsync", "frame_start_time",
+                   frame_time.ToEpochDelta().ToMicroseconds(),
+                   "frame_target_time",
+                   target_time.ToEpochDelta().ToMicroseconds());
+
+  auto* weak_this = reinterpret_cast<std::weak_ptr<VsyncWaiter>*>(data);
+  ConsumePendingCallback(weak_this, frame_time, target_time);
+}
+
+// static
+void VsyncWaiterAndroid::OnRefreshRateUpdatedFromNDK(int64_t vsync_period_nanos,
+                                                     void* data) {
+  FML_DCHECK(vsync_period_nanos > 0);
+  g_refresh_rate_ =
+      static_cast<uint>(std::round(1000000000.0 / vsync_period_nanos));
+}
+
 // static
 void VsyncWaiterAndroid::OnVsyncFromJava(JNIEnv* env,
                                          jclass jcaller,
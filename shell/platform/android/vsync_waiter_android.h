@@ -30,6 +30,13 @@ class VsyncWaiterAndroid final : public VsyncWaiter {
 
   static void OnVsyncFromNDK(int64_t frame_nanos, void* data);
 
+  static void OnVsyncFromNDKWithDeadline(int64_t frame_nanos,
+                                         int64_t deadline_nanos,
+                                         void* data);
+
+  static void OnRefreshRateUpdatedFromNDK(int64_t vsync_period_nanos,
+                                          void* data);
+
   static void OnVsyncFromJava(JNIEnv* env,
                               jclass jcaller,
                               jlong frameDelayNanos,
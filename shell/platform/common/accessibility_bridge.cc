@@ -125,6 +125,9 @@ void AccessibilityBridge::CommitUpdates() {
     OnAccessibilityEvent(targeted_event);
   }
   event_generator_.ClearEvents();
+
+  // Lets subclasses flush any native events they batched during the update.
+  OnSemanticsUpdateComplete();
 }
 
 std::weak_ptr<FlutterPlatformNodeDelegate>
@@ -148,6 +148,13 @@ class AccessibilityBridge
   virtual void OnAccessibilityEvent(
       ui::AXEventGenerator::TargetedEvent targeted_event) = 0;
 
+  //---------------------------------------------------------------------------
+  /// @brief      Called by CommitUpdates once every accessibility event
+  ///             generated by a semantics update has been delivered to
+  ///             OnAccessibilityEvent. Subclasses that batch native events
+  ///             may override this to emit them in a single dispatch.
+  virtual void OnSemanticsUpdateComplete() {}
+
   //---------------------------------------------------------------------------
   /// @brief      Creates a platform specific FlutterPlatformNodeDelegate.
   ///             Ownership passes to the caller. This method will be called
@@ -54,7 +54,9 @@ GPUCAMetalLayerHandle IOSSurfaceMetalImpeller::GetCAMetalLayer(const SkISize& fr
 
   // Flutter needs to read from the color attachment in cases where there are effects such as
   // backdrop filters. Flutter plugins that create platform views may also read from the layer.
-  layer.framebufferOnly = NO;
+  if (layer.framebufferOnly) {
+    layer.framebufferOnly = NO;
+  }
 
   // When there are platform views in the scene, the drawable needs to be presented in the same
   // transaction as the one created for platform views. When the drawable are being presented from
@@ -62,7 +64,15 @@ GPUCAMetalLayerHandle IOSSurfaceMetalImpeller::GetCAMetalLayer(const SkISize& fr
   // presented. If there is a non-Flutter UIView active, such as in add2app or a
   // presentViewController page transition, then this will cause CoreAnimation assertion errors and
   // exit the app.
-  layer.presentsWithTransaction = [[NSThread currentThread] isMainThread];
+  //
+  // Only write the property when the value actually changes: every write re-dirties the layer,
+  // and during a platform view sequence the flag flips once when the threads merge and once when
+  // they unmerge, not on every frame. This keeps steady-state platform-view frames batched in a
+  // single CoreAnimation commit with the platform view mutations.
+  const BOOL presents_with_transaction = [[NSThread currentThread] isMainThread];
+  if (layer.presentsWithTransaction != presents_with_transaction) {
+    layer.presentsWithTransaction = presents_with_transaction;
+  }
 
   return layer;
 }
@@ -1930,15 +1930,51 @@ FlutterEngineResult FlutterEngineInitialize(size_t version,
     const FlutterOpenGLRendererConfig* open_gl_config = &config->open_gl;
     if (SAFE_ACCESS(open_gl_config, gl_external_texture_frame_callback,
                     nullptr) != nullptr) {
+      // The proc resolver is used to look up glWaitSync when the embedder
+      // hands over frames guarded by a sync fence. Resolution is deferred to
+      // the raster thread where the callback is invoked with the engine
+      // context current.
+      flutter::GPUSurfaceGLDelegate::GLProcResolver gl_proc_resolver = nullptr;
+      if (SAFE_ACCESS(open_gl_config, gl_proc_resolver, nullptr) != nullptr) {
+        gl_proc_resolver = [ptr = open_gl_config->gl_proc_resolver,
+                            user_data](const char* gl_proc_name) {
+          return ptr(user_data, gl_proc_name);
+        };
+      } else {
+#if FML_OS_LINUX || FML_OS_WIN
+        gl_proc_resolver = DefaultGLProcResolver;
+#endif
+      }
+      using WaitSyncProc = void (*)(void* /* sync */,
+                                    uint32_t /* flags */,
+                                    uint64_t /* timeout */);
       external_texture_callback =
-          [ptr = open_gl_config->gl_external_texture_frame_callback, user_data](
+          [ptr = open_gl_config->gl_external_texture_frame_callback, user_data,
+           gl_proc_resolver, wait_sync = static_cast<WaitSyncProc>(nullptr)](
               int64_t texture_identifier, size_t width,
-              size_t height) -> std::unique_ptr<FlutterOpenGLTexture> {
+              size_t height) mutable -> std::unique_ptr<FlutterOpenGLTexture> {
         std::unique_ptr<FlutterOpenGLTexture> texture =
             std::make_unique<FlutterOpenGLTexture>();
         if (!ptr(user_data, texture_identifier, width, height, texture.get())) {
           return nullptr;
         }
+        if (texture->frame_sync_fence != nullptr) {
+          if (wait_sync == nullptr && gl_proc_resolver) {
+            wait_sync = reinterpret_cast<WaitSyncProc>(
+                gl_proc_resolver("glWaitSync"));
+          }
+          if (wait_sync != nullptr) {
+            // Sequence all subsequent commands (notably the sampling of the
+            // texture by the compositor) after the producer signals the
+            // fence. The flags must be zero and the timeout GL_TIMEOUT_IGNORED
+            // per the OpenGL (ES) specifications. This is a server-side wait
+            // and does not stall the raster thread.
+            wait_sync(texture->frame_sync_fence, 0u, 0xFFFFFFFFFFFFFFFFull);
+          } else {
+            FML_LOG(ERROR) << "Embedder supplied a texture sync fence but "
+                              "glWaitSync could not be resolved.";
+          }
+        }
         return texture;
       };
       external_texture_resolver =
@@ -3162,6 +3198,72 @@ FlutterEngineResult FlutterEngineSetNextFrameCallback(
   return kSuccess;
 }
 
+FlutterEngineResult FlutterEngineWarmupRenderer(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    const FlutterRendererWarmupInfo* warmup_info) {
+  if (engine == nullptr) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Invalid engine handle.");
+  }
+
+  if (warmup_info == nullptr) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Warmup info was null.");
+  }
+
+  uint64_t features = SAFE_ACCESS(warmup_info, features, 0);
+  if (features == 0) {
+    // Nothing to warm up.
+    return kSuccess;
+  }
+
+  if (!reinterpret_cast<flutter::EmbedderEngine*>(engine)->WarmupRenderer(
+          features)) {
+    return LOG_EMBEDDER_ERROR(kInternalInconsistency,
+                              "Could not schedule renderer warmup.");
+  }
+
+  return kSuccess;
+}
+
+FlutterEngineResult FlutterEngineGetStartupPhases(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterStartupPhases* phases) {
+  if (engine == nullptr) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Invalid engine handle.");
+  }
+
+  if (phases == nullptr) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Null phases specified.");
+  }
+
+  auto embedder_engine = reinterpret_cast<flutter::EmbedderEngine*>(engine);
+  if (!embedder_engine->IsValid()) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Engine not valid.");
+  }
+
+  const flutter::StartupPhaseTracker* tracker =
+      embedder_engine->GetShell().GetStartupPhaseTracker();
+  auto phase_nanos = [tracker](flutter::StartupPhase phase) -> uint64_t {
+    auto time = tracker->GetPhaseTime(phase);
+    return time.has_value() ? time->ToEpochDelta().ToNanoseconds() : 0;
+  };
+
+#define SET_PHASE(member, phase)           \
+  if (STRUCT_HAS_MEMBER(phases, member)) { \
+    phases->member = phase_nanos(phase);   \
+  }
+
+  SET_PHASE(engine_create, flutter::StartupPhase::kEngineCreate);
+  SET_PHASE(vm_init, flutter::StartupPhase::kVMInit);
+  SET_PHASE(isolate_launch, flutter::StartupPhase::kIsolateLaunch);
+  SET_PHASE(first_frame_scheduled,
+            flutter::StartupPhase::kFirstFrameScheduled);
+  SET_PHASE(first_raster, flutter::StartupPhase::kFirstRaster);
+  SET_PHASE(first_present, flutter::StartupPhase::kFirstPresent);
+#undef SET_PHASE
+
+  return kSuccess;
+}
+
 FlutterEngineResult FlutterEngineGetProcAddresses(
     FlutterEngineProcTable* table) {
   if (!table) {
@@ -3214,6 +3316,8 @@ FlutterEngineResult FlutterEngineGetProcAddresses(
   SET_PROC(NotifyDisplayUpdate, FlutterEngineNotifyDisplayUpdate);
   SET_PROC(ScheduleFrame, FlutterEngineScheduleFrame);
   SET_PROC(SetNextFrameCallback, FlutterEngineSetNextFrameCallback);
+  SET_PROC(WarmupRenderer, FlutterEngineWarmupRenderer);
+  SET_PROC(GetStartupPhases, FlutterEngineGetStartupPhases);
 #undef SET_PROC
 
   return kSuccess;
@@ -376,6 +376,15 @@ typedef struct {
   size_t width;
   /// Height of the texture.
   size_t height;
+  /// Optional sync object (a `GLsync` handle cast to `void*`) signaled by the
+  /// producer of the texture contents, default is NULL. When set, the engine
+  /// inserts a server-side wait on the fence before sampling the texture. This
+  /// allows embedders to hand over frames whose contents are still being
+  /// written by another context (for example, a video decoder) without a CPU
+  /// side `glFinish`, and to cycle a small pool of textures per frame. The
+  /// embedder retains ownership of the sync object and may delete it in the
+  /// destruction callback once the engine is done with the frame.
+  void* frame_sync_fence;
 } FlutterOpenGLTexture;
 
 typedef struct {
@@ -1844,6 +1853,53 @@ typedef enum {
   kFlutterEngineDisplaysUpdateTypeCount,
 } FlutterEngineDisplaysUpdateType;
 
+/// Bitmask values describing the rendering paths that
+/// `FlutterEngineWarmupRenderer` should prepare ahead of their first use.
+typedef enum {
+  /// Solid color fills and clips.
+  kFlutterRendererWarmupSolidFills = 1 << 0,
+  /// Linear, radial, conical and sweep gradient fills.
+  kFlutterRendererWarmupGradients = 1 << 1,
+  /// Glyph rendering, including colored glyphs.
+  kFlutterRendererWarmupText = 1 << 2,
+  /// Gaussian and mask blurs, including blurred rounded rectangles.
+  kFlutterRendererWarmupBlurs = 1 << 3,
+  /// Pipeline and advanced blend modes.
+  kFlutterRendererWarmupBlends = 1 << 4,
+} FlutterRendererWarmupFeature;
+
+typedef struct {
+  /// The size of this struct. Must be sizeof(FlutterRendererWarmupInfo).
+  size_t struct_size;
+  /// A bitmask of `FlutterRendererWarmupFeature` values describing which
+  /// rendering paths to prepare.
+  uint64_t features;
+} FlutterRendererWarmupInfo;
+
+/// The timestamps of an engine's startup milestones, filled by
+/// `FlutterEngineGetStartupPhases`. All timestamps are in nanoseconds on the
+/// clock used by `FlutterEngineGetCurrentTime`; a milestone the engine has
+/// not reached yet is reported as zero.
+typedef struct {
+  /// The size of this struct. Must be sizeof(FlutterStartupPhases).
+  size_t struct_size;
+  /// When the engine object was constructed on the platform thread.
+  uint64_t engine_create;
+  /// When the Dart VM serving the engine finished initializing. Engines
+  /// sharing a running VM report the timestamp of the lease, not of the
+  /// original VM launch.
+  uint64_t vm_init;
+  /// When the root isolate was configured and started running Dart code.
+  uint64_t isolate_launch;
+  /// When the first vsync-aligned frame began building on the UI thread.
+  uint64_t first_frame_scheduled;
+  /// When rasterization of the first frame started on the raster thread.
+  uint64_t first_raster;
+  /// When the first frame finished rasterizing and was handed to the surface
+  /// for presentation.
+  uint64_t first_present;
+} FlutterStartupPhases;
+
 typedef int64_t FlutterEngineDartPort;
 
 typedef enum {
@@ -2952,6 +3008,47 @@ FlutterEngineResult FlutterEngineSetNextFrameCallback(
     VoidCallback callback,
     void* user_data);
 
+//------------------------------------------------------------------------------
+/// @brief      Asks the engine to prepare the rendering paths described in the
+///             warmup info ahead of their first use, so that the first
+///             interaction that needs them does not pay shader or pipeline
+///             compilation costs at draw time. The work is scheduled on the
+///             render thread at a priority that does not delay frames and
+///             overlaps application startup when this call is made right
+///             after `FlutterEngineRunInitialized`. Rendering backends whose
+///             pipelines are fully compiled ahead of time ignore the request.
+///
+/// @param[in]  engine       A running engine instance.
+/// @param[in]  warmup_info  The description of the rendering paths to warm up.
+///
+/// @return     The result of the call.
+///
+FLUTTER_EXPORT
+FlutterEngineResult FlutterEngineWarmupRenderer(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    const FlutterRendererWarmupInfo* warmup_info);
+
+//------------------------------------------------------------------------------
+/// @brief      Reads the timestamps of the engine's startup milestones. The
+///             milestones are recorded unconditionally at nanosecond
+///             precision, so cold-start harnesses can attribute launch time
+///             to its phases without attaching a trace or matching trace
+///             event strings. Milestones the engine has not reached yet are
+///             reported as zero; the call may be made repeatedly from any
+///             thread to poll for later phases.
+///
+/// @param[in]  engine   A running engine instance.
+/// @param[out] phases   The struct to fill with the recorded timestamps.
+///                      This should be zero-initialized, except for
+///                      struct_size.
+///
+/// @return     The result of the call.
+///
+FLUTTER_EXPORT
+FlutterEngineResult FlutterEngineGetStartupPhases(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterStartupPhases* phases);
+
 #endif  // !FLUTTER_ENGINE_NO_PROTOTYPES
 
 // Typedefs for the function pointers in FlutterEngineProcTable.
@@ -3074,6 +3171,12 @@ typedef FlutterEngineResult (*FlutterEngineSetNextFrameCallbackFnPtr)(
     FLUTTER_API_SYMBOL(FlutterEngine) engine,
     VoidCallback callback,
     void* user_data);
+typedef FlutterEngineResult (*FlutterEngineWarmupRendererFnPtr)(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    const FlutterRendererWarmupInfo* warmup_info);
+typedef FlutterEngineResult (*FlutterEngineGetStartupPhasesFnPtr)(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterStartupPhases* phases);
 
 /// Function-pointer-based versions of the APIs above.
 typedef struct {
@@ -3120,6 +3223,8 @@ typedef struct {
   FlutterEngineNotifyDisplayUpdateFnPtr NotifyDisplayUpdate;
   FlutterEngineScheduleFrameFnPtr ScheduleFrame;
   FlutterEngineSetNextFrameCallbackFnPtr SetNextFrameCallback;
+  FlutterEngineWarmupRendererFnPtr WarmupRenderer;
+  FlutterEngineGetStartupPhasesFnPtr GetStartupPhases;
 } FlutterEngineProcTable;
 
 //------------------------------------------------------------------------------
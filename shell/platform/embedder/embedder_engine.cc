@@ -4,11 +4,95 @@
 
 #include "flutter/shell/platform/embedder/embedder_engine.h"
 
+#include <string>
+#include <vector>
+
 #include "flutter/fml/make_copyable.h"
+#include "flutter/fml/trace_event.h"
 #include "flutter/shell/platform/embedder/vsync_waiter_embedder.h"
 
+#ifdef IMPELLER_SUPPORTS_RENDERING
+#include "impeller/aiks/aiks_context.h"                   // nogncheck
+#include "impeller/entity/contents/content_context.h"     // nogncheck
+#include "impeller/entity/entity.h"                       // nogncheck
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
 namespace flutter {
 
+namespace {
+
+// Pre-creates the pipeline variants behind the requested warm-up features.
+// Runs on the raster thread. Families that are unsupported by the device are
+// skipped by |ContentContext::WarmUpVariant|.
+void WarmUpRenderingPaths(
+    const std::shared_ptr<impeller::AiksContext>& aiks_context,
+    uint64_t features) {
+#ifdef IMPELLER_SUPPORTS_RENDERING
+  if (!aiks_context || !aiks_context->IsValid()) {
+    // Backends that do not render through Impeller have no lazily compiled
+    // pipeline variants to prepare.
+    return;
+  }
+  TRACE_EVENT0("flutter", "WarmUpRenderingPaths");
+  impeller::ContentContext& content_context =
+      aiks_context->GetContentContext();
+
+  // Mirror the options onscreen render passes use so that the variants
+  // created here are the ones the first frame will request.
+  impeller::ContentContextOptions options;
+  options.sample_count = impeller::SampleCount::kCount4;
+  options.color_attachment_pixel_format =
+      content_context.GetDeviceCapabilities().GetDefaultColorFormat();
+
+  std::vector<std::string> families;
+  if (features & kFlutterRendererWarmupSolidFills) {
+    families.insert(families.end(), {"SolidFill", "Clip"});
+  }
+  if (features & kFlutterRendererWarmupGradients) {
+    families.insert(families.end(),
+                    {"LinearGradientFill", "RadialGradientFill",
+                     "ConicalGradientFill", "SweepGradientFill",
+                     "LinearGradientSSBOFill", "RadialGradientSSBOFill",
+                     "ConicalGradientSSBOFill", "SweepGradientSSBOFill"});
+  }
+  if (features & kFlutterRendererWarmupText) {
+    families.insert(families.end(), {"GlyphAtlas", "GlyphAtlasColor"});
+  }
+  if (features & kFlutterRendererWarmupBlurs) {
+    families.insert(families.end(),
+                    {"GaussianBlur", "GaussianBlurDecal", "BorderMaskBlur",
+                     "RRectBlur", "GlyphAtlasBlur"});
+  }
+  if (features & kFlutterRendererWarmupBlends) {
+    families.insert(
+        families.end(),
+        {"PorterDuffBlend", "TextureBlend", "BlendScreen", "BlendOverlay",
+         "BlendDarken", "BlendLighten", "BlendColorDodge", "BlendColorBurn",
+         "BlendHardLight", "BlendSoftLight", "BlendDifference",
+         "BlendExclusion", "BlendMultiply", "BlendHue", "BlendSaturation",
+         "BlendColor", "BlendLuminosity"});
+  }
+
+  for (const std::string& family : families) {
+    content_context.WarmUpVariant(family, options);
+  }
+
+  if (features & kFlutterRendererWarmupBlends) {
+    // Pipeline blends vary the attachment blend configuration of the texture
+    // pipeline rather than the shader, so each mode is a distinct variant.
+    impeller::ContentContextOptions blend_options = options;
+    for (auto mode = static_cast<int>(impeller::BlendMode::kClear);
+         mode <= static_cast<int>(impeller::Entity::kLastPipelineBlendMode);
+         mode++) {
+      blend_options.blend_mode = static_cast<impeller::BlendMode>(mode);
+      content_context.WarmUpVariant("Texture", blend_options);
+    }
+  }
+#endif  // IMPELLER_SUPPORTS_RENDERING
+}
+
+}  // namespace
+
 struct ShellArgs {
   Settings settings;
   Shell::CreateCallback<PlatformView> on_create_platform_view;
@@ -227,6 +311,20 @@ bool EmbedderEngine::ReloadSystemFonts() {
   return shell_->ReloadSystemFonts();
 }
 
+bool EmbedderEngine::WarmupRenderer(uint64_t features) {
+  if (!IsValid()) {
+    return false;
+  }
+
+  shell_->GetTaskRunners().GetRasterTaskRunner()->PostTask(
+      [rasterizer = shell_->GetRasterizer(), features]() {
+        if (rasterizer) {
+          WarmUpRenderingPaths(rasterizer->GetAiksContext(), features);
+        }
+      });
+  return true;
+}
+
 bool EmbedderEngine::PostRenderThreadTask(const fml::closure& task) {
   if (!IsValid()) {
     return false;
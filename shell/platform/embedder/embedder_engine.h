@@ -76,6 +76,11 @@ class EmbedderEngine {
 
   bool ReloadSystemFonts();
 
+  // Schedules pre-creation of the rendering pipeline variants behind the
+  // given `FlutterRendererWarmupFeature` bits on the raster thread, ahead of
+  // the first frame that needs them.
+  bool WarmupRenderer(uint64_t features);
+
   bool PostRenderThreadTask(const fml::closure& task);
 
   bool RunTask(const FlutterTask* task);
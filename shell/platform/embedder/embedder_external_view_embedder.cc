@@ -5,8 +5,11 @@
 #include "flutter/shell/platform/embedder/embedder_external_view_embedder.h"
 
 #include <algorithm>
+#include <atomic>
+#include <thread>
 #include <utility>
 
+#include "flutter/fml/synchronization/count_down_latch.h"
 #include "flutter/shell/platform/embedder/embedder_layers.h"
 #include "flutter/shell/platform/embedder/embedder_render_target.h"
 #include "third_party/skia/include/gpu/GrDirectContext.h"
@@ -192,13 +195,46 @@ void EmbedderExternalViewEmbedder::SubmitFrame(
 
   // Scribble embedder provide render targets. The order in which we scribble
   // into the buffers is irrelevant to the presentation order.
-  for (const auto& render_target : matched_render_targets) {
-    if (!pending_views_.at(render_target.first)
-             ->Render(*render_target.second)) {
-      FML_LOG(ERROR)
-          << "Could not render into the embedder supplied render target.";
-      return;
+  bool rendered_all_views = true;
+  if (context == nullptr && aiks_context == nullptr &&
+      matched_render_targets.size() > 1) {
+    // Without a GPU context, the render targets are independent CPU raster
+    // surfaces and the views can be rasterized concurrently. GPU backends
+    // must keep encoding on the raster thread, one view at a time.
+    if (!layer_render_workers_) {
+      layer_render_workers_ = fml::ConcurrentMessageLoop::Create(
+          std::clamp<size_t>(std::thread::hardware_concurrency(), 1u, 4u));
+    }
+    auto worker_task_runner = layer_render_workers_->GetTaskRunner();
+    fml::CountDownLatch latch(matched_render_targets.size());
+    std::atomic<bool> all_views_rendered{true};
+    for (const auto& render_target : matched_render_targets) {
+      EmbedderExternalView* view =
+          pending_views_.at(render_target.first).get();
+      EmbedderRenderTarget* target = render_target.second.get();
+      worker_task_runner->PostTask(
+          [view, target, &latch, &all_views_rendered]() {
+            if (!view->Render(*target)) {
+              all_views_rendered = false;
+            }
+            latch.CountDown();
+          });
     }
+    latch.Wait();
+    rendered_all_views = all_views_rendered;
+  } else {
+    for (const auto& render_target : matched_render_targets) {
+      if (!pending_views_.at(render_target.first)
+               ->Render(*render_target.second)) {
+        rendered_all_views = false;
+        break;
+      }
+    }
+  }
+  if (!rendered_all_views) {
+    FML_LOG(ERROR)
+        << "Could not render into the embedder supplied render target.";
+    return;
   }
 
   // We are going to be transferring control back over to the embedder there the
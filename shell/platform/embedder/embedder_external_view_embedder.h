@@ -10,6 +10,7 @@
 #include <unordered_map>
 
 #include "flutter/flow/embedded_views.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/hash_combine.h"
 #include "flutter/fml/macros.h"
 #include "flutter/shell/platform/embedder/embedder_external_view.h"
@@ -114,6 +115,10 @@ class EmbedderExternalViewEmbedder final : public ExternalViewEmbedder {
   EmbedderExternalView::PendingViews pending_views_;
   std::vector<EmbedderExternalView::ViewIdentifier> composition_order_;
   EmbedderRenderTargetCache render_target_cache_;
+  // Workers used to rasterize independent layers concurrently when the
+  // render targets are CPU backed. Created on the first frame that can use
+  // them. GPU backends render serially on the raster thread instead.
+  std::shared_ptr<fml::ConcurrentMessageLoop> layer_render_workers_;
 
   void Reset();
 
@@ -1451,6 +1451,32 @@ TEST_F(EmbedderTest, CanSendLowMemoryNotification) {
   ASSERT_EQ(FlutterEngineNotifyLowMemoryWarning(engine.get()), kSuccess);
 }
 
+TEST_F(EmbedderTest, CanWarmupRenderer) {
+  auto& context = GetEmbedderContext(EmbedderTestContextType::kSoftwareContext);
+
+  EmbedderConfigBuilder builder(context);
+  builder.SetSoftwareRendererConfig();
+
+  auto engine = builder.LaunchEngine();
+
+  ASSERT_TRUE(engine.is_valid());
+
+  ASSERT_EQ(FlutterEngineWarmupRenderer(engine.get(), nullptr),
+            kInvalidArguments);
+
+  FlutterRendererWarmupInfo warmup_info = {};
+  warmup_info.struct_size = sizeof(FlutterRendererWarmupInfo);
+  warmup_info.features = kFlutterRendererWarmupSolidFills |
+                         kFlutterRendererWarmupGradients |
+                         kFlutterRendererWarmupText |
+                         kFlutterRendererWarmupBlurs |
+                         kFlutterRendererWarmupBlends;
+
+  // The software backend has nothing to warm up, but the request must still
+  // be accepted and serviced on the raster thread.
+  ASSERT_EQ(FlutterEngineWarmupRenderer(engine.get(), &warmup_info), kSuccess);
+}
+
 TEST_F(EmbedderTest, CanPostTaskToAllNativeThreads) {
   UniqueEngine engine;
   size_t worker_count = 0;
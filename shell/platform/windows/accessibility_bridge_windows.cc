@@ -30,15 +30,15 @@ void AccessibilityBridgeWindows::OnAccessibilityEvent(
 
   switch (event_type) {
     case ui::AXEventGenerator::Event::ALERT:
-      DispatchWinAccessibilityEvent(win_delegate, ax::mojom::Event::kAlert);
+      EnqueueWinAccessibilityEvent(win_delegate, ax::mojom::Event::kAlert);
       break;
     case ui::AXEventGenerator::Event::CHECKED_STATE_CHANGED:
-      DispatchWinAccessibilityEvent(win_delegate,
-                                    ax::mojom::Event::kValueChanged);
+      EnqueueWinAccessibilityEvent(win_delegate,
+                                   ax::mojom::Event::kValueChanged);
       break;
     case ui::AXEventGenerator::Event::CHILDREN_CHANGED:
-      DispatchWinAccessibilityEvent(win_delegate,
-                                    ax::mojom::Event::kChildrenChanged);
+      EnqueueWinAccessibilityEvent(win_delegate,
+                                   ax::mojom::Event::kChildrenChanged);
       break;
     case ui::AXEventGenerator::Event::DOCUMENT_SELECTION_CHANGED: {
       // An event indicating a change in document selection should be fired
@@ -51,57 +51,57 @@ void AccessibilityBridgeWindows::OnAccessibilityEvent(
             std::static_pointer_cast<FlutterPlatformNodeDelegateWindows>(
                 focus_delegate);
       }
-      DispatchWinAccessibilityEvent(
+      EnqueueWinAccessibilityEvent(
           win_delegate, ax::mojom::Event::kDocumentSelectionChanged);
       break;
     }
     case ui::AXEventGenerator::Event::FOCUS_CHANGED:
-      DispatchWinAccessibilityEvent(win_delegate, ax::mojom::Event::kFocus);
+      EnqueueWinAccessibilityEvent(win_delegate, ax::mojom::Event::kFocus);
       SetFocus(win_delegate);
       break;
     case ui::AXEventGenerator::Event::IGNORED_CHANGED:
       if (ax_node->IsIgnored()) {
-        DispatchWinAccessibilityEvent(win_delegate, ax::mojom::Event::kHide);
+        EnqueueWinAccessibilityEvent(win_delegate, ax::mojom::Event::kHide);
       }
       break;
     case ui::AXEventGenerator::Event::IMAGE_ANNOTATION_CHANGED:
-      DispatchWinAccessibilityEvent(win_delegate,
-                                    ax::mojom::Event::kTextChanged);
+      EnqueueWinAccessibilityEvent(win_delegate,
+                                   ax::mojom::Event::kTextChanged);
       break;
     case ui::AXEventGenerator::Event::LIVE_REGION_CHANGED:
-      DispatchWinAccessibilityEvent(win_delegate,
-                                    ax::mojom::Event::kLiveRegionChanged);
+      EnqueueWinAccessibilityEvent(win_delegate,
+                                   ax::mojom::Event::kLiveRegionChanged);
       break;
     case ui::AXEventGenerator::Event::NAME_CHANGED:
-      DispatchWinAccessibilityEvent(win_delegate,
-                                    ax::mojom::Event::kTextChanged);
+      EnqueueWinAccessibilityEvent(win_delegate,
+                                   ax::mojom::Event::kTextChanged);
       break;
     case ui::AXEventGenerator::Event::SCROLL_HORIZONTAL_POSITION_CHANGED:
-      DispatchWinAccessibilityEvent(win_delegate,
-                                    ax::mojom::Event::kScrollPositionChanged);
+      EnqueueWinAccessibilityEvent(win_delegate,
+                                   ax::mojom::Event::kScrollPositionChanged);
       break;
     case ui::AXEventGenerator::Event::SCROLL_VERTICAL_POSITION_CHANGED:
-      DispatchWinAccessibilityEvent(win_delegate,
-                                    ax::mojom::Event::kScrollPositionChanged);
+      EnqueueWinAccessibilityEvent(win_delegate,
+                                   ax::mojom::Event::kScrollPositionChanged);
       break;
     case ui::AXEventGenerator::Event::SELECTED_CHANGED:
-      DispatchWinAccessibilityEvent(win_delegate,
-                                    ax::mojom::Event::kValueChanged);
+      EnqueueWinAccessibilityEvent(win_delegate,
+                                   ax::mojom::Event::kValueChanged);
       break;
     case ui::AXEventGenerator::Event::SELECTED_CHILDREN_CHANGED:
-      DispatchWinAccessibilityEvent(win_delegate,
-                                    ax::mojom::Event::kSelectedChildrenChanged);
+      EnqueueWinAccessibilityEvent(win_delegate,
+                                   ax::mojom::Event::kSelectedChildrenChanged);
       break;
     case ui::AXEventGenerator::Event::SUBTREE_CREATED:
-      DispatchWinAccessibilityEvent(win_delegate, ax::mojom::Event::kShow);
+      EnqueueWinAccessibilityEvent(win_delegate, ax::mojom::Event::kShow);
       break;
     case ui::AXEventGenerator::Event::VALUE_CHANGED:
-      DispatchWinAccessibilityEvent(win_delegate,
-                                    ax::mojom::Event::kValueChanged);
+      EnqueueWinAccessibilityEvent(win_delegate,
+                                   ax::mojom::Event::kValueChanged);
       break;
     case ui::AXEventGenerator::Event::WIN_IACCESSIBLE_STATE_CHANGED:
-      DispatchWinAccessibilityEvent(win_delegate,
-                                    ax::mojom::Event::kStateChanged);
+      EnqueueWinAccessibilityEvent(win_delegate,
+                                   ax::mojom::Event::kStateChanged);
       break;
     case ui::AXEventGenerator::Event::ACCESS_KEY_CHANGED:
     case ui::AXEventGenerator::Event::ACTIVE_DESCENDANT_CHANGED:
@@ -159,6 +159,14 @@ void AccessibilityBridgeWindows::OnAccessibilityEvent(
   }
 }
 
+void AccessibilityBridgeWindows::OnSemanticsUpdateComplete() {
+  for (PendingEvent& pending : pending_events_) {
+    DispatchWinAccessibilityEvent(std::move(pending.node_delegate),
+                                  pending.event_type);
+  }
+  pending_events_.clear();
+}
+
 void AccessibilityBridgeWindows::DispatchAccessibilityAction(
     AccessibilityNodeId target,
     FlutterSemanticsAction action,
@@ -178,6 +186,18 @@ void AccessibilityBridgeWindows::DispatchWinAccessibilityEvent(
   node_delegate->DispatchWinAccessibilityEvent(event_type);
 }
 
+void AccessibilityBridgeWindows::EnqueueWinAccessibilityEvent(
+    std::shared_ptr<FlutterPlatformNodeDelegateWindows> node_delegate,
+    ax::mojom::Event event_type) {
+  for (const PendingEvent& pending : pending_events_) {
+    if (pending.node_delegate == node_delegate &&
+        pending.event_type == event_type) {
+      return;
+    }
+  }
+  pending_events_.push_back({std::move(node_delegate), event_type});
+}
+
 void AccessibilityBridgeWindows::SetFocus(
     std::shared_ptr<FlutterPlatformNodeDelegateWindows> node_delegate) {
   node_delegate->SetFocus();
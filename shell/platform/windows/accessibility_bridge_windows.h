@@ -5,6 +5,8 @@
 #ifndef FLUTTER_SHELL_PLATFORM_WINDOWS_ACCESSIBILITY_BRIDGE_WINDOWS_H_
 #define FLUTTER_SHELL_PLATFORM_WINDOWS_ACCESSIBILITY_BRIDGE_WINDOWS_H_
 
+#include <vector>
+
 #include "flutter/fml/macros.h"
 #include "flutter/shell/platform/common/accessibility_bridge.h"
 #include "flutter/third_party/accessibility/ax/platform/ax_fragment_root_delegate_win.h"
@@ -64,6 +66,12 @@ class AccessibilityBridgeWindows : public AccessibilityBridge,
   void OnAccessibilityEvent(
       ui::AXEventGenerator::TargetedEvent targeted_event) override;
 
+  // Dispatches the events queued by OnAccessibilityEvent in a single batch
+  // once the semantics update that generated them has been fully processed.
+  //
+  // |AccessibilityBridge|
+  void OnSemanticsUpdateComplete() override;
+
   // |AccessibilityBridge|
   std::shared_ptr<FlutterPlatformNodeDelegate>
   CreateFlutterPlatformNodeDelegate() override;
@@ -72,8 +80,25 @@ class AccessibilityBridgeWindows : public AccessibilityBridge,
   virtual std::weak_ptr<FlutterPlatformNodeDelegate> GetFocusedNode();
 
  private:
+  // A Windows accessibility event waiting to be dispatched to the OS.
+  struct PendingEvent {
+    std::shared_ptr<FlutterPlatformNodeDelegateWindows> node_delegate;
+    ax::mojom::Event event_type;
+  };
+
+  // Queues an event for dispatch once the current semantics update has been
+  // fully processed. An event that duplicates one already pending for the
+  // same node is dropped; the OS reads the node's current state at dispatch
+  // time, so the pending event supersedes it.
+  void EnqueueWinAccessibilityEvent(
+      std::shared_ptr<FlutterPlatformNodeDelegateWindows> node_delegate,
+      ax::mojom::Event event_type);
+
   FlutterWindowsView* view_;
 
+  // Events generated by the in-progress semantics update, in dispatch order.
+  std::vector<PendingEvent> pending_events_;
+
   FML_DISALLOW_COPY_AND_ASSIGN(AccessibilityBridgeWindows);
 };
 
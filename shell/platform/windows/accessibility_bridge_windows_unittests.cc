@@ -37,6 +37,7 @@ struct MsaaEvent {
 class AccessibilityBridgeWindowsSpy : public AccessibilityBridgeWindows {
  public:
   using AccessibilityBridgeWindows::OnAccessibilityEvent;
+  using AccessibilityBridgeWindows::OnSemanticsUpdateComplete;
 
   explicit AccessibilityBridgeWindowsSpy(FlutterWindowsEngine* engine,
                                          FlutterWindowsView* view)
@@ -199,6 +200,7 @@ void ExpectWinEventFromAXEvent(int32_t node_id,
   bridge->ResetRecords();
   bridge->OnAccessibilityEvent({AXNodeFromID(bridge, node_id),
                                 {ax_event, ax::mojom::EventFrom::kNone, {}}});
+  bridge->OnSemanticsUpdateComplete();
   ASSERT_EQ(bridge->dispatched_events().size(), 1);
   EXPECT_EQ(bridge->dispatched_events()[0].event_type, expected_event);
 }
@@ -224,6 +226,7 @@ void ExpectWinEventFromAXEventOnFocusNode(int32_t node_id,
       focus_delegate));
   bridge->OnAccessibilityEvent({AXNodeFromID(bridge, node_id),
                                 {ax_event, ax::mojom::EventFrom::kNone, {}}});
+  bridge->OnSemanticsUpdateComplete();
   ASSERT_EQ(bridge->dispatched_events().size(), 1);
   EXPECT_EQ(bridge->dispatched_events()[0].event_type, expected_event);
   EXPECT_EQ(bridge->dispatched_events()[0].node_delegate->GetAXNode()->id(),
@@ -317,6 +320,7 @@ TEST(AccessibilityBridgeWindows, OnAccessibilityEventFocusChanged) {
                                 {ui::AXEventGenerator::Event::FOCUS_CHANGED,
                                  ax::mojom::EventFrom::kNone,
                                  {}}});
+  bridge->OnSemanticsUpdateComplete();
   ASSERT_EQ(bridge->dispatched_events().size(), 1);
   EXPECT_EQ(bridge->dispatched_events()[0].event_type,
             ax::mojom::Event::kFocus);
@@ -386,6 +390,47 @@ TEST(AccessibilityBridgeWindows, OnAccessibilityStateChanged) {
       ax::mojom::Event::kStateChanged);
 }
 
+TEST(AccessibilityBridgeWindows, BatchesAndDeduplicatesEvents) {
+  auto engine = GetTestEngine();
+  auto window_binding_handler =
+      std::make_unique<::testing::NiceMock<MockWindowBindingHandler>>();
+  FlutterWindowsViewSpy view(std::move(window_binding_handler));
+  view.SetEngine(engine.get());
+  view.OnUpdateSemanticsEnabled(true);
+
+  auto bridge = GetAccessibilityBridgeSpy(view);
+  PopulateAXTree(bridge);
+
+  bridge->ResetRecords();
+  bridge->OnAccessibilityEvent({AXNodeFromID(bridge, 1),
+                                {ui::AXEventGenerator::Event::VALUE_CHANGED,
+                                 ax::mojom::EventFrom::kNone,
+                                 {}}});
+  bridge->OnAccessibilityEvent({AXNodeFromID(bridge, 1),
+                                {ui::AXEventGenerator::Event::VALUE_CHANGED,
+                                 ax::mojom::EventFrom::kNone,
+                                 {}}});
+  bridge->OnAccessibilityEvent({AXNodeFromID(bridge, 1),
+                                {ui::AXEventGenerator::Event::NAME_CHANGED,
+                                 ax::mojom::EventFrom::kNone,
+                                 {}}});
+
+  // No events are dispatched until the semantics update completes, and the
+  // duplicate value change is coalesced into the pending event.
+  EXPECT_EQ(bridge->dispatched_events().size(), 0);
+  bridge->OnSemanticsUpdateComplete();
+  ASSERT_EQ(bridge->dispatched_events().size(), 2);
+  EXPECT_EQ(bridge->dispatched_events()[0].event_type,
+            ax::mojom::Event::kValueChanged);
+  EXPECT_EQ(bridge->dispatched_events()[1].event_type,
+            ax::mojom::Event::kTextChanged);
+
+  // A flush leaves the queue empty for the next update.
+  bridge->ResetRecords();
+  bridge->OnSemanticsUpdateComplete();
+  EXPECT_EQ(bridge->dispatched_events().size(), 0);
+}
+
 TEST(AccessibilityBridgeWindows, OnDocumentSelectionChanged) {
   ExpectWinEventFromAXEventOnFocusNode(
       1, ui::AXEventGenerator::Event::DOCUMENT_SELECTION_CHANGED,
@@ -4,6 +4,7 @@
 
 #include "flutter/shell/platform/windows/angle_surface_manager.h"
 
+#include <cstring>
 #include <vector>
 
 #include "flutter/fml/logging.h"
@@ -16,10 +17,19 @@ static void LogEglError(std::string message) {
   FML_LOG(ERROR) << "EGL: eglGetError returned " << error;
 }
 
+// Returns true if |display| advertises |extension| in its EGL extension
+// string.
+static bool HasEglExtension(EGLDisplay display, const char* extension) {
+  const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+  return extensions != nullptr && strstr(extensions, extension) != nullptr;
+}
+
 namespace flutter {
 
 int AngleSurfaceManager::instance_count_ = 0;
 
+EGLContext AngleSurfaceManager::shared_context_ = EGL_NO_CONTEXT;
+
 std::unique_ptr<AngleSurfaceManager> AngleSurfaceManager::Create(
     bool enable_impeller) {
   std::unique_ptr<AngleSurfaceManager> manager;
@@ -176,12 +186,24 @@ bool AngleSurfaceManager::Initialize(bool enable_impeller) {
     }
   }
 
-  egl_context_ = eglCreateContext(egl_display_, egl_config_, EGL_NO_CONTEXT,
+  // Join the share group of the first live instance, if any, so that
+  // multiple windows in the same process share textures and buffers instead
+  // of duplicating them. Each context is still made current only on its own
+  // engine's raster thread. Fall back to an unshared context if the driver
+  // rejects the share (e.g. the instances resolved incompatible renderers).
+  egl_context_ = eglCreateContext(egl_display_, egl_config_, shared_context_,
                                   display_context_attributes);
+  if (egl_context_ == EGL_NO_CONTEXT && shared_context_ != EGL_NO_CONTEXT) {
+    egl_context_ = eglCreateContext(egl_display_, egl_config_, EGL_NO_CONTEXT,
+                                    display_context_attributes);
+  }
   if (egl_context_ == EGL_NO_CONTEXT) {
     LogEglError("Failed to create EGL context");
     return false;
   }
+  if (shared_context_ == EGL_NO_CONTEXT) {
+    shared_context_ = egl_context_;
+  }
 
   egl_resource_context_ = eglCreateContext(
       egl_display_, egl_config_, egl_context_, display_context_attributes);
@@ -202,6 +224,11 @@ void AngleSurfaceManager::CleanUp() {
 
   if (egl_display_ != EGL_NO_DISPLAY && egl_context_ != EGL_NO_CONTEXT) {
     result = eglDestroyContext(egl_display_, egl_context_);
+    // Contexts created after this point can no longer share with this one.
+    // Surviving members of the share group keep their shared resources.
+    if (egl_context_ == shared_context_) {
+      shared_context_ = EGL_NO_CONTEXT;
+    }
     egl_context_ = EGL_NO_CONTEXT;
 
     if (result == EGL_FALSE) {
@@ -243,10 +270,36 @@ bool AngleSurfaceManager::CreateSurface(WindowsRenderTarget* render_target,
       EGL_FIXED_SIZE_ANGLE, EGL_TRUE, EGL_WIDTH, width,
       EGL_HEIGHT,           height,   EGL_NONE};
 
-  surface = eglCreateWindowSurface(
-      egl_display_, egl_config_,
-      static_cast<EGLNativeWindowType>(std::get<HWND>(*render_target)),
-      surfaceAttributes);
+  // When ANGLE exposes its DirectComposition extension, request a flip-model
+  // swapchain presented through the compositor instead of the default
+  // blit-model HWND swapchain. Flip-model presents hand the backbuffer to the
+  // DWM without a full-surface copy and remain tear-free at swap interval 0,
+  // which lowers presentation latency. Fall back to the plain HWND surface if
+  // creation fails (e.g. on systems older than Windows 8.1).
+  if (HasEglExtension(egl_display_, "EGL_ANGLE_direct_composition")) {
+    const EGLint direct_composition_attributes[] = {
+        EGL_FIXED_SIZE_ANGLE,
+        EGL_TRUE,
+        EGL_WIDTH,
+        width,
+        EGL_HEIGHT,
+        height,
+        EGL_DIRECT_COMPOSITION_ANGLE,
+        EGL_TRUE,
+        EGL_NONE,
+    };
+    surface = eglCreateWindowSurface(
+        egl_display_, egl_config_,
+        static_cast<EGLNativeWindowType>(std::get<HWND>(*render_target)),
+        direct_composition_attributes);
+  }
+
+  if (surface == EGL_NO_SURFACE) {
+    surface = eglCreateWindowSurface(
+        egl_display_, egl_config_,
+        static_cast<EGLNativeWindowType>(std::get<HWND>(*render_target)),
+        surfaceAttributes);
+  }
   if (surface == EGL_NO_SURFACE) {
     LogEglError("Surface creation failed.");
     return false;
@@ -141,6 +141,11 @@ class AngleSurfaceManager {
   // Number of active instances of AngleSurfaceManager
   static int instance_count_;
 
+  // The first live instance's render context. Later instances create their
+  // contexts in its share group so that windows in the same process share
+  // GPU resources instead of duplicating them.
+  static EGLContext shared_context_;
+
   FML_DISALLOW_COPY_AND_ASSIGN(AngleSurfaceManager);
 };
 
@@ -31,4 +31,18 @@ void main() {
     final List<dynamic> isolateError = await errorPort.first as List<dynamic>;
     expect(isolateError[0], 'UI actions are only available on root isolate.');
   });
+
+  test('Paragraphs can be built and laid out in a background isolate', () async {
+    void buildParagraph(SendPort sendPort) {
+      final ParagraphBuilder builder = ParagraphBuilder(ParagraphStyle());
+      builder.addText('Hello');
+      final Paragraph paragraph = builder.build();
+      paragraph.layout(const ParagraphConstraints(width: 800.0));
+      sendPort.send(paragraph.height);
+    }
+    final ReceivePort port = ReceivePort();
+    await Isolate.spawn<SendPort>(buildParagraph, port.sendPort);
+    final double height = await port.first as double;
+    expect(height, isNonZero);
+  });
 }
@@ -67,6 +67,41 @@ void main() {
     }
   });
 
+  test('Can report channel buffer statistics', () async {
+    vms.VmService? vmService;
+    try {
+      final developer.ServiceProtocolInfo info = await developer.Service.getInfo();
+      if (info.serverUri == null) {
+        fail('This test must not be run with --disable-vm-service.');
+      }
+
+      ui.channelBuffers.push(
+        'test/statistics',
+        ByteData(4),
+        (ByteData? responseData) {},
+      );
+
+      vmService = await vmServiceConnectUri(
+        'ws://localhost:${info.serverUri!.port}${info.serverUri!.path}ws',
+      );
+      final String? isolateId = await getIsolateId(vmService);
+
+      final vms.Response response = await vmService.callServiceExtension(
+        'ext.ui.channelBuffers.stats',
+        isolateId: isolateId,
+      );
+      final Map<String, dynamic> channels =
+          response.json!['channels'] as Map<String, dynamic>;
+      final Map<String, dynamic> stats =
+          channels['test/statistics'] as Map<String, dynamic>;
+      expect(stats['pushedCount'], 1);
+      expect(stats['length'], 1);
+      expect(stats['hasListener'], false);
+    } finally {
+      await vmService?.dispose();
+    }
+  });
+
   test('Reload fonts request sends font change notification', () async {
     vms.VmService? vmService;
     try {
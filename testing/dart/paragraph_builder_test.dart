@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+import 'dart:typed_data';
 import 'dart:ui';
 
 import 'package:litetest/litetest.dart';
@@ -18,6 +19,25 @@ void main() {
     expect(paragraph.height, isNonZero);
   });
 
+  test('Should be able to add text as UTF-16 code units', () {
+    final ParagraphBuilder builder = ParagraphBuilder(ParagraphStyle());
+    builder.addUtf16Text(Uint16List.fromList('Hello'.codeUnits));
+    final Paragraph paragraph = builder.build();
+    expect(paragraph, isNotNull);
+
+    paragraph.layout(const ParagraphConstraints(width: 800.0));
+    expect(paragraph.width, isNonZero);
+    expect(paragraph.height, isNonZero);
+  });
+
+  test('addUtf16Text rejects unpaired surrogates', () {
+    final ParagraphBuilder builder = ParagraphBuilder(ParagraphStyle());
+    expect(
+      () => builder.addUtf16Text(Uint16List.fromList(const <int>[0xD800])),
+      throwsArgumentError,
+    );
+  });
+
   test('PushStyle should not segfault after build()', () {
     final ParagraphBuilder paragraphBuilder =
         ParagraphBuilder(ParagraphStyle());
@@ -13,7 +13,11 @@ namespace flutter {
 namespace testing {
 
 std::string GetCurrentTestName() {
-  return ::testing::UnitTest::GetInstance()->current_test_info()->name();
+  const auto* test_info =
+      ::testing::UnitTest::GetInstance()->current_test_info();
+  // Test fixtures may also be driven by benchmarks, in which case no gtest
+  // test is running.
+  return test_info != nullptr ? test_info->name() : "Benchmark";
 }
 
 std::string GetDefaultKernelFilePath() {
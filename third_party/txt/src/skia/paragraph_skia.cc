@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <optional>
 #include "display_list/dl_paint.h"
 #include "fml/logging.h"
 #include "impeller/typographer/backends/skia/text_frame_skia.h"
@@ -73,10 +74,13 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
         dl_paints_(dl_paints),
         impeller_enabled_(impeller_enabled) {}
 
+  ~DisplayListParagraphPainter() { flushPendingDecorations(); }
+
   void drawTextBlob(const sk_sp<SkTextBlob>& blob,
                     SkScalar x,
                     SkScalar y,
                     const SkPaintOrID& paint) override {
+    flushPendingDecorations();
     if (!blob) {
       return;
     }
@@ -106,6 +110,7 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
                       SkScalar y,
                       SkColor color,
                       SkScalar blur_sigma) override {
+    flushPendingDecorations();
     if (!blob) {
       return;
     }
@@ -124,6 +129,7 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
   }
 
   void drawRect(const SkRect& rect, const SkPaintOrID& paint) override {
+    flushPendingDecorations();
     size_t paint_id = std::get<PaintID>(paint);
     FML_DCHECK(paint_id < dl_paints_.size());
     builder_->DrawRect(rect, dl_paints_[paint_id]);
@@ -131,12 +137,17 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
 
   void drawFilledRect(const SkRect& rect,
                       const DecorationStyle& decor_style) override {
-    DlPaint paint = toDlPaint(decor_style, DlDrawStyle::kFill);
-    builder_->DrawRect(rect, paint);
+    SkPath& path = pendingDecorationPath(decor_style, DlDrawStyle::kFill);
+    path.addRect(rect);
+    if (pending_decorations_->count == 1) {
+      pending_decorations_->first_draw = PendingDecorations::FirstDraw::kRect;
+      pending_decorations_->first_rect = rect;
+    }
   }
 
   void drawPath(const SkPath& path,
                 const DecorationStyle& decor_style) override {
+    flushPendingDecorations();
     builder_->DrawPath(path, toDlPaint(decor_style));
   }
 
@@ -155,32 +166,130 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
     auto dash_path_effect = decor_style.getDashPathEffect();
 #ifdef IMPELLER_SUPPORTS_RENDERING
     if (impeller_enabled_ && dash_path_effect) {
-      auto path = dashedLine(x0, x1, y0, *dash_path_effect);
-      builder_->DrawPath(path, toDlPaint(decor_style));
+      SkPath& path = pendingDecorationPath(decor_style, DlDrawStyle::kStroke);
+      path.addPath(dashedLine(x0, x1, y0, *dash_path_effect));
       return;
     }
 #endif  // IMPELLER_SUPPORTS_RENDERING
 
-    auto paint = toDlPaint(decor_style);
     if (dash_path_effect) {
+      // Path effects are attributes of the paint, which rules out batching
+      // this line with other decorations.
+      flushPendingDecorations();
+      auto paint = toDlPaint(decor_style);
       setPathEffect(paint, *dash_path_effect);
+      builder_->DrawLine(SkPoint::Make(x0, y0), SkPoint::Make(x1, y1), paint);
+      return;
+    }
+
+    SkPath& path = pendingDecorationPath(decor_style, DlDrawStyle::kStroke);
+    path.moveTo(x0, y0);
+    path.lineTo(x1, y1);
+    if (pending_decorations_->count == 1) {
+      pending_decorations_->first_draw = PendingDecorations::FirstDraw::kLine;
+      pending_decorations_->first_line[0] = SkPoint::Make(x0, y0);
+      pending_decorations_->first_line[1] = SkPoint::Make(x1, y1);
     }
-    builder_->DrawLine(SkPoint::Make(x0, y0), SkPoint::Make(x1, y1), paint);
   }
 
   void clipRect(const SkRect& rect) override {
+    flushPendingDecorations();
     builder_->ClipRect(rect, DlCanvas::ClipOp::kIntersect, false);
   }
 
   void translate(SkScalar dx, SkScalar dy) override {
+    flushPendingDecorations();
     builder_->Translate(dx, dy);
   }
 
-  void save() override { builder_->Save(); }
+  void save() override {
+    flushPendingDecorations();
+    builder_->Save();
+  }
 
-  void restore() override { builder_->Restore(); }
+  void restore() override {
+    flushPendingDecorations();
+    builder_->Restore();
+  }
 
  private:
+  //----------------------------------------------------------------------------
+  /// @brief      Decoration geometry that has not been issued to the builder
+  ///             yet. skt emits one draw call per decoration per run;
+  ///             consecutive calls that share a style are coalesced into a
+  ///             single path draw.
+  struct PendingDecorations {
+    SkColor color;
+    SkScalar stroke_width;
+    DlDrawStyle draw_style;
+    SkPath path;
+    int count = 0;
+
+    // The first primitive is remembered so that a decoration that ends up
+    // not batching with anything can be replayed as its original, cheaper
+    // draw op.
+    enum class FirstDraw { kLine, kRect, kPath };
+    FirstDraw first_draw = FirstDraw::kPath;
+    SkRect first_rect;
+    SkPoint first_line[2];
+  };
+
+  SkPath& pendingDecorationPath(const DecorationStyle& decor_style,
+                                DlDrawStyle draw_style) {
+    if (pending_decorations_.has_value()) {
+      const PendingDecorations& pending = pending_decorations_.value();
+      // The stroke width only matters for stroked decorations.
+      bool style_matches =
+          pending.draw_style == draw_style &&
+          pending.color == decor_style.getColor() &&
+          (draw_style == DlDrawStyle::kFill ||
+           pending.stroke_width == decor_style.getStrokeWidth());
+      if (!style_matches) {
+        flushPendingDecorations();
+      }
+    }
+    if (!pending_decorations_.has_value()) {
+      pending_decorations_ = PendingDecorations{
+          .color = decor_style.getColor(),
+          .stroke_width = decor_style.getStrokeWidth(),
+          .draw_style = draw_style,
+      };
+    }
+    pending_decorations_->count++;
+    return pending_decorations_->path;
+  }
+
+  void flushPendingDecorations() {
+    if (!pending_decorations_.has_value()) {
+      return;
+    }
+    PendingDecorations& pending = pending_decorations_.value();
+
+    DlPaint paint;
+    paint.setDrawStyle(pending.draw_style);
+    paint.setAntiAlias(true);
+    paint.setColor(DlColor(pending.color));
+    paint.setStrokeWidth(pending.stroke_width);
+
+    if (pending.count == 1) {
+      switch (pending.first_draw) {
+        case PendingDecorations::FirstDraw::kLine:
+          builder_->DrawLine(pending.first_line[0], pending.first_line[1],
+                             paint);
+          break;
+        case PendingDecorations::FirstDraw::kRect:
+          builder_->DrawRect(pending.first_rect, paint);
+          break;
+        case PendingDecorations::FirstDraw::kPath:
+          builder_->DrawPath(pending.path, paint);
+          break;
+      }
+    } else {
+      builder_->DrawPath(pending.path, paint);
+    }
+    pending_decorations_.reset();
+  }
+
   SkPath dashedLine(SkScalar x0,
                     SkScalar x1,
                     SkScalar y0,
@@ -238,6 +347,7 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
 
   DisplayListBuilder* builder_;
   const std::vector<DlPaint>& dl_paints_;
+  std::optional<PendingDecorations> pending_decorations_;
   const bool impeller_enabled_;
 };
 
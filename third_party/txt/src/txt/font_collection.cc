@@ -40,31 +40,37 @@ FontCollection::~FontCollection() {
 }
 
 size_t FontCollection::GetFontManagersCount() const {
+  std::scoped_lock lock(mutex_);
   return GetFontManagerOrder().size();
 }
 
 void FontCollection::SetupDefaultFontManager(
     uint32_t font_initialization_data) {
+  std::scoped_lock lock(mutex_);
   default_font_manager_ = GetDefaultFontManager(font_initialization_data);
   skt_collection_.reset();
 }
 
 void FontCollection::SetDefaultFontManager(sk_sp<SkFontMgr> font_manager) {
+  std::scoped_lock lock(mutex_);
   default_font_manager_ = font_manager;
   skt_collection_.reset();
 }
 
 void FontCollection::SetAssetFontManager(sk_sp<SkFontMgr> font_manager) {
+  std::scoped_lock lock(mutex_);
   asset_font_manager_ = font_manager;
   skt_collection_.reset();
 }
 
 void FontCollection::SetDynamicFontManager(sk_sp<SkFontMgr> font_manager) {
+  std::scoped_lock lock(mutex_);
   dynamic_font_manager_ = font_manager;
   skt_collection_.reset();
 }
 
 void FontCollection::SetTestFontManager(sk_sp<SkFontMgr> font_manager) {
+  std::scoped_lock lock(mutex_);
   test_font_manager_ = font_manager;
   skt_collection_.reset();
 }
@@ -84,6 +90,7 @@ std::vector<sk_sp<SkFontMgr>> FontCollection::GetFontManagerOrder() const {
 }
 
 void FontCollection::DisableFontFallback() {
+  std::scoped_lock lock(mutex_);
   enable_font_fallback_ = false;
   if (skt_collection_) {
     skt_collection_->disableFontFallback();
@@ -91,6 +98,7 @@ void FontCollection::DisableFontFallback() {
 }
 
 void FontCollection::ClearFontFamilyCache() {
+  std::scoped_lock lock(mutex_);
   if (skt_collection_) {
     skt_collection_->clearCaches();
   }
@@ -98,6 +106,13 @@ void FontCollection::ClearFontFamilyCache() {
 
 sk_sp<skia::textlayout::FontCollection>
 FontCollection::CreateSktFontCollection() {
+  std::scoped_lock lock(mutex_);
+  // A single skia::textlayout::FontCollection is shared by every paragraph
+  // built against this collection. Besides typeface resolution, it owns
+  // SkParagraph's ParagraphCache, which reuses shaped runs across paragraphs
+  // with equal text and styles. Resetting skt_collection_ therefore discards
+  // all shaped-text reuse and should only happen when the set of font
+  // managers actually changes.
   if (!skt_collection_) {
     skt_collection_ = sk_make_sp<skia::textlayout::FontCollection>();
 
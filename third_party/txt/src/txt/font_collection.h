@@ -18,6 +18,7 @@
 #define LIB_TXT_SRC_FONT_COLLECTION_H_
 
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -57,6 +58,10 @@ class FontCollection : public std::enable_shared_from_this<FontCollection> {
   sk_sp<skia::textlayout::FontCollection> CreateSktFontCollection();
 
  private:
+  // Paragraphs may be built and laid out on background isolates while fonts
+  // are registered on the UI thread, so access to the font managers and the
+  // Skia collection is serialized.
+  mutable std::mutex mutex_;
   sk_sp<SkFontMgr> default_font_manager_;
   sk_sp<SkFontMgr> asset_font_manager_;
   sk_sp<SkFontMgr> dynamic_font_manager_;
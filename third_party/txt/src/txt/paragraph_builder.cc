@@ -36,4 +36,8 @@ std::unique_ptr<ParagraphBuilder> ParagraphBuilder::CreateSkiaBuilder(
                                                 impeller_enabled);
 }
 
+void ParagraphBuilder::AddText(const char16_t* text, size_t length) {
+  AddText(std::u16string(text, length));
+}
+
 }  // namespace txt
@@ -62,6 +62,12 @@ class ParagraphBuilder {
   // on the style_stack_;
   virtual void AddText(const std::u16string& text) = 0;
 
+  // Adds a run of UTF-16 text to the builder without requiring the caller to
+  // materialize a std::u16string first. The run is copied once into the
+  // backing builder; callers that already hold the code units (e.g. a pinned
+  // typed data view) avoid the extra conversion copy at the binding layer.
+  virtual void AddText(const char16_t* text, size_t length);
+
   // Pushes the information required to leave an open space, where Flutter may
   // draw a custom placeholder into.
   //
@@ -144,6 +144,23 @@ TEST_F(PainterTest, DrawsSolidLineSkia) {
   EXPECT_FALSE(recorder.hasPathEffect());
 }
 
+TEST_F(PainterTest, BatchesDecorationsIntoOnePathSkia) {
+  PretendImpellerIsEnabled(false);
+
+  auto style = makeDecoratedStyle(txt::TextDecorationStyle::kSolid);
+  style.decoration = static_cast<txt::TextDecoration>(
+      txt::TextDecoration::kUnderline | txt::TextDecoration::kOverline |
+      txt::TextDecoration::kLineThrough);
+
+  auto recorder = DlOpRecorder();
+  draw(style)->Dispatch(recorder);
+
+  // The three solid decorations share a style and are batched into a single
+  // path draw instead of three rects.
+  EXPECT_EQ(recorder.pathCount(), 1);
+  EXPECT_EQ(recorder.rectCount(), 0);
+}
+
 TEST_F(PainterTest, DrawDashedLineSkia) {
   PretendImpellerIsEnabled(false);
 
@@ -170,6 +187,23 @@ TEST_F(PainterTest, DrawsSolidLineImpeller) {
   EXPECT_FALSE(recorder.hasPathEffect());
 }
 
+TEST_F(PainterTest, BatchesDecorationsIntoOnePathImpeller) {
+  PretendImpellerIsEnabled(true);
+
+  auto style = makeDecoratedStyle(txt::TextDecorationStyle::kSolid);
+  style.decoration = static_cast<txt::TextDecoration>(
+      txt::TextDecoration::kUnderline | txt::TextDecoration::kOverline |
+      txt::TextDecoration::kLineThrough);
+
+  auto recorder = DlOpRecorder();
+  draw(style)->Dispatch(recorder);
+
+  // The three solid decorations share a style and are batched into a single
+  // path draw instead of three rects.
+  EXPECT_EQ(recorder.pathCount(), 1);
+  EXPECT_EQ(recorder.rectCount(), 0);
+}
+
 TEST_F(PainterTest, DrawDashedLineImpeller) {
   PretendImpellerIsEnabled(true);
 